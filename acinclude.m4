@@ -1,13 +1,16 @@
 dnl Checks for required headers and functions
 dnl
-dnl Version: 20260606
+dnl Version: 20261018
 
 dnl Function to detect if libtableau dependencies are available
 AC_DEFUN([AX_LIBTABLEAU_CHECK_LOCAL],
-  [AC_CHECK_HEADERS([errno.h])
+  [AC_CHECK_HEADERS([errno.h linux/fs.h poll.h scsi/sg.h sys/ioctl.h sys/stat.h unistd.h])
 
   dnl Check for internationalization functions in libtableau/libtableau_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for timing functions in libtableau/libtableau_handle.c
+  AC_CHECK_FUNCS([clock_gettime])
 ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,390 @@
+/*
+ * Debug trace functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include <stdarg.h>
+
+#include "libtableau_debug_trace.h"
+#include "libtableau_definitions.h"
+#include "libtableau_libcerror.h"
+#include "libtableau_libcnotify.h"
+#include "libtableau_libcthreads.h"
+#include "libtableau_unused.h"
+
+#if defined( HAVE_DEBUG_OUTPUT )
+
+/* Every thread has its own buffer, so that appending a record does not
+ * require a lock and does not write to the notify stream
+ */
+#if !defined( HAVE_LIBTABLEAU_MULTI_THREAD_SUPPORT )
+#define LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL
+
+#elif defined( _MSC_VER )
+#define LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL	__declspec( thread )
+
+#elif defined( __GNUC__ )
+#define LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL	__thread
+
+#endif
+
+#if defined( LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL )
+
+/* The records of the thread, used as a ring buffer
+ */
+static LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL libtableau_debug_trace_record_t libtableau_debug_trace_records[ LIBTABLEAU_DEBUG_TRACE_NUMBER_OF_RECORDS ];
+
+/* The number of records appended by the thread
+ */
+static LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL uint64_t libtableau_debug_trace_number_of_appended_records = 0;
+
+/* The number of records appended by the thread when it was last flushed
+ */
+static LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL uint64_t libtableau_debug_trace_number_of_flushed_records = 0;
+
+/* Retrieves the next record of the debug trace of the current thread
+ * The record is cleared and counted as appended
+ */
+static libtableau_debug_trace_record_t *libtableau_debug_trace_get_next_record(
+                                         void )
+{
+	libtableau_debug_trace_record_t *record = NULL;
+
+	record = &( libtableau_debug_trace_records[ libtableau_debug_trace_number_of_appended_records % LIBTABLEAU_DEBUG_TRACE_NUMBER_OF_RECORDS ] );
+
+	record->function         = NULL;
+	record->description[ 0 ] = 0;
+	record->data_size        = 0;
+
+	libtableau_debug_trace_number_of_appended_records += 1;
+
+	return( record );
+}
+
+#endif /* defined( LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL ) */
+
+/* Appends a record to the debug trace of the current thread
+ * The record is printed when the debug trace is flushed, once the buffer
+ * is full the oldest record is overwritten. A description or data that
+ * exceeds the maximum size is truncated
+ * Without thread local storage the record is printed immediately
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_debug_trace_append_record(
+     const char *function,
+     const char *description,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+#if defined( LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL )
+	libtableau_debug_trace_record_t *record = NULL;
+	size_t description_length               = 0;
+#endif
+
+	static char *function_name              = "libtableau_debug_trace_append_record";
+
+	if( function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function.",
+		 function_name );
+
+		return( -1 );
+	}
+	if( description == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid description.",
+		 function_name );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function_name );
+
+		return( -1 );
+	}
+#if defined( LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL )
+	if( data_size > LIBTABLEAU_DEBUG_TRACE_MAXIMUM_DATA_SIZE )
+	{
+		data_size = LIBTABLEAU_DEBUG_TRACE_MAXIMUM_DATA_SIZE;
+	}
+	description_length = narrow_string_length(
+	                      description );
+
+	if( description_length >= LIBTABLEAU_DEBUG_TRACE_DESCRIPTION_SIZE )
+	{
+		description_length = LIBTABLEAU_DEBUG_TRACE_DESCRIPTION_SIZE - 1;
+	}
+	record = libtableau_debug_trace_get_next_record();
+
+	record->function = function;
+
+	if( memory_copy(
+	     record->description,
+	     description,
+	     description_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy description.",
+		 function_name );
+
+		return( -1 );
+	}
+	record->description[ description_length ] = 0;
+
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     record->data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function_name );
+
+			return( -1 );
+		}
+		record->data_size = (uint16_t) data_size;
+	}
+#else
+	libcnotify_printf(
+	 "%s: %s\n",
+	 function,
+	 description );
+
+	if( data_size > 0 )
+	{
+		libcnotify_print_data(
+		 data,
+		 data_size,
+		 0 );
+	}
+#endif /* defined( LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL ) */
+
+	return( 1 );
+}
+
+/* Appends a record with a formatted description to the debug trace of
+ * the current thread
+ * The description is formatted when the record is appended and truncated
+ * if it exceeds the description size
+ * Without thread local storage the record is printed immediately
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_debug_trace_printf(
+     const char *function,
+     const char *format,
+     ... )
+{
+#if defined( LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL )
+	libtableau_debug_trace_record_t *record = NULL;
+#else
+	char description[ LIBTABLEAU_DEBUG_TRACE_DESCRIPTION_SIZE ];
+#endif
+
+	va_list argument_list;
+
+	int print_count                         = 0;
+
+	if( ( function == NULL )
+	 || ( format == NULL ) )
+	{
+		return( -1 );
+	}
+#if defined( LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL )
+	record = libtableau_debug_trace_get_next_record();
+
+	record->function = function;
+
+	va_start(
+	 argument_list,
+	 format );
+
+	print_count = narrow_string_vsnprintf(
+	               record->description,
+	               LIBTABLEAU_DEBUG_TRACE_DESCRIPTION_SIZE,
+	               format,
+	               argument_list );
+
+	va_end(
+	 argument_list );
+
+	record->description[ LIBTABLEAU_DEBUG_TRACE_DESCRIPTION_SIZE - 1 ] = 0;
+#else
+	va_start(
+	 argument_list,
+	 format );
+
+	print_count = narrow_string_vsnprintf(
+	               description,
+	               LIBTABLEAU_DEBUG_TRACE_DESCRIPTION_SIZE,
+	               format,
+	               argument_list );
+
+	va_end(
+	 argument_list );
+
+	description[ LIBTABLEAU_DEBUG_TRACE_DESCRIPTION_SIZE - 1 ] = 0;
+
+	libcnotify_printf(
+	 "%s: %s\n",
+	 function,
+	 description );
+#endif
+	if( print_count < 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of records of the debug trace of the current thread
+ * that were not flushed and were not overwritten
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_debug_trace_get_number_of_records(
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function              = "libtableau_debug_trace_get_number_of_records";
+
+#if defined( LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL )
+	uint64_t number_of_pending_records = 0;
+#endif
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL )
+	number_of_pending_records = libtableau_debug_trace_number_of_appended_records
+	                          - libtableau_debug_trace_number_of_flushed_records;
+
+	if( number_of_pending_records > LIBTABLEAU_DEBUG_TRACE_NUMBER_OF_RECORDS )
+	{
+		number_of_pending_records = LIBTABLEAU_DEBUG_TRACE_NUMBER_OF_RECORDS;
+	}
+	*number_of_records = (int) number_of_pending_records;
+#else
+	*number_of_records = 0;
+#endif
+	return( 1 );
+}
+
+/* Prints the records of the debug trace of the current thread that were
+ * appended since the last flush
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_debug_trace_flush(
+     libcerror_error_t **error )
+{
+#if defined( LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL )
+	libtableau_debug_trace_record_t *record = NULL;
+	static char *function                   = "libtableau_debug_trace_flush";
+	uint64_t number_of_dropped_records      = 0;
+	uint64_t record_number                  = 0;
+	int number_of_records                   = 0;
+
+	if( libtableau_debug_trace_get_number_of_records(
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	record_number             = libtableau_debug_trace_number_of_appended_records - (uint64_t) number_of_records;
+	number_of_dropped_records = record_number - libtableau_debug_trace_number_of_flushed_records;
+
+	if( number_of_dropped_records > 0 )
+	{
+		libcnotify_printf(
+		 "%s: %" PRIu64 " records were overwritten before they were flushed.\n",
+		 function,
+		 number_of_dropped_records );
+	}
+	while( record_number < libtableau_debug_trace_number_of_appended_records )
+	{
+		record = &( libtableau_debug_trace_records[ record_number % LIBTABLEAU_DEBUG_TRACE_NUMBER_OF_RECORDS ] );
+
+		libcnotify_printf(
+		 "%s: %s\n",
+		 record->function,
+		 record->description );
+
+		if( record->data_size > 0 )
+		{
+			libcnotify_print_data(
+			 record->data,
+			 (size_t) record->data_size,
+			 0 );
+		}
+		record_number++;
+	}
+	libtableau_debug_trace_number_of_flushed_records = libtableau_debug_trace_number_of_appended_records;
+
+#else
+	LIBTABLEAU_UNREFERENCED_PARAMETER( error )
+
+#endif /* defined( LIBTABLEAU_DEBUG_TRACE_THREAD_LOCAL ) */
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
@@ -0,0 +1,84 @@
+/*
+ * Debug trace functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBTABLEAU_DEBUG_TRACE_H )
+#define _LIBTABLEAU_DEBUG_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libtableau_definitions.h"
+#include "libtableau_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_DEBUG_OUTPUT )
+
+typedef struct libtableau_debug_trace_record libtableau_debug_trace_record_t;
+
+struct libtableau_debug_trace_record
+{
+	/* The name of the function that appended the record
+	 */
+	const char *function;
+
+	/* The description of the event
+	 */
+	char description[ LIBTABLEAU_DEBUG_TRACE_DESCRIPTION_SIZE ];
+
+	/* The size of the data
+	 */
+	uint16_t data_size;
+
+	/* The data
+	 */
+	uint8_t data[ LIBTABLEAU_DEBUG_TRACE_MAXIMUM_DATA_SIZE ];
+};
+
+int libtableau_debug_trace_append_record(
+     const char *function,
+     const char *description,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libtableau_debug_trace_printf(
+     const char *function,
+     const char *format,
+     ... );
+
+int libtableau_debug_trace_get_number_of_records(
+     int *number_of_records,
+     libcerror_error_t **error );
+
+int libtableau_debug_trace_flush(
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBTABLEAU_DEBUG_TRACE_H ) */
+
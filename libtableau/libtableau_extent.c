@@ -0,0 +1,171 @@
+/*
+ * Acquisition extent functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libtableau_definitions.h"
+#include "libtableau_extent.h"
+#include "libtableau_libcerror.h"
+
+/* Determines the extents that cover the user area, the HPA and the DCO of a drive
+ * The HPA ranges from the drive number of sectors up to the HPA number of sectors
+ * and the DCO from there up to the DCO number of sectors. If no drive number of sectors
+ * is known, e.g. the device was not queried, the media is planned as a single user area.
+ * Sectors the device reports beyond the DCO number of sectors are added to the last area.
+ * The part of an area beyond the media number of sectors is planned as a separate extent
+ * that is flagged inaccessible, since it cannot be read without removing the HPA or DCO
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_extent_plan(
+     libtableau_extent_t *extents,
+     int maximum_number_of_extents,
+     int *number_of_extents,
+     uint64_t media_number_of_sectors,
+     uint64_t drive_number_of_sectors,
+     uint64_t hpa_number_of_sectors,
+     uint64_t dco_number_of_sectors,
+     libcerror_error_t **error )
+{
+	uint64_t area_end_sectors[ 3 ];
+
+	uint8_t area_types[ 3 ]    = { LIBTABLEAU_EXTENT_TYPE_USER, LIBTABLEAU_EXTENT_TYPE_HPA, LIBTABLEAU_EXTENT_TYPE_DCO };
+	static char *function      = "libtableau_extent_plan";
+	uint64_t area_end_sector   = 0;
+	uint64_t area_start_sector = 0;
+	uint64_t split_sector      = 0;
+	int area_index             = 0;
+	int extent_index           = 0;
+
+	if( extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_extents < LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid maximum number of extents value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( drive_number_of_sectors == 0 )
+	{
+		drive_number_of_sectors = media_number_of_sectors;
+		hpa_number_of_sectors   = 0;
+		dco_number_of_sectors   = 0;
+	}
+	area_end_sectors[ 0 ] = drive_number_of_sectors;
+	area_end_sectors[ 1 ] = area_end_sectors[ 0 ];
+
+	if( hpa_number_of_sectors > area_end_sectors[ 1 ] )
+	{
+		area_end_sectors[ 1 ] = hpa_number_of_sectors;
+	}
+	area_end_sectors[ 2 ] = area_end_sectors[ 1 ];
+
+	if( dco_number_of_sectors > area_end_sectors[ 2 ] )
+	{
+		area_end_sectors[ 2 ] = dco_number_of_sectors;
+	}
+	if( media_number_of_sectors > area_end_sectors[ 2 ] )
+	{
+		for( area_index = 2;
+		     area_index > 0;
+		     area_index-- )
+		{
+			if( area_end_sectors[ area_index ] > area_end_sectors[ area_index - 1 ] )
+			{
+				break;
+			}
+		}
+		for( ;
+		     area_index < 3;
+		     area_index++ )
+		{
+			area_end_sectors[ area_index ] = media_number_of_sectors;
+		}
+	}
+	for( area_index = 0;
+	     area_index < 3;
+	     area_index++ )
+	{
+		area_end_sector = area_end_sectors[ area_index ];
+
+		if( area_end_sector <= area_start_sector )
+		{
+			continue;
+		}
+		split_sector = area_end_sector;
+
+		if( ( area_start_sector < media_number_of_sectors )
+		 && ( area_end_sector > media_number_of_sectors ) )
+		{
+			split_sector = media_number_of_sectors;
+		}
+		extents[ extent_index ].start_sector      = area_start_sector;
+		extents[ extent_index ].number_of_sectors = split_sector - area_start_sector;
+		extents[ extent_index ].type              = area_types[ area_index ];
+		extents[ extent_index ].flags             = 0;
+
+		if( area_start_sector >= media_number_of_sectors )
+		{
+			extents[ extent_index ].flags |= LIBTABLEAU_EXTENT_FLAG_IS_INACCESSIBLE;
+		}
+		extent_index++;
+
+		if( split_sector < area_end_sector )
+		{
+			extents[ extent_index ].start_sector      = split_sector;
+			extents[ extent_index ].number_of_sectors = area_end_sector - split_sector;
+			extents[ extent_index ].type              = area_types[ area_index ];
+			extents[ extent_index ].flags             = LIBTABLEAU_EXTENT_FLAG_IS_INACCESSIBLE;
+
+			extent_index++;
+		}
+		area_start_sector = area_end_sector;
+	}
+	*number_of_extents = extent_index;
+
+	return( 1 );
+}
+
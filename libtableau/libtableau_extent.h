@@ -0,0 +1,70 @@
+/*
+ * Acquisition extent functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBTABLEAU_EXTENT_H )
+#define _LIBTABLEAU_EXTENT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libtableau_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libtableau_extent libtableau_extent_t;
+
+struct libtableau_extent
+{
+	/* The first sector of the extent
+	 */
+	uint64_t start_sector;
+
+	/* The number of sectors of the extent
+	 */
+	uint64_t number_of_sectors;
+
+	/* The extent type
+	 */
+	uint8_t type;
+
+	/* The extent flags
+	 */
+	uint32_t flags;
+};
+
+int libtableau_extent_plan(
+     libtableau_extent_t *extents,
+     int maximum_number_of_extents,
+     int *number_of_extents,
+     uint64_t media_number_of_sectors,
+     uint64_t drive_number_of_sectors,
+     uint64_t hpa_number_of_sectors,
+     uint64_t dco_number_of_sectors,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBTABLEAU_EXTENT_H ) */
+
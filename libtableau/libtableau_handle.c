@@ -37,15 +37,22 @@
 #include <errno.h>
 #endif
 
+#include <time.h>
+
+#include "libtableau_debug_trace.h"
 #include "libtableau_definitions.h"
+#include "libtableau_extent.h"
 #include "libtableau_handle.h"
 #include "libtableau_io.h"
+#include "libtableau_io_queue.h"
 #include "libtableau_libcerror.h"
 #include "libtableau_libclocale.h"
 #include "libtableau_libcnotify.h"
+#include "libtableau_libcthreads.h"
 #include "libtableau_libuna.h"
 #include "libtableau_query.h"
 #include "libtableau_security_values.h"
+#include "libtableau_trace.h"
 #include "libtableau_values.h"
 #include "libtableau_values_table.h"
 
@@ -157,7 +164,24 @@ int libtableau_handle_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBTABLEAU_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_handle->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	internal_handle->file_descriptor = -1;
+	internal_handle->timeout         = LIBTABLEAU_DEFAULT_TIMEOUT;
+	internal_handle->abort_flag      = &( internal_handle->abort );
 
 	*handle = (libtableau_handle_t *) internal_handle;
 
@@ -214,7 +238,7 @@ int libtableau_handle_free(
 		if( internal_handle->file_descriptor != -1 )
 		{
 			if( libtableau_handle_close(
-			     *handle,
+			     (libtableau_handle_t *) internal_handle,
 			     error ) != 0 )
 			{
 				libcerror_error_set(
@@ -253,12 +277,222 @@ int libtableau_handle_free(
 
 			result = -1;
 		}
+		if( internal_handle->trace != NULL )
+		{
+			if( libtableau_trace_free(
+			     &( internal_handle->trace ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free trace.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBTABLEAU_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_handle->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_handle );
 	}
 	return( result );
 }
 
+/* Signals the handle to abort its current activity
+ * A command that is being send to the device is interrupted
+ * The function only sets the abort flag, hence it can be called from a signal handler
+ * The flag of the handle is cleared when the device is opened and when a query
+ * or the removal of a DCO starts, reads fail until then so that concurrent
+ * reads all stop
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_signal_abort(
+     libtableau_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_signal_abort";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	*( internal_handle->abort_flag ) = 1;
+
+	return( 1 );
+}
+
+/* Sets the flag that signals the handle to abort
+ * A signal handler of the caller only needs to set the flag to interrupt
+ * a command that is being send to the device, the flag is not cleared by
+ * the handle, every command fails until the caller clears it
+ * If abort_flag is NULL the flag of the handle is used
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_set_abort_flag(
+     libtableau_handle_t *handle,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_set_abort_flag";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( abort_flag == NULL )
+	{
+		internal_handle->abort_flag = &( internal_handle->abort );
+	}
+	else
+	{
+		internal_handle->abort_flag = abort_flag;
+	}
+	return( 1 );
+}
+
+/* Retrieves the current value of a monotonic clock in nanoseconds
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+static int libtableau_handle_get_monotonic_time(
+            uint64_t *monotonic_time,
+            libcerror_error_t **error )
+{
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+#endif
+
+	static char *function = "libtableau_handle_get_monotonic_time";
+
+	if( monotonic_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid monotonic time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve monotonic time.",
+		 function );
+
+		return( -1 );
+	}
+	*monotonic_time = ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec;
+
+	return( 1 );
+#else
+	*monotonic_time = 0;
+
+	return( 0 );
+#endif
+}
+
+/* Appends a record of a phase to the trace
+ * The trace is best effort, a failure to append a record does not affect
+ * the open or query and is only printed with debug output
+ */
+static void libtableau_internal_handle_append_trace_record(
+             libtableau_internal_handle_t *internal_handle,
+             uint8_t phase )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libtableau_internal_handle_append_trace_record";
+	uint64_t timestamp       = 0;
+
+	if( internal_handle == NULL )
+	{
+		return;
+	}
+	if( libtableau_handle_get_monotonic_time(
+	     &timestamp,
+	     &error ) == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve timestamp.",
+		 function );
+
+		goto on_error;
+	}
+	if( libtableau_trace_append_record(
+	     internal_handle->trace,
+	     phase,
+	     timestamp,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append trace record.",
+		 function );
+
+		goto on_error;
+	}
+	return;
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+}
+
 /* Opens a device
  * Returns 1 if successful or -1 on error
  */
@@ -317,6 +551,14 @@ int libtableau_handle_open(
 
 		return( -1 );
 	}
+	internal_handle->abort = 0;
+
+	if( internal_handle->trace != NULL )
+	{
+		libtableau_internal_handle_append_trace_record(
+		 internal_handle,
+		 LIBTABLEAU_TRACE_PHASE_OPEN_START );
+	}
 #if defined( HAVE_SCSI_SG_PT_H )
 	internal_handle->file_descriptor = scsi_pt_open_device(
 	                                    filename,
@@ -333,7 +575,35 @@ int libtableau_handle_open(
 		 "%s: unable to open file.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	/* The IO queue is created per open since the sg driver discards
+	 * outstanding commands when the file descriptor is closed
+	 */
+	if( libtableau_io_queue_initialize(
+	     &( internal_handle->io_queue ),
+	     LIBTABLEAU_RECV_SIZE + LIBTABLEAU_SENSE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO queue.",
+		 function );
+
+		scsi_pt_close_device(
+		 internal_handle->file_descriptor );
+
+		internal_handle->file_descriptor = -1;
+
+		goto on_error;
+	}
+	if( internal_handle->trace != NULL )
+	{
+		libtableau_internal_handle_append_trace_record(
+		 internal_handle,
+		 LIBTABLEAU_TRACE_PHASE_OPEN_END );
 	}
 	return( 1 );
 #else
@@ -344,9 +614,16 @@ int libtableau_handle_open(
 	 "%s: missing SCSI support.",
 	 function );
 
-	return( -1 );
-
 #endif /* defined( HAVE_SCSI_SG_PT_H ) */
+
+on_error:
+	if( internal_handle->trace != NULL )
+	{
+		libtableau_internal_handle_append_trace_record(
+		 internal_handle,
+		 LIBTABLEAU_TRACE_PHASE_FAILED );
+	}
+	return( -1 );
 }
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
@@ -416,6 +693,14 @@ int libtableau_handle_open_wide(
 
 		return( -1 );
 	}
+	internal_handle->abort = 0;
+
+	if( internal_handle->trace != NULL )
+	{
+		libtableau_internal_handle_append_trace_record(
+		 internal_handle,
+		 LIBTABLEAU_TRACE_PHASE_OPEN_START );
+	}
 #if defined( HAVE_SCSI_SG_PT_H )
 	filename_length = wide_string_length(
 	                   filename );
@@ -526,7 +811,7 @@ int libtableau_handle_open_wide(
 		 "%s: unable to set narrow filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	internal_handle->file_descriptor = scsi_pt_open_device(
 	                                    narrow_filename,
@@ -545,15 +830,35 @@ int libtableau_handle_open_wide(
 
 		goto on_error;
 	}
-	return( 1 );
+	/* The IO queue is created per open since the sg driver discards
+	 * outstanding commands when the file descriptor is closed
+	 */
+	if( libtableau_io_queue_initialize(
+	     &( internal_handle->io_queue ),
+	     LIBTABLEAU_RECV_SIZE + LIBTABLEAU_SENSE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO queue.",
+		 function );
 
-on_error:
-	if( narrow_filename != NULL )
+		scsi_pt_close_device(
+		 internal_handle->file_descriptor );
+
+		internal_handle->file_descriptor = -1;
+
+		goto on_error;
+	}
+	if( internal_handle->trace != NULL )
 	{
-		memory_free(
-		 narrow_filename );
+		libtableau_internal_handle_append_trace_record(
+		 internal_handle,
+		 LIBTABLEAU_TRACE_PHASE_OPEN_END );
 	}
-	return( -1 );
+	return( 1 );
 #else
 	libcerror_error_set(
 	 error,
@@ -562,9 +867,23 @@ on_error:
 	 "%s: missing SCSI support.",
 	 function );
 
-	return( -1 );
-
 #endif /* defined( HAVE_SCSI_SG_PT_H ) */
+
+on_error:
+	if( internal_handle->trace != NULL )
+	{
+		libtableau_internal_handle_append_trace_record(
+		 internal_handle,
+		 LIBTABLEAU_TRACE_PHASE_FAILED );
+	}
+#if defined( HAVE_SCSI_SG_PT_H )
+	if( narrow_filename != NULL )
+	{
+		memory_free(
+		 narrow_filename );
+	}
+#endif
+	return( -1 );
 }
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
@@ -607,6 +926,23 @@ int libtableau_handle_close(
 
 		return( -1 );
 	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	/* The debug trace is printed when the device is closed so that
+	 * the queries are not slowed down by the notify stream
+	 */
+	if( libtableau_debug_trace_flush(
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to flush debug trace.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 #if defined( HAVE_SCSI_SG_PT_H )
 	result = scsi_pt_close_device(
 	          internal_handle->file_descriptor );
@@ -623,7 +959,29 @@ int libtableau_handle_close(
 
 		return( -1 );
 	}
-	internal_handle->file_descriptor = -1;
+	internal_handle->file_descriptor          = -1;
+
+	/* The sg driver discards the responses of abandoned commands when
+	 * the file descriptor is closed hence their buffers can be freed
+	 */
+	if( libtableau_io_queue_free(
+	     &( internal_handle->io_queue ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->query_durations_measured = 0;
+	internal_handle->media_values_determined  = 0;
+	internal_handle->media_size               = 0;
+	internal_handle->bytes_per_sector         = 0;
+	internal_handle->maximum_transfer_size    = 0;
 
 	return( 0 );
 #else
@@ -639,24 +997,17 @@ int libtableau_handle_close(
 #endif /* defined( HAVE_SCSI_SG_PT_H ) */
 }
 
-/* Queries the opened device for Tableau information
+/* Retrieves the timeout
+ * The timeout is the number of seconds the device is given to complete a command
  * Returns 1 if successful or -1 on error
  */
-int libtableau_handle_query(
+int libtableau_handle_get_timeout(
      libtableau_handle_t *handle,
+     uint32_t *timeout,
      libcerror_error_t **error )
 {
-	tableau_query_t tableau_query;
-
-	uint8_t recv_buffer[ LIBTABLEAU_RECV_SIZE ];
-	uint8_t sense_buffer[ LIBTABLEAU_SENSE_SIZE ];
-
 	libtableau_internal_handle_t *internal_handle = NULL;
-	tableau_header_t *tableau_header              = NULL;
-	tableau_page_t *tableau_page                  = NULL;
-	static char *function                         = "libtableau_handle_query";
-	ssize_t recv_buffer_offset                    = 0;
-	int result                                    = 0;
+	static char *function                         = "libtableau_handle_get_timeout";
 
 	if( handle == NULL )
 	{
@@ -671,21 +1022,135 @@ int libtableau_handle_query(
 	}
 	internal_handle = (libtableau_internal_handle_t *) handle;
 
-	if( internal_handle->file_descriptor == -1 )
+	if( timeout == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing file descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeout.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_set(
-	     &tableau_query,
-	     0,
-	     sizeof( tableau_query_t ) ) == NULL )
+	*timeout = internal_handle->timeout;
+
+	return( 1 );
+}
+
+/* Sets the timeout
+ * The timeout is the number of seconds the device is given to complete a command
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_set_timeout(
+     libtableau_handle_t *handle,
+     uint32_t timeout,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_set_timeout";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( ( timeout == 0 )
+	 || ( timeout > (uint32_t) LIBTABLEAU_MAXIMUM_TIMEOUT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid timeout value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->timeout = timeout;
+
+	return( 1 );
+}
+
+/* Sends the query command to the opened device and receives the response
+ * The response is not parsed
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_internal_handle_send_query(
+     libtableau_internal_handle_t *internal_handle,
+     uint8_t *recv_buffer,
+     size_t recv_buffer_size,
+     libcerror_error_t **error )
+{
+	tableau_query_t tableau_query;
+
+	uint8_t sense_buffer[ LIBTABLEAU_SENSE_SIZE ];
+
+	static char *function    = "libtableau_internal_handle_send_query";
+	uint64_t end_time        = 0;
+	uint64_t start_time      = 0;
+	uint8_t timed_out        = 0;
+	int result               = 0;
+	int start_time_available = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( recv_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recv buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( recv_buffer_size != LIBTABLEAU_RECV_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recv buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->query_durations_measured = 0;
+
+	if( memory_set(
+	     &tableau_query,
+	     0,
+	     sizeof( tableau_query_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -699,105 +1164,1168 @@ int libtableau_handle_query(
 	if( memory_set(
 	     recv_buffer,
 	     0,
-	     LIBTABLEAU_RECV_SIZE ) == NULL )
+	     recv_buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear recv buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     sense_buffer,
+	     0,
+	     LIBTABLEAU_SENSE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sense buffer.",
+		 function );
+
+		return( -1 );
+	}
+	tableau_query.opcode        = TABLEAU_QUERY_SCSI_OPCODE;
+	tableau_query.subcommand    = TABLEAU_QUERY_SUBCOMMAND_QUERY;
+	tableau_query.response_size = LIBTABLEAU_RECV_SIZE;
+
+	internal_handle->command_identifier = ( internal_handle->command_identifier + 1 ) % 0x7fff;
+
+	start_time_available = libtableau_handle_get_monotonic_time(
+	                        &start_time,
+	                        error );
+
+	if( start_time_available == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libtableau_io_send_command(
+	          internal_handle->file_descriptor,
+	          internal_handle->io_queue,
+	          (uint8_t *) &tableau_query,
+	          6,
+	          recv_buffer,
+	          LIBTABLEAU_RECV_SIZE,
+	          sense_buffer,
+	          LIBTABLEAU_SENSE_SIZE,
+	          internal_handle->timeout,
+	          internal_handle->command_identifier,
+	          internal_handle->abort_flag,
+	          &timed_out,
+	          error );
+
+	/* A fixed (0x70 or 0x71) or descriptor (0x72 or 0x73) format response code
+	 * indicates the device returned sense data, which a query does not
+	 * necessarily fail on
+	 */
+	if( ( sense_buffer[ 0 ] & 0x7c ) == 0x70 )
+	{
+		internal_handle->number_of_query_sense_errors += 1;
+	}
+	if( result != 1 )
+	{
+		if( timed_out != 0 )
+		{
+			internal_handle->number_of_query_timeouts += 1;
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to send command.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_time_available != 0 )
+	{
+		if( libtableau_handle_get_monotonic_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->query_transport_duration = end_time - start_time;
+		internal_handle->query_parse_duration     = 0;
+		internal_handle->query_durations_measured = 1;
+	}
+	return( 1 );
+}
+
+/* Queries the opened device for Tableau information
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_query(
+     libtableau_handle_t *handle,
+     libcerror_error_t **error )
+{
+	uint8_t recv_buffer[ LIBTABLEAU_RECV_SIZE ];
+
+	libtableau_internal_handle_t *internal_handle = NULL;
+	tableau_header_t *tableau_header              = NULL;
+	tableau_page_t *tableau_page                  = NULL;
+	static char *function                         = "libtableau_handle_query";
+	ssize_t recv_buffer_offset                    = 0;
+	uint64_t end_time                             = 0;
+	uint64_t start_time                           = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	/* An abort signalled for a previous command does not apply to the query
+	 */
+	internal_handle->abort = 0;
+
+	if( internal_handle->trace != NULL )
+	{
+		libtableau_internal_handle_append_trace_record(
+		 internal_handle,
+		 LIBTABLEAU_TRACE_PHASE_QUERY_START );
+	}
+	if( libtableau_internal_handle_send_query(
+	     internal_handle,
+	     recv_buffer,
+	     LIBTABLEAU_RECV_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to send query.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_handle->query_durations_measured != 0 )
+	{
+		if( libtableau_handle_get_monotonic_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start time.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_handle->trace != NULL )
+	{
+		libtableau_internal_handle_append_trace_record(
+		 internal_handle,
+		 LIBTABLEAU_TRACE_PHASE_QUERY_TRANSPORT_END );
+	}
+	tableau_header = (tableau_header_t *) recv_buffer;
+
+	if( libtableau_query_parse_tableau_header(
+	     tableau_header,
+             internal_handle->values_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse tableau header.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_handle->trace != NULL )
+	{
+		libtableau_internal_handle_append_trace_record(
+		 internal_handle,
+		 LIBTABLEAU_TRACE_PHASE_QUERY_HEADER_END );
+	}
+	recv_buffer_offset = (ssize_t) sizeof( tableau_header_t );
+
+	while( ( recv_buffer_offset + sizeof( tableau_page_t ) ) < (ssize_t) tableau_header->response_size )
+	{
+		tableau_page = (tableau_page_t *) &( recv_buffer[ recv_buffer_offset ] );
+
+		if( libtableau_query_parse_tableau_page(
+		     tableau_page,
+		     &( recv_buffer[ recv_buffer_offset + sizeof( tableau_page_t ) ] ),
+		     internal_handle->values_table,
+		     internal_handle->security_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse tableau page.",
+			 function );
+
+			goto on_error;
+		}
+		recv_buffer_offset += (size_t) tableau_page->size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( ( libcnotify_verbose != 0 )
+	 && ( recv_buffer_offset < (ssize_t) sizeof( tableau_header_t ) ) )
+	{
+		libtableau_debug_trace_append_record(
+		 function,
+		 "detected trailing data.",
+		 NULL,
+		 0,
+		 NULL );
+	}
+#endif
+	if( internal_handle->query_durations_measured != 0 )
+	{
+		if( libtableau_handle_get_monotonic_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			goto on_error;
+		}
+		internal_handle->query_parse_duration = end_time - start_time;
+	}
+	if( internal_handle->trace != NULL )
+	{
+		libtableau_internal_handle_append_trace_record(
+		 internal_handle,
+		 LIBTABLEAU_TRACE_PHASE_QUERY_END );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	/* Print the debug trace of the failed query before the error is reported
+	 */
+	libtableau_debug_trace_flush(
+	 NULL );
+#endif
+	if( internal_handle->trace != NULL )
+	{
+		libtableau_internal_handle_append_trace_record(
+		 internal_handle,
+		 LIBTABLEAU_TRACE_PHASE_FAILED );
+	}
+	return( -1 );
+}
+
+/* Sends the query command to the opened device without parsing the response
+ * This measures the round trip of the query command and leaves the previously
+ * retrieved Tableau information unchanged
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_send_query(
+     libtableau_handle_t *handle,
+     libcerror_error_t **error )
+{
+	uint8_t recv_buffer[ LIBTABLEAU_RECV_SIZE ];
+
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_send_query";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	/* An abort signalled for a previous command does not apply to the query
+	 */
+	internal_handle->abort = 0;
+
+	if( libtableau_internal_handle_send_query(
+	     internal_handle,
+	     recv_buffer,
+	     LIBTABLEAU_RECV_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to send query.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the durations of the most recent query in nanoseconds
+ * The transport duration covers sending the command and receiving the response,
+ * the parse duration covers the parsing of the response and is 0 if the
+ * response was not parsed
+ * Returns 1 if successful, 0 if no durations were measured or -1 on error
+ */
+int libtableau_handle_get_query_durations(
+     libtableau_handle_t *handle,
+     uint64_t *transport_duration,
+     uint64_t *parse_duration,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_get_query_durations";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( transport_duration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transport duration.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_duration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse duration.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->query_durations_measured == 0 )
+	{
+		return( 0 );
+	}
+	*transport_duration = internal_handle->query_transport_duration;
+	*parse_duration     = internal_handle->query_parse_duration;
+
+	return( 1 );
+}
+
+/* Retrieves the number of queries that timed out
+ * The number is retained when the handle is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_get_number_of_query_timeouts(
+     libtableau_handle_t *handle,
+     uint64_t *number_of_query_timeouts,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_get_number_of_query_timeouts";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( number_of_query_timeouts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of query timeouts.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_query_timeouts = internal_handle->number_of_query_timeouts;
+
+	return( 1 );
+}
+
+/* Retrieves the number of queries the device returned sense data for
+ * The number is retained when the handle is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_get_number_of_query_sense_errors(
+     libtableau_handle_t *handle,
+     uint64_t *number_of_query_sense_errors,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_get_number_of_query_sense_errors";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( number_of_query_sense_errors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of query sense errors.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_query_sense_errors = internal_handle->number_of_query_sense_errors;
+
+	return( 1 );
+}
+
+/* Enables the trace of the phases of opening and querying the device
+ * Records retained by a previously enabled trace are kept
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_enable_trace(
+     libtableau_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_enable_trace";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( internal_handle->trace == NULL )
+	{
+		if( libtableau_trace_initialize(
+		     &( internal_handle->trace ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create trace.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Disables the trace and discards its records
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_disable_trace(
+     libtableau_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_disable_trace";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( libtableau_trace_free(
+	     &( internal_handle->trace ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free trace.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of trace records
+ * The number is 0 if the trace is disabled
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_get_number_of_trace_records(
+     libtableau_handle_t *handle,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_get_number_of_trace_records";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->trace == NULL )
+	{
+		*number_of_records = 0;
+
+		return( 1 );
+	}
+	if( libtableau_trace_get_number_of_records(
+	     internal_handle->trace,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of trace records.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific trace record
+ * The records are ordered from oldest (index 0) to most recent
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_get_trace_record_by_index(
+     libtableau_handle_t *handle,
+     int record_index,
+     uint8_t *phase,
+     uint64_t *timestamp,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_get_trace_record_by_index";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( internal_handle->trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( libtableau_trace_get_record_by_index(
+	     internal_handle->trace,
+	     record_index,
+	     phase,
+	     timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve trace record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the media values
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_internal_handle_determine_media_values(
+     libtableau_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function        = "libtableau_internal_handle_determine_media_values";
+	size_t maximum_transfer_size = 0;
+	uint64_t number_of_sectors   = 0;
+	uint32_t bytes_per_sector    = 0;
+	int result                   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libtableau_io_read_capacity(
+	     internal_handle->file_descriptor,
+	     internal_handle->timeout,
+	     internal_handle->abort_flag,
+	     &number_of_sectors,
+	     &bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read capacity.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sectors > ( (uint64_t) INT64_MAX / bytes_per_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sectors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libtableau_io_get_maximum_transfer_size(
+	          internal_handle->file_descriptor,
+	          &maximum_transfer_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum transfer size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		maximum_transfer_size = LIBTABLEAU_DEFAULT_MAXIMUM_TRANSFER_SIZE;
+	}
+	/* A read command always transfers whole sectors
+	 */
+	maximum_transfer_size -= maximum_transfer_size % bytes_per_sector;
+
+	if( maximum_transfer_size == 0 )
+	{
+		maximum_transfer_size = bytes_per_sector;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: maximum transfer size\t: %" PRIzd "\n",
+		 function,
+		 maximum_transfer_size );
+	}
+#endif
+	internal_handle->media_size              = (size64_t) number_of_sectors * bytes_per_sector;
+	internal_handle->bytes_per_sector        = bytes_per_sector;
+	internal_handle->maximum_transfer_size   = maximum_transfer_size;
+	internal_handle->media_values_determined = 1;
+
+	return( 1 );
+}
+
+/* Makes sure the media values were determined
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_internal_handle_ensure_media_values(
+     libtableau_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function           = "libtableau_internal_handle_ensure_media_values";
+	uint8_t media_values_determined = 0;
+	int result                      = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBTABLEAU_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	media_values_determined = internal_handle->media_values_determined;
+
+#if defined( HAVE_LIBTABLEAU_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( media_values_determined != 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBTABLEAU_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have determined the media values in the mean time
+	 */
+	if( internal_handle->media_values_determined == 0 )
+	{
+		result = libtableau_internal_handle_determine_media_values(
+		          internal_handle,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine media values.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBTABLEAU_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads a buffer from the device at a specific offset
+ * The offset and buffer size must be a multiple of the bytes per sector
+ * The device is read using the largest transfer it supports, the handle
+ * can be read from multiple threads concurrently
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libtableau_handle_read_buffer_at_offset(
+     libtableau_handle_t *handle,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_read_buffer_at_offset";
+	size64_t media_size                           = 0;
+	size_t buffer_offset                          = 0;
+	size_t maximum_transfer_size                  = 0;
+	size_t read_size                              = 0;
+	ssize_t read_count                            = 0;
+	uint32_t bytes_per_sector                     = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( internal_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libtableau_internal_handle_ensure_media_values(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine media values.",
+		 function );
+
+		return( -1 );
+	}
+	media_size            = internal_handle->media_size;
+	bytes_per_sector      = internal_handle->bytes_per_sector;
+	maximum_transfer_size = internal_handle->maximum_transfer_size;
+
+	if( ( (size64_t) offset % bytes_per_sector ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported offset value not a multiple of bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size64_t) offset >= media_size )
+	 || ( buffer_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( media_size - (size64_t) offset ) )
+	{
+		buffer_size = (size_t) ( media_size - (size64_t) offset );
+	}
+	if( ( buffer_size % bytes_per_sector ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported buffer size value not a multiple of bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		read_size = buffer_size - buffer_offset;
+
+		if( read_size > maximum_transfer_size )
+		{
+			read_size = maximum_transfer_size;
+		}
+		read_count = libtableau_io_read_sectors(
+		              internal_handle->file_descriptor,
+		              (uint64_t) ( ( (size64_t) offset + buffer_offset ) / bytes_per_sector ),
+		              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		              read_size,
+		              bytes_per_sector,
+		              internal_handle->timeout,
+		              internal_handle->abort_flag,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset + (off64_t) buffer_offset,
+			 offset + (off64_t) buffer_offset );
+
+			return( -1 );
+		}
+		buffer_offset += (size_t) read_count;
+
+		if( (size_t) read_count < read_size )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Retrieves the media size
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_get_media_size(
+     libtableau_handle_t *handle,
+     size64_t *media_size,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_get_media_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( media_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libtableau_internal_handle_ensure_media_values(
+	     internal_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear recv buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine media values.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_set(
-	     sense_buffer,
-	     0,
-	     LIBTABLEAU_SENSE_SIZE ) == NULL )
+	*media_size = internal_handle->media_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of bytes per sector
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_get_bytes_per_sector(
+     libtableau_handle_t *handle,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_get_bytes_per_sector";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear sense buffer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	tableau_query.opcode        = TABLEAU_QUERY_SCSI_OPCODE;
-	tableau_query.subcommand    = TABLEAU_QUERY_SUBCOMMAND_QUERY;
-	tableau_query.response_size = LIBTABLEAU_RECV_SIZE;
-
-	result = libtableau_io_send_command(
-	          internal_handle->file_descriptor,
-	          (uint8_t *) &tableau_query,
-	          6,
-	          recv_buffer,
-	          LIBTABLEAU_RECV_SIZE,
-	          sense_buffer,
-	          LIBTABLEAU_SENSE_SIZE,
-	          error );
+	internal_handle = (libtableau_internal_handle_t *) handle;
 
-	if( result != 1 )
+	if( bytes_per_sector == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to send command.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
 		 function );
 
 		return( -1 );
 	}
-	tableau_header = (tableau_header_t *) recv_buffer;
-
-	if( libtableau_query_parse_tableau_header(
-	     tableau_header,
-             internal_handle->values_table,
+	if( libtableau_internal_handle_ensure_media_values(
+	     internal_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to parse tableau header.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine media values.",
 		 function );
 
 		return( -1 );
 	}
-	recv_buffer_offset = (ssize_t) sizeof( tableau_header_t );
-
-	while( ( recv_buffer_offset + sizeof( tableau_page_t ) ) < (ssize_t) tableau_header->response_size )
-	{
-		tableau_page = (tableau_page_t *) &( recv_buffer[ recv_buffer_offset ] );
-
-		if( libtableau_query_parse_tableau_page(
-		     tableau_page,
-		     &( recv_buffer[ recv_buffer_offset + sizeof( tableau_page_t ) ] ),
-		     internal_handle->values_table,
-		     internal_handle->security_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to parse tableau page.",
-			 function );
+	*bytes_per_sector = internal_handle->bytes_per_sector;
 
-			return( -1 );
-		}
-		recv_buffer_offset += (size_t) tableau_page->size;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( ( libcnotify_verbose != 0 )
-	 && ( recv_buffer_offset < (ssize_t) sizeof( tableau_header_t ) ) )
-	{
-		libcnotify_printf(
-		 "%s: detected trailing data.\n",
-		 function );
-	}
-#endif
 	return( 1 );
 }
 
@@ -933,6 +2461,239 @@ int libtableau_handle_get_dco_number_of_sectors(
 	return( 1 );
 }
 
+/* Determines the acquisition extents of the user area, the HPA and the DCO
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_internal_handle_get_extents(
+     libtableau_internal_handle_t *internal_handle,
+     libtableau_extent_t *extents,
+     int maximum_number_of_extents,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	static char *function            = "libtableau_internal_handle_get_extents";
+	uint64_t dco_number_of_sectors   = 0;
+	uint64_t drive_number_of_sectors = 0;
+	uint64_t hpa_number_of_sectors   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libtableau_internal_handle_ensure_media_values(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->security_values != NULL )
+	{
+		drive_number_of_sectors = internal_handle->security_values->drive_number_of_sectors;
+		hpa_number_of_sectors   = internal_handle->security_values->hpa_number_of_sectors;
+		dco_number_of_sectors   = internal_handle->security_values->dco_number_of_sectors;
+	}
+	if( libtableau_extent_plan(
+	     extents,
+	     maximum_number_of_extents,
+	     number_of_extents,
+	     internal_handle->media_size / internal_handle->bytes_per_sector,
+	     drive_number_of_sectors,
+	     hpa_number_of_sectors,
+	     dco_number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to plan extents.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of acquisition extents
+ * The extents cover the user area, the HPA and the DCO in sector order
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_get_number_of_extents(
+     libtableau_handle_t *handle,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libtableau_extent_t extents[ LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS ];
+
+	static char *function = "libtableau_handle_get_number_of_extents";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( libtableau_internal_handle_get_extents(
+	     (libtableau_internal_handle_t *) handle,
+	     extents,
+	     LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS,
+	     number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extents.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific acquisition extent
+ * The offset and size are in bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_handle_get_extent_by_index(
+     libtableau_handle_t *handle,
+     int extent_index,
+     off64_t *offset,
+     size64_t *size,
+     uint8_t *type,
+     uint32_t *flags,
+     libcerror_error_t **error )
+{
+	libtableau_extent_t extents[ LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS ];
+
+	libtableau_internal_handle_t *internal_handle = NULL;
+	static char *function                         = "libtableau_handle_get_extent_by_index";
+	int number_of_extents                         = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libtableau_internal_handle_t *) handle;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libtableau_internal_handle_get_extents(
+	     internal_handle,
+	     extents,
+	     LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_index < 0 )
+	 || ( extent_index >= number_of_extents ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = (off64_t) ( extents[ extent_index ].start_sector * internal_handle->bytes_per_sector );
+	*size   = (size64_t) ( extents[ extent_index ].number_of_sectors * internal_handle->bytes_per_sector );
+	*type   = extents[ extent_index ].type;
+	*flags  = extents[ extent_index ].flags;
+
+	return( 1 );
+}
+
 /* Retrieves the number of values
  * Returns 1 if successful, 0 if no values are present or -1 on error
  */
@@ -1190,6 +2951,10 @@ int libtableau_handle_remove_dco(
 #endif
 		return( 0 );
 	}
+	/* An abort signalled for a previous command does not apply to the removal
+	 */
+	internal_handle->abort = 0;
+
 	if( memory_set(
 	     &tableau_query,
 	     0,
@@ -1221,14 +2986,21 @@ int libtableau_handle_remove_dco(
 
 		return( -1 );
 	}
+	internal_handle->command_identifier = ( internal_handle->command_identifier + 1 ) % 0x7fff;
+
 	result = libtableau_io_send_command(
 	          internal_handle->file_descriptor,
+	          internal_handle->io_queue,
 	          (uint8_t *) &tableau_query,
 	          12,
 	          recv_buffer,
 	          LIBTABLEAU_RECV_SIZE,
 	          sense_buffer,
 	          LIBTABLEAU_SENSE_SIZE,
+	          internal_handle->timeout,
+	          internal_handle->command_identifier,
+	          internal_handle->abort_flag,
+	          NULL,
 	          error );
 
 	if( result != 1 )
@@ -28,9 +28,15 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include <signal.h>
+
+#include "libtableau_extent.h"
 #include "libtableau_extern.h"
+#include "libtableau_io_queue.h"
 #include "libtableau_libcerror.h"
+#include "libtableau_libcthreads.h"
 #include "libtableau_security_values.h"
+#include "libtableau_trace.h"
 #include "libtableau_types.h"
 #include "libtableau_values_table.h"
 
@@ -57,6 +63,75 @@ struct libtableau_internal_handle
 	/* Security values
 	 */
 	libtableau_security_values_t *security_values;
+
+	/* The number of seconds the device is given to complete a command
+	 */
+	uint32_t timeout;
+
+	/* The identifier of the most recent command
+	 */
+	int command_identifier;
+
+	/* The IO queue, which retains the buffers of abandoned commands
+	 * NULL if the device is not open
+	 */
+	libtableau_io_queue_t *io_queue;
+
+	/* Value to indicate if abort was signalled
+	 */
+	volatile sig_atomic_t abort;
+
+	/* The flag that signals an abort, which references abort
+	 * unless a flag of the caller was set
+	 */
+	volatile sig_atomic_t *abort_flag;
+
+	/* Value to indicate the durations of the most recent query were measured
+	 */
+	uint8_t query_durations_measured;
+
+	/* The duration of the transport of the most recent query in nanoseconds
+	 */
+	uint64_t query_transport_duration;
+
+	/* The duration of the parsing of the most recent query in nanoseconds
+	 */
+	uint64_t query_parse_duration;
+
+	/* The number of queries that timed out
+	 */
+	uint64_t number_of_query_timeouts;
+
+	/* The number of queries the device returned sense data for
+	 */
+	uint64_t number_of_query_sense_errors;
+
+	/* Value to indicate the media values were determined
+	 */
+	uint8_t media_values_determined;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The maximum number of bytes transferred by a single read command
+	 */
+	size_t maximum_transfer_size;
+
+	/* The trace of the phases of opening and querying the device
+	 * NULL if tracing is disabled
+	 */
+	libtableau_trace_t *trace;
+
+#if defined( HAVE_LIBTABLEAU_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBTABLEAU_EXTERN \
@@ -69,6 +144,17 @@ int libtableau_handle_free(
      libtableau_handle_t **handle,
      libcerror_error_t **error );
 
+LIBTABLEAU_EXTERN \
+int libtableau_handle_signal_abort(
+     libtableau_handle_t *handle,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_set_abort_flag(
+     libtableau_handle_t *handle,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error );
+
 LIBTABLEAU_EXTERN \
 int libtableau_handle_open(
      libtableau_handle_t *handle,
@@ -92,11 +178,105 @@ int libtableau_handle_close(
      libtableau_handle_t *handle,
      libcerror_error_t **error );
 
+LIBTABLEAU_EXTERN \
+int libtableau_handle_get_timeout(
+     libtableau_handle_t *handle,
+     uint32_t *timeout,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_set_timeout(
+     libtableau_handle_t *handle,
+     uint32_t timeout,
+     libcerror_error_t **error );
+
+int libtableau_internal_handle_send_query(
+     libtableau_internal_handle_t *internal_handle,
+     uint8_t *recv_buffer,
+     size_t recv_buffer_size,
+     libcerror_error_t **error );
+
 LIBTABLEAU_EXTERN \
 int libtableau_handle_query(
      libtableau_handle_t *handle,
      libcerror_error_t **error );
 
+LIBTABLEAU_EXTERN \
+int libtableau_handle_send_query(
+     libtableau_handle_t *handle,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_get_query_durations(
+     libtableau_handle_t *handle,
+     uint64_t *transport_duration,
+     uint64_t *parse_duration,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_get_number_of_query_timeouts(
+     libtableau_handle_t *handle,
+     uint64_t *number_of_query_timeouts,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_get_number_of_query_sense_errors(
+     libtableau_handle_t *handle,
+     uint64_t *number_of_query_sense_errors,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_enable_trace(
+     libtableau_handle_t *handle,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_disable_trace(
+     libtableau_handle_t *handle,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_get_number_of_trace_records(
+     libtableau_handle_t *handle,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_get_trace_record_by_index(
+     libtableau_handle_t *handle,
+     int record_index,
+     uint8_t *phase,
+     uint64_t *timestamp,
+     libcerror_error_t **error );
+
+int libtableau_internal_handle_determine_media_values(
+     libtableau_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libtableau_internal_handle_ensure_media_values(
+     libtableau_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+ssize_t libtableau_handle_read_buffer_at_offset(
+     libtableau_handle_t *handle,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_get_media_size(
+     libtableau_handle_t *handle,
+     size64_t *media_size,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_get_bytes_per_sector(
+     libtableau_handle_t *handle,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error );
+
 LIBTABLEAU_EXTERN \
 int libtableau_handle_get_drive_number_of_sectors(
      libtableau_handle_t *handle,
@@ -115,6 +295,29 @@ int libtableau_handle_get_dco_number_of_sectors(
      uint32_t *number_of_sectors,
      libcerror_error_t **error );
 
+int libtableau_internal_handle_get_extents(
+     libtableau_internal_handle_t *internal_handle,
+     libtableau_extent_t *extents,
+     int maximum_number_of_extents,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_get_number_of_extents(
+     libtableau_handle_t *handle,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBTABLEAU_EXTERN \
+int libtableau_handle_get_extent_by_index(
+     libtableau_handle_t *handle,
+     int extent_index,
+     off64_t *offset,
+     size64_t *size,
+     uint8_t *type,
+     uint32_t *flags,
+     libcerror_error_t **error );
+
 LIBTABLEAU_EXTERN \
 int libtableau_handle_get_number_of_values(
      libtableau_handle_t *handle,
@@ -19,6 +19,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <types.h>
@@ -27,35 +28,424 @@
 #include <sys/ioctl.h>
 #endif
 
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_POLL_H )
+#include <poll.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_LINUX_FS_H )
+#include <linux/fs.h>
+#endif
+
+#if defined( HAVE_SCSI_SG_H )
+#include <scsi/sg.h>
+#endif
+
 #if defined( HAVE_SCSI_SG_PT_H )
 #include <scsi/sg_pt.h>
 #endif
 
+#include "libtableau_definitions.h"
 #include "libtableau_io.h"
+#include "libtableau_io_queue.h"
 #include "libtableau_libcerror.h"
 #include "libtableau_libcnotify.h"
 
-#define LIBTABLEAU_IO_TIMEOUT_NUMBER_OF_SECONDS		5
+/* The interval in milli seconds at which an outstanding command is checked for an abort
+ */
+#define LIBTABLEAU_IO_POLL_INTERVAL			100
 
-/* Sends a Tableau IO command to the file descriptor
- * Returns 1 if successful or -1 on error
+#if defined( HAVE_SCSI_SG_H ) && defined( HAVE_POLL_H ) && defined( HAVE_SYS_STAT_H )
+
+/* Sends a Tableau IO command to a SCSI generic (sg) character device
+ * The command is queued using the asynchronous sg version 3 interface so that
+ * the wait for its completion can be interrupted by an abort
+ * The sg driver transfers the response and sense data into a buffer of the IO
+ * queue, which is retained by the IO queue if the command is abandoned
+ * The timed out value is optional and is set if the command failed because
+ * it timed out
+ * Returns 1 if successful, 0 if the file descriptor does not support the interface or -1 on error
  */
-int libtableau_io_send_command(
+int libtableau_io_send_sg_command(
      int file_descriptor,
+     libtableau_io_queue_t *io_queue,
      uint8_t *command,
      size_t size_command,
      uint8_t *response,
      size_t size_response,
      uint8_t *sense,
      size_t size_sense,
+     uint32_t timeout,
+     int command_identifier,
+     volatile sig_atomic_t *abort,
+     uint8_t *timed_out,
      libcerror_error_t **error )
 {
-	static char *function = "libtableau_io_send_command";
+	struct pollfd poll_file_descriptor;
+	struct stat file_statistics;
+	sg_io_hdr_t request_header;
+	sg_io_hdr_t response_header;
+
+	uint8_t *buffer        = NULL;
+	static char *function  = "libtableau_io_send_sg_command";
+	size_t buffer_size     = 0;
+	ssize_t io_count       = 0;
+	uint64_t elapsed_time  = 0;
+	uint64_t maximum_time  = 0;
+	int result             = 0;
+	int version            = 0;
+
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		return( 0 );
+	}
+	if( S_ISCHR( file_statistics.st_mode ) == 0 )
+	{
+		return( 0 );
+	}
+	if( ioctl(
+	     file_descriptor,
+	     SG_GET_VERSION_NUM,
+	     &version ) != 0 )
+	{
+		return( 0 );
+	}
+	if( version < 30000 )
+	{
+		return( 0 );
+	}
+	if( libtableau_io_queue_get_buffer(
+	     io_queue,
+	     &buffer,
+	     &buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve command buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size_response > buffer_size )
+	 || ( size_sense > ( buffer_size - size_response ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid response and sense size value exceeds command buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &request_header,
+	     0,
+	     sizeof( sg_io_hdr_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear request header.",
+		 function );
+
+		return( -1 );
+	}
+	request_header.interface_id    = 'S';
+	request_header.dxfer_direction = SG_DXFER_FROM_DEV;
+	request_header.cmd_len         = (unsigned char) size_command;
+	request_header.cmdp            = command;
+	request_header.mx_sb_len       = (unsigned char) size_sense;
+	request_header.sbp             = &( buffer[ size_response ] );
+	request_header.dxfer_len       = (unsigned int) size_response;
+	request_header.dxferp          = buffer;
+	request_header.timeout         = (unsigned int) timeout * 1000;
+	request_header.pack_id         = command_identifier;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: queuing SCSI command: %d.\n",
+		 function,
+		 command_identifier );
+	}
+#endif
+	io_count = write(
+	            file_descriptor,
+	            &request_header,
+	            sizeof( sg_io_hdr_t ) );
+
+	if( io_count != (ssize_t) sizeof( sg_io_hdr_t ) )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to queue command.",
+		 function );
+
+		return( -1 );
+	}
+	/* The device is given an additional poll interval to report the time out itself
+	 */
+	maximum_time = ( (uint64_t) timeout * 1000 ) + LIBTABLEAU_IO_POLL_INTERVAL;
+
+	poll_file_descriptor.fd     = file_descriptor;
+	poll_file_descriptor.events = POLLIN;
+
+	for( ;; )
+	{
+		/* An aborted command is left with the driver, its response is discarded
+		 * by the next command send or when the file descriptor is closed
+		 * hence its buffer is abandoned to the IO queue
+		 */
+		if( ( abort != NULL )
+		 && ( *abort != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+		poll_file_descriptor.revents = 0;
+
+		result = poll(
+		          &poll_file_descriptor,
+		          1,
+		          LIBTABLEAU_IO_POLL_INTERVAL );
+
+		if( result == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to poll device.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			elapsed_time += LIBTABLEAU_IO_POLL_INTERVAL;
+
+			if( elapsed_time > maximum_time )
+			{
+				if( timed_out != NULL )
+				{
+					*timed_out = 1;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: communication with device timed out.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( memory_set(
+		     &response_header,
+		     0,
+		     sizeof( sg_io_hdr_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear response header.",
+			 function );
+
+			goto on_error;
+		}
+		response_header.interface_id = 'S';
+		response_header.pack_id      = -1;
+
+		io_count = read(
+		            file_descriptor,
+		            &response_header,
+		            sizeof( sg_io_hdr_t ) );
+
+		if( io_count == -1 )
+		{
+			if( ( errno == EAGAIN )
+			 || ( errno == EINTR ) )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read response.",
+			 function );
+
+			goto on_error;
+		}
+		if( response_header.pack_id == command_identifier )
+		{
+			break;
+		}
+		/* Discard the response of a previously abandoned command, the buffer
+		 * of which can be released now the sg driver has transferred its data
+		 */
+		if( libtableau_io_queue_release_buffer(
+		     io_queue,
+		     response_header.pack_id,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to release buffer of command: %d.",
+			 function,
+			 response_header.pack_id );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: discarding response of SCSI command: %d.\n",
+			 function,
+			 response_header.pack_id );
+		}
+#endif
+	}
+	if( memory_copy(
+	     response,
+	     buffer,
+	     size_response ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy response.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     sense,
+	     &( buffer[ size_response ] ),
+	     size_sense ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy sense.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( response_header.info & SG_INFO_OK_MASK ) != SG_INFO_OK )
+	{
+		/* The sg driver reports a time out as DID_TIME_OUT (0x03) or DRIVER_TIMEOUT (0x06)
+		 */
+		if( ( response_header.host_status == 0x03 )
+		 || ( ( response_header.driver_status & 0x0f ) == 0x06 ) )
+		{
+			if( timed_out != NULL )
+			{
+				*timed_out = 1;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: communication with device timed out.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( response_header.host_status != 0 )
+		 || ( ( response_header.driver_status & 0x0f ) > 0x01 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to communicate with device.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	/* The command is still queued with the sg driver, which transfers its data
+	 * into the buffer when the response is read
+	 */
+	libtableau_io_queue_abandon_buffer(
+	 io_queue,
+	 command_identifier,
+	 NULL );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_SCSI_SG_H ) && defined( HAVE_POLL_H ) && defined( HAVE_SYS_STAT_H ) */
 
 #if defined( HAVE_SCSI_SG_PT_H )
+
+/* Sends a SCSI command that transfers data from the device using the blocking pass-through
+ * The transferred size is optional and is set to the number of bytes the device returned
+ * The timed out value is optional and is set if the command failed because it timed out
+ * Returns 1 if successful, 0 if the device did not complete the command with a good status or -1 on error
+ */
+int libtableau_io_send_pt_command(
+     int file_descriptor,
+     uint8_t *command,
+     size_t size_command,
+     uint8_t *response,
+     size_t size_response,
+     uint8_t *sense,
+     size_t size_sense,
+     uint32_t timeout,
+     size_t *transferred_size,
+     uint8_t *timed_out,
+     libcerror_error_t **error )
+{
 	void *sg_scsi_pt_obj  = NULL;
+	static char *function = "libtableau_io_send_pt_command";
+	int residual_size     = 0;
 	int result            = 0;
-#endif
 
 	if( file_descriptor == -1 )
 	{
@@ -79,7 +469,7 @@ int libtableau_io_send_command(
 
 		return( -1 );
 	}
-	if( size_command > (ssize_t) SSIZE_MAX )
+	if( size_command > (size_t) INT_MAX )
 	{
 		libcerror_error_set(
 		 error,
@@ -101,7 +491,7 @@ int libtableau_io_send_command(
 
 		return( -1 );
 	}
-	if( size_response > (ssize_t) SSIZE_MAX )
+	if( size_response > (size_t) INT_MAX )
 	{
 		libcerror_error_set(
 		 error,
@@ -123,7 +513,7 @@ int libtableau_io_send_command(
 
 		return( -1 );
 	}
-	if( size_sense > (ssize_t) SSIZE_MAX )
+	if( size_sense > (size_t) INT_MAX )
 	{
 		libcerror_error_set(
 		 error,
@@ -134,7 +524,18 @@ int libtableau_io_send_command(
 
 		return( -1 );
 	}
-#if defined( HAVE_SCSI_SG_PT_H )
+	if( ( timeout == 0 )
+	 || ( timeout > (uint32_t) LIBTABLEAU_MAXIMUM_TIMEOUT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid timeout value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	sg_scsi_pt_obj = construct_scsi_pt_obj();
 
 	if( sg_scsi_pt_obj == NULL )
@@ -151,30 +552,31 @@ int libtableau_io_send_command(
 	set_scsi_pt_cdb(
 	 sg_scsi_pt_obj,
 	 command,
-	 size_command );
+	 (int) size_command );
 
 	set_scsi_pt_sense(
 	 sg_scsi_pt_obj,
 	 sense,
-	 size_sense );
+	 (int) size_sense );
 
 	set_scsi_pt_data_in(
 	 sg_scsi_pt_obj,
 	 response,
-	 size_response );
+	 (int) size_response );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: sending SCSI command.\n",
-		 function );
+		 "%s: sending SCSI command: 0x%02" PRIx8 ".\n",
+		 function,
+		 command[ 0 ] );
 	}
 #endif
 	result = do_scsi_pt(
 	          sg_scsi_pt_obj,
 	          file_descriptor,
-	          LIBTABLEAU_IO_TIMEOUT_NUMBER_OF_SECONDS,
+	          (int) timeout,
 	          libcnotify_verbose );
 
 	if( result == SCSI_PT_DO_BAD_PARAMS )
@@ -190,6 +592,10 @@ int libtableau_io_send_command(
 	}
 	else if( result == SCSI_PT_DO_TIMEOUT )
 	{
+		if( timed_out != NULL )
+		{
+			*timed_out = 1;
+		}
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
@@ -210,9 +616,48 @@ int libtableau_io_send_command(
 
 		goto on_error;
 	}
+	result = get_scsi_pt_result_category(
+	          sg_scsi_pt_obj );
+
+	if( ( result == SCSI_PT_RESULT_TRANSPORT_ERR )
+	 || ( result == SCSI_PT_RESULT_OS_ERR ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to transfer data from device.",
+		 function );
+
+		goto on_error;
+	}
+	if( transferred_size != NULL )
+	{
+		residual_size = get_scsi_pt_resid(
+		                 sg_scsi_pt_obj );
+
+		if( ( residual_size < 0 )
+		 || ( (size_t) residual_size > size_response ) )
+		{
+			residual_size = 0;
+		}
+		*transferred_size = size_response - (size_t) residual_size;
+	}
 	destruct_scsi_pt_obj(
 	 sg_scsi_pt_obj );
 
+	if( result != SCSI_PT_RESULT_GOOD )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: device did not report a good status.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
 	return( 1 );
 
 on_error:
@@ -222,17 +667,727 @@ on_error:
 		 sg_scsi_pt_obj );
 	}
 	return( -1 );
+}
 
-#else
-	libcerror_error_set(
-	 error,
-	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-	 LIBCERROR_RUNTIME_ERROR_GENERIC,
-	 "%s: missing SCSI support.",
-	 function );
+#endif /* defined( HAVE_SCSI_SG_PT_H ) */
 
-	return( -1 );
+/* Sends a Tableau IO command to the file descriptor
+ * The timeout is the maximum number of seconds the device is given to complete the command
+ * If the value abort is referencing is set, the command is interrupted
+ * The IO queue retains the buffers of interrupted commands until the sg driver no longer references them
+ * The timed out value is optional and is set if the command failed because it timed out
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_io_send_command(
+     int file_descriptor,
+     libtableau_io_queue_t *io_queue,
+     uint8_t *command,
+     size_t size_command,
+     uint8_t *response,
+     size_t size_response,
+     uint8_t *sense,
+     size_t size_sense,
+     uint32_t timeout,
+     int command_identifier,
+     volatile sig_atomic_t *abort,
+     uint8_t *timed_out,
+     libcerror_error_t **error )
+{
+	static char *function = "libtableau_io_send_command";
 
-#endif /* defined( HAVE_SCSI_SG_PT_H ) */
+#if defined( HAVE_SCSI_SG_PT_H ) || defined( HAVE_SCSI_SG_H )
+	int result            = 0;
+#endif
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( command == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid command.",
+		 function );
+
+		return( -1 );
+	}
+	if( size_command > (ssize_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid command size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( response == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid response.",
+		 function );
+
+		return( -1 );
+	}
+	if( size_response > (ssize_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid response size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sense == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sense.",
+		 function );
+
+		return( -1 );
+	}
+	if( size_sense > (ssize_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sense size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( timeout == 0 )
+	 || ( timeout > (uint32_t) LIBTABLEAU_MAXIMUM_TIMEOUT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid timeout value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( abort != NULL )
+	 && ( *abort != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_SCSI_SG_H ) && defined( HAVE_POLL_H ) && defined( HAVE_SYS_STAT_H )
+	result = libtableau_io_send_sg_command(
+	          file_descriptor,
+	          io_queue,
+	          command,
+	          size_command,
+	          response,
+	          size_response,
+	          sense,
+	          size_sense,
+	          timeout,
+	          command_identifier,
+	          abort,
+	          timed_out,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to send sg command.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+#endif
+#if defined( HAVE_SCSI_SG_PT_H )
+	/* Devices that do not support the sg interface use a blocking pass-through
+	 * that is bound by the timeout but cannot be interrupted
+	 * A Tableau query does not require a good SCSI status
+	 */
+	result = libtableau_io_send_pt_command(
+	          file_descriptor,
+	          command,
+	          size_command,
+	          response,
+	          size_response,
+	          sense,
+	          size_sense,
+	          timeout,
+	          NULL,
+	          timed_out,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to send pass-through command.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing SCSI support.",
+	 function );
+
+	return( -1 );
+
+#endif /* defined( HAVE_SCSI_SG_PT_H ) */
+}
+
+
+/* Determines the number of sectors and the number of bytes per sector of the device
+ * READ CAPACITY (16) is tried first since READ CAPACITY (10) cannot represent
+ * drives of 2 TiB and larger
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_io_read_capacity(
+     int file_descriptor,
+     uint32_t timeout,
+     volatile sig_atomic_t *abort,
+     uint64_t *number_of_sectors,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error )
+{
+	uint8_t command[ 16 ];
+	uint8_t response[ 32 ];
+	uint8_t sense[ LIBTABLEAU_SENSE_SIZE ];
+
+	static char *function   = "libtableau_io_read_capacity";
+
+#if defined( HAVE_SCSI_SG_PT_H )
+	size_t transferred_size = 0;
+	uint64_t last_sector    = 0;
+	uint32_t sector_size    = 0;
+	int result              = 0;
+#endif
+
+	if( number_of_sectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( abort != NULL )
+	 && ( *abort != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     command,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear command.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     response,
+	     0,
+	     32 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear response.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_SCSI_SG_PT_H )
+	/* READ CAPACITY (16) is the SERVICE ACTION IN (16) operation 0x9e
+	 * with service action 0x10
+	 */
+	command[ 0 ] = 0x9e;
+	command[ 1 ] = 0x10;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( command[ 10 ] ),
+	 32 );
+
+	result = libtableau_io_send_pt_command(
+	          file_descriptor,
+	          command,
+	          16,
+	          response,
+	          32,
+	          sense,
+	          LIBTABLEAU_SENSE_SIZE,
+	          timeout,
+	          &transferred_size,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to send READ CAPACITY (16) command.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( transferred_size >= 12 ) )
+	{
+		byte_stream_copy_to_uint64_big_endian(
+		 &( response[ 0 ] ),
+		 last_sector );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( response[ 8 ] ),
+		 sector_size );
+	}
+	else
+	{
+		/* Devices that do not support READ CAPACITY (16) fall back to
+		 * READ CAPACITY (10) operation 0x25
+		 */
+		if( memory_set(
+		     command,
+		     0,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear command.",
+			 function );
+
+			return( -1 );
+		}
+		command[ 0 ] = 0x25;
+
+		result = libtableau_io_send_pt_command(
+		          file_descriptor,
+		          command,
+		          10,
+		          response,
+		          8,
+		          sense,
+		          LIBTABLEAU_SENSE_SIZE,
+		          timeout,
+		          &transferred_size,
+		          NULL,
+		          error );
+
+		if( ( result != 1 )
+		 || ( transferred_size < 8 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to send READ CAPACITY (10) command.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 &( response[ 0 ] ),
+		 last_sector );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( response[ 4 ] ),
+		 sector_size );
+
+		if( last_sector == 0xffffffffUL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported last sector value requires READ CAPACITY (16).",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( sector_size == 0 )
+	 || ( sector_size > (uint32_t) LIBTABLEAU_MAXIMUM_BYTES_PER_SECTOR )
+	 || ( ( sector_size % 512 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bytes per sector: %" PRIu32 ".",
+		 function,
+		 sector_size );
+
+		return( -1 );
+	}
+	if( last_sector == (uint64_t) UINT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid last sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: last sector\t\t\t: %" PRIu64 "\n",
+		 function,
+		 last_sector );
+
+		libcnotify_printf(
+		 "%s: bytes per sector\t\t: %" PRIu32 "\n",
+		 function,
+		 sector_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	*number_of_sectors = last_sector + 1;
+	*bytes_per_sector  = sector_size;
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing SCSI support.",
+	 function );
+
+	return( -1 );
+
+#endif /* defined( HAVE_SCSI_SG_PT_H ) */
+}
+
+/* Reads sectors from the device into a buffer using a single READ (16) command
+ * The buffer size must be a multiple of the bytes per sector
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libtableau_io_read_sectors(
+     int file_descriptor,
+     uint64_t sector,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint32_t bytes_per_sector,
+     uint32_t timeout,
+     volatile sig_atomic_t *abort,
+     libcerror_error_t **error )
+{
+	uint8_t command[ 16 ];
+	uint8_t sense[ LIBTABLEAU_SENSE_SIZE ];
+
+	static char *function      = "libtableau_io_read_sectors";
+	uint64_t number_of_sectors = 0;
+
+#if defined( HAVE_SCSI_SG_PT_H )
+	size_t transferred_size    = 0;
+	int result                 = 0;
+#endif
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid bytes per sector value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size % bytes_per_sector ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported buffer size value not a multiple of bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( abort != NULL )
+	 && ( *abort != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_sectors = buffer_size / bytes_per_sector;
+
+	if( memory_set(
+	     command,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear command.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_SCSI_SG_PT_H )
+	/* READ (16) is operation 0x88
+	 */
+	command[ 0 ] = 0x88;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( command[ 2 ] ),
+	 sector );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( command[ 10 ] ),
+	 (uint32_t) number_of_sectors );
+
+	result = libtableau_io_send_pt_command(
+	          file_descriptor,
+	          command,
+	          16,
+	          buffer,
+	          buffer_size,
+	          sense,
+	          LIBTABLEAU_SENSE_SIZE,
+	          timeout,
+	          &transferred_size,
+	          NULL,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read %" PRIu64 " sectors at sector: %" PRIu64 ".",
+		 function,
+		 number_of_sectors,
+		 sector );
+
+		return( -1 );
+	}
+	return( (ssize_t) transferred_size );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing SCSI support.",
+	 function );
+
+	return( -1 );
+
+#endif /* defined( HAVE_SCSI_SG_PT_H ) */
+}
+
+/* Retrieves the maximum number of bytes the device accepts in a single transfer
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libtableau_io_get_maximum_transfer_size(
+     int file_descriptor,
+     size_t *maximum_transfer_size,
+     libcerror_error_t **error )
+{
+	static char *function                         = "libtableau_io_get_maximum_transfer_size";
+
+#if defined( HAVE_SYS_IOCTL_H ) && defined( HAVE_SYS_STAT_H ) && defined( BLKSECTGET )
+	struct stat file_statistics;
+
+	unsigned short block_device_number_of_sectors = 0;
+	int character_device_transfer_size            = 0;
+#endif
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_transfer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum transfer size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_SYS_IOCTL_H ) && defined( HAVE_SYS_STAT_H ) && defined( BLKSECTGET )
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* BLKSECTGET returns the limit in bytes as an int for a SCSI generic (sg)
+	 * character device and as an unsigned short number of 512 byte sectors
+	 * for a block device
+	 */
+	if( S_ISCHR( file_statistics.st_mode ) )
+	{
+		if( ioctl(
+		     file_descriptor,
+		     BLKSECTGET,
+		     &character_device_transfer_size ) == -1 )
+		{
+			return( 0 );
+		}
+		if( character_device_transfer_size <= 0 )
+		{
+			return( 0 );
+		}
+		*maximum_transfer_size = (size_t) character_device_transfer_size;
+	}
+	else
+	{
+		if( ioctl(
+		     file_descriptor,
+		     BLKSECTGET,
+		     &block_device_number_of_sectors ) == -1 )
+		{
+			return( 0 );
+		}
+		if( block_device_number_of_sectors == 0 )
+		{
+			return( 0 );
+		}
+		*maximum_transfer_size = (size_t) block_device_number_of_sectors * 512;
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
 }
 
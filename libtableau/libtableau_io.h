@@ -25,20 +25,87 @@
 #include <common.h>
 #include <types.h>
 
+#include <signal.h>
+
+#include "libtableau_io_queue.h"
 #include "libtableau_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+#if defined( HAVE_SCSI_SG_H ) && defined( HAVE_POLL_H ) && defined( HAVE_SYS_STAT_H )
+
+int libtableau_io_send_sg_command(
+     int file_descriptor,
+     libtableau_io_queue_t *io_queue,
+     uint8_t *command,
+     size_t size_command,
+     uint8_t *response,
+     size_t size_response,
+     uint8_t *sense,
+     size_t size_sense,
+     uint32_t timeout,
+     int command_identifier,
+     volatile sig_atomic_t *abort,
+     uint8_t *timed_out,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_SCSI_SG_H ) && defined( HAVE_POLL_H ) && defined( HAVE_SYS_STAT_H ) */
+
+#if defined( HAVE_SCSI_SG_PT_H )
+
+int libtableau_io_send_pt_command(
+     int file_descriptor,
+     uint8_t *command,
+     size_t size_command,
+     uint8_t *response,
+     size_t size_response,
+     uint8_t *sense,
+     size_t size_sense,
+     uint32_t timeout,
+     size_t *transferred_size,
+     uint8_t *timed_out,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_SCSI_SG_PT_H ) */
+
 int libtableau_io_send_command(
      int file_descriptor,
+     libtableau_io_queue_t *io_queue,
      uint8_t *command,
      size_t size_command,
      uint8_t *response,
      size_t size_response,
      uint8_t *sense,
      size_t size_sense,
+     uint32_t timeout,
+     int command_identifier,
+     volatile sig_atomic_t *abort,
+     uint8_t *timed_out,
+     libcerror_error_t **error );
+
+int libtableau_io_read_capacity(
+     int file_descriptor,
+     uint32_t timeout,
+     volatile sig_atomic_t *abort,
+     uint64_t *number_of_sectors,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error );
+
+ssize_t libtableau_io_read_sectors(
+     int file_descriptor,
+     uint64_t sector,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint32_t bytes_per_sector,
+     uint32_t timeout,
+     volatile sig_atomic_t *abort,
+     libcerror_error_t **error );
+
+int libtableau_io_get_maximum_transfer_size(
+     int file_descriptor,
+     size_t *maximum_transfer_size,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
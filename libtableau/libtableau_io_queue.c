@@ -0,0 +1,471 @@
+/*
+ * Input/Output (IO) queue functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libtableau_definitions.h"
+#include "libtableau_io_queue.h"
+#include "libtableau_libcerror.h"
+
+/* The IO queue keeps the buffers of the commands queued with the sg driver
+ * alive until their response has been read. The sg driver copies the response
+ * and sense data of a command into its buffers when its response is read,
+ * which for an abandoned, aborted or timed out, command happens when the next
+ * command discards the stale response.
+ */
+
+/* Creates an IO queue
+ * Make sure the value io_queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_io_queue_initialize(
+     libtableau_io_queue_t **io_queue,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libtableau_io_queue_initialize";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*io_queue = memory_allocate_structure(
+	             libtableau_io_queue_t );
+
+	if( *io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_queue,
+	     0,
+	     sizeof( libtableau_io_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO queue.",
+		 function );
+
+		goto on_error;
+	}
+	/* The buffer of the first command is allocated up front so that
+	 * a command only allocates after a previous command was abandoned
+	 */
+	( *io_queue )->buffer = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * buffer_size );
+
+	if( ( *io_queue )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_queue )->buffer_size = buffer_size;
+
+	return( 1 );
+
+on_error:
+	if( *io_queue != NULL )
+	{
+		if( ( *io_queue )->buffer != NULL )
+		{
+			memory_free(
+			 ( *io_queue )->buffer );
+		}
+		memory_free(
+		 *io_queue );
+
+		*io_queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an IO queue
+ * The buffers of abandoned commands are freed, hence the file descriptor
+ * the commands were queued on must be closed first
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_io_queue_free(
+     libtableau_io_queue_t **io_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libtableau_io_queue_free";
+	int result            = 1;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_queue != NULL )
+	{
+		if( libtableau_io_queue_empty(
+		     *io_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty IO queue.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *io_queue )->buffer != NULL )
+		{
+			memory_free(
+			 ( *io_queue )->buffer );
+		}
+		memory_free(
+		 *io_queue );
+
+		*io_queue = NULL;
+	}
+	return( result );
+}
+
+/* Empties an IO queue
+ * The buffers of abandoned commands are freed, hence the file descriptor
+ * the commands were queued on must be closed first
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_io_queue_empty(
+     libtableau_io_queue_t *io_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libtableau_io_queue_empty";
+	int command_index     = 0;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	for( command_index = 0;
+	     command_index < io_queue->number_of_abandoned_commands;
+	     command_index++ )
+	{
+		memory_free(
+		 io_queue->abandoned_commands[ command_index ].buffer );
+
+		io_queue->abandoned_commands[ command_index ].buffer = NULL;
+	}
+	io_queue->number_of_abandoned_commands = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the buffer of the next command
+ * The buffer is allocated if needed and cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_io_queue_get_buffer(
+     libtableau_io_queue_t *io_queue,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libtableau_io_queue_get_buffer";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	/* A command is only queued if its buffer can be abandoned
+	 */
+	if( io_queue->number_of_abandoned_commands >= LIBTABLEAU_IO_QUEUE_MAXIMUM_NUMBER_OF_ABANDONED_COMMANDS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid IO queue - number of abandoned commands exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_queue->buffer == NULL )
+	{
+		io_queue->buffer = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * io_queue->buffer_size );
+
+		if( io_queue->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( memory_set(
+	     io_queue->buffer,
+	     0,
+	     io_queue->buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer      = io_queue->buffer;
+	*buffer_size = io_queue->buffer_size;
+
+	return( 1 );
+}
+
+/* Abandons the buffer of the command that was queued last
+ * The buffer is retained until the response of the command is read
+ * and a new buffer is allocated for the next command
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_io_queue_abandon_buffer(
+     libtableau_io_queue_t *io_queue,
+     int identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libtableau_io_queue_abandon_buffer";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_queue->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO queue - missing buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_queue->number_of_abandoned_commands >= LIBTABLEAU_IO_QUEUE_MAXIMUM_NUMBER_OF_ABANDONED_COMMANDS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid IO queue - number of abandoned commands exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	io_queue->abandoned_commands[ io_queue->number_of_abandoned_commands ].identifier = identifier;
+	io_queue->abandoned_commands[ io_queue->number_of_abandoned_commands ].buffer     = io_queue->buffer;
+
+	io_queue->number_of_abandoned_commands += 1;
+
+	io_queue->buffer = NULL;
+
+	return( 1 );
+}
+
+/* Releases the buffer of an abandoned command after its response was read
+ * Returns 1 if successful, 0 if no such command or -1 on error
+ */
+int libtableau_io_queue_release_buffer(
+     libtableau_io_queue_t *io_queue,
+     int identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libtableau_io_queue_release_buffer";
+	int command_index     = 0;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	for( command_index = 0;
+	     command_index < io_queue->number_of_abandoned_commands;
+	     command_index++ )
+	{
+		if( io_queue->abandoned_commands[ command_index ].identifier == identifier )
+		{
+			break;
+		}
+	}
+	if( command_index >= io_queue->number_of_abandoned_commands )
+	{
+		return( 0 );
+	}
+	memory_free(
+	 io_queue->abandoned_commands[ command_index ].buffer );
+
+	io_queue->number_of_abandoned_commands -= 1;
+
+	/* The last abandoned command takes the place of the released one
+	 */
+	io_queue->abandoned_commands[ command_index ] = io_queue->abandoned_commands[ io_queue->number_of_abandoned_commands ];
+
+	io_queue->abandoned_commands[ io_queue->number_of_abandoned_commands ].identifier = 0;
+	io_queue->abandoned_commands[ io_queue->number_of_abandoned_commands ].buffer     = NULL;
+
+	return( 1 );
+}
+
+/* Retrieves the number of abandoned commands
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_io_queue_get_number_of_abandoned_commands(
+     libtableau_io_queue_t *io_queue,
+     int *number_of_abandoned_commands,
+     libcerror_error_t **error )
+{
+	static char *function = "libtableau_io_queue_get_number_of_abandoned_commands";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_abandoned_commands == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of abandoned commands.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_abandoned_commands = io_queue->number_of_abandoned_commands;
+
+	return( 1 );
+}
+
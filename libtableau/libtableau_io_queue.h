@@ -0,0 +1,108 @@
+/*
+ * Input/Output (IO) queue functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBTABLEAU_IO_QUEUE_H )
+#define _LIBTABLEAU_IO_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libtableau_definitions.h"
+#include "libtableau_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libtableau_io_queue_command libtableau_io_queue_command_t;
+
+struct libtableau_io_queue_command
+{
+	/* The identifier (pack_id) of the command
+	 */
+	int identifier;
+
+	/* The buffer of the command
+	 */
+	uint8_t *buffer;
+};
+
+typedef struct libtableau_io_queue libtableau_io_queue_t;
+
+struct libtableau_io_queue
+{
+	/* The buffer of the next command
+	 */
+	uint8_t *buffer;
+
+	/* The size of the buffer of a command
+	 */
+	size_t buffer_size;
+
+	/* The abandoned commands
+	 */
+	libtableau_io_queue_command_t abandoned_commands[ LIBTABLEAU_IO_QUEUE_MAXIMUM_NUMBER_OF_ABANDONED_COMMANDS ];
+
+	/* The number of abandoned commands
+	 */
+	int number_of_abandoned_commands;
+};
+
+int libtableau_io_queue_initialize(
+     libtableau_io_queue_t **io_queue,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libtableau_io_queue_free(
+     libtableau_io_queue_t **io_queue,
+     libcerror_error_t **error );
+
+int libtableau_io_queue_empty(
+     libtableau_io_queue_t *io_queue,
+     libcerror_error_t **error );
+
+int libtableau_io_queue_get_buffer(
+     libtableau_io_queue_t *io_queue,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error );
+
+int libtableau_io_queue_abandon_buffer(
+     libtableau_io_queue_t *io_queue,
+     int identifier,
+     libcerror_error_t **error );
+
+int libtableau_io_queue_release_buffer(
+     libtableau_io_queue_t *io_queue,
+     int identifier,
+     libcerror_error_t **error );
+
+int libtableau_io_queue_get_number_of_abandoned_commands(
+     libtableau_io_queue_t *io_queue,
+     int *number_of_abandoned_commands,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBTABLEAU_IO_QUEUE_H ) */
+
@@ -27,9 +27,11 @@
 #include <stdlib.h>
 #endif
 
+#include "libtableau_debug_trace.h"
 #include "libtableau_libcerror.h"
 #include "libtableau_libcnotify.h"
 #include "libtableau_notify.h"
+#include "libtableau_unused.h"
 
 #if !defined( HAVE_LOCAL_LIBTABLEAU )
 
@@ -116,5 +118,32 @@ int libtableau_notify_stream_close(
 	return( 0 );
 }
 
+/* Prints the buffered debug output of the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_notify_flush(
+     libcerror_error_t **error )
+{
+#if defined( HAVE_DEBUG_OUTPUT )
+	static char *function = "libtableau_notify_flush";
+
+	if( libtableau_debug_trace_flush(
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to flush debug trace.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	LIBTABLEAU_UNREFERENCED_PARAMETER( error )
+#endif
+	return( 1 );
+}
+
 #endif /* !defined( HAVE_LOCAL_LIBTABLEAU ) */
 
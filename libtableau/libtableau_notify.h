@@ -53,6 +53,10 @@ LIBTABLEAU_EXTERN \
 int libtableau_notify_stream_close(
      libcerror_error_t **error );
 
+LIBTABLEAU_EXTERN \
+int libtableau_notify_flush(
+     libcerror_error_t **error );
+
 #endif /* !defined( HAVE_LOCAL_LIBTABLEAU ) */
 
 #if defined( __cplusplus )
@@ -26,6 +26,7 @@
 
 #include <libtableau/definitions.h>
 
+#include "libtableau_debug_trace.h"
 #include "libtableau_definitions.h"
 #include "libtableau_handle.h"
 #include "libtableau_io.h"
@@ -94,13 +95,14 @@ int libtableau_query_parse_tableau_header(
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		libcnotify_printf(
-		 "%s: Tableau header:\n",
-		 function );
-		libcnotify_print_data(
+		/* The debug trace is best effort and does not affect the query
+		 */
+		libtableau_debug_trace_append_record(
+		 function,
+		 "Tableau header:",
 		 (uint8_t *) tableau_header,
 		 sizeof( tableau_header_t ),
-		 0 );
+		 NULL );
 	}
 #endif
 	if( ( tableau_header->signature[ 0 ] != 0x0e )
@@ -716,21 +718,20 @@ int libtableau_query_parse_tableau_page(
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		libcnotify_printf(
-		 "%s: Tableau page header:\n",
-		 function );
-		libcnotify_print_data(
+		/* The debug trace is best effort and does not affect the query
+		 */
+		libtableau_debug_trace_append_record(
+		 function,
+		 "Tableau page header:",
 		 (uint8_t *) tableau_page,
 		 sizeof( tableau_page_t ),
-		 0 );
-
-		libcnotify_printf(
-		 "%s: Tableau page data:\n",
-		 function );
-		libcnotify_print_data(
+		 NULL );
+		libtableau_debug_trace_append_record(
+		 function,
+		 "Tableau page data:",
 		 tableau_page_data,
-		 tableau_page->size,
-		 0 );
+		 (size_t) tableau_page->size,
+		 NULL );
 	}
 #endif
 	if( tableau_page->identifier == TABLEAU_PAGE_IDENTIFIER_HPA_DCO )
@@ -765,9 +766,9 @@ int libtableau_query_parse_tableau_page(
 #if defined( HAVE_DEBUG_OUTPUT )
 	else if( libcnotify_verbose != 0 )
 	{
-		libcnotify_printf(
-		 "%s: unsupported tableau page identifier: 0x%02x.\n",
+		libtableau_debug_trace_printf(
 		 function,
+		 "unsupported tableau page identifier: 0x%02x.",
 		 tableau_page->identifier );
 	}
 #endif
@@ -93,7 +93,7 @@ ssize_t libtableau_string_trim_copy(
 			break;
 		}
 	}
-	if( last_character <= first_character )
+	if( last_character < first_character )
 	{
 		return( 0 );
 	}
@@ -102,7 +102,7 @@ ssize_t libtableau_string_trim_copy(
 	if( narrow_string_copy(
 	     destination,
 	     &( source[ first_character ] ),
-	     last_character ) != NULL )
+	     last_character ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -113,7 +113,7 @@ ssize_t libtableau_string_trim_copy(
 
 		return( -1 );
 	}
-	destination[ last_character + 1 ] = 0;
+	destination[ last_character ] = 0;
 
 	return( last_character );
 }
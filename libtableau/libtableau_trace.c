@@ -0,0 +1,283 @@
+/*
+ * Trace functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libtableau_definitions.h"
+#include "libtableau_libcerror.h"
+#include "libtableau_trace.h"
+
+/* Creates a trace
+ * Make sure the value trace is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_trace_initialize(
+     libtableau_trace_t **trace,
+     libcerror_error_t **error )
+{
+	static char *function = "libtableau_trace_initialize";
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trace != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid trace value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*trace = memory_allocate_structure(
+	          libtableau_trace_t );
+
+	if( *trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create trace.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *trace,
+	     0,
+	     sizeof( libtableau_trace_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear trace.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *trace != NULL )
+	{
+		memory_free(
+		 *trace );
+
+		*trace = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a trace
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_trace_free(
+     libtableau_trace_t **trace,
+     libcerror_error_t **error )
+{
+	static char *function = "libtableau_trace_free";
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trace != NULL )
+	{
+		memory_free(
+		 *trace );
+
+		*trace = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a record to the trace
+ * Once the trace is full the oldest record is overwritten
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_trace_append_record(
+     libtableau_trace_t *trace,
+     uint8_t phase,
+     uint64_t timestamp,
+     libcerror_error_t **error )
+{
+	libtableau_trace_record_t *record = NULL;
+	static char *function             = "libtableau_trace_append_record";
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+	record = &( trace->records[ trace->number_of_appended_records % LIBTABLEAU_TRACE_NUMBER_OF_RECORDS ] );
+
+	record->timestamp = timestamp;
+	record->phase     = phase;
+
+	trace->number_of_appended_records += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of records retained by the trace
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_trace_get_number_of_records(
+     libtableau_trace_t *trace,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libtableau_trace_get_number_of_records";
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( trace->number_of_appended_records < LIBTABLEAU_TRACE_NUMBER_OF_RECORDS )
+	{
+		*number_of_records = (int) trace->number_of_appended_records;
+	}
+	else
+	{
+		*number_of_records = LIBTABLEAU_TRACE_NUMBER_OF_RECORDS;
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific record
+ * The records are ordered from oldest (index 0) to most recent
+ * Returns 1 if successful or -1 on error
+ */
+int libtableau_trace_get_record_by_index(
+     libtableau_trace_t *trace,
+     int record_index,
+     uint8_t *phase,
+     uint64_t *timestamp,
+     libcerror_error_t **error )
+{
+	libtableau_trace_record_t *record = NULL;
+	static char *function             = "libtableau_trace_get_record_by_index";
+	uint64_t first_record_number      = 0;
+	int number_of_records             = 0;
+
+	if( libtableau_trace_get_number_of_records(
+	     trace,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( record_index >= number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( phase == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid phase.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	first_record_number = trace->number_of_appended_records - (uint64_t) number_of_records;
+
+	record = &( trace->records[ ( first_record_number + (uint64_t) record_index ) % LIBTABLEAU_TRACE_NUMBER_OF_RECORDS ] );
+
+	*phase     = record->phase;
+	*timestamp = record->timestamp;
+
+	return( 1 );
+}
+
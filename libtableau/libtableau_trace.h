@@ -0,0 +1,92 @@
+/*
+ * Trace functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBTABLEAU_TRACE_H )
+#define _LIBTABLEAU_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libtableau_definitions.h"
+#include "libtableau_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libtableau_trace_record libtableau_trace_record_t;
+
+struct libtableau_trace_record
+{
+	/* The monotonic time in nanoseconds
+	 */
+	uint64_t timestamp;
+
+	/* The phase boundary
+	 */
+	uint8_t phase;
+};
+
+typedef struct libtableau_trace libtableau_trace_t;
+
+struct libtableau_trace
+{
+	/* The records, used as a ring buffer
+	 */
+	libtableau_trace_record_t records[ LIBTABLEAU_TRACE_NUMBER_OF_RECORDS ];
+
+	/* The number of records appended since the trace was created
+	 */
+	uint64_t number_of_appended_records;
+};
+
+int libtableau_trace_initialize(
+     libtableau_trace_t **trace,
+     libcerror_error_t **error );
+
+int libtableau_trace_free(
+     libtableau_trace_t **trace,
+     libcerror_error_t **error );
+
+int libtableau_trace_append_record(
+     libtableau_trace_t *trace,
+     uint8_t phase,
+     uint64_t timestamp,
+     libcerror_error_t **error );
+
+int libtableau_trace_get_number_of_records(
+     libtableau_trace_t *trace,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+int libtableau_trace_get_record_by_index(
+     libtableau_trace_t *trace,
+     int record_index,
+     uint8_t *phase,
+     uint64_t *timestamp,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBTABLEAU_TRACE_H ) */
+
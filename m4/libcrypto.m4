@@ -0,0 +1,138 @@
+dnl Checks for libcrypto required headers and functions
+dnl
+dnl Version: 20261018
+
+dnl Function to detect if libcrypto (OpenSSL) EVP digest functions are available
+dnl ac_libcrypto_dummy is used to prevent AC_CHECK_LIB adding unnecessary -l<library> arguments
+AC_DEFUN([AX_LIBCRYPTO_CHECK_LIB],
+  [dnl Check if parameters were provided
+  AS_IF(
+    [test "x$ac_cv_with_openssl" != x && test "x$ac_cv_with_openssl" != xno && test "x$ac_cv_with_openssl" != xauto-detect],
+    [AS_IF(
+      [test -d "$ac_cv_with_openssl"],
+      [CFLAGS="$CFLAGS -I${ac_cv_with_openssl}/include"
+      LDFLAGS="$LDFLAGS -L${ac_cv_with_openssl}/lib"],
+      [AC_MSG_WARN([no such directory: $ac_cv_with_openssl])
+      ])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_with_openssl" = xno],
+    [ac_cv_libcrypto=no],
+    [dnl Check for headers
+    AC_CHECK_HEADERS([openssl/evp.h])
+
+    AS_IF(
+      [test "x$ac_cv_header_openssl_evp_h" = xno],
+      [ac_cv_libcrypto=no],
+      [dnl Check for the individual functions
+      ac_cv_libcrypto=libcrypto
+
+      AC_CHECK_LIB(
+        crypto,
+        EVP_MD_CTX_new,
+        [ac_libcrypto_dummy=yes],
+        [ac_cv_libcrypto=no])
+      AC_CHECK_LIB(
+        crypto,
+        EVP_MD_CTX_free,
+        [ac_libcrypto_dummy=yes],
+        [ac_cv_libcrypto=no])
+      AC_CHECK_LIB(
+        crypto,
+        EVP_DigestInit_ex,
+        [ac_libcrypto_dummy=yes],
+        [ac_cv_libcrypto=no])
+      AC_CHECK_LIB(
+        crypto,
+        EVP_DigestUpdate,
+        [ac_libcrypto_dummy=yes],
+        [ac_cv_libcrypto=no])
+      AC_CHECK_LIB(
+        crypto,
+        EVP_DigestFinal_ex,
+        [ac_libcrypto_dummy=yes],
+        [ac_cv_libcrypto=no])
+      AC_CHECK_LIB(
+        crypto,
+        EVP_md5,
+        [ac_libcrypto_dummy=yes],
+        [ac_cv_libcrypto=no])
+      AC_CHECK_LIB(
+        crypto,
+        EVP_sha1,
+        [ac_libcrypto_dummy=yes],
+        [ac_cv_libcrypto=no])
+      AC_CHECK_LIB(
+        crypto,
+        EVP_sha256,
+        [ac_libcrypto_dummy=yes],
+        [ac_cv_libcrypto=no])
+
+      AS_IF(
+        [test "x$ac_cv_libcrypto" = xlibcrypto],
+        [ac_cv_libcrypto_LIBADD="-lcrypto"],
+        [AS_IF(
+          [test "x$ac_cv_with_openssl" != xauto-detect],
+          [AC_MSG_FAILURE(
+            [Missing EVP digest functions in library: crypto.],
+            [1])
+          ])
+        ])
+      ])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libcrypto" = xlibcrypto],
+    [AC_DEFINE(
+      [HAVE_LIBCRYPTO],
+      [1],
+      [Define to 1 if you have the 'crypto' library (-lcrypto).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libcrypto" != xno],
+    [AC_SUBST(
+      [HAVE_LIBCRYPTO],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_LIBCRYPTO],
+      [0])
+    ])
+  ])
+
+dnl Function to detect how to enable libcrypto
+AC_DEFUN([AX_LIBCRYPTO_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [openssl],
+    [openssl],
+    [search for OpenSSL in includedir and libdir or in the specified DIR, or no if not to use OpenSSL],
+    [auto-detect],
+    [DIR])
+
+  dnl Check for a shared library version
+  AX_LIBCRYPTO_CHECK_LIB
+
+  AS_IF(
+    [test "x$ac_cv_libcrypto_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [LIBCRYPTO_CPPFLAGS],
+      [$ac_cv_libcrypto_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libcrypto_LIBADD" != "x"],
+    [AC_SUBST(
+      [LIBCRYPTO_LIBADD],
+      [$ac_cv_libcrypto_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libcrypto" = xlibcrypto],
+    [AC_SUBST(
+      [ax_libcrypto_spec_requires],
+      [openssl])
+    AC_SUBST(
+      [ax_libcrypto_spec_build_requires],
+      [openssl-devel])
+    ])
+  ])
@@ -1,6 +1,6 @@
 dnl Checks for sgutils2 or required headers and functions
 dnl
-dnl Version: 20170903
+dnl Version: 20261018
 
 dnl Function to detect if sgutils2 is available
 AC_DEFUN([AX_SGUTILS2_CHECK_LIB],
@@ -131,6 +131,32 @@ AC_DEFUN([AX_SGUTILS2_CHECK_LIB],
           [1])
         ])
 
+      AC_CHECK_LIB(
+        sgutils2,
+        get_scsi_pt_result_category,
+        [],
+        [ac_cv_sgutils2=no])
+
+      AS_IF(
+        [test "x$ac_cv_lib_sgutils2_get_scsi_pt_result_category" = xno],
+        [AC_MSG_FAILURE(
+          [Missing function: get_scsi_pt_result_category in library: sgutils2.],
+          [1])
+        ])
+
+      AC_CHECK_LIB(
+        sgutils2,
+        get_scsi_pt_resid,
+        [],
+        [ac_cv_sgutils2=no])
+
+      AS_IF(
+        [test "x$ac_cv_lib_sgutils2_get_scsi_pt_resid" = xno],
+        [AC_MSG_FAILURE(
+          [Missing function: get_scsi_pt_resid in library: sgutils2.],
+          [1])
+        ])
+
       ac_cv_sgutils2_LIBADD="-lsgutils2";
       ])
     ])
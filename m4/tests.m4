@@ -1,6 +1,6 @@
 dnl Functions for testing
 dnl
-dnl Version: 20260612
+dnl Version: 20261018
 
 dnl Function to check if pthread_rwlock_unlock can be hooked for testing
 AC_DEFUN([AX_TESTS_CHECK_CAN_HOOK_PTHREAD_RWLOCK_UNLOCK],
@@ -249,9 +249,9 @@ AC_DEFUN([AX_TESTS_CHECK_ENABLE_CODE_COVERAGE],
 
 dnl Function to detect if tests dependencies are available
 AC_DEFUN([AX_TESTS_CHECK_LOCAL],
-  [AC_CHECK_HEADERS([dlfcn.h])
+  [AC_CHECK_HEADERS([dlfcn.h malloc.h])
 
-  AC_CHECK_FUNCS([fmemopen getopt mkstemp setenv tzset unlink])
+  AC_CHECK_FUNCS([clock_gettime fmemopen getopt malloc_usable_size mkstemp setenv tzset unlink])
 
   AC_CHECK_LIB(
     dl,
@@ -287,6 +287,21 @@ AC_DEFUN([AX_TESTS_CHECK_LOCAL],
     [TESTS_MANPAGE_LINTER],
     [$ac_cv_have_manpage_linter])
 
+  dnl Check if the SCSI generic device emulator used in test_emulated_device.at
+  dnl can be preloaded into the tools
+  AS_IF(
+    [test "x$ac_cv_header_scsi_sg_h" = xyes && test "x$ac_cv_lib_dl_dlsym" = xyes && test "x$ac_cv_c_compiler_gnu" = xyes && test "x$ac_cv_sgutils2" != xno && test "x$enable_shared" != xno && test "x$ac_cv_enable_static_executables" = xno && test "x$ac_cv_enable_asan" = xno],
+    [ac_cv_tests_sg_shim=yes],
+    [ac_cv_tests_sg_shim=no])
+
+  AM_CONDITIONAL(
+    [HAVE_TABLEAU_TEST_SG_SHIM],
+    [test "x$ac_cv_tests_sg_shim" = xyes])
+
+  AC_SUBST(
+    [TESTS_SG_SHIM],
+    [$ac_cv_tests_sg_shim])
+
   ac_tests_target_string="$target"
 
   AS_IF(
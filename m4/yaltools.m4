@@ -1,6 +1,6 @@
 dnl Checks for tools required headers and functions
 dnl
-dnl Version: 20260601
+dnl Version: 20261018
 
 dnl Function to determine how to link with MinGW binmode
 AC_DEFUN([AX_TOOLS_CHECK_MINGW_BINMODE],
@@ -73,9 +73,12 @@ AC_DEFUN([AX_TOOLS_CHECK_ENABLE_MINGW_BINMODE],
 
 dnl Function to detect if tableautools dependencies are available
 AC_DEFUN([AX_TABLEAUTOOLS_CHECK_LOCAL],
-  [AC_CHECK_HEADERS([signal.h sys/signal.h unistd.h])
+  [AC_CHECK_HEADERS([fcntl.h linux/io_uring.h poll.h signal.h sys/mman.h sys/signal.h sys/socket.h sys/stat.h sys/syscall.h sys/uio.h sys/un.h unistd.h])
 
-  AC_CHECK_FUNCS([close getopt setvbuf])
+  dnl Older C libraries provide the POSIX shared memory functions in librt
+  AC_SEARCH_LIBS([shm_open], [rt])
+
+  AC_CHECK_FUNCS([clock_gettime close fsync ftruncate getopt isatty lseek mmap munmap nanosleep open posix_memalign pread pwrite read realpath rename setvbuf shm_open shm_unlink sysconf unlink write])
 
   AS_IF(
    [test "x$ac_cv_func_close" != xyes],
@@ -0,0 +1,8771 @@
+/*
+ * Acquire handle
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#include "acquire_handle.h"
+#include "checkpoint.h"
+#include "chunk_compressor.h"
+#include "chunk_index.h"
+#include "digest_pipeline.h"
+#include "rescue_map.h"
+#include "storage_media_buffer.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcnotify.h"
+#include "tableautools_libcthreads.h"
+#include "tableautools_libtableau.h"
+#include "tableautools_system_string.h"
+#include "tableautools_time.h"
+#include "tableautools_unused.h"
+#include "tuning_cache.h"
+
+#define ACQUIRE_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates an acquire handle
+ * Make sure the value acquire_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_initialize(
+     acquire_handle_t **acquire_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_initialize";
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *acquire_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid acquire handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*acquire_handle = memory_allocate_structure(
+	                   acquire_handle_t );
+
+	if( *acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create acquire handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *acquire_handle,
+	     0,
+	     sizeof( acquire_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear acquire handle.",
+		 function );
+
+		memory_free(
+		 *acquire_handle );
+
+		*acquire_handle = NULL;
+
+		return( -1 );
+	}
+	if( libtableau_handle_initialize(
+	     &( ( *acquire_handle )->input_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *acquire_handle )->abort_flag = &( ( *acquire_handle )->abort );
+
+	if( libtableau_handle_set_abort_flag(
+	     ( *acquire_handle )->input_handle,
+	     ( *acquire_handle )->abort_flag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set abort flag of input handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *acquire_handle )->process_buffer_size = ACQUIRE_HANDLE_DEFAULT_PROCESS_BUFFER_SIZE;
+	( *acquire_handle )->number_of_threads   = ACQUIRE_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	( *acquire_handle )->queue_depth         = SEGMENT_WRITER_DEFAULT_QUEUE_DEPTH;
+	( *acquire_handle )->fsync_policy        = SEGMENT_WRITER_FSYNC_POLICY_CLOSE;
+	( *acquire_handle )->digest_types        = DIGEST_PIPELINE_TYPE_MD5;
+	( *acquire_handle )->notify_stream       = ACQUIRE_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *acquire_handle != NULL )
+	{
+		memory_free(
+		 *acquire_handle );
+
+		*acquire_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an acquire handle
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_free(
+     acquire_handle_t **acquire_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_free";
+	int result            = 1;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *acquire_handle != NULL )
+	{
+		if( ( *acquire_handle )->digest_pipeline != NULL )
+		{
+			if( digest_pipeline_free(
+			     &( ( *acquire_handle )->digest_pipeline ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest pipeline.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *acquire_handle )->verify_input_digest_pipeline != NULL )
+		{
+			if( digest_pipeline_free(
+			     &( ( *acquire_handle )->verify_input_digest_pipeline ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free verify input digest pipeline.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *acquire_handle )->verify_output_digest_pipeline != NULL )
+		{
+			if( digest_pipeline_free(
+			     &( ( *acquire_handle )->verify_output_digest_pipeline ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free verify output digest pipeline.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( acquire_handle_free_extent_digests(
+		     *acquire_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extent digests.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *acquire_handle )->output_writer != NULL )
+		{
+			if( segment_writer_free(
+			     &( ( *acquire_handle )->output_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *acquire_handle )->chunk_index != NULL )
+		{
+			if( chunk_index_free(
+			     &( ( *acquire_handle )->chunk_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *acquire_handle )->rescue_map != NULL )
+		{
+			if( rescue_map_free(
+			     &( ( *acquire_handle )->rescue_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free rescue map.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *acquire_handle )->rescue_map_filename != NULL )
+		{
+			memory_free(
+			 ( *acquire_handle )->rescue_map_filename );
+		}
+		if( ( *acquire_handle )->recovered_map != NULL )
+		{
+			if( rescue_map_free(
+			     &( ( *acquire_handle )->recovered_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free recovered map.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *acquire_handle )->checkpoint != NULL )
+		{
+			if( checkpoint_free(
+			     &( ( *acquire_handle )->checkpoint ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free checkpoint.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *acquire_handle )->checkpoint_filename != NULL )
+		{
+			memory_free(
+			 ( *acquire_handle )->checkpoint_filename );
+		}
+		if( ( *acquire_handle )->tuning_cache != NULL )
+		{
+			if( tuning_cache_free(
+			     &( ( *acquire_handle )->tuning_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free tuning cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *acquire_handle )->tuning_cache_filename != NULL )
+		{
+			memory_free(
+			 ( *acquire_handle )->tuning_cache_filename );
+		}
+		if( libtableau_handle_free(
+		     &( ( *acquire_handle )->input_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *acquire_handle );
+
+		*acquire_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the acquire handle to abort
+ * Only the flag of the acquire handle is set, an abort flag of the caller
+ * is left as is, hence a failed acquisition does not abort the other
+ * acquisitions that share the flag
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_signal_abort(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_signal_abort";
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	acquire_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the flag that signals the acquire handle to abort
+ * A signal handler of the caller only needs to set the flag to abort the
+ * acquisition, the input handle is passed the same flag
+ * If abort_flag is NULL the flag of the acquire handle is used
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_set_abort_flag(
+     acquire_handle_t *acquire_handle,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_set_abort_flag";
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort_flag == NULL )
+	{
+		acquire_handle->abort_flag = &( acquire_handle->abort );
+	}
+	else
+	{
+		acquire_handle->abort_flag = abort_flag;
+	}
+	if( libtableau_handle_set_abort_flag(
+	     acquire_handle->input_handle,
+	     acquire_handle->abort_flag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set abort flag of input handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the process buffer size
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int acquire_handle_set_process_buffer_size(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_set_process_buffer_size";
+	size_t string_length  = 0;
+	uint64_t size_value   = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( tableautools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &size_value,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	/* The process buffer size must be a multiple of the largest supported sector size
+	 */
+	if( ( size_value == 0 )
+	 || ( size_value > (uint64_t) ACQUIRE_HANDLE_MAXIMUM_PROCESS_BUFFER_SIZE )
+	 || ( ( size_value % 4096 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	acquire_handle->process_buffer_size = (size_t) size_value;
+
+	return( 1 );
+}
+
+/* Sets the number of read threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int acquire_handle_set_number_of_threads(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( tableautools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+	acquire_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the additional digest types, the MD5 digest is always calculated
+ * The string contains a comma separated list of: sha1, sha256
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int acquire_handle_set_additional_digest_types(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_set_additional_digest_types";
+	size_t segment_length = 0;
+	size_t segment_start  = 0;
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	uint8_t digest_types  = DIGEST_PIPELINE_TYPE_MD5;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != (system_character_t) ',' ) )
+		{
+			continue;
+		}
+		segment_length = string_index - segment_start;
+
+		if( ( segment_length == 4 )
+		 && ( system_string_compare_no_case(
+		       &( string[ segment_start ] ),
+		       _SYSTEM_STRING( "sha1" ),
+		       4 ) == 0 ) )
+		{
+			digest_types |= DIGEST_PIPELINE_TYPE_SHA1;
+		}
+		else if( ( segment_length == 5 )
+		      && ( system_string_compare_no_case(
+		            &( string[ segment_start ] ),
+		            _SYSTEM_STRING( "sha-1" ),
+		            5 ) == 0 ) )
+		{
+			digest_types |= DIGEST_PIPELINE_TYPE_SHA1;
+		}
+		else if( ( segment_length == 6 )
+		      && ( system_string_compare_no_case(
+		            &( string[ segment_start ] ),
+		            _SYSTEM_STRING( "sha256" ),
+		            6 ) == 0 ) )
+		{
+			digest_types |= DIGEST_PIPELINE_TYPE_SHA256;
+		}
+		else if( ( segment_length == 7 )
+		      && ( system_string_compare_no_case(
+		            &( string[ segment_start ] ),
+		            _SYSTEM_STRING( "sha-256" ),
+		            7 ) == 0 ) )
+		{
+			digest_types |= DIGEST_PIPELINE_TYPE_SHA256;
+		}
+		else
+		{
+			return( 0 );
+		}
+		segment_start = string_index + 1;
+	}
+	acquire_handle->digest_types = digest_types;
+
+	return( 1 );
+}
+
+/* Sets the size of the output segment files
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int acquire_handle_set_segment_size(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_set_segment_size";
+	size_t string_length  = 0;
+	uint64_t size_value   = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( tableautools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &size_value,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	/* The segment size must be a multiple of the largest supported sector size
+	 */
+	if( ( size_value < (uint64_t) ACQUIRE_HANDLE_MINIMUM_SEGMENT_SIZE )
+	 || ( size_value > (uint64_t) INT64_MAX )
+	 || ( ( size_value % 4096 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	acquire_handle->segment_size = (size64_t) size_value;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of asynchronous output write requests in flight
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int acquire_handle_set_queue_depth(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_set_queue_depth";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( tableautools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) SEGMENT_WRITER_MAXIMUM_QUEUE_DEPTH ) )
+	{
+		return( 0 );
+	}
+	acquire_handle->queue_depth = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the output fsync policy
+ * The string contains one of: none, close, segment
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int acquire_handle_set_fsync_policy(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_set_fsync_policy";
+	size_t string_length  = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 4 )
+	 && ( system_string_compare_no_case(
+	       string,
+	       _SYSTEM_STRING( "none" ),
+	       4 ) == 0 ) )
+	{
+		acquire_handle->fsync_policy = SEGMENT_WRITER_FSYNC_POLICY_NONE;
+	}
+	else if( ( string_length == 5 )
+	      && ( system_string_compare_no_case(
+	            string,
+	            _SYSTEM_STRING( "close" ),
+	            5 ) == 0 ) )
+	{
+		acquire_handle->fsync_policy = SEGMENT_WRITER_FSYNC_POLICY_CLOSE;
+	}
+	else if( ( string_length == 7 )
+	      && ( system_string_compare_no_case(
+	            string,
+	            _SYSTEM_STRING( "segment" ),
+	            7 ) == 0 ) )
+	{
+		acquire_handle->fsync_policy = SEGMENT_WRITER_FSYNC_POLICY_SEGMENT;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Sets the compression level
+ * The string contains one of: none, fast, best
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int acquire_handle_set_compression_level(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_set_compression_level";
+	size_t string_length  = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 4 )
+	 && ( system_string_compare_no_case(
+	       string,
+	       _SYSTEM_STRING( "none" ),
+	       4 ) == 0 ) )
+	{
+		acquire_handle->compression_level = CHUNK_COMPRESSOR_LEVEL_NONE;
+	}
+#if defined( HAVE_ZLIB )
+	else if( ( string_length == 4 )
+	      && ( system_string_compare_no_case(
+	            string,
+	            _SYSTEM_STRING( "fast" ),
+	            4 ) == 0 ) )
+	{
+		acquire_handle->compression_level = CHUNK_COMPRESSOR_LEVEL_FAST;
+	}
+	else if( ( string_length == 4 )
+	      && ( system_string_compare_no_case(
+	            string,
+	            _SYSTEM_STRING( "best" ),
+	            4 ) == 0 ) )
+	{
+		acquire_handle->compression_level = CHUNK_COMPRESSOR_LEVEL_BEST;
+	}
+#endif
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Copies the settings of one acquire handle to another
+ * The settings are the values set before the input is opened
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_copy_settings(
+     acquire_handle_t *destination_acquire_handle,
+     acquire_handle_t *source_acquire_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_copy_settings";
+
+	if( destination_acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	destination_acquire_handle->process_buffer_size = source_acquire_handle->process_buffer_size;
+	destination_acquire_handle->number_of_threads   = source_acquire_handle->number_of_threads;
+	destination_acquire_handle->digest_types        = source_acquire_handle->digest_types;
+	destination_acquire_handle->segment_size        = source_acquire_handle->segment_size;
+	destination_acquire_handle->queue_depth         = source_acquire_handle->queue_depth;
+	destination_acquire_handle->fsync_policy        = source_acquire_handle->fsync_policy;
+	destination_acquire_handle->compression_level   = source_acquire_handle->compression_level;
+	destination_acquire_handle->notify_stream       = source_acquire_handle->notify_stream;
+
+	return( 1 );
+}
+
+/* Opens the input handle
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_open_input(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	acquire_extent_t *extent       = NULL;
+	libcerror_error_t *local_error = NULL;
+	static char *function          = "acquire_handle_open_input";
+	size_t firmware_date_length    = 0;
+	int extent_index               = 0;
+	int result                     = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libtableau_handle_open_wide(
+	     acquire_handle->input_handle,
+	     filename,
+	     LIBTABLEAU_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libtableau_handle_open(
+	     acquire_handle->input_handle,
+	     filename,
+	     LIBTABLEAU_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libtableau_handle_get_media_size(
+	     acquire_handle->input_handle,
+	     &( acquire_handle->media_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libtableau_handle_get_bytes_per_sector(
+	     acquire_handle->input_handle,
+	     &( acquire_handle->bytes_per_sector ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	/* The bridge and drive information is only available when the device
+	 * is attached to a Tableau forensic bridge
+	 */
+	acquire_handle->bridge_serial_number[ 0 ] = 0;
+	acquire_handle->bridge_model[ 0 ]         = 0;
+	acquire_handle->bridge_firmware[ 0 ]      = 0;
+	acquire_handle->bridge_channel_type[ 0 ]  = 0;
+	acquire_handle->drive_serial_number[ 0 ]  = 0;
+	acquire_handle->drive_model[ 0 ]          = 0;
+
+	if( libtableau_handle_query(
+	     acquire_handle->input_handle,
+	     &local_error ) == 1 )
+	{
+		if( libtableau_handle_get_value_bridge_serial_number(
+		     acquire_handle->input_handle,
+		     acquire_handle->bridge_serial_number,
+		     32,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bridge serial number.",
+			 function );
+
+			return( -1 );
+		}
+		if( libtableau_handle_get_value_bridge_model(
+		     acquire_handle->input_handle,
+		     acquire_handle->bridge_model,
+		     64,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bridge model.",
+			 function );
+
+			return( -1 );
+		}
+		/* The firmware is identified by its build date and time
+		 */
+		result = libtableau_handle_get_value_bridge_firmware_date(
+		          acquire_handle->input_handle,
+		          acquire_handle->bridge_firmware,
+		          32,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bridge firmware date.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			firmware_date_length = narrow_string_length(
+			                        acquire_handle->bridge_firmware );
+
+			acquire_handle->bridge_firmware[ firmware_date_length++ ] = ' ';
+		}
+		result = libtableau_handle_get_value_bridge_firmware_time(
+		          acquire_handle->input_handle,
+		          &( acquire_handle->bridge_firmware[ firmware_date_length ] ),
+		          64 - firmware_date_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bridge firmware time.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      && ( firmware_date_length > 0 ) )
+		{
+			acquire_handle->bridge_firmware[ firmware_date_length - 1 ] = 0;
+		}
+		if( libtableau_handle_get_value_bridge_channel_type(
+		     acquire_handle->input_handle,
+		     acquire_handle->bridge_channel_type,
+		     16,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bridge channel type.",
+			 function );
+
+			return( -1 );
+		}
+		if( libtableau_handle_get_value_drive_serial_number(
+		     acquire_handle->input_handle,
+		     acquire_handle->drive_serial_number,
+		     32,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve drive serial number.",
+			 function );
+
+			return( -1 );
+		}
+		if( libtableau_handle_get_value_drive_model(
+		     acquire_handle->input_handle,
+		     acquire_handle->drive_model,
+		     64,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve drive model.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( local_error != NULL )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to query Tableau.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 local_error );
+		}
+		libcerror_error_free(
+		 &local_error );
+	}
+	/* The extents depend on the HPA and DCO values of the query
+	 */
+	if( libtableau_handle_get_number_of_extents(
+	     acquire_handle->input_handle,
+	     &( acquire_handle->number_of_extents ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( acquire_handle->number_of_extents < 0 )
+	 || ( acquire_handle->number_of_extents > ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_EXTENTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of extents value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	acquire_handle->number_of_accessible_extents = 0;
+
+	for( extent_index = 0;
+	     extent_index < acquire_handle->number_of_extents;
+	     extent_index++ )
+	{
+		extent = &( acquire_handle->extents[ extent_index ] );
+
+		if( libtableau_handle_get_extent_by_index(
+		     acquire_handle->input_handle,
+		     extent_index,
+		     &( extent->offset ),
+		     &( extent->size ),
+		     &( extent->type ),
+		     &( extent->flags ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( ( extent->flags & LIBTABLEAU_EXTENT_FLAG_IS_INACCESSIBLE ) == 0 )
+		{
+			acquire_handle->number_of_accessible_extents += 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the read tuning cache
+ * The input must be opened first. When the cache contains an entry of the
+ * bridge and drive its process buffer size and number of read threads are used
+ * Returns 1 if the cached values are used, 0 if a calibration is needed or -1 on error
+ */
+int acquire_handle_open_tuning_cache(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	tuning_cache_entry_t *entry = NULL;
+	static char *function       = "acquire_handle_open_tuning_cache";
+	size_t filename_length      = 0;
+	int result                  = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->tuning_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid acquire handle - tuning cache already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	acquire_handle->tuning_cache_filename = (system_character_t *) memory_allocate(
+	                                                                sizeof( system_character_t ) * ( filename_length + 1 ) );
+
+	if( acquire_handle->tuning_cache_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tuning cache filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     acquire_handle->tuning_cache_filename,
+	     filename,
+	     filename_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy tuning cache filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( tuning_cache_initialize(
+	     &( acquire_handle->tuning_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create tuning cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( tuning_cache_read(
+	     acquire_handle->tuning_cache,
+	     filename,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read tuning cache.",
+		 function );
+
+		goto on_error;
+	}
+	/* Without a drive model the drive cannot be recognized the next time
+	 */
+	if( acquire_handle->drive_model[ 0 ] == 0 )
+	{
+		return( 0 );
+	}
+	result = tuning_cache_get_entry(
+	          acquire_handle->tuning_cache,
+	          acquire_handle->bridge_model,
+	          acquire_handle->bridge_firmware,
+	          acquire_handle->bridge_channel_type,
+	          acquire_handle->drive_model,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve tuning cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* An entry with values the acquisition does not support is calibrated again
+	 */
+	if( ( entry->process_buffer_size == 0 )
+	 || ( entry->process_buffer_size > (size_t) ACQUIRE_HANDLE_MAXIMUM_PROCESS_BUFFER_SIZE )
+	 || ( ( entry->process_buffer_size % 4096 ) != 0 )
+	 || ( entry->number_of_threads <= 0 )
+	 || ( entry->number_of_threads > ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+	acquire_handle->process_buffer_size    = entry->process_buffer_size;
+	acquire_handle->number_of_threads      = entry->number_of_threads;
+	acquire_handle->read_tuning            = ACQUIRE_HANDLE_READ_TUNING_CACHED;
+	acquire_handle->read_tuning_throughput = entry->throughput;
+
+	return( 1 );
+
+on_error:
+	if( acquire_handle->tuning_cache != NULL )
+	{
+		tuning_cache_free(
+		 &( acquire_handle->tuning_cache ),
+		 NULL );
+	}
+	if( acquire_handle->tuning_cache_filename != NULL )
+	{
+		memory_free(
+		 acquire_handle->tuning_cache_filename );
+
+		acquire_handle->tuning_cache_filename = NULL;
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+/* Thread function of a calibration reader
+ * Reads every stride bytes, so that the readers of a calibration trial
+ * together read all of the trial data
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_calibration_read_thread_function(
+     acquire_calibration_reader_t *calibration_reader )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "acquire_handle_calibration_read_thread_function";
+	int read_index           = 0;
+
+	if( calibration_reader == NULL )
+	{
+		return( -1 );
+	}
+	calibration_reader->result = 1;
+
+	calibration_reader->storage_media_buffer->storage_media_offset = calibration_reader->offset;
+
+	for( read_index = 0;
+	     read_index < calibration_reader->number_of_reads;
+	     read_index++ )
+	{
+		if( acquire_handle_is_aborted( calibration_reader->acquire_handle ) != 0 )
+		{
+			calibration_reader->result = 0;
+
+			break;
+		}
+		if( acquire_handle_read_buffer(
+		     calibration_reader->acquire_handle,
+		     calibration_reader->storage_media_buffer,
+		     &error ) != 1 )
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read calibration data.\n",
+				 function );
+
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+			libcerror_error_free(
+			 &error );
+
+			calibration_reader->result = 0;
+
+			break;
+		}
+		calibration_reader->storage_media_buffer->storage_media_offset += (off64_t) calibration_reader->stride;
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+/* Runs a single calibration trial
+ * Reads size bytes at offset in reads of the process buffer size by
+ * the number of threads concurrently and measures the throughput
+ * Returns 1 if successful, 0 if the data could not be read or -1 on error
+ */
+int acquire_handle_calibrate_trial(
+     acquire_handle_t *acquire_handle,
+     off64_t offset,
+     size64_t size,
+     size_t process_buffer_size,
+     int number_of_threads,
+     uint64_t *throughput,
+     libcerror_error_t **error )
+{
+	storage_media_buffer_t *storage_media_buffers[ ACQUIRE_HANDLE_CALIBRATION_MAXIMUM_NUMBER_OF_THREADS ];
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	acquire_calibration_reader_t calibration_readers[ ACQUIRE_HANDLE_CALIBRATION_MAXIMUM_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ ACQUIRE_HANDLE_CALIBRATION_MAXIMUM_NUMBER_OF_THREADS ];
+#endif
+
+	libcerror_error_t *local_error = NULL;
+	static char *function          = "acquire_handle_calibrate_trial";
+	uint64_t end_time              = 0;
+	uint64_t start_time            = 0;
+	int buffer_index               = 0;
+	int number_of_reads            = 0;
+	int read_index                 = 0;
+	int result                     = 1;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( process_buffer_size == 0 )
+	 || ( ( size % process_buffer_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid process buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > ACQUIRE_HANDLE_CALIBRATION_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( throughput == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid throughput.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < ACQUIRE_HANDLE_CALIBRATION_MAXIMUM_NUMBER_OF_THREADS;
+	     buffer_index++ )
+	{
+		storage_media_buffers[ buffer_index ] = NULL;
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		threads[ buffer_index ]               = NULL;
+#endif
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_threads;
+	     buffer_index++ )
+	{
+		if( storage_media_buffer_initialize(
+		     &( storage_media_buffers[ buffer_index ] ),
+		     process_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create storage media buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		storage_media_buffers[ buffer_index ]->raw_buffer_data_size = process_buffer_size;
+	}
+	if( tableautools_time_get_monotonic_time(
+	     &start_time ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_reads = (int) ( size / process_buffer_size );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		for( buffer_index = 0;
+		     buffer_index < number_of_threads;
+		     buffer_index++ )
+		{
+			calibration_readers[ buffer_index ].acquire_handle       = acquire_handle;
+			calibration_readers[ buffer_index ].storage_media_buffer = storage_media_buffers[ buffer_index ];
+			calibration_readers[ buffer_index ].offset               = offset + (off64_t) ( process_buffer_size * buffer_index );
+			calibration_readers[ buffer_index ].stride               = (size64_t) process_buffer_size * number_of_threads;
+			calibration_readers[ buffer_index ].number_of_reads      = number_of_reads / number_of_threads;
+			calibration_readers[ buffer_index ].result               = 0;
+
+			if( buffer_index < ( number_of_reads % number_of_threads ) )
+			{
+				calibration_readers[ buffer_index ].number_of_reads += 1;
+			}
+			if( libcthreads_thread_create(
+			     &( threads[ buffer_index ] ),
+			     NULL,
+			     (int (*)(void *)) &acquire_handle_calibration_read_thread_function,
+			     (void *) &( calibration_readers[ buffer_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create calibration thread: %d.",
+				 function,
+				 buffer_index );
+
+				goto on_error;
+			}
+		}
+		for( buffer_index = 0;
+		     buffer_index < number_of_threads;
+		     buffer_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( threads[ buffer_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join calibration thread: %d.",
+				 function,
+				 buffer_index );
+
+				goto on_error;
+			}
+			if( calibration_readers[ buffer_index ].result != 1 )
+			{
+				result = 0;
+			}
+		}
+	}
+	else
+#endif
+	{
+		/* A single reader reads sequentially
+		 */
+		storage_media_buffers[ 0 ]->storage_media_offset = offset;
+
+		for( read_index = 0;
+		     read_index < number_of_reads;
+		     read_index++ )
+		{
+			if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+			{
+				result = 0;
+
+				break;
+			}
+			if( acquire_handle_read_buffer(
+			     acquire_handle,
+			     storage_media_buffers[ 0 ],
+			     &local_error ) != 1 )
+			{
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to read calibration data.\n",
+					 function );
+
+					libcnotify_print_error_backtrace(
+					 local_error );
+				}
+				libcerror_error_free(
+				 &local_error );
+
+				result = 0;
+
+				break;
+			}
+			storage_media_buffers[ 0 ]->storage_media_offset += (off64_t) process_buffer_size;
+		}
+	}
+	if( tableautools_time_get_monotonic_time(
+	     &end_time ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	if( end_time <= start_time )
+	{
+		end_time = start_time + 1;
+	}
+	*throughput = (uint64_t) ( ( (double) size * 1000000000.0 ) / (double) ( end_time - start_time ) );
+
+	for( buffer_index = 0;
+	     buffer_index < number_of_threads;
+	     buffer_index++ )
+	{
+		if( storage_media_buffer_free(
+		     &( storage_media_buffers[ buffer_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free storage media buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	for( buffer_index = 0;
+	     buffer_index < number_of_threads;
+	     buffer_index++ )
+	{
+		if( threads[ buffer_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ buffer_index ] ),
+			 NULL );
+		}
+	}
+#endif
+	for( buffer_index = 0;
+	     buffer_index < number_of_threads;
+	     buffer_index++ )
+	{
+		if( storage_media_buffers[ buffer_index ] != NULL )
+		{
+			storage_media_buffer_free(
+			 &( storage_media_buffers[ buffer_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Calibrates the process buffer size and number of read threads
+ * Every combination of read size and number of read threads reads its own
+ * part of the start of the media, the fastest combination is used for the
+ * acquisition and stored in the tuning cache when one was opened
+ * Returns 1 if successful, 0 if the media could not be calibrated or -1 on error
+ */
+int acquire_handle_calibrate(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	static char *function           = "acquire_handle_calibrate";
+	size64_t trial_size             = 0;
+	size_t best_process_buffer_size = 0;
+	size_t process_buffer_size      = 0;
+	uint64_t best_throughput        = 0;
+	uint64_t throughput             = 0;
+	uint64_t time_value             = 0;
+	off64_t offset                  = 0;
+	int best_number_of_threads      = 0;
+	int maximum_number_of_threads   = 1;
+	int number_of_sizes             = 0;
+	int number_of_threads           = 0;
+	int number_of_trials            = 0;
+	int result                      = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The throughput cannot be measured without a monotonic clock
+	 */
+	if( tableautools_time_get_monotonic_time(
+	     &time_value ) != 1 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	maximum_number_of_threads = ACQUIRE_HANDLE_CALIBRATION_MAXIMUM_NUMBER_OF_THREADS;
+#endif
+	for( process_buffer_size = ACQUIRE_HANDLE_CALIBRATION_MINIMUM_SIZE;
+	     process_buffer_size <= ACQUIRE_HANDLE_CALIBRATION_MAXIMUM_SIZE;
+	     process_buffer_size *= 4 )
+	{
+		number_of_sizes++;
+	}
+	for( number_of_threads = 1;
+	     number_of_threads <= maximum_number_of_threads;
+	     number_of_threads *= 2 )
+	{
+		number_of_trials += number_of_sizes;
+	}
+	/* A small media is divided over the trials, every trial must read
+	 * at least a single read of the maximum size
+	 */
+	trial_size = ACQUIRE_HANDLE_CALIBRATION_TRIAL_SIZE;
+
+	if( acquire_handle->media_size < ( trial_size * number_of_trials ) )
+	{
+		trial_size  = acquire_handle->media_size / number_of_trials;
+		trial_size -= trial_size % ACQUIRE_HANDLE_CALIBRATION_MAXIMUM_SIZE;
+	}
+	if( trial_size == 0 )
+	{
+		return( 0 );
+	}
+	for( process_buffer_size = ACQUIRE_HANDLE_CALIBRATION_MINIMUM_SIZE;
+	     process_buffer_size <= ACQUIRE_HANDLE_CALIBRATION_MAXIMUM_SIZE;
+	     process_buffer_size *= 4 )
+	{
+		for( number_of_threads = 1;
+		     number_of_threads <= maximum_number_of_threads;
+		     number_of_threads *= 2 )
+		{
+			if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+			{
+				return( 0 );
+			}
+			result = acquire_handle_calibrate_trial(
+			          acquire_handle,
+			          offset,
+			          trial_size,
+			          process_buffer_size,
+			          number_of_threads,
+			          &throughput,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calibrate %" PRIzd " bytes per read with %d read thread(s).",
+				 function,
+				 process_buffer_size,
+				 number_of_threads );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				return( 0 );
+			}
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: %" PRIzd " bytes per read with %d read thread(s): %" PRIu64 " bytes per second.\n",
+				 function,
+				 process_buffer_size,
+				 number_of_threads,
+				 throughput );
+			}
+			/* On a tie the smaller read size and fewer threads are preferred
+			 */
+			if( throughput > best_throughput )
+			{
+				best_process_buffer_size = process_buffer_size;
+				best_number_of_threads   = number_of_threads;
+				best_throughput          = throughput;
+			}
+			offset += (off64_t) trial_size;
+		}
+	}
+	acquire_handle->process_buffer_size    = best_process_buffer_size;
+	acquire_handle->number_of_threads      = best_number_of_threads;
+	acquire_handle->read_tuning            = ACQUIRE_HANDLE_READ_TUNING_CALIBRATED;
+	acquire_handle->read_tuning_throughput = best_throughput;
+
+	if( ( acquire_handle->tuning_cache == NULL )
+	 || ( acquire_handle->drive_model[ 0 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	result = tuning_cache_set_entry(
+	          acquire_handle->tuning_cache,
+	          acquire_handle->bridge_model,
+	          acquire_handle->bridge_firmware,
+	          acquire_handle->bridge_channel_type,
+	          acquire_handle->drive_model,
+	          best_process_buffer_size,
+	          best_number_of_threads,
+	          best_throughput,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set tuning cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( tuning_cache_write(
+		     acquire_handle->tuning_cache,
+		     acquire_handle->tuning_cache_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write tuning cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the rescue map of the recovery mode
+ * The input must be opened first. An existing rescue map is read to resume
+ * a previous recovery, otherwise a map with an untried media is created
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_open_rescue_map(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "acquire_handle_open_rescue_map";
+	size_t filename_length = 0;
+	int result             = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->rescue_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid acquire handle - rescue map already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->output_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid acquire handle - output writer already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	acquire_handle->rescue_map_filename = (system_character_t *) memory_allocate(
+	                                                              sizeof( system_character_t ) * ( filename_length + 1 ) );
+
+	if( acquire_handle->rescue_map_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create rescue map filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     acquire_handle->rescue_map_filename,
+	     filename,
+	     filename_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy rescue map filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( rescue_map_initialize(
+	     &( acquire_handle->rescue_map ),
+	     acquire_handle->media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create rescue map.",
+		 function );
+
+		goto on_error;
+	}
+	result = rescue_map_read(
+	          acquire_handle->rescue_map,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read rescue map.",
+		 function );
+
+		goto on_error;
+	}
+	acquire_handle->resume_recovery = (uint8_t) result;
+
+	if( rescue_map_initialize(
+	     &( acquire_handle->recovered_map ),
+	     acquire_handle->media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( acquire_handle->rescue_map != NULL )
+	{
+		rescue_map_free(
+		 &( acquire_handle->rescue_map ),
+		 NULL );
+	}
+	if( acquire_handle->rescue_map_filename != NULL )
+	{
+		memory_free(
+		 acquire_handle->rescue_map_filename );
+
+		acquire_handle->rescue_map_filename = NULL;
+	}
+	return( -1 );
+}
+
+/* Opens the checkpoint of a resumable acquisition
+ * The checkpoint is stored next to the target with the suffix .checkpoint
+ * The input must be opened first. When resuming, the checkpoint must exist
+ * and match the bridge, the drive and the extents of the input
+ * A compressed acquisition is not resumable and does not write a checkpoint,
+ * since the checkpoint does not contain the state of the chunk index
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_open_checkpoint(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *target_filename,
+     uint8_t resume,
+     libcerror_error_t **error )
+{
+	checkpoint_t *checkpoint = NULL;
+	static char *function    = "acquire_handle_open_checkpoint";
+	size_t filename_length   = 0;
+	int extent_index         = 0;
+	int result               = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->checkpoint != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid acquire handle - checkpoint already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->output_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid acquire handle - output writer already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->number_of_extents > CHECKPOINT_MAXIMUM_NUMBER_OF_EXTENTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid acquire handle - number of extents value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->compression_level != CHUNK_COMPRESSOR_LEVEL_NONE )
+	{
+		if( resume != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported resume of compressed acquisition.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	filename_length = system_string_length(
+	                   target_filename );
+
+	acquire_handle->checkpoint_filename = (system_character_t *) memory_allocate(
+	                                                              sizeof( system_character_t ) * ( filename_length + 12 ) );
+
+	if( acquire_handle->checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoint filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     acquire_handle->checkpoint_filename,
+	     target_filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy target filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( acquire_handle->checkpoint_filename[ filename_length ] ),
+	     _SYSTEM_STRING( ".checkpoint" ),
+	     12 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy checkpoint filename suffix.",
+		 function );
+
+		goto on_error;
+	}
+	if( checkpoint_initialize(
+	     &( acquire_handle->checkpoint ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	checkpoint = acquire_handle->checkpoint;
+
+	if( resume != 0 )
+	{
+		result = checkpoint_read(
+		          checkpoint,
+		          acquire_handle->checkpoint_filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing checkpoint: %" PRIs_SYSTEM ".",
+			 function,
+			 acquire_handle->checkpoint_filename );
+
+			goto on_error;
+		}
+		/* Make sure the acquisition resumes from the same drive behind the same bridge
+		 */
+		if( ( narrow_string_compare(
+		       checkpoint->bridge_serial_number,
+		       acquire_handle->bridge_serial_number,
+		       32 ) != 0 )
+		 || ( narrow_string_compare(
+		       checkpoint->drive_serial_number,
+		       acquire_handle->drive_serial_number,
+		       32 ) != 0 )
+		 || ( narrow_string_compare(
+		       checkpoint->drive_model,
+		       acquire_handle->drive_model,
+		       64 ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: bridge or drive does not match the checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( checkpoint->media_size != acquire_handle->media_size )
+		 || ( checkpoint->bytes_per_sector != acquire_handle->bytes_per_sector )
+		 || ( checkpoint->number_of_extents != acquire_handle->number_of_extents ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: media does not match the checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+		for( extent_index = 0;
+		     extent_index < acquire_handle->number_of_extents;
+		     extent_index++ )
+		{
+			if( ( checkpoint->extent_offsets[ extent_index ] != acquire_handle->extents[ extent_index ].offset )
+			 || ( checkpoint->extent_sizes[ extent_index ] != acquire_handle->extents[ extent_index ].size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: extent: %d does not match the checkpoint.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+		}
+		if( checkpoint->digest_types != acquire_handle->digest_types )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: digest types do not match the checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+		if( checkpoint->segment_size != acquire_handle->segment_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: segment size does not match the checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+		acquire_handle->resume_acquisition = 1;
+		acquire_handle->resume_offset      = checkpoint->offset;
+	}
+	else
+	{
+		if( memory_copy(
+		     checkpoint->bridge_serial_number,
+		     acquire_handle->bridge_serial_number,
+		     32 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy bridge serial number.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     checkpoint->drive_serial_number,
+		     acquire_handle->drive_serial_number,
+		     32 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy drive serial number.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     checkpoint->drive_model,
+		     acquire_handle->drive_model,
+		     64 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy drive model.",
+			 function );
+
+			goto on_error;
+		}
+		checkpoint->media_size        = acquire_handle->media_size;
+		checkpoint->bytes_per_sector  = acquire_handle->bytes_per_sector;
+		checkpoint->digest_types      = acquire_handle->digest_types;
+		checkpoint->segment_size      = acquire_handle->segment_size;
+		checkpoint->number_of_extents = acquire_handle->number_of_extents;
+
+		for( extent_index = 0;
+		     extent_index < acquire_handle->number_of_extents;
+		     extent_index++ )
+		{
+			checkpoint->extent_offsets[ extent_index ] = acquire_handle->extents[ extent_index ].offset;
+			checkpoint->extent_sizes[ extent_index ]   = acquire_handle->extents[ extent_index ].size;
+		}
+		acquire_handle->resume_acquisition = 0;
+		acquire_handle->resume_offset      = 0;
+	}
+	/* The first checkpoint is written as soon as the acquisition starts
+	 */
+	acquire_handle->checkpoint_save_time = 0;
+
+	return( 1 );
+
+on_error:
+	if( acquire_handle->checkpoint != NULL )
+	{
+		checkpoint_free(
+		 &( acquire_handle->checkpoint ),
+		 NULL );
+	}
+	if( acquire_handle->checkpoint_filename != NULL )
+	{
+		memory_free(
+		 acquire_handle->checkpoint_filename );
+
+		acquire_handle->checkpoint_filename = NULL;
+	}
+	return( -1 );
+}
+
+/* Opens the output
+ * An existing output file is never overwritten, except when the recovery
+ * resumes from an existing rescue map or the acquisition from a checkpoint
+ * When a segment size is set the output is split into segment files
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_open_output(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t *index_filename = NULL;
+	static char *function              = "acquire_handle_open_output";
+	size_t filename_length             = 0;
+	uint8_t create                     = 1;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->output_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid acquire handle - output writer already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	/* The recovery mode writes the data at its offset in the input
+	 */
+	if( ( acquire_handle->rescue_map != NULL )
+	 && ( acquire_handle->compression_level != CHUNK_COMPRESSOR_LEVEL_NONE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression in recovery mode.",
+		 function );
+
+		return( -1 );
+	}
+	/* The output is always opened for reading as well, since the recovery
+	 * mode and a resumed acquisition read the output back to calculate the
+	 * digest hashes
+	 */
+	if( acquire_handle->rescue_map != NULL )
+	{
+		if( acquire_handle->resume_recovery != 0 )
+		{
+			create = 0;
+		}
+	}
+	else if( acquire_handle->resume_acquisition != 0 )
+	{
+		create = 0;
+	}
+	if( segment_writer_initialize(
+	     &( acquire_handle->output_writer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_writer_set_fsync_policy(
+	     acquire_handle->output_writer,
+	     acquire_handle->fsync_policy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set fsync policy of output writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_writer_set_queue_depth(
+	     acquire_handle->output_writer,
+	     acquire_handle->queue_depth,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set queue depth of output writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_writer_open(
+	     acquire_handle->output_writer,
+	     filename,
+	     acquire_handle->media_size,
+	     acquire_handle->segment_size,
+	     create,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* The chunk index of a compressed output is stored next to the target
+	 * with the suffix .index
+	 */
+	if( acquire_handle->compression_level != CHUNK_COMPRESSOR_LEVEL_NONE )
+	{
+		filename_length = system_string_length(
+		                   filename );
+
+		index_filename = (system_character_t *) memory_allocate(
+		                                         sizeof( system_character_t ) * ( filename_length + 7 ) );
+
+		if( index_filename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create index filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     index_filename,
+		     filename,
+		     filename_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     &( index_filename[ filename_length ] ),
+		     _SYSTEM_STRING( ".index" ),
+		     7 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy index filename suffix.",
+			 function );
+
+			goto on_error;
+		}
+		if( chunk_index_initialize(
+		     &( acquire_handle->chunk_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk index.",
+			 function );
+
+			goto on_error;
+		}
+		if( chunk_index_open_write(
+		     acquire_handle->chunk_index,
+		     index_filename,
+		     CHUNK_COMPRESSOR_CHUNK_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open chunk index: %" PRIs_SYSTEM ".",
+			 function,
+			 index_filename );
+
+			goto on_error;
+		}
+		memory_free(
+		 index_filename );
+
+		index_filename = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( acquire_handle->chunk_index != NULL )
+	{
+		chunk_index_free(
+		 &( acquire_handle->chunk_index ),
+		 NULL );
+	}
+	if( index_filename != NULL )
+	{
+		memory_free(
+		 index_filename );
+	}
+	if( acquire_handle->output_writer != NULL )
+	{
+		segment_writer_free(
+		 &( acquire_handle->output_writer ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the size of the output
+ * This makes sure the output covers zero blocks at its end that were left as a hole
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_set_output_size(
+     acquire_handle_t *acquire_handle,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_set_output_size";
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer_set_size(
+	     acquire_handle->output_writer,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to set size of output.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the acquire handle
+ * Returns the 0 if successful or -1 on error
+ */
+int acquire_handle_close(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_close";
+	int result            = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->chunk_index != NULL )
+	{
+		if( chunk_index_free(
+		     &( acquire_handle->chunk_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( acquire_handle->output_writer != NULL )
+	{
+		if( segment_writer_close(
+		     acquire_handle->output_writer,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close output.",
+			 function );
+
+			result = -1;
+		}
+		if( segment_writer_free(
+		     &( acquire_handle->output_writer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output writer.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libtableau_handle_close(
+	     acquire_handle->input_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves the accessible extent that contains a specific offset
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int acquire_handle_get_extent_by_offset(
+     acquire_handle_t *acquire_handle,
+     off64_t offset,
+     acquire_extent_t **extent,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_get_extent_by_offset";
+	int extent_index      = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	for( extent_index = 0;
+	     extent_index < acquire_handle->number_of_extents;
+	     extent_index++ )
+	{
+		if( ( acquire_handle->extents[ extent_index ].flags & LIBTABLEAU_EXTENT_FLAG_IS_INACCESSIBLE ) != 0 )
+		{
+			continue;
+		}
+		if( ( offset >= acquire_handle->extents[ extent_index ].offset )
+		 && ( (size64_t) ( offset - acquire_handle->extents[ extent_index ].offset ) < acquire_handle->extents[ extent_index ].size ) )
+		{
+			*extent = &( acquire_handle->extents[ extent_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Creates the digest pipelines of the accessible extents
+ * Extent digests are only calculated when the acquisition covers more than one extent,
+ * otherwise they are the same as the digests of the entire acquisition
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_initialize_extent_digests(
+     acquire_handle_t *acquire_handle,
+     int maximum_number_of_buffers,
+     int (*release_function)(
+            storage_media_buffer_t *storage_media_buffer,
+            void *release_arguments ),
+     void *release_arguments,
+     libcerror_error_t **error )
+{
+	acquire_extent_t *extent = NULL;
+	static char *function    = "acquire_handle_initialize_extent_digests";
+	int extent_index         = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->number_of_accessible_extents <= 1 )
+	{
+		return( 1 );
+	}
+	for( extent_index = 0;
+	     extent_index < acquire_handle->number_of_extents;
+	     extent_index++ )
+	{
+		extent = &( acquire_handle->extents[ extent_index ] );
+
+		if( ( extent->flags & LIBTABLEAU_EXTENT_FLAG_IS_INACCESSIBLE ) != 0 )
+		{
+			continue;
+		}
+		if( digest_pipeline_initialize(
+		     &( extent->digest_pipeline ),
+		     acquire_handle->digest_types,
+		     maximum_number_of_buffers,
+		     release_function,
+		     release_arguments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create digest pipeline of extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	acquire_handle_free_extent_digests(
+	 acquire_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the digest pipelines of the extents
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_free_extent_digests(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_free_extent_digests";
+	int extent_index      = 0;
+	int result            = 1;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( extent_index = 0;
+	     extent_index < ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_EXTENTS;
+	     extent_index++ )
+	{
+		if( acquire_handle->extents[ extent_index ].digest_pipeline == NULL )
+		{
+			continue;
+		}
+		if( digest_pipeline_free(
+		     &( acquire_handle->extents[ extent_index ].digest_pipeline ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free digest pipeline of extent: %d.",
+			 function,
+			 extent_index );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Finalizes the digest pipeline and the digest pipelines of the extents
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_finalize_digests(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_finalize_digests";
+	int extent_index      = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline_finalize(
+	     acquire_handle->digest_pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize digest hashes.",
+		 function );
+
+		return( -1 );
+	}
+	for( extent_index = 0;
+	     extent_index < acquire_handle->number_of_extents;
+	     extent_index++ )
+	{
+		if( acquire_handle->extents[ extent_index ].digest_pipeline == NULL )
+		{
+			continue;
+		}
+		if( digest_pipeline_finalize(
+		     acquire_handle->extents[ extent_index ].digest_pipeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize digest hashes of extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes a checkpoint of the acquisition up to a specific offset
+ * The output is flushed to the storage first so that the checkpoint never
+ * refers to data that was not durably written
+ * Only call this function when no buffers are pending in the pipeline
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_save_checkpoint(
+     acquire_handle_t *acquire_handle,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	acquire_extent_t *extent = NULL;
+	checkpoint_t *checkpoint = NULL;
+	static char *function    = "acquire_handle_save_checkpoint";
+	int extent_index         = 0;
+	int result               = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing output writer.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint = acquire_handle->checkpoint;
+
+	if( segment_writer_synchronize(
+	     acquire_handle->output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to synchronize output.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint->offset                = offset;
+	checkpoint->number_of_zero_blocks = acquire_handle->number_of_zero_blocks;
+	checkpoint->zero_blocks_size      = acquire_handle->zero_blocks_size;
+
+	result = digest_pipeline_get_state(
+	          acquire_handle->digest_pipeline,
+	          checkpoint->digest_state,
+	          DIGEST_PIPELINE_STATE_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve digest state.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint->digest_state_is_set = (uint8_t) result;
+
+	for( extent_index = 0;
+	     extent_index < acquire_handle->number_of_extents;
+	     extent_index++ )
+	{
+		extent = &( acquire_handle->extents[ extent_index ] );
+
+		checkpoint->extent_digest_state_is_set[ extent_index ] = 0;
+
+		if( extent->digest_pipeline == NULL )
+		{
+			continue;
+		}
+		result = digest_pipeline_get_state(
+		          extent->digest_pipeline,
+		          checkpoint->extent_digest_states[ extent_index ],
+		          DIGEST_PIPELINE_STATE_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve digest state of extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		checkpoint->extent_digest_state_is_set[ extent_index ] = (uint8_t) result;
+	}
+	if( checkpoint_write(
+	     checkpoint,
+	     acquire_handle->checkpoint_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	acquire_handle->checkpoint_save_time = time( NULL );
+
+	return( 1 );
+}
+
+/* Calculates the digest hashes of the data that was acquired before the checkpoint
+ * by reading it back from the output, this is needed when the checkpoint
+ * does not contain the intermediate digest states
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int acquire_handle_rehash_output(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	acquire_extent_t *extent                     = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "acquire_handle_rehash_output";
+	size64_t extent_remaining_size               = 0;
+	size64_t remaining_size                      = 0;
+	uint8_t digest_type                          = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer_initialize(
+	     &storage_media_buffer,
+	     acquire_handle->process_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "Calculating digest hashes of the acquired data up to offset: %" PRIi64 ".\n",
+	 acquire_handle->resume_offset );
+
+	storage_media_buffer->storage_media_offset = 0;
+	remaining_size                             = (size64_t) acquire_handle->resume_offset;
+
+	while( remaining_size > 0 )
+	{
+		if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+		{
+			break;
+		}
+		storage_media_buffer->raw_buffer_data_size = acquire_handle->process_buffer_size;
+
+		if( (size64_t) storage_media_buffer->raw_buffer_data_size > remaining_size )
+		{
+			storage_media_buffer->raw_buffer_data_size = (size_t) remaining_size;
+		}
+		extent = NULL;
+
+		if( acquire_handle_get_extent_by_offset(
+		     acquire_handle,
+		     storage_media_buffer->storage_media_offset,
+		     &extent,
+		     NULL ) == 1 )
+		{
+			extent_remaining_size = extent->size - (size64_t) ( storage_media_buffer->storage_media_offset - extent->offset );
+
+			if( (size64_t) storage_media_buffer->raw_buffer_data_size > extent_remaining_size )
+			{
+				storage_media_buffer->raw_buffer_data_size = (size_t) extent_remaining_size;
+			}
+		}
+		if( acquire_handle_read_output_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read storage media buffer from output.",
+			 function );
+
+			goto on_error;
+		}
+		for( digest_type = DIGEST_PIPELINE_TYPE_MD5;
+		     digest_type <= DIGEST_PIPELINE_TYPE_SHA256;
+		     digest_type <<= 1 )
+		{
+			if( ( acquire_handle->digest_types & digest_type ) == 0 )
+			{
+				continue;
+			}
+			if( digest_pipeline_update(
+			     acquire_handle->digest_pipeline,
+			     digest_type,
+			     storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update digest: 0x%02" PRIx8 ".",
+				 function,
+				 digest_type );
+
+				goto on_error;
+			}
+			if( ( extent != NULL )
+			 && ( extent->digest_pipeline != NULL ) )
+			{
+				if( digest_pipeline_update(
+				     extent->digest_pipeline,
+				     digest_type,
+				     storage_media_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update extent digest: 0x%02" PRIx8 ".",
+					 function,
+					 digest_type );
+
+					goto on_error;
+				}
+			}
+		}
+		storage_media_buffer->storage_media_offset += (off64_t) storage_media_buffer->raw_buffer_data_size;
+		remaining_size                             -= (size64_t) storage_media_buffer->raw_buffer_data_size;
+	}
+	if( storage_media_buffer_free(
+	     &storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( remaining_size > 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Restores the state of the acquisition from the checkpoint when resuming
+ * The digest pipelines must be created and idle. The output is truncated to
+ * the offset of the checkpoint, data written after it is acquired again
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int acquire_handle_restore_checkpoint(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	acquire_extent_t *extent = NULL;
+	checkpoint_t *checkpoint = NULL;
+	static char *function    = "acquire_handle_restore_checkpoint";
+	int extent_index         = 0;
+	int result               = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->resume_acquisition == 0 )
+	{
+		return( 1 );
+	}
+	checkpoint = acquire_handle->checkpoint;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle_set_output_size(
+	     acquire_handle,
+	     (size64_t) acquire_handle->resume_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to set size of output.",
+		 function );
+
+		return( -1 );
+	}
+	/* The digest states can only be restored when all of them were stored
+	 */
+	result = (int) checkpoint->digest_state_is_set;
+
+	for( extent_index = 0;
+	     extent_index < acquire_handle->number_of_extents;
+	     extent_index++ )
+	{
+		if( ( acquire_handle->extents[ extent_index ].digest_pipeline != NULL )
+		 && ( checkpoint->extent_digest_state_is_set[ extent_index ] == 0 ) )
+		{
+			result = 0;
+		}
+	}
+	if( result != 0 )
+	{
+		result = digest_pipeline_set_state(
+		          acquire_handle->digest_pipeline,
+		          checkpoint->digest_state,
+		          DIGEST_PIPELINE_STATE_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set digest state.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* All digests use the same implementation, if the state of the first
+	 * can be set so can the others
+	 */
+	for( extent_index = 0;
+	     ( result == 1 ) && ( extent_index < acquire_handle->number_of_extents );
+	     extent_index++ )
+	{
+		extent = &( acquire_handle->extents[ extent_index ] );
+
+		if( extent->digest_pipeline == NULL )
+		{
+			continue;
+		}
+		if( digest_pipeline_set_state(
+		     extent->digest_pipeline,
+		     checkpoint->extent_digest_states[ extent_index ],
+		     DIGEST_PIPELINE_STATE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set digest state of extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		result = acquire_handle_rehash_output(
+		          acquire_handle,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to calculate digest hashes of output.",
+				 function );
+			}
+			return( result );
+		}
+	}
+	acquire_handle->acquired_size         = (size64_t) acquire_handle->resume_offset;
+	acquire_handle->number_of_zero_blocks = checkpoint->number_of_zero_blocks;
+	acquire_handle->zero_blocks_size      = checkpoint->zero_blocks_size;
+
+	return( 1 );
+}
+
+/* Removes the checkpoint once the acquisition completed
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_remove_checkpoint(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_remove_checkpoint";
+	int result            = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->checkpoint_filename == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = _wunlink(
+	          acquire_handle->checkpoint_filename );
+#elif defined( HAVE_UNLINK )
+	result = unlink(
+	          acquire_handle->checkpoint_filename );
+#endif
+	if( ( result != 0 )
+	 && ( errno != ENOENT ) )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 errno,
+		 "%s: unable to remove checkpoint: %" PRIs_SYSTEM ".",
+		 function,
+		 acquire_handle->checkpoint_filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data of a storage media buffer from the input
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_read_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_read_buffer";
+	ssize_t read_count    = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libtableau_handle_read_buffer_at_offset(
+	              acquire_handle->input_handle,
+	              storage_media_buffer->raw_buffer,
+	              storage_media_buffer->raw_buffer_data_size,
+	              storage_media_buffer->storage_media_offset,
+	              error );
+
+	if( read_count != (ssize_t) storage_media_buffer->raw_buffer_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read %" PRIzd " bytes at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 storage_media_buffer->raw_buffer_data_size,
+		 storage_media_buffer->storage_media_offset,
+		 storage_media_buffer->storage_media_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Passes the data of a storage media buffer to the digest pipeline
+ * and to the digest pipeline of the extent that contains the buffer
+ * The buffers must be hashed in order of their storage media offset
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_hash_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	acquire_extent_t *extent = NULL;
+	static char *function    = "acquire_handle_hash_buffer";
+	int result               = 1;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	/* A digest pipeline releases its references also on failure, hence the
+	 * buffer is passed to the extent digest pipeline regardless
+	 */
+	if( digest_pipeline_push_buffer(
+	     acquire_handle->digest_pipeline,
+	     storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest hashes.",
+		 function );
+
+		result = -1;
+	}
+	if( acquire_handle_get_extent_by_offset(
+	     acquire_handle,
+	     storage_media_buffer->storage_media_offset,
+	     &extent,
+	     NULL ) == 1 )
+	{
+		if( extent->digest_pipeline != NULL )
+		{
+			if( digest_pipeline_push_buffer(
+			     extent->digest_pipeline,
+			     storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update extent digest hashes.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	return( result );
+}
+
+/* Compresses the data of a storage media buffer with its chunk compressor
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_compress_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_compress_buffer";
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_compressor_compress(
+	     storage_media_buffer->chunk_compressor,
+	     storage_media_buffer->raw_buffer,
+	     storage_media_buffer->raw_buffer_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 storage_media_buffer->storage_media_offset,
+		 storage_media_buffer->storage_media_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the compressed data of a storage media buffer to the output
+ * The compressed chunks are written consecutively and their offsets are
+ * appended to the chunk index
+ * The buffers must be written in order of their storage media offset
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_write_compressed_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	chunk_compressor_t *chunk_compressor = NULL;
+	static char *function                = "acquire_handle_write_compressed_buffer";
+	size_t buffer_offset                 = 0;
+	size_t chunk_data_size               = 0;
+	int chunk_index                      = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_compressor = storage_media_buffer->chunk_compressor;
+
+	for( chunk_index = 0;
+	     chunk_index < chunk_compressor->number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_data_size = chunk_compressor->chunk_size;
+
+		if( chunk_data_size > ( storage_media_buffer->raw_buffer_data_size - buffer_offset ) )
+		{
+			chunk_data_size = storage_media_buffer->raw_buffer_data_size - buffer_offset;
+		}
+		if( chunk_index_append_chunk(
+		     acquire_handle->chunk_index,
+		     chunk_data_size,
+		     (size_t) chunk_compressor->chunk_compressed_sizes[ chunk_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to append chunk of offset: %" PRIi64 " (0x%08" PRIx64 ") to chunk index.",
+			 function,
+			 storage_media_buffer->storage_media_offset + (off64_t) buffer_offset,
+			 storage_media_buffer->storage_media_offset + (off64_t) buffer_offset );
+
+			return( -1 );
+		}
+		buffer_offset += chunk_data_size;
+	}
+	if( buffer_offset != storage_media_buffer->raw_buffer_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid storage media buffer - chunks do not cover data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer_write(
+	     acquire_handle->output_writer,
+	     chunk_compressor->compressed_data,
+	     chunk_compressor->compressed_size,
+	     (off64_t) acquire_handle->compressed_size,
+	     (intptr_t *) storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write compressed data of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 storage_media_buffer->storage_media_offset,
+		 storage_media_buffer->storage_media_offset );
+
+		return( -1 );
+	}
+	acquire_handle->compressed_size += (size64_t) chunk_compressor->compressed_size;
+	acquire_handle->acquired_size   += (size64_t) storage_media_buffer->raw_buffer_data_size;
+
+	return( 1 );
+}
+
+/* Writes the data of a storage media buffer to the output
+ * Blocks that consist of zero bytes are skipped, which leaves a hole in the output
+ * The data of a compressed buffer is written as its compressed chunks instead
+ * When the output is written asynchronously the storage media buffer is
+ * referenced until its writes have completed
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_write_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_write_buffer";
+	size_t block_size     = 0;
+	size_t buffer_offset  = 0;
+	size_t run_end_offset = 0;
+	int is_zero_block     = 0;
+	int is_zero_run       = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer->chunk_compressor != NULL )
+	{
+		return( acquire_handle_write_compressed_buffer(
+		         acquire_handle,
+		         storage_media_buffer,
+		         error ) );
+	}
+	while( buffer_offset < storage_media_buffer->raw_buffer_data_size )
+	{
+		/* Determine the run of blocks that either all or none consist of zero bytes
+		 */
+		run_end_offset = buffer_offset;
+		is_zero_run    = -1;
+
+		while( run_end_offset < storage_media_buffer->raw_buffer_data_size )
+		{
+			block_size = ACQUIRE_HANDLE_ZERO_BLOCK_SIZE;
+
+			if( block_size > ( storage_media_buffer->raw_buffer_data_size - run_end_offset ) )
+			{
+				block_size = storage_media_buffer->raw_buffer_data_size - run_end_offset;
+			}
+			is_zero_block = storage_media_buffer_check_for_zero_block(
+			                 storage_media_buffer,
+			                 run_end_offset,
+			                 block_size,
+			                 error );
+
+			if( is_zero_block == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to determine if block consists of zero bytes.",
+				 function );
+
+				return( -1 );
+			}
+			if( is_zero_run == -1 )
+			{
+				is_zero_run = is_zero_block;
+			}
+			else if( is_zero_block != is_zero_run )
+			{
+				break;
+			}
+			if( is_zero_block != 0 )
+			{
+				acquire_handle->number_of_zero_blocks += 1;
+				acquire_handle->zero_blocks_size      += block_size;
+			}
+			run_end_offset += block_size;
+		}
+		if( is_zero_run == 0 )
+		{
+			if( segment_writer_write(
+			     acquire_handle->output_writer,
+			     &( storage_media_buffer->raw_buffer[ buffer_offset ] ),
+			     run_end_offset - buffer_offset,
+			     storage_media_buffer->storage_media_offset + (off64_t) buffer_offset,
+			     (intptr_t *) storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 storage_media_buffer->storage_media_offset,
+				 storage_media_buffer->storage_media_offset );
+
+				return( -1 );
+			}
+		}
+		buffer_offset = run_end_offset;
+	}
+	acquire_handle->acquired_size += buffer_offset;
+
+	return( 1 );
+}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+/* Marks the acquisition as failed and prints the error of a pipeline stage
+ */
+void acquire_handle_stage_failed(
+      acquire_handle_t *acquire_handle,
+      libcerror_error_t **error )
+{
+	acquire_handle->stage_failed = 1;
+
+	acquire_handle_signal_abort(
+	 acquire_handle,
+	 NULL );
+
+	if( ( error != NULL )
+	 && ( *error != NULL ) )
+	{
+		libcnotify_print_error_backtrace(
+		 *error );
+		libcerror_error_free(
+		 error );
+	}
+}
+
+/* Releases a reference to a storage media buffer
+ * The buffer returns to the queue of buffers available for reading when
+ * no pipeline stage uses it anymore
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_release_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function    = "acquire_handle_release_buffer";
+	int number_of_references = 0;
+
+	if( libcthreads_mutex_grab(
+	     acquire_handle->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab references mutex.",
+		 function );
+
+		return( -1 );
+	}
+	storage_media_buffer->number_of_references -= 1;
+
+	number_of_references = storage_media_buffer->number_of_references;
+
+	if( libcthreads_mutex_release(
+	     acquire_handle->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release references mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_references > 0 )
+	{
+		return( 1 );
+	}
+	if( libcthreads_queue_push(
+	     acquire_handle->free_buffer_queue,
+	     (intptr_t *) storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push storage media buffer onto free queue.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function of the digest pipeline, called when a digest no longer
+ * uses a storage media buffer
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_digest_release_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle )
+{
+	libcerror_error_t *error = NULL;
+
+	if( acquire_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( acquire_handle_release_buffer(
+	     acquire_handle,
+	     storage_media_buffer,
+	     &error ) != 1 )
+	{
+		acquire_handle_stage_failed(
+		 acquire_handle,
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function of the output writer, called before an asynchronous
+ * write of a storage media buffer is submitted
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_output_reference_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "acquire_handle_output_reference_callback";
+
+	if( acquire_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     acquire_handle->references_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab references mutex.",
+		 function );
+
+		acquire_handle_stage_failed(
+		 acquire_handle,
+		 &error );
+
+		return( -1 );
+	}
+	storage_media_buffer->number_of_references += 1;
+
+	if( libcthreads_mutex_release(
+	     acquire_handle->references_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release references mutex.",
+		 function );
+
+		acquire_handle_stage_failed(
+		 acquire_handle,
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function of the output writer, called when an asynchronous
+ * write of a storage media buffer has completed
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_output_release_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle )
+{
+	libcerror_error_t *error = NULL;
+
+	if( acquire_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( acquire_handle_release_buffer(
+	     acquire_handle,
+	     storage_media_buffer,
+	     &error ) != 1 )
+	{
+		acquire_handle_stage_failed(
+		 acquire_handle,
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function of the read thread pool
+ * Multiple buffers are read concurrently, the buffer is always passed on to
+ * the compress or hash thread pool so that it eventually returns to the free queue
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_read_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "acquire_handle_read_callback";
+
+	if( acquire_handle == NULL )
+	{
+		return( -1 );
+	}
+	storage_media_buffer->read_result = 0;
+
+	if( acquire_handle_is_aborted( acquire_handle ) == 0 )
+	{
+		storage_media_buffer->read_result = acquire_handle_read_buffer(
+		                                     acquire_handle,
+		                                     storage_media_buffer,
+		                                     &error );
+
+		if( storage_media_buffer->read_result != 1 )
+		{
+			/* An abort is not reported as a failure
+			 */
+			if( acquire_handle_is_aborted( acquire_handle ) == 0 )
+			{
+				acquire_handle_stage_failed(
+				 acquire_handle,
+				 &error );
+			}
+			else
+			{
+				libcerror_error_free(
+				 &error );
+			}
+		}
+	}
+	if( acquire_handle->compress_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_push(
+		     acquire_handle->compress_thread_pool,
+		     (intptr_t *) storage_media_buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto compress thread pool queue.",
+			 function );
+
+			acquire_handle_stage_failed(
+			 acquire_handle,
+			 &error );
+
+			return( -1 );
+		}
+	}
+	else if( libcthreads_thread_pool_push(
+	          acquire_handle->hash_thread_pool,
+	          (intptr_t *) storage_media_buffer,
+	          &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push storage media buffer onto hash thread pool queue.",
+		 function );
+
+		acquire_handle_stage_failed(
+		 acquire_handle,
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function of the compress thread pool
+ * Multiple buffers are compressed concurrently, the hash thread pool passes
+ * them on in order. The buffer is always passed on to the hash thread pool
+ * so that it eventually returns to the free queue
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_compress_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "acquire_handle_compress_callback";
+
+	if( acquire_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( ( storage_media_buffer->read_result == 1 )
+	 && ( acquire_handle_is_aborted( acquire_handle ) == 0 ) )
+	{
+		if( acquire_handle_compress_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     &error ) != 1 )
+		{
+			storage_media_buffer->read_result = 0;
+
+			acquire_handle_stage_failed(
+			 acquire_handle,
+			 &error );
+		}
+	}
+	if( libcthreads_thread_pool_push(
+	     acquire_handle->hash_thread_pool,
+	     (intptr_t *) storage_media_buffer,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push storage media buffer onto hash thread pool queue.",
+		 function );
+
+		acquire_handle_stage_failed(
+		 acquire_handle,
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function of the hash thread pool
+ * The buffers arrive in the order the reads completed, they are kept
+ * pending until all preceding buffers were passed on. The digest workers
+ * and the write stage then share the buffer, each holding a reference
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_hash_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle )
+{
+	acquire_extent_t *extent = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "acquire_handle_hash_callback";
+	int buffer_index         = 0;
+
+	if( acquire_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( ( storage_media_buffer->read_result != 1 )
+	 || ( acquire_handle_is_aborted( acquire_handle ) != 0 ) )
+	{
+		if( acquire_handle_release_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     &error ) != 1 )
+		{
+			acquire_handle_stage_failed(
+			 acquire_handle,
+			 &error );
+
+			return( -1 );
+		}
+		/* The buffers kept pending are never hashed after an abort, they are
+		 * released so that every buffer returns to the free queue
+		 */
+		if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+		{
+			for( buffer_index = 0;
+			     buffer_index < acquire_handle->number_of_buffers;
+			     buffer_index++ )
+			{
+				storage_media_buffer = acquire_handle->pending_buffers[ buffer_index ];
+
+				if( storage_media_buffer == NULL )
+				{
+					continue;
+				}
+				acquire_handle->pending_buffers[ buffer_index ] = NULL;
+
+				if( acquire_handle_release_buffer(
+				     acquire_handle,
+				     storage_media_buffer,
+				     &error ) != 1 )
+				{
+					acquire_handle_stage_failed(
+					 acquire_handle,
+					 &error );
+
+					return( -1 );
+				}
+			}
+		}
+		return( 1 );
+	}
+	/* There are never more buffers in the pipeline than pending buffer slots
+	 */
+	buffer_index = (int) ( storage_media_buffer->sequence_number % acquire_handle->number_of_buffers );
+
+	acquire_handle->pending_buffers[ buffer_index ] = storage_media_buffer;
+
+	buffer_index = (int) ( acquire_handle->next_sequence_number % acquire_handle->number_of_buffers );
+
+	while( acquire_handle->pending_buffers[ buffer_index ] != NULL )
+	{
+		storage_media_buffer = acquire_handle->pending_buffers[ buffer_index ];
+
+		if( storage_media_buffer->sequence_number != acquire_handle->next_sequence_number )
+		{
+			break;
+		}
+		acquire_handle->pending_buffers[ buffer_index ] = NULL;
+
+		/* No other stage uses the buffer yet so the references can be set
+		 * without holding the mutex
+		 */
+		storage_media_buffer->number_of_references = acquire_handle->digest_pipeline->number_of_digests + 1;
+
+		if( acquire_handle_get_extent_by_offset(
+		     acquire_handle,
+		     storage_media_buffer->storage_media_offset,
+		     &extent,
+		     NULL ) == 1 )
+		{
+			if( extent->digest_pipeline != NULL )
+			{
+				storage_media_buffer->number_of_references += extent->digest_pipeline->number_of_digests;
+			}
+		}
+
+		/* The digest pipeline releases its references also on failure
+		 */
+		if( acquire_handle_hash_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     &error ) != 1 )
+		{
+			acquire_handle_stage_failed(
+			 acquire_handle,
+			 &error );
+
+			acquire_handle_release_buffer(
+			 acquire_handle,
+			 storage_media_buffer,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libcthreads_thread_pool_push(
+		     acquire_handle->write_thread_pool,
+		     (intptr_t *) storage_media_buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto write thread pool queue.",
+			 function );
+
+			acquire_handle_stage_failed(
+			 acquire_handle,
+			 &error );
+
+			acquire_handle_release_buffer(
+			 acquire_handle,
+			 storage_media_buffer,
+			 NULL );
+
+			return( -1 );
+		}
+		acquire_handle->next_sequence_number += 1;
+
+		buffer_index = (int) ( acquire_handle->next_sequence_number % acquire_handle->number_of_buffers );
+	}
+	return( 1 );
+}
+
+/* Callback function of the write thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_write_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 1;
+
+	if( acquire_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( acquire_handle_is_aborted( acquire_handle ) == 0 )
+	{
+		if( acquire_handle_write_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     &error ) != 1 )
+		{
+			acquire_handle_stage_failed(
+			 acquire_handle,
+			 &error );
+
+			result = -1;
+		}
+	}
+	if( acquire_handle_release_buffer(
+	     acquire_handle,
+	     storage_media_buffer,
+	     &error ) != 1 )
+	{
+		acquire_handle_stage_failed(
+		 acquire_handle,
+		 &error );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Writes a checkpoint of the acquisition up to a specific offset while the pipeline runs
+ * All buffers are taken from the free queue first, which means every buffer
+ * that was pushed before has passed through all stages, and are returned after
+ * No checkpoint is written when the acquisition was aborted meanwhile
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_save_checkpoint_threaded(
+     acquire_handle_t *acquire_handle,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	storage_media_buffer_t *storage_media_buffers[ ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_BUFFERS ];
+
+	static char *function = "acquire_handle_save_checkpoint_threaded";
+	int buffer_index      = 0;
+	int number_of_buffers = 0;
+	int result            = 1;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( acquire_handle->number_of_buffers < 0 )
+	 || ( acquire_handle->number_of_buffers > ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid acquire handle - number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < acquire_handle->number_of_buffers;
+	     buffer_index++ )
+	{
+		if( libcthreads_queue_pop(
+		     acquire_handle->free_buffer_queue,
+		     (intptr_t **) &( storage_media_buffers[ buffer_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop storage media buffer from free queue.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		number_of_buffers++;
+	}
+	if( ( result == 1 )
+	 && ( acquire_handle_is_aborted( acquire_handle ) == 0 )
+	 && ( acquire_handle->stage_failed == 0 ) )
+	{
+		if( acquire_handle_save_checkpoint(
+		     acquire_handle,
+		     offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write checkpoint.",
+			 function );
+
+			result = -1;
+		}
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( libcthreads_queue_push(
+		     acquire_handle->free_buffer_queue,
+		     (intptr_t *) storage_media_buffers[ buffer_index ],
+		     NULL ) != 1 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push storage media buffer onto free queue.",
+				 function );
+			}
+			storage_media_buffer_free(
+			 &( storage_media_buffers[ buffer_index ] ),
+			 NULL );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Determines the number of compression threads, one per online processor
+ * Returns the number of compression threads
+ */
+static int acquire_handle_get_number_of_compression_threads(
+            void )
+{
+	long number_of_processors = 0;
+
+#if defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	number_of_processors = sysconf(
+	                        _SC_NPROCESSORS_ONLN );
+#endif
+	if( number_of_processors < 1 )
+	{
+		return( ACQUIRE_HANDLE_DEFAULT_NUMBER_OF_COMPRESSION_THREADS );
+	}
+	if( number_of_processors > ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_COMPRESSION_THREADS )
+	{
+		return( ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_COMPRESSION_THREADS );
+	}
+	return( (int) number_of_processors );
+}
+
+/* Acquires the input using a pipeline of read, hash and write thread pools
+ * The hash thread pool passes the buffers on to a digest worker per digest type
+ * When the output is compressed a compress thread pool between the read and
+ * hash thread pools compresses the buffers
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_acquire_threaded(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *raw_buffers[ ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_BUFFERS ];
+	chunk_compressor_t *chunk_compressors[ ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_BUFFERS ];
+
+	acquire_extent_t *extent                     = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "acquire_handle_acquire_threaded";
+	size64_t extent_remaining_size               = 0;
+	size64_t remaining_size                      = 0;
+	off64_t storage_media_offset                 = 0;
+	uint64_t sequence_number                     = 0;
+	int buffer_index                             = 0;
+	int extent_index                             = 0;
+	int result                                   = 1;
+
+	if( memory_set(
+	     chunk_compressors,
+	     0,
+	     sizeof( chunk_compressor_t * ) * ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_BUFFERS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk compressors.",
+		 function );
+
+		return( -1 );
+	}
+	acquire_handle->number_of_compression_threads = 0;
+
+	if( acquire_handle->compression_level != CHUNK_COMPRESSOR_LEVEL_NONE )
+	{
+		acquire_handle->number_of_compression_threads = acquire_handle_get_number_of_compression_threads();
+	}
+	/* Allow every read thread to have a read in flight while the hash and
+	 * write stages each work on a buffer and one buffer is queued between them
+	 */
+	acquire_handle->number_of_buffers    = ( acquire_handle->number_of_threads * 2 ) + 2 + acquire_handle->number_of_compression_threads;
+	acquire_handle->next_sequence_number = 0;
+
+	acquire_handle->pending_buffers = (storage_media_buffer_t **) memory_allocate(
+	                                                               sizeof( storage_media_buffer_t * ) * acquire_handle->number_of_buffers );
+
+	if( acquire_handle->pending_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pending buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     acquire_handle->pending_buffers,
+	     0,
+	     sizeof( storage_media_buffer_t * ) * acquire_handle->number_of_buffers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pending buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( acquire_handle->references_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create references mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( acquire_handle->free_buffer_queue ),
+	     acquire_handle->number_of_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create free buffer queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < acquire_handle->number_of_buffers;
+	     buffer_index++ )
+	{
+		if( storage_media_buffer_initialize(
+		     &storage_media_buffer,
+		     acquire_handle->process_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create storage media buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		raw_buffers[ buffer_index ] = storage_media_buffer->raw_buffer;
+
+		/* The write stage writes a compressed buffer from its compressed data
+		 */
+		if( acquire_handle->compression_level != CHUNK_COMPRESSOR_LEVEL_NONE )
+		{
+			if( chunk_compressor_initialize(
+			     &( chunk_compressors[ buffer_index ] ),
+			     CHUNK_COMPRESSOR_CHUNK_SIZE,
+			     acquire_handle->process_buffer_size,
+			     acquire_handle->compression_level,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create chunk compressor: %d.",
+				 function,
+				 buffer_index );
+
+				goto on_error;
+			}
+			storage_media_buffer->chunk_compressor = chunk_compressors[ buffer_index ];
+
+			raw_buffers[ buffer_index ] = chunk_compressors[ buffer_index ]->compressed_data;
+		}
+
+		if( libcthreads_queue_push(
+		     acquire_handle->free_buffer_queue,
+		     (intptr_t *) storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer: %d onto free queue.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		storage_media_buffer = NULL;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( acquire_handle->write_thread_pool ),
+	     NULL,
+	     1,
+	     acquire_handle->number_of_buffers,
+	     (int (*)(intptr_t *, void *)) &acquire_handle_write_callback,
+	     (void *) acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create write thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( digest_pipeline_initialize(
+	     &( acquire_handle->digest_pipeline ),
+	     acquire_handle->digest_types,
+	     acquire_handle->number_of_buffers,
+	     (int (*)(storage_media_buffer_t *, void *)) &acquire_handle_digest_release_callback,
+	     (void *) acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( acquire_handle_initialize_extent_digests(
+	     acquire_handle,
+	     acquire_handle->number_of_buffers,
+	     (int (*)(storage_media_buffer_t *, void *)) &acquire_handle_digest_release_callback,
+	     (void *) acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent digests.",
+		 function );
+
+		goto on_error;
+	}
+	if( acquire_handle_restore_checkpoint(
+	     acquire_handle,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to restore checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	/* The write stage submits the writes of the storage media buffers and
+	 * the buffers return to the free queue once their writes have completed
+	 */
+	result = segment_writer_start_asynchronous(
+	          acquire_handle->output_writer,
+	          raw_buffers,
+	          acquire_handle->process_buffer_size,
+	          acquire_handle->number_of_buffers,
+	          (int (*)(intptr_t *, void *)) &acquire_handle_output_reference_callback,
+	          (int (*)(intptr_t *, void *)) &acquire_handle_output_release_callback,
+	          (void *) acquire_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start asynchronous output writes.",
+		 function );
+
+		goto on_error;
+	}
+	acquire_handle->asynchronous_output = (uint8_t) result;
+
+	result = 1;
+
+	if( libcthreads_thread_pool_create(
+	     &( acquire_handle->hash_thread_pool ),
+	     NULL,
+	     1,
+	     acquire_handle->number_of_buffers,
+	     (int (*)(intptr_t *, void *)) &acquire_handle_hash_callback,
+	     (void *) acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hash thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( acquire_handle->number_of_compression_threads > 0 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( acquire_handle->compress_thread_pool ),
+		     NULL,
+		     acquire_handle->number_of_compression_threads,
+		     acquire_handle->number_of_buffers,
+		     (int (*)(intptr_t *, void *)) &acquire_handle_compress_callback,
+		     (void *) acquire_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compress thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_pool_create(
+	     &( acquire_handle->read_thread_pool ),
+	     NULL,
+	     acquire_handle->number_of_threads,
+	     acquire_handle->number_of_buffers,
+	     (int (*)(intptr_t *, void *)) &acquire_handle_read_callback,
+	     (void *) acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	storage_media_offset = acquire_handle->resume_offset;
+	remaining_size       = acquire_handle->media_size - (size64_t) acquire_handle->resume_offset;
+
+	while( remaining_size > 0 )
+	{
+		if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+		{
+			break;
+		}
+		if( ( acquire_handle->checkpoint != NULL )
+		 && ( ( time( NULL ) - acquire_handle->checkpoint_save_time ) >= ACQUIRE_HANDLE_CHECKPOINT_INTERVAL ) )
+		{
+			if( acquire_handle_save_checkpoint_threaded(
+			     acquire_handle,
+			     storage_media_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		/* Blocks until a buffer has passed through the write stage
+		 */
+		if( libcthreads_queue_pop(
+		     acquire_handle->free_buffer_queue,
+		     (intptr_t **) &storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop storage media buffer from free queue.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+		{
+			if( libcthreads_queue_push(
+			     acquire_handle->free_buffer_queue,
+			     (intptr_t *) storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push storage media buffer onto free queue.",
+				 function );
+
+				result = -1;
+			}
+			storage_media_buffer = NULL;
+
+			break;
+		}
+		storage_media_buffer->storage_media_offset = storage_media_offset;
+		storage_media_buffer->sequence_number      = sequence_number;
+		storage_media_buffer->raw_buffer_data_size = acquire_handle->process_buffer_size;
+		storage_media_buffer->number_of_references = 1;
+
+		if( (size64_t) storage_media_buffer->raw_buffer_data_size > remaining_size )
+		{
+			storage_media_buffer->raw_buffer_data_size = (size_t) remaining_size;
+		}
+		/* A buffer never spans more than one extent so that the extent digests
+		 * can be calculated from the same buffers
+		 */
+		if( acquire_handle_get_extent_by_offset(
+		     acquire_handle,
+		     storage_media_offset,
+		     &extent,
+		     NULL ) == 1 )
+		{
+			extent_remaining_size = extent->size - (size64_t) ( storage_media_offset - extent->offset );
+
+			if( (size64_t) storage_media_buffer->raw_buffer_data_size > extent_remaining_size )
+			{
+				storage_media_buffer->raw_buffer_data_size = (size_t) extent_remaining_size;
+			}
+		}
+		if( libcthreads_thread_pool_push(
+		     acquire_handle->read_thread_pool,
+		     (intptr_t *) storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto read thread pool queue.",
+			 function );
+
+			libcthreads_queue_push(
+			 acquire_handle->free_buffer_queue,
+			 (intptr_t *) storage_media_buffer,
+			 NULL );
+
+			storage_media_buffer = NULL;
+			result               = -1;
+
+			break;
+		}
+		storage_media_offset += (off64_t) storage_media_buffer->raw_buffer_data_size;
+		remaining_size       -= (size64_t) storage_media_buffer->raw_buffer_data_size;
+		sequence_number      += 1;
+
+		storage_media_buffer = NULL;
+	}
+	if( result != 1 )
+	{
+		acquire_handle_signal_abort(
+		 acquire_handle,
+		 NULL );
+	}
+	/* The pools are joined in pipeline order so that every buffer is passed on
+	 * before the next stage stops
+	 */
+	if( libcthreads_thread_pool_join(
+	     &( acquire_handle->read_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join read thread pool.",
+		 function );
+
+		result = -1;
+	}
+	if( acquire_handle->compress_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( acquire_handle->compress_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join compress thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_thread_pool_join(
+	     &( acquire_handle->hash_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join hash thread pool.",
+		 function );
+
+		result = -1;
+	}
+	if( digest_pipeline_join(
+	     acquire_handle->digest_pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join digest pipeline.",
+		 function );
+
+		result = -1;
+	}
+	for( extent_index = 0;
+	     extent_index < acquire_handle->number_of_extents;
+	     extent_index++ )
+	{
+		if( acquire_handle->extents[ extent_index ].digest_pipeline == NULL )
+		{
+			continue;
+		}
+		if( digest_pipeline_join(
+		     acquire_handle->extents[ extent_index ].digest_pipeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join digest pipeline of extent: %d.",
+			 function,
+			 extent_index );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_thread_pool_join(
+	     &( acquire_handle->write_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join write thread pool.",
+		 function );
+
+		result = -1;
+	}
+	if( segment_writer_stop_asynchronous(
+	     acquire_handle->output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to complete asynchronous output writes.",
+		 function );
+
+		result = -1;
+	}
+	for( buffer_index = 0;
+	     buffer_index < acquire_handle->number_of_buffers;
+	     buffer_index++ )
+	{
+		storage_media_buffer_free(
+		 &( acquire_handle->pending_buffers[ buffer_index ] ),
+		 NULL );
+	}
+	memory_free(
+	 acquire_handle->pending_buffers );
+
+	acquire_handle->pending_buffers = NULL;
+
+	if( libcthreads_queue_free(
+	     &( acquire_handle->free_buffer_queue ),
+	     (int (*)(intptr_t **, libcerror_error_t **)) &storage_media_buffer_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free free buffer queue.",
+		 function );
+
+		result = -1;
+	}
+	for( buffer_index = 0;
+	     buffer_index < acquire_handle->number_of_buffers;
+	     buffer_index++ )
+	{
+		if( chunk_compressors[ buffer_index ] == NULL )
+		{
+			continue;
+		}
+		if( chunk_compressor_free(
+		     &( chunk_compressors[ buffer_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk compressor: %d.",
+			 function,
+			 buffer_index );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_free(
+	     &( acquire_handle->references_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free references mutex.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+
+on_error:
+	if( acquire_handle->read_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( acquire_handle->read_thread_pool ),
+		 NULL );
+	}
+	if( acquire_handle->compress_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( acquire_handle->compress_thread_pool ),
+		 NULL );
+	}
+	if( acquire_handle->hash_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( acquire_handle->hash_thread_pool ),
+		 NULL );
+	}
+	if( acquire_handle->digest_pipeline != NULL )
+	{
+		digest_pipeline_join(
+		 acquire_handle->digest_pipeline,
+		 NULL );
+	}
+	acquire_handle_free_extent_digests(
+	 acquire_handle,
+	 NULL );
+
+	if( acquire_handle->write_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( acquire_handle->write_thread_pool ),
+		 NULL );
+	}
+	segment_writer_stop_asynchronous(
+	 acquire_handle->output_writer,
+	 NULL );
+
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	if( acquire_handle->free_buffer_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( acquire_handle->free_buffer_queue ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &storage_media_buffer_free,
+		 NULL );
+	}
+	if( acquire_handle->pending_buffers != NULL )
+	{
+		memory_free(
+		 acquire_handle->pending_buffers );
+
+		acquire_handle->pending_buffers = NULL;
+	}
+	for( buffer_index = 0;
+	     buffer_index < ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( chunk_compressors[ buffer_index ] != NULL )
+		{
+			chunk_compressor_free(
+			 &( chunk_compressors[ buffer_index ] ),
+			 NULL );
+		}
+	}
+	if( acquire_handle->references_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( acquire_handle->references_mutex ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+/* Acquires the input a buffer at a time
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_acquire_single_threaded(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	acquire_extent_t *extent                     = NULL;
+	chunk_compressor_t *chunk_compressor         = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "acquire_handle_acquire_single_threaded";
+	size64_t extent_remaining_size               = 0;
+	size64_t remaining_size                      = 0;
+
+	if( digest_pipeline_initialize(
+	     &( acquire_handle->digest_pipeline ),
+	     acquire_handle->digest_types,
+	     0,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( acquire_handle_initialize_extent_digests(
+	     acquire_handle,
+	     0,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent digests.",
+		 function );
+
+		goto on_error;
+	}
+	if( storage_media_buffer_initialize(
+	     &storage_media_buffer,
+	     acquire_handle->process_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( acquire_handle->compression_level != CHUNK_COMPRESSOR_LEVEL_NONE )
+	{
+		if( chunk_compressor_initialize(
+		     &chunk_compressor,
+		     CHUNK_COMPRESSOR_CHUNK_SIZE,
+		     acquire_handle->process_buffer_size,
+		     acquire_handle->compression_level,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk compressor.",
+			 function );
+
+			goto on_error;
+		}
+		storage_media_buffer->chunk_compressor = chunk_compressor;
+
+		acquire_handle->number_of_compression_threads = 1;
+	}
+	if( acquire_handle_restore_checkpoint(
+	     acquire_handle,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to restore checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	storage_media_buffer->storage_media_offset = acquire_handle->resume_offset;
+	remaining_size                             = acquire_handle->media_size - (size64_t) acquire_handle->resume_offset;
+
+	while( remaining_size > 0 )
+	{
+		if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+		{
+			break;
+		}
+		if( ( acquire_handle->checkpoint != NULL )
+		 && ( ( time( NULL ) - acquire_handle->checkpoint_save_time ) >= ACQUIRE_HANDLE_CHECKPOINT_INTERVAL ) )
+		{
+			if( acquire_handle_save_checkpoint(
+			     acquire_handle,
+			     storage_media_buffer->storage_media_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		storage_media_buffer->raw_buffer_data_size = acquire_handle->process_buffer_size;
+
+		if( (size64_t) storage_media_buffer->raw_buffer_data_size > remaining_size )
+		{
+			storage_media_buffer->raw_buffer_data_size = (size_t) remaining_size;
+		}
+		if( acquire_handle_get_extent_by_offset(
+		     acquire_handle,
+		     storage_media_buffer->storage_media_offset,
+		     &extent,
+		     NULL ) == 1 )
+		{
+			extent_remaining_size = extent->size - (size64_t) ( storage_media_buffer->storage_media_offset - extent->offset );
+
+			if( (size64_t) storage_media_buffer->raw_buffer_data_size > extent_remaining_size )
+			{
+				storage_media_buffer->raw_buffer_data_size = (size_t) extent_remaining_size;
+			}
+		}
+		if( acquire_handle_read_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read storage media buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( acquire_handle_hash_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to hash storage media buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( chunk_compressor != NULL )
+		{
+			if( acquire_handle_compress_buffer(
+			     acquire_handle,
+			     storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to compress storage media buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( acquire_handle_write_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write storage media buffer.",
+			 function );
+
+			goto on_error;
+		}
+		storage_media_buffer->storage_media_offset += (off64_t) storage_media_buffer->raw_buffer_data_size;
+		remaining_size                             -= (size64_t) storage_media_buffer->raw_buffer_data_size;
+	}
+	if( storage_media_buffer_free(
+	     &storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( chunk_compressor != NULL )
+	{
+		if( chunk_compressor_free(
+		     &chunk_compressor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk compressor.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	if( chunk_compressor != NULL )
+	{
+		chunk_compressor_free(
+		 &chunk_compressor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Acquires the input to the output
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int acquire_handle_acquire(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_acquire";
+	int result            = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( acquire_handle->bytes_per_sector == 0 )
+	 || ( ( acquire_handle->process_buffer_size % acquire_handle->bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported process buffer size value not a multiple of bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( acquire_handle->compression_level != CHUNK_COMPRESSOR_LEVEL_NONE )
+	 && ( ( acquire_handle->process_buffer_size % CHUNK_COMPRESSOR_CHUNK_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported process buffer size value not a multiple of the compression chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->digest_pipeline != NULL )
+	{
+		if( digest_pipeline_free(
+		     &( acquire_handle->digest_pipeline ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free digest pipeline.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( acquire_handle_free_extent_digests(
+	     acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extent digests.",
+		 function );
+
+		return( -1 );
+	}
+	acquire_handle->acquired_size         = 0;
+	acquire_handle->number_of_zero_blocks = 0;
+	acquire_handle->zero_blocks_size      = 0;
+	acquire_handle->compressed_size       = 0;
+	acquire_handle->stage_failed          = 0;
+	acquire_handle->start_time            = time( NULL );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	result = acquire_handle_acquire_threaded(
+	          acquire_handle,
+	          error );
+#else
+	result = acquire_handle_acquire_single_threaded(
+	          acquire_handle,
+	          error );
+#endif
+	acquire_handle->end_time = time( NULL );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to acquire input.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->stage_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to acquire input - a pipeline stage failed.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+	{
+		return( 0 );
+	}
+	if( acquire_handle->chunk_index != NULL )
+	{
+		if( acquire_handle_set_output_size(
+		     acquire_handle,
+		     acquire_handle->compressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to set size of output.",
+			 function );
+
+			return( -1 );
+		}
+		if( chunk_index_finalize(
+		     acquire_handle->chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to finalize chunk index.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( acquire_handle_set_output_size(
+	          acquire_handle,
+	          acquire_handle->acquired_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to set size of output.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle_finalize_digests(
+	     acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize digest hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle_remove_checkpoint(
+	     acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 "%s: unable to remove checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data of a storage media buffer back from a compressed output
+ * The chunks that contain the data are located with the chunk index and
+ * decompressed, data beyond the end of the media is read as zero bytes
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_read_compressed_output_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	uint8_t *chunk_data             = NULL;
+	uint8_t *compressed_chunk_data  = NULL;
+	uint8_t *decompressed_data      = NULL;
+	static char *function           = "acquire_handle_read_compressed_output_buffer";
+	size_t buffer_offset            = 0;
+	size_t chunk_compressed_size    = 0;
+	size_t chunk_data_offset        = 0;
+	size_t chunk_data_size          = 0;
+	size_t read_size                = 0;
+	off64_t chunk_compressed_offset = 0;
+	off64_t chunk_media_offset      = 0;
+	off64_t offset                  = 0;
+	int result                      = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * acquire_handle->chunk_index->chunk_size );
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk data.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_chunk_data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * acquire_handle->chunk_index->chunk_size );
+
+	if( compressed_chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed chunk data.",
+		 function );
+
+		goto on_error;
+	}
+	while( buffer_offset < storage_media_buffer->raw_buffer_data_size )
+	{
+		offset = storage_media_buffer->storage_media_offset + (off64_t) buffer_offset;
+
+		result = chunk_index_get_chunk_by_offset(
+		          acquire_handle->chunk_index,
+		          offset,
+		          &chunk_media_offset,
+		          &chunk_data_size,
+		          &chunk_compressed_offset,
+		          &chunk_compressed_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( memory_set(
+			     &( storage_media_buffer->raw_buffer[ buffer_offset ] ),
+			     0,
+			     storage_media_buffer->raw_buffer_data_size - buffer_offset ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear data beyond the end of the media.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+		}
+		if( segment_writer_read(
+		     acquire_handle->output_writer,
+		     compressed_chunk_data,
+		     chunk_compressed_size,
+		     chunk_compressed_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed chunk of offset: %" PRIi64 " (0x%08" PRIx64 ") from output.",
+			 function,
+			 chunk_media_offset,
+			 chunk_media_offset );
+
+			goto on_error;
+		}
+		chunk_data_offset = (size_t) ( offset - chunk_media_offset );
+		read_size         = chunk_data_size - chunk_data_offset;
+
+		if( read_size > ( storage_media_buffer->raw_buffer_data_size - buffer_offset ) )
+		{
+			read_size = storage_media_buffer->raw_buffer_data_size - buffer_offset;
+		}
+		/* A chunk that lies entirely within the buffer is decompressed in place
+		 */
+		if( ( chunk_data_offset == 0 )
+		 && ( read_size == chunk_data_size ) )
+		{
+			decompressed_data = &( storage_media_buffer->raw_buffer[ buffer_offset ] );
+		}
+		else
+		{
+			decompressed_data = chunk_data;
+		}
+		if( chunk_compressor_decompress(
+		     compressed_chunk_data,
+		     chunk_compressed_size,
+		     decompressed_data,
+		     chunk_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 chunk_media_offset,
+			 chunk_media_offset );
+
+			goto on_error;
+		}
+		if( decompressed_data == chunk_data )
+		{
+			if( memory_copy(
+			     &( storage_media_buffer->raw_buffer[ buffer_offset ] ),
+			     &( chunk_data[ chunk_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy chunk data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		buffer_offset += read_size;
+	}
+	memory_free(
+	 compressed_chunk_data );
+
+	memory_free(
+	 chunk_data );
+
+	return( 1 );
+
+on_error:
+	if( compressed_chunk_data != NULL )
+	{
+		memory_free(
+		 compressed_chunk_data );
+	}
+	if( chunk_data != NULL )
+	{
+		memory_free(
+		 chunk_data );
+	}
+	return( -1 );
+}
+
+/* Reads the data of a storage media buffer back from the output
+ * Data beyond the end of the output is read as zero bytes
+ * A compressed output is read back by means of its chunk index
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_read_output_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_read_output_buffer";
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->chunk_index != NULL )
+	{
+		return( acquire_handle_read_compressed_output_buffer(
+		         acquire_handle,
+		         storage_media_buffer,
+		         error ) );
+	}
+	if( segment_writer_read(
+	     acquire_handle->output_writer,
+	     storage_media_buffer->raw_buffer,
+	     storage_media_buffer->raw_buffer_data_size,
+	     storage_media_buffer->storage_media_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data of offset: %" PRIi64 " (0x%08" PRIx64 ") from output.",
+		 function,
+		 storage_media_buffer->storage_media_offset,
+		 storage_media_buffer->storage_media_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the rescue map
+ * Unless forced the rescue map is only written when the save interval has passed
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_save_rescue_map(
+     acquire_handle_t *acquire_handle,
+     int force,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_save_rescue_map";
+	time_t current_time   = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	current_time = time( NULL );
+
+	if( ( force == 0 )
+	 && ( ( current_time - acquire_handle->rescue_map_save_time ) < ACQUIRE_HANDLE_RECOVERY_SAVE_INTERVAL ) )
+	{
+		return( 1 );
+	}
+	if( rescue_map_write(
+	     acquire_handle->rescue_map,
+	     acquire_handle->rescue_map_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	acquire_handle->rescue_map_save_time = current_time;
+
+	return( 1 );
+}
+
+/* Reads the areas of the rescue map with a specific status in blocks
+ * The data that was read is written to the same offset in the output.
+ * A block that cannot be read is marked as failed, or as bad when
+ * it consists of a single sector, in which case zero bytes are written
+ * When skip on error is set the area after a failed block is skipped,
+ * where the size of the skipped area doubles with every consecutive failure
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_recover_pass(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     uint8_t status,
+     size_t block_size,
+     uint8_t skip_on_error,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	static char *function         = "acquire_handle_recover_pass";
+	size64_t size                 = 0;
+	size64_t skip_size            = 0;
+	off64_t offset                = 0;
+	off64_t start_offset          = 0;
+	uint8_t read_status           = 0;
+	int result                    = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > storage_media_buffer->raw_buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( acquire_handle_is_aborted( acquire_handle ) == 0 )
+	{
+		result = rescue_map_get_next_extent(
+		          acquire_handle->rescue_map,
+		          status,
+		          start_offset,
+		          &offset,
+		          &size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next area from rescue map.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		storage_media_buffer->storage_media_offset = offset;
+		storage_media_buffer->raw_buffer_data_size = block_size;
+
+		if( (size64_t) storage_media_buffer->raw_buffer_data_size > size )
+		{
+			storage_media_buffer->raw_buffer_data_size = (size_t) size;
+		}
+		if( acquire_handle_read_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     &read_error ) == 1 )
+		{
+			read_status = RESCUE_MAP_STATUS_GOOD;
+			skip_size   = 0;
+		}
+		else
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 read_error );
+			}
+			libcerror_error_free(
+			 &read_error );
+
+			if( storage_media_buffer->raw_buffer_data_size > (size_t) acquire_handle->bytes_per_sector )
+			{
+				read_status = RESCUE_MAP_STATUS_FAILED;
+			}
+			else
+			{
+				read_status = RESCUE_MAP_STATUS_BAD;
+
+				if( memory_set(
+				     storage_media_buffer->raw_buffer,
+				     0,
+				     storage_media_buffer->raw_buffer_data_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear storage media buffer.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( skip_on_error != 0 )
+			{
+				if( skip_size == 0 )
+				{
+					skip_size = (size64_t) block_size;
+				}
+				else if( skip_size < ( (size64_t) block_size * ACQUIRE_HANDLE_RECOVERY_MAXIMUM_SKIP_BLOCKS ) )
+				{
+					skip_size *= 2;
+				}
+			}
+		}
+		if( read_status != RESCUE_MAP_STATUS_FAILED )
+		{
+			if( acquire_handle_write_buffer(
+			     acquire_handle,
+			     storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write storage media buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( rescue_map_set_status(
+		     acquire_handle->rescue_map,
+		     offset,
+		     (size64_t) storage_media_buffer->raw_buffer_data_size,
+		     read_status,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set status in rescue map.",
+			 function );
+
+			return( -1 );
+		}
+		/* Keep track of the areas that were read after a read error so that
+		 * the verification can be limited to these areas
+		 */
+		if( ( acquire_handle->recovered_map != NULL )
+		 && ( status == RESCUE_MAP_STATUS_FAILED )
+		 && ( read_status == RESCUE_MAP_STATUS_GOOD ) )
+		{
+			if( rescue_map_set_status(
+			     acquire_handle->recovered_map,
+			     offset,
+			     (size64_t) storage_media_buffer->raw_buffer_data_size,
+			     RESCUE_MAP_STATUS_GOOD,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set status in recovered map.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		start_offset = offset + (off64_t) storage_media_buffer->raw_buffer_data_size;
+
+		if( read_status != RESCUE_MAP_STATUS_GOOD )
+		{
+			start_offset += (off64_t) skip_size;
+		}
+		if( acquire_handle_save_rescue_map(
+		     acquire_handle,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to save rescue map.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( acquire_handle_save_rescue_map(
+	     acquire_handle,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to save rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the digest hashes of a recovered input by reading the output back
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_recover_digests(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	acquire_extent_t *extent       = NULL;
+	static char *function          = "acquire_handle_recover_digests";
+	size64_t extent_remaining_size = 0;
+	size64_t remaining_size        = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline_initialize(
+	     &( acquire_handle->digest_pipeline ),
+	     acquire_handle->digest_types,
+	     0,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle_initialize_extent_digests(
+	     acquire_handle,
+	     0,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent digests.",
+		 function );
+
+		return( -1 );
+	}
+	storage_media_buffer->storage_media_offset = 0;
+
+	remaining_size = acquire_handle->media_size;
+
+	while( remaining_size > 0 )
+	{
+		if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+		{
+			return( 1 );
+		}
+		storage_media_buffer->raw_buffer_data_size = acquire_handle->process_buffer_size;
+
+		if( (size64_t) storage_media_buffer->raw_buffer_data_size > remaining_size )
+		{
+			storage_media_buffer->raw_buffer_data_size = (size_t) remaining_size;
+		}
+		if( acquire_handle_get_extent_by_offset(
+		     acquire_handle,
+		     storage_media_buffer->storage_media_offset,
+		     &extent,
+		     NULL ) == 1 )
+		{
+			extent_remaining_size = extent->size - (size64_t) ( storage_media_buffer->storage_media_offset - extent->offset );
+
+			if( (size64_t) storage_media_buffer->raw_buffer_data_size > extent_remaining_size )
+			{
+				storage_media_buffer->raw_buffer_data_size = (size_t) extent_remaining_size;
+			}
+		}
+		if( acquire_handle_read_output_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read storage media buffer from output.",
+			 function );
+
+			return( -1 );
+		}
+		if( acquire_handle_hash_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to hash storage media buffer.",
+			 function );
+
+			return( -1 );
+		}
+		storage_media_buffer->storage_media_offset += (off64_t) storage_media_buffer->raw_buffer_data_size;
+		remaining_size                             -= (size64_t) storage_media_buffer->raw_buffer_data_size;
+	}
+	if( acquire_handle_finalize_digests(
+	     acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize digest hashes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Recovers the input to the output using the rescue map
+ * The first pass reads the untried areas and skips ahead after read errors,
+ * the second pass reads the skipped areas and the subsequent passes retry
+ * the failed areas with decreasing block sizes down to a single sector
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int acquire_handle_recover(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "acquire_handle_recover";
+	size64_t failed_size                         = 0;
+	size_t block_size                            = 0;
+	int pass_number                              = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( acquire_handle->bytes_per_sector == 0 )
+	 || ( ( acquire_handle->process_buffer_size % acquire_handle->bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported process buffer size value not a multiple of bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->digest_pipeline != NULL )
+	{
+		if( digest_pipeline_free(
+		     &( acquire_handle->digest_pipeline ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free digest pipeline.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( acquire_handle_free_extent_digests(
+	     acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extent digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer_initialize(
+	     &storage_media_buffer,
+	     acquire_handle->process_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	acquire_handle->acquired_size         = 0;
+	acquire_handle->number_of_zero_blocks = 0;
+	acquire_handle->zero_blocks_size      = 0;
+	acquire_handle->start_time            = time( NULL );
+	acquire_handle->rescue_map_save_time  = acquire_handle->start_time;
+
+	if( acquire_handle->resume_recovery != 0 )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "Resuming recovery from rescue map: %" PRIs_SYSTEM "\n",
+		 acquire_handle->rescue_map_filename );
+	}
+	block_size = acquire_handle->process_buffer_size;
+
+	for( pass_number = 1;
+	     pass_number <= 2;
+	     pass_number++ )
+	{
+		if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+		{
+			break;
+		}
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "Recovery pass %d: reading %s areas in blocks of %" PRIzd " bytes\n",
+		 pass_number,
+		 ( pass_number == 1 ) ? "untried" : "skipped",
+		 block_size );
+
+		if( acquire_handle_recover_pass(
+		     acquire_handle,
+		     storage_media_buffer,
+		     RESCUE_MAP_STATUS_UNTRIED,
+		     block_size,
+		     (uint8_t) ( pass_number == 1 ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run recovery pass: %d.",
+			 function,
+			 pass_number );
+
+			goto on_error;
+		}
+	}
+	while( ( acquire_handle_is_aborted( acquire_handle ) == 0 )
+	    && ( block_size > (size_t) acquire_handle->bytes_per_sector ) )
+	{
+		if( rescue_map_get_size_by_status(
+		     acquire_handle->rescue_map,
+		     RESCUE_MAP_STATUS_FAILED,
+		     &failed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of failed areas.",
+			 function );
+
+			goto on_error;
+		}
+		if( failed_size == 0 )
+		{
+			break;
+		}
+		block_size /= ACQUIRE_HANDLE_RECOVERY_BLOCK_SIZE_DIVISOR;
+		block_size -= block_size % acquire_handle->bytes_per_sector;
+
+		if( block_size < (size_t) acquire_handle->bytes_per_sector )
+		{
+			block_size = (size_t) acquire_handle->bytes_per_sector;
+		}
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "Recovery pass %d: retrying failed areas in blocks of %" PRIzd " bytes\n",
+		 pass_number,
+		 block_size );
+
+		if( acquire_handle_recover_pass(
+		     acquire_handle,
+		     storage_media_buffer,
+		     RESCUE_MAP_STATUS_FAILED,
+		     block_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run recovery pass: %d.",
+			 function,
+			 pass_number );
+
+			goto on_error;
+		}
+		pass_number++;
+	}
+	if( acquire_handle_is_aborted( acquire_handle ) == 0 )
+	{
+		if( acquire_handle_set_output_size(
+		     acquire_handle,
+		     acquire_handle->media_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to set size of output.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "Calculating digest hashes of the output\n" );
+
+		if( acquire_handle_recover_digests(
+		     acquire_handle,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate digest hashes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	acquire_handle->end_time = time( NULL );
+
+	if( rescue_map_get_size_by_status(
+	     acquire_handle->rescue_map,
+	     RESCUE_MAP_STATUS_GOOD,
+	     &( acquire_handle->acquired_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of recovered areas.",
+		 function );
+
+		goto on_error;
+	}
+	if( storage_media_buffer_free(
+	     &storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares the input data of a storage media buffer with the output data of its compare buffer
+ * Every sector of which the data differs is counted and the offset of the first one is kept
+ * The buffers must be compared in order of their storage media offset
+ * Returns 1 if the data is the same, 0 if not or -1 on error
+ */
+int acquire_handle_compare_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	storage_media_buffer_t *compare_buffer = NULL;
+	static char *function                  = "acquire_handle_compare_buffer";
+	size_t buffer_offset                   = 0;
+	size_t compare_size                    = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	compare_buffer = storage_media_buffer->compare_buffer;
+
+	if( compare_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid storage media buffer - missing compare buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_buffer->raw_buffer_data_size != storage_media_buffer->raw_buffer_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compare buffer - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	acquire_handle->verified_size += (size64_t) storage_media_buffer->raw_buffer_data_size;
+
+	if( memory_compare(
+	     storage_media_buffer->raw_buffer,
+	     compare_buffer->raw_buffer,
+	     storage_media_buffer->raw_buffer_data_size ) == 0 )
+	{
+		return( 1 );
+	}
+	while( buffer_offset < storage_media_buffer->raw_buffer_data_size )
+	{
+		compare_size = (size_t) acquire_handle->bytes_per_sector;
+
+		if( compare_size > ( storage_media_buffer->raw_buffer_data_size - buffer_offset ) )
+		{
+			compare_size = storage_media_buffer->raw_buffer_data_size - buffer_offset;
+		}
+		if( memory_compare(
+		     &( storage_media_buffer->raw_buffer[ buffer_offset ] ),
+		     &( compare_buffer->raw_buffer[ buffer_offset ] ),
+		     compare_size ) != 0 )
+		{
+			if( acquire_handle->number_of_mismatched_sectors == 0 )
+			{
+				acquire_handle->first_mismatch_offset = storage_media_buffer->storage_media_offset + (off64_t) buffer_offset;
+			}
+			acquire_handle->number_of_mismatched_sectors += 1;
+		}
+		buffer_offset += compare_size;
+	}
+	return( 0 );
+}
+
+/* Compares the input and output data of a storage media buffer and passes
+ * the input data and the output data to their own digest pipeline
+ * The buffers must be verified in order of their storage media offset
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_verify_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_verify_buffer";
+	int result            = 1;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer->compare_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid storage media buffer - missing compare buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle_compare_buffer(
+	     acquire_handle,
+	     storage_media_buffer,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare storage media buffer.",
+		 function );
+
+		result = -1;
+	}
+	/* A digest pipeline releases its references also on failure, hence the
+	 * buffers are passed to both digest pipelines regardless
+	 */
+	if( digest_pipeline_push_buffer(
+	     acquire_handle->verify_input_digest_pipeline,
+	     storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update input digest hashes.",
+		 function );
+
+		result = -1;
+	}
+	if( digest_pipeline_push_buffer(
+	     acquire_handle->verify_output_digest_pipeline,
+	     storage_media_buffer->compare_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update output digest hashes.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+/* Callback function of the output digest pipeline of the verification, called
+ * when a digest no longer uses a compare buffer
+ * The references are kept by the storage media buffer the compare buffer belongs to
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_verify_release_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle )
+{
+	libcerror_error_t *error = NULL;
+
+	if( acquire_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( acquire_handle_release_buffer(
+	     acquire_handle,
+	     storage_media_buffer->compare_buffer,
+	     &error ) != 1 )
+	{
+		acquire_handle_stage_failed(
+		 acquire_handle,
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function of the read thread pool of the verification
+ * The buffer is always passed on to the compare thread pool so that it
+ * eventually returns to the free queue
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_verify_read_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "acquire_handle_verify_read_callback";
+
+	if( acquire_handle == NULL )
+	{
+		return( -1 );
+	}
+	storage_media_buffer->read_result = 0;
+
+	if( acquire_handle_is_aborted( acquire_handle ) == 0 )
+	{
+		storage_media_buffer->read_result = acquire_handle_read_buffer(
+		                                     acquire_handle,
+		                                     storage_media_buffer,
+		                                     &error );
+
+		if( storage_media_buffer->read_result != 1 )
+		{
+			/* An abort is not reported as a failure
+			 */
+			if( acquire_handle_is_aborted( acquire_handle ) == 0 )
+			{
+				acquire_handle_stage_failed(
+				 acquire_handle,
+				 &error );
+			}
+			else
+			{
+				libcerror_error_free(
+				 &error );
+			}
+		}
+	}
+	if( libcthreads_thread_pool_push(
+	     acquire_handle->compare_thread_pool,
+	     (intptr_t *) storage_media_buffer,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push storage media buffer onto compare thread pool queue.",
+		 function );
+
+		acquire_handle_stage_failed(
+		 acquire_handle,
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function of the output read thread pool of the verification
+ * Reads the output data into the compare buffer of the storage media buffer,
+ * which is always passed on to the compare thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_verify_output_read_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle )
+{
+	libcerror_error_t *error               = NULL;
+	storage_media_buffer_t *compare_buffer = NULL;
+	static char *function                  = "acquire_handle_verify_output_read_callback";
+
+	if( acquire_handle == NULL )
+	{
+		return( -1 );
+	}
+	compare_buffer = storage_media_buffer->compare_buffer;
+
+	compare_buffer->read_result = 0;
+
+	if( acquire_handle_is_aborted( acquire_handle ) == 0 )
+	{
+		compare_buffer->read_result = acquire_handle_read_output_buffer(
+		                               acquire_handle,
+		                               compare_buffer,
+		                               &error );
+
+		if( compare_buffer->read_result != 1 )
+		{
+			acquire_handle_stage_failed(
+			 acquire_handle,
+			 &error );
+		}
+	}
+	if( libcthreads_thread_pool_push(
+	     acquire_handle->compare_thread_pool,
+	     (intptr_t *) storage_media_buffer,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push storage media buffer onto compare thread pool queue.",
+		 function );
+
+		acquire_handle_stage_failed(
+		 acquire_handle,
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function of the compare thread pool of the verification
+ * Every buffer arrives twice, once its input data and once its output data
+ * was read. Complete buffers are kept pending until all preceding buffers
+ * were compared. The digest workers of the input and the output then share
+ * the buffer, each holding a reference
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_verify_compare_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle )
+{
+	libcerror_error_t *error = NULL;
+	int buffer_index         = 0;
+
+	if( acquire_handle == NULL )
+	{
+		return( -1 );
+	}
+	/* Until both reads have arrived only this stage uses the references,
+	 * which count the reads that are still outstanding
+	 */
+	storage_media_buffer->number_of_references -= 1;
+
+	if( storage_media_buffer->number_of_references > 0 )
+	{
+		return( 1 );
+	}
+	storage_media_buffer->number_of_references = 1;
+
+	if( ( storage_media_buffer->read_result != 1 )
+	 || ( storage_media_buffer->compare_buffer->read_result != 1 )
+	 || ( acquire_handle_is_aborted( acquire_handle ) != 0 ) )
+	{
+		if( acquire_handle_release_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     &error ) != 1 )
+		{
+			acquire_handle_stage_failed(
+			 acquire_handle,
+			 &error );
+
+			return( -1 );
+		}
+		/* The buffers kept pending are never compared after an abort, they are
+		 * released so that every buffer returns to the free queue
+		 */
+		if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+		{
+			for( buffer_index = 0;
+			     buffer_index < acquire_handle->number_of_buffers;
+			     buffer_index++ )
+			{
+				storage_media_buffer = acquire_handle->pending_buffers[ buffer_index ];
+
+				if( storage_media_buffer == NULL )
+				{
+					continue;
+				}
+				acquire_handle->pending_buffers[ buffer_index ] = NULL;
+
+				if( acquire_handle_release_buffer(
+				     acquire_handle,
+				     storage_media_buffer,
+				     &error ) != 1 )
+				{
+					acquire_handle_stage_failed(
+					 acquire_handle,
+					 &error );
+
+					return( -1 );
+				}
+			}
+		}
+		return( 1 );
+	}
+	/* There are never more buffers in the pipeline than pending buffer slots
+	 */
+	buffer_index = (int) ( storage_media_buffer->sequence_number % acquire_handle->number_of_buffers );
+
+	acquire_handle->pending_buffers[ buffer_index ] = storage_media_buffer;
+
+	buffer_index = (int) ( acquire_handle->next_sequence_number % acquire_handle->number_of_buffers );
+
+	while( acquire_handle->pending_buffers[ buffer_index ] != NULL )
+	{
+		storage_media_buffer = acquire_handle->pending_buffers[ buffer_index ];
+
+		if( storage_media_buffer->sequence_number != acquire_handle->next_sequence_number )
+		{
+			break;
+		}
+		acquire_handle->pending_buffers[ buffer_index ] = NULL;
+
+		/* No other stage uses the buffer yet so the references can be set
+		 * without holding the mutex
+		 */
+		storage_media_buffer->number_of_references = acquire_handle->verify_input_digest_pipeline->number_of_digests
+		                                           + acquire_handle->verify_output_digest_pipeline->number_of_digests;
+
+		/* The digest pipelines release their references also on failure
+		 */
+		if( acquire_handle_verify_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     &error ) != 1 )
+		{
+			acquire_handle_stage_failed(
+			 acquire_handle,
+			 &error );
+
+			return( -1 );
+		}
+		acquire_handle->next_sequence_number += 1;
+
+		buffer_index = (int) ( acquire_handle->next_sequence_number % acquire_handle->number_of_buffers );
+	}
+	return( 1 );
+}
+
+/* Verifies the output against the input using multiple threads
+ * The input is read by the read thread pool while the output is read by
+ * a thread of its own, the input and output data are compared in order and
+ * hashed by separate digest pipelines
+ * Only the areas of the verify map with the good status are verified
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_verify_threaded(
+     acquire_handle_t *acquire_handle,
+     rescue_map_t *verify_map,
+     libcerror_error_t **error )
+{
+	storage_media_buffer_t *compare_buffers[ ( ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_THREADS * 2 ) + 2 ];
+	storage_media_buffer_t *input_buffers[ ( ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_THREADS * 2 ) + 2 ];
+
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "acquire_handle_verify_threaded";
+	size64_t range_size                          = 0;
+	off64_t range_offset                         = 0;
+	off64_t storage_media_offset                 = 0;
+	uint64_t sequence_number                     = 0;
+	int buffer_index                             = 0;
+	int result                                   = 1;
+
+	/* Allow every read thread to have a read in flight while the output read
+	 * and compare stages each work on a buffer and one buffer is queued between them
+	 */
+	acquire_handle->number_of_buffers    = ( acquire_handle->number_of_threads * 2 ) + 2;
+	acquire_handle->next_sequence_number = 0;
+
+	if( memory_set(
+	     compare_buffers,
+	     0,
+	     sizeof( storage_media_buffer_t * ) * ( ( ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_THREADS * 2 ) + 2 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compare buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     input_buffers,
+	     0,
+	     sizeof( storage_media_buffer_t * ) * ( ( ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_THREADS * 2 ) + 2 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input buffers.",
+		 function );
+
+		return( -1 );
+	}
+	acquire_handle->pending_buffers = (storage_media_buffer_t **) memory_allocate(
+	                                                               sizeof( storage_media_buffer_t * ) * acquire_handle->number_of_buffers );
+
+	if( acquire_handle->pending_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pending buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     acquire_handle->pending_buffers,
+	     0,
+	     sizeof( storage_media_buffer_t * ) * acquire_handle->number_of_buffers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pending buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( acquire_handle->references_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create references mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( acquire_handle->free_buffer_queue ),
+	     acquire_handle->number_of_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create free buffer queue.",
+		 function );
+
+		goto on_error;
+	}
+	/* The buffers are owned by the arrays, not by the free queue, so that
+	 * they are freed regardless where in the pipeline they are
+	 */
+	for( buffer_index = 0;
+	     buffer_index < acquire_handle->number_of_buffers;
+	     buffer_index++ )
+	{
+		if( storage_media_buffer_initialize(
+		     &( input_buffers[ buffer_index ] ),
+		     acquire_handle->process_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create input buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		if( storage_media_buffer_initialize(
+		     &( compare_buffers[ buffer_index ] ),
+		     acquire_handle->process_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compare buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		input_buffers[ buffer_index ]->compare_buffer   = compare_buffers[ buffer_index ];
+		compare_buffers[ buffer_index ]->compare_buffer = input_buffers[ buffer_index ];
+
+		if( libcthreads_queue_push(
+		     acquire_handle->free_buffer_queue,
+		     (intptr_t *) input_buffers[ buffer_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push input buffer: %d onto free queue.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+	if( digest_pipeline_initialize(
+	     &( acquire_handle->verify_input_digest_pipeline ),
+	     acquire_handle->digest_types,
+	     acquire_handle->number_of_buffers,
+	     (int (*)(storage_media_buffer_t *, void *)) &acquire_handle_digest_release_callback,
+	     (void *) acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create input digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( digest_pipeline_initialize(
+	     &( acquire_handle->verify_output_digest_pipeline ),
+	     acquire_handle->digest_types,
+	     acquire_handle->number_of_buffers,
+	     (int (*)(storage_media_buffer_t *, void *)) &acquire_handle_verify_release_callback,
+	     (void *) acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every buffer is pushed twice onto the compare thread pool queue
+	 */
+	if( libcthreads_thread_pool_create(
+	     &( acquire_handle->compare_thread_pool ),
+	     NULL,
+	     1,
+	     acquire_handle->number_of_buffers * 2,
+	     (int (*)(intptr_t *, void *)) &acquire_handle_verify_compare_callback,
+	     (void *) acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compare thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( acquire_handle->output_read_thread_pool ),
+	     NULL,
+	     1,
+	     acquire_handle->number_of_buffers,
+	     (int (*)(intptr_t *, void *)) &acquire_handle_verify_output_read_callback,
+	     (void *) acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output read thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( acquire_handle->read_thread_pool ),
+	     NULL,
+	     acquire_handle->number_of_threads,
+	     acquire_handle->number_of_buffers,
+	     (int (*)(intptr_t *, void *)) &acquire_handle_verify_read_callback,
+	     (void *) acquire_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	while( acquire_handle_is_aborted( acquire_handle ) == 0 )
+	{
+		if( range_size == 0 )
+		{
+			result = rescue_map_get_next_extent(
+			          verify_map,
+			          RESCUE_MAP_STATUS_GOOD,
+			          storage_media_offset,
+			          &range_offset,
+			          &range_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next area from verify map.",
+				 function );
+
+				break;
+			}
+			else if( result == 0 )
+			{
+				result = 1;
+
+				break;
+			}
+			storage_media_offset = range_offset;
+		}
+		/* Blocks until a buffer has passed through the digest pipelines
+		 */
+		if( libcthreads_queue_pop(
+		     acquire_handle->free_buffer_queue,
+		     (intptr_t **) &storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop storage media buffer from free queue.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+		{
+			break;
+		}
+		storage_media_buffer->storage_media_offset = storage_media_offset;
+		storage_media_buffer->sequence_number      = sequence_number;
+		storage_media_buffer->raw_buffer_data_size = acquire_handle->process_buffer_size;
+
+		if( (size64_t) storage_media_buffer->raw_buffer_data_size > range_size )
+		{
+			storage_media_buffer->raw_buffer_data_size = (size_t) range_size;
+		}
+		storage_media_buffer->compare_buffer->storage_media_offset = storage_media_buffer->storage_media_offset;
+		storage_media_buffer->compare_buffer->sequence_number      = storage_media_buffer->sequence_number;
+		storage_media_buffer->compare_buffer->raw_buffer_data_size = storage_media_buffer->raw_buffer_data_size;
+
+		/* The references count the reads until the buffer reaches the compare stage
+		 */
+		storage_media_buffer->number_of_references = 2;
+
+		if( libcthreads_thread_pool_push(
+		     acquire_handle->output_read_thread_pool,
+		     (intptr_t *) storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto output read thread pool queue.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( libcthreads_thread_pool_push(
+		     acquire_handle->read_thread_pool,
+		     (intptr_t *) storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto read thread pool queue.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		storage_media_offset += (off64_t) storage_media_buffer->raw_buffer_data_size;
+		range_size           -= (size64_t) storage_media_buffer->raw_buffer_data_size;
+		sequence_number      += 1;
+	}
+	if( result != 1 )
+	{
+		acquire_handle_signal_abort(
+		 acquire_handle,
+		 NULL );
+	}
+	/* The pools are joined in pipeline order so that every buffer is passed on
+	 * before the next stage stops
+	 */
+	if( libcthreads_thread_pool_join(
+	     &( acquire_handle->read_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join read thread pool.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_thread_pool_join(
+	     &( acquire_handle->output_read_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join output read thread pool.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_thread_pool_join(
+	     &( acquire_handle->compare_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join compare thread pool.",
+		 function );
+
+		result = -1;
+	}
+	if( digest_pipeline_join(
+	     acquire_handle->verify_input_digest_pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join input digest pipeline.",
+		 function );
+
+		result = -1;
+	}
+	if( digest_pipeline_join(
+	     acquire_handle->verify_output_digest_pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join output digest pipeline.",
+		 function );
+
+		result = -1;
+	}
+	memory_free(
+	 acquire_handle->pending_buffers );
+
+	acquire_handle->pending_buffers = NULL;
+
+	if( libcthreads_queue_free(
+	     &( acquire_handle->free_buffer_queue ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free free buffer queue.",
+		 function );
+
+		result = -1;
+	}
+	for( buffer_index = 0;
+	     buffer_index < acquire_handle->number_of_buffers;
+	     buffer_index++ )
+	{
+		if( storage_media_buffer_free(
+		     &( input_buffers[ buffer_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input buffer: %d.",
+			 function,
+			 buffer_index );
+
+			result = -1;
+		}
+		if( storage_media_buffer_free(
+		     &( compare_buffers[ buffer_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compare buffer: %d.",
+			 function,
+			 buffer_index );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_free(
+	     &( acquire_handle->references_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free references mutex.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+
+on_error:
+	if( acquire_handle->read_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( acquire_handle->read_thread_pool ),
+		 NULL );
+	}
+	if( acquire_handle->output_read_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( acquire_handle->output_read_thread_pool ),
+		 NULL );
+	}
+	if( acquire_handle->compare_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( acquire_handle->compare_thread_pool ),
+		 NULL );
+	}
+	if( acquire_handle->verify_input_digest_pipeline != NULL )
+	{
+		digest_pipeline_join(
+		 acquire_handle->verify_input_digest_pipeline,
+		 NULL );
+	}
+	if( acquire_handle->verify_output_digest_pipeline != NULL )
+	{
+		digest_pipeline_join(
+		 acquire_handle->verify_output_digest_pipeline,
+		 NULL );
+	}
+	if( acquire_handle->free_buffer_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( acquire_handle->free_buffer_queue ),
+		 NULL,
+		 NULL );
+	}
+	for( buffer_index = 0;
+	     buffer_index < acquire_handle->number_of_buffers;
+	     buffer_index++ )
+	{
+		if( input_buffers[ buffer_index ] != NULL )
+		{
+			storage_media_buffer_free(
+			 &( input_buffers[ buffer_index ] ),
+			 NULL );
+		}
+		if( compare_buffers[ buffer_index ] != NULL )
+		{
+			storage_media_buffer_free(
+			 &( compare_buffers[ buffer_index ] ),
+			 NULL );
+		}
+	}
+	if( acquire_handle->pending_buffers != NULL )
+	{
+		memory_free(
+		 acquire_handle->pending_buffers );
+
+		acquire_handle->pending_buffers = NULL;
+	}
+	if( acquire_handle->references_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( acquire_handle->references_mutex ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+/* Verifies the output against the input a buffer at a time
+ * Only the areas of the verify map with the good status are verified
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_verify_single_threaded(
+     acquire_handle_t *acquire_handle,
+     rescue_map_t *verify_map,
+     libcerror_error_t **error )
+{
+	storage_media_buffer_t *compare_buffer       = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "acquire_handle_verify_single_threaded";
+	size64_t range_size                          = 0;
+	off64_t range_offset                         = 0;
+	int result                                   = 0;
+
+	if( digest_pipeline_initialize(
+	     &( acquire_handle->verify_input_digest_pipeline ),
+	     acquire_handle->digest_types,
+	     0,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create input digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( digest_pipeline_initialize(
+	     &( acquire_handle->verify_output_digest_pipeline ),
+	     acquire_handle->digest_types,
+	     0,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( storage_media_buffer_initialize(
+	     &storage_media_buffer,
+	     acquire_handle->process_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( storage_media_buffer_initialize(
+	     &compare_buffer,
+	     acquire_handle->process_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compare buffer.",
+		 function );
+
+		goto on_error;
+	}
+	storage_media_buffer->compare_buffer = compare_buffer;
+
+	while( acquire_handle_is_aborted( acquire_handle ) == 0 )
+	{
+		if( range_size == 0 )
+		{
+			result = rescue_map_get_next_extent(
+			          verify_map,
+			          RESCUE_MAP_STATUS_GOOD,
+			          storage_media_buffer->storage_media_offset,
+			          &range_offset,
+			          &range_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next area from verify map.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			storage_media_buffer->storage_media_offset = range_offset;
+		}
+		storage_media_buffer->raw_buffer_data_size = acquire_handle->process_buffer_size;
+
+		if( (size64_t) storage_media_buffer->raw_buffer_data_size > range_size )
+		{
+			storage_media_buffer->raw_buffer_data_size = (size_t) range_size;
+		}
+		compare_buffer->storage_media_offset = storage_media_buffer->storage_media_offset;
+		compare_buffer->raw_buffer_data_size = storage_media_buffer->raw_buffer_data_size;
+
+		if( acquire_handle_read_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read storage media buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( acquire_handle_read_output_buffer(
+		     acquire_handle,
+		     compare_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compare buffer from output.",
+			 function );
+
+			goto on_error;
+		}
+		if( acquire_handle_verify_buffer(
+		     acquire_handle,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify storage media buffer.",
+			 function );
+
+			goto on_error;
+		}
+		storage_media_buffer->storage_media_offset += (off64_t) storage_media_buffer->raw_buffer_data_size;
+		range_size                                 -= (size64_t) storage_media_buffer->raw_buffer_data_size;
+	}
+	if( storage_media_buffer_free(
+	     &compare_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compare buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( storage_media_buffer_free(
+	     &storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compare_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &compare_buffer,
+		 NULL );
+	}
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Verifies the output against the input by reading both again
+ * In recovery mode only the areas that were read successfully after a read
+ * error are verified, otherwise the entire input
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int acquire_handle_verify(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	rescue_map_t *media_map  = NULL;
+	rescue_map_t *verify_map = NULL;
+	static char *function    = "acquire_handle_verify";
+	int result               = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( acquire_handle->bytes_per_sector == 0 )
+	 || ( ( acquire_handle->process_buffer_size % acquire_handle->bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported process buffer size value not a multiple of bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->verify_input_digest_pipeline != NULL )
+	{
+		if( digest_pipeline_free(
+		     &( acquire_handle->verify_input_digest_pipeline ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input digest pipeline.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( acquire_handle->verify_output_digest_pipeline != NULL )
+	{
+		if( digest_pipeline_free(
+		     &( acquire_handle->verify_output_digest_pipeline ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output digest pipeline.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( acquire_handle->recovered_map != NULL )
+	{
+		verify_map = acquire_handle->recovered_map;
+	}
+	else
+	{
+		if( rescue_map_initialize(
+		     &media_map,
+		     acquire_handle->media_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create media map.",
+			 function );
+
+			goto on_error;
+		}
+		if( rescue_map_set_status(
+		     media_map,
+		     0,
+		     acquire_handle->media_size,
+		     RESCUE_MAP_STATUS_GOOD,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set status in media map.",
+			 function );
+
+			goto on_error;
+		}
+		verify_map = media_map;
+	}
+	acquire_handle->verify_recovered_areas       = (uint8_t) ( verify_map == acquire_handle->recovered_map );
+	acquire_handle->verified_size                = 0;
+	acquire_handle->number_of_mismatched_sectors = 0;
+	acquire_handle->first_mismatch_offset        = 0;
+	acquire_handle->stage_failed                 = 0;
+	acquire_handle->verify_start_time            = time( NULL );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	result = acquire_handle_verify_threaded(
+	          acquire_handle,
+	          verify_map,
+	          error );
+#else
+	result = acquire_handle_verify_single_threaded(
+	          acquire_handle,
+	          verify_map,
+	          error );
+#endif
+	acquire_handle->verify_end_time = time( NULL );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify output.",
+		 function );
+
+		goto on_error;
+	}
+	if( media_map != NULL )
+	{
+		if( rescue_map_free(
+		     &media_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free media map.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( acquire_handle->stage_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify output - a pipeline stage failed.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle_is_aborted( acquire_handle ) != 0 )
+	{
+		return( 0 );
+	}
+	if( digest_pipeline_finalize(
+	     acquire_handle->verify_input_digest_pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize input digest hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline_finalize(
+	     acquire_handle->verify_output_digest_pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize output digest hashes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( media_map != NULL )
+	{
+		rescue_map_free(
+		 &media_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the digest hashes of a digest pipeline
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_digests_fprint(
+     acquire_handle_t *acquire_handle,
+     digest_pipeline_t *digest_pipeline,
+     const char *indentation,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_handle_digests_fprint";
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( indentation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid indentation.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline->md5_context != NULL )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "%sMD5 hash calculated\t: %" PRIs_SYSTEM "\n",
+		 indentation,
+		 digest_pipeline->md5_hash_string );
+	}
+	if( digest_pipeline->sha1_context != NULL )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "%sSHA1 hash calculated\t: %" PRIs_SYSTEM "\n",
+		 indentation,
+		 digest_pipeline->sha1_hash_string );
+	}
+	if( digest_pipeline->sha256_context != NULL )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "%sSHA256 hash calculated\t: %" PRIs_SYSTEM "\n",
+		 indentation,
+		 digest_pipeline->sha256_hash_string );
+	}
+	return( 1 );
+}
+
+/* Prints a summary of the acquisition
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_acquire_fprint(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	acquire_extent_t *extent       = NULL;
+	const char *extent_type_string = NULL;
+	static char *function          = "acquire_handle_acquire_fprint";
+	size64_t bad_size              = 0;
+	size64_t bytes_per_second      = 0;
+	time_t number_of_seconds       = 0;
+	int extent_index               = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds = acquire_handle->end_time - acquire_handle->start_time;
+
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "Acquisition completed\n" );
+
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\tMedia size\t\t: %" PRIu64 " bytes\n",
+	 acquire_handle->media_size );
+
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\tBytes per sector\t: %" PRIu32 "\n",
+	 acquire_handle->bytes_per_sector );
+
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\tAcquired\t\t: %" PRIu64 " bytes\n",
+	 acquire_handle->acquired_size );
+
+	if( acquire_handle->resume_acquisition != 0 )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tResumed at offset\t: %" PRIi64 "\n",
+		 acquire_handle->resume_offset );
+	}
+
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\tZero blocks\t\t: %" PRIu64 " (%" PRIu64 " bytes not written)\n",
+	 acquire_handle->number_of_zero_blocks,
+	 acquire_handle->zero_blocks_size );
+
+	if( acquire_handle->compression_level != CHUNK_COMPRESSOR_LEVEL_NONE )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tCompression\t\t: %s, %d thread(s)\n",
+		 ( acquire_handle->compression_level == CHUNK_COMPRESSOR_LEVEL_BEST ) ? "best" : "fast",
+		 acquire_handle->number_of_compression_threads );
+
+		if( acquire_handle->acquired_size > 0 )
+		{
+			fprintf(
+			 acquire_handle->notify_stream,
+			 "\tCompressed\t\t: %" PRIu64 " bytes (%" PRIu64 "%% of acquired)\n",
+			 acquire_handle->compressed_size,
+			 ( acquire_handle->compressed_size * 100 ) / acquire_handle->acquired_size );
+		}
+	}
+	if( ( acquire_handle->output_writer != NULL )
+	 && ( acquire_handle->segment_size > 0 ) )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tSegment files\t\t: %d of %" PRIu64 " bytes\n",
+		 acquire_handle->output_writer->number_of_segments,
+		 acquire_handle->segment_size );
+	}
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\tOutput writes\t\t: %s\n",
+	 ( acquire_handle->asynchronous_output != 0 ) ? "asynchronous (io_uring)" : "synchronous" );
+
+	if( acquire_handle->read_tuning != ACQUIRE_HANDLE_READ_TUNING_NONE )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tRead tuning\t\t: %" PRIzd " bytes per read, %d read thread(s) (%s at %" PRIu64 " MiB/s)\n",
+		 acquire_handle->process_buffer_size,
+		 acquire_handle->number_of_threads,
+		 ( acquire_handle->read_tuning == ACQUIRE_HANDLE_READ_TUNING_CACHED ) ? "cached" : "calibrated",
+		 acquire_handle->read_tuning_throughput / ( 1024 * 1024 ) );
+	}
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\tDuration\t\t: %" PRIi64 " seconds\n",
+	 (int64_t) number_of_seconds );
+
+	if( number_of_seconds > 0 )
+	{
+		bytes_per_second = ( acquire_handle->acquired_size - (size64_t) acquire_handle->resume_offset ) / (size64_t) number_of_seconds;
+
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tThroughput\t\t: %" PRIu64 " MiB/s\n",
+		 bytes_per_second / ( 1024 * 1024 ) );
+	}
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "Drive information\n" );
+
+	if( acquire_handle->drive_serial_number[ 0 ] != 0 )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tSerial number\t\t: %s\n",
+		 acquire_handle->drive_serial_number );
+	}
+	else
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tSerial number\t\t: N/A\n" );
+	}
+	if( acquire_handle->digest_pipeline != NULL )
+	{
+		if( acquire_handle_digests_fprint(
+		     acquire_handle,
+		     acquire_handle->digest_pipeline,
+		     "\t",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "Extents\n" );
+
+	for( extent_index = 0;
+	     extent_index < acquire_handle->number_of_extents;
+	     extent_index++ )
+	{
+		extent = &( acquire_handle->extents[ extent_index ] );
+
+		switch( extent->type )
+		{
+			case LIBTABLEAU_EXTENT_TYPE_USER:
+				extent_type_string = "User area\t\t";
+				break;
+
+			case LIBTABLEAU_EXTENT_TYPE_HPA:
+				extent_type_string = "HPA\t\t\t";
+				break;
+
+			case LIBTABLEAU_EXTENT_TYPE_DCO:
+				extent_type_string = "DCO\t\t\t";
+				break;
+
+			default:
+				extent_type_string = "Unknown\t\t\t";
+				break;
+		}
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\t%s: %" PRIi64 " - %" PRIi64 " (size: %" PRIu64 " bytes)%s\n",
+		 extent_type_string,
+		 extent->offset,
+		 extent->offset + (off64_t) extent->size,
+		 extent->size,
+		 ( ( extent->flags & LIBTABLEAU_EXTENT_FLAG_IS_INACCESSIBLE ) != 0 ) ? " not acquired, inaccessible" : "" );
+
+		if( extent->digest_pipeline != NULL )
+		{
+			if( acquire_handle_digests_fprint(
+			     acquire_handle,
+			     extent->digest_pipeline,
+			     "\t\t",
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print digest hashes of extent: %d.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+		}
+	}
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\n" );
+
+	if( acquire_handle->rescue_map != NULL )
+	{
+		if( rescue_map_get_size_by_status(
+		     acquire_handle->rescue_map,
+		     RESCUE_MAP_STATUS_BAD,
+		     &bad_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of bad areas.",
+			 function );
+
+			return( -1 );
+		}
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "Recovery\n" );
+
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tRescue map\t\t: %" PRIs_SYSTEM "\n",
+		 acquire_handle->rescue_map_filename );
+
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tRecovered\t\t: %" PRIu64 " bytes\n",
+		 acquire_handle->acquired_size );
+
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tBad sectors\t\t: %" PRIu64 " (%" PRIu64 " bytes, filled with zero bytes)\n",
+		 bad_size / acquire_handle->bytes_per_sector,
+		 bad_size );
+
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Prints a summary of the verification
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_handle_verify_fprint(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error )
+{
+	static char *function     = "acquire_handle_verify_fprint";
+	size64_t bytes_per_second = 0;
+	time_t number_of_seconds  = 0;
+
+	if( acquire_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds = acquire_handle->verify_end_time - acquire_handle->verify_start_time;
+
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "Verification completed\n" );
+
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\tVerified\t\t: %" PRIu64 " bytes (%s)\n",
+	 acquire_handle->verified_size,
+	 ( acquire_handle->verify_recovered_areas != 0 ) ? "areas recovered after read errors" : "entire media" );
+
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\tMismatched sectors\t: %" PRIu64 "\n",
+	 acquire_handle->number_of_mismatched_sectors );
+
+	if( acquire_handle->number_of_mismatched_sectors > 0 )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tFirst mismatch\t\t: sector %" PRIu64 " (offset: %" PRIi64 ")\n",
+		 (uint64_t) acquire_handle->first_mismatch_offset / acquire_handle->bytes_per_sector,
+		 acquire_handle->first_mismatch_offset );
+	}
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\tDuration\t\t: %" PRIi64 " seconds\n",
+	 (int64_t) number_of_seconds );
+
+	if( number_of_seconds > 0 )
+	{
+		bytes_per_second = acquire_handle->verified_size / (size64_t) number_of_seconds;
+
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tThroughput\t\t: %" PRIu64 " MiB/s\n",
+		 bytes_per_second / ( 1024 * 1024 ) );
+	}
+	if( acquire_handle->verify_input_digest_pipeline != NULL )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tSource\n" );
+
+		if( acquire_handle_digests_fprint(
+		     acquire_handle,
+		     acquire_handle->verify_input_digest_pipeline,
+		     "\t\t",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print input digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( acquire_handle->verify_output_digest_pipeline != NULL )
+	{
+		fprintf(
+		 acquire_handle->notify_stream,
+		 "\tTarget\n" );
+
+		if( acquire_handle_digests_fprint(
+		     acquire_handle,
+		     acquire_handle->verify_output_digest_pipeline,
+		     "\t\t",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print output digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	fprintf(
+	 acquire_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
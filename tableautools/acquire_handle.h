@@ -0,0 +1,788 @@
+/*
+ * Acquire handle
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ACQUIRE_HANDLE_H )
+#define _ACQUIRE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include <signal.h>
+#include <time.h>
+
+#include "checkpoint.h"
+#include "chunk_compressor.h"
+#include "chunk_index.h"
+#include "digest_pipeline.h"
+#include "rescue_map.h"
+#include "segment_writer.h"
+#include "storage_media_buffer.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcthreads.h"
+#include "tableautools_libtableau.h"
+#include "tuning_cache.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define ACQUIRE_HANDLE_DEFAULT_PROCESS_BUFFER_SIZE	( 1024 * 1024 )
+#define ACQUIRE_HANDLE_MAXIMUM_PROCESS_BUFFER_SIZE	( 64 * 1024 * 1024 )
+
+#define ACQUIRE_HANDLE_DEFAULT_NUMBER_OF_THREADS	4
+#define ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_THREADS	32
+
+/* The number of compression threads is the number of processors, when
+ * it cannot be determined the default is used
+ */
+#define ACQUIRE_HANDLE_DEFAULT_NUMBER_OF_COMPRESSION_THREADS	4
+#define ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_COMPRESSION_THREADS	32
+
+/* Every read thread can have a read in flight while the hash and write stages
+ * each work on a buffer and one buffer is queued between them, every
+ * compression thread needs a buffer of its own
+ */
+#define ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_BUFFERS	( ( ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_THREADS * 2 ) + 2 + ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_COMPRESSION_THREADS )
+
+#define ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_EXTENTS	6
+
+#define ACQUIRE_HANDLE_MINIMUM_SEGMENT_SIZE		( 1024 * 1024 )
+
+/* The size of the blocks that are tested for zero bytes, a block that
+ * consists of zero bytes is not written but left as a hole in the output
+ */
+#define ACQUIRE_HANDLE_ZERO_BLOCK_SIZE			4096
+
+/* The block size of every retry pass of the recovery mode is the block size
+ * of the previous pass divided by this value, down to the sector size
+ */
+#define ACQUIRE_HANDLE_RECOVERY_BLOCK_SIZE_DIVISOR	8
+
+/* The maximum number of blocks skipped after consecutive read errors
+ * in the first pass of the recovery mode
+ */
+#define ACQUIRE_HANDLE_RECOVERY_MAXIMUM_SKIP_BLOCKS	64
+
+/* The number of seconds between updates of the rescue map
+ */
+#define ACQUIRE_HANDLE_RECOVERY_SAVE_INTERVAL		30
+
+/* The number of seconds between checkpoints of a resumable acquisition
+ */
+#define ACQUIRE_HANDLE_CHECKPOINT_INTERVAL		60
+
+/* The calibration tries every combination of the read sizes from the minimum
+ * size, multiplied by 4 up to the maximum size, and the number of read threads
+ * from 1, doubled up to the maximum number of threads
+ */
+#define ACQUIRE_HANDLE_CALIBRATION_MINIMUM_SIZE		( 64 * 1024 )
+#define ACQUIRE_HANDLE_CALIBRATION_MAXIMUM_SIZE		( 4 * 1024 * 1024 )
+#define ACQUIRE_HANDLE_CALIBRATION_MAXIMUM_NUMBER_OF_THREADS	8
+
+/* The number of bytes read by every combination, each combination reads
+ * the data following the previous one so none of it is read from the
+ * cache of the drive
+ */
+#define ACQUIRE_HANDLE_CALIBRATION_TRIAL_SIZE		( 32 * 1024 * 1024 )
+
+enum ACQUIRE_HANDLE_READ_TUNINGS
+{
+	ACQUIRE_HANDLE_READ_TUNING_NONE			= 0,
+	ACQUIRE_HANDLE_READ_TUNING_CALIBRATED		= 1,
+	ACQUIRE_HANDLE_READ_TUNING_CACHED		= 2
+};
+
+typedef struct acquire_extent acquire_extent_t;
+
+struct acquire_extent
+{
+	/* The offset of the extent
+	 */
+	off64_t offset;
+
+	/* The size of the extent
+	 */
+	size64_t size;
+
+	/* The extent type
+	 */
+	uint8_t type;
+
+	/* The extent flags
+	 */
+	uint32_t flags;
+
+	/* The digest pipeline of the extent, only used when the acquisition
+	 * covers more than one extent
+	 */
+	digest_pipeline_t *digest_pipeline;
+};
+
+typedef struct acquire_handle acquire_handle_t;
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+typedef struct acquire_calibration_reader acquire_calibration_reader_t;
+
+struct acquire_calibration_reader
+{
+	/* The acquire handle
+	 */
+	acquire_handle_t *acquire_handle;
+
+	/* The storage media buffer
+	 */
+	storage_media_buffer_t *storage_media_buffer;
+
+	/* The offset of the first read
+	 */
+	off64_t offset;
+
+	/* The distance between the offsets of consecutive reads
+	 */
+	size64_t stride;
+
+	/* The number of reads
+	 */
+	int number_of_reads;
+
+	/* Value to indicate all reads were successful
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+struct acquire_handle
+{
+	/* The input handle
+	 */
+	libtableau_handle_t *input_handle;
+
+	/* The output writer
+	 */
+	segment_writer_t *output_writer;
+
+	/* The size of an output segment file, 0 if the output is a single file
+	 */
+	size64_t segment_size;
+
+	/* The maximum number of asynchronous output write requests in flight
+	 */
+	int queue_depth;
+
+	/* The output fsync policy
+	 */
+	uint8_t fsync_policy;
+
+	/* Value to indicate the output is written asynchronously
+	 */
+	uint8_t asynchronous_output;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The process buffer size, the number of bytes read by a single read
+	 */
+	size_t process_buffer_size;
+
+	/* The number of read threads
+	 */
+	int number_of_threads;
+
+	/* The digest types
+	 */
+	uint8_t digest_types;
+
+	/* The digest pipeline
+	 */
+	digest_pipeline_t *digest_pipeline;
+
+	/* The bridge serial number
+	 */
+	char bridge_serial_number[ 32 ];
+
+	/* The bridge model
+	 */
+	char bridge_model[ 64 ];
+
+	/* The bridge firmware date and time
+	 */
+	char bridge_firmware[ 64 ];
+
+	/* The bridge channel type
+	 */
+	char bridge_channel_type[ 16 ];
+
+	/* The drive serial number
+	 */
+	char drive_serial_number[ 32 ];
+
+	/* The drive model
+	 */
+	char drive_model[ 64 ];
+
+	/* The extents of the user area, HPA and DCO
+	 */
+	acquire_extent_t extents[ ACQUIRE_HANDLE_MAXIMUM_NUMBER_OF_EXTENTS ];
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The number of extents that can be read
+	 */
+	int number_of_accessible_extents;
+
+	/* The number of bytes written to the output, including the zero blocks
+	 */
+	size64_t acquired_size;
+
+	/* The number of zero blocks left as holes in the output
+	 */
+	uint64_t number_of_zero_blocks;
+
+	/* The number of bytes of the zero blocks
+	 */
+	size64_t zero_blocks_size;
+
+	/* The compression level, CHUNK_COMPRESSOR_LEVEL_NONE if the output is not compressed
+	 */
+	int compression_level;
+
+	/* The number of compression threads
+	 */
+	int number_of_compression_threads;
+
+	/* The chunk index of the compressed output
+	 */
+	chunk_index_t *chunk_index;
+
+	/* The number of bytes written to the compressed output
+	 */
+	size64_t compressed_size;
+
+	/* The rescue map, only used in recovery mode
+	 */
+	rescue_map_t *rescue_map;
+
+	/* The filename of the rescue map
+	 */
+	system_character_t *rescue_map_filename;
+
+	/* Value to indicate the recovery resumes from an existing rescue map
+	 */
+	uint8_t resume_recovery;
+
+	/* The time the rescue map was last written
+	 */
+	time_t rescue_map_save_time;
+
+	/* The checkpoint, only used by a resumable acquisition
+	 */
+	checkpoint_t *checkpoint;
+
+	/* The filename of the checkpoint
+	 */
+	system_character_t *checkpoint_filename;
+
+	/* Value to indicate the acquisition resumes from an existing checkpoint
+	 */
+	uint8_t resume_acquisition;
+
+	/* The offset from which the acquisition resumes
+	 */
+	off64_t resume_offset;
+
+	/* The time the checkpoint was last written
+	 */
+	time_t checkpoint_save_time;
+
+	/* The read tuning cache
+	 */
+	tuning_cache_t *tuning_cache;
+
+	/* The filename of the read tuning cache
+	 */
+	system_character_t *tuning_cache_filename;
+
+	/* Value to indicate how the process buffer size and number of read
+	 * threads were tuned
+	 */
+	uint8_t read_tuning;
+
+	/* The read throughput of the tuned values in bytes per second
+	 */
+	uint64_t read_tuning_throughput;
+
+	/* The time the acquisition started
+	 */
+	time_t start_time;
+
+	/* The time the acquisition ended
+	 */
+	time_t end_time;
+
+	/* The areas that were read successfully after a read error,
+	 * only used in recovery mode
+	 */
+	rescue_map_t *recovered_map;
+
+	/* Value to indicate only the recovered areas are verified
+	 */
+	uint8_t verify_recovered_areas;
+
+	/* The digest pipeline of the input data read by the verification
+	 */
+	digest_pipeline_t *verify_input_digest_pipeline;
+
+	/* The digest pipeline of the output data read by the verification
+	 */
+	digest_pipeline_t *verify_output_digest_pipeline;
+
+	/* The number of bytes verified
+	 */
+	size64_t verified_size;
+
+	/* The number of sectors of which the input and output data differ
+	 */
+	uint64_t number_of_mismatched_sectors;
+
+	/* The offset of the first sector of which the input and output data differ
+	 */
+	off64_t first_mismatch_offset;
+
+	/* The time the verification started
+	 */
+	time_t verify_start_time;
+
+	/* The time the verification ended
+	 */
+	time_t verify_end_time;
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	/* The number of storage media buffers in the pipeline
+	 */
+	int number_of_buffers;
+
+	/* The queue of storage media buffers available for reading
+	 */
+	libcthreads_queue_t *free_buffer_queue;
+
+	/* The read thread pool
+	 */
+	libcthreads_thread_pool_t *read_thread_pool;
+
+	/* The compress thread pool, only used when the output is compressed
+	 */
+	libcthreads_thread_pool_t *compress_thread_pool;
+
+	/* The hash thread pool, passes the buffers in order to the digest pipeline
+	 */
+	libcthreads_thread_pool_t *hash_thread_pool;
+
+	/* The mutex protecting the storage media buffer references
+	 */
+	libcthreads_mutex_t *references_mutex;
+
+	/* The write thread pool
+	 */
+	libcthreads_thread_pool_t *write_thread_pool;
+
+	/* The output read thread pool, reads the output back for the verification
+	 */
+	libcthreads_thread_pool_t *output_read_thread_pool;
+
+	/* The compare thread pool, passes the buffers of the verification in order
+	 * to the digest pipelines
+	 */
+	libcthreads_thread_pool_t *compare_thread_pool;
+
+	/* The storage media buffers that were read ahead of the next buffer to hash
+	 */
+	storage_media_buffer_t **pending_buffers;
+
+	/* The sequence number of the next buffer to hash
+	 */
+	uint64_t next_sequence_number;
+#endif
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate a pipeline stage failed
+	 */
+	int stage_failed;
+
+	/* Value to indicate if abort was signalled, e.g. by a failed pipeline stage
+	 */
+	volatile sig_atomic_t abort;
+
+	/* The flag of the caller that signals an abort, which references abort
+	 * if not set
+	 */
+	volatile sig_atomic_t *abort_flag;
+};
+
+/* Determines if the acquisition was aborted, either by the acquire handle
+ * itself or by the abort flag of the caller
+ */
+#define acquire_handle_is_aborted( acquire_handle ) \
+	( ( ( acquire_handle )->abort != 0 ) || ( *( ( acquire_handle )->abort_flag ) != 0 ) )
+
+int acquire_handle_initialize(
+     acquire_handle_t **acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_free(
+     acquire_handle_t **acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_signal_abort(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_set_abort_flag(
+     acquire_handle_t *acquire_handle,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error );
+
+int acquire_handle_set_process_buffer_size(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int acquire_handle_set_number_of_threads(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int acquire_handle_set_additional_digest_types(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int acquire_handle_set_segment_size(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int acquire_handle_set_queue_depth(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int acquire_handle_set_fsync_policy(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int acquire_handle_set_compression_level(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int acquire_handle_copy_settings(
+     acquire_handle_t *destination_acquire_handle,
+     acquire_handle_t *source_acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_open_input(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int acquire_handle_open_tuning_cache(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+int acquire_handle_calibration_read_thread_function(
+     acquire_calibration_reader_t *calibration_reader );
+
+#endif
+
+int acquire_handle_calibrate_trial(
+     acquire_handle_t *acquire_handle,
+     off64_t offset,
+     size64_t size,
+     size_t process_buffer_size,
+     int number_of_threads,
+     uint64_t *throughput,
+     libcerror_error_t **error );
+
+int acquire_handle_calibrate(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_open_rescue_map(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int acquire_handle_open_checkpoint(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *target_filename,
+     uint8_t resume,
+     libcerror_error_t **error );
+
+int acquire_handle_open_output(
+     acquire_handle_t *acquire_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int acquire_handle_set_output_size(
+     acquire_handle_t *acquire_handle,
+     size64_t size,
+     libcerror_error_t **error );
+
+int acquire_handle_close(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_get_extent_by_offset(
+     acquire_handle_t *acquire_handle,
+     off64_t offset,
+     acquire_extent_t **extent,
+     libcerror_error_t **error );
+
+int acquire_handle_initialize_extent_digests(
+     acquire_handle_t *acquire_handle,
+     int maximum_number_of_buffers,
+     int (*release_function)(
+            storage_media_buffer_t *storage_media_buffer,
+            void *release_arguments ),
+     void *release_arguments,
+     libcerror_error_t **error );
+
+int acquire_handle_free_extent_digests(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_finalize_digests(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_save_checkpoint(
+     acquire_handle_t *acquire_handle,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int acquire_handle_rehash_output(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_restore_checkpoint(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_remove_checkpoint(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_read_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int acquire_handle_hash_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int acquire_handle_compress_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int acquire_handle_write_compressed_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int acquire_handle_write_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+void acquire_handle_stage_failed(
+      acquire_handle_t *acquire_handle,
+      libcerror_error_t **error );
+
+int acquire_handle_release_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int acquire_handle_digest_release_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle );
+
+int acquire_handle_output_reference_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle );
+
+int acquire_handle_output_release_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle );
+
+int acquire_handle_read_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle );
+
+int acquire_handle_compress_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle );
+
+int acquire_handle_hash_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle );
+
+int acquire_handle_write_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle );
+
+int acquire_handle_save_checkpoint_threaded(
+     acquire_handle_t *acquire_handle,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int acquire_handle_acquire_threaded(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+int acquire_handle_acquire_single_threaded(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_acquire(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_read_compressed_output_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int acquire_handle_read_output_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int acquire_handle_save_rescue_map(
+     acquire_handle_t *acquire_handle,
+     int force,
+     libcerror_error_t **error );
+
+int acquire_handle_recover_pass(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     uint8_t status,
+     size_t block_size,
+     uint8_t skip_on_error,
+     libcerror_error_t **error );
+
+int acquire_handle_recover_digests(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int acquire_handle_recover(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_compare_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int acquire_handle_verify_buffer(
+     acquire_handle_t *acquire_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+int acquire_handle_verify_release_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle );
+
+int acquire_handle_verify_read_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle );
+
+int acquire_handle_verify_output_read_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle );
+
+int acquire_handle_verify_compare_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     acquire_handle_t *acquire_handle );
+
+int acquire_handle_verify_threaded(
+     acquire_handle_t *acquire_handle,
+     rescue_map_t *verify_map,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+int acquire_handle_verify_single_threaded(
+     acquire_handle_t *acquire_handle,
+     rescue_map_t *verify_map,
+     libcerror_error_t **error );
+
+int acquire_handle_verify(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_digests_fprint(
+     acquire_handle_t *acquire_handle,
+     digest_pipeline_t *digest_pipeline,
+     const char *indentation,
+     libcerror_error_t **error );
+
+int acquire_handle_acquire_fprint(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_handle_verify_fprint(
+     acquire_handle_t *acquire_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ACQUIRE_HANDLE_H ) */
+
@@ -0,0 +1,1738 @@
+/*
+ * Scheduler of concurrent acquisitions over multiple host controllers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#include "acquire_handle.h"
+#include "acquire_scheduler.h"
+#include "host_topology.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcnotify.h"
+#include "tableautools_libcthreads.h"
+#include "tableautools_system_string.h"
+
+#define ACQUIRE_SCHEDULER_NOTIFY_STREAM	stdout
+
+/* Creates an acquire scheduler
+ * Make sure the value acquire_scheduler is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_scheduler_initialize(
+     acquire_scheduler_t **acquire_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_scheduler_initialize";
+
+	if( acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *acquire_scheduler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid acquire scheduler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*acquire_scheduler = memory_allocate_structure(
+	                      acquire_scheduler_t );
+
+	if( *acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create acquire scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *acquire_scheduler,
+	     0,
+	     sizeof( acquire_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear acquire scheduler.",
+		 function );
+
+		memory_free(
+		 *acquire_scheduler );
+
+		*acquire_scheduler = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *acquire_scheduler )->jobs_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create jobs mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *acquire_scheduler )->jobs_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create jobs condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *acquire_scheduler )->maximum_jobs_per_controller = ACQUIRE_SCHEDULER_DEFAULT_MAXIMUM_JOBS_PER_CONTROLLER;
+	( *acquire_scheduler )->notify_stream               = ACQUIRE_SCHEDULER_NOTIFY_STREAM;
+	( *acquire_scheduler )->abort_flag                  = &( ( *acquire_scheduler )->abort );
+
+	return( 1 );
+
+on_error:
+	if( *acquire_scheduler != NULL )
+	{
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		if( ( *acquire_scheduler )->jobs_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *acquire_scheduler )->jobs_mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *acquire_scheduler );
+
+		*acquire_scheduler = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a job
+ * Returns 1 if successful or -1 on error
+ */
+static int acquire_scheduler_free_job(
+            acquire_job_t **job,
+            libcerror_error_t **error )
+{
+	static char *function = "acquire_scheduler_free_job";
+	int result            = 1;
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *job != NULL )
+	{
+		if( ( *job )->acquire_handle != NULL )
+		{
+			if( acquire_handle_free(
+			     &( ( *job )->acquire_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free acquire handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *job )->source != NULL )
+		{
+			memory_free(
+			 ( *job )->source );
+		}
+		if( ( *job )->target != NULL )
+		{
+			memory_free(
+			 ( *job )->target );
+		}
+		memory_free(
+		 *job );
+
+		*job = NULL;
+	}
+	return( result );
+}
+
+/* Frees an acquire scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_scheduler_free(
+     acquire_scheduler_t **acquire_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_scheduler_free";
+	int job_index         = 0;
+	int result            = 1;
+
+	if( acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *acquire_scheduler != NULL )
+	{
+		for( job_index = 0;
+		     job_index < ( *acquire_scheduler )->number_of_jobs;
+		     job_index++ )
+		{
+			if( acquire_scheduler_free_job(
+			     &( ( *acquire_scheduler )->jobs[ job_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free job: %d.",
+				 function,
+				 job_index );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *acquire_scheduler )->jobs_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free jobs condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *acquire_scheduler )->jobs_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free jobs mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *acquire_scheduler );
+
+		*acquire_scheduler = NULL;
+	}
+	return( result );
+}
+
+/* Signals the acquire scheduler to abort
+ * The acquire handles of the jobs share the abort flag of the scheduler,
+ * hence the function only sets the flag and can be called from a signal
+ * handler
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_scheduler_signal_abort(
+     acquire_scheduler_t *acquire_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_scheduler_signal_abort";
+
+	if( acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	*( acquire_scheduler->abort_flag ) = 1;
+
+	return( 1 );
+}
+
+/* Sets the flag that signals the acquire scheduler to abort
+ * A signal handler of the caller only needs to set the flag to abort the
+ * jobs, the flag is passed to the acquire handles of the jobs when run
+ * If abort_flag is NULL the flag of the scheduler is used
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_scheduler_set_abort_flag(
+     acquire_scheduler_t *acquire_scheduler,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_scheduler_set_abort_flag";
+
+	if( acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort_flag == NULL )
+	{
+		acquire_scheduler->abort_flag = &( acquire_scheduler->abort );
+	}
+	else
+	{
+		acquire_scheduler->abort_flag = abort_flag;
+	}
+	return( 1 );
+}
+
+/* Sets the maximum number of concurrent jobs per host controller
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int acquire_scheduler_set_maximum_jobs_per_controller(
+     acquire_scheduler_t *acquire_scheduler,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "acquire_scheduler_set_maximum_jobs_per_controller";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( tableautools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) ACQUIRE_SCHEDULER_MAXIMUM_JOBS_PER_CONTROLLER ) )
+	{
+		return( 0 );
+	}
+	acquire_scheduler->maximum_jobs_per_controller = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Appends a job that acquires the source device into the target file
+ * The host controller of the source device is determined when the job is
+ * appended, a job of which the host controller cannot be determined is
+ * not limited by the other jobs
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_scheduler_append_job(
+     acquire_scheduler_t *acquire_scheduler,
+     const system_character_t *source,
+     size_t source_length,
+     const system_character_t *target,
+     size_t target_length,
+     libcerror_error_t **error )
+{
+	acquire_job_t *job             = NULL;
+	libcerror_error_t *local_error = NULL;
+	static char *function          = "acquire_scheduler_append_job";
+	int job_index                  = 0;
+	int result                     = 0;
+
+	if( acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_scheduler->number_of_jobs >= ACQUIRE_SCHEDULER_MAXIMUM_NUMBER_OF_JOBS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: number of jobs exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_length == 0 )
+	 || ( source_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( target_length == 0 )
+	 || ( target_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid target length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every target must be unique otherwise jobs overwrite each other
+	 */
+	for( job_index = 0;
+	     job_index < acquire_scheduler->number_of_jobs;
+	     job_index++ )
+	{
+		if( ( system_string_length( acquire_scheduler->jobs[ job_index ]->target ) == target_length )
+		 && ( system_string_compare(
+		       acquire_scheduler->jobs[ job_index ]->target,
+		       target,
+		       target_length ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid target value already used by job: %d.",
+			 function,
+			 job_index );
+
+			return( -1 );
+		}
+	}
+	job = memory_allocate_structure(
+	       acquire_job_t );
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     job,
+	     0,
+	     sizeof( acquire_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear job.",
+		 function );
+
+		memory_free(
+		 job );
+
+		return( -1 );
+	}
+	job->source = system_string_allocate(
+	               source_length + 1 );
+
+	if( job->source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     job->source,
+	     source,
+	     source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source.",
+		 function );
+
+		goto on_error;
+	}
+	job->source[ source_length ] = 0;
+
+	job->target = system_string_allocate(
+	               target_length + 1 );
+
+	if( job->target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create target.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     job->target,
+	     target,
+	     target_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy target.",
+		 function );
+
+		goto on_error;
+	}
+	job->target[ target_length ] = 0;
+
+	result = host_topology_get_controller(
+	          job->source,
+	          job->controller,
+	          HOST_TOPOLOGY_CONTROLLER_SIZE,
+	          &local_error );
+
+	if( result != 1 )
+	{
+		if( ( result == -1 )
+		 && ( libcnotify_verbose != 0 ) )
+		{
+			libcnotify_printf(
+			 "%s: unable to determine host controller of source: %" PRIs_SYSTEM ".\n",
+			 function,
+			 job->source );
+
+			libcnotify_print_error_backtrace(
+			 local_error );
+		}
+		libcerror_error_free(
+		 &local_error );
+
+		job->controller[ 0 ] = 0;
+	}
+	if( acquire_handle_initialize(
+	     &( job->acquire_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create acquire handle.",
+		 function );
+
+		goto on_error;
+	}
+	job->acquire_scheduler = acquire_scheduler;
+	job->state             = ACQUIRE_JOB_STATE_PENDING;
+
+	acquire_scheduler->jobs[ acquire_scheduler->number_of_jobs ] = job;
+
+	acquire_scheduler->number_of_jobs += 1;
+
+	return( 1 );
+
+on_error:
+	if( job != NULL )
+	{
+		acquire_scheduler_free_job(
+		 &job,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the jobs from a job file
+ * Every job line contains the source device and the target file separated
+ * by a tab, empty lines and lines starting with # are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_scheduler_read_job_file(
+     acquire_scheduler_t *acquire_scheduler,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t line[ ACQUIRE_SCHEDULER_MAXIMUM_LINE_SIZE ];
+
+	FILE *file_stream     = NULL;
+	static char *function = "acquire_scheduler_read_job_file";
+	size_t line_length    = 0;
+	size_t source_length  = 0;
+	int line_number       = 0;
+
+	if( acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"r" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "r" );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open job file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( file_stream_get_string_wide(
+	        file_stream,
+	        line,
+	        ACQUIRE_SCHEDULER_MAXIMUM_LINE_SIZE ) != NULL )
+#else
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        ACQUIRE_SCHEDULER_MAXIMUM_LINE_SIZE ) != NULL )
+#endif
+	{
+		line_number++;
+
+		line_length = system_string_length(
+		               line );
+
+		/* The last line is not required to end with a new line
+		 */
+		if( ( line_length == 0 )
+		 || ( ( line[ line_length - 1 ] != (system_character_t) '\n' )
+		  &&  ( file_stream_at_end( file_stream ) == 0 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid line: %d value out of bounds.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == (system_character_t) '\n' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == (system_character_t) '#' ) )
+		{
+			continue;
+		}
+		for( source_length = 0;
+		     source_length < line_length;
+		     source_length++ )
+		{
+			if( line[ source_length ] == (system_character_t) '\t' )
+			{
+				break;
+			}
+		}
+		if( ( source_length == 0 )
+		 || ( source_length + 1 >= line_length ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing source or target on line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( acquire_scheduler_append_job(
+		     acquire_scheduler,
+		     line,
+		     source_length,
+		     &( line[ source_length + 1 ] ),
+		     line_length - ( source_length + 1 ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append job on line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close job file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 file_stream );
+
+	return( -1 );
+}
+
+/* Retrieves the next job to start
+ * Of the pending jobs whose host controller runs less than the maximum
+ * number of jobs, the job on the host controller that runs the fewest jobs
+ * is started first, so that the reads spread over the host controllers
+ * as jobs finish. Jobs on the same number of running jobs start in the order
+ * they were appended. A job of which the host controller is unknown is
+ * considered to be on a host controller of its own
+ * The caller must hold the jobs mutex
+ * Returns 1 if successful, 0 if no job can be started or -1 on error
+ */
+int acquire_scheduler_get_next_job(
+     acquire_scheduler_t *acquire_scheduler,
+     acquire_job_t **job,
+     libcerror_error_t **error )
+{
+	acquire_job_t *candidate_job = NULL;
+	acquire_job_t *running_job   = NULL;
+	static char *function        = "acquire_scheduler_get_next_job";
+	int best_number_of_jobs      = 0;
+	int job_index                = 0;
+	int number_of_jobs           = 0;
+	int running_job_index        = 0;
+
+	if( acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	*job = NULL;
+
+	for( job_index = 0;
+	     job_index < acquire_scheduler->number_of_jobs;
+	     job_index++ )
+	{
+		candidate_job = acquire_scheduler->jobs[ job_index ];
+
+		if( candidate_job->state != ACQUIRE_JOB_STATE_PENDING )
+		{
+			continue;
+		}
+		number_of_jobs = 0;
+
+		if( candidate_job->controller[ 0 ] != 0 )
+		{
+			for( running_job_index = 0;
+			     running_job_index < acquire_scheduler->number_of_jobs;
+			     running_job_index++ )
+			{
+				running_job = acquire_scheduler->jobs[ running_job_index ];
+
+				if( ( running_job->state == ACQUIRE_JOB_STATE_RUNNING )
+				 && ( narrow_string_compare(
+				       running_job->controller,
+				       candidate_job->controller,
+				       HOST_TOPOLOGY_CONTROLLER_SIZE ) == 0 ) )
+				{
+					number_of_jobs++;
+				}
+			}
+			if( number_of_jobs >= acquire_scheduler->maximum_jobs_per_controller )
+			{
+				continue;
+			}
+		}
+		if( ( *job == NULL )
+		 || ( number_of_jobs < best_number_of_jobs ) )
+		{
+			*job                = candidate_job;
+			best_number_of_jobs = number_of_jobs;
+		}
+	}
+	if( *job == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Runs a job
+ * Errors of the acquisition are reported in the result of the job
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_scheduler_run_job(
+     acquire_job_t *job,
+     libcerror_error_t **error )
+{
+	acquire_scheduler_t *acquire_scheduler = NULL;
+	libcerror_error_t *job_error           = NULL;
+	const char *failure_string             = NULL;
+	static char *function                  = "acquire_scheduler_run_job";
+	int result                             = 0;
+	uint8_t input_opened                   = 0;
+	uint8_t resumable                      = 0;
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( job->acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid job - missing acquire scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	acquire_scheduler = job->acquire_scheduler;
+
+	if( acquire_handle_open_input(
+	     job->acquire_handle,
+	     job->source,
+	     &job_error ) != 1 )
+	{
+		failure_string = "Unable to open source device";
+		result         = -1;
+	}
+	else
+	{
+		input_opened = 1;
+
+		if( acquire_handle_open_checkpoint(
+		     job->acquire_handle,
+		     job->target,
+		     0,
+		     &job_error ) != 1 )
+		{
+			failure_string = "Unable to open checkpoint";
+			result         = -1;
+		}
+		else if( acquire_handle_open_output(
+		          job->acquire_handle,
+		          job->target,
+		          &job_error ) != 1 )
+		{
+			failure_string = "Unable to open target file";
+			result         = -1;
+		}
+		else
+		{
+			result = acquire_handle_acquire(
+			          job->acquire_handle,
+			          &job_error );
+
+			if( result == -1 )
+			{
+				failure_string = "Unable to acquire source device";
+				resumable      = (uint8_t) ( job->acquire_handle->checkpoint != NULL );
+			}
+			else if( result == 0 )
+			{
+				failure_string = "Aborted while acquiring source device";
+				resumable      = (uint8_t) ( job->acquire_handle->checkpoint != NULL );
+			}
+			else if( acquire_scheduler->verify != 0 )
+			{
+				result = acquire_handle_verify(
+				          job->acquire_handle,
+				          &job_error );
+
+				if( result == -1 )
+				{
+					failure_string = "Unable to verify target";
+				}
+				else if( result == 0 )
+				{
+					failure_string = "Aborted while verifying target";
+				}
+			}
+		}
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     acquire_scheduler->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab jobs mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The summaries of the jobs are printed while holding the jobs mutex
+	 * so that they do not interleave
+	 */
+	fprintf(
+	 acquire_scheduler->notify_stream,
+	 "Job: %" PRIs_SYSTEM " to: %" PRIs_SYSTEM "\n",
+	 job->source,
+	 job->target );
+
+	if( failure_string != NULL )
+	{
+		fprintf(
+		 acquire_scheduler->notify_stream,
+		 "%s.\n",
+		 failure_string );
+
+		if( job_error != NULL )
+		{
+			libcnotify_print_error_backtrace(
+			 job_error );
+		}
+		if( resumable != 0 )
+		{
+			fprintf(
+			 acquire_scheduler->notify_stream,
+			 "The acquisition can be resumed from the last checkpoint with -R.\n" );
+		}
+		fprintf(
+		 acquire_scheduler->notify_stream,
+		 "\n" );
+	}
+	else
+	{
+		if( acquire_handle_acquire_fprint(
+		     job->acquire_handle,
+		     &job_error ) != 1 )
+		{
+			fprintf(
+			 acquire_scheduler->notify_stream,
+			 "Unable to print acquisition summary.\n" );
+
+			libcnotify_print_error_backtrace(
+			 job_error );
+
+			result = -1;
+		}
+		else if( acquire_scheduler->verify != 0 )
+		{
+			if( acquire_handle_verify_fprint(
+			     job->acquire_handle,
+			     &job_error ) != 1 )
+			{
+				fprintf(
+				 acquire_scheduler->notify_stream,
+				 "Unable to print verification summary.\n" );
+
+				libcnotify_print_error_backtrace(
+				 job_error );
+
+				result = -1;
+			}
+			else if( job->acquire_handle->number_of_mismatched_sectors > 0 )
+			{
+				fprintf(
+				 acquire_scheduler->notify_stream,
+				 "Verification failed: the target differs from the source in %" PRIu64 " sector(s), the first at offset: %" PRIi64 ".\n",
+				 job->acquire_handle->number_of_mismatched_sectors,
+				 job->acquire_handle->first_mismatch_offset );
+
+				result = 0;
+			}
+		}
+	}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     acquire_scheduler->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release jobs mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( job_error != NULL )
+	{
+		libcerror_error_free(
+		 &job_error );
+	}
+	/* A handle of which the input could not be opened has nothing to close
+	 */
+	if( input_opened != 0 )
+	{
+		input_opened = 0;
+
+		if( acquire_handle_close(
+		     job->acquire_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close acquire handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	job->result = result;
+
+	return( 1 );
+
+on_error:
+	if( job_error != NULL )
+	{
+		libcerror_error_free(
+		 &job_error );
+	}
+	if( input_opened != 0 )
+	{
+		acquire_handle_close(
+		 job->acquire_handle,
+		 NULL );
+	}
+
+	job->result = -1;
+
+	return( -1 );
+}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+/* Thread function of a job
+ * Runs the job and signals the scheduler that the job has finished
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_scheduler_job_thread_function(
+     acquire_job_t *job )
+{
+	acquire_scheduler_t *acquire_scheduler = NULL;
+	libcerror_error_t *error               = NULL;
+	static char *function                  = "acquire_scheduler_job_thread_function";
+	int jobs_mutex_grabbed                 = 0;
+
+	if( job == NULL )
+	{
+		return( -1 );
+	}
+	acquire_scheduler = job->acquire_scheduler;
+
+	if( acquire_scheduler == NULL )
+	{
+		return( -1 );
+	}
+	if( acquire_scheduler_run_job(
+	     job,
+	     &error ) != 1 )
+	{
+		libcnotify_printf(
+		 "%s: unable to run job.\n",
+		 function );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	/* The buffered debug output of the job is lost when the thread exits
+	 */
+	libtableau_notify_flush(
+	 NULL );
+
+	if( libcthreads_mutex_grab(
+	     acquire_scheduler->jobs_mutex,
+	     &error ) == 1 )
+	{
+		jobs_mutex_grabbed = 1;
+	}
+	else
+	{
+		libcnotify_printf(
+		 "%s: unable to grab jobs mutex.\n",
+		 function );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	job->state = ACQUIRE_JOB_STATE_FINISHED;
+
+	acquire_scheduler->number_of_running_jobs -= 1;
+
+	if( libcthreads_condition_broadcast(
+	     acquire_scheduler->jobs_condition,
+	     &error ) != 1 )
+	{
+		libcnotify_printf(
+		 "%s: unable to broadcast jobs condition.\n",
+		 function );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( jobs_mutex_grabbed != 0 )
+	{
+		if( libcthreads_mutex_release(
+		     acquire_scheduler->jobs_mutex,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to release jobs mutex.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+/* Starts a job
+ * The caller must hold the jobs mutex
+ * Returns 1 if successful or -1 on error
+ */
+static int acquire_scheduler_start_job(
+            acquire_scheduler_t *acquire_scheduler,
+            acquire_job_t *job,
+            libcerror_error_t **error )
+{
+	static char *function = "acquire_scheduler_start_job";
+
+	job->state = ACQUIRE_JOB_STATE_RUNNING;
+
+	acquire_scheduler->number_of_running_jobs += 1;
+
+	fprintf(
+	 acquire_scheduler->notify_stream,
+	 "Starting job: %" PRIs_SYSTEM " on host controller: %s\n",
+	 job->source,
+	 ( job->controller[ 0 ] != 0 ) ? job->controller : "unknown" );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_thread_create(
+	     &( job->thread ),
+	     NULL,
+	     (int (*)(void *)) &acquire_scheduler_job_thread_function,
+	     (void *) job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create job thread.",
+		 function );
+
+		job->state  = ACQUIRE_JOB_STATE_FINISHED;
+		job->result = -1;
+
+		acquire_scheduler->number_of_running_jobs -= 1;
+
+		return( -1 );
+	}
+#else
+	if( acquire_scheduler_run_job(
+	     job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run job.",
+		 function );
+
+		job->state = ACQUIRE_JOB_STATE_FINISHED;
+
+		acquire_scheduler->number_of_running_jobs -= 1;
+
+		return( -1 );
+	}
+	job->state = ACQUIRE_JOB_STATE_FINISHED;
+
+	acquire_scheduler->number_of_running_jobs -= 1;
+#endif
+	return( 1 );
+}
+
+/* Runs the jobs
+ * The jobs are started as long as their host controller runs less than
+ * the maximum number of jobs, every job that finishes frees a slot on its
+ * host controller for the next pending job. Without multi-threading support
+ * the jobs run one after the other
+ * The settings of the acquire handle of every job are copied from the
+ * settings acquire handle
+ * Returns 1 if all jobs succeeded, 0 if a job failed or was aborted or -1 on error
+ */
+int acquire_scheduler_run(
+     acquire_scheduler_t *acquire_scheduler,
+     acquire_handle_t *settings_acquire_handle,
+     libcerror_error_t **error )
+{
+	acquire_job_t *job     = NULL;
+	static char *function  = "acquire_scheduler_run";
+	int job_index          = 0;
+	int result             = 0;
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	int jobs_mutex_grabbed = 0;
+#endif
+
+	if( acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_scheduler->number_of_jobs == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid acquire scheduler - missing jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( acquire_scheduler->number_of_running_jobs != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid acquire scheduler - jobs already running.",
+		 function );
+
+		return( -1 );
+	}
+	for( job_index = 0;
+	     job_index < acquire_scheduler->number_of_jobs;
+	     job_index++ )
+	{
+		if( acquire_handle_copy_settings(
+		     acquire_scheduler->jobs[ job_index ]->acquire_handle,
+		     settings_acquire_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy settings to acquire handle of job: %d.",
+			 function,
+			 job_index );
+
+			return( -1 );
+		}
+		if( acquire_handle_set_abort_flag(
+		     acquire_scheduler->jobs[ job_index ]->acquire_handle,
+		     acquire_scheduler->abort_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set abort flag of acquire handle of job: %d.",
+			 function,
+			 job_index );
+
+			return( -1 );
+		}
+	}
+	acquire_scheduler->start_time = time( NULL );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     acquire_scheduler->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab jobs mutex.",
+		 function );
+
+		goto on_error;
+	}
+	jobs_mutex_grabbed = 1;
+#endif
+	do
+	{
+		while( *( acquire_scheduler->abort_flag ) == 0 )
+		{
+			result = acquire_scheduler_get_next_job(
+			          acquire_scheduler,
+			          &job,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next job.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( acquire_scheduler_start_job(
+			     acquire_scheduler,
+			     job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to start job.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		if( acquire_scheduler->number_of_running_jobs == 0 )
+		{
+			break;
+		}
+		if( libcthreads_condition_wait(
+		     acquire_scheduler->jobs_condition,
+		     acquire_scheduler->jobs_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for jobs condition.",
+			 function );
+
+			goto on_error;
+		}
+		/* A finished job has released the jobs mutex before the wait returned
+		 */
+		for( job_index = 0;
+		     job_index < acquire_scheduler->number_of_jobs;
+		     job_index++ )
+		{
+			job = acquire_scheduler->jobs[ job_index ];
+
+			if( ( job->state == ACQUIRE_JOB_STATE_FINISHED )
+			 && ( job->thread != NULL ) )
+			{
+				if( libcthreads_thread_join(
+				     &( job->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join thread of job: %d.",
+					 function,
+					 job_index );
+
+					goto on_error;
+				}
+			}
+		}
+#endif
+	}
+	while( acquire_scheduler->number_of_running_jobs > 0 );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	jobs_mutex_grabbed = 0;
+
+	if( libcthreads_mutex_release(
+	     acquire_scheduler->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release jobs mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	acquire_scheduler->end_time = time( NULL );
+
+	result = 1;
+
+	for( job_index = 0;
+	     job_index < acquire_scheduler->number_of_jobs;
+	     job_index++ )
+	{
+		job = acquire_scheduler->jobs[ job_index ];
+
+		if( ( job->state != ACQUIRE_JOB_STATE_FINISHED )
+		 || ( job->result != 1 ) )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	/* Abort the running jobs and wait for them to finish
+	 */
+	acquire_scheduler_signal_abort(
+	 acquire_scheduler,
+	 NULL );
+
+	if( jobs_mutex_grabbed == 0 )
+	{
+		if( libcthreads_mutex_grab(
+		     acquire_scheduler->jobs_mutex,
+		     NULL ) == 1 )
+		{
+			jobs_mutex_grabbed = 1;
+		}
+	}
+	if( jobs_mutex_grabbed != 0 )
+	{
+		while( acquire_scheduler->number_of_running_jobs > 0 )
+		{
+			if( libcthreads_condition_wait(
+			     acquire_scheduler->jobs_condition,
+			     acquire_scheduler->jobs_mutex,
+			     NULL ) != 1 )
+			{
+				break;
+			}
+		}
+		libcthreads_mutex_release(
+		 acquire_scheduler->jobs_mutex,
+		 NULL );
+	}
+	for( job_index = 0;
+	     job_index < acquire_scheduler->number_of_jobs;
+	     job_index++ )
+	{
+		job = acquire_scheduler->jobs[ job_index ];
+
+		if( job->thread != NULL )
+		{
+			libcthreads_thread_join(
+			 &( job->thread ),
+			 NULL );
+		}
+	}
+#endif
+	return( -1 );
+}
+
+/* Prints a summary of the jobs
+ * Returns 1 if successful or -1 on error
+ */
+int acquire_scheduler_fprint(
+     acquire_scheduler_t *acquire_scheduler,
+     libcerror_error_t **error )
+{
+	acquire_job_t *job          = NULL;
+	const char *job_status      = NULL;
+	static char *function       = "acquire_scheduler_fprint";
+	size64_t acquired_size      = 0;
+	size64_t bytes_per_second   = 0;
+	time_t number_of_seconds    = 0;
+	int job_index               = 0;
+	int number_of_failed_jobs   = 0;
+
+	if( acquire_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid acquire scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds = acquire_scheduler->end_time - acquire_scheduler->start_time;
+
+	fprintf(
+	 acquire_scheduler->notify_stream,
+	 "Jobs completed\n" );
+
+	for( job_index = 0;
+	     job_index < acquire_scheduler->number_of_jobs;
+	     job_index++ )
+	{
+		job = acquire_scheduler->jobs[ job_index ];
+
+		if( job->state != ACQUIRE_JOB_STATE_FINISHED )
+		{
+			job_status = "not started";
+		}
+		else if( job->result == 1 )
+		{
+			job_status = "succeeded";
+		}
+		else if( job->result == 0 )
+		{
+			job_status = "aborted or failed verification";
+		}
+		else
+		{
+			job_status = "failed";
+		}
+		if( job->result != 1 )
+		{
+			number_of_failed_jobs++;
+		}
+		acquired_size += job->acquire_handle->acquired_size;
+
+		fprintf(
+		 acquire_scheduler->notify_stream,
+		 "\t%" PRIs_SYSTEM " to: %" PRIs_SYSTEM "\t: %s (host controller: %s)\n",
+		 job->source,
+		 job->target,
+		 job_status,
+		 ( job->controller[ 0 ] != 0 ) ? job->controller : "unknown" );
+	}
+	fprintf(
+	 acquire_scheduler->notify_stream,
+	 "\tNumber of jobs\t\t: %d (%d not succeeded)\n",
+	 acquire_scheduler->number_of_jobs,
+	 number_of_failed_jobs );
+
+	fprintf(
+	 acquire_scheduler->notify_stream,
+	 "\tAcquired\t\t: %" PRIu64 " bytes\n",
+	 acquired_size );
+
+	fprintf(
+	 acquire_scheduler->notify_stream,
+	 "\tDuration\t\t: %" PRIi64 " seconds\n",
+	 (int64_t) number_of_seconds );
+
+	if( number_of_seconds > 0 )
+	{
+		bytes_per_second = acquired_size / (size64_t) number_of_seconds;
+
+		fprintf(
+		 acquire_scheduler->notify_stream,
+		 "\tTotal throughput\t: %" PRIu64 " MiB/s\n",
+		 bytes_per_second / ( 1024 * 1024 ) );
+	}
+	fprintf(
+	 acquire_scheduler->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
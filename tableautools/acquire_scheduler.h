@@ -0,0 +1,217 @@
+/*
+ * Scheduler of concurrent acquisitions over multiple host controllers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ACQUIRE_SCHEDULER_H )
+#define _ACQUIRE_SCHEDULER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include <signal.h>
+
+#include "acquire_handle.h"
+#include "host_topology.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define ACQUIRE_SCHEDULER_MAXIMUM_NUMBER_OF_JOBS			64
+
+#define ACQUIRE_SCHEDULER_DEFAULT_MAXIMUM_JOBS_PER_CONTROLLER		2
+#define ACQUIRE_SCHEDULER_MAXIMUM_JOBS_PER_CONTROLLER			32
+
+/* The maximum size of a line of a job file
+ */
+#define ACQUIRE_SCHEDULER_MAXIMUM_LINE_SIZE				4096
+
+enum ACQUIRE_JOB_STATES
+{
+	ACQUIRE_JOB_STATE_PENDING					= 0,
+	ACQUIRE_JOB_STATE_RUNNING					= 1,
+	ACQUIRE_JOB_STATE_FINISHED					= 2
+};
+
+typedef struct acquire_scheduler acquire_scheduler_t;
+
+typedef struct acquire_job acquire_job_t;
+
+struct acquire_job
+{
+	/* The scheduler
+	 */
+	acquire_scheduler_t *acquire_scheduler;
+
+	/* The source device
+	 */
+	system_character_t *source;
+
+	/* The target file
+	 */
+	system_character_t *target;
+
+	/* The host controller of the source device
+	 * an empty string if the host controller is unknown
+	 */
+	char controller[ HOST_TOPOLOGY_CONTROLLER_SIZE ];
+
+	/* The acquire handle
+	 */
+	acquire_handle_t *acquire_handle;
+
+	/* The state
+	 */
+	uint8_t state;
+
+	/* The result, 1 if the acquisition succeeded, 0 if it was aborted or
+	 * the verification failed and -1 on error
+	 */
+	int result;
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct acquire_scheduler
+{
+	/* The jobs
+	 */
+	acquire_job_t *jobs[ ACQUIRE_SCHEDULER_MAXIMUM_NUMBER_OF_JOBS ];
+
+	/* The number of jobs
+	 */
+	int number_of_jobs;
+
+	/* The maximum number of concurrent jobs per host controller
+	 */
+	int maximum_jobs_per_controller;
+
+	/* Value to indicate the target of every job should be verified
+	 */
+	uint8_t verify;
+
+	/* The number of running jobs
+	 */
+	int number_of_running_jobs;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* The start time
+	 */
+	time_t start_time;
+
+	/* The end time
+	 */
+	time_t end_time;
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	/* The mutex protecting the job states and the notification output
+	 */
+	libcthreads_mutex_t *jobs_mutex;
+
+	/* The condition signalled when a job has finished
+	 */
+	libcthreads_condition_t *jobs_condition;
+#endif
+
+	/* Value to indicate if abort was signalled
+	 */
+	volatile sig_atomic_t abort;
+
+	/* The flag that signals an abort, which references abort if not set
+	 */
+	volatile sig_atomic_t *abort_flag;
+};
+
+int acquire_scheduler_initialize(
+     acquire_scheduler_t **acquire_scheduler,
+     libcerror_error_t **error );
+
+int acquire_scheduler_free(
+     acquire_scheduler_t **acquire_scheduler,
+     libcerror_error_t **error );
+
+int acquire_scheduler_signal_abort(
+     acquire_scheduler_t *acquire_scheduler,
+     libcerror_error_t **error );
+
+int acquire_scheduler_set_abort_flag(
+     acquire_scheduler_t *acquire_scheduler,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error );
+
+int acquire_scheduler_set_maximum_jobs_per_controller(
+     acquire_scheduler_t *acquire_scheduler,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int acquire_scheduler_append_job(
+     acquire_scheduler_t *acquire_scheduler,
+     const system_character_t *source,
+     size_t source_length,
+     const system_character_t *target,
+     size_t target_length,
+     libcerror_error_t **error );
+
+int acquire_scheduler_read_job_file(
+     acquire_scheduler_t *acquire_scheduler,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int acquire_scheduler_get_next_job(
+     acquire_scheduler_t *acquire_scheduler,
+     acquire_job_t **job,
+     libcerror_error_t **error );
+
+int acquire_scheduler_run_job(
+     acquire_job_t *job,
+     libcerror_error_t **error );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+int acquire_scheduler_job_thread_function(
+     acquire_job_t *job );
+
+#endif
+
+int acquire_scheduler_run(
+     acquire_scheduler_t *acquire_scheduler,
+     acquire_handle_t *settings_acquire_handle,
+     libcerror_error_t **error );
+
+int acquire_scheduler_fprint(
+     acquire_scheduler_t *acquire_scheduler,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ACQUIRE_SCHEDULER_H ) */
+
@@ -0,0 +1,1160 @@
+/*
+ * Checkpoint of a resumable acquisition
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#include "checkpoint.h"
+#include "digest_pipeline.h"
+#include "rescue_map.h"
+#include "tableautools_libcerror.h"
+
+/* The maximum size of a line, a digest state line is the largest
+ */
+#define CHECKPOINT_MAXIMUM_LINE_SIZE	( 64 + ( 2 * DIGEST_PIPELINE_STATE_SIZE ) )
+
+/* Creates a checkpoint
+ * Make sure the value checkpoint is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int checkpoint_initialize(
+     checkpoint_t **checkpoint,
+     libcerror_error_t **error )
+{
+	static char *function = "checkpoint_initialize";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checkpoint != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checkpoint value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*checkpoint = memory_allocate_structure(
+	               checkpoint_t );
+
+	if( *checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *checkpoint,
+	     0,
+	     sizeof( checkpoint_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear checkpoint.",
+		 function );
+
+		memory_free(
+		 *checkpoint );
+
+		*checkpoint = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int checkpoint_free(
+     checkpoint_t **checkpoint,
+     libcerror_error_t **error )
+{
+	static char *function = "checkpoint_free";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checkpoint != NULL )
+	{
+		memory_free(
+		 *checkpoint );
+
+		*checkpoint = NULL;
+	}
+	return( 1 );
+}
+
+/* Copies an intermediate digest state from a string of hexadecimal digits
+ * The string must contain exactly 2 digits per byte of the state
+ * Returns 1 if successful or -1 on error
+ */
+int checkpoint_copy_state_from_string(
+     const char *string,
+     size_t string_length,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "checkpoint_copy_state_from_string";
+	size_t state_index    = 0;
+	size_t string_index   = 0;
+	uint8_t byte_value    = 0;
+	char character        = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( state_size > (size_t) ( SSIZE_MAX / 2 ) )
+	 || ( string_length != ( 2 * state_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( state_index = 0;
+	     state_index < state_size;
+	     state_index++ )
+	{
+		byte_value = 0;
+
+		for( string_index = 2 * state_index;
+		     string_index < ( 2 * state_index ) + 2;
+		     string_index++ )
+		{
+			character = string[ string_index ];
+
+			if( ( character >= '0' )
+			 && ( character <= '9' ) )
+			{
+				character -= '0';
+			}
+			else if( ( character >= 'a' )
+			      && ( character <= 'f' ) )
+			{
+				character -= 'a' - 10;
+			}
+			else if( ( character >= 'A' )
+			      && ( character <= 'F' ) )
+			{
+				character -= 'A' - 10;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported character at index: %" PRIzd ".",
+				 function,
+				 string_index );
+
+				return( -1 );
+			}
+			byte_value <<= 4;
+			byte_value  |= (uint8_t) character;
+		}
+		state[ state_index ] = byte_value;
+	}
+	return( 1 );
+}
+
+/* Copies a string value of a checkpoint line
+ * Returns 1 if successful or -1 on error
+ */
+static int checkpoint_copy_string_value(
+            const char *value,
+            size_t value_length,
+            char *string,
+            size_t string_size,
+            libcerror_error_t **error )
+{
+	static char *function = "checkpoint_copy_string_value";
+
+	if( value_length >= string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: value too large.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     string,
+	     value,
+	     value_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		return( -1 );
+	}
+	string[ value_length ] = 0;
+
+	return( 1 );
+}
+
+/* Reads the checkpoint from a file
+ * Every line contains a key and a value separated by a tab, numeric values
+ * are in hexadecimal and digest states are a string of hexadecimal digits
+ * Returns 1 if successful, 0 if the file does not exist or -1 on error
+ */
+int checkpoint_read(
+     checkpoint_t *checkpoint,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	char line[ CHECKPOINT_MAXIMUM_LINE_SIZE ];
+
+	FILE *file_stream         = NULL;
+	const char *value         = NULL;
+	static char *function     = "checkpoint_read";
+	size_t key_length         = 0;
+	size_t line_index         = 0;
+	size_t line_length        = 0;
+	size_t value_length       = 0;
+	uint64_t value_64bit      = 0;
+	uint64_t size             = 0;
+	off64_t extent_end_offset = 0;
+	int extent_index          = 0;
+	int has_offset            = 0;
+	int line_number           = 0;
+	int result                = 0;
+	int version               = 0;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"r" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "r" );
+#endif
+	if( file_stream == NULL )
+	{
+		if( errno == ENOENT )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open checkpoint: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     checkpoint,
+	     0,
+	     sizeof( checkpoint_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        CHECKPOINT_MAXIMUM_LINE_SIZE ) != NULL )
+	{
+		line_number++;
+
+		line_length = narrow_string_length(
+		               line );
+
+		if( ( line_length == 0 )
+		 || ( line[ line_length - 1 ] != '\n' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid line: %d value out of bounds.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == '\n' )
+		     ||  ( line[ line_length - 1 ] == '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == '#' ) )
+		{
+			continue;
+		}
+		for( key_length = 0;
+		     key_length < line_length;
+		     key_length++ )
+		{
+			if( line[ key_length ] == '\t' )
+			{
+				break;
+			}
+		}
+		if( key_length >= line_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: missing value on line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		value        = &( line[ key_length + 1 ] );
+		value_length = line_length - ( key_length + 1 );
+		line_index   = key_length;
+		result       = 1;
+
+		if( ( key_length == 7 )
+		 && ( narrow_string_compare(
+		       line,
+		       "version",
+		       7 ) == 0 ) )
+		{
+			result = rescue_map_copy_hexadecimal_from_string(
+			          line,
+			          line_length,
+			          &line_index,
+			          &value_64bit,
+			          error );
+
+			if( ( result == 1 )
+			 && ( value_64bit != CHECKPOINT_VERSION ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported version: %" PRIu64 ".",
+				 function,
+				 value_64bit );
+
+				result = -1;
+			}
+			version = (int) value_64bit;
+		}
+		else if( ( key_length == 20 )
+		      && ( narrow_string_compare(
+		            line,
+		            "bridge_serial_number",
+		            20 ) == 0 ) )
+		{
+			result = checkpoint_copy_string_value(
+			          value,
+			          value_length,
+			          checkpoint->bridge_serial_number,
+			          32,
+			          error );
+		}
+		else if( ( key_length == 19 )
+		      && ( narrow_string_compare(
+		            line,
+		            "drive_serial_number",
+		            19 ) == 0 ) )
+		{
+			result = checkpoint_copy_string_value(
+			          value,
+			          value_length,
+			          checkpoint->drive_serial_number,
+			          32,
+			          error );
+		}
+		else if( ( key_length == 11 )
+		      && ( narrow_string_compare(
+		            line,
+		            "drive_model",
+		            11 ) == 0 ) )
+		{
+			result = checkpoint_copy_string_value(
+			          value,
+			          value_length,
+			          checkpoint->drive_model,
+			          64,
+			          error );
+		}
+		else if( ( key_length == 10 )
+		      && ( narrow_string_compare(
+		            line,
+		            "media_size",
+		            10 ) == 0 ) )
+		{
+			result = rescue_map_copy_hexadecimal_from_string(
+			          line,
+			          line_length,
+			          &line_index,
+			          &value_64bit,
+			          error );
+
+			checkpoint->media_size = (size64_t) value_64bit;
+		}
+		else if( ( key_length == 16 )
+		      && ( narrow_string_compare(
+		            line,
+		            "bytes_per_sector",
+		            16 ) == 0 ) )
+		{
+			result = rescue_map_copy_hexadecimal_from_string(
+			          line,
+			          line_length,
+			          &line_index,
+			          &value_64bit,
+			          error );
+
+			if( ( result == 1 )
+			 && ( ( value_64bit == 0 )
+			  ||  ( value_64bit > (uint64_t) UINT32_MAX ) ) )
+			{
+				result = 0;
+			}
+			checkpoint->bytes_per_sector = (uint32_t) value_64bit;
+		}
+		else if( ( key_length == 12 )
+		      && ( narrow_string_compare(
+		            line,
+		            "segment_size",
+		            12 ) == 0 ) )
+		{
+			result = rescue_map_copy_hexadecimal_from_string(
+			          line,
+			          line_length,
+			          &line_index,
+			          &value_64bit,
+			          error );
+
+			checkpoint->segment_size = (size64_t) value_64bit;
+		}
+		else if( ( key_length == 12 )
+		      && ( narrow_string_compare(
+		            line,
+		            "digest_types",
+		            12 ) == 0 ) )
+		{
+			result = rescue_map_copy_hexadecimal_from_string(
+			          line,
+			          line_length,
+			          &line_index,
+			          &value_64bit,
+			          error );
+
+			if( ( result == 1 )
+			 && ( ( value_64bit == 0 )
+			  ||  ( ( value_64bit & ~( (uint64_t) DIGEST_PIPELINE_TYPE_MD5 | DIGEST_PIPELINE_TYPE_SHA1 | DIGEST_PIPELINE_TYPE_SHA256 ) ) != 0 ) ) )
+			{
+				result = 0;
+			}
+			checkpoint->digest_types = (uint8_t) value_64bit;
+		}
+		else if( ( key_length == 6 )
+		      && ( narrow_string_compare(
+		            line,
+		            "extent",
+		            6 ) == 0 ) )
+		{
+			if( checkpoint->number_of_extents >= CHECKPOINT_MAXIMUM_NUMBER_OF_EXTENTS )
+			{
+				result = 0;
+			}
+			else if( ( rescue_map_copy_hexadecimal_from_string(
+			            line,
+			            line_length,
+			            &line_index,
+			            &value_64bit,
+			            error ) != 1 )
+			      || ( rescue_map_copy_hexadecimal_from_string(
+			            line,
+			            line_length,
+			            &line_index,
+			            &size,
+			            error ) != 1 ) )
+			{
+				result = -1;
+			}
+			else if( ( value_64bit > (uint64_t) INT64_MAX )
+			      || ( size > ( (uint64_t) INT64_MAX - value_64bit ) ) )
+			{
+				result = 0;
+			}
+			else
+			{
+				checkpoint->extent_offsets[ checkpoint->number_of_extents ] = (off64_t) value_64bit;
+				checkpoint->extent_sizes[ checkpoint->number_of_extents ]   = (size64_t) size;
+
+				checkpoint->number_of_extents += 1;
+			}
+		}
+		else if( ( key_length == 6 )
+		      && ( narrow_string_compare(
+		            line,
+		            "offset",
+		            6 ) == 0 ) )
+		{
+			result = rescue_map_copy_hexadecimal_from_string(
+			          line,
+			          line_length,
+			          &line_index,
+			          &value_64bit,
+			          error );
+
+			if( ( result == 1 )
+			 && ( value_64bit > (uint64_t) INT64_MAX ) )
+			{
+				result = 0;
+			}
+			checkpoint->offset = (off64_t) value_64bit;
+
+			has_offset = 1;
+		}
+		else if( ( key_length == 11 )
+		      && ( narrow_string_compare(
+		            line,
+		            "zero_blocks",
+		            11 ) == 0 ) )
+		{
+			if( ( rescue_map_copy_hexadecimal_from_string(
+			       line,
+			       line_length,
+			       &line_index,
+			       &value_64bit,
+			       error ) != 1 )
+			 || ( rescue_map_copy_hexadecimal_from_string(
+			       line,
+			       line_length,
+			       &line_index,
+			       &size,
+			       error ) != 1 ) )
+			{
+				result = -1;
+			}
+			checkpoint->number_of_zero_blocks = value_64bit;
+			checkpoint->zero_blocks_size      = (size64_t) size;
+		}
+		else if( ( key_length == 12 )
+		      && ( narrow_string_compare(
+		            line,
+		            "digest_state",
+		            12 ) == 0 ) )
+		{
+			result = checkpoint_copy_state_from_string(
+			          value,
+			          value_length,
+			          checkpoint->digest_state,
+			          DIGEST_PIPELINE_STATE_SIZE,
+			          error );
+
+			checkpoint->digest_state_is_set = 1;
+		}
+		else if( ( key_length == 19 )
+		      && ( narrow_string_compare(
+		            line,
+		            "extent_digest_state",
+		            19 ) == 0 ) )
+		{
+			result = rescue_map_copy_hexadecimal_from_string(
+			          line,
+			          line_length,
+			          &line_index,
+			          &value_64bit,
+			          error );
+
+			if( result == 1 )
+			{
+				if( ( value_64bit >= CHECKPOINT_MAXIMUM_NUMBER_OF_EXTENTS )
+				 || ( line_index >= line_length )
+				 || ( line[ line_index ] != '\t' ) )
+				{
+					result = 0;
+				}
+			}
+			if( result == 1 )
+			{
+				extent_index = (int) value_64bit;
+
+				result = checkpoint_copy_state_from_string(
+				          &( line[ line_index + 1 ] ),
+				          line_length - ( line_index + 1 ),
+				          checkpoint->extent_digest_states[ extent_index ],
+				          DIGEST_PIPELINE_STATE_SIZE,
+				          error );
+
+				checkpoint->extent_digest_state_is_set[ extent_index ] = 1;
+			}
+		}
+		else
+		{
+			result = 0;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value on line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close checkpoint.",
+		 function );
+
+		file_stream = NULL;
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+	if( ( version != CHECKPOINT_VERSION )
+	 || ( has_offset == 0 )
+	 || ( checkpoint->bytes_per_sector == 0 )
+	 || ( checkpoint->digest_types == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing checkpoint values.",
+		 function );
+
+		goto on_error;
+	}
+	/* The acquired part must stay within the media
+	 */
+	if( ( (size64_t) checkpoint->offset > checkpoint->media_size )
+	 || ( ( checkpoint->offset % checkpoint->bytes_per_sector ) != 0 )
+	 || ( checkpoint->zero_blocks_size > (size64_t) checkpoint->offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The extents follow each other from the start of the drive up to the
+	 * end of the HPA and DCO. An extent that starts within the media must
+	 * end within it, the extents beyond the media are inaccessible and
+	 * were not read hence have no digest state
+	 */
+	for( extent_index = 0;
+	     extent_index < checkpoint->number_of_extents;
+	     extent_index++ )
+	{
+		if( ( checkpoint->extent_offsets[ extent_index ] != extent_end_offset )
+		 || ( ( (size64_t) extent_end_offset < checkpoint->media_size )
+		  &&  ( checkpoint->extent_sizes[ extent_index ] > ( checkpoint->media_size - (size64_t) extent_end_offset ) ) )
+		 || ( ( (size64_t) extent_end_offset >= checkpoint->media_size )
+		  &&  ( checkpoint->extent_digest_state_is_set[ extent_index ] != 0 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extent: %d value out of bounds.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		extent_end_offset += (off64_t) checkpoint->extent_sizes[ extent_index ];
+	}
+	/* Only the extents that were read have a digest state
+	 */
+	for( extent_index = checkpoint->number_of_extents;
+	     extent_index < CHECKPOINT_MAXIMUM_NUMBER_OF_EXTENTS;
+	     extent_index++ )
+	{
+		if( checkpoint->extent_digest_state_is_set[ extent_index ] != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extent digest state: %d value out of bounds.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Writes the checkpoint to a file
+ * The checkpoint is written to a temporary file first that is flushed to
+ * the storage and then replaces the file, so that an interruption never
+ * leaves a damaged checkpoint behind
+ * Returns 1 if successful or -1 on error
+ */
+int checkpoint_write(
+     checkpoint_t *checkpoint,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t *temporary_filename = NULL;
+	FILE *file_stream                      = NULL;
+	static char *function                  = "checkpoint_write";
+	size_t filename_length                 = 0;
+	size_t state_index                     = 0;
+	int extent_index                       = 0;
+	int print_count                        = 0;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checkpoint->number_of_extents < 0 )
+	 || ( checkpoint->number_of_extents > CHECKPOINT_MAXIMUM_NUMBER_OF_EXTENTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checkpoint - number of extents value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	/* The identification strings are stored as the remainder of a line
+	 */
+	if( ( narrow_string_search_character(
+	       checkpoint->bridge_serial_number,
+	       '\n',
+	       narrow_string_length( checkpoint->bridge_serial_number ) ) != NULL )
+	 || ( narrow_string_search_character(
+	       checkpoint->drive_serial_number,
+	       '\n',
+	       narrow_string_length( checkpoint->drive_serial_number ) ) != NULL )
+	 || ( narrow_string_search_character(
+	       checkpoint->drive_model,
+	       '\n',
+	       narrow_string_length( checkpoint->drive_model ) ) != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported identification string.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	temporary_filename = (system_character_t *) memory_allocate(
+	                                             sizeof( system_character_t ) * ( filename_length + 5 ) );
+
+	if( temporary_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create temporary filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     temporary_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( temporary_filename[ filename_length ] ),
+	     _SYSTEM_STRING( ".tmp" ),
+	     5 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy temporary filename suffix.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               temporary_filename,
+	               L"w" );
+#else
+	file_stream = file_stream_open(
+	               temporary_filename,
+	               "w" );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open temporary checkpoint: %" PRIs_SYSTEM ".",
+		 function,
+		 temporary_filename );
+
+		goto on_error;
+	}
+	print_count = fprintf(
+	               file_stream,
+	               "# Checkpoint of tableauacquire\n"
+	               "version\t0x%x\n"
+	               "bridge_serial_number\t%s\n"
+	               "drive_serial_number\t%s\n"
+	               "drive_model\t%s\n"
+	               "media_size\t0x%08" PRIx64 "\n"
+	               "bytes_per_sector\t0x%" PRIx32 "\n"
+	               "digest_types\t0x%02" PRIx8 "\n"
+	               "segment_size\t0x%08" PRIx64 "\n",
+	               CHECKPOINT_VERSION,
+	               checkpoint->bridge_serial_number,
+	               checkpoint->drive_serial_number,
+	               checkpoint->drive_model,
+	               (uint64_t) checkpoint->media_size,
+	               checkpoint->bytes_per_sector,
+	               checkpoint->digest_types,
+	               (uint64_t) checkpoint->segment_size );
+
+	for( extent_index = 0;
+	     ( print_count >= 0 ) && ( extent_index < checkpoint->number_of_extents );
+	     extent_index++ )
+	{
+		print_count = fprintf(
+		               file_stream,
+		               "extent\t0x%08" PRIx64 "\t0x%08" PRIx64 "\n",
+		               (uint64_t) checkpoint->extent_offsets[ extent_index ],
+		               (uint64_t) checkpoint->extent_sizes[ extent_index ] );
+	}
+	if( print_count >= 0 )
+	{
+		print_count = fprintf(
+		               file_stream,
+		               "offset\t0x%08" PRIx64 "\n"
+		               "zero_blocks\t0x%" PRIx64 "\t0x%08" PRIx64 "\n",
+		               (uint64_t) checkpoint->offset,
+		               checkpoint->number_of_zero_blocks,
+		               (uint64_t) checkpoint->zero_blocks_size );
+	}
+	if( ( print_count >= 0 )
+	 && ( checkpoint->digest_state_is_set != 0 ) )
+	{
+		print_count = fprintf(
+		               file_stream,
+		               "digest_state\t" );
+
+		for( state_index = 0;
+		     ( print_count >= 0 ) && ( state_index < DIGEST_PIPELINE_STATE_SIZE );
+		     state_index++ )
+		{
+			print_count = fprintf(
+			               file_stream,
+			               "%02" PRIx8 "",
+			               checkpoint->digest_state[ state_index ] );
+		}
+		if( print_count >= 0 )
+		{
+			print_count = fprintf(
+			               file_stream,
+			               "\n" );
+		}
+	}
+	for( extent_index = 0;
+	     ( print_count >= 0 ) && ( extent_index < checkpoint->number_of_extents );
+	     extent_index++ )
+	{
+		if( checkpoint->extent_digest_state_is_set[ extent_index ] == 0 )
+		{
+			continue;
+		}
+		print_count = fprintf(
+		               file_stream,
+		               "extent_digest_state\t0x%x\t",
+		               extent_index );
+
+		for( state_index = 0;
+		     ( print_count >= 0 ) && ( state_index < DIGEST_PIPELINE_STATE_SIZE );
+		     state_index++ )
+		{
+			print_count = fprintf(
+			               file_stream,
+			               "%02" PRIx8 "",
+			               checkpoint->extent_digest_states[ extent_index ][ state_index ] );
+		}
+		if( print_count >= 0 )
+		{
+			print_count = fprintf(
+			               file_stream,
+			               "\n" );
+		}
+	}
+	if( print_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write temporary checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( fflush(
+	     file_stream ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to flush temporary checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_FSYNC )
+	if( fsync(
+	     fileno(
+	      file_stream ) ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to synchronize temporary checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close temporary checkpoint.",
+		 function );
+
+		file_stream = NULL;
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( _wrename(
+	     temporary_filename,
+	     filename ) != 0 )
+#else
+	if( rename(
+	     temporary_filename,
+	     filename ) != 0 )
+#endif
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to replace checkpoint: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	memory_free(
+	 temporary_filename );
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( temporary_filename != NULL )
+	{
+		memory_free(
+		 temporary_filename );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,142 @@
+/*
+ * Checkpoint of a resumable acquisition
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CHECKPOINT_H )
+#define _CHECKPOINT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "digest_pipeline.h"
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define CHECKPOINT_VERSION			1
+
+#define CHECKPOINT_MAXIMUM_NUMBER_OF_EXTENTS	6
+
+typedef struct checkpoint checkpoint_t;
+
+struct checkpoint
+{
+	/* The bridge serial number
+	 */
+	char bridge_serial_number[ 32 ];
+
+	/* The drive serial number
+	 */
+	char drive_serial_number[ 32 ];
+
+	/* The drive model
+	 */
+	char drive_model[ 64 ];
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The digest types
+	 */
+	uint8_t digest_types;
+
+	/* The size of an output segment file, 0 if the output is a single file
+	 */
+	size64_t segment_size;
+
+	/* The offsets of the extents
+	 */
+	off64_t extent_offsets[ CHECKPOINT_MAXIMUM_NUMBER_OF_EXTENTS ];
+
+	/* The sizes of the extents
+	 */
+	size64_t extent_sizes[ CHECKPOINT_MAXIMUM_NUMBER_OF_EXTENTS ];
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The offset up to which the media was acquired, hashed and written
+	 */
+	off64_t offset;
+
+	/* The number of zero blocks left as holes in the output
+	 */
+	uint64_t number_of_zero_blocks;
+
+	/* The number of bytes of the zero blocks
+	 */
+	size64_t zero_blocks_size;
+
+	/* The intermediate state of the digests of the entire acquisition
+	 */
+	uint8_t digest_state[ DIGEST_PIPELINE_STATE_SIZE ];
+
+	/* Value to indicate the digest state is set
+	 */
+	uint8_t digest_state_is_set;
+
+	/* The intermediate state of the digests of the extents
+	 */
+	uint8_t extent_digest_states[ CHECKPOINT_MAXIMUM_NUMBER_OF_EXTENTS ][ DIGEST_PIPELINE_STATE_SIZE ];
+
+	/* Values to indicate the digest state of an extent is set
+	 */
+	uint8_t extent_digest_state_is_set[ CHECKPOINT_MAXIMUM_NUMBER_OF_EXTENTS ];
+};
+
+int checkpoint_initialize(
+     checkpoint_t **checkpoint,
+     libcerror_error_t **error );
+
+int checkpoint_free(
+     checkpoint_t **checkpoint,
+     libcerror_error_t **error );
+
+int checkpoint_copy_state_from_string(
+     const char *string,
+     size_t string_length,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+int checkpoint_read(
+     checkpoint_t *checkpoint,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int checkpoint_write(
+     checkpoint_t *checkpoint,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CHECKPOINT_H ) */
+
@@ -0,0 +1,576 @@
+/*
+ * Compression of storage media data in chunks
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ZLIB )
+#include <zlib.h>
+#endif
+
+#include "chunk_compressor.h"
+#include "tableautools_libcerror.h"
+
+/* Creates a chunk compressor
+ * Make sure the value chunk_compressor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_compressor_initialize(
+     chunk_compressor_t **chunk_compressor,
+     size_t chunk_size,
+     size_t maximum_data_size,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	static char *function   = "chunk_compressor_initialize";
+
+#if defined( HAVE_ZLIB )
+	z_stream *stream        = NULL;
+	size_t number_of_chunks = 0;
+#endif
+
+	if( chunk_compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_compressor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk compressor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_data_size == 0 )
+	 || ( maximum_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_level < CHUNK_COMPRESSOR_LEVEL_FAST )
+	 || ( compression_level > CHUNK_COMPRESSOR_LEVEL_BEST ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_ZLIB )
+	*chunk_compressor = memory_allocate_structure(
+	                     chunk_compressor_t );
+
+	if( *chunk_compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk compressor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_compressor,
+	     0,
+	     sizeof( chunk_compressor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk compressor.",
+		 function );
+
+		memory_free(
+		 *chunk_compressor );
+
+		*chunk_compressor = NULL;
+
+		return( -1 );
+	}
+	number_of_chunks = maximum_data_size / chunk_size;
+
+	if( ( maximum_data_size % chunk_size ) != 0 )
+	{
+		number_of_chunks += 1;
+	}
+	/* A chunk that does not compress is stored uncompressed, hence the
+	 * compressed data never exceeds the data
+	 */
+	( *chunk_compressor )->compressed_data = (uint8_t *) memory_allocate(
+	                                                      sizeof( uint8_t ) * maximum_data_size );
+
+	if( ( *chunk_compressor )->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_compressor )->chunk_compressed_sizes = (uint32_t *) memory_allocate(
+	                                                              sizeof( uint32_t ) * number_of_chunks );
+
+	if( ( *chunk_compressor )->chunk_compressed_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk compressed sizes.",
+		 function );
+
+		goto on_error;
+	}
+	stream = memory_allocate_structure(
+	          z_stream );
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     stream,
+	     0,
+	     sizeof( z_stream ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream.",
+		 function );
+
+		memory_free(
+		 stream );
+
+		goto on_error;
+	}
+	if( deflateInit(
+	     stream,
+	     compression_level ) != Z_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize stream.",
+		 function );
+
+		memory_free(
+		 stream );
+
+		goto on_error;
+	}
+	( *chunk_compressor )->stream                   = (intptr_t *) stream;
+	( *chunk_compressor )->compression_level        = compression_level;
+	( *chunk_compressor )->chunk_size               = chunk_size;
+	( *chunk_compressor )->compressed_data_size     = maximum_data_size;
+	( *chunk_compressor )->maximum_number_of_chunks = (int) number_of_chunks;
+
+	return( 1 );
+
+on_error:
+	if( *chunk_compressor != NULL )
+	{
+		if( ( *chunk_compressor )->chunk_compressed_sizes != NULL )
+		{
+			memory_free(
+			 ( *chunk_compressor )->chunk_compressed_sizes );
+		}
+		if( ( *chunk_compressor )->compressed_data != NULL )
+		{
+			memory_free(
+			 ( *chunk_compressor )->compressed_data );
+		}
+		memory_free(
+		 *chunk_compressor );
+
+		*chunk_compressor = NULL;
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: missing zlib support.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_ZLIB ) */
+}
+
+/* Frees a chunk compressor
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_compressor_free(
+     chunk_compressor_t **chunk_compressor,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_compressor_free";
+
+	if( chunk_compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_compressor != NULL )
+	{
+#if defined( HAVE_ZLIB )
+		if( ( *chunk_compressor )->stream != NULL )
+		{
+			deflateEnd(
+			 (z_stream *) ( *chunk_compressor )->stream );
+
+			memory_free(
+			 ( *chunk_compressor )->stream );
+		}
+#endif
+		if( ( *chunk_compressor )->chunk_compressed_sizes != NULL )
+		{
+			memory_free(
+			 ( *chunk_compressor )->chunk_compressed_sizes );
+		}
+		if( ( *chunk_compressor )->compressed_data != NULL )
+		{
+			memory_free(
+			 ( *chunk_compressor )->compressed_data );
+		}
+		memory_free(
+		 *chunk_compressor );
+
+		*chunk_compressor = NULL;
+	}
+	return( 1 );
+}
+
+/* Compresses data in chunks
+ * The data is split in chunks of the chunk size, the last chunk can be smaller
+ * A chunk that does not become smaller by compression is stored uncompressed
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_compressor_compress(
+     chunk_compressor_t *chunk_compressor,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "chunk_compressor_compress";
+
+#if defined( HAVE_ZLIB )
+	z_stream *stream       = NULL;
+	size_t chunk_data_size = 0;
+	size_t compressed_size = 0;
+	size_t data_offset     = 0;
+	int chunk_index        = 0;
+	int result             = 0;
+#endif
+
+	if( chunk_compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > chunk_compressor->compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_ZLIB )
+	stream = (z_stream *) chunk_compressor->stream;
+
+	chunk_compressor->compressed_size  = 0;
+	chunk_compressor->number_of_chunks = 0;
+
+	while( data_offset < data_size )
+	{
+		chunk_data_size = chunk_compressor->chunk_size;
+
+		if( chunk_data_size > ( data_size - data_offset ) )
+		{
+			chunk_data_size = data_size - data_offset;
+		}
+		if( deflateReset(
+		     stream ) != Z_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset stream.",
+			 function );
+
+			return( -1 );
+		}
+		stream->next_in   = (Bytef *) &( data[ data_offset ] );
+		stream->avail_in  = (uInt) chunk_data_size;
+		stream->next_out  = (Bytef *) &( chunk_compressor->compressed_data[ chunk_compressor->compressed_size ] );
+		stream->avail_out = (uInt) ( chunk_data_size - 1 );
+
+		/* The output space is one byte less than the data, when it runs out
+		 * the chunk does not compress
+		 */
+		result = deflate(
+		          stream,
+		          Z_FINISH );
+
+		if( result == Z_STREAM_END )
+		{
+			compressed_size = ( chunk_data_size - 1 ) - (size_t) stream->avail_out;
+		}
+		else if( ( result == Z_OK )
+		      || ( result == Z_BUF_ERROR ) )
+		{
+			if( memory_copy(
+			     &( chunk_compressor->compressed_data[ chunk_compressor->compressed_size ] ),
+			     &( data[ data_offset ] ),
+			     chunk_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed chunk: %d.",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+			compressed_size = chunk_data_size;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		chunk_compressor->chunk_compressed_sizes[ chunk_index ] = (uint32_t) compressed_size;
+
+		chunk_compressor->compressed_size += compressed_size;
+		data_offset                       += chunk_data_size;
+		chunk_index                       += 1;
+	}
+	chunk_compressor->number_of_chunks = chunk_index;
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: missing zlib support.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_ZLIB ) */
+}
+
+/* Decompresses the data of a single chunk
+ * A chunk of which the compressed data size equals the data size is stored uncompressed
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_compressor_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "chunk_compressor_decompress";
+
+#if defined( HAVE_ZLIB )
+	uLongf uncompressed_size = 0;
+#endif
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size > data_size )
+	 || ( data_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == data_size )
+	{
+		if( memory_copy(
+		     data,
+		     compressed_data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed chunk.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#if defined( HAVE_ZLIB )
+	uncompressed_size = (uLongf) data_size;
+
+	if( uncompress(
+	     (Bytef *) data,
+	     &uncompressed_size,
+	     (const Bytef *) compressed_data,
+	     (uLong) compressed_data_size ) != Z_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) uncompressed_size != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: mismatch in decompressed chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: missing zlib support.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_ZLIB ) */
+}
+
@@ -0,0 +1,117 @@
+/*
+ * Compression of storage media data in chunks
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CHUNK_COMPRESSOR_H )
+#define _CHUNK_COMPRESSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a chunk, every chunk is compressed independently so that it
+ * can be decompressed without the preceding chunks
+ */
+#define CHUNK_COMPRESSOR_CHUNK_SIZE		( 64 * 1024 )
+
+enum CHUNK_COMPRESSOR_LEVELS
+{
+	CHUNK_COMPRESSOR_LEVEL_NONE		= 0,
+	CHUNK_COMPRESSOR_LEVEL_FAST		= 1,
+	CHUNK_COMPRESSOR_LEVEL_BEST		= 9
+};
+
+typedef struct chunk_compressor chunk_compressor_t;
+
+struct chunk_compressor
+{
+	/* The compression level
+	 */
+	int compression_level;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The zlib stream, which is reused for every chunk
+	 */
+	intptr_t *stream;
+
+	/* The compressed data of the chunks, stored consecutively
+	 */
+	uint8_t *compressed_data;
+
+	/* The size of the compressed data buffer
+	 */
+	size_t compressed_data_size;
+
+	/* The size of the compressed data of all chunks
+	 */
+	size_t compressed_size;
+
+	/* The compressed size of every chunk, a chunk of which the compressed
+	 * size equals its data size is stored uncompressed
+	 */
+	uint32_t *chunk_compressed_sizes;
+
+	/* The maximum number of chunks
+	 */
+	int maximum_number_of_chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+};
+
+int chunk_compressor_initialize(
+     chunk_compressor_t **chunk_compressor,
+     size_t chunk_size,
+     size_t maximum_data_size,
+     int compression_level,
+     libcerror_error_t **error );
+
+int chunk_compressor_free(
+     chunk_compressor_t **chunk_compressor,
+     libcerror_error_t **error );
+
+int chunk_compressor_compress(
+     chunk_compressor_t *chunk_compressor,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int chunk_compressor_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CHUNK_COMPRESSOR_H ) */
+
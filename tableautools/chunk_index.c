@@ -0,0 +1,991 @@
+/*
+ * Index of the chunks of a compressed output
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#include "chunk_index.h"
+#include "tableautools_libcerror.h"
+
+/* The signature of the index file
+ */
+const uint8_t chunk_index_signature[ 8 ] = { 't', 'b', 'l', 'c', 'h', 'i', 'd', 'x' };
+
+/* Creates a chunk index
+ * Make sure the value chunk_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_index_initialize(
+     chunk_index_t **chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_index_initialize";
+
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_index = memory_allocate_structure(
+	                chunk_index_t );
+
+	if( *chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *chunk_index,
+	     0,
+	     sizeof( chunk_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk index.",
+		 function );
+
+		memory_free(
+		 *chunk_index );
+
+		*chunk_index = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a chunk index
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_index_free(
+     chunk_index_t **chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_index_free";
+	int result            = 1;
+
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_index != NULL )
+	{
+		if( ( *chunk_index )->file_stream != NULL )
+		{
+			if( chunk_index_close(
+			     *chunk_index,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close chunk index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *chunk_index );
+
+		*chunk_index = NULL;
+	}
+	return( result );
+}
+
+/* Writes the header of the index file
+ * Returns 1 if successful or -1 on error
+ */
+static int chunk_index_write_header(
+            chunk_index_t *chunk_index,
+            libcerror_error_t **error )
+{
+	uint8_t header_data[ CHUNK_INDEX_HEADER_SIZE ];
+
+	static char *function = "chunk_index_write_header";
+
+	if( memory_copy(
+	     header_data,
+	     chunk_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( header_data[ 8 ] ),
+	 CHUNK_INDEX_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( header_data[ 12 ] ),
+	 chunk_index->chunk_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( header_data[ 16 ] ),
+	 chunk_index->media_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( header_data[ 24 ] ),
+	 chunk_index->number_of_chunks );
+
+	if( file_stream_seek_offset(
+	     chunk_index->file_stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to seek header offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream_write(
+	     chunk_index->file_stream,
+	     header_data,
+	     CHUNK_INDEX_HEADER_SIZE ) != CHUNK_INDEX_HEADER_SIZE )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to write header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates the index file and writes an incomplete header
+ * An existing index file is not overwritten
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_index_open_write(
+     chunk_index_t *chunk_index,
+     const system_character_t *filename,
+     uint32_t chunk_size,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_index_open_write";
+
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index->file_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk index - file stream already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index is read back by the verification hence it is opened for
+	 * reading as well
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	chunk_index->file_stream = file_stream_open_wide(
+	                            filename,
+	                            L"wb+x" );
+#else
+	chunk_index->file_stream = file_stream_open(
+	                            filename,
+	                            "wb+x" );
+#endif
+	if( chunk_index->file_stream == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to create chunk index: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	chunk_index->chunk_size        = chunk_size;
+	chunk_index->media_size        = 0;
+	chunk_index->number_of_chunks  = 0;
+	chunk_index->media_offset      = 0;
+	chunk_index->compressed_offset = 0;
+	chunk_index->is_complete       = 0;
+
+	if( chunk_index_write_header(
+	     chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 chunk_index->file_stream );
+
+	chunk_index->file_stream = NULL;
+
+	return( -1 );
+}
+
+/* Opens a complete index file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_index_open_read(
+     chunk_index_t *chunk_index,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ CHUNK_INDEX_HEADER_SIZE ];
+
+	static char *function = "chunk_index_open_read";
+	uint32_t version      = 0;
+
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index->file_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk index - file stream already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	chunk_index->file_stream = file_stream_open_wide(
+	                            filename,
+	                            L"rb" );
+#else
+	chunk_index->file_stream = file_stream_open(
+	                            filename,
+	                            FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( chunk_index->file_stream == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open chunk index: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	if( file_stream_read(
+	     chunk_index->file_stream,
+	     header_data,
+	     CHUNK_INDEX_HEADER_SIZE ) != CHUNK_INDEX_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     header_data,
+	     chunk_index_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: unsupported signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( header_data[ 8 ] ),
+	 version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( header_data[ 12 ] ),
+	 chunk_index->chunk_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( header_data[ 16 ] ),
+	 chunk_index->media_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( header_data[ 24 ] ),
+	 chunk_index->number_of_chunks );
+
+	if( version != CHUNK_INDEX_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported version: %" PRIu32 ".",
+		 function,
+		 version );
+
+		goto on_error;
+	}
+	if( chunk_index->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The number of chunks is only set when the index was completed
+	 */
+	if( ( chunk_index->media_size > 0 )
+	 && ( chunk_index->number_of_chunks == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: incomplete chunk index.",
+		 function );
+
+		goto on_error;
+	}
+	chunk_index->is_complete = 1;
+
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 chunk_index->file_stream );
+
+	chunk_index->file_stream = NULL;
+
+	return( -1 );
+}
+
+/* Closes the index file
+ * An index file that was not finalized remains incomplete
+ * Returns 0 if successful or -1 on error
+ */
+int chunk_index_close(
+     chunk_index_t *chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_index_close";
+
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index->file_stream == NULL )
+	{
+		return( 0 );
+	}
+	if( file_stream_close(
+	     chunk_index->file_stream ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close chunk index.",
+		 function );
+
+		chunk_index->file_stream = NULL;
+
+		return( -1 );
+	}
+	chunk_index->file_stream = NULL;
+	chunk_index->is_complete = 0;
+
+	return( 0 );
+}
+
+/* Writes the entry of a chunk
+ * Returns 1 if successful or -1 on error
+ */
+static int chunk_index_write_entry(
+            chunk_index_t *chunk_index,
+            off64_t media_offset,
+            off64_t compressed_offset,
+            libcerror_error_t **error )
+{
+	uint8_t entry_data[ CHUNK_INDEX_ENTRY_SIZE ];
+
+	static char *function = "chunk_index_write_entry";
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 0 ] ),
+	 (uint64_t) media_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 8 ] ),
+	 (uint64_t) compressed_offset );
+
+	if( file_stream_write(
+	     chunk_index->file_stream,
+	     entry_data,
+	     CHUNK_INDEX_ENTRY_SIZE ) != CHUNK_INDEX_ENTRY_SIZE )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to write entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the entry of the next chunk
+ * The chunks must be appended in order of their media offset
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_index_append_chunk(
+     chunk_index_t *chunk_index,
+     size_t data_size,
+     size_t compressed_size,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_index_append_chunk";
+
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index->file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk index - missing file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index->is_complete != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk index - index already complete.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) chunk_index->chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_size == 0 )
+	 || ( compressed_size > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index_write_entry(
+	     chunk_index,
+	     chunk_index->media_offset,
+	     chunk_index->compressed_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write entry of chunk: %" PRIu64 ".",
+		 function,
+		 chunk_index->number_of_chunks );
+
+		return( -1 );
+	}
+	chunk_index->media_offset      += (off64_t) data_size;
+	chunk_index->compressed_offset += (off64_t) compressed_size;
+	chunk_index->number_of_chunks  += 1;
+
+	return( 1 );
+}
+
+/* Completes the index file with the terminating entry and the header
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_index_finalize(
+     chunk_index_t *chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_index_finalize";
+
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index->file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk index - missing file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index->is_complete != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk index - index already complete.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index_write_entry(
+	     chunk_index,
+	     chunk_index->media_offset,
+	     chunk_index->compressed_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write terminating entry.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_index->media_size = (size64_t) chunk_index->media_offset;
+
+	if( chunk_index_write_header(
+	     chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		return( -1 );
+	}
+	if( fflush(
+	     chunk_index->file_stream ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to flush chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_index->is_complete = 1;
+
+	return( 1 );
+}
+
+/* Reads an entry
+ * Returns 1 if successful or -1 on error
+ */
+static int chunk_index_read_entry(
+            chunk_index_t *chunk_index,
+            uint64_t entry_index,
+            off64_t *media_offset,
+            off64_t *compressed_offset,
+            libcerror_error_t **error )
+{
+	uint8_t entry_data[ CHUNK_INDEX_ENTRY_SIZE ];
+
+	static char *function = "chunk_index_read_entry";
+	uint64_t value_64bit  = 0;
+
+	if( file_stream_seek_offset(
+	     chunk_index->file_stream,
+	     (off64_t) ( CHUNK_INDEX_HEADER_SIZE + ( entry_index * CHUNK_INDEX_ENTRY_SIZE ) ),
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to seek entry: %" PRIu64 ".",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( file_stream_read(
+	     chunk_index->file_stream,
+	     entry_data,
+	     CHUNK_INDEX_ENTRY_SIZE ) != CHUNK_INDEX_ENTRY_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entry: %" PRIu64 ".",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( entry_data[ 0 ] ),
+	 value_64bit );
+
+	*media_offset = (off64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( entry_data[ 8 ] ),
+	 value_64bit );
+
+	*compressed_offset = (off64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Retrieves the chunk that contains a specific media offset
+ * Only the chunks at the end of an extent are smaller than the chunk size,
+ * hence the chunk is found within a few entries after the entry of the offset
+ * divided by the chunk size
+ * Returns 1 if successful, 0 if the offset is beyond the media size or -1 on error
+ */
+int chunk_index_get_chunk_by_offset(
+     chunk_index_t *chunk_index,
+     off64_t offset,
+     off64_t *chunk_media_offset,
+     size_t *chunk_data_size,
+     off64_t *chunk_compressed_offset,
+     size_t *chunk_compressed_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "chunk_index_get_chunk_by_offset";
+	off64_t compressed_offset      = 0;
+	off64_t media_offset           = 0;
+	off64_t next_compressed_offset = 0;
+	off64_t next_media_offset      = 0;
+	uint64_t entry_index           = 0;
+
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_index->file_stream == NULL )
+	 || ( chunk_index->is_complete == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk index - index not complete.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_media_offset == NULL )
+	 || ( chunk_data_size == NULL )
+	 || ( chunk_compressed_offset == NULL )
+	 || ( chunk_compressed_size == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk value.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= chunk_index->media_size )
+	{
+		return( 0 );
+	}
+	entry_index = (uint64_t) offset / chunk_index->chunk_size;
+
+	if( entry_index >= chunk_index->number_of_chunks )
+	{
+		entry_index = chunk_index->number_of_chunks - 1;
+	}
+	while( 1 )
+	{
+		if( chunk_index_read_entry(
+		     chunk_index,
+		     entry_index,
+		     &media_offset,
+		     &compressed_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entry: %" PRIu64 ".",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( chunk_index_read_entry(
+		     chunk_index,
+		     entry_index + 1,
+		     &next_media_offset,
+		     &next_compressed_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entry: %" PRIu64 ".",
+			 function,
+			 entry_index + 1 );
+
+			return( -1 );
+		}
+		if( offset < media_offset )
+		{
+			if( entry_index == 0 )
+			{
+				break;
+			}
+			entry_index -= 1;
+		}
+		else if( offset >= next_media_offset )
+		{
+			if( ( entry_index + 1 ) >= chunk_index->number_of_chunks )
+			{
+				break;
+			}
+			entry_index += 1;
+		}
+		else
+		{
+			break;
+		}
+	}
+	if( ( offset < media_offset )
+	 || ( offset >= next_media_offset )
+	 || ( ( next_media_offset - media_offset ) > (off64_t) chunk_index->chunk_size )
+	 || ( next_compressed_offset <= compressed_offset )
+	 || ( ( next_compressed_offset - compressed_offset ) > ( next_media_offset - media_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry: %" PRIu64 " value out of bounds.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	*chunk_media_offset      = media_offset;
+	*chunk_data_size         = (size_t) ( next_media_offset - media_offset );
+	*chunk_compressed_offset = compressed_offset;
+	*chunk_compressed_size   = (size_t) ( next_compressed_offset - compressed_offset );
+
+	return( 1 );
+}
+
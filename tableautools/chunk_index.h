@@ -0,0 +1,140 @@
+/*
+ * Index of the chunks of a compressed output
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CHUNK_INDEX_H )
+#define _CHUNK_INDEX_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define CHUNK_INDEX_VERSION		1
+
+/* The index file consists of a header of 32 bytes followed by an entry of
+ * 16 bytes per chunk and a terminating entry, all values are little-endian
+ *
+ * header:
+ *   0  signature "tblchidx"
+ *   8  format version (32-bit)
+ *  12  chunk size (32-bit)
+ *  16  media size (64-bit)
+ *  24  number of chunks (64-bit), 0 while the index is incomplete
+ *
+ * entry:
+ *   0  media offset of the chunk (64-bit)
+ *   8  offset of the compressed chunk in the output (64-bit)
+ *
+ * The terminating entry contains the media size and the size of the output.
+ * A chunk is at most the chunk size and a chunk of which the compressed size
+ * equals its size is stored uncompressed
+ */
+#define CHUNK_INDEX_HEADER_SIZE		32
+#define CHUNK_INDEX_ENTRY_SIZE		16
+
+extern const uint8_t chunk_index_signature[ 8 ];
+
+typedef struct chunk_index chunk_index_t;
+
+struct chunk_index
+{
+	/* The file stream
+	 */
+	FILE *file_stream;
+
+	/* The chunk size
+	 */
+	uint32_t chunk_size;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of chunks
+	 */
+	uint64_t number_of_chunks;
+
+	/* The media offset of the next chunk, only used while writing
+	 */
+	off64_t media_offset;
+
+	/* The output offset of the next chunk, only used while writing
+	 */
+	off64_t compressed_offset;
+
+	/* Value to indicate the index is complete and can be read
+	 */
+	uint8_t is_complete;
+};
+
+int chunk_index_initialize(
+     chunk_index_t **chunk_index,
+     libcerror_error_t **error );
+
+int chunk_index_free(
+     chunk_index_t **chunk_index,
+     libcerror_error_t **error );
+
+int chunk_index_open_write(
+     chunk_index_t *chunk_index,
+     const system_character_t *filename,
+     uint32_t chunk_size,
+     libcerror_error_t **error );
+
+int chunk_index_open_read(
+     chunk_index_t *chunk_index,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int chunk_index_close(
+     chunk_index_t *chunk_index,
+     libcerror_error_t **error );
+
+int chunk_index_append_chunk(
+     chunk_index_t *chunk_index,
+     size_t data_size,
+     size_t compressed_size,
+     libcerror_error_t **error );
+
+int chunk_index_finalize(
+     chunk_index_t *chunk_index,
+     libcerror_error_t **error );
+
+int chunk_index_get_chunk_by_offset(
+     chunk_index_t *chunk_index,
+     off64_t offset,
+     off64_t *chunk_media_offset,
+     size_t *chunk_data_size,
+     off64_t *chunk_compressed_offset,
+     size_t *chunk_compressed_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CHUNK_INDEX_H ) */
+
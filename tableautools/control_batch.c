@@ -0,0 +1,1371 @@
+/*
+ * Batch control of multiple Tableau write blockers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "control_batch.h"
+#include "control_policy.h"
+#include "tableautools_device.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcthreads.h"
+#include "tableautools_libtableau.h"
+#include "tableautools_time.h"
+#include "tableautools_unused.h"
+
+#define CONTROL_BATCH_NOTIFY_STREAM	stdout
+
+/* Creates a batch
+ * Make sure the value control_batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int control_batch_initialize(
+     control_batch_t **control_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "control_batch_initialize";
+
+	if( control_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *control_batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*control_batch = memory_allocate_structure(
+	                  control_batch_t );
+
+	if( *control_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *control_batch,
+	     0,
+	     sizeof( control_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch.",
+		 function );
+
+		memory_free(
+		 *control_batch );
+
+		*control_batch = NULL;
+
+		return( -1 );
+	}
+	( *control_batch )->notify_stream = CONTROL_BATCH_NOTIFY_STREAM;
+	( *control_batch )->abort_flag    = &( ( *control_batch )->abort );
+
+	return( 1 );
+}
+
+/* Frees a device
+ * Returns 1 if successful or -1 on error
+ */
+static int control_batch_free_device(
+            control_batch_device_t **device,
+            libcerror_error_t **error )
+{
+	static char *function = "control_batch_free_device";
+	int result            = 1;
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device.",
+		 function );
+
+		return( -1 );
+	}
+	if( *device != NULL )
+	{
+		if( ( *device )->handle != NULL )
+		{
+			if( libtableau_handle_free(
+			     &( ( *device )->handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *device )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *device )->error ) );
+		}
+		if( ( *device )->source != NULL )
+		{
+			memory_free(
+			 ( *device )->source );
+		}
+		memory_free(
+		 *device );
+
+		*device = NULL;
+	}
+	return( result );
+}
+
+/* Frees a batch
+ * Returns 1 if successful or -1 on error
+ */
+int control_batch_free(
+     control_batch_t **control_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "control_batch_free";
+	int device_index      = 0;
+	int result            = 1;
+
+	if( control_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *control_batch != NULL )
+	{
+		for( device_index = 0;
+		     device_index < ( *control_batch )->number_of_devices;
+		     device_index++ )
+		{
+			if( control_batch_free_device(
+			     &( ( *control_batch )->devices[ device_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free device: %d.",
+				 function,
+				 device_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *control_batch );
+
+		*control_batch = NULL;
+	}
+	return( result );
+}
+
+/* Signals the batch to abort
+ * The handles of the devices share the abort flag of the batch, hence
+ * the function only sets the flag and can be called from a signal handler
+ * Returns 1 if successful or -1 on error
+ */
+int control_batch_signal_abort(
+     control_batch_t *control_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "control_batch_signal_abort";
+
+	if( control_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	*( control_batch->abort_flag ) = 1;
+
+	return( 1 );
+}
+
+/* Sets the flag that signals the batch to abort
+ * A signal handler of the caller only needs to set the flag to abort the batch
+ * If abort_flag is NULL the flag of the batch is used
+ * Returns 1 if successful or -1 on error
+ */
+int control_batch_set_abort_flag(
+     control_batch_t *control_batch,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error )
+{
+	static char *function = "control_batch_set_abort_flag";
+	int device_index      = 0;
+
+	if( control_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort_flag == NULL )
+	{
+		control_batch->abort_flag = &( control_batch->abort );
+	}
+	else
+	{
+		control_batch->abort_flag = abort_flag;
+	}
+	for( device_index = 0;
+	     device_index < control_batch->number_of_devices;
+	     device_index++ )
+	{
+		if( libtableau_handle_set_abort_flag(
+		     control_batch->devices[ device_index ]->handle,
+		     control_batch->abort_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set abort flag of handle of device: %d.",
+			 function,
+			 device_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a device
+ * A device that was discovered instead of specified does not need to be
+ * a Tableau write blocker, hence it is not considered failed if it cannot
+ * be queried
+ * Returns 1 if successful, 0 if the device was already appended or -1 on error
+ */
+int control_batch_append_device(
+     control_batch_t *control_batch,
+     const system_character_t *source,
+     size_t source_length,
+     uint8_t is_discovered,
+     libcerror_error_t **error )
+{
+	control_batch_device_t *device = NULL;
+	static char *function          = "control_batch_append_device";
+	int device_index               = 0;
+
+	if( control_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_length == 0 )
+	 || ( source_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A device that is both specified and discovered is processed once
+	 */
+	for( device_index = 0;
+	     device_index < control_batch->number_of_devices;
+	     device_index++ )
+	{
+		device = control_batch->devices[ device_index ];
+
+		if( ( system_string_length( device->source ) == source_length )
+		 && ( system_string_compare(
+		       device->source,
+		       source,
+		       source_length ) == 0 ) )
+		{
+			if( is_discovered == 0 )
+			{
+				device->is_discovered = 0;
+			}
+			return( 0 );
+		}
+	}
+	device = NULL;
+
+	if( control_batch->number_of_devices >= CONTROL_BATCH_MAXIMUM_NUMBER_OF_DEVICES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: number of devices exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	device = memory_allocate_structure(
+	          control_batch_device_t );
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create device.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     device,
+	     0,
+	     sizeof( control_batch_device_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear device.",
+		 function );
+
+		memory_free(
+		 device );
+
+		return( -1 );
+	}
+	device->source = system_string_allocate(
+	                  source_length + 1 );
+
+	if( device->source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     device->source,
+	     source,
+	     source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source.",
+		 function );
+
+		goto on_error;
+	}
+	device->source[ source_length ] = 0;
+
+	if( libtableau_handle_initialize(
+	     &( device->handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libtableau_handle_set_abort_flag(
+	     device->handle,
+	     control_batch->abort_flag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set abort flag of handle.",
+		 function );
+
+		goto on_error;
+	}
+	device->control_batch = control_batch;
+	device->is_discovered = is_discovered;
+
+	control_batch->devices[ control_batch->number_of_devices ] = device;
+
+	control_batch->number_of_devices += 1;
+
+	return( 1 );
+
+on_error:
+	if( device != NULL )
+	{
+		control_batch_free_device(
+		 &device,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a discovered device
+ * Callback function for tableautools_device_discover
+ * Returns 1 if successful or -1 on error
+ */
+static int control_batch_append_discovered_device(
+            intptr_t *control_batch,
+            const system_character_t *device_name,
+            size_t device_name_length,
+            libcerror_error_t **error )
+{
+	static char *function = "control_batch_append_discovered_device";
+
+	if( control_batch_append_device(
+	     (control_batch_t *) control_batch,
+	     device_name,
+	     device_name_length,
+	     1,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append device.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Discovers the SCSI generic devices
+ * Discovery is only supported on Linux, where every Tableau write blocker
+ * is accessible as a /dev/sg# device
+ * Returns 1 if successful or -1 on error
+ */
+int control_batch_discover_devices(
+     control_batch_t *control_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "control_batch_discover_devices";
+
+	if( control_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( tableautools_device_discover(
+	     &control_batch_append_discovered_device,
+	     (intptr_t *) control_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to discover devices.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the serial numbers and the number of HPA and DCO sectors
+ * of a queried device
+ * Returns 1 if successful or -1 on error
+ */
+static int control_batch_get_device_values(
+            control_batch_device_t *device,
+            libcerror_error_t **error )
+{
+	static char *function = "control_batch_get_device_values";
+	int result            = 0;
+
+	result = libtableau_handle_get_value_bridge_serial_number(
+	          device->handle,
+	          device->bridge_serial_number,
+	          CONTROL_BATCH_SERIAL_NUMBER_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bridge serial number.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		device->bridge_serial_number[ 0 ] = 0;
+	}
+	result = libtableau_handle_get_value_drive_serial_number(
+	          device->handle,
+	          device->drive_serial_number,
+	          CONTROL_BATCH_SERIAL_NUMBER_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve drive serial number.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		device->drive_serial_number[ 0 ] = 0;
+	}
+	result = libtableau_handle_get_hpa_number_of_sectors(
+	          device->handle,
+	          &( device->hpa_number_of_sectors ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of HPA sectors.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		device->hpa_number_of_sectors = 0;
+	}
+	result = libtableau_handle_get_dco_number_of_sectors(
+	          device->handle,
+	          &( device->dco_number_of_sectors ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of DCO sectors.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		device->dco_number_of_sectors = 0;
+	}
+	return( 1 );
+}
+
+/* Processes a device
+ * The device is queried and if the policy applies to it its DCO is removed,
+ * after which the device is queried again to verify the removal
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+static int control_batch_process_device(
+            control_batch_device_t *device,
+            libcerror_error_t **error )
+{
+	control_batch_t *control_batch = NULL;
+	static char *function          = "control_batch_process_device";
+	uint64_t end_time              = 0;
+	uint64_t start_time            = 0;
+	int handle_opened              = 0;
+	int result                     = 0;
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device.",
+		 function );
+
+		return( -1 );
+	}
+	control_batch = device->control_batch;
+
+	if( tableautools_time_get_monotonic_time(
+	     &start_time ) != 1 )
+	{
+		start_time = 0;
+	}
+	device->status = CONTROL_BATCH_STATUS_PENDING;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libtableau_handle_open_wide(
+	     device->handle,
+	     device->source,
+	     LIBTABLEAU_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libtableau_handle_open(
+	     device->handle,
+	     device->source,
+	     LIBTABLEAU_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open device: %" PRIs_SYSTEM ".",
+		 function,
+		 device->source );
+
+		goto on_error;
+	}
+	handle_opened = 1;
+
+	if( libtableau_handle_query(
+	     device->handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to query device.",
+		 function );
+
+		goto on_error;
+	}
+	device->status = CONTROL_BATCH_STATUS_QUERIED;
+
+	if( control_batch_get_device_values(
+	     device,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device values.",
+		 function );
+
+		goto on_error;
+	}
+	result = control_policy_matches_device(
+	          control_batch->control_policy,
+	          device->bridge_serial_number,
+	          device->drive_serial_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if policy applies to device.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		device->status = CONTROL_BATCH_STATUS_SKIPPED;
+	}
+	else
+	{
+		result = libtableau_handle_detected_dco(
+		          device->handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if DCO was detected.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			device->status = CONTROL_BATCH_STATUS_NO_DCO;
+		}
+		else if( *( control_batch->abort_flag ) != 0 )
+		{
+			goto on_error;
+		}
+		else
+		{
+			device->status = CONTROL_BATCH_STATUS_REMOVING;
+
+			result = libtableau_handle_remove_dco(
+			          device->handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to remove DCO.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				device->status = CONTROL_BATCH_STATUS_NO_DCO;
+			}
+			else
+			{
+				device->status = CONTROL_BATCH_STATUS_REMOVED;
+
+				if( libtableau_handle_query(
+				     device->handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to query device to verify DCO removal.",
+					 function );
+
+					goto on_error;
+				}
+				/* The drive can keep reporting the DCO until it is power cycled
+				 */
+				result = libtableau_handle_detected_dco(
+				          device->handle,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine if DCO was detected after removal.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					device->status = CONTROL_BATCH_STATUS_VERIFIED;
+				}
+			}
+		}
+	}
+	handle_opened = 0;
+
+	if( libtableau_handle_close(
+	     device->handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close device.",
+		 function );
+
+		goto on_error;
+	}
+	if( tableautools_time_get_monotonic_time(
+	     &end_time ) == 1 )
+	{
+		device->processing_time = ( end_time - start_time ) / 1000;
+	}
+	return( 1 );
+
+on_error:
+	if( handle_opened != 0 )
+	{
+		libtableau_handle_close(
+		 device->handle,
+		 NULL );
+	}
+	if( tableautools_time_get_monotonic_time(
+	     &end_time ) == 1 )
+	{
+		device->processing_time = ( end_time - start_time ) / 1000;
+	}
+	if( *( control_batch->abort_flag ) != 0 )
+	{
+		return( 0 );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+/* Callback function of the process thread pool
+ * The error of a failed device is kept with the device so that it is
+ * printed as part of the report instead of interleaved with other output
+ * Returns 1 if successful or -1 on error
+ */
+int control_batch_process_callback(
+     control_batch_device_t *device,
+     control_batch_t *control_batch )
+{
+	if( ( device == NULL )
+	 || ( control_batch == NULL ) )
+	{
+		return( -1 );
+	}
+	if( *( control_batch->abort_flag ) != 0 )
+	{
+		device->result = 0;
+
+		return( 1 );
+	}
+	device->result = control_batch_process_device(
+	                  device,
+	                  &( device->error ) );
+
+	/* The buffered debug output of the device is kept by the thread of
+	 * the pool, hence it is printed before the thread continues
+	 */
+	libtableau_notify_flush(
+	 NULL );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+/* Processes the devices as specified by the policy
+ * The devices are processed concurrently by a thread pool of at most
+ * CONTROL_BATCH_MAXIMUM_NUMBER_OF_THREADS threads. Without multi-threading
+ * support the devices are processed one after the other
+ * Returns 1 if all devices were processed, 0 if a device failed or was
+ * aborted or -1 on error
+ */
+int control_batch_run(
+     control_batch_t *control_batch,
+     control_policy_t *control_policy,
+     libcerror_error_t **error )
+{
+	control_batch_device_t *device                 = NULL;
+	static char *function                          = "control_batch_run";
+	uint64_t end_time                              = 0;
+	uint64_t start_time                            = 0;
+	int device_index                               = 0;
+	int result                                     = 0;
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *process_thread_pool = NULL;
+	int number_of_threads                          = 0;
+#endif
+
+	if( control_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( control_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( control_batch->number_of_devices == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch - missing devices.",
+		 function );
+
+		return( -1 );
+	}
+	control_batch->control_policy = control_policy;
+
+	if( tableautools_time_get_monotonic_time(
+	     &start_time ) != 1 )
+	{
+		start_time = 0;
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	number_of_threads = control_batch->number_of_devices;
+
+	if( number_of_threads > CONTROL_BATCH_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		number_of_threads = CONTROL_BATCH_MAXIMUM_NUMBER_OF_THREADS;
+	}
+	if( libcthreads_thread_pool_create(
+	     &process_thread_pool,
+	     NULL,
+	     number_of_threads,
+	     control_batch->number_of_devices,
+	     (int (*)(intptr_t *, void *)) &control_batch_process_callback,
+	     (void *) control_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( device_index = 0;
+	     device_index < control_batch->number_of_devices;
+	     device_index++ )
+	{
+		if( libcthreads_thread_pool_push(
+		     process_thread_pool,
+		     (intptr_t *) control_batch->devices[ device_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push device: %d onto process thread pool queue.",
+			 function,
+			 device_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_pool_join(
+	     &process_thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join process thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	for( device_index = 0;
+	     device_index < control_batch->number_of_devices;
+	     device_index++ )
+	{
+		device = control_batch->devices[ device_index ];
+
+		if( *( control_batch->abort_flag ) != 0 )
+		{
+			device->result = 0;
+
+			continue;
+		}
+		device->result = control_batch_process_device(
+		                  device,
+		                  &( device->error ) );
+	}
+#endif
+	if( tableautools_time_get_monotonic_time(
+	     &end_time ) == 1 )
+	{
+		control_batch->batch_time = ( end_time - start_time ) / 1000;
+	}
+	result = 1;
+
+	for( device_index = 0;
+	     device_index < control_batch->number_of_devices;
+	     device_index++ )
+	{
+		device = control_batch->devices[ device_index ];
+
+		/* A discovered device that could not be queried is not a failure
+		 */
+		if( ( device->is_discovered != 0 )
+		 && ( device->status == CONTROL_BATCH_STATUS_PENDING )
+		 && ( device->result == -1 ) )
+		{
+			continue;
+		}
+		if( device->result != 1 )
+		{
+			result = 0;
+		}
+	}
+	if( *( control_batch->abort_flag ) != 0 )
+	{
+		result = 0;
+	}
+	return( result );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+on_error:
+	if( process_thread_pool != NULL )
+	{
+		control_batch_signal_abort(
+		 control_batch,
+		 NULL );
+
+		libcthreads_thread_pool_join(
+		 &process_thread_pool,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Retrieves a description of the outcome of a device
+ * Returns a string
+ */
+static const char *control_batch_get_device_outcome(
+                    control_batch_device_t *device )
+{
+	if( device->result == 0 )
+	{
+		if( device->status == CONTROL_BATCH_STATUS_REMOVING )
+		{
+			return( "aborted while removing DCO, power cycle the drive before retrying" );
+		}
+		return( "aborted" );
+	}
+	else if( device->result != 1 )
+	{
+		switch( device->status )
+		{
+			case CONTROL_BATCH_STATUS_PENDING:
+				if( device->is_discovered != 0 )
+				{
+					return( "unable to query device, which might not be a Tableau write blocker" );
+				}
+				return( "unable to query device" );
+
+			case CONTROL_BATCH_STATUS_REMOVING:
+				return( "unable to remove DCO" );
+
+			case CONTROL_BATCH_STATUS_REMOVED:
+				return( "DCO removed, unable to verify the removal" );
+
+			default:
+				return( "unable to determine DCO" );
+		}
+	}
+	switch( device->status )
+	{
+		case CONTROL_BATCH_STATUS_SKIPPED:
+			return( "skipped, not covered by policy" );
+
+		case CONTROL_BATCH_STATUS_NO_DCO:
+			return( "no DCO detected" );
+
+		case CONTROL_BATCH_STATUS_REMOVED:
+			return( "DCO removed, power cycle the drive to verify the removal" );
+
+		case CONTROL_BATCH_STATUS_VERIFIED:
+			return( "DCO removed and verified" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
+/* Prints the report of a device
+ * Returns 1 if successful or -1 on error
+ */
+static int control_batch_device_fprint(
+            control_batch_t *control_batch,
+            control_batch_device_t *device,
+            libcerror_error_t **error )
+{
+	static char *function = "control_batch_device_fprint";
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 control_batch->notify_stream,
+	 "Device: %" PRIs_SYSTEM " (processed in %" PRIu64 ".%03" PRIu64 " ms)\n",
+	 device->source,
+	 device->processing_time / 1000,
+	 device->processing_time % 1000 );
+
+	if( device->status != CONTROL_BATCH_STATUS_PENDING )
+	{
+		fprintf(
+		 control_batch->notify_stream,
+		 "\tBridge serial number\t: %s\n",
+		 device->bridge_serial_number );
+
+		fprintf(
+		 control_batch->notify_stream,
+		 "\tDrive serial number\t: %s\n",
+		 device->drive_serial_number );
+
+		fprintf(
+		 control_batch->notify_stream,
+		 "\tHPA number of sectors\t: %" PRIu32 "\n",
+		 device->hpa_number_of_sectors );
+
+		fprintf(
+		 control_batch->notify_stream,
+		 "\tDCO number of sectors\t: %" PRIu32 "\n",
+		 device->dco_number_of_sectors );
+	}
+	fprintf(
+	 control_batch->notify_stream,
+	 "\tResult\t\t\t: %s\n",
+	 control_batch_get_device_outcome(
+	  device ) );
+
+	if( ( device->result == -1 )
+	 && ( device->error != NULL )
+	 && ( ( device->is_discovered == 0 )
+	  || ( device->status != CONTROL_BATCH_STATUS_PENDING )
+	  || ( control_batch->verbose != 0 ) ) )
+	{
+		libcerror_error_backtrace_fprint(
+		 device->error,
+		 control_batch->notify_stream );
+	}
+	fprintf(
+	 control_batch->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Prints the reports of the devices and a summary of the batch
+ * Returns 1 if successful or -1 on error
+ */
+int control_batch_fprint(
+     control_batch_t *control_batch,
+     libcerror_error_t **error )
+{
+	control_batch_device_t *device = NULL;
+	static char *function          = "control_batch_fprint";
+	int device_index               = 0;
+	int number_of_failed_devices   = 0;
+	int number_of_no_dco_devices   = 0;
+	int number_of_removed_devices  = 0;
+	int number_of_skipped_devices  = 0;
+	int number_of_verified_devices = 0;
+
+	if( control_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	for( device_index = 0;
+	     device_index < control_batch->number_of_devices;
+	     device_index++ )
+	{
+		device = control_batch->devices[ device_index ];
+
+		if( control_batch_device_fprint(
+		     control_batch,
+		     device,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print device: %d.",
+			 function,
+			 device_index );
+
+			return( -1 );
+		}
+		if( device->result != 1 )
+		{
+			number_of_failed_devices++;
+		}
+		else if( device->status == CONTROL_BATCH_STATUS_SKIPPED )
+		{
+			number_of_skipped_devices++;
+		}
+		else if( device->status == CONTROL_BATCH_STATUS_NO_DCO )
+		{
+			number_of_no_dco_devices++;
+		}
+		else
+		{
+			number_of_removed_devices++;
+
+			if( device->status == CONTROL_BATCH_STATUS_VERIFIED )
+			{
+				number_of_verified_devices++;
+			}
+		}
+	}
+	fprintf(
+	 control_batch->notify_stream,
+	 "Batch completed\n" );
+
+	fprintf(
+	 control_batch->notify_stream,
+	 "\tNumber of devices\t: %d\n",
+	 control_batch->number_of_devices );
+
+	fprintf(
+	 control_batch->notify_stream,
+	 "\tDCO removed\t\t: %d (%d verified)\n",
+	 number_of_removed_devices,
+	 number_of_verified_devices );
+
+	fprintf(
+	 control_batch->notify_stream,
+	 "\tNo DCO detected\t\t: %d\n",
+	 number_of_no_dco_devices );
+
+	fprintf(
+	 control_batch->notify_stream,
+	 "\tSkipped by policy\t: %d\n",
+	 number_of_skipped_devices );
+
+	fprintf(
+	 control_batch->notify_stream,
+	 "\tNot processed\t\t: %d\n",
+	 number_of_failed_devices );
+
+	fprintf(
+	 control_batch->notify_stream,
+	 "\tDuration\t\t: %" PRIu64 ".%03" PRIu64 " ms\n",
+	 control_batch->batch_time / 1000,
+	 control_batch->batch_time % 1000 );
+
+	if( number_of_removed_devices > number_of_verified_devices )
+	{
+		fprintf(
+		 control_batch->notify_stream,
+		 "\nPower cycle the drives to make sure the changes are detected.\n" );
+	}
+	fprintf(
+	 control_batch->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
@@ -0,0 +1,203 @@
+/*
+ * Batch control of multiple Tableau write blockers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CONTROL_BATCH_H )
+#define _CONTROL_BATCH_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include <signal.h>
+
+#include "control_policy.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcthreads.h"
+#include "tableautools_libtableau.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define CONTROL_BATCH_MAXIMUM_NUMBER_OF_DEVICES		256
+
+/* The maximum number of devices that are processed concurrently
+ */
+#define CONTROL_BATCH_MAXIMUM_NUMBER_OF_THREADS		32
+
+#define CONTROL_BATCH_SERIAL_NUMBER_SIZE		64
+
+/* The stage a device has reached
+ */
+enum CONTROL_BATCH_STATUSES
+{
+	CONTROL_BATCH_STATUS_PENDING		= 0,
+	CONTROL_BATCH_STATUS_QUERIED		= 1,
+	CONTROL_BATCH_STATUS_SKIPPED		= 2,
+	CONTROL_BATCH_STATUS_NO_DCO		= 3,
+	CONTROL_BATCH_STATUS_REMOVING		= 4,
+	CONTROL_BATCH_STATUS_REMOVED		= 5,
+	CONTROL_BATCH_STATUS_VERIFIED		= 6
+};
+
+typedef struct control_batch control_batch_t;
+
+typedef struct control_batch_device control_batch_device_t;
+
+struct control_batch_device
+{
+	/* The batch
+	 */
+	control_batch_t *control_batch;
+
+	/* The source device
+	 */
+	system_character_t *source;
+
+	/* Value to indicate the device was discovered instead of specified
+	 */
+	uint8_t is_discovered;
+
+	/* The libtableau handle
+	 */
+	libtableau_handle_t *handle;
+
+	/* The bridge serial number, an empty string if unknown
+	 */
+	char bridge_serial_number[ CONTROL_BATCH_SERIAL_NUMBER_SIZE ];
+
+	/* The drive serial number, an empty string if unknown
+	 */
+	char drive_serial_number[ CONTROL_BATCH_SERIAL_NUMBER_SIZE ];
+
+	/* The number of HPA sectors before the DCO was removed
+	 */
+	uint32_t hpa_number_of_sectors;
+
+	/* The number of DCO sectors before the DCO was removed
+	 */
+	uint32_t dco_number_of_sectors;
+
+	/* The status
+	 */
+	int status;
+
+	/* The duration of the processing in microseconds
+	 */
+	uint64_t processing_time;
+
+	/* The result, 1 if the processing succeeded, 0 if it was aborted
+	 * and -1 on error
+	 */
+	int result;
+
+	/* The error of a failed processing
+	 */
+	libcerror_error_t *error;
+};
+
+struct control_batch
+{
+	/* The devices
+	 */
+	control_batch_device_t *devices[ CONTROL_BATCH_MAXIMUM_NUMBER_OF_DEVICES ];
+
+	/* The number of devices
+	 */
+	int number_of_devices;
+
+	/* The policy
+	 */
+	control_policy_t *control_policy;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate the errors of the discovered devices should be printed
+	 */
+	uint8_t verbose;
+
+	/* The duration of the batch in microseconds
+	 */
+	uint64_t batch_time;
+
+	/* Value to indicate if abort was signalled
+	 */
+	volatile sig_atomic_t abort;
+
+	/* The flag that signals an abort, which references abort
+	 * unless a flag of the caller was set
+	 */
+	volatile sig_atomic_t *abort_flag;
+};
+
+int control_batch_initialize(
+     control_batch_t **control_batch,
+     libcerror_error_t **error );
+
+int control_batch_free(
+     control_batch_t **control_batch,
+     libcerror_error_t **error );
+
+int control_batch_signal_abort(
+     control_batch_t *control_batch,
+     libcerror_error_t **error );
+
+int control_batch_set_abort_flag(
+     control_batch_t *control_batch,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error );
+
+int control_batch_append_device(
+     control_batch_t *control_batch,
+     const system_character_t *source,
+     size_t source_length,
+     uint8_t is_discovered,
+     libcerror_error_t **error );
+
+int control_batch_discover_devices(
+     control_batch_t *control_batch,
+     libcerror_error_t **error );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+int control_batch_process_callback(
+     control_batch_device_t *device,
+     control_batch_t *control_batch );
+
+#endif
+
+int control_batch_run(
+     control_batch_t *control_batch,
+     control_policy_t *control_policy,
+     libcerror_error_t **error );
+
+int control_batch_fprint(
+     control_batch_t *control_batch,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CONTROL_BATCH_H ) */
+
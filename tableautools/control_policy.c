@@ -0,0 +1,1296 @@
+/*
+ * Signed policy for the batch control of Tableau write blockers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#include "control_policy.h"
+#include "sha256.h"
+#include "tableautools_libcerror.h"
+
+/* Creates a policy
+ * Make sure the value control_policy is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int control_policy_initialize(
+     control_policy_t **control_policy,
+     libcerror_error_t **error )
+{
+	static char *function = "control_policy_initialize";
+
+	if( control_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( *control_policy != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid policy value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*control_policy = memory_allocate_structure(
+	                   control_policy_t );
+
+	if( *control_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *control_policy,
+	     0,
+	     sizeof( control_policy_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear policy.",
+		 function );
+
+		memory_free(
+		 *control_policy );
+
+		*control_policy = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a policy
+ * The key is cleared before the policy is freed
+ * Returns 1 if successful or -1 on error
+ */
+int control_policy_free(
+     control_policy_t **control_policy,
+     libcerror_error_t **error )
+{
+	static char *function = "control_policy_free";
+
+	if( control_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( *control_policy != NULL )
+	{
+		memory_set(
+		 ( *control_policy )->key,
+		 0,
+		 CONTROL_POLICY_MAXIMUM_KEY_SIZE );
+
+		memory_free(
+		 *control_policy );
+
+		*control_policy = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the SHA-256 hash of a block followed by data
+ * Returns 1 if successful or -1 on error
+ */
+static int control_policy_calculate_block_hash(
+            const uint8_t *block,
+            const uint8_t *data,
+            size_t data_size,
+            uint8_t *hash,
+            libcerror_error_t **error )
+{
+	sha256_context_t *context = NULL;
+	static char *function     = "control_policy_calculate_block_hash";
+
+	if( sha256_context_initialize(
+	     &context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create SHA-256 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( block != NULL )
+	{
+		if( sha256_context_update(
+		     context,
+		     block,
+		     SHA256_BLOCK_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA-256 context with block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( data_size > 0 )
+	{
+		if( sha256_context_update(
+		     context,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA-256 context with data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( sha256_context_finalize(
+	     context,
+	     hash,
+	     SHA256_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize SHA-256 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( sha256_context_free(
+	     &context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free SHA-256 context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		sha256_context_free(
+		 &context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Calculates the HMAC-SHA256 of data as specified by RFC 2104
+ * Returns 1 if successful or -1 on error
+ */
+int control_policy_calculate_hmac(
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *hmac,
+     size_t hmac_size,
+     libcerror_error_t **error )
+{
+	uint8_t inner_hash[ SHA256_HASH_SIZE ];
+	uint8_t key_block[ SHA256_BLOCK_SIZE ];
+	uint8_t pad_block[ SHA256_BLOCK_SIZE ];
+
+	static char *function = "control_policy_calculate_hmac";
+	size_t block_index    = 0;
+	int result            = -1;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hmac == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HMAC.",
+		 function );
+
+		return( -1 );
+	}
+	if( hmac_size < SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid HMAC size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     key_block,
+	     0,
+	     SHA256_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key block.",
+		 function );
+
+		return( -1 );
+	}
+	/* A key that is larger than the block size is replaced by its hash
+	 */
+	if( key_size > SHA256_BLOCK_SIZE )
+	{
+		if( control_policy_calculate_block_hash(
+		     NULL,
+		     key,
+		     key_size,
+		     key_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate key hash.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( key_size > 0 )
+	{
+		if( memory_copy(
+		     key_block,
+		     key,
+		     key_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( block_index = 0;
+	     block_index < SHA256_BLOCK_SIZE;
+	     block_index++ )
+	{
+		pad_block[ block_index ] = key_block[ block_index ] ^ 0x36;
+	}
+	if( control_policy_calculate_block_hash(
+	     pad_block,
+	     data,
+	     data_size,
+	     inner_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate inner hash.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < SHA256_BLOCK_SIZE;
+	     block_index++ )
+	{
+		pad_block[ block_index ] = key_block[ block_index ] ^ 0x5c;
+	}
+	if( control_policy_calculate_block_hash(
+	     pad_block,
+	     inner_hash,
+	     SHA256_HASH_SIZE,
+	     hmac,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate outer hash.",
+		 function );
+
+		goto on_error;
+	}
+	result = 1;
+
+on_error:
+	memory_set(
+	 key_block,
+	 0,
+	 SHA256_BLOCK_SIZE );
+
+	memory_set(
+	 pad_block,
+	 0,
+	 SHA256_BLOCK_SIZE );
+
+	return( result );
+}
+
+/* Sets the key
+ * Returns 1 if successful or -1 on error
+ */
+int control_policy_set_key(
+     control_policy_t *control_policy,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	static char *function = "control_policy_set_key";
+
+	if( control_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size == 0 )
+	 || ( key_size > CONTROL_POLICY_MAXIMUM_KEY_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     control_policy->key,
+	     key,
+	     key_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
+
+		return( -1 );
+	}
+	control_policy->key_size = key_size;
+
+	return( 1 );
+}
+
+/* Reads the key from a file
+ * The trailing end-of-line characters are not part of the key
+ * Returns 1 if successful or -1 on error
+ */
+int control_policy_read_key_file(
+     control_policy_t *control_policy,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t key[ CONTROL_POLICY_MAXIMUM_KEY_SIZE + 1 ];
+
+	FILE *file_stream     = NULL;
+	static char *function = "control_policy_read_key_file";
+	size_t key_size       = 0;
+	int result            = -1;
+
+	if( control_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"rb" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open key file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	key_size = file_stream_read(
+	            file_stream,
+	            key,
+	            CONTROL_POLICY_MAXIMUM_KEY_SIZE + 1 );
+
+	while( ( key_size > 0 )
+	    && ( ( key[ key_size - 1 ] == (uint8_t) '\n' )
+	     ||  ( key[ key_size - 1 ] == (uint8_t) '\r' ) ) )
+	{
+		key_size--;
+	}
+	if( ( key_size == 0 )
+	 || ( key_size > CONTROL_POLICY_MAXIMUM_KEY_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key file: %" PRIs_SYSTEM " - key size value out of bounds.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( control_policy_set_key(
+	     control_policy,
+	     key,
+	     key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key.",
+		 function );
+
+		goto on_error;
+	}
+	result = 1;
+
+on_error:
+	memory_set(
+	 key,
+	 0,
+	 CONTROL_POLICY_MAXIMUM_KEY_SIZE + 1 );
+
+	file_stream_close(
+	 file_stream );
+
+	return( result );
+}
+
+/* Copies a base16 encoded signature to its binary form
+ * Returns 1 if successful or 0 if the signature is not valid base16
+ */
+static int control_policy_copy_signature(
+            const uint8_t *string,
+            size_t string_length,
+            uint8_t *signature )
+{
+	size_t string_index = 0;
+	uint8_t byte_value  = 0;
+	uint8_t nibble      = 0;
+
+	if( string_length != ( 2 * SHA256_HASH_SIZE ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] >= (uint8_t) '0' )
+		 && ( string[ string_index ] <= (uint8_t) '9' ) )
+		{
+			nibble = string[ string_index ] - (uint8_t) '0';
+		}
+		else if( ( string[ string_index ] >= (uint8_t) 'a' )
+		      && ( string[ string_index ] <= (uint8_t) 'f' ) )
+		{
+			nibble = string[ string_index ] - (uint8_t) 'a' + 10;
+		}
+		else if( ( string[ string_index ] >= (uint8_t) 'A' )
+		      && ( string[ string_index ] <= (uint8_t) 'F' ) )
+		{
+			nibble = string[ string_index ] - (uint8_t) 'A' + 10;
+		}
+		else
+		{
+			return( 0 );
+		}
+		byte_value = (uint8_t) ( ( byte_value << 4 ) | nibble );
+
+		if( ( string_index % 2 ) == 1 )
+		{
+			signature[ string_index / 2 ] = byte_value;
+
+			byte_value = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a serial number to a list of serial numbers
+ * Returns 1 if successful or -1 on error
+ */
+static int control_policy_append_serial_number(
+            char serial_numbers[][ CONTROL_POLICY_SERIAL_NUMBER_SIZE ],
+            int *number_of_serial_numbers,
+            const uint8_t *value,
+            size_t value_length,
+            int line_number,
+            libcerror_error_t **error )
+{
+	static char *function = "control_policy_append_serial_number";
+
+	if( ( value_length == 0 )
+	 || ( value_length >= CONTROL_POLICY_SERIAL_NUMBER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid serial number in line: %d value out of bounds.",
+		 function,
+		 line_number );
+
+		return( -1 );
+	}
+	if( *number_of_serial_numbers >= CONTROL_POLICY_MAXIMUM_NUMBER_OF_SERIAL_NUMBERS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: number of serial numbers in line: %d exceeds maximum.",
+		 function,
+		 line_number );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     serial_numbers[ *number_of_serial_numbers ],
+	     value,
+	     value_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy serial number.",
+		 function );
+
+		return( -1 );
+	}
+	serial_numbers[ *number_of_serial_numbers ][ value_length ] = 0;
+
+	*number_of_serial_numbers += 1;
+
+	return( 1 );
+}
+
+/* Reads the policy from data
+ * The signature is verified before the policy is parsed, so that none of
+ * the values of a policy that was not signed with the key are used
+ * Returns 1 if successful, 0 if the policy is not signed with the key or -1 on error
+ */
+int control_policy_read_data(
+     control_policy_t *control_policy,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t calculated_signature[ SHA256_HASH_SIZE ];
+	uint8_t stored_signature[ SHA256_HASH_SIZE ];
+
+	const uint8_t *line          = NULL;
+	const uint8_t *value         = NULL;
+	static char *function        = "control_policy_read_data";
+	size_t data_offset           = 0;
+	size_t line_end_offset       = 0;
+	size_t line_length           = 0;
+	size_t name_length           = 0;
+	size_t signature_offset      = 0;
+	size_t value_length          = 0;
+	uint8_t difference           = 0;
+	uint8_t has_signature        = 0;
+	int byte_index               = 0;
+	int line_number              = 0;
+	int result                   = 0;
+
+	if( control_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( control_policy->key_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid policy - missing key.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > CONTROL_POLICY_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	control_policy->action                          = CONTROL_POLICY_ACTION_NONE;
+	control_policy->number_of_bridge_serial_numbers = 0;
+	control_policy->number_of_drive_serial_numbers  = 0;
+
+	/* Locate the signature line, which must be the last line
+	 */
+	while( data_offset < data_size )
+	{
+		line            = &( data[ data_offset ] );
+		line_end_offset = data_offset;
+
+		while( ( line_end_offset < data_size )
+		    && ( data[ line_end_offset ] != (uint8_t) '\n' ) )
+		{
+			line_end_offset++;
+		}
+		line_length = line_end_offset - data_offset;
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (uint8_t) '\r' ) )
+		{
+			line_length--;
+		}
+		if( has_signature != 0 )
+		{
+			if( line_length > 0 )
+			{
+				return( 0 );
+			}
+		}
+		else if( ( line_length >= 10 )
+		      && ( memory_compare(
+		            line,
+		            "signature\t",
+		            10 ) == 0 ) )
+		{
+			if( control_policy_copy_signature(
+			     &( line[ 10 ] ),
+			     line_length - 10,
+			     stored_signature ) != 1 )
+			{
+				return( 0 );
+			}
+			signature_offset = data_offset;
+			has_signature    = 1;
+		}
+		data_offset = line_end_offset + 1;
+	}
+	if( has_signature == 0 )
+	{
+		return( 0 );
+	}
+	if( control_policy_calculate_hmac(
+	     control_policy->key,
+	     control_policy->key_size,
+	     data,
+	     signature_offset,
+	     calculated_signature,
+	     SHA256_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate signature.",
+		 function );
+
+		return( -1 );
+	}
+	/* The signatures are compared in constant time
+	 */
+	for( byte_index = 0;
+	     byte_index < SHA256_HASH_SIZE;
+	     byte_index++ )
+	{
+		difference |= calculated_signature[ byte_index ] ^ stored_signature[ byte_index ];
+	}
+	if( difference != 0 )
+	{
+		return( 0 );
+	}
+	data_offset = 0;
+
+	while( data_offset < signature_offset )
+	{
+		line_number++;
+
+		line            = &( data[ data_offset ] );
+		line_end_offset = data_offset;
+
+		while( ( line_end_offset < signature_offset )
+		    && ( data[ line_end_offset ] != (uint8_t) '\n' ) )
+		{
+			line_end_offset++;
+		}
+		line_length = line_end_offset - data_offset;
+		data_offset = line_end_offset + 1;
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (uint8_t) '\r' ) )
+		{
+			line_length--;
+		}
+		/* Ignore empty lines and comments
+		 */
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == (uint8_t) '#' ) )
+		{
+			continue;
+		}
+		for( name_length = 0;
+		     name_length < line_length;
+		     name_length++ )
+		{
+			if( line[ name_length ] == (uint8_t) '\t' )
+			{
+				break;
+			}
+		}
+		if( name_length >= line_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value in line: %d.",
+			 function,
+			 line_number );
+
+			return( -1 );
+		}
+		value        = &( line[ name_length + 1 ] );
+		value_length = line_length - name_length - 1;
+
+		if( ( name_length == 6 )
+		 && ( memory_compare(
+		       line,
+		       "action",
+		       6 ) == 0 ) )
+		{
+			if( control_policy->action != CONTROL_POLICY_ACTION_NONE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+				 "%s: action in line: %d already set.",
+				 function,
+				 line_number );
+
+				return( -1 );
+			}
+			if( ( value_length == 10 )
+			 && ( memory_compare(
+			       value,
+			       "remove_dco",
+			       10 ) == 0 ) )
+			{
+				control_policy->action = CONTROL_POLICY_ACTION_REMOVE_DCO;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported action in line: %d.",
+				 function,
+				 line_number );
+
+				return( -1 );
+			}
+		}
+		else if( ( name_length == 20 )
+		      && ( memory_compare(
+		            line,
+		            "bridge_serial_number",
+		            20 ) == 0 ) )
+		{
+			result = control_policy_append_serial_number(
+			          control_policy->bridge_serial_numbers,
+			          &( control_policy->number_of_bridge_serial_numbers ),
+			          value,
+			          value_length,
+			          line_number,
+			          error );
+		}
+		else if( ( name_length == 19 )
+		      && ( memory_compare(
+		            line,
+		            "drive_serial_number",
+		            19 ) == 0 ) )
+		{
+			result = control_policy_append_serial_number(
+			          control_policy->drive_serial_numbers,
+			          &( control_policy->number_of_drive_serial_numbers ),
+			          value,
+			          value_length,
+			          line_number,
+			          error );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported name in line: %d.",
+			 function,
+			 line_number );
+
+			return( -1 );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append serial number in line: %d.",
+			 function,
+			 line_number );
+
+			return( -1 );
+		}
+	}
+	if( control_policy->action == CONTROL_POLICY_ACTION_NONE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing action.",
+		 function );
+
+		return( -1 );
+	}
+	/* A policy applies to explicitly listed devices, or to any device
+	 * if a serial number of "*" is listed
+	 */
+	if( ( control_policy->number_of_bridge_serial_numbers == 0 )
+	 && ( control_policy->number_of_drive_serial_numbers == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing serial numbers.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the policy from a file
+ * Returns 1 if successful, 0 if the policy is not signed with the key or -1 on error
+ */
+int control_policy_read_file(
+     control_policy_t *control_policy,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	uint8_t *data         = NULL;
+	static char *function = "control_policy_read_file";
+	size_t data_size      = 0;
+	int result            = 0;
+
+	if( control_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ( CONTROL_POLICY_MAXIMUM_DATA_SIZE + 1 ) );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"rb" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open policy file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* One additional byte is read to detect a policy file that is too large
+	 */
+	data_size = file_stream_read(
+	             file_stream,
+	             data,
+	             CONTROL_POLICY_MAXIMUM_DATA_SIZE + 1 );
+
+	if( data_size > CONTROL_POLICY_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid policy file: %" PRIs_SYSTEM " - size value exceeds maximum.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	file_stream_close(
+	 file_stream );
+
+	file_stream = NULL;
+
+	result = control_policy_read_data(
+	          control_policy,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read policy file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( result );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Determines if a serial number is in a list of serial numbers
+ * Returns 1 if the serial number is in the list or 0 if not
+ */
+static int control_policy_serial_number_in_list(
+            char serial_numbers[][ CONTROL_POLICY_SERIAL_NUMBER_SIZE ],
+            int number_of_serial_numbers,
+            const char *serial_number )
+{
+	size_t serial_number_length = 0;
+	int serial_number_index     = 0;
+
+	serial_number_length = narrow_string_length(
+	                        serial_number );
+
+	for( serial_number_index = 0;
+	     serial_number_index < number_of_serial_numbers;
+	     serial_number_index++ )
+	{
+		if( ( serial_numbers[ serial_number_index ][ 0 ] == '*' )
+		 && ( serial_numbers[ serial_number_index ][ 1 ] == 0 ) )
+		{
+			return( 1 );
+		}
+		if( ( serial_number_length > 0 )
+		 && ( narrow_string_length( serial_numbers[ serial_number_index ] ) == serial_number_length )
+		 && ( narrow_string_compare(
+		       serial_numbers[ serial_number_index ],
+		       serial_number,
+		       serial_number_length ) == 0 ) )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines if the policy applies to a device
+ * The serial numbers of a device must be in every list of serial numbers
+ * of the policy that is not empty
+ * Returns 1 if the policy applies, 0 if not or -1 on error
+ */
+int control_policy_matches_device(
+     control_policy_t *control_policy,
+     const char *bridge_serial_number,
+     const char *drive_serial_number,
+     libcerror_error_t **error )
+{
+	static char *function = "control_policy_matches_device";
+
+	if( control_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( bridge_serial_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bridge serial number.",
+		 function );
+
+		return( -1 );
+	}
+	if( drive_serial_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid drive serial number.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( control_policy->number_of_bridge_serial_numbers == 0 )
+	 && ( control_policy->number_of_drive_serial_numbers == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( control_policy->number_of_bridge_serial_numbers > 0 )
+	 && ( control_policy_serial_number_in_list(
+	       control_policy->bridge_serial_numbers,
+	       control_policy->number_of_bridge_serial_numbers,
+	       bridge_serial_number ) == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( control_policy->number_of_drive_serial_numbers > 0 )
+	 && ( control_policy_serial_number_in_list(
+	       control_policy->drive_serial_numbers,
+	       control_policy->number_of_drive_serial_numbers,
+	       drive_serial_number ) == 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,140 @@
+/*
+ * Signed policy for the batch control of Tableau write blockers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CONTROL_POLICY_H )
+#define _CONTROL_POLICY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "sha256.h"
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a policy file
+ */
+#define CONTROL_POLICY_MAXIMUM_DATA_SIZE			65536
+
+/* The maximum size of a policy key
+ */
+#define CONTROL_POLICY_MAXIMUM_KEY_SIZE				256
+
+#define CONTROL_POLICY_MAXIMUM_NUMBER_OF_SERIAL_NUMBERS		256
+
+#define CONTROL_POLICY_SERIAL_NUMBER_SIZE			64
+
+enum CONTROL_POLICY_ACTIONS
+{
+	CONTROL_POLICY_ACTION_NONE		= 0,
+	CONTROL_POLICY_ACTION_REMOVE_DCO	= 1
+};
+
+typedef struct control_policy control_policy_t;
+
+/* A policy consists of tab separated name and value lines, of which the last
+ * one is the signature: the HMAC-SHA256 of all the preceding data, keyed with
+ * the policy key
+ */
+struct control_policy
+{
+	/* The key
+	 */
+	uint8_t key[ CONTROL_POLICY_MAXIMUM_KEY_SIZE ];
+
+	/* The size of the key
+	 */
+	size_t key_size;
+
+	/* The action
+	 */
+	int action;
+
+	/* The bridge serial numbers the action applies to
+	 */
+	char bridge_serial_numbers[ CONTROL_POLICY_MAXIMUM_NUMBER_OF_SERIAL_NUMBERS ][ CONTROL_POLICY_SERIAL_NUMBER_SIZE ];
+
+	/* The number of bridge serial numbers
+	 */
+	int number_of_bridge_serial_numbers;
+
+	/* The drive serial numbers the action applies to
+	 */
+	char drive_serial_numbers[ CONTROL_POLICY_MAXIMUM_NUMBER_OF_SERIAL_NUMBERS ][ CONTROL_POLICY_SERIAL_NUMBER_SIZE ];
+
+	/* The number of drive serial numbers
+	 */
+	int number_of_drive_serial_numbers;
+};
+
+int control_policy_initialize(
+     control_policy_t **control_policy,
+     libcerror_error_t **error );
+
+int control_policy_free(
+     control_policy_t **control_policy,
+     libcerror_error_t **error );
+
+int control_policy_calculate_hmac(
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *hmac,
+     size_t hmac_size,
+     libcerror_error_t **error );
+
+int control_policy_set_key(
+     control_policy_t *control_policy,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+int control_policy_read_key_file(
+     control_policy_t *control_policy,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int control_policy_read_data(
+     control_policy_t *control_policy,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int control_policy_read_file(
+     control_policy_t *control_policy,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int control_policy_matches_device(
+     control_policy_t *control_policy,
+     const char *bridge_serial_number,
+     const char *drive_serial_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CONTROL_POLICY_H ) */
+
@@ -0,0 +1,1311 @@
+/*
+ * Unix domain socket server of the Tableau daemon
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "daemon_server.h"
+
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+#include "daemon_state.h"
+#include "info_record.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcthreads.h"
+#include "tableautools_time.h"
+
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET ) && defined( MSG_NOSIGNAL )
+#define DAEMON_SERVER_SEND_FLAGS	MSG_NOSIGNAL
+#else
+#define DAEMON_SERVER_SEND_FLAGS	0
+#endif
+
+/* Creates a daemon server
+ * Make sure the value daemon_server is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_server_initialize(
+     daemon_server_t **daemon_server,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_server_initialize";
+
+	if( daemon_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon server.",
+		 function );
+
+		return( -1 );
+	}
+	if( *daemon_server != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid daemon server value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*daemon_server = memory_allocate_structure(
+	                  daemon_server_t );
+
+	if( *daemon_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create daemon server.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *daemon_server,
+	     0,
+	     sizeof( daemon_server_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear daemon server.",
+		 function );
+
+		memory_free(
+		 *daemon_server );
+
+		*daemon_server = NULL;
+
+		return( -1 );
+	}
+	( *daemon_server )->socket_descriptor = -1;
+
+	return( 1 );
+}
+
+/* Frees a daemon server
+ * The socket is closed if it is still open
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_server_free(
+     daemon_server_t **daemon_server,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_server_free";
+	int result            = 1;
+
+	if( daemon_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon server.",
+		 function );
+
+		return( -1 );
+	}
+	if( *daemon_server != NULL )
+	{
+		if( ( *daemon_server )->socket_descriptor != -1 )
+		{
+			if( daemon_server_close(
+			     *daemon_server,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close daemon server.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *daemon_server );
+
+		*daemon_server = NULL;
+	}
+	return( result );
+}
+
+/* Signals the daemon server to abort
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_server_signal_abort(
+     daemon_server_t *daemon_server,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_server_signal_abort";
+
+	if( daemon_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon server.",
+		 function );
+
+		return( -1 );
+	}
+	daemon_server->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens the daemon server
+ * A stale socket left behind by a previous instance is removed, any other
+ * type of file at the socket path is left untouched
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_server_open(
+     daemon_server_t *daemon_server,
+     const system_character_t *socket_path,
+     libcerror_error_t **error )
+{
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+	struct sockaddr_un socket_address;
+	struct stat file_statistics;
+
+	size_t socket_path_length = 0;
+	int socket_descriptor     = -1;
+#endif
+	static char *function     = "daemon_server_open";
+
+	if( daemon_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon server.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_server->socket_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid daemon server - socket descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( socket_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+	socket_path_length = narrow_string_length(
+	                      socket_path );
+
+	if( ( socket_path_length == 0 )
+	 || ( socket_path_length >= DAEMON_SERVER_SOCKET_PATH_SIZE )
+	 || ( socket_path_length >= sizeof( socket_address.sun_path ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid socket path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( lstat(
+	     socket_path,
+	     &file_statistics ) == 0 )
+	{
+		if( !S_ISSOCK( file_statistics.st_mode ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_INVALID_RESOURCE,
+			 "%s: unsupported file at socket path: %s.",
+			 function,
+			 socket_path );
+
+			return( -1 );
+		}
+		if( unlink(
+		     socket_path ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 errno,
+			 "%s: unable to remove stale socket: %s.",
+			 function,
+			 socket_path );
+
+			return( -1 );
+		}
+	}
+	if( memory_set(
+	     &socket_address,
+	     0,
+	     sizeof( struct sockaddr_un ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear socket address.",
+		 function );
+
+		return( -1 );
+	}
+	socket_address.sun_family = AF_UNIX;
+
+	memory_copy(
+	 socket_address.sun_path,
+	 socket_path,
+	 socket_path_length );
+
+	socket_descriptor = socket(
+	                     AF_UNIX,
+	                     SOCK_STREAM,
+	                     0 );
+
+	if( socket_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to create socket.",
+		 function );
+
+		return( -1 );
+	}
+	if( bind(
+	     socket_descriptor,
+	     (struct sockaddr *) &socket_address,
+	     sizeof( struct sockaddr_un ) ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to bind socket: %s.",
+		 function,
+		 socket_path );
+
+		close(
+		 socket_descriptor );
+
+		return( -1 );
+	}
+	if( listen(
+	     socket_descriptor,
+	     SOMAXCONN ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to listen on socket: %s.",
+		 function,
+		 socket_path );
+
+		close(
+		 socket_descriptor );
+
+		unlink(
+		 socket_path );
+
+		return( -1 );
+	}
+	memory_copy(
+	 daemon_server->socket_path,
+	 socket_path,
+	 socket_path_length );
+
+	daemon_server->socket_path[ socket_path_length ] = 0;
+
+	daemon_server->socket_descriptor = socket_descriptor;
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing Unix domain socket support.",
+	 function );
+
+	return( -1 );
+
+#endif /* defined( DAEMON_SERVER_HAVE_UNIX_SOCKET ) */
+}
+
+/* Closes the daemon server
+ * The socket is removed from the file system
+ * Returns 0 if successful or -1 on error
+ */
+int daemon_server_close(
+     daemon_server_t *daemon_server,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_server_close";
+	int result            = 0;
+
+	if( daemon_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon server.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_server->socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid daemon server - missing socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+	if( close(
+	     daemon_server->socket_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close socket.",
+		 function );
+
+		result = -1;
+	}
+	if( unlink(
+	     daemon_server->socket_path ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 errno,
+		 "%s: unable to remove socket: %s.",
+		 function,
+		 daemon_server->socket_path );
+
+		result = -1;
+	}
+#endif
+	daemon_server->socket_descriptor = -1;
+
+	return( result );
+}
+
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+
+/* Reads a request line from a client
+ * The client has DAEMON_SERVER_CLIENT_TIMEOUT milliseconds to send
+ * the entire line
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_server_read_request(
+            int client_descriptor,
+            char *request,
+            size_t request_size,
+            libcerror_error_t **error )
+{
+	struct pollfd poll_descriptor;
+
+	static char *function = "daemon_server_read_request";
+	size_t request_offset = 0;
+	ssize_t read_count    = 0;
+	uint64_t current_time = 0;
+	uint64_t end_time     = 0;
+	int result            = 0;
+
+	tableautools_time_get_monotonic_time(
+	 &end_time );
+
+	end_time = ( end_time / 1000000 ) + DAEMON_SERVER_CLIENT_TIMEOUT;
+
+	while( request_offset < ( request_size - 1 ) )
+	{
+		tableautools_time_get_monotonic_time(
+		 &current_time );
+
+		current_time /= 1000000;
+
+		if( current_time >= end_time )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: timeout reading request.",
+			 function );
+
+			return( -1 );
+		}
+		poll_descriptor.fd      = client_descriptor;
+		poll_descriptor.events  = POLLIN;
+		poll_descriptor.revents = 0;
+
+		result = poll(
+		          &poll_descriptor,
+		          1,
+		          (int) ( end_time - current_time ) );
+
+		if( result == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to poll client.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		read_count = recv(
+		              client_descriptor,
+		              &( request[ request_offset ] ),
+		              request_size - 1 - request_offset,
+		              0 );
+
+		if( read_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read request.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		request_offset += (size_t) read_count;
+
+		request[ request_offset ] = 0;
+
+		if( narrow_string_search_character(
+		     request,
+		     '\n',
+		     request_offset ) != NULL )
+		{
+			break;
+		}
+	}
+	request[ request_offset ] = 0;
+
+	return( 1 );
+}
+
+/* Writes the data in the output buffer to a client
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_server_flush(
+            daemon_server_t *daemon_server,
+            int client_descriptor,
+            libcerror_error_t **error )
+{
+	static char *function = "daemon_server_flush";
+	size_t buffer_offset  = 0;
+	ssize_t write_count   = 0;
+
+	while( buffer_offset < daemon_server->output_buffer_size )
+	{
+		write_count = send(
+		               client_descriptor,
+		               &( daemon_server->output_buffer[ buffer_offset ] ),
+		               daemon_server->output_buffer_size - buffer_offset,
+		               DAEMON_SERVER_SEND_FLAGS );
+
+		if( write_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 errno,
+			 "%s: unable to write response.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset += (size_t) write_count;
+	}
+	daemon_server->output_buffer_size = 0;
+
+	return( 1 );
+}
+
+/* Writes data to a client
+ * The data is buffered and written when the output buffer is full
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_server_write(
+            daemon_server_t *daemon_server,
+            int client_descriptor,
+            const uint8_t *data,
+            size_t data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "daemon_server_write";
+	size_t copy_size      = 0;
+
+	while( data_size > 0 )
+	{
+		if( daemon_server->output_buffer_size >= DAEMON_SERVER_OUTPUT_BUFFER_SIZE )
+		{
+			if( daemon_server_flush(
+			     daemon_server,
+			     client_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush output buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		copy_size = DAEMON_SERVER_OUTPUT_BUFFER_SIZE - daemon_server->output_buffer_size;
+
+		if( copy_size > data_size )
+		{
+			copy_size = data_size;
+		}
+		memory_copy(
+		 &( daemon_server->output_buffer[ daemon_server->output_buffer_size ] ),
+		 data,
+		 copy_size );
+
+		daemon_server->output_buffer_size += copy_size;
+
+		data      += copy_size;
+		data_size -= copy_size;
+	}
+	return( 1 );
+}
+
+/* Writes metrics data to a client
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_server_write_metrics_data(
+            const uint8_t *data,
+            size_t data_size,
+            daemon_server_client_t *client,
+            libcerror_error_t **error )
+{
+	static char *function = "daemon_server_write_metrics_data";
+
+	if( daemon_server_write(
+	     client->daemon_server,
+	     client->client_descriptor,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metrics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the response to a request to a client
+ * Returns 1 if successful, 0 if the request is not supported or -1 on error
+ */
+static int daemon_server_write_response(
+            daemon_server_t *daemon_server,
+            daemon_state_t *daemon_state,
+            int client_descriptor,
+            const char *request,
+            libcerror_error_t **error )
+{
+	uint8_t header[ DAEMON_SERVER_BINARY_HEADER_SIZE ];
+
+	daemon_server_client_t client;
+
+	daemon_state_device_t *device = NULL;
+	static char *function         = "daemon_server_write_response";
+	size_t request_length         = 0;
+	uint32_t number_of_records    = 0;
+	int device_index              = 0;
+	int result                    = 0;
+
+	request_length = narrow_string_length(
+	                  request );
+
+	while( ( request_length > 0 )
+	    && ( ( request[ request_length - 1 ] == '\n' )
+	     ||  ( request[ request_length - 1 ] == '\r' ) ) )
+	{
+		request_length--;
+	}
+	daemon_server->output_buffer_size = 0;
+
+	if( ( request_length == 4 )
+	 && ( narrow_string_compare(
+	       request,
+	       "json",
+	       4 ) == 0 ) )
+	{
+		for( device_index = 0;
+		     device_index < daemon_state->number_of_devices;
+		     device_index++ )
+		{
+			device = daemon_state->devices[ device_index ];
+
+			if( device->status == DAEMON_STATE_STATUS_UNSUPPORTED )
+			{
+				continue;
+			}
+			if( daemon_server_write(
+			     daemon_server,
+			     client_descriptor,
+			     (uint8_t *) device->json_record.data,
+			     device->json_record.data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write record of device: %d.",
+				 function,
+				 device_index );
+
+				return( -1 );
+			}
+		}
+		result = 1;
+	}
+	else if( ( request_length == 6 )
+	      && ( narrow_string_compare(
+	            request,
+	            "binary",
+	            6 ) == 0 ) )
+	{
+		for( device_index = 0;
+		     device_index < daemon_state->number_of_devices;
+		     device_index++ )
+		{
+			if( daemon_state->devices[ device_index ]->status != DAEMON_STATE_STATUS_UNSUPPORTED )
+			{
+				number_of_records++;
+			}
+		}
+		memory_copy(
+		 header,
+		 DAEMON_SERVER_BINARY_SIGNATURE,
+		 8 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( header[ 8 ] ),
+		 DAEMON_SERVER_BINARY_VERSION );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( header[ 12 ] ),
+		 number_of_records );
+
+		if( daemon_server_write(
+		     daemon_server,
+		     client_descriptor,
+		     header,
+		     DAEMON_SERVER_BINARY_HEADER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write header.",
+			 function );
+
+			return( -1 );
+		}
+		for( device_index = 0;
+		     device_index < daemon_state->number_of_devices;
+		     device_index++ )
+		{
+			device = daemon_state->devices[ device_index ];
+
+			if( device->status == DAEMON_STATE_STATUS_UNSUPPORTED )
+			{
+				continue;
+			}
+			if( daemon_server_write(
+			     daemon_server,
+			     client_descriptor,
+			     device->binary_record,
+			     DAEMON_STATE_BINARY_RECORD_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write record of device: %d.",
+				 function,
+				 device_index );
+
+				return( -1 );
+			}
+		}
+		result = 1;
+	}
+	else if( ( request_length == 7 )
+	      && ( narrow_string_compare(
+	            request,
+	            "metrics",
+	            7 ) == 0 ) )
+	{
+		client.daemon_server     = daemon_server;
+		client.client_descriptor = client_descriptor;
+
+		if( daemon_state_write_metrics(
+		     daemon_state,
+		     (int (*)(const uint8_t *, size_t, void *, libcerror_error_t **)) &daemon_server_write_metrics_data,
+		     (void *) &client,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write metrics.",
+			 function );
+
+			return( -1 );
+		}
+		result = 1;
+	}
+	else
+	{
+		if( daemon_server_write(
+		     daemon_server,
+		     client_descriptor,
+		     (uint8_t *) "error: unsupported request\n",
+		     27,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write error.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( daemon_server_flush(
+	     daemon_server,
+	     client_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( DAEMON_SERVER_HAVE_UNIX_SOCKET ) */
+
+/* Handles a pending connection
+ * A client that fails to send its request or to receive the response
+ * in time is disconnected, which does not affect the daemon
+ * Returns 1 if a request was served, 0 if not or -1 on error
+ */
+int daemon_server_handle_connection(
+     daemon_server_t *daemon_server,
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error )
+{
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+	char request[ DAEMON_SERVER_MAXIMUM_REQUEST_SIZE ];
+
+	struct timeval send_timeout;
+
+	libcerror_error_t *client_error = NULL;
+	int client_descriptor           = -1;
+	int result                      = 0;
+#endif
+	static char *function           = "daemon_server_handle_connection";
+
+	if( daemon_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon server.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_server->socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid daemon server - missing socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+	client_descriptor = accept(
+	                     daemon_server->socket_descriptor,
+	                     NULL,
+	                     NULL );
+
+	if( client_descriptor == -1 )
+	{
+		if( ( errno == EINTR )
+		 || ( errno == EAGAIN )
+		 || ( errno == ECONNABORTED ) )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to accept connection.",
+		 function );
+
+		return( -1 );
+	}
+	/* A client that does not read its response would otherwise
+	 * block the daemon
+	 */
+	send_timeout.tv_sec  = DAEMON_SERVER_CLIENT_TIMEOUT / 1000;
+	send_timeout.tv_usec = ( DAEMON_SERVER_CLIENT_TIMEOUT % 1000 ) * 1000;
+
+	if( setsockopt(
+	     client_descriptor,
+	     SOL_SOCKET,
+	     SO_SNDTIMEO,
+	     &send_timeout,
+	     sizeof( struct timeval ) ) != 0 )
+	{
+		libcerror_system_set_error(
+		 &client_error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 errno,
+		 "%s: unable to set send timeout.",
+		 function );
+
+		goto on_client_error;
+	}
+	if( daemon_server_read_request(
+	     client_descriptor,
+	     request,
+	     DAEMON_SERVER_MAXIMUM_REQUEST_SIZE,
+	     &client_error ) != 1 )
+	{
+		libcerror_error_set(
+		 &client_error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read request.",
+		 function );
+
+		goto on_client_error;
+	}
+	/* The cached records are not changed by the poll thread
+	 * while the response is written
+	 */
+	if( daemon_state_grab_for_read(
+	     daemon_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab daemon state for read.",
+		 function );
+
+		close(
+		 client_descriptor );
+
+		return( -1 );
+	}
+	result = daemon_server_write_response(
+	          daemon_server,
+	          daemon_state,
+	          client_descriptor,
+	          request,
+	          &client_error );
+
+	if( daemon_state_release_for_read(
+	     daemon_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release daemon state for read.",
+		 function );
+
+		if( client_error != NULL )
+		{
+			libcerror_error_free(
+			 &client_error );
+		}
+		close(
+		 client_descriptor );
+
+		return( -1 );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &client_error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write response.",
+		 function );
+
+		goto on_client_error;
+	}
+	else if( result != 0 )
+	{
+		daemon_server->number_of_requests += 1;
+	}
+	close(
+	 client_descriptor );
+
+	return( result );
+
+on_client_error:
+	if( client_error != NULL )
+	{
+		libcerror_error_free(
+		 &client_error );
+	}
+	close(
+	 client_descriptor );
+
+	return( 0 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Runs the daemon server until abort is signalled
+ * The devices are polled by the poll thread of the daemon state, hence
+ * a request is answered from the cached records without waiting for a
+ * device query. Without multi-threading support the devices are polled
+ * in between serving requests, one device at a time, hence a request
+ * never waits for more than a single device query
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_server_run(
+     daemon_server_t *daemon_server,
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error )
+{
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+	struct pollfd poll_descriptor;
+
+	int result            = 0;
+	int timeout           = 0;
+#endif
+	static char *function = "daemon_server_run";
+
+	if( daemon_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon server.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_server->socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid daemon server - missing socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( daemon_state_start_poll_thread(
+	     daemon_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start poll thread.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( ( daemon_server->abort == 0 )
+	    && ( daemon_state->abort == 0 ) )
+	{
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		/* The signal can be delivered to the poll thread, hence the abort
+		 * values are checked periodically
+		 */
+		timeout = DAEMON_SERVER_ABORT_CHECK_INTERVAL;
+#else
+		if( daemon_state_get_timeout(
+		     daemon_state,
+		     &timeout,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve timeout.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		poll_descriptor.fd      = daemon_server->socket_descriptor;
+		poll_descriptor.events  = POLLIN;
+		poll_descriptor.revents = 0;
+
+		result = poll(
+		          &poll_descriptor,
+		          1,
+		          timeout );
+
+		if( result == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to poll socket.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result > 0 )
+		      && ( ( poll_descriptor.revents & POLLIN ) != 0 ) )
+		{
+			if( daemon_server_handle_connection(
+			     daemon_server,
+			     daemon_state,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to handle connection.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#if !defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		if( ( daemon_server->abort != 0 )
+		 || ( daemon_state->abort != 0 ) )
+		{
+			break;
+		}
+		if( daemon_state_poll_next_device(
+		     daemon_state,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to poll device.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( daemon_state_stop_poll_thread(
+	     daemon_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop poll thread.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	daemon_state_stop_poll_thread(
+	 daemon_state,
+	 NULL );
+#endif
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing Unix domain socket support.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
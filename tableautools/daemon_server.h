@@ -0,0 +1,159 @@
+/*
+ * Unix domain socket server of the Tableau daemon
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DAEMON_SERVER_H )
+#define _DAEMON_SERVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include <signal.h>
+
+#include "daemon_state.h"
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_SYS_SOCKET_H ) && defined( HAVE_SYS_UN_H ) && defined( HAVE_POLL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define DAEMON_SERVER_HAVE_UNIX_SOCKET
+#endif
+
+/* The size of the path of a Unix domain socket, including the end-of-string
+ * character, as defined by sockaddr_un
+ */
+#define DAEMON_SERVER_SOCKET_PATH_SIZE			108
+
+/* The maximum size of a request line, including the end-of-line character
+ */
+#define DAEMON_SERVER_MAXIMUM_REQUEST_SIZE		64
+
+/* The time in milliseconds a client has to send its request and
+ * to receive the response
+ */
+#define DAEMON_SERVER_CLIENT_TIMEOUT			1000
+
+/* The interval in milliseconds in which the abort values are checked
+ * while waiting for a connection
+ */
+#define DAEMON_SERVER_ABORT_CHECK_INTERVAL		250
+
+/* The size of the output buffer of a response
+ */
+#define DAEMON_SERVER_OUTPUT_BUFFER_SIZE		65536
+
+/* The signature and version of a binary response
+ */
+#define DAEMON_SERVER_BINARY_SIGNATURE			"tableaud"
+#define DAEMON_SERVER_BINARY_VERSION			1
+
+/* The size of the header of a binary response
+ */
+#define DAEMON_SERVER_BINARY_HEADER_SIZE		16
+
+typedef struct daemon_server daemon_server_t;
+
+typedef struct daemon_server_client daemon_server_client_t;
+
+/* A client connects, sends a single request line and receives the response,
+ * after which the connection is closed. The supported requests are:
+ * "json", the device records as JSON Lines, "binary", a header followed
+ * by the fixed size device records, and "metrics", the device metrics
+ * in the Prometheus text format
+ */
+struct daemon_server
+{
+	/* The socket path
+	 */
+	char socket_path[ DAEMON_SERVER_SOCKET_PATH_SIZE ];
+
+	/* The socket descriptor
+	 */
+	int socket_descriptor;
+
+	/* The output buffer
+	 */
+	uint8_t output_buffer[ DAEMON_SERVER_OUTPUT_BUFFER_SIZE ];
+
+	/* The size of the data in the output buffer
+	 */
+	size_t output_buffer_size;
+
+	/* The number of requests that were served
+	 */
+	uint64_t number_of_requests;
+
+	/* Value to indicate if abort was signalled
+	 */
+	volatile sig_atomic_t abort;
+};
+
+/* The client a response is written to
+ */
+struct daemon_server_client
+{
+	/* The daemon server
+	 */
+	daemon_server_t *daemon_server;
+
+	/* The client descriptor
+	 */
+	int client_descriptor;
+};
+
+int daemon_server_initialize(
+     daemon_server_t **daemon_server,
+     libcerror_error_t **error );
+
+int daemon_server_free(
+     daemon_server_t **daemon_server,
+     libcerror_error_t **error );
+
+int daemon_server_signal_abort(
+     daemon_server_t *daemon_server,
+     libcerror_error_t **error );
+
+int daemon_server_open(
+     daemon_server_t *daemon_server,
+     const system_character_t *socket_path,
+     libcerror_error_t **error );
+
+int daemon_server_close(
+     daemon_server_t *daemon_server,
+     libcerror_error_t **error );
+
+int daemon_server_handle_connection(
+     daemon_server_t *daemon_server,
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error );
+
+int daemon_server_run(
+     daemon_server_t *daemon_server,
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DAEMON_SERVER_H ) */
+
@@ -0,0 +1,2647 @@
+/*
+ * Device state of the Tableau daemon
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#include <time.h>
+
+#include "daemon_state.h"
+#include "info_record.h"
+#include "status_table.h"
+#include "tableautools_device.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcnotify.h"
+#include "tableautools_libcthreads.h"
+#include "tableautools_libtableau.h"
+#include "tableautools_system_string.h"
+#include "tableautools_time.h"
+#include "tableautools_unused.h"
+
+/* The maximum size of a value of the handle
+ */
+#define DAEMON_STATE_VALUE_SIZE		256
+
+/* The names of the statuses as reported in a record
+ */
+static const char *daemon_state_status_names[ 4 ] = {
+	"pending",
+	"ok",
+	"error",
+	"unsupported" };
+
+/* Creates a daemon state
+ * Make sure the value daemon_state is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_initialize(
+     daemon_state_t **daemon_state,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_state_initialize";
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *daemon_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid daemon state value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*daemon_state = memory_allocate_structure(
+	                 daemon_state_t );
+
+	if( *daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *daemon_state,
+	     0,
+	     sizeof( daemon_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear daemon state.",
+		 function );
+
+		memory_free(
+		 *daemon_state );
+
+		*daemon_state = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *daemon_state )->devices_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create devices lock.",
+		 function );
+
+		memory_free(
+		 *daemon_state );
+
+		*daemon_state = NULL;
+
+		return( -1 );
+	}
+#endif
+	( *daemon_state )->poll_interval = 1000;
+
+	return( 1 );
+}
+
+/* Frees a device
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_state_free_device(
+            daemon_state_device_t **device,
+            libcerror_error_t **error )
+{
+	static char *function = "daemon_state_free_device";
+	int result            = 1;
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device.",
+		 function );
+
+		return( -1 );
+	}
+	if( *device != NULL )
+	{
+		if( ( *device )->is_open != 0 )
+		{
+			if( libtableau_handle_close(
+			     ( *device )->handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *device )->handle != NULL )
+		{
+			if( libtableau_handle_free(
+			     &( ( *device )->handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *device )->source != NULL )
+		{
+			memory_free(
+			 ( *device )->source );
+		}
+		memory_free(
+		 *device );
+
+		*device = NULL;
+	}
+	return( result );
+}
+
+/* Frees a daemon state
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_free(
+     daemon_state_t **daemon_state,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_state_free";
+	int device_index      = 0;
+	int result            = 1;
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *daemon_state != NULL )
+	{
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		if( daemon_state_stop_poll_thread(
+		     *daemon_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop poll thread.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( device_index = 0;
+		     device_index < ( *daemon_state )->number_of_devices;
+		     device_index++ )
+		{
+			if( daemon_state_free_device(
+			     &( ( *daemon_state )->devices[ device_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free device: %d.",
+				 function,
+				 device_index );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *daemon_state )->devices_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free devices lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *daemon_state );
+
+		*daemon_state = NULL;
+	}
+	return( result );
+}
+
+/* Signals the daemon state to abort
+ * The handles of the devices reference the abort value of the daemon state,
+ * hence a device that is being polled is signalled as well. The function
+ * only sets the abort value, so that it can be called from a signal handler
+ * while the devices are changed by the poll thread
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_signal_abort(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_state_signal_abort";
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	daemon_state->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the poll interval
+ * The string contains the interval in milliseconds
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int daemon_state_set_poll_interval(
+     daemon_state_t *daemon_state,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_state_set_poll_interval";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( tableautools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( value_64bit < (uint64_t) DAEMON_STATE_MINIMUM_POLL_INTERVAL )
+	 || ( value_64bit > (uint64_t) DAEMON_STATE_MAXIMUM_POLL_INTERVAL ) )
+	{
+		return( 0 );
+	}
+	daemon_state->poll_interval = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Appends a device
+ * Returns 1 if successful, 0 if the device was already appended or -1 on error
+ */
+int daemon_state_append_device(
+     daemon_state_t *daemon_state,
+     const system_character_t *source,
+     size_t source_length,
+     uint8_t is_discovered,
+     libcerror_error_t **error )
+{
+	daemon_state_device_t *device = NULL;
+	static char *function         = "daemon_state_append_device";
+	int device_index              = 0;
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_length == 0 )
+	 || ( source_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A device that is both specified and discovered is polled once
+	 */
+	for( device_index = 0;
+	     device_index < daemon_state->number_of_devices;
+	     device_index++ )
+	{
+		device = daemon_state->devices[ device_index ];
+
+		if( ( system_string_length( device->source ) == source_length )
+		 && ( system_string_compare(
+		       device->source,
+		       source,
+		       source_length ) == 0 ) )
+		{
+			if( is_discovered == 0 )
+			{
+				device->flags &= ~( DAEMON_STATE_FLAG_DISCOVERED );
+			}
+			return( 0 );
+		}
+	}
+	device = NULL;
+
+	if( daemon_state->number_of_devices >= DAEMON_STATE_MAXIMUM_NUMBER_OF_DEVICES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: number of devices exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	device = memory_allocate_structure(
+	          daemon_state_device_t );
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create device.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     device,
+	     0,
+	     sizeof( daemon_state_device_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear device.",
+		 function );
+
+		memory_free(
+		 device );
+
+		return( -1 );
+	}
+	device->source = system_string_allocate(
+	                  source_length + 1 );
+
+	if( device->source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     device->source,
+	     source,
+	     source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source.",
+		 function );
+
+		goto on_error;
+	}
+	device->source[ source_length ] = 0;
+
+	/* A source that does not fit is truncated in the records
+	 */
+	if( narrow_string_snprintf(
+	     device->source_string,
+	     DAEMON_STATE_STRING_SIZE,
+	     "%" PRIs_SYSTEM "",
+	     device->source ) < 0 )
+	{
+		device->source_string[ 0 ] = 0;
+	}
+	device->source_string[ DAEMON_STATE_STRING_SIZE - 1 ] = 0;
+
+	if( libtableau_handle_initialize(
+	     &( device->handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libtableau_handle_set_abort_flag(
+	     device->handle,
+	     &( daemon_state->abort ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set abort flag of handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( is_discovered != 0 )
+	{
+		device->flags = DAEMON_STATE_FLAG_DISCOVERED;
+	}
+	device->status             = DAEMON_STATE_STATUS_PENDING;
+	device->status_table_index = -1;
+
+	if( daemon_state_device_update_records(
+	     device,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update records.",
+		 function );
+
+		goto on_error;
+	}
+	daemon_state->devices[ daemon_state->number_of_devices ] = device;
+
+	daemon_state->number_of_devices += 1;
+
+	return( 1 );
+
+on_error:
+	if( device != NULL )
+	{
+		daemon_state_free_device(
+		 &device,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Removes a device
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_state_remove_device(
+            daemon_state_t *daemon_state,
+            int device_index,
+            libcerror_error_t **error )
+{
+	static char *function = "daemon_state_remove_device";
+
+	if( ( device_index < 0 )
+	 || ( device_index >= daemon_state->number_of_devices ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid device index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_state_free_device(
+	     &( daemon_state->devices[ device_index ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free device: %d.",
+		 function,
+		 device_index );
+
+		return( -1 );
+	}
+	daemon_state->number_of_devices -= 1;
+
+	/* The order of the devices is retained so that the records are
+	 * reported in the order the devices were appended
+	 */
+	while( device_index < daemon_state->number_of_devices )
+	{
+		daemon_state->devices[ device_index ] = daemon_state->devices[ device_index + 1 ];
+
+		device_index++;
+	}
+	daemon_state->devices[ daemon_state->number_of_devices ] = NULL;
+
+	return( 1 );
+}
+
+/* Appends a discovered device
+ * Callback function for tableautools_device_discover, which stops the
+ * discovery once the maximum number of devices has been reached
+ * Returns 1 if successful, 0 if the maximum number of devices was reached or -1 on error
+ */
+static int daemon_state_append_discovered_device(
+            intptr_t *daemon_state,
+            const system_character_t *device_name,
+            size_t device_name_length,
+            libcerror_error_t **error )
+{
+	static char *function = "daemon_state_append_discovered_device";
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (daemon_state_t *) daemon_state )->number_of_devices >= DAEMON_STATE_MAXIMUM_NUMBER_OF_DEVICES )
+	{
+		return( 0 );
+	}
+	if( daemon_state_append_device(
+	     (daemon_state_t *) daemon_state,
+	     device_name,
+	     device_name_length,
+	     1,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append device.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Discovers the SCSI generic devices
+ * Discovery is only supported on Linux, where every Tableau write blocker
+ * is accessible as a /dev/sg# device. New devices are appended, discovered
+ * devices that no longer exist are removed and discovered devices that
+ * could not be queried before are queried again, so that hot-plugged
+ * write blockers are picked up
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_discover_devices(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error )
+{
+#if defined( __linux__ ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_statistics;
+
+	daemon_state_device_t *device = NULL;
+	int device_index              = 0;
+#endif
+	static char *function         = "daemon_state_discover_devices";
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __linux__ ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	device_index = daemon_state->number_of_devices;
+
+	while( device_index > 0 )
+	{
+		device_index--;
+
+		device = daemon_state->devices[ device_index ];
+
+		if( ( device->flags & DAEMON_STATE_FLAG_DISCOVERED ) == 0 )
+		{
+			continue;
+		}
+		if( stat(
+		     device->source,
+		     &file_statistics ) != 0 )
+		{
+			if( daemon_state_remove_device(
+			     daemon_state,
+			     device_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove device: %d.",
+				 function,
+				 device_index );
+
+				return( -1 );
+			}
+		}
+		else if( device->status == DAEMON_STATE_STATUS_UNSUPPORTED )
+		{
+			device->status         = DAEMON_STATE_STATUS_PENDING;
+			device->next_poll_time = 0;
+		}
+	}
+	if( tableautools_device_discover(
+	     &daemon_state_append_discovered_device,
+	     (intptr_t *) daemon_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to discover devices.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Copies a string into a fixed size field of a binary record
+ * The field is padded with 0-byte values
+ */
+static void daemon_state_copy_string_to_field(
+             uint8_t *field,
+             const char *string )
+{
+	size_t string_length = 0;
+
+	string_length = narrow_string_length(
+	                 string );
+
+	if( string_length >= DAEMON_STATE_STRING_SIZE )
+	{
+		string_length = DAEMON_STATE_STRING_SIZE - 1;
+	}
+	memory_copy(
+	 field,
+	 string,
+	 string_length );
+}
+
+/* Updates the cached records of a device from its values
+ * The records are composed when the device is polled, so that a request
+ * only copies them
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_device_update_records(
+     daemon_state_device_t *device,
+     libcerror_error_t **error )
+{
+	const char *flag_strings[ 3 ];
+	const char *flag_names[ 3 ] = {
+		"bridge_mode_read_only",
+		"drive_hpa_in_use",
+		"drive_dco_in_use" };
+
+	uint64_t integer_values[ 9 ];
+	const char *integer_names[ 9 ] = {
+		"drive_number_of_sectors",
+		"hpa_number_of_sectors",
+		"dco_number_of_sectors",
+		"latency",
+		"maximum_latency",
+		"number_of_queries",
+		"number_of_errors",
+		"poll_time",
+		"discovered" };
+
+	const char *string_values[ 3 ];
+	const char *string_names[ 3 ] = {
+		"bridge_serial_number",
+		"drive_model",
+		"drive_serial_number" };
+
+	uint64_t metrics_values[ METRICS_RECORD_NUMBER_OF_FAMILIES ];
+
+	static char *function  = "daemon_state_device_update_records";
+	size_t value_length    = 0;
+	int number_of_families = 0;
+	int result             = 0;
+	int value_index        = 0;
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( device->status < DAEMON_STATE_STATUS_PENDING )
+	 || ( device->status > DAEMON_STATE_STATUS_UNSUPPORTED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported status.",
+		 function );
+
+		return( -1 );
+	}
+	string_values[ 0 ] = device->bridge_serial_number;
+	string_values[ 1 ] = device->drive_model;
+	string_values[ 2 ] = device->drive_serial_number;
+
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		if( ( device->flags & ( 1 << value_index ) ) != 0 )
+		{
+			flag_strings[ value_index ] = "true";
+		}
+		else
+		{
+			flag_strings[ value_index ] = "false";
+		}
+	}
+	integer_values[ 0 ] = (uint64_t) device->drive_number_of_sectors;
+	integer_values[ 1 ] = (uint64_t) device->hpa_number_of_sectors;
+	integer_values[ 2 ] = (uint64_t) device->dco_number_of_sectors;
+	integer_values[ 3 ] = device->latency;
+	integer_values[ 4 ] = device->maximum_latency;
+	integer_values[ 5 ] = device->number_of_queries;
+	integer_values[ 6 ] = device->number_of_errors;
+	integer_values[ 7 ] = device->poll_time;
+	integer_values[ 8 ] = (uint64_t) ( ( device->flags & DAEMON_STATE_FLAG_DISCOVERED ) != 0 );
+
+	if( info_record_clear(
+	     &( device->json_record ),
+	     INFO_RECORD_FORMAT_JSONL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clear JSON record.",
+		 function );
+
+		return( -1 );
+	}
+	value_length = narrow_string_length(
+	                device->source_string );
+
+	if( info_record_append_string(
+	     &( device->json_record ),
+	     "source",
+	     device->source_string,
+	     value_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source.",
+		 function );
+
+		return( -1 );
+	}
+	value_length = narrow_string_length(
+	                daemon_state_status_names[ device->status ] );
+
+	if( info_record_append_string(
+	     &( device->json_record ),
+	     "status",
+	     daemon_state_status_names[ device->status ],
+	     value_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append status.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		value_length = narrow_string_length(
+		                string_values[ value_index ] );
+
+		if( info_record_append_string(
+		     &( device->json_record ),
+		     string_names[ value_index ],
+		     string_values[ value_index ],
+		     value_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value: %s.",
+			 function,
+			 string_names[ value_index ] );
+
+			return( -1 );
+		}
+	}
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		value_length = narrow_string_length(
+		                flag_strings[ value_index ] );
+
+		if( info_record_append_string(
+		     &( device->json_record ),
+		     flag_names[ value_index ],
+		     flag_strings[ value_index ],
+		     value_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value: %s.",
+			 function,
+			 flag_names[ value_index ] );
+
+			return( -1 );
+		}
+	}
+	for( value_index = 0;
+	     value_index < 9;
+	     value_index++ )
+	{
+		if( info_record_append_integer(
+		     &( device->json_record ),
+		     integer_names[ value_index ],
+		     integer_values[ value_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value: %s.",
+			 function,
+			 integer_names[ value_index ] );
+
+			return( -1 );
+		}
+	}
+	if( info_record_finalize(
+	     &( device->json_record ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize JSON record.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     device->binary_record,
+	     0,
+	     DAEMON_STATE_BINARY_RECORD_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear binary record.",
+		 function );
+
+		return( -1 );
+	}
+	device->binary_record[ 0 ] = (uint8_t) device->status;
+	device->binary_record[ 1 ] = device->flags;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( device->binary_record[ 4 ] ),
+	 device->drive_number_of_sectors );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( device->binary_record[ 8 ] ),
+	 device->hpa_number_of_sectors );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( device->binary_record[ 12 ] ),
+	 device->dco_number_of_sectors );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( device->binary_record[ 16 ] ),
+	 device->latency );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( device->binary_record[ 24 ] ),
+	 device->maximum_latency );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( device->binary_record[ 32 ] ),
+	 device->number_of_queries );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( device->binary_record[ 40 ] ),
+	 device->number_of_errors );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( device->binary_record[ 48 ] ),
+	 device->poll_time );
+
+	daemon_state_copy_string_to_field(
+	 &( device->binary_record[ 64 ] ),
+	 device->source_string );
+
+	daemon_state_copy_string_to_field(
+	 &( device->binary_record[ 128 ] ),
+	 device->bridge_serial_number );
+
+	daemon_state_copy_string_to_field(
+	 &( device->binary_record[ 192 ] ),
+	 device->drive_model );
+
+	daemon_state_copy_string_to_field(
+	 &( device->binary_record[ 256 ] ),
+	 device->drive_serial_number );
+
+	if( metrics_record_clear(
+	     &( device->metrics_record ),
+	     device->source_string,
+	     device->bridge_serial_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clear metrics record.",
+		 function );
+
+		return( -1 );
+	}
+	metrics_values[ 0 ] = (uint64_t) ( device->status == DAEMON_STATE_STATUS_OK );
+	metrics_values[ 1 ] = 0;
+	metrics_values[ 2 ] = device->number_of_queries;
+	metrics_values[ 3 ] = device->number_of_errors;
+	metrics_values[ 4 ] = device->number_of_query_timeouts;
+	metrics_values[ 5 ] = device->number_of_query_sense_errors;
+	metrics_values[ 6 ] = (uint64_t) ( ( device->flags & DAEMON_STATE_FLAG_READ_ONLY ) == 0 );
+	metrics_values[ 7 ] = (uint64_t) ( ( device->flags & DAEMON_STATE_FLAG_HPA_IN_USE ) != 0 );
+	metrics_values[ 8 ] = (uint64_t) ( ( device->flags & DAEMON_STATE_FLAG_DCO_IN_USE ) != 0 );
+	metrics_values[ 9 ] = (uint64_t) device->drive_number_of_sectors;
+
+	/* The state of the bridge and the drive is only known after
+	 * a successful query
+	 */
+	number_of_families = METRICS_RECORD_FAMILY_WRITE_PERMITTED;
+
+	if( ( device->flags & DAEMON_STATE_FLAG_QUERIED ) != 0 )
+	{
+		number_of_families = METRICS_RECORD_NUMBER_OF_FAMILIES;
+	}
+	for( value_index = 0;
+	     value_index < number_of_families;
+	     value_index++ )
+	{
+		if( value_index == METRICS_RECORD_FAMILY_QUERY_LATENCY )
+		{
+			result = metrics_record_append_histogram(
+			          &( device->metrics_record ),
+			          value_index,
+			          device->latency_bucket_counts,
+			          device->latency_sum,
+			          error );
+		}
+		else
+		{
+			result = metrics_record_append_value(
+			          &( device->metrics_record ),
+			          value_index,
+			          metrics_values[ value_index ],
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append metrics family: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	if( metrics_record_finalize(
+	     &( device->metrics_record ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize metrics record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a value of the handle as a string
+ * The string is empty if the value is not present
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_state_get_handle_value(
+            daemon_state_device_t *device,
+            const char *identifier,
+            char *string,
+            size_t string_size,
+            libcerror_error_t **error )
+{
+	char value_string[ DAEMON_STATE_VALUE_SIZE ];
+
+	static char *function = "daemon_state_get_handle_value";
+	size_t value_length   = 0;
+	int result            = 0;
+
+	result = libtableau_handle_get_value(
+	          device->handle,
+	          identifier,
+	          value_string,
+	          DAEMON_STATE_VALUE_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %s.",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		value_length = narrow_string_length(
+		                value_string );
+	}
+	if( value_length >= string_size )
+	{
+		value_length = string_size - 1;
+	}
+	if( value_length > 0 )
+	{
+		memory_copy(
+		 string,
+		 value_string,
+		 value_length );
+	}
+	string[ value_length ] = 0;
+
+	return( 1 );
+}
+
+/* Sets the values of a device from the values of the last query
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_state_set_values_from_handle(
+            daemon_state_device_t *device,
+            libcerror_error_t **error )
+{
+	char flag_string[ 8 ];
+
+	const char *flag_identifiers[ 3 ] = {
+		"bridge_mode_read_only",
+		"drive_hpa_in_use",
+		"drive_dco_in_use" };
+
+	static char *function = "daemon_state_set_values_from_handle";
+	int flag_index        = 0;
+	int result            = 0;
+
+	if( daemon_state_get_handle_value(
+	     device,
+	     "bridge_serial_number",
+	     device->bridge_serial_number,
+	     DAEMON_STATE_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bridge serial number.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_state_get_handle_value(
+	     device,
+	     "drive_model",
+	     device->drive_model,
+	     DAEMON_STATE_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve drive model.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_state_get_handle_value(
+	     device,
+	     "drive_serial_number",
+	     device->drive_serial_number,
+	     DAEMON_STATE_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve drive serial number.",
+		 function );
+
+		return( -1 );
+	}
+	device->flags &= DAEMON_STATE_FLAG_DISCOVERED;
+
+	for( flag_index = 0;
+	     flag_index < 3;
+	     flag_index++ )
+	{
+		if( daemon_state_get_handle_value(
+		     device,
+		     flag_identifiers[ flag_index ],
+		     flag_string,
+		     8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %s.",
+			 function,
+			 flag_identifiers[ flag_index ] );
+
+			return( -1 );
+		}
+		if( ( narrow_string_length( flag_string ) == 4 )
+		 && ( narrow_string_compare(
+		       flag_string,
+		       "true",
+		       4 ) == 0 ) )
+		{
+			device->flags |= (uint8_t) ( 1 << flag_index );
+		}
+	}
+	result = libtableau_handle_get_drive_number_of_sectors(
+	          device->handle,
+	          &( device->drive_number_of_sectors ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve drive number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		device->drive_number_of_sectors = 0;
+	}
+	result = libtableau_handle_get_hpa_number_of_sectors(
+	          device->handle,
+	          &( device->hpa_number_of_sectors ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve HPA number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		device->hpa_number_of_sectors = 0;
+	}
+	result = libtableau_handle_get_dco_number_of_sectors(
+	          device->handle,
+	          &( device->dco_number_of_sectors ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve DCO number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		device->dco_number_of_sectors = 0;
+	}
+	return( 1 );
+}
+
+/* Grabs the devices lock for write
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_state_grab_for_write(
+            daemon_state_t *daemon_state,
+            libcerror_error_t **error )
+{
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	static char *function = "daemon_state_grab_for_write";
+
+	if( libcthreads_read_write_lock_grab_for_write(
+	     daemon_state->devices_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab devices lock for write.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	TABLEAUTOOLS_UNREFERENCED_PARAMETER( daemon_state )
+	TABLEAUTOOLS_UNREFERENCED_PARAMETER( error )
+#endif
+	return( 1 );
+}
+
+/* Releases the devices lock for write
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_state_release_for_write(
+            daemon_state_t *daemon_state,
+            libcerror_error_t **error )
+{
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	static char *function = "daemon_state_release_for_write";
+
+	if( libcthreads_read_write_lock_release_for_write(
+	     daemon_state->devices_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release devices lock for write.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	TABLEAUTOOLS_UNREFERENCED_PARAMETER( daemon_state )
+	TABLEAUTOOLS_UNREFERENCED_PARAMETER( error )
+#endif
+	return( 1 );
+}
+
+/* Polls a device
+ * The handle is kept open between polls and only the query command
+ * is sent. A failed open or query is counted as an error and the handle
+ * is reopened by the next poll, so that a bridge that was reconnected
+ * is picked up again. A discovered device that was never queried
+ * successfully is marked as unsupported, since it is most likely not
+ * a Tableau write blocker. The device is queried without holding the devices
+ * lock, which is only grabbed to update the values and the cached records
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_state_poll_device(
+            daemon_state_t *daemon_state,
+            daemon_state_device_t *device,
+            libcerror_error_t **error )
+{
+	libcerror_error_t *query_error = NULL;
+	static char *function          = "daemon_state_poll_device";
+	uint64_t end_time              = 0;
+	uint64_t start_time            = 0;
+	uint8_t query_sent             = 0;
+	int bucket_index               = 0;
+	int result                     = 0;
+
+	tableautools_time_get_monotonic_time(
+	 &start_time );
+
+	if( device->is_open == 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libtableau_handle_open_wide(
+		          device->handle,
+		          device->source,
+		          LIBTABLEAU_OPEN_READ,
+		          &query_error );
+#else
+		result = libtableau_handle_open(
+		          device->handle,
+		          device->source,
+		          LIBTABLEAU_OPEN_READ,
+		          &query_error );
+#endif
+		if( result == 1 )
+		{
+			device->is_open = 1;
+		}
+		result = 0;
+	}
+	if( device->is_open != 0 )
+	{
+		result = libtableau_handle_query(
+		          device->handle,
+		          &query_error );
+
+		device->number_of_queries += 1;
+
+		query_sent = 1;
+	}
+	tableautools_time_get_monotonic_time(
+	 &end_time );
+
+	if( end_time >= start_time )
+	{
+		device->latency = ( end_time - start_time ) / 1000;
+
+		if( device->latency > device->maximum_latency )
+		{
+			device->maximum_latency = device->latency;
+		}
+	}
+	if( query_error != NULL )
+	{
+		libcerror_error_free(
+		 &query_error );
+	}
+	if( daemon_state_grab_for_write(
+	     daemon_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab devices lock for write.",
+		 function );
+
+		return( -1 );
+	}
+	if( query_sent != 0 )
+	{
+		bucket_index = metrics_record_get_latency_bucket_index(
+		                device->latency );
+
+		device->latency_bucket_counts[ bucket_index ] += 1;
+		device->latency_sum                           += device->latency;
+
+		/* The counters of the handle are kept when the handle is closed
+		 */
+		if( libtableau_handle_get_number_of_query_timeouts(
+		     device->handle,
+		     &( device->number_of_query_timeouts ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of query timeouts.",
+			 function );
+
+			goto on_error;
+		}
+		if( libtableau_handle_get_number_of_query_sense_errors(
+		     device->handle,
+		     &( device->number_of_query_sense_errors ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of query sense errors.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 1 )
+	{
+		if( daemon_state_set_values_from_handle(
+		     device,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set values.",
+			 function );
+
+			goto on_error;
+		}
+		device->status = DAEMON_STATE_STATUS_OK;
+		device->flags |= DAEMON_STATE_FLAG_QUERIED;
+	}
+	else
+	{
+		device->number_of_errors += 1;
+
+		if( device->is_open != 0 )
+		{
+			libtableau_handle_close(
+			 device->handle,
+			 NULL );
+
+			device->is_open = 0;
+		}
+		if( ( ( device->flags & DAEMON_STATE_FLAG_DISCOVERED ) != 0 )
+		 && ( device->status == DAEMON_STATE_STATUS_PENDING ) )
+		{
+			device->status = DAEMON_STATE_STATUS_UNSUPPORTED;
+		}
+		else
+		{
+			device->status = DAEMON_STATE_STATUS_ERROR;
+		}
+	}
+	device->poll_time      = (uint64_t) time( NULL );
+	device->next_poll_time = ( end_time / 1000 ) + ( (uint64_t) daemon_state->poll_interval * 1000 );
+
+	if( daemon_state_device_update_records(
+	     device,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update records.",
+		 function );
+
+		goto on_error;
+	}
+	if( daemon_state_release_for_write(
+	     daemon_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release devices lock for write.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	daemon_state_release_for_write(
+	 daemon_state,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes the record of a device to the status table
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_state_write_status_table_record(
+            daemon_state_t *daemon_state,
+            daemon_state_device_t *device,
+            libcerror_error_t **error )
+{
+	status_table_record_t record;
+
+	static char *function = "daemon_state_write_status_table_record";
+
+	if( memory_set(
+	     &record,
+	     0,
+	     sizeof( status_table_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record.",
+		 function );
+
+		return( -1 );
+	}
+	record.status                  = (uint8_t) device->status;
+	record.flags                   = device->flags;
+	record.drive_number_of_sectors = device->drive_number_of_sectors;
+	record.hpa_number_of_sectors   = device->hpa_number_of_sectors;
+	record.dco_number_of_sectors   = device->dco_number_of_sectors;
+	record.latency                 = device->latency;
+	record.maximum_latency         = device->maximum_latency;
+	record.number_of_queries       = device->number_of_queries;
+	record.number_of_errors        = device->number_of_errors;
+	record.poll_time               = device->poll_time;
+
+	daemon_state_copy_string_to_field(
+	 (uint8_t *) record.source,
+	 device->source_string );
+
+	daemon_state_copy_string_to_field(
+	 (uint8_t *) record.bridge_serial_number,
+	 device->bridge_serial_number );
+
+	daemon_state_copy_string_to_field(
+	 (uint8_t *) record.drive_model,
+	 device->drive_model );
+
+	daemon_state_copy_string_to_field(
+	 (uint8_t *) record.drive_serial_number,
+	 device->drive_serial_number );
+
+	if( status_table_write_record(
+	     daemon_state->status_table,
+	     (uint32_t) device->status_table_index,
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write status table record: %d.",
+		 function,
+		 device->status_table_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the status table the records are published to
+ * The status table is not managed by the daemon state and must have been
+ * created for writing. The records of all devices are published
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_set_status_table(
+     daemon_state_t *daemon_state,
+     status_table_t *status_table,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_state_set_status_table";
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( status_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status table.",
+		 function );
+
+		return( -1 );
+	}
+	if( status_table->is_writer == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported status table - not created for writing.",
+		 function );
+
+		return( -1 );
+	}
+	daemon_state->status_table = status_table;
+
+	if( daemon_state_publish_devices(
+	     daemon_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to publish devices.",
+		 function );
+
+		daemon_state->status_table = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Publishes the records of all devices to the status table
+ * The records of the reported devices are written to consecutive records
+ * in the order of the devices, which changes when devices are discovered,
+ * removed or found to be unsupported. A device that no longer fits in
+ * the status table is not published
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_publish_devices(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error )
+{
+	daemon_state_device_t *device = NULL;
+	static char *function         = "daemon_state_publish_devices";
+	uint32_t number_of_records    = 0;
+	int device_index              = 0;
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_state->status_table == NULL )
+	{
+		return( 1 );
+	}
+	for( device_index = 0;
+	     device_index < daemon_state->number_of_devices;
+	     device_index++ )
+	{
+		device = daemon_state->devices[ device_index ];
+
+		device->status_table_index = -1;
+
+		if( ( device->status == DAEMON_STATE_STATUS_UNSUPPORTED )
+		 || ( number_of_records >= daemon_state->status_table->maximum_number_of_records ) )
+		{
+			continue;
+		}
+		device->status_table_index = (int) number_of_records;
+
+		if( daemon_state_write_status_table_record(
+		     daemon_state,
+		     device,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to publish device: %s.",
+			 function,
+			 device->source_string );
+
+			return( -1 );
+		}
+		number_of_records++;
+	}
+	if( status_table_set_number_of_records(
+	     daemon_state->status_table,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of status table records.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the metrics text file that is written after polls
+ * The metrics text file is not managed by the daemon state and must have
+ * its path set. The text file is written after the next poll and once per
+ * poll interval after that
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_set_metrics_textfile(
+     daemon_state_t *daemon_state,
+     metrics_textfile_t *metrics_textfile,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_state_set_metrics_textfile";
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_textfile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics text file.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_textfile->path[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported metrics text file - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	daemon_state->metrics_textfile           = metrics_textfile;
+	daemon_state->next_metrics_textfile_time = 0;
+
+	return( 1 );
+}
+
+/* Writes the metrics of all devices in the Prometheus text format
+ * The samples are written family by family, each preceded by its HELP and
+ * TYPE lines, from the cached metrics records of the reported devices
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_write_metrics(
+     daemon_state_t *daemon_state,
+     int (*write_function)(
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_arguments,
+            libcerror_error_t **error ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	daemon_state_device_t *device = NULL;
+	const uint8_t *data           = NULL;
+	static char *function         = "daemon_state_write_metrics";
+	size_t data_size              = 0;
+	int device_index              = 0;
+	int family                    = 0;
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write function.",
+		 function );
+
+		return( -1 );
+	}
+	for( family = 0;
+	     family < METRICS_RECORD_NUMBER_OF_FAMILIES;
+	     family++ )
+	{
+		if( metrics_record_get_family_header(
+		     family,
+		     &data,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve header of family: %d.",
+			 function,
+			 family );
+
+			return( -1 );
+		}
+		if( write_function(
+		     data,
+		     data_size,
+		     callback_arguments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write header of family: %d.",
+			 function,
+			 family );
+
+			return( -1 );
+		}
+		for( device_index = 0;
+		     device_index < daemon_state->number_of_devices;
+		     device_index++ )
+		{
+			device = daemon_state->devices[ device_index ];
+
+			if( device->status == DAEMON_STATE_STATUS_UNSUPPORTED )
+			{
+				continue;
+			}
+			if( metrics_record_get_family_data(
+			     &( device->metrics_record ),
+			     family,
+			     &data,
+			     &data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve samples of family: %d of device: %d.",
+				 function,
+				 family,
+				 device_index );
+
+				return( -1 );
+			}
+			if( data_size == 0 )
+			{
+				continue;
+			}
+			if( write_function(
+			     data,
+			     data_size,
+			     callback_arguments,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write samples of family: %d of device: %d.",
+				 function,
+				 family,
+				 device_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Writes metrics data to the metrics text file
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_state_write_metrics_textfile_data(
+            const uint8_t *data,
+            size_t data_size,
+            metrics_textfile_t *metrics_textfile,
+            libcerror_error_t **error )
+{
+	static char *function = "daemon_state_write_metrics_textfile_data";
+
+	if( metrics_textfile_write(
+	     metrics_textfile,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metrics text file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the metrics of all devices to the metrics text file
+ * A failure to write the text file is counted by the metrics text file and
+ * does not affect the daemon, the text file is written again at the next
+ * poll interval
+ */
+static void daemon_state_write_metrics_textfile(
+             daemon_state_t *daemon_state )
+{
+	if( metrics_textfile_open(
+	     daemon_state->metrics_textfile,
+	     NULL ) != 1 )
+	{
+		return;
+	}
+	if( daemon_state_write_metrics(
+	     daemon_state,
+	     (int (*)(const uint8_t *, size_t, void *, libcerror_error_t **)) &daemon_state_write_metrics_textfile_data,
+	     (void *) daemon_state->metrics_textfile,
+	     NULL ) != 1 )
+	{
+		daemon_state->metrics_textfile->write_failed = 1;
+	}
+	metrics_textfile_close(
+	 daemon_state->metrics_textfile,
+	 NULL );
+}
+
+/* Polls the device of which the poll is the most overdue
+ * The devices are discovered again first when hot-plug is tracked and
+ * the discovery interval passed. This function must only be called by
+ * the thread that polls the devices
+ * Returns 1 if a device was polled, 0 if no poll is due or -1 on error
+ */
+int daemon_state_poll_next_device(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error )
+{
+	daemon_state_device_t *device = NULL;
+	static char *function         = "daemon_state_poll_next_device";
+	uint64_t current_time         = 0;
+	uint8_t publish_devices       = 0;
+	int device_index              = 0;
+	int result                    = 0;
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	tableautools_time_get_monotonic_time(
+	 &current_time );
+
+	current_time /= 1000;
+
+	if( ( daemon_state->track_hot_plug != 0 )
+	 && ( current_time >= daemon_state->next_discovery_time ) )
+	{
+		/* Discovery appends and removes devices, hence the devices lock
+		 * is held for its duration
+		 */
+		if( daemon_state_grab_for_write(
+		     daemon_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab devices lock for write.",
+			 function );
+
+			return( -1 );
+		}
+		result = daemon_state_discover_devices(
+		          daemon_state,
+		          error );
+
+		if( daemon_state_release_for_write(
+		     daemon_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release devices lock for write.",
+			 function );
+
+			return( -1 );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to discover devices.",
+			 function );
+
+			return( -1 );
+		}
+		daemon_state->next_discovery_time = current_time + DAEMON_STATE_DISCOVERY_INTERVAL;
+
+		publish_devices = 1;
+	}
+	for( device_index = 0;
+	     device_index < daemon_state->number_of_devices;
+	     device_index++ )
+	{
+		if( daemon_state->devices[ device_index ]->status == DAEMON_STATE_STATUS_UNSUPPORTED )
+		{
+			continue;
+		}
+		if( daemon_state->devices[ device_index ]->next_poll_time > current_time )
+		{
+			continue;
+		}
+		if( ( device == NULL )
+		 || ( daemon_state->devices[ device_index ]->next_poll_time < device->next_poll_time ) )
+		{
+			device = daemon_state->devices[ device_index ];
+		}
+	}
+	if( device != NULL )
+	{
+		if( daemon_state_poll_device(
+		     daemon_state,
+		     device,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to poll device: %s.",
+			 function,
+			 device->source_string );
+
+			return( -1 );
+		}
+		/* The handles are kept open, hence the buffered debug output
+		 * of the query is printed after every poll
+		 */
+		libtableau_notify_flush(
+		 NULL );
+	}
+	if( daemon_state->status_table != NULL )
+	{
+		/* Only the record of the polled device changes, unless the set of
+		 * reported devices changed
+		 */
+		if( ( device != NULL )
+		 && ( ( device->status == DAEMON_STATE_STATUS_UNSUPPORTED )
+		  || ( device->status_table_index == -1 ) ) )
+		{
+			publish_devices = 1;
+		}
+		if( publish_devices != 0 )
+		{
+			if( daemon_state_publish_devices(
+			     daemon_state,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to publish devices.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( device != NULL )
+		{
+			if( daemon_state_write_status_table_record(
+			     daemon_state,
+			     device,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to publish device: %s.",
+				 function,
+				 device->source_string );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( device != NULL )
+	 && ( daemon_state->metrics_textfile != NULL )
+	 && ( current_time >= daemon_state->next_metrics_textfile_time ) )
+	{
+		daemon_state_write_metrics_textfile(
+		 daemon_state );
+
+		daemon_state->next_metrics_textfile_time = current_time + ( (uint64_t) daemon_state->poll_interval * 1000 );
+	}
+	if( device == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of milliseconds until the next poll or discovery is due
+ * The timeout is at most the poll interval
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_get_timeout(
+     daemon_state_t *daemon_state,
+     int *timeout,
+     libcerror_error_t **error )
+{
+	daemon_state_device_t *device = NULL;
+	static char *function         = "daemon_state_get_timeout";
+	uint64_t current_time         = 0;
+	uint64_t next_time            = 0;
+	int device_index              = 0;
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( timeout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeout.",
+		 function );
+
+		return( -1 );
+	}
+	tableautools_time_get_monotonic_time(
+	 &current_time );
+
+	current_time /= 1000;
+	next_time    = current_time + ( (uint64_t) daemon_state->poll_interval * 1000 );
+
+	if( ( daemon_state->track_hot_plug != 0 )
+	 && ( daemon_state->next_discovery_time < next_time ) )
+	{
+		next_time = daemon_state->next_discovery_time;
+	}
+	for( device_index = 0;
+	     device_index < daemon_state->number_of_devices;
+	     device_index++ )
+	{
+		device = daemon_state->devices[ device_index ];
+
+		if( ( device->status != DAEMON_STATE_STATUS_UNSUPPORTED )
+		 && ( device->next_poll_time < next_time ) )
+		{
+			next_time = device->next_poll_time;
+		}
+	}
+	if( next_time <= current_time )
+	{
+		*timeout = 0;
+	}
+	else
+	{
+		*timeout = (int) ( ( next_time - current_time + 999 ) / 1000 );
+	}
+	return( 1 );
+}
+
+/* Grabs the devices lock for read
+ * The devices and their cached records are not changed by the poll thread
+ * until the lock is released
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_grab_for_read(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_state_grab_for_read";
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     daemon_state->devices_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab devices lock for read.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases the devices lock for read
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_release_for_read(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_state_release_for_read";
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     daemon_state->devices_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release devices lock for read.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+/* Polls the devices until abort is signalled
+ * The thread sleeps in between polls, at most the minimum poll interval
+ * at a time so that an abort is handled in time. A failure to poll is
+ * printed and signals the daemon to abort
+ * Returns 1 if successful or -1 on error
+ */
+static int daemon_state_poll_thread_function(
+            daemon_state_t *daemon_state )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "daemon_state_poll_thread_function";
+	int result               = 0;
+	int timeout              = 0;
+
+	while( daemon_state->abort == 0 )
+	{
+		result = daemon_state_poll_next_device(
+		          daemon_state,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to poll device.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		if( daemon_state_get_timeout(
+		     daemon_state,
+		     &timeout,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve timeout.",
+			 function );
+
+			goto on_error;
+		}
+		if( timeout > DAEMON_STATE_MINIMUM_POLL_INTERVAL )
+		{
+			timeout = DAEMON_STATE_MINIMUM_POLL_INTERVAL;
+		}
+		if( timeout > 0 )
+		{
+			tableautools_time_sleep(
+			 (uint32_t) timeout );
+		}
+	}
+	return( 1 );
+
+on_error:
+	libcnotify_print_error_backtrace(
+	 error );
+	libcerror_error_free(
+	 &error );
+
+	daemon_state->poll_thread_result = -1;
+	daemon_state->abort              = 1;
+
+	return( -1 );
+}
+
+/* Starts the thread that polls the devices
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_start_poll_thread(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_state_start_poll_thread";
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_state->poll_thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid daemon state - poll thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	daemon_state->poll_thread_result = 1;
+
+	if( libcthreads_thread_create(
+	     &( daemon_state->poll_thread ),
+	     NULL,
+	     (int (*)(void *)) &daemon_state_poll_thread_function,
+	     (void *) daemon_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create poll thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Stops the thread that polls the devices
+ * The daemon state is signalled to abort, since the thread only stops then
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_state_stop_poll_thread(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_state_stop_poll_thread";
+
+	if( daemon_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon state.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_state->poll_thread == NULL )
+	{
+		return( 1 );
+	}
+	daemon_state->abort = 1;
+
+	if( libcthreads_thread_join(
+	     &( daemon_state->poll_thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join poll thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_state->poll_thread_result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to poll devices.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
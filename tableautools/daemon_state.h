@@ -0,0 +1,348 @@
+/*
+ * Device state of the Tableau daemon
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DAEMON_STATE_H )
+#define _DAEMON_STATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include <signal.h>
+
+#include "info_record.h"
+#include "metrics_record.h"
+#include "metrics_textfile.h"
+#include "status_table.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcthreads.h"
+#include "tableautools_libtableau.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define DAEMON_STATE_MAXIMUM_NUMBER_OF_DEVICES		256
+
+/* The minimum and maximum poll interval in milliseconds
+ */
+#define DAEMON_STATE_MINIMUM_POLL_INTERVAL		100
+#define DAEMON_STATE_MAXIMUM_POLL_INTERVAL		3600000
+
+/* The interval in microseconds in which SCSI generic devices are discovered
+ * again when hot-plug is tracked
+ */
+#define DAEMON_STATE_DISCOVERY_INTERVAL			5000000
+
+/* The size of a string in a device record
+ */
+#define DAEMON_STATE_STRING_SIZE			64
+
+/* The size of a binary device record
+ */
+#define DAEMON_STATE_BINARY_RECORD_SIZE			320
+
+enum DAEMON_STATE_STATUSES
+{
+	DAEMON_STATE_STATUS_PENDING		= 0,
+	DAEMON_STATE_STATUS_OK			= 1,
+	DAEMON_STATE_STATUS_ERROR		= 2,
+
+	/* A discovered device that could not be queried, which is not reported
+	 */
+	DAEMON_STATE_STATUS_UNSUPPORTED		= 3
+};
+
+enum DAEMON_STATE_FLAGS
+{
+	DAEMON_STATE_FLAG_READ_ONLY		= 0x01,
+	DAEMON_STATE_FLAG_HPA_IN_USE		= 0x02,
+	DAEMON_STATE_FLAG_DCO_IN_USE		= 0x04,
+	DAEMON_STATE_FLAG_DISCOVERED		= 0x08,
+
+	/* The values of the device were set by a successful query
+	 */
+	DAEMON_STATE_FLAG_QUERIED		= 0x10
+};
+
+typedef struct daemon_state daemon_state_t;
+
+typedef struct daemon_state_device daemon_state_device_t;
+
+struct daemon_state_device
+{
+	/* The source device
+	 */
+	system_character_t *source;
+
+	/* The source, as reported in a record
+	 */
+	char source_string[ DAEMON_STATE_STRING_SIZE ];
+
+	/* The libtableau handle
+	 */
+	libtableau_handle_t *handle;
+
+	/* Value to indicate the handle is open
+	 */
+	uint8_t is_open;
+
+	/* The status
+	 */
+	int status;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The bridge serial number
+	 */
+	char bridge_serial_number[ DAEMON_STATE_STRING_SIZE ];
+
+	/* The drive model
+	 */
+	char drive_model[ DAEMON_STATE_STRING_SIZE ];
+
+	/* The drive serial number
+	 */
+	char drive_serial_number[ DAEMON_STATE_STRING_SIZE ];
+
+	/* The number of sectors of the drive
+	 */
+	uint32_t drive_number_of_sectors;
+
+	/* The number of HPA sectors
+	 */
+	uint32_t hpa_number_of_sectors;
+
+	/* The number of DCO sectors
+	 */
+	uint32_t dco_number_of_sectors;
+
+	/* The duration of the last query in microseconds
+	 */
+	uint64_t latency;
+
+	/* The duration of the slowest query in microseconds
+	 */
+	uint64_t maximum_latency;
+
+	/* The number of queries
+	 */
+	uint64_t number_of_queries;
+
+	/* The number of failed opens and queries
+	 */
+	uint64_t number_of_errors;
+
+	/* The number of queries that timed out
+	 */
+	uint64_t number_of_query_timeouts;
+
+	/* The number of queries the bridge returned sense data for
+	 */
+	uint64_t number_of_query_sense_errors;
+
+	/* The number of queries per latency bucket, the last bucket counts
+	 * the queries that exceed the upper bound of the largest bucket
+	 */
+	uint64_t latency_bucket_counts[ METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS + 1 ];
+
+	/* The sum of the durations of the queries in microseconds
+	 */
+	uint64_t latency_sum;
+
+	/* The POSIX time of the last poll in seconds
+	 */
+	uint64_t poll_time;
+
+	/* The monotonic time of the next poll in microseconds
+	 */
+	uint64_t next_poll_time;
+
+	/* The index of the record in the status table or -1 if not published
+	 */
+	int status_table_index;
+
+	/* The cached JSON Lines record
+	 */
+	info_record_t json_record;
+
+	/* The cached binary record
+	 */
+	uint8_t binary_record[ DAEMON_STATE_BINARY_RECORD_SIZE ];
+
+	/* The cached metrics record
+	 */
+	metrics_record_t metrics_record;
+};
+
+/* The devices are polled one at a time by a poll thread, which is the only
+ * thread that changes the device state. Requests are answered from the cached
+ * records, which are read while holding the devices lock, without waiting for
+ * the devices. Without multi-threading support the devices are polled in
+ * between serving requests
+ */
+struct daemon_state
+{
+	/* The devices
+	 */
+	daemon_state_device_t *devices[ DAEMON_STATE_MAXIMUM_NUMBER_OF_DEVICES ];
+
+	/* The number of devices
+	 */
+	int number_of_devices;
+
+	/* The poll interval in milliseconds
+	 */
+	uint32_t poll_interval;
+
+	/* Value to indicate SCSI generic devices should be discovered
+	 * periodically to track hot-plug
+	 */
+	uint8_t track_hot_plug;
+
+	/* The monotonic time of the next discovery in microseconds
+	 */
+	uint64_t next_discovery_time;
+
+	/* The status table the records are published to, which is optional
+	 */
+	status_table_t *status_table;
+
+	/* The metrics text file that is written after polls, which is optional
+	 */
+	metrics_textfile_t *metrics_textfile;
+
+	/* The monotonic time the metrics text file is written next in microseconds
+	 */
+	uint64_t next_metrics_textfile_time;
+
+	/* Value to indicate if abort was signalled
+	 * the handles of the devices reference this value as their abort flag
+	 */
+	volatile sig_atomic_t abort;
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	/* The lock protecting the devices and their cached records
+	 */
+	libcthreads_read_write_lock_t *devices_lock;
+
+	/* The poll thread
+	 */
+	libcthreads_thread_t *poll_thread;
+
+	/* The result of the poll thread, -1 if polling failed
+	 */
+	int poll_thread_result;
+#endif
+};
+
+int daemon_state_initialize(
+     daemon_state_t **daemon_state,
+     libcerror_error_t **error );
+
+int daemon_state_free(
+     daemon_state_t **daemon_state,
+     libcerror_error_t **error );
+
+int daemon_state_signal_abort(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error );
+
+int daemon_state_set_poll_interval(
+     daemon_state_t *daemon_state,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int daemon_state_append_device(
+     daemon_state_t *daemon_state,
+     const system_character_t *source,
+     size_t source_length,
+     uint8_t is_discovered,
+     libcerror_error_t **error );
+
+int daemon_state_discover_devices(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error );
+
+int daemon_state_device_update_records(
+     daemon_state_device_t *device,
+     libcerror_error_t **error );
+
+int daemon_state_set_status_table(
+     daemon_state_t *daemon_state,
+     status_table_t *status_table,
+     libcerror_error_t **error );
+
+int daemon_state_publish_devices(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error );
+
+int daemon_state_set_metrics_textfile(
+     daemon_state_t *daemon_state,
+     metrics_textfile_t *metrics_textfile,
+     libcerror_error_t **error );
+
+int daemon_state_write_metrics(
+     daemon_state_t *daemon_state,
+     int (*write_function)(
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_arguments,
+            libcerror_error_t **error ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+int daemon_state_poll_next_device(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error );
+
+int daemon_state_get_timeout(
+     daemon_state_t *daemon_state,
+     int *timeout,
+     libcerror_error_t **error );
+
+int daemon_state_grab_for_read(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error );
+
+int daemon_state_release_for_read(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+int daemon_state_start_poll_thread(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error );
+
+int daemon_state_stop_poll_thread(
+     daemon_state_t *daemon_state,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DAEMON_STATE_H ) */
+
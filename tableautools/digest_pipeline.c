@@ -0,0 +1,1141 @@
+/*
+ * Digest pipeline
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "digest_hash.h"
+#include "digest_pipeline.h"
+#include "md5.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "storage_media_buffer.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcnotify.h"
+#include "tableautools_libcthreads.h"
+
+/* Creates a digest pipeline
+ * Every digest type is calculated by its own worker thread, the workers
+ * only read the buffers so that they can share them
+ * A maximum number of buffers of 0 calculates the digests without workers
+ * Make sure the value digest_pipeline is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_initialize(
+     digest_pipeline_t **digest_pipeline,
+     uint8_t digest_types,
+     int maximum_number_of_buffers,
+     int (*release_function)(
+            storage_media_buffer_t *storage_media_buffer,
+            void *release_arguments ),
+     void *release_arguments,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_initialize";
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_pipeline != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest pipeline value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest_types & ~( DIGEST_PIPELINE_TYPE_MD5 | DIGEST_PIPELINE_TYPE_SHA1 | DIGEST_PIPELINE_TYPE_SHA256 ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported digest types: 0x%02" PRIx8 ".",
+		 function,
+		 digest_types );
+
+		return( -1 );
+	}
+	if( maximum_number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*digest_pipeline = memory_allocate_structure(
+	                    digest_pipeline_t );
+
+	if( *digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *digest_pipeline,
+	     0,
+	     sizeof( digest_pipeline_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest pipeline.",
+		 function );
+
+		memory_free(
+		 *digest_pipeline );
+
+		*digest_pipeline = NULL;
+
+		return( -1 );
+	}
+	( *digest_pipeline )->digest_types      = digest_types;
+	( *digest_pipeline )->release_function  = release_function;
+	( *digest_pipeline )->release_arguments = release_arguments;
+
+	if( ( digest_types & DIGEST_PIPELINE_TYPE_MD5 ) != 0 )
+	{
+		if( md5_context_initialize(
+		     &( ( *digest_pipeline )->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		if( maximum_number_of_buffers > 0 )
+		{
+			if( libcthreads_thread_pool_create(
+			     &( ( *digest_pipeline )->md5_thread_pool ),
+			     NULL,
+			     1,
+			     maximum_number_of_buffers,
+			     (int (*)(intptr_t *, void *)) &digest_pipeline_md5_callback,
+			     (void *) *digest_pipeline,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create MD5 thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		( *digest_pipeline )->number_of_digests += 1;
+	}
+	if( ( digest_types & DIGEST_PIPELINE_TYPE_SHA1 ) != 0 )
+	{
+		if( sha1_context_initialize(
+		     &( ( *digest_pipeline )->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		if( maximum_number_of_buffers > 0 )
+		{
+			if( libcthreads_thread_pool_create(
+			     &( ( *digest_pipeline )->sha1_thread_pool ),
+			     NULL,
+			     1,
+			     maximum_number_of_buffers,
+			     (int (*)(intptr_t *, void *)) &digest_pipeline_sha1_callback,
+			     (void *) *digest_pipeline,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create SHA1 thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		( *digest_pipeline )->number_of_digests += 1;
+	}
+	if( ( digest_types & DIGEST_PIPELINE_TYPE_SHA256 ) != 0 )
+	{
+		if( sha256_context_initialize(
+		     &( ( *digest_pipeline )->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		if( maximum_number_of_buffers > 0 )
+		{
+			if( libcthreads_thread_pool_create(
+			     &( ( *digest_pipeline )->sha256_thread_pool ),
+			     NULL,
+			     1,
+			     maximum_number_of_buffers,
+			     (int (*)(intptr_t *, void *)) &digest_pipeline_sha256_callback,
+			     (void *) *digest_pipeline,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create SHA256 thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		( *digest_pipeline )->number_of_digests += 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 digest_pipeline,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a digest pipeline
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_free(
+     digest_pipeline_t **digest_pipeline,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_free";
+	int result            = 1;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_pipeline != NULL )
+	{
+		if( digest_pipeline_join(
+		     *digest_pipeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join digest workers.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *digest_pipeline )->md5_context != NULL )
+		{
+			if( md5_context_free(
+			     &( ( *digest_pipeline )->md5_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free MD5 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_pipeline )->sha1_context != NULL )
+		{
+			if( sha1_context_free(
+			     &( ( *digest_pipeline )->sha1_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA1 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_pipeline )->sha256_context != NULL )
+		{
+			if( sha256_context_free(
+			     &( ( *digest_pipeline )->sha256_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA256 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *digest_pipeline );
+
+		*digest_pipeline = NULL;
+	}
+	return( result );
+}
+
+/* Updates a digest with the data of a storage media buffer
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_update(
+     digest_pipeline_t *digest_pipeline,
+     uint8_t digest_type,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_update";
+	int result            = 0;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	switch( digest_type )
+	{
+		case DIGEST_PIPELINE_TYPE_MD5:
+			result = md5_context_update(
+			          digest_pipeline->md5_context,
+			          storage_media_buffer->raw_buffer,
+			          storage_media_buffer->raw_buffer_data_size,
+			          error );
+			break;
+
+		case DIGEST_PIPELINE_TYPE_SHA1:
+			result = sha1_context_update(
+			          digest_pipeline->sha1_context,
+			          storage_media_buffer->raw_buffer,
+			          storage_media_buffer->raw_buffer_data_size,
+			          error );
+			break;
+
+		case DIGEST_PIPELINE_TYPE_SHA256:
+			result = sha256_context_update(
+			          digest_pipeline->sha256_context,
+			          storage_media_buffer->raw_buffer,
+			          storage_media_buffer->raw_buffer_data_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: 0x%02" PRIx8 ".",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest: 0x%02" PRIx8 ".",
+		 function,
+		 digest_type );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+/* Updates a digest from a worker thread and releases the buffer
+ * Returns 1 if successful or -1 on error
+ */
+static int digest_pipeline_worker_update(
+            digest_pipeline_t *digest_pipeline,
+            uint8_t digest_type,
+            storage_media_buffer_t *storage_media_buffer )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 1;
+
+	if( digest_pipeline == NULL )
+	{
+		return( -1 );
+	}
+	/* Once a digest failed the remaining buffers are only released
+	 */
+	if( digest_pipeline->digest_failed == 0 )
+	{
+		if( digest_pipeline_update(
+		     digest_pipeline,
+		     digest_type,
+		     storage_media_buffer,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			digest_pipeline->digest_failed = 1;
+
+			result = -1;
+		}
+	}
+	if( digest_pipeline->release_function != NULL )
+	{
+		if( digest_pipeline->release_function(
+		     storage_media_buffer,
+		     digest_pipeline->release_arguments ) != 1 )
+		{
+			digest_pipeline->digest_failed = 1;
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Callback function of the MD5 thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_md5_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     digest_pipeline_t *digest_pipeline )
+{
+	return( digest_pipeline_worker_update(
+	         digest_pipeline,
+	         DIGEST_PIPELINE_TYPE_MD5,
+	         storage_media_buffer ) );
+}
+
+/* Callback function of the SHA1 thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_sha1_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     digest_pipeline_t *digest_pipeline )
+{
+	return( digest_pipeline_worker_update(
+	         digest_pipeline,
+	         DIGEST_PIPELINE_TYPE_SHA1,
+	         storage_media_buffer ) );
+}
+
+/* Callback function of the SHA256 thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_sha256_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     digest_pipeline_t *digest_pipeline )
+{
+	return( digest_pipeline_worker_update(
+	         digest_pipeline,
+	         DIGEST_PIPELINE_TYPE_SHA256,
+	         storage_media_buffer ) );
+}
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+/* Pushes a storage media buffer to the digest workers
+ * Buffers must be pushed in order of their storage media offset.
+ * The release function is called once per digest when the digest
+ * no longer uses the buffer, also when pushing the buffer failed
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_push_buffer(
+     digest_pipeline_t *digest_pipeline,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_push_buffer";
+	uint8_t digest_type   = 0;
+	int result            = 1;
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	for( digest_type = DIGEST_PIPELINE_TYPE_MD5;
+	     digest_type <= DIGEST_PIPELINE_TYPE_SHA256;
+	     digest_type <<= 1 )
+	{
+		if( ( digest_pipeline->digest_types & digest_type ) == 0 )
+		{
+			continue;
+		}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		switch( digest_type )
+		{
+			case DIGEST_PIPELINE_TYPE_MD5:
+				thread_pool = digest_pipeline->md5_thread_pool;
+				break;
+
+			case DIGEST_PIPELINE_TYPE_SHA1:
+				thread_pool = digest_pipeline->sha1_thread_pool;
+				break;
+
+			case DIGEST_PIPELINE_TYPE_SHA256:
+				thread_pool = digest_pipeline->sha256_thread_pool;
+				break;
+		}
+		if( ( result == 1 )
+		 && ( thread_pool != NULL ) )
+		{
+			/* The worker releases the buffer
+			 */
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) storage_media_buffer,
+			     error ) == 1 )
+			{
+				continue;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto digest: 0x%02" PRIx8 " thread pool queue.",
+			 function,
+			 digest_type );
+
+			result = -1;
+		}
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+		if( result == 1 )
+		{
+			if( digest_pipeline_update(
+			     digest_pipeline,
+			     digest_type,
+			     storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update digest: 0x%02" PRIx8 ".",
+				 function,
+				 digest_type );
+
+				result = -1;
+			}
+		}
+		if( digest_pipeline->release_function != NULL )
+		{
+			if( digest_pipeline->release_function(
+			     storage_media_buffer,
+			     digest_pipeline->release_arguments ) != 1 )
+			{
+				if( result == 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to release storage media buffer.",
+					 function );
+				}
+				result = -1;
+			}
+		}
+	}
+	if( result != 1 )
+	{
+		digest_pipeline->digest_failed = 1;
+	}
+	return( result );
+}
+
+/* Waits for the digest workers to process all pushed buffers
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_join(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_join";
+	int result            = 1;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( digest_pipeline->md5_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( digest_pipeline->md5_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join MD5 thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( digest_pipeline->sha1_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( digest_pipeline->sha1_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join SHA1 thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( digest_pipeline->sha256_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( digest_pipeline->sha256_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join SHA256 thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+	return( result );
+}
+
+/* Finalizes the digests and sets the calculated hash strings
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_finalize(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error )
+{
+	uint8_t calculated_md5_hash[ MD5_HASH_SIZE ];
+	uint8_t calculated_sha1_hash[ SHA1_HASH_SIZE ];
+	uint8_t calculated_sha256_hash[ SHA256_HASH_SIZE ];
+
+	static char *function = "digest_pipeline_finalize";
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline_join(
+	     digest_pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join digest workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline->digest_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to finalize digests - a digest worker failed.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline->md5_context != NULL )
+	{
+		if( md5_context_finalize(
+		     digest_pipeline->md5_context,
+		     calculated_md5_hash,
+		     MD5_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize MD5 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( digest_hash_copy_to_string(
+		     calculated_md5_hash,
+		     MD5_HASH_SIZE,
+		     digest_pipeline->md5_hash_string,
+		     33,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set calculated MD5 hash string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest_pipeline->sha1_context != NULL )
+	{
+		if( sha1_context_finalize(
+		     digest_pipeline->sha1_context,
+		     calculated_sha1_hash,
+		     SHA1_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA1 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( digest_hash_copy_to_string(
+		     calculated_sha1_hash,
+		     SHA1_HASH_SIZE,
+		     digest_pipeline->sha1_hash_string,
+		     41,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set calculated SHA1 hash string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest_pipeline->sha256_context != NULL )
+	{
+		if( sha256_context_finalize(
+		     digest_pipeline->sha256_context,
+		     calculated_sha256_hash,
+		     SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( digest_hash_copy_to_string(
+		     calculated_sha256_hash,
+		     SHA256_HASH_SIZE,
+		     digest_pipeline->sha256_hash_string,
+		     65,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set calculated SHA256 hash string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the intermediate state of the digests
+ * Only call this function when no buffers are pending in the digest workers
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int digest_pipeline_get_state(
+     digest_pipeline_t *digest_pipeline,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_get_state";
+	int result            = 1;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_size < DIGEST_PIPELINE_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     state,
+	     0,
+	     DIGEST_PIPELINE_STATE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 1 )
+	 && ( digest_pipeline->md5_context != NULL ) )
+	{
+		result = md5_context_get_state(
+		          digest_pipeline->md5_context,
+		          state,
+		          MD5_STATE_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to get MD5 state.",
+			 function );
+
+			return( -1 );
+		}
+	}
+
+	if( ( result == 1 )
+	 && ( digest_pipeline->sha1_context != NULL ) )
+	{
+		result = sha1_context_get_state(
+		          digest_pipeline->sha1_context,
+		          &( state[ MD5_STATE_SIZE ] ),
+		          SHA1_STATE_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to get SHA1 state.",
+			 function );
+
+			return( -1 );
+		}
+	}
+
+	if( ( result == 1 )
+	 && ( digest_pipeline->sha256_context != NULL ) )
+	{
+		result = sha256_context_get_state(
+		          digest_pipeline->sha256_context,
+		          &( state[ MD5_STATE_SIZE + SHA1_STATE_SIZE ] ),
+		          SHA256_STATE_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to get SHA256 state.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Sets the intermediate state of the digests
+ * Only call this function when no buffers are pending in the digest workers
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int digest_pipeline_set_state(
+     digest_pipeline_t *digest_pipeline,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_set_state";
+	int result            = 1;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_size < DIGEST_PIPELINE_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 1 )
+	 && ( digest_pipeline->md5_context != NULL ) )
+	{
+		result = md5_context_set_state(
+		          digest_pipeline->md5_context,
+		          state,
+		          MD5_STATE_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set MD5 state.",
+			 function );
+
+			return( -1 );
+		}
+	}
+
+	if( ( result == 1 )
+	 && ( digest_pipeline->sha1_context != NULL ) )
+	{
+		result = sha1_context_set_state(
+		          digest_pipeline->sha1_context,
+		          &( state[ MD5_STATE_SIZE ] ),
+		          SHA1_STATE_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set SHA1 state.",
+			 function );
+
+			return( -1 );
+		}
+	}
+
+	if( ( result == 1 )
+	 && ( digest_pipeline->sha256_context != NULL ) )
+	{
+		result = sha256_context_set_state(
+		          digest_pipeline->sha256_context,
+		          &( state[ MD5_STATE_SIZE + SHA1_STATE_SIZE ] ),
+		          SHA256_STATE_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set SHA256 state.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
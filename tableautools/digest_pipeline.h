@@ -0,0 +1,182 @@
+/*
+ * Digest pipeline
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIGEST_PIPELINE_H )
+#define _DIGEST_PIPELINE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "md5.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "storage_media_buffer.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum DIGEST_PIPELINE_TYPES
+{
+	DIGEST_PIPELINE_TYPE_MD5	= 0x01,
+	DIGEST_PIPELINE_TYPE_SHA1	= 0x02,
+	DIGEST_PIPELINE_TYPE_SHA256	= 0x04
+};
+
+/* The size of the intermediate state of the digests, every digest type
+ * has a fixed location in the state
+ */
+#define DIGEST_PIPELINE_STATE_SIZE	( MD5_STATE_SIZE + SHA1_STATE_SIZE + SHA256_STATE_SIZE )
+
+typedef struct digest_pipeline digest_pipeline_t;
+
+struct digest_pipeline
+{
+	/* The digest types
+	 */
+	uint8_t digest_types;
+
+	/* The number of digests calculated
+	 */
+	int number_of_digests;
+
+	/* The MD5 context
+	 */
+	md5_context_t *md5_context;
+
+	/* The SHA1 context
+	 */
+	sha1_context_t *sha1_context;
+
+	/* The SHA256 context
+	 */
+	sha256_context_t *sha256_context;
+
+	/* The calculated MD5 hash string
+	 */
+	system_character_t md5_hash_string[ 33 ];
+
+	/* The calculated SHA1 hash string
+	 */
+	system_character_t sha1_hash_string[ 41 ];
+
+	/* The calculated SHA256 hash string
+	 */
+	system_character_t sha256_hash_string[ 65 ];
+
+	/* The function called when a digest no longer uses a buffer
+	 */
+	int (*release_function)(
+	       storage_media_buffer_t *storage_media_buffer,
+	       void *release_arguments );
+
+	/* The arguments of the release function
+	 */
+	void *release_arguments;
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	/* The MD5 thread pool
+	 */
+	libcthreads_thread_pool_t *md5_thread_pool;
+
+	/* The SHA1 thread pool
+	 */
+	libcthreads_thread_pool_t *sha1_thread_pool;
+
+	/* The SHA256 thread pool
+	 */
+	libcthreads_thread_pool_t *sha256_thread_pool;
+#endif
+
+	/* Value to indicate a digest failed
+	 */
+	int digest_failed;
+};
+
+int digest_pipeline_initialize(
+     digest_pipeline_t **digest_pipeline,
+     uint8_t digest_types,
+     int maximum_number_of_buffers,
+     int (*release_function)(
+            storage_media_buffer_t *storage_media_buffer,
+            void *release_arguments ),
+     void *release_arguments,
+     libcerror_error_t **error );
+
+int digest_pipeline_free(
+     digest_pipeline_t **digest_pipeline,
+     libcerror_error_t **error );
+
+int digest_pipeline_update(
+     digest_pipeline_t *digest_pipeline,
+     uint8_t digest_type,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+int digest_pipeline_md5_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     digest_pipeline_t *digest_pipeline );
+
+int digest_pipeline_sha1_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     digest_pipeline_t *digest_pipeline );
+
+int digest_pipeline_sha256_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     digest_pipeline_t *digest_pipeline );
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+int digest_pipeline_push_buffer(
+     digest_pipeline_t *digest_pipeline,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int digest_pipeline_join(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error );
+
+int digest_pipeline_finalize(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error );
+
+int digest_pipeline_get_state(
+     digest_pipeline_t *digest_pipeline,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+int digest_pipeline_set_state(
+     digest_pipeline_t *digest_pipeline,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIGEST_PIPELINE_H ) */
+
@@ -0,0 +1,329 @@
+/*
+ * Host controller topology of the source devices
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "host_topology.h"
+#include "tableautools_libcerror.h"
+
+/* Determines if a string is a PCI address in the form: 0000:00:14.0
+ * Returns 1 if the string is a PCI address or 0 if not
+ */
+int host_topology_is_pci_address(
+     const char *string,
+     size_t string_length )
+{
+	size_t string_index = 0;
+
+	if( ( string == NULL )
+	 || ( string_length != 12 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string_index == 4 )
+		 || ( string_index == 7 ) )
+		{
+			if( string[ string_index ] != ':' )
+			{
+				return( 0 );
+			}
+		}
+		else if( string_index == 10 )
+		{
+			if( string[ string_index ] != '.' )
+			{
+				return( 0 );
+			}
+		}
+		else if( ( ( string[ string_index ] < '0' )
+		       || ( string[ string_index ] > '9' ) )
+		      && ( ( string[ string_index ] < 'a' )
+		       || ( string[ string_index ] > 'f' ) ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the host controller from the sysfs path of a device
+ * The host controller is the PCI device closest to the device, e.g. the USB
+ * host controller, the AHCI controller or the SAS HBA. Every bridge attached
+ * to the same host controller shares its bandwidth
+ * Returns 1 if successful, 0 if the path contains no PCI device or -1 on error
+ */
+int host_topology_get_controller_from_device_path(
+     const char *device_path,
+     size_t device_path_length,
+     char *controller,
+     size_t controller_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "host_topology_get_controller_from_device_path";
+	size_t component_length        = 0;
+	size_t component_start_index   = 0;
+	size_t controller_length       = 0;
+	size_t controller_start_index  = 0;
+	size_t device_path_index       = 0;
+
+	if( device_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device path.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid device path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( controller == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid controller.",
+		 function );
+
+		return( -1 );
+	}
+	if( controller_size < HOST_TOPOLOGY_CONTROLLER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid controller size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( device_path_index = 0;
+	     device_path_index <= device_path_length;
+	     device_path_index++ )
+	{
+		if( ( device_path_index < device_path_length )
+		 && ( device_path[ device_path_index ] != '/' ) )
+		{
+			continue;
+		}
+		component_length = device_path_index - component_start_index;
+
+		if( host_topology_is_pci_address(
+		     &( device_path[ component_start_index ] ),
+		     component_length ) != 0 )
+		{
+			controller_start_index = component_start_index;
+			controller_length      = component_length;
+		}
+		component_start_index = device_path_index + 1;
+	}
+	if( controller_length == 0 )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     controller,
+	     &( device_path[ controller_start_index ] ),
+	     controller_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy controller.",
+		 function );
+
+		return( -1 );
+	}
+	controller[ controller_length ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the host controller of a SCSI generic (sg) or block device
+ * The device is looked up in sysfs, hence this is only supported on Linux
+ * Returns 1 if successful, 0 if the host controller cannot be determined or -1 on error
+ */
+int host_topology_get_controller(
+     const system_character_t *filename,
+     char *controller,
+     size_t controller_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "host_topology_get_controller";
+
+#if defined( __linux__ ) && defined( HAVE_REALPATH ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	char sysfs_path[ 128 ];
+
+	char *device_name       = NULL;
+	char *device_path       = NULL;
+	char *resolved_filename = NULL;
+	size_t device_name_size = 0;
+	int print_count         = 0;
+	int result              = 0;
+#endif
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( controller == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid controller.",
+		 function );
+
+		return( -1 );
+	}
+	if( controller_size < HOST_TOPOLOGY_CONTROLLER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid controller size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __linux__ ) && defined( HAVE_REALPATH ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* Resolve symbolic links such as /dev/disk/by-id/ to the device node
+	 */
+	resolved_filename = realpath(
+	                     filename,
+	                     NULL );
+
+	if( resolved_filename == NULL )
+	{
+		return( 0 );
+	}
+	device_name = narrow_string_search_character_reverse(
+	               resolved_filename,
+	               (int) '/',
+	               narrow_string_length( resolved_filename ) + 1 );
+
+	if( device_name == NULL )
+	{
+		device_name = resolved_filename;
+	}
+	else
+	{
+		device_name++;
+	}
+	device_name_size = narrow_string_length(
+	                    device_name ) + 1;
+
+	if( ( device_name_size > 3 )
+	 && ( device_name[ 0 ] == 's' )
+	 && ( device_name[ 1 ] == 'g' ) )
+	{
+		print_count = narrow_string_snprintf(
+		               sysfs_path,
+		               128,
+		               "/sys/class/scsi_generic/%s/device",
+		               device_name );
+	}
+	else
+	{
+		print_count = narrow_string_snprintf(
+		               sysfs_path,
+		               128,
+		               "/sys/block/%s/device",
+		               device_name );
+	}
+	memory_free(
+	 resolved_filename );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 128 ) )
+	{
+		return( 0 );
+	}
+	device_path = realpath(
+	               sysfs_path,
+	               NULL );
+
+	if( device_path == NULL )
+	{
+		return( 0 );
+	}
+	result = host_topology_get_controller_from_device_path(
+	          device_path,
+	          narrow_string_length( device_path ),
+	          controller,
+	          controller_size,
+	          error );
+
+	memory_free(
+	 device_path );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve controller from device path.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+#else
+	return( 0 );
+#endif
+}
+
@@ -0,0 +1,61 @@
+/*
+ * Host controller topology of the source devices
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _HOST_TOPOLOGY_H )
+#define _HOST_TOPOLOGY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a controller identifier, a PCI address such as 0000:00:14.0
+ * including the end-of-string character
+ */
+#define HOST_TOPOLOGY_CONTROLLER_SIZE	16
+
+int host_topology_is_pci_address(
+     const char *string,
+     size_t string_length );
+
+int host_topology_get_controller_from_device_path(
+     const char *device_path,
+     size_t device_path_length,
+     char *controller,
+     size_t controller_size,
+     libcerror_error_t **error );
+
+int host_topology_get_controller(
+     const system_character_t *filename,
+     char *controller,
+     size_t controller_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _HOST_TOPOLOGY_H ) */
+
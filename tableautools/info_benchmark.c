@@ -0,0 +1,1064 @@
+/*
+ * Query latency benchmark of a Tableau write blocker
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "info_benchmark.h"
+#include "info_record.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libtableau.h"
+#include "tableautools_system_string.h"
+#include "tableautools_time.h"
+#include "tableautools_unused.h"
+
+#define INFO_BENCHMARK_NOTIFY_STREAM	stdout
+
+#define INFO_BENCHMARK_NUMBER_OF_VALUES	14
+
+/* The names of the values of a record
+ */
+static const char *info_benchmark_value_names[ INFO_BENCHMARK_NUMBER_OF_VALUES ] = {
+	"source",
+	"bridge_serial_number",
+	"mode",
+	"number_of_iterations",
+	"number_of_samples",
+	"duration",
+	"transport_minimum",
+	"transport_median",
+	"transport_percentile_99",
+	"transport_maximum",
+	"parse_minimum",
+	"parse_median",
+	"parse_percentile_99",
+	"parse_maximum" };
+
+/* Creates a benchmark
+ * Make sure the value info_benchmark is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int info_benchmark_initialize(
+     info_benchmark_t **info_benchmark,
+     libcerror_error_t **error )
+{
+	static char *function = "info_benchmark_initialize";
+
+	if( info_benchmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_benchmark != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid benchmark value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*info_benchmark = memory_allocate_structure(
+	                   info_benchmark_t );
+
+	if( *info_benchmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create benchmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *info_benchmark,
+	     0,
+	     sizeof( info_benchmark_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear benchmark.",
+		 function );
+
+		memory_free(
+		 *info_benchmark );
+
+		*info_benchmark = NULL;
+
+		return( -1 );
+	}
+	( *info_benchmark )->notify_stream        = INFO_BENCHMARK_NOTIFY_STREAM;
+	( *info_benchmark )->abort_flag           = &( ( *info_benchmark )->abort );
+	( *info_benchmark )->number_of_iterations = 1000;
+
+	return( 1 );
+}
+
+/* Frees a benchmark
+ * Returns 1 if successful or -1 on error
+ */
+int info_benchmark_free(
+     info_benchmark_t **info_benchmark,
+     libcerror_error_t **error )
+{
+	static char *function = "info_benchmark_free";
+
+	if( info_benchmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_benchmark != NULL )
+	{
+		if( ( *info_benchmark )->parse_durations != NULL )
+		{
+			memory_free(
+			 ( *info_benchmark )->parse_durations );
+		}
+		if( ( *info_benchmark )->transport_durations != NULL )
+		{
+			memory_free(
+			 ( *info_benchmark )->transport_durations );
+		}
+		memory_free(
+		 *info_benchmark );
+
+		*info_benchmark = NULL;
+	}
+	return( 1 );
+}
+
+/* Signals the benchmark to abort
+ * The function only sets the abort flag and can be called from a signal
+ * handler
+ * Returns 1 if successful or -1 on error
+ */
+int info_benchmark_signal_abort(
+     info_benchmark_t *info_benchmark,
+     libcerror_error_t **error )
+{
+	static char *function = "info_benchmark_signal_abort";
+
+	if( info_benchmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark.",
+		 function );
+
+		return( -1 );
+	}
+	*( info_benchmark->abort_flag ) = 1;
+
+	return( 1 );
+}
+
+/* Sets the flag that signals the benchmark to abort
+ * A signal handler of the caller only needs to set the flag to abort the
+ * benchmark
+ * If abort_flag is NULL the flag of the benchmark is used
+ * Returns 1 if successful or -1 on error
+ */
+int info_benchmark_set_abort_flag(
+     info_benchmark_t *info_benchmark,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error )
+{
+	static char *function = "info_benchmark_set_abort_flag";
+
+	if( info_benchmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort_flag == NULL )
+	{
+		info_benchmark->abort_flag = &( info_benchmark->abort );
+	}
+	else
+	{
+		info_benchmark->abort_flag = abort_flag;
+	}
+	return( 1 );
+}
+
+/* Sets the number of iterations
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_benchmark_set_number_of_iterations(
+     info_benchmark_t *info_benchmark,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_benchmark_set_number_of_iterations";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( info_benchmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( tableautools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) INFO_BENCHMARK_MAXIMUM_NUMBER_OF_ITERATIONS ) )
+	{
+		return( 0 );
+	}
+	info_benchmark->number_of_iterations = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Compares two durations
+ * Returns -1 if the first is smaller, 1 if the first is larger or 0 if equal
+ */
+static int info_benchmark_compare_durations(
+            const void *first_duration,
+            const void *second_duration )
+{
+	uint64_t first_value  = *( (const uint64_t *) first_duration );
+	uint64_t second_value = *( (const uint64_t *) second_duration );
+
+	if( first_value < second_value )
+	{
+		return( -1 );
+	}
+	else if( first_value > second_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Calculates the statistics of durations
+ * The durations are sorted in place and the percentiles are determined
+ * using the nearest rank, so that every statistic is a measured duration
+ * Returns 1 if successful or -1 on error
+ */
+int info_benchmark_calculate_statistics(
+     uint64_t *durations,
+     uint32_t number_of_durations,
+     info_benchmark_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "info_benchmark_calculate_statistics";
+	uint64_t rank         = 0;
+
+	if( durations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid durations.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_durations == 0 )
+	 || ( number_of_durations > (uint32_t) INFO_BENCHMARK_MAXIMUM_NUMBER_OF_ITERATIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of durations value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	qsort(
+	 durations,
+	 (size_t) number_of_durations,
+	 sizeof( uint64_t ),
+	 &info_benchmark_compare_durations );
+
+	statistics->minimum = durations[ 0 ];
+	statistics->maximum = durations[ number_of_durations - 1 ];
+
+	/* The nearest rank of percentile P of N values is ceil( P * N / 100 )
+	 */
+	rank = ( ( 50 * (uint64_t) number_of_durations ) + 99 ) / 100;
+
+	statistics->median = durations[ rank - 1 ];
+
+	rank = ( ( 99 * (uint64_t) number_of_durations ) + 99 ) / 100;
+
+	statistics->percentile_99 = durations[ rank - 1 ];
+
+	return( 1 );
+}
+
+/* Runs the benchmark
+ * A warm-up query, which is not measured, determines the bridge serial number
+ * after which the iterations are measured back-to-back
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int info_benchmark_run(
+     info_benchmark_t *info_benchmark,
+     libtableau_handle_t *handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "info_benchmark_run";
+	uint64_t end_time       = 0;
+	uint64_t parse_duration = 0;
+	uint64_t start_time     = 0;
+	uint32_t iteration      = 0;
+	int result              = 0;
+
+	if( info_benchmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( info_benchmark->transport_durations != NULL )
+	 || ( info_benchmark->parse_durations != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid benchmark - durations value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( info_benchmark->number_of_iterations == 0 )
+	 || ( info_benchmark->number_of_iterations > (uint32_t) INFO_BENCHMARK_MAXIMUM_NUMBER_OF_ITERATIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid benchmark - number of iterations value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The durations are allocated before the iterations so that no memory
+	 * is allocated while measuring
+	 */
+	info_benchmark->transport_durations = (uint64_t *) memory_allocate(
+	                                                    sizeof( uint64_t ) * info_benchmark->number_of_iterations );
+
+	if( info_benchmark->transport_durations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create transport durations.",
+		 function );
+
+		goto on_error;
+	}
+	info_benchmark->parse_durations = (uint64_t *) memory_allocate(
+	                                                sizeof( uint64_t ) * info_benchmark->number_of_iterations );
+
+	if( info_benchmark->parse_durations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parse durations.",
+		 function );
+
+		goto on_error;
+	}
+	info_benchmark->number_of_samples = 0;
+	info_benchmark->benchmark_time    = 0;
+
+	if( libtableau_handle_query(
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to query Tableau.",
+		 function );
+
+		goto on_error;
+	}
+	result = libtableau_handle_get_value_bridge_serial_number(
+	          handle,
+	          info_benchmark->bridge_serial_number,
+	          INFO_RECORD_VALUE_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bridge serial number.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		info_benchmark->bridge_serial_number[ 0 ] = 0;
+	}
+	if( tableautools_time_get_monotonic_time(
+	     &start_time ) != 1 )
+	{
+		start_time = 0;
+	}
+	for( iteration = 0;
+	     iteration < info_benchmark->number_of_iterations;
+	     iteration++ )
+	{
+		if( *( info_benchmark->abort_flag ) != 0 )
+		{
+			break;
+		}
+		if( info_benchmark->mode == INFO_BENCHMARK_MODE_RAW )
+		{
+			result = libtableau_handle_send_query(
+			          handle,
+			          error );
+		}
+		else
+		{
+			result = libtableau_handle_query(
+			          handle,
+			          error );
+		}
+		if( result != 1 )
+		{
+			/* A query that is interrupted by an abort is not reported
+			 * as an error
+			 */
+			if( *( info_benchmark->abort_flag ) != 0 )
+			{
+				libcerror_error_free(
+				 error );
+
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to query Tableau in iteration: %" PRIu32 ".",
+			 function,
+			 iteration );
+
+			goto on_error;
+		}
+		result = libtableau_handle_get_query_durations(
+		          handle,
+		          &( info_benchmark->transport_durations[ iteration ] ),
+		          &parse_duration,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve query durations in iteration: %" PRIu32 ".",
+			 function,
+			 iteration );
+
+			goto on_error;
+		}
+		info_benchmark->parse_durations[ iteration ] = parse_duration;
+
+		info_benchmark->number_of_samples += 1;
+	}
+	if( ( start_time != 0 )
+	 && ( tableautools_time_get_monotonic_time(
+	       &end_time ) == 1 ) )
+	{
+		info_benchmark->benchmark_time = end_time - start_time;
+	}
+	if( info_benchmark->number_of_samples > 0 )
+	{
+		if( info_benchmark_calculate_statistics(
+		     info_benchmark->transport_durations,
+		     info_benchmark->number_of_samples,
+		     &( info_benchmark->transport_statistics ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate transport statistics.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_benchmark_calculate_statistics(
+		     info_benchmark->parse_durations,
+		     info_benchmark->number_of_samples,
+		     &( info_benchmark->parse_statistics ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate parse statistics.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( *( info_benchmark->abort_flag ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( info_benchmark->parse_durations != NULL )
+	{
+		memory_free(
+		 info_benchmark->parse_durations );
+
+		info_benchmark->parse_durations = NULL;
+	}
+	if( info_benchmark->transport_durations != NULL )
+	{
+		memory_free(
+		 info_benchmark->transport_durations );
+
+		info_benchmark->transport_durations = NULL;
+	}
+	info_benchmark->number_of_samples = 0;
+
+	return( -1 );
+}
+
+/* Prints statistics in microseconds
+ */
+static void info_benchmark_statistics_fprint(
+             FILE *stream,
+             const char *title,
+             info_benchmark_statistics_t *statistics )
+{
+	fprintf(
+	 stream,
+	 "\n%s latency (microseconds)\n",
+	 title );
+
+	fprintf(
+	 stream,
+	 "\tMinimum:\t\t%" PRIu64 ".%03" PRIu64 "\n",
+	 statistics->minimum / 1000,
+	 statistics->minimum % 1000 );
+
+	fprintf(
+	 stream,
+	 "\tMedian:\t\t\t%" PRIu64 ".%03" PRIu64 "\n",
+	 statistics->median / 1000,
+	 statistics->median % 1000 );
+
+	fprintf(
+	 stream,
+	 "\t99th percentile:\t%" PRIu64 ".%03" PRIu64 "\n",
+	 statistics->percentile_99 / 1000,
+	 statistics->percentile_99 % 1000 );
+
+	fprintf(
+	 stream,
+	 "\tMaximum:\t\t%" PRIu64 ".%03" PRIu64 "\n",
+	 statistics->maximum / 1000,
+	 statistics->maximum % 1000 );
+}
+
+/* Prints the benchmark as a single record, including a header in CSV
+ * The durations in the record are in nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+static int info_benchmark_record_fprint(
+            info_benchmark_t *info_benchmark,
+            const char *source,
+            libcerror_error_t **error )
+{
+	info_record_t info_record;
+
+	uint64_t values[ 8 ];
+
+	const char *mode_string = NULL;
+	static char *function   = "info_benchmark_record_fprint";
+	size_t value_length     = 0;
+	int value_index         = 0;
+
+	if( info_benchmark->output_format == INFO_RECORD_FORMAT_CSV )
+	{
+		if( info_record_clear(
+		     &info_record,
+		     info_benchmark->output_format,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clear record.",
+			 function );
+
+			return( -1 );
+		}
+		for( value_index = 0;
+		     value_index < INFO_BENCHMARK_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			value_length = narrow_string_length(
+			                info_benchmark_value_names[ value_index ] );
+
+			if( info_record_append_string(
+			     &info_record,
+			     info_benchmark_value_names[ value_index ],
+			     info_benchmark_value_names[ value_index ],
+			     value_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append name: %s.",
+				 function,
+				 info_benchmark_value_names[ value_index ] );
+
+				return( -1 );
+			}
+		}
+		if( info_record_finalize(
+		     &info_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize header.",
+			 function );
+
+			return( -1 );
+		}
+		if( info_record_write(
+		     &info_record,
+		     info_benchmark->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( info_record_clear(
+	     &info_record,
+	     info_benchmark->output_format,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clear record.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_benchmark->mode == INFO_BENCHMARK_MODE_RAW )
+	{
+		mode_string = "raw";
+	}
+	else
+	{
+		mode_string = "query";
+	}
+	value_length = 0;
+
+	if( source != NULL )
+	{
+		value_length = narrow_string_length(
+		                source );
+	}
+	if( info_record_append_string(
+	     &info_record,
+	     info_benchmark_value_names[ 0 ],
+	     source,
+	     value_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source.",
+		 function );
+
+		return( -1 );
+	}
+	value_length = narrow_string_length(
+	                info_benchmark->bridge_serial_number );
+
+	if( info_record_append_string(
+	     &info_record,
+	     info_benchmark_value_names[ 1 ],
+	     info_benchmark->bridge_serial_number,
+	     value_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append bridge serial number.",
+		 function );
+
+		return( -1 );
+	}
+	value_length = narrow_string_length(
+	                mode_string );
+
+	if( info_record_append_string(
+	     &info_record,
+	     info_benchmark_value_names[ 2 ],
+	     mode_string,
+	     value_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_append_integer(
+	     &info_record,
+	     info_benchmark_value_names[ 3 ],
+	     (uint64_t) info_benchmark->number_of_iterations,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of iterations.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_append_integer(
+	     &info_record,
+	     info_benchmark_value_names[ 4 ],
+	     (uint64_t) info_benchmark->number_of_samples,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_append_integer(
+	     &info_record,
+	     info_benchmark_value_names[ 5 ],
+	     info_benchmark->benchmark_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append duration.",
+		 function );
+
+		return( -1 );
+	}
+	values[ 0 ] = info_benchmark->transport_statistics.minimum;
+	values[ 1 ] = info_benchmark->transport_statistics.median;
+	values[ 2 ] = info_benchmark->transport_statistics.percentile_99;
+	values[ 3 ] = info_benchmark->transport_statistics.maximum;
+	values[ 4 ] = info_benchmark->parse_statistics.minimum;
+	values[ 5 ] = info_benchmark->parse_statistics.median;
+	values[ 6 ] = info_benchmark->parse_statistics.percentile_99;
+	values[ 7 ] = info_benchmark->parse_statistics.maximum;
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		if( info_record_append_integer(
+		     &info_record,
+		     info_benchmark_value_names[ 6 + value_index ],
+		     values[ value_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value: %s.",
+			 function,
+			 info_benchmark_value_names[ 6 + value_index ] );
+
+			return( -1 );
+		}
+	}
+	if( info_record_finalize(
+	     &info_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize record.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_write(
+	     &info_record,
+	     info_benchmark->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the benchmark results
+ * Returns 1 if successful or -1 on error
+ */
+int info_benchmark_fprint(
+     info_benchmark_t *info_benchmark,
+     const char *source,
+     libcerror_error_t **error )
+{
+	static char *function = "info_benchmark_fprint";
+
+	if( info_benchmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_benchmark->output_format != INFO_RECORD_FORMAT_TEXT )
+	{
+		if( info_benchmark_record_fprint(
+		     info_benchmark,
+		     source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print benchmark record.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	fprintf(
+	 info_benchmark->notify_stream,
+	 "Tableau query benchmark\n" );
+
+	if( source != NULL )
+	{
+		fprintf(
+		 info_benchmark->notify_stream,
+		 "\tSource:\t\t\t%s\n",
+		 source );
+	}
+	fprintf(
+	 info_benchmark->notify_stream,
+	 "\tSerial number:\t\t%s\n",
+	 info_benchmark->bridge_serial_number );
+
+	if( info_benchmark->mode == INFO_BENCHMARK_MODE_RAW )
+	{
+		fprintf(
+		 info_benchmark->notify_stream,
+		 "\tMode:\t\t\traw query commands\n" );
+	}
+	else
+	{
+		fprintf(
+		 info_benchmark->notify_stream,
+		 "\tMode:\t\t\tparsed queries\n" );
+	}
+	fprintf(
+	 info_benchmark->notify_stream,
+	 "\tIterations:\t\t%" PRIu32 "\n",
+	 info_benchmark->number_of_iterations );
+
+	fprintf(
+	 info_benchmark->notify_stream,
+	 "\tSamples:\t\t%" PRIu32 "\n",
+	 info_benchmark->number_of_samples );
+
+	fprintf(
+	 info_benchmark->notify_stream,
+	 "\tDuration:\t\t%" PRIu64 ".%03" PRIu64 " ms\n",
+	 info_benchmark->benchmark_time / 1000000,
+	 ( info_benchmark->benchmark_time / 1000 ) % 1000 );
+
+	if( info_benchmark->number_of_samples > 0 )
+	{
+		info_benchmark_statistics_fprint(
+		 info_benchmark->notify_stream,
+		 "Transport",
+		 &( info_benchmark->transport_statistics ) );
+
+		if( info_benchmark->mode != INFO_BENCHMARK_MODE_RAW )
+		{
+			info_benchmark_statistics_fprint(
+			 info_benchmark->notify_stream,
+			 "Parse",
+			 &( info_benchmark->parse_statistics ) );
+		}
+	}
+	fprintf(
+	 info_benchmark->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
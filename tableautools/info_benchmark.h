@@ -0,0 +1,170 @@
+/*
+ * Query latency benchmark of a Tableau write blocker
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INFO_BENCHMARK_H )
+#define _INFO_BENCHMARK_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include <signal.h>
+
+#include "info_record.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libtableau.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define INFO_BENCHMARK_MAXIMUM_NUMBER_OF_ITERATIONS	1000000
+
+enum INFO_BENCHMARK_MODES
+{
+	INFO_BENCHMARK_MODE_QUERY	= 0,
+	INFO_BENCHMARK_MODE_RAW		= 1
+};
+
+typedef struct info_benchmark_statistics info_benchmark_statistics_t;
+
+/* The statistics of a series of durations in nanoseconds
+ */
+struct info_benchmark_statistics
+{
+	/* The minimum
+	 */
+	uint64_t minimum;
+
+	/* The median
+	 */
+	uint64_t median;
+
+	/* The 99th percentile
+	 */
+	uint64_t percentile_99;
+
+	/* The maximum
+	 */
+	uint64_t maximum;
+};
+
+typedef struct info_benchmark info_benchmark_t;
+
+struct info_benchmark
+{
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* The output format
+	 */
+	int output_format;
+
+	/* The mode, either parsed queries or raw query commands
+	 */
+	int mode;
+
+	/* The number of iterations
+	 */
+	uint32_t number_of_iterations;
+
+	/* The bridge serial number, as determined by the warm-up query
+	 */
+	char bridge_serial_number[ INFO_RECORD_VALUE_SIZE ];
+
+	/* The transport durations of the iterations in nanoseconds
+	 */
+	uint64_t *transport_durations;
+
+	/* The parse durations of the iterations in nanoseconds
+	 */
+	uint64_t *parse_durations;
+
+	/* The number of completed iterations
+	 */
+	uint32_t number_of_samples;
+
+	/* The duration of all iterations in nanoseconds
+	 */
+	uint64_t benchmark_time;
+
+	/* The statistics of the transport durations
+	 */
+	info_benchmark_statistics_t transport_statistics;
+
+	/* The statistics of the parse durations
+	 */
+	info_benchmark_statistics_t parse_statistics;
+
+	/* Value to indicate if abort was signalled
+	 */
+	volatile sig_atomic_t abort;
+
+	/* The flag that signals an abort, which references abort if not set
+	 */
+	volatile sig_atomic_t *abort_flag;
+};
+
+int info_benchmark_initialize(
+     info_benchmark_t **info_benchmark,
+     libcerror_error_t **error );
+
+int info_benchmark_free(
+     info_benchmark_t **info_benchmark,
+     libcerror_error_t **error );
+
+int info_benchmark_signal_abort(
+     info_benchmark_t *info_benchmark,
+     libcerror_error_t **error );
+
+int info_benchmark_set_abort_flag(
+     info_benchmark_t *info_benchmark,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error );
+
+int info_benchmark_set_number_of_iterations(
+     info_benchmark_t *info_benchmark,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_benchmark_calculate_statistics(
+     uint64_t *durations,
+     uint32_t number_of_durations,
+     info_benchmark_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int info_benchmark_run(
+     info_benchmark_t *info_benchmark,
+     libtableau_handle_t *handle,
+     libcerror_error_t **error );
+
+int info_benchmark_fprint(
+     info_benchmark_t *info_benchmark,
+     const char *source,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INFO_BENCHMARK_H ) */
+
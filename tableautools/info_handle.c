@@ -22,9 +22,12 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
 #include <types.h>
 
 #include "info_handle.h"
+#include "info_record.h"
 #include "tableautools_libcerror.h"
 #include "tableautools_libtableau.h"
 
@@ -104,6 +107,22 @@ int info_handle_initialize(
 		goto on_error;
 	}
 	( *info_handle )->notify_stream = INFO_HANDLE_NOTIFY_STREAM;
+	( *info_handle )->abort_flag    = &( ( *info_handle )->abort );
+
+	if( libtableau_handle_set_abort_flag(
+	     ( *info_handle )->input_handle,
+	     ( *info_handle )->abort_flag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set abort flag of input handle.",
+		 function );
+
+		goto on_error;
+	}
 
 	return( 1 );
 
@@ -163,6 +182,8 @@ int info_handle_free(
 }
 
 /* Signals the info handle to abort
+ * The input handle shares the abort flag of the info handle, hence the
+ * function only sets the flag and can be called from a signal handler
  * Returns 1 if successful or -1 on error
  */
 int info_handle_signal_abort(
@@ -182,8 +203,161 @@ int info_handle_signal_abort(
 
 		return( -1 );
 	}
-	info_handle->abort = 1;
+	*( info_handle->abort_flag ) = 1;
+
+	return( 1 );
+}
+
+/* Sets the flag that signals the info handle to abort
+ * A signal handler of the caller only needs to set the flag to abort the
+ * queries of the input handle
+ * If abort_flag is NULL the flag of the info handle is used
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_abort_flag(
+     info_handle_t *info_handle,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_abort_flag";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort_flag == NULL )
+	{
+		info_handle->abort_flag = &( info_handle->abort );
+	}
+	else
+	{
+		info_handle->abort_flag = abort_flag;
+	}
+	if( libtableau_handle_set_abort_flag(
+	     info_handle->input_handle,
+	     info_handle->abort_flag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set abort flag of input handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the output format
+ * The string contains one of: text, jsonl, csv
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_output_format";
+	size_t string_length  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 4 )
+	 && ( system_string_compare_no_case(
+	       string,
+	       _SYSTEM_STRING( "text" ),
+	       4 ) == 0 ) )
+	{
+		info_handle->output_format = INFO_RECORD_FORMAT_TEXT;
+	}
+	else if( ( string_length == 5 )
+	      && ( system_string_compare_no_case(
+	            string,
+	            _SYSTEM_STRING( "jsonl" ),
+	            5 ) == 0 ) )
+	{
+		info_handle->output_format = INFO_RECORD_FORMAT_JSONL;
+	}
+	else if( ( string_length == 3 )
+	      && ( system_string_compare_no_case(
+	            string,
+	            _SYSTEM_STRING( "csv" ),
+	            3 ) == 0 ) )
+	{
+		info_handle->output_format = INFO_RECORD_FORMAT_CSV;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Enables the trace of the phases of opening and querying the input handle
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_enable_trace(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_enable_trace";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libtableau_handle_enable_trace(
+	     info_handle->input_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to enable trace.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -231,6 +405,18 @@ int info_handle_open_input(
 
 		return( -1 );
 	}
+	/* A source that does not fit is truncated in the record
+	 */
+	if( narrow_string_snprintf(
+	     info_handle->source,
+	     INFO_RECORD_VALUE_SIZE,
+	     "%" PRIs_SYSTEM "",
+	     filename ) < 0 )
+	{
+		info_handle->source[ 0 ] = 0;
+	}
+	info_handle->source[ INFO_RECORD_VALUE_SIZE - 1 ] = 0;
+
 	return( 1 );
 }
 
@@ -270,6 +456,116 @@ int info_handle_close_input(
 	return( 0 );
 }
 
+/* Prints the header that precedes the device information
+ * Only the CSV output format has a header
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_header_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_header_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_header_fprint(
+	     info_handle->output_format,
+	     info_handle->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the device information as a single record
+ * The record is composed without allocating memory and written with
+ * a single write
+ * Returns 1 if successful or -1 on error
+ */
+static int info_handle_device_record_fprint(
+            info_handle_t *info_handle,
+            libcerror_error_t **error )
+{
+	info_record_t info_record;
+
+	static char *function = "info_handle_device_record_fprint";
+
+	if( info_record_clear(
+	     &info_record,
+	     info_handle->output_format,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clear record.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_set_from_handle(
+	     &info_record,
+	     info_handle->input_handle,
+	     info_handle->source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set record.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_finalize(
+	     &info_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize record.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_write(
+	     &info_record,
+	     info_handle->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Prints the device information
  * Returns 1 if successful or -1 on error
  */
@@ -307,6 +603,23 @@ int info_handle_device_fprint(
 
 		return( -1 );
 	}
+	if( info_handle->output_format != INFO_RECORD_FORMAT_TEXT )
+	{
+		if( info_handle_device_record_fprint(
+		     info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print device record.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
 	fprintf(
 	 info_handle->notify_stream,
 	 "Tableau forensic bridge information\n" );
@@ -1097,3 +1410,149 @@ int info_handle_device_fprint(
 	return( 1 );
 }
 
+
+/* Retrieves the description of a trace phase
+ * The description is followed by tabs to align the times
+ */
+static const char *info_handle_get_trace_phase_description(
+                    uint8_t phase )
+{
+	switch( phase )
+	{
+		case LIBTABLEAU_TRACE_PHASE_OPEN_START:
+			return( "Open start:\t\t" );
+
+		case LIBTABLEAU_TRACE_PHASE_OPEN_END:
+			return( "Open end:\t\t" );
+
+		case LIBTABLEAU_TRACE_PHASE_QUERY_START:
+			return( "Query start:\t\t" );
+
+		case LIBTABLEAU_TRACE_PHASE_QUERY_TRANSPORT_END:
+			return( "Query transport end:\t" );
+
+		case LIBTABLEAU_TRACE_PHASE_QUERY_HEADER_END:
+			return( "Query header end:\t" );
+
+		case LIBTABLEAU_TRACE_PHASE_QUERY_END:
+			return( "Query end:\t\t" );
+
+		case LIBTABLEAU_TRACE_PHASE_FAILED:
+			return( "Failed:\t\t\t" );
+
+		default:
+			break;
+	}
+	return( "Unknown:\t\t" );
+}
+
+/* Prints the trace of the phases of opening and querying the input handle
+ * For each phase the time since the first record and since the previous
+ * record is printed. The trace is printed to stderr if the output format
+ * is not text so that the output only contains records
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_trace_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	FILE *stream                = NULL;
+	static char *function       = "info_handle_trace_fprint";
+	uint64_t elapsed_time       = 0;
+	uint64_t first_timestamp    = 0;
+	uint64_t phase_time         = 0;
+	uint64_t previous_timestamp = 0;
+	uint64_t timestamp          = 0;
+	uint8_t phase               = 0;
+	int number_of_records       = 0;
+	int record_index            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libtableau_handle_get_number_of_trace_records(
+	     info_handle->input_handle,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of trace records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	if( info_handle->output_format == INFO_RECORD_FORMAT_TEXT )
+	{
+		stream = info_handle->notify_stream;
+	}
+	else
+	{
+		stream = stderr;
+	}
+	fprintf(
+	 stream,
+	 "\nTrace (microseconds since the first and previous phase)\n" );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libtableau_handle_get_trace_record_by_index(
+		     info_handle->input_handle,
+		     record_index,
+		     &phase,
+		     &timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve trace record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( record_index == 0 )
+		{
+			first_timestamp    = timestamp;
+			previous_timestamp = timestamp;
+		}
+		elapsed_time = timestamp - first_timestamp;
+		phase_time   = timestamp - previous_timestamp;
+
+		fprintf(
+		 stream,
+		 "\t%s%" PRIu64 ".%03" PRIu64 "\t+%" PRIu64 ".%03" PRIu64 "\n",
+		 info_handle_get_trace_phase_description(
+		  phase ),
+		 elapsed_time / 1000,
+		 elapsed_time % 1000,
+		 phase_time / 1000,
+		 phase_time % 1000 );
+
+		previous_timestamp = timestamp;
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
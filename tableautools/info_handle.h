@@ -26,6 +26,9 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include <signal.h>
+
+#include "info_record.h"
 #include "tableautools_libcerror.h"
 #include "tableautools_libtableau.h"
 
@@ -41,13 +44,25 @@ struct info_handle
 	 */
 	libtableau_handle_t *input_handle;
 
+	/* The source, as printed in a record
+	 */
+	char source[ INFO_RECORD_VALUE_SIZE ];
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
 
+	/* The output format
+	 */
+	int output_format;
+
 	/* Value to indicate if abort was signalled
 	 */
-	int abort;
+	volatile sig_atomic_t abort;
+
+	/* The flag that signals an abort, which references abort if not set
+	 */
+	volatile sig_atomic_t *abort_flag;
 };
 
 int info_handle_initialize(
@@ -62,6 +77,20 @@ int info_handle_signal_abort(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_set_abort_flag(
+     info_handle_t *info_handle,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error );
+
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_enable_trace(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 int info_handle_open_input(
      info_handle_t *info_handle,
      const system_character_t *filename,
@@ -71,10 +100,18 @@ int info_handle_close_input(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_header_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 int info_handle_device_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_trace_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1252 @@
+/*
+ * Inventory of multiple Tableau write blockers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "info_handle.h"
+#include "info_inventory.h"
+#include "info_record.h"
+#include "tableautools_device.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcnotify.h"
+#include "tableautools_libcthreads.h"
+#include "tableautools_libtableau.h"
+#include "tableautools_time.h"
+#include "tableautools_unused.h"
+
+#define INFO_INVENTORY_NOTIFY_STREAM	stdout
+
+/* Creates an inventory
+ * Make sure the value info_inventory is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int info_inventory_initialize(
+     info_inventory_t **info_inventory,
+     libcerror_error_t **error )
+{
+	static char *function = "info_inventory_initialize";
+
+	if( info_inventory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inventory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_inventory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inventory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*info_inventory = memory_allocate_structure(
+	                   info_inventory_t );
+
+	if( *info_inventory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inventory.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *info_inventory,
+	     0,
+	     sizeof( info_inventory_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inventory.",
+		 function );
+
+		memory_free(
+		 *info_inventory );
+
+		*info_inventory = NULL;
+
+		return( -1 );
+	}
+	( *info_inventory )->notify_stream = INFO_INVENTORY_NOTIFY_STREAM;
+	( *info_inventory )->abort_flag    = &( ( *info_inventory )->abort );
+
+	return( 1 );
+}
+
+/* Frees a device
+ * Returns 1 if successful or -1 on error
+ */
+static int info_inventory_free_device(
+            info_inventory_device_t **device,
+            libcerror_error_t **error )
+{
+	static char *function = "info_inventory_free_device";
+	int result            = 1;
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device.",
+		 function );
+
+		return( -1 );
+	}
+	if( *device != NULL )
+	{
+		if( ( *device )->info_handle != NULL )
+		{
+			if( info_handle_free(
+			     &( ( *device )->info_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free info handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *device )->report_stream != NULL )
+		{
+			file_stream_close(
+			 ( *device )->report_stream );
+		}
+		if( ( *device )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *device )->error ) );
+		}
+		if( ( *device )->source != NULL )
+		{
+			memory_free(
+			 ( *device )->source );
+		}
+		memory_free(
+		 *device );
+
+		*device = NULL;
+	}
+	return( result );
+}
+
+/* Frees an inventory
+ * Returns 1 if successful or -1 on error
+ */
+int info_inventory_free(
+     info_inventory_t **info_inventory,
+     libcerror_error_t **error )
+{
+	static char *function = "info_inventory_free";
+	int device_index      = 0;
+	int result            = 1;
+
+	if( info_inventory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inventory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_inventory != NULL )
+	{
+		for( device_index = 0;
+		     device_index < ( *info_inventory )->number_of_devices;
+		     device_index++ )
+		{
+			if( info_inventory_free_device(
+			     &( ( *info_inventory )->devices[ device_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free device: %d.",
+				 function,
+				 device_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *info_inventory );
+
+		*info_inventory = NULL;
+	}
+	return( result );
+}
+
+/* Signals the inventory to abort
+ * The info handles of the devices share the abort flag of the inventory, hence
+ * the function only sets the flag and can be called from a signal handler
+ * Returns 1 if successful or -1 on error
+ */
+int info_inventory_signal_abort(
+     info_inventory_t *info_inventory,
+     libcerror_error_t **error )
+{
+	static char *function = "info_inventory_signal_abort";
+
+	if( info_inventory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inventory.",
+		 function );
+
+		return( -1 );
+	}
+	*( info_inventory->abort_flag ) = 1;
+
+	return( 1 );
+}
+
+/* Sets the flag that signals the inventory to abort
+ * A signal handler of the caller only needs to set the flag to abort the
+ * inventory, the flag is passed to the info handles of the devices
+ * If abort_flag is NULL the flag of the inventory is used
+ * Returns 1 if successful or -1 on error
+ */
+int info_inventory_set_abort_flag(
+     info_inventory_t *info_inventory,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error )
+{
+	static char *function = "info_inventory_set_abort_flag";
+	int device_index      = 0;
+
+	if( info_inventory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inventory.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort_flag == NULL )
+	{
+		info_inventory->abort_flag = &( info_inventory->abort );
+	}
+	else
+	{
+		info_inventory->abort_flag = abort_flag;
+	}
+	for( device_index = 0;
+	     device_index < info_inventory->number_of_devices;
+	     device_index++ )
+	{
+		if( info_handle_set_abort_flag(
+		     info_inventory->devices[ device_index ]->info_handle,
+		     info_inventory->abort_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set abort flag of info handle of device: %d.",
+			 function,
+			 device_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a device
+ * A device that was discovered instead of specified does not need to be
+ * a Tableau write blocker, hence it is not considered failed if it cannot
+ * be queried
+ * Returns 1 if successful, 0 if the device was already appended or -1 on error
+ */
+int info_inventory_append_device(
+     info_inventory_t *info_inventory,
+     const system_character_t *source,
+     size_t source_length,
+     uint8_t is_discovered,
+     libcerror_error_t **error )
+{
+	info_inventory_device_t *device = NULL;
+	static char *function           = "info_inventory_append_device";
+	int device_index                = 0;
+
+	if( info_inventory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inventory.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_length == 0 )
+	 || ( source_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A device that is both specified and discovered is queried once
+	 */
+	for( device_index = 0;
+	     device_index < info_inventory->number_of_devices;
+	     device_index++ )
+	{
+		device = info_inventory->devices[ device_index ];
+
+		if( ( system_string_length( device->source ) == source_length )
+		 && ( system_string_compare(
+		       device->source,
+		       source,
+		       source_length ) == 0 ) )
+		{
+			if( is_discovered == 0 )
+			{
+				device->is_discovered = 0;
+			}
+			return( 0 );
+		}
+	}
+	device = NULL;
+
+	if( info_inventory->number_of_devices >= INFO_INVENTORY_MAXIMUM_NUMBER_OF_DEVICES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: number of devices exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	device = memory_allocate_structure(
+	          info_inventory_device_t );
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create device.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     device,
+	     0,
+	     sizeof( info_inventory_device_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear device.",
+		 function );
+
+		memory_free(
+		 device );
+
+		return( -1 );
+	}
+	device->source = system_string_allocate(
+	                  source_length + 1 );
+
+	if( device->source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     device->source,
+	     source,
+	     source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source.",
+		 function );
+
+		goto on_error;
+	}
+	device->source[ source_length ] = 0;
+
+	if( info_handle_initialize(
+	     &( device->info_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_set_abort_flag(
+	     device->info_handle,
+	     info_inventory->abort_flag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set abort flag of info handle.",
+		 function );
+
+		goto on_error;
+	}
+	device->info_inventory = info_inventory;
+	device->is_discovered  = is_discovered;
+
+	info_inventory->devices[ info_inventory->number_of_devices ] = device;
+
+	info_inventory->number_of_devices += 1;
+
+	return( 1 );
+
+on_error:
+	if( device != NULL )
+	{
+		info_inventory_free_device(
+		 &device,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a discovered device
+ * Callback function for tableautools_device_discover
+ * Returns 1 if successful or -1 on error
+ */
+static int info_inventory_append_discovered_device(
+            intptr_t *info_inventory,
+            const system_character_t *device_name,
+            size_t device_name_length,
+            libcerror_error_t **error )
+{
+	static char *function = "info_inventory_append_discovered_device";
+
+	if( info_inventory_append_device(
+	     (info_inventory_t *) info_inventory,
+	     device_name,
+	     device_name_length,
+	     1,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append device.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Discovers the SCSI generic devices
+ * Discovery is only supported on Linux, where every Tableau write blocker
+ * is accessible as a /dev/sg# device
+ * Returns 1 if successful or -1 on error
+ */
+int info_inventory_discover_devices(
+     info_inventory_t *info_inventory,
+     libcerror_error_t **error )
+{
+	static char *function = "info_inventory_discover_devices";
+
+	if( info_inventory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inventory.",
+		 function );
+
+		return( -1 );
+	}
+	if( tableautools_device_discover(
+	     &info_inventory_append_discovered_device,
+	     (intptr_t *) info_inventory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to discover devices.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Queries a device
+ * The device information is printed to the report stream of the device
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+static int info_inventory_query_device(
+            info_inventory_device_t *device,
+            libcerror_error_t **error )
+{
+	static char *function = "info_inventory_query_device";
+	uint64_t end_time     = 0;
+	uint64_t start_time   = 0;
+	int input_opened      = 0;
+	int result            = 0;
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device.",
+		 function );
+
+		return( -1 );
+	}
+	if( device->report_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid device - report stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( tableautools_time_get_monotonic_time(
+	     &start_time ) != 1 )
+	{
+		start_time = 0;
+	}
+	device->report_stream = tmpfile();
+
+	if( device->report_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create report stream.",
+		 function );
+
+		goto on_error;
+	}
+	device->info_handle->notify_stream = device->report_stream;
+	device->info_handle->output_format = device->info_inventory->output_format;
+
+	if( info_handle_open_input(
+	     device->info_handle,
+	     device->source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open device: %" PRIs_SYSTEM ".",
+		 function,
+		 device->source );
+
+		goto on_error;
+	}
+	input_opened = 1;
+
+	if( info_handle_device_fprint(
+	     device->info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print device information.",
+		 function );
+
+		goto on_error;
+	}
+	/* The bridge values were retrieved by the query of info_handle_device_fprint
+	 */
+	result = libtableau_handle_get_value_bridge_serial_number(
+	          device->info_handle->input_handle,
+	          device->serial_number,
+	          INFO_INVENTORY_SERIAL_NUMBER_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bridge serial number.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		device->serial_number[ 0 ] = 0;
+	}
+	input_opened = 0;
+
+	if( info_handle_close_input(
+	     device->info_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close device.",
+		 function );
+
+		goto on_error;
+	}
+	if( tableautools_time_get_monotonic_time(
+	     &end_time ) == 1 )
+	{
+		device->query_time = ( end_time - start_time ) / 1000;
+	}
+	return( 1 );
+
+on_error:
+	if( input_opened != 0 )
+	{
+		info_handle_close_input(
+		 device->info_handle,
+		 NULL );
+	}
+	device->serial_number[ 0 ] = 0;
+
+	if( tableautools_time_get_monotonic_time(
+	     &end_time ) == 1 )
+	{
+		device->query_time = ( end_time - start_time ) / 1000;
+	}
+	if( *( device->info_handle->abort_flag ) != 0 )
+	{
+		return( 0 );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+/* Callback function of the query thread pool
+ * The error of a failed query is kept with the device so that it is
+ * printed as part of the report instead of interleaved with other output
+ * Returns 1 if successful or -1 on error
+ */
+int info_inventory_query_callback(
+     info_inventory_device_t *device,
+     info_inventory_t *info_inventory )
+{
+	if( ( device == NULL )
+	 || ( info_inventory == NULL ) )
+	{
+		return( -1 );
+	}
+	if( *( info_inventory->abort_flag ) != 0 )
+	{
+		device->result = 0;
+
+		return( 1 );
+	}
+	device->result = info_inventory_query_device(
+	                  device,
+	                  &( device->error ) );
+
+	/* The buffered debug output of the query is kept by the thread of
+	 * the pool, hence it is printed before the thread continues
+	 */
+	libtableau_notify_flush(
+	 NULL );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+/* Queries the devices
+ * The devices are queried concurrently by a thread pool of at most
+ * INFO_INVENTORY_MAXIMUM_NUMBER_OF_THREADS threads. Without multi-threading
+ * support the devices are queried one after the other
+ * Returns 1 if all specified devices were queried, 0 if a specified device
+ * failed or was aborted or -1 on error
+ */
+int info_inventory_run(
+     info_inventory_t *info_inventory,
+     libcerror_error_t **error )
+{
+	info_inventory_device_t *device              = NULL;
+	static char *function                        = "info_inventory_run";
+	uint64_t end_time                            = 0;
+	uint64_t start_time                          = 0;
+	int device_index                             = 0;
+	int result                                   = 0;
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *query_thread_pool = NULL;
+	int number_of_threads                        = 0;
+#endif
+
+	if( info_inventory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inventory.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_inventory->number_of_devices == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inventory - missing devices.",
+		 function );
+
+		return( -1 );
+	}
+	if( tableautools_time_get_monotonic_time(
+	     &start_time ) != 1 )
+	{
+		start_time = 0;
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	number_of_threads = info_inventory->number_of_devices;
+
+	if( number_of_threads > INFO_INVENTORY_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		number_of_threads = INFO_INVENTORY_MAXIMUM_NUMBER_OF_THREADS;
+	}
+	if( libcthreads_thread_pool_create(
+	     &query_thread_pool,
+	     NULL,
+	     number_of_threads,
+	     info_inventory->number_of_devices,
+	     (int (*)(intptr_t *, void *)) &info_inventory_query_callback,
+	     (void *) info_inventory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create query thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( device_index = 0;
+	     device_index < info_inventory->number_of_devices;
+	     device_index++ )
+	{
+		if( libcthreads_thread_pool_push(
+		     query_thread_pool,
+		     (intptr_t *) info_inventory->devices[ device_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push device: %d onto query thread pool queue.",
+			 function,
+			 device_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_pool_join(
+	     &query_thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join query thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	for( device_index = 0;
+	     device_index < info_inventory->number_of_devices;
+	     device_index++ )
+	{
+		device = info_inventory->devices[ device_index ];
+
+		if( *( info_inventory->abort_flag ) != 0 )
+		{
+			device->result = 0;
+
+			continue;
+		}
+		device->result = info_inventory_query_device(
+		                  device,
+		                  &( device->error ) );
+	}
+#endif
+	if( tableautools_time_get_monotonic_time(
+	     &end_time ) == 1 )
+	{
+		info_inventory->inventory_time = ( end_time - start_time ) / 1000;
+	}
+	result = 1;
+
+	for( device_index = 0;
+	     device_index < info_inventory->number_of_devices;
+	     device_index++ )
+	{
+		device = info_inventory->devices[ device_index ];
+
+		if( ( device->is_discovered == 0 )
+		 && ( device->result != 1 ) )
+		{
+			result = 0;
+		}
+	}
+	if( *( info_inventory->abort_flag ) != 0 )
+	{
+		result = 0;
+	}
+	return( result );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+on_error:
+	if( query_thread_pool != NULL )
+	{
+		info_inventory_signal_abort(
+		 info_inventory,
+		 NULL );
+
+		libcthreads_thread_pool_join(
+		 &query_thread_pool,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Compares two devices
+ * Devices with a bridge serial number are ordered by serial number, followed
+ * by the devices without a serial number and the devices that could not
+ * be queried, all of which are ordered by source
+ * Returns -1, 0 or 1 as required by qsort
+ */
+static int info_inventory_compare_devices(
+            const void *first_value,
+            const void *second_value )
+{
+	info_inventory_device_t *first_device  = NULL;
+	info_inventory_device_t *second_device = NULL;
+	int first_rank                         = 0;
+	int result                             = 0;
+	int second_rank                        = 0;
+
+	first_device  = *( (info_inventory_device_t **) first_value );
+	second_device = *( (info_inventory_device_t **) second_value );
+
+	if( first_device->result != 1 )
+	{
+		first_rank = 2;
+	}
+	else if( first_device->serial_number[ 0 ] == 0 )
+	{
+		first_rank = 1;
+	}
+	if( second_device->result != 1 )
+	{
+		second_rank = 2;
+	}
+	else if( second_device->serial_number[ 0 ] == 0 )
+	{
+		second_rank = 1;
+	}
+	if( first_rank != second_rank )
+	{
+		return( ( first_rank < second_rank ) ? -1 : 1 );
+	}
+	if( first_rank == 0 )
+	{
+		result = narrow_string_compare(
+		          first_device->serial_number,
+		          second_device->serial_number,
+		          INFO_INVENTORY_SERIAL_NUMBER_SIZE );
+	}
+	if( result == 0 )
+	{
+		result = system_string_compare(
+		          first_device->source,
+		          second_device->source,
+		          system_string_length( first_device->source ) + 1 );
+	}
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the devices by bridge serial number
+ * Returns 1 if successful or -1 on error
+ */
+int info_inventory_sort_devices(
+     info_inventory_t *info_inventory,
+     libcerror_error_t **error )
+{
+	static char *function = "info_inventory_sort_devices";
+
+	if( info_inventory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inventory.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_inventory->number_of_devices > 1 )
+	{
+		qsort(
+		 info_inventory->devices,
+		 (size_t) info_inventory->number_of_devices,
+		 sizeof( info_inventory_device_t * ),
+		 &info_inventory_compare_devices );
+	}
+	return( 1 );
+}
+
+/* Prints the report of a device
+ * Returns 1 if successful or -1 on error
+ */
+static int info_inventory_device_fprint(
+            info_inventory_t *info_inventory,
+            info_inventory_device_t *device,
+            libcerror_error_t **error )
+{
+	char report_data[ 512 ];
+
+	static char *function = "info_inventory_device_fprint";
+	FILE *message_stream  = NULL;
+	size_t read_count     = 0;
+
+	/* In a machine-readable output format only the records of the queried
+	 * devices are printed and the failures are reported on stderr
+	 */
+	if( info_inventory->output_format != INFO_RECORD_FORMAT_TEXT )
+	{
+		message_stream = stderr;
+
+		if( device->result != 1 )
+		{
+			fprintf(
+			 message_stream,
+			 "Device: %" PRIs_SYSTEM "\n",
+			 device->source );
+		}
+	}
+	else
+	{
+		message_stream = info_inventory->notify_stream;
+
+		fprintf(
+		 message_stream,
+		 "Device: %" PRIs_SYSTEM " (queried in %" PRIu64 ".%03" PRIu64 " ms)\n",
+		 device->source,
+		 device->query_time / 1000,
+		 device->query_time % 1000 );
+	}
+	if( ( device->report_stream != NULL )
+	 && ( ( info_inventory->output_format == INFO_RECORD_FORMAT_TEXT )
+	  || ( device->result == 1 ) ) )
+	{
+		if( file_stream_seek_offset(
+		     device->report_stream,
+		     0,
+		     SEEK_SET ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek start of report stream.",
+			 function );
+
+			return( -1 );
+		}
+		do
+		{
+			read_count = file_stream_read(
+			              device->report_stream,
+			              report_data,
+			              512 );
+
+			if( read_count > 0 )
+			{
+				if( file_stream_write(
+				     info_inventory->notify_stream,
+				     report_data,
+				     read_count ) != read_count )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write report.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		while( read_count == 512 );
+	}
+	if( device->result == 0 )
+	{
+		fprintf(
+		 message_stream,
+		 "Aborted while querying device.\n" );
+	}
+	else if( device->result != 1 )
+	{
+		if( device->is_discovered != 0 )
+		{
+			fprintf(
+			 message_stream,
+			 "Unable to query device, which might not be a Tableau write blocker.\n" );
+		}
+		else
+		{
+			fprintf(
+			 message_stream,
+			 "Unable to query device.\n" );
+		}
+		if( ( device->error != NULL )
+		 && ( ( device->is_discovered == 0 )
+		  || ( info_inventory->verbose != 0 ) ) )
+		{
+			libcerror_error_backtrace_fprint(
+			 device->error,
+			 message_stream );
+		}
+	}
+	if( ( info_inventory->output_format == INFO_RECORD_FORMAT_TEXT )
+	 || ( device->result != 1 ) )
+	{
+		fprintf(
+		 message_stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Prints the reports of the devices ordered by bridge serial number
+ * and a summary of the inventory
+ * In a machine-readable output format the summary is not printed
+ * Returns 1 if successful or -1 on error
+ */
+int info_inventory_fprint(
+     info_inventory_t *info_inventory,
+     libcerror_error_t **error )
+{
+	static char *function        = "info_inventory_fprint";
+	int device_index             = 0;
+	int number_of_failed_devices = 0;
+
+	if( info_inventory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inventory.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_inventory_sort_devices(
+	     info_inventory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort devices.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_header_fprint(
+	     info_inventory->output_format,
+	     info_inventory->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print header.",
+		 function );
+
+		return( -1 );
+	}
+	for( device_index = 0;
+	     device_index < info_inventory->number_of_devices;
+	     device_index++ )
+	{
+		if( info_inventory_device_fprint(
+		     info_inventory,
+		     info_inventory->devices[ device_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print device: %d.",
+			 function,
+			 device_index );
+
+			return( -1 );
+		}
+		if( info_inventory->devices[ device_index ]->result != 1 )
+		{
+			number_of_failed_devices++;
+		}
+	}
+	if( info_inventory->output_format != INFO_RECORD_FORMAT_TEXT )
+	{
+		return( 1 );
+	}
+	fprintf(
+	 info_inventory->notify_stream,
+	 "Inventory completed\n" );
+
+	fprintf(
+	 info_inventory->notify_stream,
+	 "\tNumber of devices\t: %d (%d not queried)\n",
+	 info_inventory->number_of_devices,
+	 number_of_failed_devices );
+
+	fprintf(
+	 info_inventory->notify_stream,
+	 "\tDuration\t\t: %" PRIu64 ".%03" PRIu64 " ms\n",
+	 info_inventory->inventory_time / 1000,
+	 info_inventory->inventory_time % 1000 );
+
+	fprintf(
+	 info_inventory->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
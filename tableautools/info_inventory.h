@@ -0,0 +1,180 @@
+/*
+ * Inventory of multiple Tableau write blockers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INFO_INVENTORY_H )
+#define _INFO_INVENTORY_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include <signal.h>
+
+#include "info_handle.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define INFO_INVENTORY_MAXIMUM_NUMBER_OF_DEVICES	256
+
+/* The maximum number of devices that are queried concurrently
+ */
+#define INFO_INVENTORY_MAXIMUM_NUMBER_OF_THREADS	32
+
+#define INFO_INVENTORY_SERIAL_NUMBER_SIZE		32
+
+typedef struct info_inventory info_inventory_t;
+
+typedef struct info_inventory_device info_inventory_device_t;
+
+struct info_inventory_device
+{
+	/* The inventory
+	 */
+	info_inventory_t *info_inventory;
+
+	/* The source device
+	 */
+	system_character_t *source;
+
+	/* Value to indicate the device was discovered instead of specified
+	 */
+	uint8_t is_discovered;
+
+	/* The info handle
+	 */
+	info_handle_t *info_handle;
+
+	/* The stream the device information is printed to while querying,
+	 * so that concurrent queries do not interleave their output
+	 */
+	FILE *report_stream;
+
+	/* The bridge serial number, an empty string if unknown
+	 */
+	char serial_number[ INFO_INVENTORY_SERIAL_NUMBER_SIZE ];
+
+	/* The duration of the query in microseconds
+	 */
+	uint64_t query_time;
+
+	/* The result, 1 if the query succeeded, 0 if it was aborted
+	 * and -1 on error
+	 */
+	int result;
+
+	/* The error of a failed query
+	 */
+	libcerror_error_t *error;
+};
+
+struct info_inventory
+{
+	/* The devices
+	 */
+	info_inventory_device_t *devices[ INFO_INVENTORY_MAXIMUM_NUMBER_OF_DEVICES ];
+
+	/* The number of devices
+	 */
+	int number_of_devices;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate the errors of the failed queries should be printed
+	 */
+	uint8_t verbose;
+
+	/* The output format
+	 */
+	int output_format;
+
+	/* The duration of the inventory in microseconds
+	 */
+	uint64_t inventory_time;
+
+	/* Value to indicate if abort was signalled
+	 */
+	volatile sig_atomic_t abort;
+
+	/* The flag that signals an abort, which references abort if not set
+	 */
+	volatile sig_atomic_t *abort_flag;
+};
+
+int info_inventory_initialize(
+     info_inventory_t **info_inventory,
+     libcerror_error_t **error );
+
+int info_inventory_free(
+     info_inventory_t **info_inventory,
+     libcerror_error_t **error );
+
+int info_inventory_signal_abort(
+     info_inventory_t *info_inventory,
+     libcerror_error_t **error );
+
+int info_inventory_set_abort_flag(
+     info_inventory_t *info_inventory,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error );
+
+int info_inventory_append_device(
+     info_inventory_t *info_inventory,
+     const system_character_t *source,
+     size_t source_length,
+     uint8_t is_discovered,
+     libcerror_error_t **error );
+
+int info_inventory_discover_devices(
+     info_inventory_t *info_inventory,
+     libcerror_error_t **error );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+int info_inventory_query_callback(
+     info_inventory_device_t *device,
+     info_inventory_t *info_inventory );
+
+#endif
+
+int info_inventory_run(
+     info_inventory_t *info_inventory,
+     libcerror_error_t **error );
+
+int info_inventory_sort_devices(
+     info_inventory_t *info_inventory,
+     libcerror_error_t **error );
+
+int info_inventory_fprint(
+     info_inventory_t *info_inventory,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INFO_INVENTORY_H ) */
+
@@ -0,0 +1,761 @@
+/*
+ * Machine-readable record of the information of a Tableau write blocker
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "info_record.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libtableau.h"
+
+#define INFO_RECORD_NUMBER_OF_VALUES	26
+
+/* The names of the values in record order, the source is followed by
+ * the identifiers of the string values of the handle and the numbers of sectors
+ */
+static const char *info_record_value_names[ INFO_RECORD_NUMBER_OF_VALUES ] = {
+	"source",
+	"bridge_vendor",
+	"bridge_model",
+	"bridge_serial_number",
+	"bridge_firmware_date",
+	"bridge_firmware_time",
+	"bridge_firmware_stepping",
+	"bridge_debug_firmware",
+	"bridge_channel_index",
+	"bridge_channel_type",
+	"bridge_mode_read_only",
+	"bridge_report_read_only",
+	"bridge_report_write_error",
+	"drive_vendor",
+	"drive_model",
+	"drive_serial_number",
+	"drive_revision_number",
+	"drive_hpa_support",
+	"drive_hpa_in_use",
+	"drive_dco_support",
+	"drive_dco_in_use",
+	"drive_security_support",
+	"drive_security_in_use",
+	"drive_number_of_sectors",
+	"hpa_number_of_sectors",
+	"dco_number_of_sectors" };
+
+static const char *info_record_hexadecimal_digits = "0123456789abcdef";
+
+/* Clears a record and starts a new record in a specific format
+ * Returns 1 if successful or -1 on error
+ */
+int info_record_clear(
+     info_record_t *info_record,
+     int format,
+     libcerror_error_t **error )
+{
+	static char *function = "info_record_clear";
+
+	if( info_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != INFO_RECORD_FORMAT_JSONL )
+	 && ( format != INFO_RECORD_FORMAT_CSV ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	info_record->format           = format;
+	info_record->data_size        = 0;
+	info_record->number_of_values = 0;
+
+	if( format == INFO_RECORD_FORMAT_JSONL )
+	{
+		info_record->data[ info_record->data_size++ ] = '{';
+	}
+	return( 1 );
+}
+
+/* Appends the name of a value and the separator that precedes it
+ * Returns 1 if successful or -1 on error
+ */
+static int info_record_append_name(
+            info_record_t *info_record,
+            const char *name,
+            libcerror_error_t **error )
+{
+	static char *function = "info_record_append_name";
+	size_t name_length    = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	/* The name is not escaped, it consists of the characters of an identifier
+	 */
+	if( ( info_record->data_size + name_length + 4 ) > INFO_RECORD_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record->number_of_values > 0 )
+	{
+		info_record->data[ info_record->data_size++ ] = ',';
+	}
+	if( info_record->format == INFO_RECORD_FORMAT_JSONL )
+	{
+		info_record->data[ info_record->data_size++ ] = '"';
+
+		if( memory_copy(
+		     &( info_record->data[ info_record->data_size ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+		info_record->data_size += name_length;
+
+		info_record->data[ info_record->data_size++ ] = '"';
+		info_record->data[ info_record->data_size++ ] = ':';
+	}
+	info_record->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Appends a string value
+ * In JSON Lines the value is escaped as a JSON string, where bytes outside
+ * the ASCII range are escaped as their code point, a missing value is null
+ * In CSV the value is quoted if it contains a separator, quote or line break,
+ * a missing value is empty
+ * Returns 1 if successful or -1 on error
+ */
+int info_record_append_string(
+     info_record_t *info_record,
+     const char *name,
+     const char *value,
+     size_t value_length,
+     libcerror_error_t **error )
+{
+	static char *function = "info_record_append_string";
+	size_t value_index    = 0;
+	uint8_t byte_value    = 0;
+	uint8_t quote_value   = 0;
+
+	if( info_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_length > (size_t) INFO_RECORD_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_append_name(
+	     info_record,
+	     name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		if( info_record->format == INFO_RECORD_FORMAT_JSONL )
+		{
+			if( ( info_record->data_size + 4 ) > INFO_RECORD_DATA_SIZE )
+			{
+				goto on_error;
+			}
+			info_record->data[ info_record->data_size++ ] = 'n';
+			info_record->data[ info_record->data_size++ ] = 'u';
+			info_record->data[ info_record->data_size++ ] = 'l';
+			info_record->data[ info_record->data_size++ ] = 'l';
+		}
+		return( 1 );
+	}
+	if( info_record->format == INFO_RECORD_FORMAT_JSONL )
+	{
+		quote_value = 1;
+	}
+	else
+	{
+		for( value_index = 0;
+		     value_index < value_length;
+		     value_index++ )
+		{
+			byte_value = (uint8_t) value[ value_index ];
+
+			if( ( byte_value == (uint8_t) ',' )
+			 || ( byte_value == (uint8_t) '"' )
+			 || ( byte_value == (uint8_t) '\r' )
+			 || ( byte_value == (uint8_t) '\n' ) )
+			{
+				quote_value = 1;
+
+				break;
+			}
+		}
+	}
+	if( quote_value != 0 )
+	{
+		if( ( info_record->data_size + 2 ) > INFO_RECORD_DATA_SIZE )
+		{
+			goto on_error;
+		}
+		info_record->data[ info_record->data_size++ ] = '"';
+	}
+	for( value_index = 0;
+	     value_index < value_length;
+	     value_index++ )
+	{
+		byte_value = (uint8_t) value[ value_index ];
+
+		/* Reserve space for the largest escape sequence and the closing quote
+		 */
+		if( ( info_record->data_size + 7 ) > INFO_RECORD_DATA_SIZE )
+		{
+			goto on_error;
+		}
+		if( info_record->format == INFO_RECORD_FORMAT_CSV )
+		{
+			if( byte_value == (uint8_t) '"' )
+			{
+				info_record->data[ info_record->data_size++ ] = '"';
+			}
+			info_record->data[ info_record->data_size++ ] = (char) byte_value;
+		}
+		else if( ( byte_value == (uint8_t) '"' )
+		      || ( byte_value == (uint8_t) '\\' ) )
+		{
+			info_record->data[ info_record->data_size++ ] = '\\';
+			info_record->data[ info_record->data_size++ ] = (char) byte_value;
+		}
+		else if( byte_value == (uint8_t) '\n' )
+		{
+			info_record->data[ info_record->data_size++ ] = '\\';
+			info_record->data[ info_record->data_size++ ] = 'n';
+		}
+		else if( byte_value == (uint8_t) '\r' )
+		{
+			info_record->data[ info_record->data_size++ ] = '\\';
+			info_record->data[ info_record->data_size++ ] = 'r';
+		}
+		else if( byte_value == (uint8_t) '\t' )
+		{
+			info_record->data[ info_record->data_size++ ] = '\\';
+			info_record->data[ info_record->data_size++ ] = 't';
+		}
+		else if( ( byte_value < 0x20 )
+		      || ( byte_value >= 0x7f ) )
+		{
+			info_record->data[ info_record->data_size++ ] = '\\';
+			info_record->data[ info_record->data_size++ ] = 'u';
+			info_record->data[ info_record->data_size++ ] = '0';
+			info_record->data[ info_record->data_size++ ] = '0';
+			info_record->data[ info_record->data_size++ ] = info_record_hexadecimal_digits[ byte_value >> 4 ];
+			info_record->data[ info_record->data_size++ ] = info_record_hexadecimal_digits[ byte_value & 0x0f ];
+		}
+		else
+		{
+			info_record->data[ info_record->data_size++ ] = (char) byte_value;
+		}
+	}
+	if( quote_value != 0 )
+	{
+		info_record->data[ info_record->data_size++ ] = '"';
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid record data size value out of bounds.",
+	 function );
+
+	return( -1 );
+}
+
+/* Appends an integer value
+ * Returns 1 if successful or -1 on error
+ */
+int info_record_append_integer(
+     info_record_t *info_record,
+     const char *name,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	char digits[ 20 ];
+
+	static char *function = "info_record_append_integer";
+	int digit_index       = 0;
+
+	if( info_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_append_name(
+	     info_record,
+	     name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		digits[ digit_index++ ] = (char) ( '0' + ( value % 10 ) );
+
+		value /= 10;
+	}
+	while( value > 0 );
+
+	if( ( info_record->data_size + digit_index ) > INFO_RECORD_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( digit_index > 0 )
+	{
+		info_record->data[ info_record->data_size++ ] = digits[ --digit_index ];
+	}
+	return( 1 );
+}
+
+/* Finalizes a record
+ * Returns 1 if successful or -1 on error
+ */
+int info_record_finalize(
+     info_record_t *info_record,
+     libcerror_error_t **error )
+{
+	static char *function = "info_record_finalize";
+
+	if( info_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( info_record->data_size + 2 ) > INFO_RECORD_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record->format == INFO_RECORD_FORMAT_JSONL )
+	{
+		info_record->data[ info_record->data_size++ ] = '}';
+	}
+	info_record->data[ info_record->data_size++ ] = '\n';
+
+	return( 1 );
+}
+
+/* Sets the record from the values of a queried handle
+ * Returns 1 if successful or -1 on error
+ */
+int info_record_set_from_handle(
+     info_record_t *info_record,
+     libtableau_handle_t *handle,
+     const char *source,
+     libcerror_error_t **error )
+{
+	char value_string[ INFO_RECORD_VALUE_SIZE ];
+
+	static char *function      = "info_record_set_from_handle";
+	size_t value_length        = 0;
+	uint32_t number_of_sectors = 0;
+	int result                 = 0;
+	int value_index            = 0;
+
+	if( info_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( source != NULL )
+	{
+		value_length = narrow_string_length(
+		                source );
+	}
+	if( info_record_append_string(
+	     info_record,
+	     info_record_value_names[ 0 ],
+	     source,
+	     value_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 1;
+	     value_index < INFO_RECORD_NUMBER_OF_VALUES - 3;
+	     value_index++ )
+	{
+		result = libtableau_handle_get_value(
+		          handle,
+		          info_record_value_names[ value_index ],
+		          value_string,
+		          INFO_RECORD_VALUE_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %s.",
+			 function,
+			 info_record_value_names[ value_index ] );
+
+			return( -1 );
+		}
+		if( result == 1 )
+		{
+			value_length = narrow_string_length(
+			                value_string );
+		}
+		if( info_record_append_string(
+		     info_record,
+		     info_record_value_names[ value_index ],
+		     ( result == 1 ) ? value_string : NULL,
+		     ( result == 1 ) ? value_length : 0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value: %s.",
+			 function,
+			 info_record_value_names[ value_index ] );
+
+			return( -1 );
+		}
+	}
+	for( value_index = INFO_RECORD_NUMBER_OF_VALUES - 3;
+	     value_index < INFO_RECORD_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		if( value_index == ( INFO_RECORD_NUMBER_OF_VALUES - 3 ) )
+		{
+			result = libtableau_handle_get_drive_number_of_sectors(
+			          handle,
+			          &number_of_sectors,
+			          error );
+		}
+		else if( value_index == ( INFO_RECORD_NUMBER_OF_VALUES - 2 ) )
+		{
+			result = libtableau_handle_get_hpa_number_of_sectors(
+			          handle,
+			          &number_of_sectors,
+			          error );
+		}
+		else
+		{
+			result = libtableau_handle_get_dco_number_of_sectors(
+			          handle,
+			          &number_of_sectors,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %s.",
+			 function,
+			 info_record_value_names[ value_index ] );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			result = info_record_append_string(
+			          info_record,
+			          info_record_value_names[ value_index ],
+			          NULL,
+			          0,
+			          error );
+		}
+		else
+		{
+			result = info_record_append_integer(
+			          info_record,
+			          info_record_value_names[ value_index ],
+			          (uint64_t) number_of_sectors,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value: %s.",
+			 function,
+			 info_record_value_names[ value_index ] );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes a record to a stream with a single write
+ * Returns 1 if successful or -1 on error
+ */
+int info_record_write(
+     info_record_t *info_record,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "info_record_write";
+
+	if( info_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream_write(
+	     stream,
+	     info_record->data,
+	     info_record->data_size ) != info_record->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the header of the records
+ * Only CSV has a header, which contains the names of the values
+ * Returns 1 if successful or -1 on error
+ */
+int info_record_header_fprint(
+     int format,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	info_record_t info_record;
+
+	static char *function = "info_record_header_fprint";
+	size_t name_length    = 0;
+	int value_index       = 0;
+
+	if( format != INFO_RECORD_FORMAT_CSV )
+	{
+		return( 1 );
+	}
+	if( info_record_clear(
+	     &info_record,
+	     format,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clear record.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < INFO_RECORD_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		name_length = narrow_string_length(
+		               info_record_value_names[ value_index ] );
+
+		if( info_record_append_string(
+		     &info_record,
+		     info_record_value_names[ value_index ],
+		     info_record_value_names[ value_index ],
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append name: %s.",
+			 function,
+			 info_record_value_names[ value_index ] );
+
+			return( -1 );
+		}
+	}
+	if( info_record_finalize(
+	     &info_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize record.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_record_write(
+	     &info_record,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
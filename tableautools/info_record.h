@@ -0,0 +1,120 @@
+/*
+ * Machine-readable record of the information of a Tableau write blocker
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INFO_RECORD_H )
+#define _INFO_RECORD_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+#include "tableautools_libtableau.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the record data, which is large enough for every value of
+ * a device to be escaped
+ */
+#define INFO_RECORD_DATA_SIZE		8192
+
+/* The maximum size of a value
+ */
+#define INFO_RECORD_VALUE_SIZE		256
+
+enum INFO_RECORD_FORMATS
+{
+	INFO_RECORD_FORMAT_TEXT		= 0,
+	INFO_RECORD_FORMAT_JSONL	= 1,
+	INFO_RECORD_FORMAT_CSV		= 2
+};
+
+typedef struct info_record info_record_t;
+
+/* A record is composed in place and written with a single write, so that
+ * records of concurrent writers are not interleaved and no memory is
+ * allocated per value
+ */
+struct info_record
+{
+	/* The format
+	 */
+	int format;
+
+	/* The data
+	 */
+	char data[ INFO_RECORD_DATA_SIZE ];
+
+	/* The size of the data
+	 */
+	size_t data_size;
+
+	/* The number of values
+	 */
+	int number_of_values;
+};
+
+int info_record_clear(
+     info_record_t *info_record,
+     int format,
+     libcerror_error_t **error );
+
+int info_record_append_string(
+     info_record_t *info_record,
+     const char *name,
+     const char *value,
+     size_t value_length,
+     libcerror_error_t **error );
+
+int info_record_append_integer(
+     info_record_t *info_record,
+     const char *name,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int info_record_finalize(
+     info_record_t *info_record,
+     libcerror_error_t **error );
+
+int info_record_set_from_handle(
+     info_record_t *info_record,
+     libtableau_handle_t *handle,
+     const char *source,
+     libcerror_error_t **error );
+
+int info_record_write(
+     info_record_t *info_record,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int info_record_header_fprint(
+     int format,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INFO_RECORD_H ) */
+
@@ -0,0 +1,1543 @@
+/*
+ * Continuous watch of Tableau write blockers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include <time.h>
+
+#include "info_handle.h"
+#include "info_watch.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libtableau.h"
+#include "tableautools_system_string.h"
+#include "tableautools_time.h"
+#include "tableautools_unused.h"
+
+#define INFO_WATCH_NOTIFY_STREAM	stdout
+
+/* The maximum size of a value of the handle
+ */
+#define INFO_WATCH_VALUE_SIZE		256
+
+/* The size that is reserved in the output data for a single print,
+ * which is large enough for an escape sequence and the widest column
+ * or for a line that reports a change
+ */
+#define INFO_WATCH_OUTPUT_RESERVED_SIZE	256
+
+/* The titles of the columns
+ */
+static const char *info_watch_field_titles[ INFO_WATCH_NUMBER_OF_FIELDS ] = {
+	"Source",
+	"Status",
+	"Bridge serial",
+	"Read only",
+	"Drive model",
+	"Drive serial",
+	"Sectors",
+	"HPA",
+	"DCO",
+	"Latency ms",
+	"Max ms",
+	"Errors",
+	"Queries" };
+
+/* The widths of the columns, longer values are truncated
+ */
+static const int info_watch_field_widths[ INFO_WATCH_NUMBER_OF_FIELDS ] = {
+	16, 6, 16, 9, 16, 16, 10, 5, 5, 10, 10, 6, 7 };
+
+/* The identifiers of the handle values of the fields
+ */
+static const char *info_watch_field_identifiers[ INFO_WATCH_NUMBER_OF_FIELDS ] = {
+	NULL,
+	NULL,
+	"bridge_serial_number",
+	"bridge_mode_read_only",
+	"drive_model",
+	"drive_serial_number",
+	NULL,
+	"drive_hpa_in_use",
+	"drive_dco_in_use",
+	NULL,
+	NULL,
+	NULL,
+	NULL };
+
+/* Creates a watch
+ * Make sure the value info_watch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int info_watch_initialize(
+     info_watch_t **info_watch,
+     libcerror_error_t **error )
+{
+	static char *function = "info_watch_initialize";
+
+	if( info_watch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_watch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid watch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*info_watch = memory_allocate_structure(
+	               info_watch_t );
+
+	if( *info_watch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create watch.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *info_watch,
+	     0,
+	     sizeof( info_watch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear watch.",
+		 function );
+
+		memory_free(
+		 *info_watch );
+
+		*info_watch = NULL;
+
+		return( -1 );
+	}
+	( *info_watch )->notify_stream = INFO_WATCH_NOTIFY_STREAM;
+	( *info_watch )->abort_flag    = &( ( *info_watch )->abort );
+	( *info_watch )->interval      = 1;
+
+	return( 1 );
+}
+
+/* Frees a device
+ * Returns 1 if successful or -1 on error
+ */
+static int info_watch_free_device(
+            info_watch_device_t **device,
+            libcerror_error_t **error )
+{
+	static char *function = "info_watch_free_device";
+	int result            = 1;
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device.",
+		 function );
+
+		return( -1 );
+	}
+	if( *device != NULL )
+	{
+		if( ( *device )->is_open != 0 )
+		{
+			if( info_handle_close_input(
+			     ( *device )->info_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close info handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *device )->info_handle != NULL )
+		{
+			if( info_handle_free(
+			     &( ( *device )->info_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free info handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *device )->source != NULL )
+		{
+			memory_free(
+			 ( *device )->source );
+		}
+		memory_free(
+		 *device );
+
+		*device = NULL;
+	}
+	return( result );
+}
+
+/* Frees a watch
+ * Returns 1 if successful or -1 on error
+ */
+int info_watch_free(
+     info_watch_t **info_watch,
+     libcerror_error_t **error )
+{
+	static char *function = "info_watch_free";
+	int device_index      = 0;
+	int result            = 1;
+
+	if( info_watch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_watch != NULL )
+	{
+		for( device_index = 0;
+		     device_index < ( *info_watch )->number_of_devices;
+		     device_index++ )
+		{
+			if( info_watch_free_device(
+			     &( ( *info_watch )->devices[ device_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free device: %d.",
+				 function,
+				 device_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *info_watch );
+
+		*info_watch = NULL;
+	}
+	return( result );
+}
+
+/* Signals the watch to abort
+ * The info handles of the devices share the abort flag of the watch, hence
+ * the function only sets the flag and can be called from a signal handler
+ * Returns 1 if successful or -1 on error
+ */
+int info_watch_signal_abort(
+     info_watch_t *info_watch,
+     libcerror_error_t **error )
+{
+	static char *function = "info_watch_signal_abort";
+
+	if( info_watch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch.",
+		 function );
+
+		return( -1 );
+	}
+	*( info_watch->abort_flag ) = 1;
+
+	return( 1 );
+}
+
+/* Sets the flag that signals the watch to abort
+ * A signal handler of the caller only needs to set the flag to abort the
+ * watch, the flag is passed to the info handles of the devices
+ * If abort_flag is NULL the flag of the watch is used
+ * Returns 1 if successful or -1 on error
+ */
+int info_watch_set_abort_flag(
+     info_watch_t *info_watch,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error )
+{
+	static char *function = "info_watch_set_abort_flag";
+	int device_index      = 0;
+
+	if( info_watch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort_flag == NULL )
+	{
+		info_watch->abort_flag = &( info_watch->abort );
+	}
+	else
+	{
+		info_watch->abort_flag = abort_flag;
+	}
+	for( device_index = 0;
+	     device_index < info_watch->number_of_devices;
+	     device_index++ )
+	{
+		if( info_handle_set_abort_flag(
+		     info_watch->devices[ device_index ]->info_handle,
+		     info_watch->abort_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set abort flag of info handle of device: %d.",
+			 function,
+			 device_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the refresh interval
+ * The string contains the interval in seconds
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_watch_set_interval(
+     info_watch_t *info_watch,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_watch_set_interval";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( info_watch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( tableautools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) INFO_WATCH_MAXIMUM_INTERVAL ) )
+	{
+		return( 0 );
+	}
+	info_watch->interval = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Appends a device
+ * Returns 1 if successful, 0 if the device was already appended or -1 on error
+ */
+int info_watch_append_device(
+     info_watch_t *info_watch,
+     const system_character_t *source,
+     size_t source_length,
+     libcerror_error_t **error )
+{
+	char source_string[ INFO_WATCH_FIELD_SIZE ];
+
+	info_watch_device_t *device = NULL;
+	static char *function       = "info_watch_append_device";
+	int device_index            = 0;
+	int print_count             = 0;
+
+	if( info_watch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_length == 0 )
+	 || ( source_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( device_index = 0;
+	     device_index < info_watch->number_of_devices;
+	     device_index++ )
+	{
+		device = info_watch->devices[ device_index ];
+
+		if( ( system_string_length( device->source ) == source_length )
+		 && ( system_string_compare(
+		       device->source,
+		       source,
+		       source_length ) == 0 ) )
+		{
+			return( 0 );
+		}
+	}
+	device = NULL;
+
+	if( info_watch->number_of_devices >= INFO_WATCH_MAXIMUM_NUMBER_OF_DEVICES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: number of devices exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	device = memory_allocate_structure(
+	          info_watch_device_t );
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create device.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     device,
+	     0,
+	     sizeof( info_watch_device_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear device.",
+		 function );
+
+		memory_free(
+		 device );
+
+		return( -1 );
+	}
+	device->source = system_string_allocate(
+	                  source_length + 1 );
+
+	if( device->source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     device->source,
+	     source,
+	     source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source.",
+		 function );
+
+		goto on_error;
+	}
+	device->source[ source_length ] = 0;
+
+	if( info_handle_initialize(
+	     &( device->info_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_set_abort_flag(
+	     device->info_handle,
+	     info_watch->abort_flag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set abort flag of info handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* A source that does not fit is truncated in the field
+	 */
+	print_count = narrow_string_snprintf(
+	               source_string,
+	               INFO_WATCH_FIELD_SIZE,
+	               "%" PRIs_SYSTEM "",
+	               device->source );
+
+	if( print_count < 0 )
+	{
+		print_count = 0;
+	}
+	else if( print_count >= INFO_WATCH_FIELD_SIZE )
+	{
+		print_count = INFO_WATCH_FIELD_SIZE - 1;
+	}
+	if( info_watch_set_field(
+	     device,
+	     INFO_WATCH_FIELD_SOURCE,
+	     source_string,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set source field.",
+		 function );
+
+		goto on_error;
+	}
+	info_watch->devices[ info_watch->number_of_devices ] = device;
+
+	info_watch->number_of_devices += 1;
+
+	return( 1 );
+
+on_error:
+	if( device != NULL )
+	{
+		info_watch_free_device(
+		 &device,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets a field of a device
+ * The value is truncated to the width of the column
+ * Returns 1 if successful or -1 on error
+ */
+int info_watch_set_field(
+     info_watch_device_t *device,
+     int field_index,
+     const char *value,
+     size_t value_length,
+     libcerror_error_t **error )
+{
+	static char *function = "info_watch_set_field";
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( field_index < 0 )
+	 || ( field_index >= INFO_WATCH_NUMBER_OF_FIELDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid field index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value == NULL )
+	 && ( value_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_length > (size_t) info_watch_field_widths[ field_index ] )
+	{
+		value_length = (size_t) info_watch_field_widths[ field_index ];
+	}
+	if( value_length > 0 )
+	{
+		if( memory_copy(
+		     device->fields[ field_index ],
+		     value,
+		     value_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	device->fields[ field_index ][ value_length ] = 0;
+
+	return( 1 );
+}
+
+/* Sets a field of a device to a formatted duration in milliseconds
+ * Returns 1 if successful or -1 on error
+ */
+static int info_watch_set_duration_field(
+            info_watch_device_t *device,
+            int field_index,
+            uint64_t duration,
+            libcerror_error_t **error )
+{
+	char value_string[ INFO_WATCH_FIELD_SIZE ];
+
+	static char *function = "info_watch_set_duration_field";
+	int print_count       = 0;
+
+	print_count = narrow_string_snprintf(
+	               value_string,
+	               INFO_WATCH_FIELD_SIZE,
+	               "%" PRIu64 ".%03" PRIu64 "",
+	               duration / 1000,
+	               duration % 1000 );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= INFO_WATCH_FIELD_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to format duration.",
+		 function );
+
+		return( -1 );
+	}
+	return( info_watch_set_field(
+	         device,
+	         field_index,
+	         value_string,
+	         (size_t) print_count,
+	         error ) );
+}
+
+/* Sets a field of a device to a formatted integer
+ * Returns 1 if successful or -1 on error
+ */
+static int info_watch_set_integer_field(
+            info_watch_device_t *device,
+            int field_index,
+            uint64_t value,
+            libcerror_error_t **error )
+{
+	char value_string[ INFO_WATCH_FIELD_SIZE ];
+
+	static char *function = "info_watch_set_integer_field";
+	int print_count       = 0;
+
+	print_count = narrow_string_snprintf(
+	               value_string,
+	               INFO_WATCH_FIELD_SIZE,
+	               "%" PRIu64 "",
+	               value );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= INFO_WATCH_FIELD_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to format integer.",
+		 function );
+
+		return( -1 );
+	}
+	return( info_watch_set_field(
+	         device,
+	         field_index,
+	         value_string,
+	         (size_t) print_count,
+	         error ) );
+}
+
+/* Sets the fields of a device from the values of the last query
+ * Returns 1 if successful or -1 on error
+ */
+static int info_watch_set_fields_from_handle(
+            info_watch_device_t *device,
+            libcerror_error_t **error )
+{
+	char value_string[ INFO_WATCH_VALUE_SIZE ];
+
+	static char *function      = "info_watch_set_fields_from_handle";
+	size_t value_length        = 0;
+	uint32_t number_of_sectors = 0;
+	int field_index            = 0;
+	int result                 = 0;
+
+	for( field_index = 0;
+	     field_index < INFO_WATCH_NUMBER_OF_FIELDS;
+	     field_index++ )
+	{
+		if( info_watch_field_identifiers[ field_index ] == NULL )
+		{
+			continue;
+		}
+		result = libtableau_handle_get_value(
+		          device->info_handle->input_handle,
+		          info_watch_field_identifiers[ field_index ],
+		          value_string,
+		          INFO_WATCH_VALUE_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %s.",
+			 function,
+			 info_watch_field_identifiers[ field_index ] );
+
+			return( -1 );
+		}
+		value_length = 0;
+
+		if( result == 1 )
+		{
+			value_length = narrow_string_length(
+			                value_string );
+		}
+		if( info_watch_set_field(
+		     device,
+		     field_index,
+		     value_string,
+		     value_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set field: %d.",
+			 function,
+			 field_index );
+
+			return( -1 );
+		}
+	}
+	result = libtableau_handle_get_drive_number_of_sectors(
+	          device->info_handle->input_handle,
+	          &number_of_sectors,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve drive number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		result = info_watch_set_field(
+		          device,
+		          INFO_WATCH_FIELD_NUMBER_OF_SECTORS,
+		          NULL,
+		          0,
+		          error );
+	}
+	else
+	{
+		result = info_watch_set_integer_field(
+		          device,
+		          INFO_WATCH_FIELD_NUMBER_OF_SECTORS,
+		          (uint64_t) number_of_sectors,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of sectors field.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Refreshes a device
+ * The handle is kept open between refreshes and only the query command
+ * is sent. A failed open or query is counted as an error and the handle
+ * is reopened by the next refresh, so that a bridge that was reconnected
+ * is picked up again
+ * Returns 1 if successful or -1 on error
+ */
+static int info_watch_refresh_device(
+            info_watch_device_t *device,
+            libcerror_error_t **error )
+{
+	libcerror_error_t *query_error = NULL;
+	static char *function          = "info_watch_refresh_device";
+	uint64_t end_time              = 0;
+	uint64_t start_time            = 0;
+	int result                     = 0;
+
+	if( device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device.",
+		 function );
+
+		return( -1 );
+	}
+	if( tableautools_time_get_monotonic_time(
+	     &start_time ) != 1 )
+	{
+		start_time = 0;
+	}
+	if( device->is_open == 0 )
+	{
+		if( info_handle_open_input(
+		     device->info_handle,
+		     device->source,
+		     &query_error ) == 1 )
+		{
+			device->is_open = 1;
+		}
+	}
+	if( device->is_open != 0 )
+	{
+		result = libtableau_handle_query(
+		          device->info_handle->input_handle,
+		          &query_error );
+
+		device->number_of_queries += 1;
+	}
+	if( tableautools_time_get_monotonic_time(
+	     &end_time ) == 1 )
+	{
+		device->latency = ( end_time - start_time ) / 1000;
+
+		if( device->latency > device->maximum_latency )
+		{
+			device->maximum_latency = device->latency;
+		}
+	}
+	if( query_error != NULL )
+	{
+		libcerror_error_free(
+		 &query_error );
+	}
+	if( result == 1 )
+	{
+		result = info_watch_set_fields_from_handle(
+		          device,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set fields.",
+			 function );
+
+			return( -1 );
+		}
+		result = info_watch_set_field(
+		          device,
+		          INFO_WATCH_FIELD_STATUS,
+		          "ok",
+		          2,
+		          error );
+	}
+	else
+	{
+		device->number_of_errors += 1;
+
+		if( device->is_open != 0 )
+		{
+			info_handle_close_input(
+			 device->info_handle,
+			 NULL );
+
+			device->is_open = 0;
+		}
+		result = info_watch_set_field(
+		          device,
+		          INFO_WATCH_FIELD_STATUS,
+		          "error",
+		          5,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set status field.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_watch_set_duration_field(
+	     device,
+	     INFO_WATCH_FIELD_LATENCY,
+	     device->latency,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set latency field.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_watch_set_duration_field(
+	     device,
+	     INFO_WATCH_FIELD_MAXIMUM_LATENCY,
+	     device->maximum_latency,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum latency field.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_watch_set_integer_field(
+	     device,
+	     INFO_WATCH_FIELD_NUMBER_OF_ERRORS,
+	     device->number_of_errors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of errors field.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_watch_set_integer_field(
+	     device,
+	     INFO_WATCH_FIELD_NUMBER_OF_QUERIES,
+	     device->number_of_queries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of queries field.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the output data to the notify stream
+ * Returns 1 if successful or -1 on error
+ */
+static int info_watch_output_flush(
+            info_watch_t *info_watch,
+            libcerror_error_t **error )
+{
+	static char *function = "info_watch_output_flush";
+
+	if( info_watch->output_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( file_stream_write(
+	     info_watch->notify_stream,
+	     info_watch->output_data,
+	     info_watch->output_data_size ) != info_watch->output_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output data.",
+		 function );
+
+		return( -1 );
+	}
+	info_watch->output_data_size = 0;
+
+	return( 1 );
+}
+
+/* Makes sure there is room in the output data for a single print
+ * Returns 1 if successful or -1 on error
+ */
+static int info_watch_output_reserve(
+            info_watch_t *info_watch,
+            libcerror_error_t **error )
+{
+	static char *function = "info_watch_output_reserve";
+
+	if( ( info_watch->output_data_size + INFO_WATCH_OUTPUT_RESERVED_SIZE ) > INFO_WATCH_OUTPUT_DATA_SIZE )
+	{
+		if( info_watch_output_flush(
+		     info_watch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends the number of characters printed by a single print to the output data
+ * Returns 1 if successful or -1 on error
+ */
+static int info_watch_output_append(
+            info_watch_t *info_watch,
+            int print_count,
+            libcerror_error_t **error )
+{
+	static char *function = "info_watch_output_append";
+
+	if( ( print_count < 0 )
+	 || ( print_count >= INFO_WATCH_OUTPUT_RESERVED_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid print count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	info_watch->output_data_size += (size_t) print_count;
+
+	return( 1 );
+}
+
+/* Prints the titles of the columns
+ * Returns 1 if successful or -1 on error
+ */
+static int info_watch_titles_fprint(
+            info_watch_t *info_watch,
+            libcerror_error_t **error )
+{
+	static char *function = "info_watch_titles_fprint";
+	int field_index       = 0;
+	int print_count       = 0;
+
+	if( info_watch->use_escape_sequences != 0 )
+	{
+		/* Clear the screen, move the cursor to the top left and hide it
+		 */
+		if( info_watch_output_reserve(
+		     info_watch,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		print_count = narrow_string_snprintf(
+		               &( info_watch->output_data[ info_watch->output_data_size ] ),
+		               INFO_WATCH_OUTPUT_RESERVED_SIZE,
+		               "\033[H\033[2J\033[?25l" );
+
+		if( info_watch_output_append(
+		     info_watch,
+		     print_count,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	for( field_index = 0;
+	     field_index < INFO_WATCH_NUMBER_OF_FIELDS;
+	     field_index++ )
+	{
+		if( info_watch_output_reserve(
+		     info_watch,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		print_count = narrow_string_snprintf(
+		               &( info_watch->output_data[ info_watch->output_data_size ] ),
+		               INFO_WATCH_OUTPUT_RESERVED_SIZE,
+		               "%-*s%s",
+		               info_watch_field_widths[ field_index ],
+		               info_watch_field_titles[ field_index ],
+		               ( field_index < ( INFO_WATCH_NUMBER_OF_FIELDS - 1 ) ) ? " " : "\n" );
+
+		if( info_watch_output_append(
+		     info_watch,
+		     print_count,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+	 "%s: unable to print titles.",
+	 function );
+
+	return( -1 );
+}
+
+/* Prints the fields that changed since the previous refresh
+ * With escape sequences the changed fields are redrawn in place, where the
+ * table starts at the top of the screen with a row per device. Without escape
+ * sequences the table is printed by the first refresh and every following
+ * change, except of the counters, is printed as a line
+ * The output of a refresh is written with as few writes as possible
+ * Returns 1 if successful or -1 on error
+ */
+int info_watch_refresh_fprint(
+     info_watch_t *info_watch,
+     libcerror_error_t **error )
+{
+	info_watch_device_t *device = NULL;
+	static char *function       = "info_watch_refresh_fprint";
+	int column                  = 0;
+	int device_index            = 0;
+	int field_index             = 0;
+	int is_changed              = 0;
+	int print_count             = 0;
+
+	if( info_watch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_watch->number_of_refreshes == 0 )
+	{
+		if( info_watch_titles_fprint(
+		     info_watch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print titles.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( device_index = 0;
+	     device_index < info_watch->number_of_devices;
+	     device_index++ )
+	{
+		device = info_watch->devices[ device_index ];
+		column = 1;
+
+		for( field_index = 0;
+		     field_index < INFO_WATCH_NUMBER_OF_FIELDS;
+		     field_index++ )
+		{
+			is_changed = narrow_string_compare(
+			              device->fields[ field_index ],
+			              device->printed_fields[ field_index ],
+			              INFO_WATCH_FIELD_SIZE );
+
+			if( ( info_watch->number_of_refreshes != 0 )
+			 && ( is_changed == 0 ) )
+			{
+				column += info_watch_field_widths[ field_index ] + 1;
+
+				continue;
+			}
+			if( info_watch_output_reserve(
+			     info_watch,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			print_count = 0;
+
+			if( info_watch->use_escape_sequences != 0 )
+			{
+				/* The titles are printed on the first row
+				 */
+				print_count = narrow_string_snprintf(
+				               &( info_watch->output_data[ info_watch->output_data_size ] ),
+				               INFO_WATCH_OUTPUT_RESERVED_SIZE,
+				               "\033[%d;%dH%-*s",
+				               device_index + 2,
+				               column,
+				               info_watch_field_widths[ field_index ],
+				               device->fields[ field_index ] );
+			}
+			else if( info_watch->number_of_refreshes == 0 )
+			{
+				print_count = narrow_string_snprintf(
+				               &( info_watch->output_data[ info_watch->output_data_size ] ),
+				               INFO_WATCH_OUTPUT_RESERVED_SIZE,
+				               "%-*s%s",
+				               info_watch_field_widths[ field_index ],
+				               device->fields[ field_index ],
+				               ( field_index < ( INFO_WATCH_NUMBER_OF_FIELDS - 1 ) ) ? " " : "\n" );
+			}
+			else if( field_index < INFO_WATCH_FIELD_LATENCY )
+			{
+				print_count = narrow_string_snprintf(
+				               &( info_watch->output_data[ info_watch->output_data_size ] ),
+				               INFO_WATCH_OUTPUT_RESERVED_SIZE,
+				               "%s: %s changed from: %s to: %s\n",
+				               device->fields[ INFO_WATCH_FIELD_SOURCE ],
+				               info_watch_field_titles[ field_index ],
+				               device->printed_fields[ field_index ],
+				               device->fields[ field_index ] );
+			}
+			if( info_watch_output_append(
+			     info_watch,
+			     print_count,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( memory_copy(
+			     device->printed_fields[ field_index ],
+			     device->fields[ field_index ],
+			     INFO_WATCH_FIELD_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy field.",
+				 function );
+
+				goto on_error;
+			}
+			column += info_watch_field_widths[ field_index ] + 1;
+		}
+	}
+	if( info_watch->use_escape_sequences != 0 )
+	{
+		/* Park the cursor below the table
+		 */
+		if( info_watch_output_reserve(
+		     info_watch,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		print_count = narrow_string_snprintf(
+		               &( info_watch->output_data[ info_watch->output_data_size ] ),
+		               INFO_WATCH_OUTPUT_RESERVED_SIZE,
+		               "\033[%d;1H",
+		               info_watch->number_of_devices + 2 );
+
+		if( info_watch_output_append(
+		     info_watch,
+		     print_count,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( info_watch_output_flush(
+	     info_watch,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	info_watch->number_of_refreshes += 1;
+
+	return( 1 );
+
+on_error:
+	info_watch->output_data_size = 0;
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+	 "%s: unable to print refresh.",
+	 function );
+
+	return( -1 );
+}
+
+/* Watches the devices until abort is signalled
+ * The devices are refreshed one after the other, after which the changes
+ * are printed and the watch sleeps for the refresh interval
+ * Returns 1 if successful or -1 on error
+ */
+int info_watch_run(
+     info_watch_t *info_watch,
+     libcerror_error_t **error )
+{
+	static char *function = "info_watch_run";
+	int device_index      = 0;
+
+	if( info_watch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_watch->number_of_devices == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid watch - missing devices.",
+		 function );
+
+		return( -1 );
+	}
+	while( *( info_watch->abort_flag ) == 0 )
+	{
+		for( device_index = 0;
+		     device_index < info_watch->number_of_devices;
+		     device_index++ )
+		{
+			if( *( info_watch->abort_flag ) != 0 )
+			{
+				break;
+			}
+			if( info_watch_refresh_device(
+			     info_watch->devices[ device_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to refresh device: %d.",
+				 function,
+				 device_index );
+
+				goto on_error;
+			}
+		}
+		/* The handles are kept open, hence the buffered debug output
+		 * of the queries is printed once per refresh
+		 */
+		libtableau_notify_flush(
+		 NULL );
+
+		if( *( info_watch->abort_flag ) != 0 )
+		{
+			break;
+		}
+		if( info_watch_refresh_fprint(
+		     info_watch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print refresh.",
+			 function );
+
+			goto on_error;
+		}
+		if( *( info_watch->abort_flag ) != 0 )
+		{
+			break;
+		}
+		tableautools_time_sleep(
+		 info_watch->interval * 1000 );
+	}
+	if( ( info_watch->use_escape_sequences != 0 )
+	 && ( info_watch->number_of_refreshes != 0 ) )
+	{
+		/* Show the cursor again
+		 */
+		fprintf(
+		 info_watch->notify_stream,
+		 "\033[?25h" );
+	}
+	return( 1 );
+
+on_error:
+	if( ( info_watch->use_escape_sequences != 0 )
+	 && ( info_watch->number_of_refreshes != 0 ) )
+	{
+		fprintf(
+		 info_watch->notify_stream,
+		 "\033[?25h" );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,207 @@
+/*
+ * Continuous watch of Tableau write blockers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INFO_WATCH_H )
+#define _INFO_WATCH_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include <signal.h>
+
+#include "info_handle.h"
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define INFO_WATCH_MAXIMUM_NUMBER_OF_DEVICES	256
+
+/* The maximum refresh interval in seconds
+ */
+#define INFO_WATCH_MAXIMUM_INTERVAL		3600
+
+/* The size of a field, which is large enough for the widest column
+ */
+#define INFO_WATCH_FIELD_SIZE			32
+
+/* The size of the output buffer, in which the output of a refresh
+ * is composed before it is written
+ */
+#define INFO_WATCH_OUTPUT_DATA_SIZE		8192
+
+enum INFO_WATCH_FIELDS
+{
+	INFO_WATCH_FIELD_SOURCE			= 0,
+	INFO_WATCH_FIELD_STATUS			= 1,
+	INFO_WATCH_FIELD_BRIDGE_SERIAL_NUMBER	= 2,
+	INFO_WATCH_FIELD_MODE			= 3,
+	INFO_WATCH_FIELD_DRIVE_MODEL		= 4,
+	INFO_WATCH_FIELD_DRIVE_SERIAL_NUMBER	= 5,
+	INFO_WATCH_FIELD_NUMBER_OF_SECTORS	= 6,
+	INFO_WATCH_FIELD_HPA_IN_USE		= 7,
+	INFO_WATCH_FIELD_DCO_IN_USE		= 8,
+	INFO_WATCH_FIELD_LATENCY		= 9,
+	INFO_WATCH_FIELD_MAXIMUM_LATENCY	= 10,
+	INFO_WATCH_FIELD_NUMBER_OF_ERRORS	= 11,
+	INFO_WATCH_FIELD_NUMBER_OF_QUERIES	= 12,
+
+	INFO_WATCH_NUMBER_OF_FIELDS		= 13
+};
+
+typedef struct info_watch info_watch_t;
+
+typedef struct info_watch_device info_watch_device_t;
+
+struct info_watch_device
+{
+	/* The source device
+	 */
+	system_character_t *source;
+
+	/* The info handle
+	 */
+	info_handle_t *info_handle;
+
+	/* Value to indicate the info handle is open
+	 */
+	uint8_t is_open;
+
+	/* The fields as determined by the last refresh
+	 */
+	char fields[ INFO_WATCH_NUMBER_OF_FIELDS ][ INFO_WATCH_FIELD_SIZE ];
+
+	/* The fields as currently printed
+	 */
+	char printed_fields[ INFO_WATCH_NUMBER_OF_FIELDS ][ INFO_WATCH_FIELD_SIZE ];
+
+	/* The number of queries
+	 */
+	uint64_t number_of_queries;
+
+	/* The number of failed opens and queries
+	 */
+	uint64_t number_of_errors;
+
+	/* The duration of the last query in microseconds
+	 */
+	uint64_t latency;
+
+	/* The duration of the slowest query in microseconds
+	 */
+	uint64_t maximum_latency;
+};
+
+struct info_watch
+{
+	/* The devices
+	 */
+	info_watch_device_t *devices[ INFO_WATCH_MAXIMUM_NUMBER_OF_DEVICES ];
+
+	/* The number of devices
+	 */
+	int number_of_devices;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* The refresh interval in seconds
+	 */
+	uint32_t interval;
+
+	/* Value to indicate the changed fields should be redrawn in place
+	 * using ANSI escape sequences instead of printed as a line per change
+	 */
+	uint8_t use_escape_sequences;
+
+	/* The number of refreshes
+	 */
+	uint64_t number_of_refreshes;
+
+	/* The output data
+	 */
+	char output_data[ INFO_WATCH_OUTPUT_DATA_SIZE ];
+
+	/* The size of the output data
+	 */
+	size_t output_data_size;
+
+	/* Value to indicate if abort was signalled
+	 */
+	volatile sig_atomic_t abort;
+
+	/* The flag that signals an abort, which references abort if not set
+	 */
+	volatile sig_atomic_t *abort_flag;
+};
+
+int info_watch_initialize(
+     info_watch_t **info_watch,
+     libcerror_error_t **error );
+
+int info_watch_free(
+     info_watch_t **info_watch,
+     libcerror_error_t **error );
+
+int info_watch_signal_abort(
+     info_watch_t *info_watch,
+     libcerror_error_t **error );
+
+int info_watch_set_abort_flag(
+     info_watch_t *info_watch,
+     volatile sig_atomic_t *abort_flag,
+     libcerror_error_t **error );
+
+int info_watch_set_interval(
+     info_watch_t *info_watch,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_watch_append_device(
+     info_watch_t *info_watch,
+     const system_character_t *source,
+     size_t source_length,
+     libcerror_error_t **error );
+
+int info_watch_set_field(
+     info_watch_device_t *device,
+     int field_index,
+     const char *value,
+     size_t value_length,
+     libcerror_error_t **error );
+
+int info_watch_refresh_fprint(
+     info_watch_t *info_watch,
+     libcerror_error_t **error );
+
+int info_watch_run(
+     info_watch_t *info_watch,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INFO_WATCH_H ) */
+
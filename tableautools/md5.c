@@ -0,0 +1,807 @@
+/*
+ * MD5 functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+#include <openssl/evp.h>
+#endif
+
+#include "md5.h"
+#include "tableautools_libcerror.h"
+
+#if !defined( HAVE_LIBCRYPTO ) || !defined( HAVE_OPENSSL_EVP_H )
+
+/* RFC 1321 based MD5 implementation
+ */
+static uint32_t md5_sine_based_values[ 64 ] = {
+	0xd76aa478UL, 0xe8c7b756UL, 0x242070dbUL, 0xc1bdceeeUL,
+	0xf57c0fafUL, 0x4787c62aUL, 0xa8304613UL, 0xfd469501UL,
+	0x698098d8UL, 0x8b44f7afUL, 0xffff5bb1UL, 0x895cd7beUL,
+	0x6b901122UL, 0xfd987193UL, 0xa679438eUL, 0x49b40821UL,
+	0xf61e2562UL, 0xc040b340UL, 0x265e5a51UL, 0xe9b6c7aaUL,
+	0xd62f105dUL, 0x02441453UL, 0xd8a1e681UL, 0xe7d3fbc8UL,
+	0x21e1cde6UL, 0xc33707d6UL, 0xf4d50d87UL, 0x455a14edUL,
+	0xa9e3e905UL, 0xfcefa3f8UL, 0x676f02d9UL, 0x8d2a4c8aUL,
+	0xfffa3942UL, 0x8771f681UL, 0x6d9d6122UL, 0xfde5380cUL,
+	0xa4beea44UL, 0x4bdecfa9UL, 0xf6bb4b60UL, 0xbebfbc70UL,
+	0x289b7ec6UL, 0xeaa127faUL, 0xd4ef3085UL, 0x04881d05UL,
+	0xd9d4d039UL, 0xe6db99e5UL, 0x1fa27cf8UL, 0xc4ac5665UL,
+	0xf4292244UL, 0x432aff97UL, 0xab9423a7UL, 0xfc93a039UL,
+	0x655b59c3UL, 0x8f0ccc92UL, 0xffeff47dUL, 0x85845dd1UL,
+	0x6fa87e4fUL, 0xfe2ce6e0UL, 0xa3014314UL, 0x4e0811a1UL,
+	0xf7537e82UL, 0xbd3af235UL, 0x2ad7d2bbUL, 0xeb86d391UL };
+
+static uint8_t md5_bit_shifts[ 64 ] = {
+	7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+	5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+	4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+	6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21 };
+
+
+/* Calculates the MD5 of 64 byte sized blocks of data in a buffer
+ * Returns the number of bytes used if successful
+ */
+static size_t md5_calculate(
+               uint32_t *hash_values,
+               const uint8_t *buffer,
+               size_t size )
+{
+	uint32_t values_32bit[ 16 ];
+
+	size_t buffer_offset       = 0;
+	uint32_t hash_value        = 0;
+	uint32_t hash_values_a     = 0;
+	uint32_t hash_values_b     = 0;
+	uint32_t hash_values_c     = 0;
+	uint32_t hash_values_d     = 0;
+	uint32_t value_32bit       = 0;
+	uint8_t block_index        = 0;
+	uint8_t value_32bit_index  = 0;
+	uint8_t values_32bit_index = 0;
+
+	while( ( size - buffer_offset ) >= MD5_BLOCK_SIZE )
+	{
+		for( value_32bit_index = 0;
+		     value_32bit_index < 16;
+		     value_32bit_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ buffer_offset ] ),
+			 values_32bit[ value_32bit_index ] );
+
+			buffer_offset += sizeof( uint32_t );
+		}
+		hash_values_a = hash_values[ 0 ];
+		hash_values_b = hash_values[ 1 ];
+		hash_values_c = hash_values[ 2 ];
+		hash_values_d = hash_values[ 3 ];
+
+		for( block_index = 0;
+		     block_index < 64;
+		     block_index++ )
+		{
+			if( block_index < 16 )
+			{
+				hash_value         = ( hash_values_b & hash_values_c ) | ( ~hash_values_b & hash_values_d );
+				values_32bit_index = block_index;
+			}
+			else if( block_index < 32 )
+			{
+				hash_value         = ( hash_values_d & hash_values_b ) | ( ~hash_values_d & hash_values_c );
+				values_32bit_index = (uint8_t) ( ( ( 5 * block_index ) + 1 ) % 16 );
+			}
+			else if( block_index < 48 )
+			{
+				hash_value         = hash_values_b ^ hash_values_c ^ hash_values_d;
+				values_32bit_index = (uint8_t) ( ( ( 3 * block_index ) + 5 ) % 16 );
+			}
+			else
+			{
+				hash_value         = hash_values_c ^ ( hash_values_b | ~hash_values_d );
+				values_32bit_index = (uint8_t) ( ( 7 * block_index ) % 16 );
+			}
+			value_32bit   = hash_values_d;
+			hash_values_d = hash_values_c;
+			hash_values_c = hash_values_b;
+
+			hash_value += hash_values_a + md5_sine_based_values[ block_index ] + values_32bit[ values_32bit_index ];
+
+			hash_values_b += byte_stream_bit_rotate_left_32bit(
+			                  hash_value,
+			                  md5_bit_shifts[ block_index ] );
+
+			hash_values_a = value_32bit;
+		}
+		hash_values[ 0 ] += hash_values_a;
+		hash_values[ 1 ] += hash_values_b;
+		hash_values[ 2 ] += hash_values_c;
+		hash_values[ 3 ] += hash_values_d;
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     values_32bit,
+	     0,
+	     sizeof( uint32_t ) * 16 ) == NULL )
+	{
+		return( 0 );
+	}
+	return( buffer_offset );
+}
+
+
+#endif /* !defined( HAVE_LIBCRYPTO ) || !defined( HAVE_OPENSSL_EVP_H ) */
+
+/* Creates a MD5 context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int md5_context_initialize(
+     md5_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "md5_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            md5_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( md5_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	( *context )->evp_md_context = EVP_MD_CTX_new();
+
+	if( ( *context )->evp_md_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create EVP message digest context.",
+		 function );
+
+		goto on_error;
+	}
+	/* The EVP MD5 implementation selects SHA-NI or AVX2 code paths
+	 * at run-time when supported by the CPU
+	 */
+	if( EVP_DigestInit_ex(
+	     ( *context )->evp_md_context,
+	     EVP_md5(),
+	     NULL ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize EVP message digest context.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	( *context )->hash_values[ 0 ] = 0x67452301UL;
+	( *context )->hash_values[ 1 ] = 0xefcdab89UL;
+	( *context )->hash_values[ 2 ] = 0x98badcfeUL;
+	( *context )->hash_values[ 3 ] = 0x10325476UL;
+
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) */
+
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+		if( ( *context )->evp_md_context != NULL )
+		{
+			EVP_MD_CTX_free(
+			 ( *context )->evp_md_context );
+		}
+#endif
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a MD5 context
+ * Returns 1 if successful or -1 on error
+ */
+int md5_context_free(
+     md5_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "md5_context_free";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+		EVP_MD_CTX_free(
+		 ( *context )->evp_md_context );
+#else
+		if( memory_set(
+		     *context,
+		     0,
+		     sizeof( md5_context_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear context.",
+			 function );
+		}
+#endif
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the MD5 context
+ * Returns 1 if successful or -1 on error
+ */
+int md5_context_update(
+     md5_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "md5_context_update";
+
+#if !defined( HAVE_LIBCRYPTO ) || !defined( HAVE_OPENSSL_EVP_H )
+	size_t buffer_offset  = 0;
+	size_t remaining_size = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	if( EVP_DigestUpdate(
+	     context->evp_md_context,
+	     (const void *) buffer,
+	     size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update EVP message digest context.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( context->block_offset > 0 )
+	{
+		remaining_size = MD5_BLOCK_SIZE - context->block_offset;
+
+		if( remaining_size > size )
+		{
+			remaining_size = size;
+		}
+		if( memory_copy(
+		     &( context->block[ context->block_offset ] ),
+		     buffer,
+		     remaining_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to context block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_offset += remaining_size;
+
+		if( context->block_offset < MD5_BLOCK_SIZE )
+		{
+			context->hash_count += remaining_size;
+
+			return( 1 );
+		}
+		md5_calculate(
+		 context->hash_values,
+		 context->block,
+		 MD5_BLOCK_SIZE );
+
+		context->hash_count  += remaining_size;
+		context->block_offset = 0;
+		buffer_offset         = remaining_size;
+	}
+	remaining_size = size - buffer_offset;
+
+	if( remaining_size >= MD5_BLOCK_SIZE )
+	{
+		remaining_size = md5_calculate(
+		                  context->hash_values,
+		                  &( buffer[ buffer_offset ] ),
+		                  remaining_size );
+
+		context->hash_count += remaining_size;
+		buffer_offset       += remaining_size;
+	}
+	remaining_size = size - buffer_offset;
+
+	if( remaining_size > 0 )
+	{
+		if( memory_copy(
+		     context->block,
+		     &( buffer[ buffer_offset ] ),
+		     remaining_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to context block.",
+			 function );
+
+			return( -1 );
+		}
+		context->hash_count  += remaining_size;
+		context->block_offset = remaining_size;
+	}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) */
+
+	return( 1 );
+}
+
+/* Finalizes the MD5 context
+ * Returns 1 if successful or -1 on error
+ */
+int md5_context_finalize(
+     md5_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "md5_context_finalize";
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	unsigned int safe_hash_size = 0;
+#else
+	size_t block_size       = 0;
+	size_t number_of_blocks = 0;
+	uint64_t bit_size       = 0;
+	int value_32bit_index   = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < (size_t) MD5_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	safe_hash_size = (unsigned int) hash_size;
+
+	if( EVP_DigestFinal_ex(
+	     context->evp_md_context,
+	     (unsigned char *) hash,
+	     &safe_hash_size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize EVP message digest context.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	/* Add padding with a size of 56 mod 64
+	 */
+	number_of_blocks = 1;
+
+	if( context->block_offset > 55 )
+	{
+		number_of_blocks += 1;
+	}
+	block_size = number_of_blocks * MD5_BLOCK_SIZE;
+
+	if( memory_set(
+	     &( context->block[ context->block_offset ] ),
+	     0,
+	     block_size - context->block_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context block.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first byte of the padding contains 0x80
+	 */
+	context->block[ context->block_offset ] = 0x80;
+
+	bit_size = context->hash_count * 8;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( context->block[ block_size - 8 ] ),
+	 bit_size );
+
+	md5_calculate(
+	 context->hash_values,
+	 context->block,
+	 block_size );
+
+	for( value_32bit_index = 0;
+	     value_32bit_index < 4;
+	     value_32bit_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( hash[ value_32bit_index * sizeof( uint32_t ) ] ),
+		 context->hash_values[ value_32bit_index ] );
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     context,
+	     0,
+	     sizeof( md5_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) */
+
+	return( 1 );
+}
+
+/* Copies the intermediate state of the context to a byte stream
+ * The state is only available with the built-in implementation
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int md5_context_get_state(
+     md5_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "md5_context_get_state";
+
+#if !defined( HAVE_LIBCRYPTO ) || !defined( HAVE_OPENSSL_EVP_H )
+	size_t state_offset   = 0;
+	int value_32bit_index = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_size < MD5_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	/* The EVP message digest context does not expose its state
+	 */
+	return( 0 );
+#else
+	byte_stream_copy_from_uint64_little_endian(
+	 state,
+	 context->hash_count );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( state[ 8 ] ),
+	 (uint64_t) context->block_offset );
+
+	state_offset = 16;
+
+	for( value_32bit_index = 0;
+	     value_32bit_index < 4;
+	     value_32bit_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( state[ state_offset ] ),
+		 context->hash_values[ value_32bit_index ] );
+
+		state_offset += sizeof( uint32_t );
+	}
+	if( memory_copy(
+	     &( state[ state_offset ] ),
+	     context->block,
+	     MD5_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy context block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) */
+}
+
+/* Copies the intermediate state of the context from a byte stream
+ * The state is only available with the built-in implementation
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int md5_context_set_state(
+     md5_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "md5_context_set_state";
+
+#if !defined( HAVE_LIBCRYPTO ) || !defined( HAVE_OPENSSL_EVP_H )
+	uint64_t block_offset = 0;
+	size_t state_offset   = 0;
+	int value_32bit_index = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_size < MD5_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	return( 0 );
+#else
+	byte_stream_copy_to_uint64_little_endian(
+	 &( state[ 8 ] ),
+	 block_offset );
+
+	if( block_offset >= MD5_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state - block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 state,
+	 context->hash_count );
+
+	context->block_offset = (size_t) block_offset;
+
+	state_offset = 16;
+
+	for( value_32bit_index = 0;
+	     value_32bit_index < 4;
+	     value_32bit_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( state[ state_offset ] ),
+		 context->hash_values[ value_32bit_index ] );
+
+		state_offset += sizeof( uint32_t );
+	}
+	if( memory_copy(
+	     context->block,
+	     &( state[ state_offset ] ),
+	     MD5_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy context block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) */
+}
+
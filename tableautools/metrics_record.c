@@ -0,0 +1,730 @@
+/*
+ * Prometheus text format metrics of a Tableau write blocker
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "metrics_record.h"
+#include "tableautools_libcerror.h"
+
+enum METRICS_RECORD_TYPES
+{
+	METRICS_RECORD_TYPE_GAUGE		= 0,
+	METRICS_RECORD_TYPE_COUNTER		= 1,
+	METRICS_RECORD_TYPE_HISTOGRAM		= 2
+};
+
+/* The names of the metric families
+ */
+static const char *metrics_record_family_names[ METRICS_RECORD_NUMBER_OF_FAMILIES ] = {
+	"tableau_bridge_up",
+	"tableau_bridge_query_latency_seconds",
+	"tableau_bridge_queries_total",
+	"tableau_bridge_errors_total",
+	"tableau_bridge_query_timeouts_total",
+	"tableau_bridge_query_sense_errors_total",
+	"tableau_bridge_write_permitted",
+	"tableau_drive_hpa_present",
+	"tableau_drive_dco_present",
+	"tableau_drive_capacity_sectors" };
+
+/* The types of the metric families
+ */
+static const int metrics_record_family_types[ METRICS_RECORD_NUMBER_OF_FAMILIES ] = {
+	METRICS_RECORD_TYPE_GAUGE,
+	METRICS_RECORD_TYPE_HISTOGRAM,
+	METRICS_RECORD_TYPE_COUNTER,
+	METRICS_RECORD_TYPE_COUNTER,
+	METRICS_RECORD_TYPE_COUNTER,
+	METRICS_RECORD_TYPE_COUNTER,
+	METRICS_RECORD_TYPE_GAUGE,
+	METRICS_RECORD_TYPE_GAUGE,
+	METRICS_RECORD_TYPE_GAUGE,
+	METRICS_RECORD_TYPE_GAUGE };
+
+/* The HELP and TYPE lines of the metric families
+ */
+static const char *metrics_record_family_headers[ METRICS_RECORD_NUMBER_OF_FAMILIES ] = {
+	"# HELP tableau_bridge_up Whether the most recent query of the bridge succeeded.\n"
+	"# TYPE tableau_bridge_up gauge\n",
+	"# HELP tableau_bridge_query_latency_seconds The duration of the queries of the bridge.\n"
+	"# TYPE tableau_bridge_query_latency_seconds histogram\n",
+	"# HELP tableau_bridge_queries_total The number of queries of the bridge.\n"
+	"# TYPE tableau_bridge_queries_total counter\n",
+	"# HELP tableau_bridge_errors_total The number of failed opens and queries of the bridge.\n"
+	"# TYPE tableau_bridge_errors_total counter\n",
+	"# HELP tableau_bridge_query_timeouts_total The number of queries of the bridge that timed out.\n"
+	"# TYPE tableau_bridge_query_timeouts_total counter\n",
+	"# HELP tableau_bridge_query_sense_errors_total The number of queries the bridge returned sense data for.\n"
+	"# TYPE tableau_bridge_query_sense_errors_total counter\n",
+	"# HELP tableau_bridge_write_permitted Whether the bridge permits writes to the drive.\n"
+	"# TYPE tableau_bridge_write_permitted gauge\n",
+	"# HELP tableau_drive_hpa_present Whether a HPA is in use on the drive.\n"
+	"# TYPE tableau_drive_hpa_present gauge\n",
+	"# HELP tableau_drive_dco_present Whether a DCO is in use on the drive.\n"
+	"# TYPE tableau_drive_dco_present gauge\n",
+	"# HELP tableau_drive_capacity_sectors The number of sectors of the drive as reported by the bridge.\n"
+	"# TYPE tableau_drive_capacity_sectors gauge\n" };
+
+/* The upper bounds of the latency buckets in microseconds
+ */
+static const uint64_t metrics_record_latency_bucket_bounds[ METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS ] = {
+	1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000, 2500000, 5000000 };
+
+/* The upper bounds of the latency buckets in seconds as exposed
+ */
+static const char *metrics_record_latency_bucket_labels[ METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS ] = {
+	"0.001", "0.0025", "0.005", "0.01", "0.025", "0.05", "0.1", "0.25", "0.5", "1", "2.5", "5" };
+
+/* Retrieves the index of the latency bucket of a latency in microseconds
+ * Returns the bucket index, which is METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS
+ * if the latency exceeds the upper bound of the last bucket
+ */
+int metrics_record_get_latency_bucket_index(
+     uint64_t latency )
+{
+	int bucket_index = 0;
+
+	while( bucket_index < METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS )
+	{
+		if( latency <= metrics_record_latency_bucket_bounds[ bucket_index ] )
+		{
+			break;
+		}
+		bucket_index++;
+	}
+	return( bucket_index );
+}
+
+/* Clears a record and sets its labels
+ * The label values are escaped as required by the text format
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_record_clear(
+     metrics_record_t *metrics_record,
+     const char *source,
+     const char *bridge_serial_number,
+     libcerror_error_t **error )
+{
+	const char *label_names[ 2 ] = {
+		"source",
+		"bridge_serial_number" };
+
+	const char *label_values[ 2 ];
+
+	static char *function        = "metrics_record_clear";
+	size_t name_length           = 0;
+	size_t value_index           = 0;
+	int label_index              = 0;
+	char byte_value              = 0;
+
+	if( metrics_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( bridge_serial_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bridge serial number.",
+		 function );
+
+		return( -1 );
+	}
+	metrics_record->data_size   = 0;
+	metrics_record->next_family = 0;
+	metrics_record->labels_size = 0;
+
+	label_values[ 0 ] = source;
+	label_values[ 1 ] = bridge_serial_number;
+
+	for( label_index = 0;
+	     label_index < 2;
+	     label_index++ )
+	{
+		name_length = narrow_string_length(
+		               label_names[ label_index ] );
+
+		/* Reserve space for the separator, the name, the equals sign
+		 * and the opening quote
+		 */
+		if( ( metrics_record->labels_size + name_length + 3 ) > METRICS_RECORD_LABELS_SIZE )
+		{
+			goto on_error;
+		}
+		if( label_index > 0 )
+		{
+			metrics_record->labels[ metrics_record->labels_size++ ] = ',';
+		}
+		memory_copy(
+		 &( metrics_record->labels[ metrics_record->labels_size ] ),
+		 label_names[ label_index ],
+		 name_length );
+
+		metrics_record->labels_size += name_length;
+
+		metrics_record->labels[ metrics_record->labels_size++ ] = '=';
+		metrics_record->labels[ metrics_record->labels_size++ ] = '"';
+
+		for( value_index = 0;
+		     label_values[ label_index ][ value_index ] != 0;
+		     value_index++ )
+		{
+			byte_value = label_values[ label_index ][ value_index ];
+
+			/* Reserve space for an escape sequence, the closing quote and
+			 * the end-of-string character
+			 */
+			if( ( metrics_record->labels_size + 4 ) > METRICS_RECORD_LABELS_SIZE )
+			{
+				goto on_error;
+			}
+			if( ( byte_value == '\\' )
+			 || ( byte_value == '"' ) )
+			{
+				metrics_record->labels[ metrics_record->labels_size++ ] = '\\';
+				metrics_record->labels[ metrics_record->labels_size++ ] = byte_value;
+			}
+			else if( byte_value == '\n' )
+			{
+				metrics_record->labels[ metrics_record->labels_size++ ] = '\\';
+				metrics_record->labels[ metrics_record->labels_size++ ] = 'n';
+			}
+			else
+			{
+				metrics_record->labels[ metrics_record->labels_size++ ] = byte_value;
+			}
+		}
+		if( ( metrics_record->labels_size + 2 ) > METRICS_RECORD_LABELS_SIZE )
+		{
+			goto on_error;
+		}
+		metrics_record->labels[ metrics_record->labels_size++ ] = '"';
+	}
+	metrics_record->labels[ metrics_record->labels_size ] = 0;
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: labels exceed maximum size.",
+	 function );
+
+	metrics_record->labels_size = 0;
+
+	return( -1 );
+}
+
+/* Starts the samples of a family
+ * Families that are skipped have no samples
+ * Returns 1 if successful or -1 on error
+ */
+static int metrics_record_start_family(
+            metrics_record_t *metrics_record,
+            int family,
+            int type,
+            libcerror_error_t **error )
+{
+	static char *function = "metrics_record_start_family";
+
+	if( metrics_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( family < metrics_record->next_family )
+	 || ( family >= METRICS_RECORD_NUMBER_OF_FAMILIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid family value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_record_family_types[ family ] != type )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported family type.",
+		 function );
+
+		return( -1 );
+	}
+	while( metrics_record->next_family <= family )
+	{
+		metrics_record->family_offsets[ metrics_record->next_family ] = metrics_record->data_size;
+
+		metrics_record->next_family++;
+	}
+	return( 1 );
+}
+
+/* Appends a formatted sample
+ * Returns 1 if successful or -1 on error
+ */
+static int metrics_record_append_sample(
+            metrics_record_t *metrics_record,
+            const char *name,
+            const char *suffix,
+            const char *bucket_label,
+            uint64_t value,
+            uint64_t fraction,
+            uint8_t has_fraction,
+            libcerror_error_t **error )
+{
+	static char *function = "metrics_record_append_sample";
+	size_t remaining_size = 0;
+	int print_count       = 0;
+
+	remaining_size = METRICS_RECORD_DATA_SIZE - metrics_record->data_size;
+
+	if( bucket_label != NULL )
+	{
+		print_count = narrow_string_snprintf(
+		               &( metrics_record->data[ metrics_record->data_size ] ),
+		               remaining_size,
+		               "%s%s{%s,le=\"%s\"} %" PRIu64 "\n",
+		               name,
+		               suffix,
+		               metrics_record->labels,
+		               bucket_label,
+		               value );
+	}
+	else if( has_fraction != 0 )
+	{
+		print_count = narrow_string_snprintf(
+		               &( metrics_record->data[ metrics_record->data_size ] ),
+		               remaining_size,
+		               "%s%s{%s} %" PRIu64 ".%06" PRIu64 "\n",
+		               name,
+		               suffix,
+		               metrics_record->labels,
+		               value,
+		               fraction );
+	}
+	else
+	{
+		print_count = narrow_string_snprintf(
+		               &( metrics_record->data[ metrics_record->data_size ] ),
+		               remaining_size,
+		               "%s%s{%s} %" PRIu64 "\n",
+		               name,
+		               suffix,
+		               metrics_record->labels,
+		               value );
+	}
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= remaining_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: sample exceeds maximum record size.",
+		 function );
+
+		return( -1 );
+	}
+	metrics_record->data_size += (size_t) print_count;
+
+	return( 1 );
+}
+
+/* Appends the sample of a gauge or counter family
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_record_append_value(
+     metrics_record_t *metrics_record,
+     int family,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_record_append_value";
+	int type              = METRICS_RECORD_TYPE_GAUGE;
+
+	if( ( family >= 0 )
+	 && ( family < METRICS_RECORD_NUMBER_OF_FAMILIES )
+	 && ( metrics_record_family_types[ family ] == METRICS_RECORD_TYPE_COUNTER ) )
+	{
+		type = METRICS_RECORD_TYPE_COUNTER;
+	}
+	if( metrics_record_start_family(
+	     metrics_record,
+	     family,
+	     type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start family.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_record_append_sample(
+	     metrics_record,
+	     metrics_record_family_names[ family ],
+	     "",
+	     NULL,
+	     value,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append sample.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the samples of a histogram family
+ * The bucket counts are not cumulative and contain
+ * METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS + 1 values, of which the last
+ * one counts the observations that exceed the largest upper bound.
+ * The sum is in microseconds and exposed in seconds
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_record_append_histogram(
+     metrics_record_t *metrics_record,
+     int family,
+     const uint64_t *bucket_counts,
+     uint64_t sum,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_record_append_histogram";
+	uint64_t count        = 0;
+	int bucket_index      = 0;
+
+	if( bucket_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_record_start_family(
+	     metrics_record,
+	     family,
+	     METRICS_RECORD_TYPE_HISTOGRAM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start family.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS;
+	     bucket_index++ )
+	{
+		count += bucket_counts[ bucket_index ];
+
+		if( metrics_record_append_sample(
+		     metrics_record,
+		     metrics_record_family_names[ family ],
+		     "_bucket",
+		     metrics_record_latency_bucket_labels[ bucket_index ],
+		     count,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append bucket: %d.",
+			 function,
+			 bucket_index );
+
+			return( -1 );
+		}
+	}
+	count += bucket_counts[ METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS ];
+
+	if( metrics_record_append_sample(
+	     metrics_record,
+	     metrics_record_family_names[ family ],
+	     "_bucket",
+	     "+Inf",
+	     count,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append +Inf bucket.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_record_append_sample(
+	     metrics_record,
+	     metrics_record_family_names[ family ],
+	     "_sum",
+	     NULL,
+	     sum / 1000000,
+	     sum % 1000000,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append sum.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_record_append_sample(
+	     metrics_record,
+	     metrics_record_family_names[ family ],
+	     "_count",
+	     NULL,
+	     count,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append count.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Finalizes a record
+ * The families after the last one appended have no samples
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_record_finalize(
+     metrics_record_t *metrics_record,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_record_finalize";
+
+	if( metrics_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	while( metrics_record->next_family <= METRICS_RECORD_NUMBER_OF_FAMILIES )
+	{
+		metrics_record->family_offsets[ metrics_record->next_family ] = metrics_record->data_size;
+
+		metrics_record->next_family++;
+	}
+	return( 1 );
+}
+
+/* Retrieves the samples of a family
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_record_get_family_data(
+     metrics_record_t *metrics_record,
+     int family,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_record_get_family_data";
+
+	if( metrics_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_record->next_family <= METRICS_RECORD_NUMBER_OF_FAMILIES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - not finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( family < 0 )
+	 || ( family >= METRICS_RECORD_NUMBER_OF_FAMILIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid family value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = (uint8_t *) &( metrics_record->data[ metrics_record->family_offsets[ family ] ] );
+	*data_size = metrics_record->family_offsets[ family + 1 ] - metrics_record->family_offsets[ family ];
+
+	return( 1 );
+}
+
+/* Retrieves the HELP and TYPE lines of a family
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_record_get_family_header(
+     int family,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_record_get_family_header";
+
+	if( ( family < 0 )
+	 || ( family >= METRICS_RECORD_NUMBER_OF_FAMILIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid family value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = (uint8_t *) metrics_record_family_headers[ family ];
+	*data_size = narrow_string_length(
+	              metrics_record_family_headers[ family ] );
+
+	return( 1 );
+}
+
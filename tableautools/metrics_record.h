@@ -0,0 +1,144 @@
+/*
+ * Prometheus text format metrics of a Tableau write blocker
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _METRICS_RECORD_H )
+#define _METRICS_RECORD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the record data, which is large enough for every sample of
+ * a device with escaped labels
+ */
+#define METRICS_RECORD_DATA_SIZE			16384
+
+/* The size of the labels, which is large enough for escaped values
+ */
+#define METRICS_RECORD_LABELS_SIZE			512
+
+/* The number of latency buckets, excluding the +Inf bucket
+ */
+#define METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS	12
+
+/* The metric families in the order they are exposed
+ */
+enum METRICS_RECORD_FAMILIES
+{
+	METRICS_RECORD_FAMILY_UP			= 0,
+	METRICS_RECORD_FAMILY_QUERY_LATENCY		= 1,
+	METRICS_RECORD_FAMILY_QUERIES			= 2,
+	METRICS_RECORD_FAMILY_ERRORS			= 3,
+	METRICS_RECORD_FAMILY_QUERY_TIMEOUTS		= 4,
+	METRICS_RECORD_FAMILY_QUERY_SENSE_ERRORS	= 5,
+	METRICS_RECORD_FAMILY_WRITE_PERMITTED		= 6,
+	METRICS_RECORD_FAMILY_HPA_PRESENT		= 7,
+	METRICS_RECORD_FAMILY_DCO_PRESENT		= 8,
+	METRICS_RECORD_FAMILY_CAPACITY			= 9,
+
+	METRICS_RECORD_NUMBER_OF_FAMILIES		= 10
+};
+
+typedef struct metrics_record metrics_record_t;
+
+/* A record contains the samples of a single device, grouped per metric
+ * family, so that the samples of all devices can be exposed family by
+ * family without composing them again. The samples are composed in place,
+ * hence no memory is allocated per sample
+ */
+struct metrics_record
+{
+	/* The data
+	 */
+	char data[ METRICS_RECORD_DATA_SIZE ];
+
+	/* The size of the data
+	 */
+	size_t data_size;
+
+	/* The offsets of the samples of the families in the data, the offset
+	 * after the last family is the size of the data
+	 */
+	size_t family_offsets[ METRICS_RECORD_NUMBER_OF_FAMILIES + 1 ];
+
+	/* The family the next samples are appended to
+	 */
+	int next_family;
+
+	/* The escaped labels
+	 */
+	char labels[ METRICS_RECORD_LABELS_SIZE ];
+
+	/* The size of the labels
+	 */
+	size_t labels_size;
+};
+
+int metrics_record_get_latency_bucket_index(
+     uint64_t latency );
+
+int metrics_record_clear(
+     metrics_record_t *metrics_record,
+     const char *source,
+     const char *bridge_serial_number,
+     libcerror_error_t **error );
+
+int metrics_record_append_value(
+     metrics_record_t *metrics_record,
+     int family,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int metrics_record_append_histogram(
+     metrics_record_t *metrics_record,
+     int family,
+     const uint64_t *bucket_counts,
+     uint64_t sum,
+     libcerror_error_t **error );
+
+int metrics_record_finalize(
+     metrics_record_t *metrics_record,
+     libcerror_error_t **error );
+
+int metrics_record_get_family_data(
+     metrics_record_t *metrics_record,
+     int family,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int metrics_record_get_family_header(
+     int family,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _METRICS_RECORD_H ) */
+
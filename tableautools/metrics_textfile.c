@@ -0,0 +1,597 @@
+/*
+ * Metrics text file for the node exporter textfile collector
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "metrics_textfile.h"
+#include "tableautools_libcerror.h"
+
+/* Creates a metrics text file
+ * Make sure the value metrics_textfile is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_textfile_initialize(
+     metrics_textfile_t **metrics_textfile,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_textfile_initialize";
+
+	if( metrics_textfile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics text file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metrics_textfile != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metrics text file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*metrics_textfile = memory_allocate_structure(
+	                     metrics_textfile_t );
+
+	if( *metrics_textfile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metrics text file.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *metrics_textfile,
+	     0,
+	     sizeof( metrics_textfile_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metrics text file.",
+		 function );
+
+		memory_free(
+		 *metrics_textfile );
+
+		*metrics_textfile = NULL;
+
+		return( -1 );
+	}
+	( *metrics_textfile )->file_descriptor = -1;
+
+	return( 1 );
+}
+
+/* Frees a metrics text file
+ * A temporary file that is still open is closed and removed, hence
+ * the text file is not replaced
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_textfile_free(
+     metrics_textfile_t **metrics_textfile,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_textfile_free";
+
+	if( metrics_textfile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics text file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metrics_textfile != NULL )
+	{
+#if defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE )
+		if( ( *metrics_textfile )->file_descriptor != -1 )
+		{
+			close(
+			 ( *metrics_textfile )->file_descriptor );
+
+			unlink(
+			 ( *metrics_textfile )->temporary_path );
+		}
+#endif
+		memory_free(
+		 *metrics_textfile );
+
+		*metrics_textfile = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the path
+ * The temporary file is the path with the extension .tmp, which the
+ * textfile collector ignores
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_textfile_set_path(
+     metrics_textfile_t *metrics_textfile,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_textfile_set_path";
+	size_t path_length    = 0;
+
+	if( metrics_textfile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics text file.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_textfile->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metrics text file - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE )
+	path_length = narrow_string_length(
+	               path );
+
+	/* Reserve space for the .tmp extension and the end-of-string character
+	 */
+	if( ( path_length == 0 )
+	 || ( ( path_length + 5 ) > METRICS_TEXTFILE_PATH_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	memory_copy(
+	 metrics_textfile->path,
+	 path,
+	 path_length );
+
+	metrics_textfile->path[ path_length ] = 0;
+
+	memory_copy(
+	 metrics_textfile->temporary_path,
+	 path,
+	 path_length );
+
+	memory_copy(
+	 &( metrics_textfile->temporary_path[ path_length ] ),
+	 ".tmp",
+	 5 );
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing atomic file replace support.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Opens the temporary file for writing
+ * A failure to open the temporary file is counted as a failed write
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_textfile_open(
+     metrics_textfile_t *metrics_textfile,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_textfile_open";
+
+	if( metrics_textfile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics text file.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_textfile->path[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid metrics text file - missing path.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_textfile->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metrics text file - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE )
+	metrics_textfile->file_descriptor = open(
+	                                     metrics_textfile->temporary_path,
+	                                     O_WRONLY | O_CREAT | O_TRUNC,
+	                                     0644 );
+
+	if( metrics_textfile->file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open temporary file: %s.",
+		 function,
+		 metrics_textfile->temporary_path );
+
+		metrics_textfile->number_of_failed_writes += 1;
+
+		return( -1 );
+	}
+	metrics_textfile->buffer_size  = 0;
+	metrics_textfile->write_failed = 0;
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing atomic file replace support.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+#if defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE )
+
+/* Writes the data in the output buffer to the temporary file
+ * Returns 1 if successful or -1 on error
+ */
+static int metrics_textfile_flush(
+            metrics_textfile_t *metrics_textfile,
+            libcerror_error_t **error )
+{
+	static char *function = "metrics_textfile_flush";
+	size_t buffer_offset  = 0;
+	ssize_t write_count   = 0;
+
+	while( buffer_offset < metrics_textfile->buffer_size )
+	{
+		write_count = write(
+		               metrics_textfile->file_descriptor,
+		               &( metrics_textfile->buffer[ buffer_offset ] ),
+		               metrics_textfile->buffer_size - buffer_offset );
+
+		if( write_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 errno,
+			 "%s: unable to write temporary file.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset += (size_t) write_count;
+	}
+	metrics_textfile->buffer_size = 0;
+
+	return( 1 );
+}
+
+#endif /* defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE ) */
+
+/* Writes data to the temporary file
+ * The data is buffered and written when the output buffer is full
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_textfile_write(
+     metrics_textfile_t *metrics_textfile,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+#if defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE )
+	size_t copy_size      = 0;
+#endif
+	static char *function = "metrics_textfile_write";
+
+	if( metrics_textfile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics text file.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_textfile->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid metrics text file - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE )
+	while( data_size > 0 )
+	{
+		if( metrics_textfile->buffer_size >= METRICS_TEXTFILE_BUFFER_SIZE )
+		{
+			if( metrics_textfile_flush(
+			     metrics_textfile,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush output buffer.",
+				 function );
+
+				metrics_textfile->write_failed = 1;
+
+				return( -1 );
+			}
+		}
+		copy_size = METRICS_TEXTFILE_BUFFER_SIZE - metrics_textfile->buffer_size;
+
+		if( copy_size > data_size )
+		{
+			copy_size = data_size;
+		}
+		memory_copy(
+		 &( metrics_textfile->buffer[ metrics_textfile->buffer_size ] ),
+		 data,
+		 copy_size );
+
+		metrics_textfile->buffer_size += copy_size;
+
+		data      += copy_size;
+		data_size -= copy_size;
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing atomic file replace support.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Closes the temporary file and replaces the text file with it
+ * The temporary file is removed instead if a write failed, hence the
+ * text file keeps its previous contents
+ * Returns 0 if successful or -1 on error
+ */
+int metrics_textfile_close(
+     metrics_textfile_t *metrics_textfile,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_textfile_close";
+
+	if( metrics_textfile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics text file.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_textfile->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid metrics text file - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE )
+	if( metrics_textfile->write_failed == 0 )
+	{
+		if( metrics_textfile_flush(
+		     metrics_textfile,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
+			 function );
+
+			metrics_textfile->write_failed = 1;
+		}
+	}
+	if( close(
+	     metrics_textfile->file_descriptor ) != 0 )
+	{
+		if( metrics_textfile->write_failed == 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close temporary file.",
+			 function );
+
+			metrics_textfile->write_failed = 1;
+		}
+	}
+	metrics_textfile->file_descriptor = -1;
+	metrics_textfile->buffer_size     = 0;
+
+	if( metrics_textfile->write_failed == 0 )
+	{
+		if( rename(
+		     metrics_textfile->temporary_path,
+		     metrics_textfile->path ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 errno,
+			 "%s: unable to replace text file: %s.",
+			 function,
+			 metrics_textfile->path );
+
+			metrics_textfile->write_failed = 1;
+		}
+	}
+	if( metrics_textfile->write_failed != 0 )
+	{
+		unlink(
+		 metrics_textfile->temporary_path );
+
+		metrics_textfile->number_of_failed_writes += 1;
+
+		return( -1 );
+	}
+	metrics_textfile->number_of_writes += 1;
+
+	return( 0 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing atomic file replace support.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
@@ -0,0 +1,118 @@
+/*
+ * Metrics text file for the node exporter textfile collector
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#if !defined( _METRICS_TEXTFILE_H )
+#define _METRICS_TEXTFILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_OPEN ) && defined( HAVE_RENAME ) && defined( HAVE_FCNTL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE
+#endif
+
+/* The size of the path, including the end-of-string character
+ */
+#define METRICS_TEXTFILE_PATH_SIZE		4096
+
+/* The size of the output buffer
+ */
+#define METRICS_TEXTFILE_BUFFER_SIZE		65536
+
+typedef struct metrics_textfile metrics_textfile_t;
+
+/* The metrics are written to a temporary file next to the text file, which
+ * replaces the text file when it is closed, so that the textfile collector
+ * never reads a partially written file
+ */
+struct metrics_textfile
+{
+	/* The path
+	 */
+	char path[ METRICS_TEXTFILE_PATH_SIZE ];
+
+	/* The path of the temporary file
+	 */
+	char temporary_path[ METRICS_TEXTFILE_PATH_SIZE ];
+
+	/* The file descriptor of the temporary file
+	 */
+	int file_descriptor;
+
+	/* The output buffer
+	 */
+	uint8_t buffer[ METRICS_TEXTFILE_BUFFER_SIZE ];
+
+	/* The size of the data in the output buffer
+	 */
+	size_t buffer_size;
+
+	/* Value to indicate a write failed since the file was opened
+	 */
+	uint8_t write_failed;
+
+	/* The number of times the text file was replaced
+	 */
+	uint64_t number_of_writes;
+
+	/* The number of times the text file could not be replaced
+	 */
+	uint64_t number_of_failed_writes;
+};
+
+int metrics_textfile_initialize(
+     metrics_textfile_t **metrics_textfile,
+     libcerror_error_t **error );
+
+int metrics_textfile_free(
+     metrics_textfile_t **metrics_textfile,
+     libcerror_error_t **error );
+
+int metrics_textfile_set_path(
+     metrics_textfile_t *metrics_textfile,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int metrics_textfile_open(
+     metrics_textfile_t *metrics_textfile,
+     libcerror_error_t **error );
+
+int metrics_textfile_write(
+     metrics_textfile_t *metrics_textfile,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int metrics_textfile_close(
+     metrics_textfile_t *metrics_textfile,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _METRICS_TEXTFILE_H ) */
+
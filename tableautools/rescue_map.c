@@ -0,0 +1,1194 @@
+/*
+ * Rescue map of the recovery mode
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#include "rescue_map.h"
+#include "tableautools_libcerror.h"
+
+/* Creates a rescue map
+ * Make sure the value rescue_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int rescue_map_initialize(
+     rescue_map_t **rescue_map,
+     size64_t media_size,
+     libcerror_error_t **error )
+{
+	static char *function = "rescue_map_initialize";
+
+	if( rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rescue_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid rescue map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid media size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*rescue_map = memory_allocate_structure(
+	               rescue_map_t );
+
+	if( *rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create rescue map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *rescue_map,
+	     0,
+	     sizeof( rescue_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear rescue map.",
+		 function );
+
+		memory_free(
+		 *rescue_map );
+
+		*rescue_map = NULL;
+
+		return( -1 );
+	}
+	if( rescue_map_resize(
+	     *rescue_map,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize extents.",
+		 function );
+
+		goto on_error;
+	}
+	( *rescue_map )->media_size = media_size;
+
+	if( media_size > 0 )
+	{
+		( *rescue_map )->extents[ 0 ].offset = 0;
+		( *rescue_map )->extents[ 0 ].size   = media_size;
+		( *rescue_map )->extents[ 0 ].status = RESCUE_MAP_STATUS_UNTRIED;
+
+		( *rescue_map )->number_of_extents = 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *rescue_map != NULL )
+	{
+		if( ( *rescue_map )->extents != NULL )
+		{
+			memory_free(
+			 ( *rescue_map )->extents );
+		}
+		memory_free(
+		 *rescue_map );
+
+		*rescue_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a rescue map
+ * Returns 1 if successful or -1 on error
+ */
+int rescue_map_free(
+     rescue_map_t **rescue_map,
+     libcerror_error_t **error )
+{
+	static char *function = "rescue_map_free";
+
+	if( rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rescue_map != NULL )
+	{
+		if( ( *rescue_map )->extents != NULL )
+		{
+			memory_free(
+			 ( *rescue_map )->extents );
+		}
+		memory_free(
+		 *rescue_map );
+
+		*rescue_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Makes sure the rescue map can contain a specific number of extents
+ * Returns 1 if successful or -1 on error
+ */
+int rescue_map_resize(
+     rescue_map_t *rescue_map,
+     int number_of_extents,
+     libcerror_error_t **error )
+{
+	void *reallocation              = NULL;
+	static char *function           = "rescue_map_resize";
+	size_t extents_size             = 0;
+	int number_of_allocated_extents = 0;
+
+	if( rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_extents < 0 )
+	 || ( number_of_extents > ( INT_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of extents value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents <= rescue_map->number_of_allocated_extents )
+	{
+		return( 1 );
+	}
+	/* Grow the allocation exponentially, a failing drive can fragment the map
+	 * into many extents
+	 */
+	number_of_allocated_extents = rescue_map->number_of_allocated_extents * 2;
+
+	if( number_of_allocated_extents < 16 )
+	{
+		number_of_allocated_extents = 16;
+	}
+	if( number_of_allocated_extents < number_of_extents )
+	{
+		number_of_allocated_extents = number_of_extents;
+	}
+	extents_size = sizeof( rescue_map_extent_t ) * (size_t) number_of_allocated_extents;
+
+	if( extents_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid extents size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                rescue_map->extents,
+	                extents_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize extents.",
+		 function );
+
+		return( -1 );
+	}
+	rescue_map->extents                     = (rescue_map_extent_t *) reallocation;
+	rescue_map->number_of_allocated_extents = number_of_allocated_extents;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the extent that contains a specific offset
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int rescue_map_get_extent_index_by_offset(
+     rescue_map_t *rescue_map,
+     off64_t offset,
+     int *extent_index,
+     libcerror_error_t **error )
+{
+	static char *function = "rescue_map_get_extent_index_by_offset";
+	int first_index       = 0;
+	int last_index        = 0;
+	int middle_index      = 0;
+
+	if( rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= rescue_map->media_size ) )
+	{
+		return( 0 );
+	}
+	/* The extents are contiguous, hence a binary search on the offset suffices
+	 */
+	last_index = rescue_map->number_of_extents - 1;
+
+	while( first_index < last_index )
+	{
+		middle_index = first_index + ( ( last_index - first_index + 1 ) / 2 );
+
+		if( rescue_map->extents[ middle_index ].offset <= offset )
+		{
+			first_index = middle_index;
+		}
+		else
+		{
+			last_index = middle_index - 1;
+		}
+	}
+	*extent_index = first_index;
+
+	return( 1 );
+}
+
+/* Sets the status of a range of the media
+ * Adjacent extents with the same status are merged
+ * Returns 1 if successful or -1 on error
+ */
+int rescue_map_set_status(
+     rescue_map_t *rescue_map,
+     off64_t offset,
+     size64_t size,
+     uint8_t status,
+     libcerror_error_t **error )
+{
+	rescue_map_extent_t extents[ 3 ];
+
+	rescue_map_extent_t *first_extent = NULL;
+	rescue_map_extent_t *last_extent  = NULL;
+	static char *function             = "rescue_map_set_status";
+	off64_t end_offset                = 0;
+	int extent_index                  = 0;
+	int first_index                   = 0;
+	int last_index                    = 0;
+	int merge_index                   = 0;
+	int merge_last_index              = 0;
+	int number_of_new_extents         = 0;
+	int number_of_replaced_extents    = 0;
+
+	if( rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( size == 0 )
+	 || ( (size64_t) offset >= rescue_map->media_size )
+	 || ( size > ( rescue_map->media_size - (size64_t) offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( status != RESCUE_MAP_STATUS_UNTRIED )
+	 && ( status != RESCUE_MAP_STATUS_FAILED )
+	 && ( status != RESCUE_MAP_STATUS_BAD )
+	 && ( status != RESCUE_MAP_STATUS_GOOD ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported status.",
+		 function );
+
+		return( -1 );
+	}
+	end_offset = offset + (off64_t) size;
+
+	if( ( rescue_map_get_extent_index_by_offset(
+	       rescue_map,
+	       offset,
+	       &first_index,
+	       error ) != 1 )
+	 || ( rescue_map_get_extent_index_by_offset(
+	       rescue_map,
+	       end_offset - 1,
+	       &last_index,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent index.",
+		 function );
+
+		return( -1 );
+	}
+	first_extent = &( rescue_map->extents[ first_index ] );
+	last_extent  = &( rescue_map->extents[ last_index ] );
+
+	/* Replace the extents in the range by the part of the first extent
+	 * before the range, the range itself and the part of the last extent
+	 * after the range
+	 */
+	if( first_extent->offset < offset )
+	{
+		extents[ number_of_new_extents ].offset = first_extent->offset;
+		extents[ number_of_new_extents ].size   = (size64_t) ( offset - first_extent->offset );
+		extents[ number_of_new_extents ].status = first_extent->status;
+
+		number_of_new_extents++;
+	}
+	extents[ number_of_new_extents ].offset = offset;
+	extents[ number_of_new_extents ].size   = size;
+	extents[ number_of_new_extents ].status = status;
+
+	number_of_new_extents++;
+
+	if( ( last_extent->offset + (off64_t) last_extent->size ) > end_offset )
+	{
+		extents[ number_of_new_extents ].offset = end_offset;
+		extents[ number_of_new_extents ].size   = (size64_t) ( last_extent->offset + (off64_t) last_extent->size - end_offset );
+		extents[ number_of_new_extents ].status = last_extent->status;
+
+		number_of_new_extents++;
+	}
+	number_of_replaced_extents = last_index - first_index + 1;
+
+	if( rescue_map_resize(
+	     rescue_map,
+	     rescue_map->number_of_extents + number_of_new_extents - number_of_replaced_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( last_index + 1 ) < rescue_map->number_of_extents )
+	{
+		memmove(
+		 &( rescue_map->extents[ first_index + number_of_new_extents ] ),
+		 &( rescue_map->extents[ last_index + 1 ] ),
+		 sizeof( rescue_map_extent_t ) * (size_t) ( rescue_map->number_of_extents - ( last_index + 1 ) ) );
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_new_extents;
+	     extent_index++ )
+	{
+		rescue_map->extents[ first_index + extent_index ] = extents[ extent_index ];
+	}
+	rescue_map->number_of_extents += number_of_new_extents - number_of_replaced_extents;
+
+	/* Merge the new extents with their neighbours
+	 */
+	merge_index      = ( first_index > 0 ) ? first_index - 1 : first_index;
+	merge_last_index = first_index + number_of_new_extents;
+
+	if( merge_last_index >= rescue_map->number_of_extents )
+	{
+		merge_last_index = rescue_map->number_of_extents - 1;
+	}
+	while( merge_index < merge_last_index )
+	{
+		if( rescue_map->extents[ merge_index ].status != rescue_map->extents[ merge_index + 1 ].status )
+		{
+			merge_index++;
+
+			continue;
+		}
+		rescue_map->extents[ merge_index ].size += rescue_map->extents[ merge_index + 1 ].size;
+
+		if( ( merge_index + 2 ) < rescue_map->number_of_extents )
+		{
+			memmove(
+			 &( rescue_map->extents[ merge_index + 1 ] ),
+			 &( rescue_map->extents[ merge_index + 2 ] ),
+			 sizeof( rescue_map_extent_t ) * (size_t) ( rescue_map->number_of_extents - ( merge_index + 2 ) ) );
+		}
+		rescue_map->number_of_extents -= 1;
+		merge_last_index              -= 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the next range with a specific status at or after a start offset
+ * Returns 1 if successful, 0 if no such range or -1 on error
+ */
+int rescue_map_get_next_extent(
+     rescue_map_t *rescue_map,
+     uint8_t status,
+     off64_t start_offset,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "rescue_map_get_next_extent";
+	int extent_index      = 0;
+	int result            = 0;
+
+	if( rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	result = rescue_map_get_extent_index_by_offset(
+	          rescue_map,
+	          start_offset,
+	          &extent_index,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	while( extent_index < rescue_map->number_of_extents )
+	{
+		if( rescue_map->extents[ extent_index ].status == status )
+		{
+			*offset = rescue_map->extents[ extent_index ].offset;
+
+			if( *offset < start_offset )
+			{
+				*offset = start_offset;
+			}
+			*size = (size64_t) ( rescue_map->extents[ extent_index ].offset + (off64_t) rescue_map->extents[ extent_index ].size - *offset );
+
+			return( 1 );
+		}
+		extent_index++;
+	}
+	return( 0 );
+}
+
+/* Retrieves the total size of the extents with a specific status
+ * Returns 1 if successful or -1 on error
+ */
+int rescue_map_get_size_by_status(
+     rescue_map_t *rescue_map,
+     uint8_t status,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "rescue_map_get_size_by_status";
+	int extent_index      = 0;
+
+	if( rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = 0;
+
+	for( extent_index = 0;
+	     extent_index < rescue_map->number_of_extents;
+	     extent_index++ )
+	{
+		if( rescue_map->extents[ extent_index ].status == status )
+		{
+			*size += rescue_map->extents[ extent_index ].size;
+		}
+	}
+	return( 1 );
+}
+
+/* Copies a hexadecimal value formatted as 0x### from a string
+ * Returns 1 if successful or -1 on error
+ */
+int rescue_map_copy_hexadecimal_from_string(
+     const char *string,
+     size_t string_length,
+     size_t *string_index,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "rescue_map_copy_hexadecimal_from_string";
+	size_t safe_index     = 0;
+	uint64_t safe_value   = 0;
+	int number_of_digits  = 0;
+	char character        = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	safe_index = *string_index;
+
+	while( ( safe_index < string_length )
+	    && ( ( string[ safe_index ] == ' ' )
+	     ||  ( string[ safe_index ] == '\t' ) ) )
+	{
+		safe_index++;
+	}
+	if( ( ( safe_index + 2 ) > string_length )
+	 || ( string[ safe_index ] != '0' )
+	 || ( ( string[ safe_index + 1 ] != 'x' )
+	  &&  ( string[ safe_index + 1 ] != 'X' ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported hexadecimal value.",
+		 function );
+
+		return( -1 );
+	}
+	safe_index += 2;
+
+	while( safe_index < string_length )
+	{
+		character = string[ safe_index ];
+
+		if( ( character >= '0' )
+		 && ( character <= '9' ) )
+		{
+			character -= '0';
+		}
+		else if( ( character >= 'a' )
+		      && ( character <= 'f' ) )
+		{
+			character -= 'a' - 10;
+		}
+		else if( ( character >= 'A' )
+		      && ( character <= 'F' ) )
+		{
+			character -= 'A' - 10;
+		}
+		else
+		{
+			break;
+		}
+		if( number_of_digits >= 16 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: hexadecimal value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value <<= 4;
+		safe_value  |= (uint64_t) character;
+
+		number_of_digits++;
+		safe_index++;
+	}
+	if( number_of_digits == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: missing hexadecimal digits.",
+		 function );
+
+		return( -1 );
+	}
+	*string_index = safe_index;
+	*value        = safe_value;
+
+	return( 1 );
+}
+
+/* Reads the rescue map from a file
+ * Every line contains the offset and size of an extent, in hexadecimal, and its status
+ * Returns 1 if successful, 0 if the file does not exist or -1 on error
+ */
+int rescue_map_read(
+     rescue_map_t *rescue_map,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	char line[ 128 ];
+
+	FILE *file_stream        = NULL;
+	static char *function    = "rescue_map_read";
+	size_t line_index        = 0;
+	size_t line_length       = 0;
+	uint64_t expected_offset = 0;
+	uint64_t offset          = 0;
+	uint64_t size            = 0;
+	int line_number          = 0;
+	int number_of_extents    = 0;
+	uint8_t status           = 0;
+
+	if( rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"r" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "r" );
+#endif
+	if( file_stream == NULL )
+	{
+		if( errno == ENOENT )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open rescue map: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        128 ) != NULL )
+	{
+		line_number++;
+
+		line_length = narrow_string_length(
+		               line );
+
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == '\n' )
+		     ||  ( line[ line_length - 1 ] == '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == '#' ) )
+		{
+			continue;
+		}
+		line_index = 0;
+
+		if( ( rescue_map_copy_hexadecimal_from_string(
+		       line,
+		       line_length,
+		       &line_index,
+		       &offset,
+		       error ) != 1 )
+		 || ( rescue_map_copy_hexadecimal_from_string(
+		       line,
+		       line_length,
+		       &line_index,
+		       &size,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported extent on line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_index < line_length )
+		    && ( ( line[ line_index ] == ' ' )
+		     ||  ( line[ line_index ] == '\t' ) ) )
+		{
+			line_index++;
+		}
+		status = 0;
+
+		if( ( line_index + 1 ) == line_length )
+		{
+			status = (uint8_t) line[ line_index ];
+		}
+		if( ( status != RESCUE_MAP_STATUS_UNTRIED )
+		 && ( status != RESCUE_MAP_STATUS_FAILED )
+		 && ( status != RESCUE_MAP_STATUS_BAD )
+		 && ( status != RESCUE_MAP_STATUS_GOOD ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported status on line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		/* The extents must be contiguous and stay within the media
+		 */
+		if( ( size == 0 )
+		 || ( offset != expected_offset )
+		 || ( size > ( rescue_map->media_size - offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extent on line: %d value out of bounds.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( rescue_map_resize(
+		     rescue_map,
+		     number_of_extents + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize extents.",
+			 function );
+
+			goto on_error;
+		}
+		rescue_map->extents[ number_of_extents ].offset = (off64_t) offset;
+		rescue_map->extents[ number_of_extents ].size   = (size64_t) size;
+		rescue_map->extents[ number_of_extents ].status = status;
+
+		number_of_extents++;
+
+		expected_offset = offset + size;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close rescue map.",
+		 function );
+
+		file_stream = NULL;
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+	if( ( number_of_extents == 0 )
+	 || ( expected_offset != (uint64_t) rescue_map->media_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: rescue map does not cover the media size.",
+		 function );
+
+		goto on_error;
+	}
+	rescue_map->number_of_extents = number_of_extents;
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	/* Restore a map that covers the entire media
+	 */
+	rescue_map->extents[ 0 ].offset = 0;
+	rescue_map->extents[ 0 ].size   = rescue_map->media_size;
+	rescue_map->extents[ 0 ].status = RESCUE_MAP_STATUS_UNTRIED;
+
+	rescue_map->number_of_extents = ( rescue_map->media_size > 0 ) ? 1 : 0;
+
+	return( -1 );
+}
+
+/* Writes the rescue map to a file
+ * The map is written to a temporary file first that replaces the file
+ * so that an interrupted write never leaves a damaged map behind
+ * Returns 1 if successful or -1 on error
+ */
+int rescue_map_write(
+     rescue_map_t *rescue_map,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t *temporary_filename = NULL;
+	FILE *file_stream                      = NULL;
+	static char *function                  = "rescue_map_write";
+	size_t filename_length                 = 0;
+	int extent_index                       = 0;
+	int print_count                        = 0;
+
+	if( rescue_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rescue map.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	temporary_filename = (system_character_t *) memory_allocate(
+	                                             sizeof( system_character_t ) * ( filename_length + 5 ) );
+
+	if( temporary_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create temporary filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     temporary_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( temporary_filename[ filename_length ] ),
+	     _SYSTEM_STRING( ".tmp" ),
+	     5 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy temporary filename suffix.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               temporary_filename,
+	               L"w" );
+#else
+	file_stream = file_stream_open(
+	               temporary_filename,
+	               "w" );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open temporary rescue map: %" PRIs_SYSTEM ".",
+		 function,
+		 temporary_filename );
+
+		goto on_error;
+	}
+	print_count = fprintf(
+	               file_stream,
+	               "# Rescue map of tableauacquire\n"
+	               "# Status: ? untried, * failed, - bad sector, + good\n"
+	               "# offset\tsize\tstatus\n" );
+
+	for( extent_index = 0;
+	     ( print_count >= 0 ) && ( extent_index < rescue_map->number_of_extents );
+	     extent_index++ )
+	{
+		print_count = fprintf(
+		               file_stream,
+		               "0x%08" PRIx64 "\t0x%08" PRIx64 "\t%c\n",
+		               (uint64_t) rescue_map->extents[ extent_index ].offset,
+		               (uint64_t) rescue_map->extents[ extent_index ].size,
+		               (char) rescue_map->extents[ extent_index ].status );
+	}
+	if( print_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write temporary rescue map.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close temporary rescue map.",
+		 function );
+
+		file_stream = NULL;
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( _wrename(
+	     temporary_filename,
+	     filename ) != 0 )
+#else
+	if( rename(
+	     temporary_filename,
+	     filename ) != 0 )
+#endif
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to replace rescue map: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	memory_free(
+	 temporary_filename );
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( temporary_filename != NULL )
+	{
+		memory_free(
+		 temporary_filename );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,145 @@
+/*
+ * Rescue map of the recovery mode
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RESCUE_MAP_H )
+#define _RESCUE_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The status of an extent, the values are the characters used in the rescue map file
+ */
+enum RESCUE_MAP_STATUSES
+{
+	RESCUE_MAP_STATUS_UNTRIED	= (uint8_t) '?',
+	RESCUE_MAP_STATUS_FAILED	= (uint8_t) '*',
+	RESCUE_MAP_STATUS_BAD		= (uint8_t) '-',
+	RESCUE_MAP_STATUS_GOOD		= (uint8_t) '+'
+};
+
+typedef struct rescue_map_extent rescue_map_extent_t;
+
+struct rescue_map_extent
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The status
+	 */
+	uint8_t status;
+};
+
+typedef struct rescue_map rescue_map_t;
+
+struct rescue_map
+{
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The extents, sorted by offset and covering the entire media
+	 */
+	rescue_map_extent_t *extents;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The number of allocated extents
+	 */
+	int number_of_allocated_extents;
+};
+
+int rescue_map_initialize(
+     rescue_map_t **rescue_map,
+     size64_t media_size,
+     libcerror_error_t **error );
+
+int rescue_map_free(
+     rescue_map_t **rescue_map,
+     libcerror_error_t **error );
+
+int rescue_map_resize(
+     rescue_map_t *rescue_map,
+     int number_of_extents,
+     libcerror_error_t **error );
+
+int rescue_map_get_extent_index_by_offset(
+     rescue_map_t *rescue_map,
+     off64_t offset,
+     int *extent_index,
+     libcerror_error_t **error );
+
+int rescue_map_set_status(
+     rescue_map_t *rescue_map,
+     off64_t offset,
+     size64_t size,
+     uint8_t status,
+     libcerror_error_t **error );
+
+int rescue_map_get_next_extent(
+     rescue_map_t *rescue_map,
+     uint8_t status,
+     off64_t start_offset,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int rescue_map_get_size_by_status(
+     rescue_map_t *rescue_map,
+     uint8_t status,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int rescue_map_copy_hexadecimal_from_string(
+     const char *string,
+     size_t string_length,
+     size_t *string_index,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int rescue_map_read(
+     rescue_map_t *rescue_map,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int rescue_map_write(
+     rescue_map_t *rescue_map,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RESCUE_MAP_H ) */
+
@@ -0,0 +1,2427 @@
+/*
+ * Segmented output writer
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_SYSCALL_H )
+#include <sys/syscall.h>
+#endif
+
+#include "segment_writer.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libcnotify.h"
+#include "tableautools_libcthreads.h"
+
+/* Creates a segment writer
+ * Make sure the value segment_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_initialize(
+     segment_writer_t **segment_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_initialize";
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*segment_writer = memory_allocate_structure(
+	                   segment_writer_t );
+
+	if( *segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *segment_writer,
+	     0,
+	     sizeof( segment_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment writer.",
+		 function );
+
+		memory_free(
+		 *segment_writer );
+
+		*segment_writer = NULL;
+
+		return( -1 );
+	}
+	( *segment_writer )->fsync_policy = SEGMENT_WRITER_FSYNC_POLICY_CLOSE;
+	( *segment_writer )->queue_depth  = SEGMENT_WRITER_DEFAULT_QUEUE_DEPTH;
+
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+	( *segment_writer )->ring_file_descriptor = -1;
+#endif
+	return( 1 );
+}
+
+/* Frees a segment writer
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_free(
+     segment_writer_t **segment_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_free";
+	int result            = 1;
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_writer != NULL )
+	{
+		if( ( *segment_writer )->file_descriptors != NULL )
+		{
+			if( segment_writer_close(
+			     *segment_writer,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close segment writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *segment_writer );
+
+		*segment_writer = NULL;
+	}
+	return( result );
+}
+
+/* Sets the fsync policy
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_set_fsync_policy(
+     segment_writer_t *segment_writer,
+     uint8_t fsync_policy,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_set_fsync_policy";
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( fsync_policy != SEGMENT_WRITER_FSYNC_POLICY_NONE )
+	 && ( fsync_policy != SEGMENT_WRITER_FSYNC_POLICY_CLOSE )
+	 && ( fsync_policy != SEGMENT_WRITER_FSYNC_POLICY_SEGMENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported fsync policy: %" PRIu8 ".",
+		 function,
+		 fsync_policy );
+
+		return( -1 );
+	}
+	segment_writer->fsync_policy = fsync_policy;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of asynchronous write requests in flight
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_set_queue_depth(
+     segment_writer_t *segment_writer,
+     int queue_depth,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_set_queue_depth";
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer->is_asynchronous != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment writer - asynchronous writes already started.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_depth <= 0 )
+	 || ( queue_depth > SEGMENT_WRITER_MAXIMUM_QUEUE_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment_writer->queue_depth = queue_depth;
+
+	return( 1 );
+}
+
+/* Opens the segment files of the output
+ * A segment size of 0 writes the output to a single file named filename,
+ * otherwise the output is split into segment files named filename.001,
+ * filename.002, etc. of segment size bytes each
+ * When create is set the segment files are created and must not exist,
+ * otherwise the existing segment files are opened
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_open(
+     segment_writer_t *segment_writer,
+     const system_character_t *filename,
+     size64_t size,
+     size64_t segment_size,
+     uint8_t create,
+     libcerror_error_t **error )
+{
+	system_character_t *segment_filename = NULL;
+	static char *function                = "segment_writer_open";
+	size64_t number_of_segments          = 1;
+	size_t filename_length               = 0;
+	int segment_index                    = 0;
+	int segment_number                   = 0;
+
+#if defined( HAVE_OPEN ) && defined( HAVE_FCNTL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int flags                            = O_RDWR;
+#endif
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer->file_descriptors != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment writer - file descriptors already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size > 0 )
+	{
+		number_of_segments = size / segment_size;
+
+		if( ( size % segment_size ) != 0 )
+		{
+			number_of_segments += 1;
+		}
+		if( number_of_segments == 0 )
+		{
+			number_of_segments = 1;
+		}
+		if( number_of_segments > (size64_t) SEGMENT_WRITER_MAXIMUM_NUMBER_OF_SEGMENTS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment size value too small for a maximum of %d segment files.",
+			 function,
+			 SEGMENT_WRITER_MAXIMUM_NUMBER_OF_SEGMENTS );
+
+			return( -1 );
+		}
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	/* Add space for the .### extension and the end-of-string character
+	 */
+	segment_filename = (system_character_t *) memory_allocate(
+	                                           sizeof( system_character_t ) * ( filename_length + 5 ) );
+
+	if( segment_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     segment_filename,
+	     filename,
+	     filename_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	segment_writer->file_descriptors = (int *) memory_allocate(
+	                                            sizeof( int ) * (size_t) number_of_segments );
+
+	if( segment_writer->file_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_index = 0;
+	     segment_index < (int) number_of_segments;
+	     segment_index++ )
+	{
+		segment_writer->file_descriptors[ segment_index ] = -1;
+	}
+	segment_writer->size                  = size;
+	segment_writer->segment_size          = segment_size;
+	segment_writer->number_of_segments    = (int) number_of_segments;
+	segment_writer->current_segment_index = 0;
+
+#if defined( HAVE_OPEN ) && defined( HAVE_FCNTL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( create != 0 )
+	{
+		flags |= O_CREAT | O_EXCL;
+	}
+	for( segment_index = 0;
+	     segment_index < segment_writer->number_of_segments;
+	     segment_index++ )
+	{
+		if( segment_size > 0 )
+		{
+			segment_number = segment_index + 1;
+
+			segment_filename[ filename_length ]     = (system_character_t) '.';
+			segment_filename[ filename_length + 1 ] = (system_character_t) ( '0' + ( segment_number / 100 ) );
+			segment_filename[ filename_length + 2 ] = (system_character_t) ( '0' + ( ( segment_number / 10 ) % 10 ) );
+			segment_filename[ filename_length + 3 ] = (system_character_t) ( '0' + ( segment_number % 10 ) );
+			segment_filename[ filename_length + 4 ] = 0;
+		}
+		segment_writer->file_descriptors[ segment_index ] = open(
+		                                                     segment_filename,
+		                                                     flags,
+		                                                     S_IRUSR | S_IWUSR | S_IRGRP );
+
+		if( segment_writer->file_descriptors[ segment_index ] == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open output file: %" PRIs_SYSTEM ".",
+			 function,
+			 segment_filename );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 segment_filename );
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing output file support.",
+	 function );
+
+	goto on_error;
+
+#endif /* defined( HAVE_OPEN ) && defined( HAVE_FCNTL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+on_error:
+	if( segment_writer->file_descriptors != NULL )
+	{
+#if defined( HAVE_CLOSE )
+		for( segment_index = 0;
+		     segment_index < segment_writer->number_of_segments;
+		     segment_index++ )
+		{
+			if( segment_writer->file_descriptors[ segment_index ] != -1 )
+			{
+				close(
+				 segment_writer->file_descriptors[ segment_index ] );
+			}
+		}
+#endif
+		memory_free(
+		 segment_writer->file_descriptors );
+
+		segment_writer->file_descriptors = NULL;
+	}
+	segment_writer->number_of_segments = 0;
+
+	if( segment_filename != NULL )
+	{
+		memory_free(
+		 segment_filename );
+	}
+	return( -1 );
+}
+
+/* Closes the segment files
+ * The segment files are synchronized first unless the fsync policy is none
+ * Returns 0 if successful or -1 on error
+ */
+int segment_writer_close(
+     segment_writer_t *segment_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_close";
+	int result            = 0;
+	int segment_index     = 0;
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer->file_descriptors == NULL )
+	{
+		return( 0 );
+	}
+	if( segment_writer->is_asynchronous != 0 )
+	{
+		if( segment_writer_stop_asynchronous(
+		     segment_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop asynchronous writes.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( result == 0 )
+	 && ( segment_writer->fsync_policy != SEGMENT_WRITER_FSYNC_POLICY_NONE ) )
+	{
+		if( segment_writer_synchronize(
+		     segment_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to synchronize segment files.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_CLOSE )
+	for( segment_index = 0;
+	     segment_index < segment_writer->number_of_segments;
+	     segment_index++ )
+	{
+		if( segment_writer->file_descriptors[ segment_index ] == -1 )
+		{
+			continue;
+		}
+		if( close(
+		     segment_writer->file_descriptors[ segment_index ] ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close segment file: %d.",
+			 function,
+			 segment_index );
+
+			result = -1;
+		}
+		segment_writer->file_descriptors[ segment_index ] = -1;
+	}
+#endif
+	memory_free(
+	 segment_writer->file_descriptors );
+
+	segment_writer->file_descriptors   = NULL;
+	segment_writer->number_of_segments = 0;
+
+	return( result );
+}
+
+/* Determines the segment file that contains an offset in the output
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_get_segment_by_offset(
+     segment_writer_t *segment_writer,
+     off64_t offset,
+     int *segment_index,
+     off64_t *segment_file_offset,
+     size64_t *segment_file_remaining_size,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_get_segment_by_offset";
+	size64_t index        = 0;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer->segment_size == 0 )
+	{
+		*segment_index               = 0;
+		*segment_file_offset         = offset;
+		*segment_file_remaining_size = (size64_t) INT64_MAX - (size64_t) offset;
+
+		return( 1 );
+	}
+	index = (size64_t) offset / segment_writer->segment_size;
+
+	if( index >= (size64_t) segment_writer->number_of_segments )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset: %" PRIi64 " (0x%08" PRIx64 ") value out of bounds.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	*segment_index               = (int) index;
+	*segment_file_offset         = (off64_t) ( (size64_t) offset % segment_writer->segment_size );
+	*segment_file_remaining_size = segment_writer->segment_size - (size64_t) *segment_file_offset;
+
+	return( 1 );
+}
+
+/* Writes data to a segment file at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_write_segment_file(
+     int file_descriptor,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t segment_file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_write_segment_file";
+	size_t data_offset    = 0;
+
+#if defined( HAVE_PWRITE ) || defined( HAVE_WRITE )
+	ssize_t write_count   = 0;
+#endif
+
+#if !defined( HAVE_PWRITE ) && defined( HAVE_LSEEK )
+	if( lseek(
+	     file_descriptor,
+	     (off_t) segment_file_offset,
+	     SEEK_SET ) != (off_t) segment_file_offset )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in segment file.",
+		 function,
+		 segment_file_offset,
+		 segment_file_offset );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_PWRITE ) || ( defined( HAVE_WRITE ) && defined( HAVE_LSEEK ) )
+	while( data_offset < data_size )
+	{
+#if defined( HAVE_PWRITE )
+		write_count = pwrite(
+		               file_descriptor,
+		               &( data[ data_offset ] ),
+		               data_size - data_offset,
+		               (off_t) ( segment_file_offset + (off64_t) data_offset ) );
+#else
+		write_count = write(
+		               file_descriptor,
+		               &( data[ data_offset ] ),
+		               data_size - data_offset );
+#endif
+		if( write_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 errno,
+			 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ") in segment file.",
+			 function,
+			 segment_file_offset,
+			 segment_file_offset );
+
+			return( -1 );
+		}
+		data_offset += (size_t) write_count;
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing output file support.",
+	 function );
+
+	return( -1 );
+
+#endif /* defined( HAVE_PWRITE ) || ( defined( HAVE_WRITE ) && defined( HAVE_LSEEK ) ) */
+}
+
+/* Synchronizes a segment file to disk
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_synchronize_segment_file(
+     segment_writer_t *segment_writer,
+     int segment_index,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_synchronize_segment_file";
+
+#if defined( HAVE_FSYNC )
+	if( fsync(
+	     segment_writer->file_descriptors[ segment_index ] ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to synchronize segment file: %d.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+
+/* Waits until a request is available
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_get_free_request(
+     segment_writer_t *segment_writer,
+     int *request_index,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_get_free_request";
+	int error_number      = 0;
+	off64_t error_offset  = 0;
+
+	if( libcthreads_mutex_grab(
+	     segment_writer->requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab requests mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( segment_writer->number_of_free_requests == 0 )
+	    && ( segment_writer->asynchronous_error_number == 0 ) )
+	{
+		if( libcthreads_condition_wait(
+		     segment_writer->requests_condition,
+		     segment_writer->requests_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for requests condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 segment_writer->requests_mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	error_number = segment_writer->asynchronous_error_number;
+	error_offset = segment_writer->asynchronous_error_offset;
+
+	if( error_number == 0 )
+	{
+		segment_writer->number_of_free_requests -= 1;
+
+		*request_index = segment_writer->free_requests[ segment_writer->number_of_free_requests ];
+	}
+	if( libcthreads_mutex_release(
+	     segment_writer->requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release requests mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_number != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 error_number,
+		 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 error_offset,
+		 error_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Returns a request that is no longer in flight
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_put_free_request(
+     segment_writer_t *segment_writer,
+     int request_index,
+     int error_number,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_put_free_request";
+	int result            = 1;
+
+	if( libcthreads_mutex_grab(
+	     segment_writer->requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab requests mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( error_number != 0 )
+	 && ( segment_writer->asynchronous_error_number == 0 ) )
+	{
+		segment_writer->asynchronous_error_number = error_number;
+		segment_writer->asynchronous_error_offset = segment_writer->requests[ request_index ].offset;
+	}
+	segment_writer->free_requests[ segment_writer->number_of_free_requests ] = request_index;
+
+	segment_writer->number_of_free_requests += 1;
+
+	if( libcthreads_condition_broadcast(
+	     segment_writer->requests_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast requests condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     segment_writer->requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release requests mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Waits until no requests are in flight
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_wait_for_requests(
+     segment_writer_t *segment_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_wait_for_requests";
+	int error_number      = 0;
+	off64_t error_offset  = 0;
+
+	if( libcthreads_mutex_grab(
+	     segment_writer->requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab requests mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( segment_writer->number_of_free_requests < segment_writer->queue_depth )
+	{
+		if( libcthreads_condition_wait(
+		     segment_writer->requests_condition,
+		     segment_writer->requests_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for requests condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 segment_writer->requests_mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	error_number = segment_writer->asynchronous_error_number;
+	error_offset = segment_writer->asynchronous_error_offset;
+
+	if( libcthreads_mutex_release(
+	     segment_writer->requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release requests mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_number != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 error_number,
+		 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 error_offset,
+		 error_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Places a submission queue entry of a request on the ring and submits it
+ * A request index of -1 submits a no operation entry that stops the completion thread
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_submit_request(
+     segment_writer_t *segment_writer,
+     int request_index,
+     libcerror_error_t **error )
+{
+	segment_writer_request_t *request          = NULL;
+	struct io_uring_sqe *submission_entry      = NULL;
+	static char *function                      = "segment_writer_submit_request";
+	uint32_t submission_tail                   = 0;
+	uint32_t submission_index                  = 0;
+	int buffer_index                           = 0;
+	int result                                 = 0;
+
+	submission_tail  = *( segment_writer->submission_tail );
+	submission_index = submission_tail & segment_writer->submission_ring_mask;
+	submission_entry = &( segment_writer->submission_entries[ submission_index ] );
+
+	if( memory_set(
+	     submission_entry,
+	     0,
+	     sizeof( struct io_uring_sqe ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear submission queue entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( request_index == -1 )
+	{
+		submission_entry->opcode = IORING_OP_NOP;
+	}
+	else
+	{
+		request = &( segment_writer->requests[ request_index ] );
+
+		submission_entry->fd        = request->file_descriptor;
+		submission_entry->off       = (uint64_t) request->segment_file_offset;
+		submission_entry->user_data = (uint64_t) request_index + 1;
+
+		if( request->data_size == 0 )
+		{
+			/* Drain the ring so that the synchronization covers every write
+			 * that was submitted before
+			 */
+			submission_entry->opcode = IORING_OP_FSYNC;
+			submission_entry->flags  = IOSQE_IO_DRAIN;
+		}
+		else
+		{
+			for( buffer_index = 0;
+			     buffer_index < segment_writer->number_of_registered_buffers;
+			     buffer_index++ )
+			{
+				if( ( request->data >= (uint8_t *) segment_writer->registered_buffers[ buffer_index ].iov_base )
+				 && ( &( request->data[ request->data_size ] ) <= &( ( (uint8_t *) segment_writer->registered_buffers[ buffer_index ].iov_base )[ segment_writer->registered_buffers[ buffer_index ].iov_len ] ) ) )
+				{
+					break;
+				}
+			}
+			if( buffer_index < segment_writer->number_of_registered_buffers )
+			{
+				submission_entry->opcode    = IORING_OP_WRITE_FIXED;
+				submission_entry->addr      = (uint64_t) (intptr_t) request->data;
+				submission_entry->len       = (uint32_t) request->data_size;
+				submission_entry->buf_index = (uint16_t) buffer_index;
+			}
+			else
+			{
+				request->iovec.iov_base = (void *) request->data;
+				request->iovec.iov_len  = request->data_size;
+
+				submission_entry->opcode = IORING_OP_WRITEV;
+				submission_entry->addr   = (uint64_t) (intptr_t) &( request->iovec );
+				submission_entry->len    = 1;
+			}
+		}
+	}
+	segment_writer->submission_array[ submission_index ] = submission_index;
+
+	/* Make the entry visible to the kernel before the tail is moved
+	 */
+	__atomic_store_n(
+	 segment_writer->submission_tail,
+	 submission_tail + 1,
+	 __ATOMIC_RELEASE );
+
+	do
+	{
+		result = (int) syscall(
+		                __NR_io_uring_enter,
+		                segment_writer->ring_file_descriptor,
+		                1,
+		                0,
+		                0,
+		                NULL,
+		                0 );
+	}
+	while( ( result == -1 )
+	    && ( errno == EINTR ) );
+
+	if( result != 1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to submit request.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Submits a request to write data or to synchronize a segment file
+ * A data size of 0 synchronizes the segment file
+ * The reference function is called for the value before the request is
+ * submitted and the release function when the request has completed
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_submit(
+     segment_writer_t *segment_writer,
+     int segment_index,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t segment_file_offset,
+     off64_t offset,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	segment_writer_request_t *request = NULL;
+	static char *function             = "segment_writer_submit";
+	int request_index                 = 0;
+
+	if( segment_writer_get_free_request(
+	     segment_writer,
+	     &request_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve free request.",
+		 function );
+
+		return( -1 );
+	}
+	request = &( segment_writer->requests[ request_index ] );
+
+	request->value               = value;
+	request->file_descriptor     = segment_writer->file_descriptors[ segment_index ];
+	request->data                = data;
+	request->data_size           = data_size;
+	request->segment_file_offset = segment_file_offset;
+	request->offset              = offset;
+
+	if( ( value != NULL )
+	 && ( segment_writer->reference_function != NULL ) )
+	{
+		if( segment_writer->reference_function(
+		     value,
+		     segment_writer->callback_arguments ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reference value.",
+			 function );
+
+			segment_writer_put_free_request(
+			 segment_writer,
+			 request_index,
+			 0,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     segment_writer->requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab requests mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_writer_submit_request(
+	     segment_writer,
+	     request_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to submit request.",
+		 function );
+
+		libcthreads_mutex_release(
+		 segment_writer->requests_mutex,
+		 NULL );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     segment_writer->requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release requests mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( ( value != NULL )
+	 && ( segment_writer->release_function != NULL ) )
+	{
+		segment_writer->release_function(
+		 value,
+		 segment_writer->callback_arguments );
+	}
+	segment_writer_put_free_request(
+	 segment_writer,
+	 request_index,
+	 0,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Completes the requests reported on the completion queue until stopped
+ * A short write is completed synchronously
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_completion_thread_function(
+     segment_writer_t *segment_writer )
+{
+	struct io_uring_cqe *completion_entry = NULL;
+	segment_writer_request_t *request     = NULL;
+	uint64_t user_data                    = 0;
+	uint32_t completion_head              = 0;
+	uint32_t completion_tail              = 0;
+	int32_t completion_result             = 0;
+	int error_number                      = 0;
+	int request_index                     = 0;
+	int result                            = 0;
+
+	if( segment_writer == NULL )
+	{
+		return( -1 );
+	}
+	while( 1 )
+	{
+		completion_head = *( segment_writer->completion_head );
+		completion_tail = __atomic_load_n(
+		                   segment_writer->completion_tail,
+		                   __ATOMIC_ACQUIRE );
+
+		if( completion_head == completion_tail )
+		{
+			result = (int) syscall(
+			                __NR_io_uring_enter,
+			                segment_writer->ring_file_descriptor,
+			                0,
+			                1,
+			                IORING_ENTER_GETEVENTS,
+			                NULL,
+			                0 );
+
+			if( ( result == -1 )
+			 && ( errno != EINTR ) )
+			{
+				return( -1 );
+			}
+			continue;
+		}
+		completion_entry = &( segment_writer->completion_entries[ completion_head & segment_writer->completion_ring_mask ] );
+
+		user_data         = completion_entry->user_data;
+		completion_result = completion_entry->res;
+
+		__atomic_store_n(
+		 segment_writer->completion_head,
+		 completion_head + 1,
+		 __ATOMIC_RELEASE );
+
+		if( user_data == 0 )
+		{
+			break;
+		}
+		request_index = (int) ( user_data - 1 );
+		request       = &( segment_writer->requests[ request_index ] );
+		error_number  = 0;
+
+		if( completion_result < 0 )
+		{
+			error_number = -completion_result;
+
+			if( ( request->data_size > 0 )
+			 && ( ( error_number == EAGAIN )
+			  || ( error_number == EINTR ) ) )
+			{
+				error_number      = 0;
+				completion_result = 0;
+			}
+		}
+		if( ( error_number == 0 )
+		 && ( (size_t) completion_result < request->data_size ) )
+		{
+			if( segment_writer_write_segment_file(
+			     request->file_descriptor,
+			     &( request->data[ completion_result ] ),
+			     request->data_size - (size_t) completion_result,
+			     request->segment_file_offset + (off64_t) completion_result,
+			     NULL ) != 1 )
+			{
+				error_number = errno;
+
+				if( error_number == 0 )
+				{
+					error_number = EIO;
+				}
+			}
+		}
+		if( ( request->value != NULL )
+		 && ( segment_writer->release_function != NULL ) )
+		{
+			segment_writer->release_function(
+			 request->value,
+			 segment_writer->callback_arguments );
+		}
+		if( segment_writer_put_free_request(
+		     segment_writer,
+		     request_index,
+		     error_number,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Frees the io_uring resources
+ */
+void segment_writer_free_ring(
+      segment_writer_t *segment_writer )
+{
+	if( segment_writer->submission_entries != NULL )
+	{
+		munmap(
+		 segment_writer->submission_entries,
+		 segment_writer->submission_entries_size );
+
+		segment_writer->submission_entries = NULL;
+	}
+	if( ( segment_writer->completion_ring != NULL )
+	 && ( segment_writer->completion_ring != segment_writer->submission_ring ) )
+	{
+		munmap(
+		 segment_writer->completion_ring,
+		 segment_writer->completion_ring_size );
+	}
+	segment_writer->completion_ring = NULL;
+
+	if( segment_writer->submission_ring != NULL )
+	{
+		munmap(
+		 segment_writer->submission_ring,
+		 segment_writer->submission_ring_size );
+
+		segment_writer->submission_ring = NULL;
+	}
+	if( segment_writer->ring_file_descriptor != -1 )
+	{
+		close(
+		 segment_writer->ring_file_descriptor );
+
+		segment_writer->ring_file_descriptor = -1;
+	}
+	if( segment_writer->registered_buffers != NULL )
+	{
+		memory_free(
+		 segment_writer->registered_buffers );
+
+		segment_writer->registered_buffers = NULL;
+	}
+	segment_writer->number_of_registered_buffers = 0;
+
+	if( segment_writer->free_requests != NULL )
+	{
+		memory_free(
+		 segment_writer->free_requests );
+
+		segment_writer->free_requests = NULL;
+	}
+	if( segment_writer->requests != NULL )
+	{
+		memory_free(
+		 segment_writer->requests );
+
+		segment_writer->requests = NULL;
+	}
+	if( segment_writer->requests_condition != NULL )
+	{
+		libcthreads_condition_free(
+		 &( segment_writer->requests_condition ),
+		 NULL );
+	}
+	if( segment_writer->requests_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( segment_writer->requests_mutex ),
+		 NULL );
+	}
+}
+
+#endif /* defined( SEGMENT_WRITER_HAVE_IO_URING ) */
+
+/* Starts asynchronous writes using io_uring
+ * The buffers are registered with the kernel so that writes from them do not
+ * need to map the buffer memory for every request, when the buffers cannot be
+ * registered the writes are submitted without registered buffers
+ * The reference function is called for the value of a write before every
+ * request is submitted and the release function when the request has completed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int segment_writer_start_asynchronous(
+     segment_writer_t *segment_writer,
+     uint8_t **buffers,
+     size_t buffer_size,
+     int number_of_buffers,
+     int (*reference_function)(
+            intptr_t *value,
+            void *callback_arguments ),
+     int (*release_function)(
+            intptr_t *value,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	static char *function             = "segment_writer_start_asynchronous";
+
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+	struct io_uring_params parameters;
+
+	int buffer_index                  = 0;
+	int request_index                 = 0;
+#endif
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer->file_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment writer - missing file descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer->is_asynchronous != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment writer - asynchronous writes already started.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffers == NULL )
+	 && ( number_of_buffers != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+	if( memory_set(
+	     &parameters,
+	     0,
+	     sizeof( struct io_uring_params ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parameters.",
+		 function );
+
+		return( -1 );
+	}
+	segment_writer->ring_file_descriptor = (int) syscall(
+	                                              __NR_io_uring_setup,
+	                                              (unsigned int) segment_writer->queue_depth,
+	                                              &parameters );
+
+	if( segment_writer->ring_file_descriptor == -1 )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: io_uring not available (error: %d) falling back to synchronous writes.\n",
+			 function,
+			 errno );
+		}
+#endif
+		return( 0 );
+	}
+	segment_writer->submission_ring_size    = parameters.sq_off.array + ( parameters.sq_entries * sizeof( uint32_t ) );
+	segment_writer->completion_ring_size    = parameters.cq_off.cqes + ( parameters.cq_entries * sizeof( struct io_uring_cqe ) );
+	segment_writer->submission_entries_size = parameters.sq_entries * sizeof( struct io_uring_sqe );
+
+	if( ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+	{
+		if( segment_writer->completion_ring_size > segment_writer->submission_ring_size )
+		{
+			segment_writer->submission_ring_size = segment_writer->completion_ring_size;
+		}
+		segment_writer->completion_ring_size = segment_writer->submission_ring_size;
+	}
+	segment_writer->submission_ring = (uint8_t *) mmap(
+	                                               NULL,
+	                                               segment_writer->submission_ring_size,
+	                                               PROT_READ | PROT_WRITE,
+	                                               MAP_SHARED | MAP_POPULATE,
+	                                               segment_writer->ring_file_descriptor,
+	                                               IORING_OFF_SQ_RING );
+
+	if( segment_writer->submission_ring == MAP_FAILED )
+	{
+		segment_writer->submission_ring = NULL;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 errno,
+		 "%s: unable to map submission queue ring.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+	{
+		segment_writer->completion_ring = segment_writer->submission_ring;
+	}
+	else
+	{
+		segment_writer->completion_ring = (uint8_t *) mmap(
+		                                               NULL,
+		                                               segment_writer->completion_ring_size,
+		                                               PROT_READ | PROT_WRITE,
+		                                               MAP_SHARED | MAP_POPULATE,
+		                                               segment_writer->ring_file_descriptor,
+		                                               IORING_OFF_CQ_RING );
+
+		if( segment_writer->completion_ring == MAP_FAILED )
+		{
+			segment_writer->completion_ring = NULL;
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 errno,
+			 "%s: unable to map completion queue ring.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	segment_writer->submission_entries = (struct io_uring_sqe *) mmap(
+	                                                              NULL,
+	                                                              segment_writer->submission_entries_size,
+	                                                              PROT_READ | PROT_WRITE,
+	                                                              MAP_SHARED | MAP_POPULATE,
+	                                                              segment_writer->ring_file_descriptor,
+	                                                              IORING_OFF_SQES );
+
+	if( segment_writer->submission_entries == MAP_FAILED )
+	{
+		segment_writer->submission_entries = NULL;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 errno,
+		 "%s: unable to map submission queue entries.",
+		 function );
+
+		goto on_error;
+	}
+	segment_writer->submission_tail      = (uint32_t *) &( segment_writer->submission_ring[ parameters.sq_off.tail ] );
+	segment_writer->submission_ring_mask = *( (uint32_t *) &( segment_writer->submission_ring[ parameters.sq_off.ring_mask ] ) );
+	segment_writer->submission_array     = (uint32_t *) &( segment_writer->submission_ring[ parameters.sq_off.array ] );
+	segment_writer->completion_head      = (uint32_t *) &( segment_writer->completion_ring[ parameters.cq_off.head ] );
+	segment_writer->completion_tail      = (uint32_t *) &( segment_writer->completion_ring[ parameters.cq_off.tail ] );
+	segment_writer->completion_ring_mask = *( (uint32_t *) &( segment_writer->completion_ring[ parameters.cq_off.ring_mask ] ) );
+	segment_writer->completion_entries   = (struct io_uring_cqe *) &( segment_writer->completion_ring[ parameters.cq_off.cqes ] );
+
+	segment_writer->requests = (segment_writer_request_t *) memory_allocate(
+	                                                         sizeof( segment_writer_request_t ) * segment_writer->queue_depth );
+
+	if( segment_writer->requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create requests.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     segment_writer->requests,
+	     0,
+	     sizeof( segment_writer_request_t ) * segment_writer->queue_depth ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear requests.",
+		 function );
+
+		goto on_error;
+	}
+	segment_writer->free_requests = (int *) memory_allocate(
+	                                         sizeof( int ) * segment_writer->queue_depth );
+
+	if( segment_writer->free_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create free requests.",
+		 function );
+
+		goto on_error;
+	}
+	for( request_index = 0;
+	     request_index < segment_writer->queue_depth;
+	     request_index++ )
+	{
+		segment_writer->free_requests[ request_index ] = request_index;
+	}
+	segment_writer->number_of_free_requests = segment_writer->queue_depth;
+
+	if( number_of_buffers > 0 )
+	{
+		segment_writer->registered_buffers = (struct iovec *) memory_allocate(
+		                                                       sizeof( struct iovec ) * number_of_buffers );
+
+		if( segment_writer->registered_buffers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create registered buffers.",
+			 function );
+
+			goto on_error;
+		}
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			segment_writer->registered_buffers[ buffer_index ].iov_base = (void *) buffers[ buffer_index ];
+			segment_writer->registered_buffers[ buffer_index ].iov_len  = buffer_size;
+		}
+		/* Registering the buffers pins their memory, which can exceed
+		 * the locked memory limit
+		 */
+		if( syscall(
+		     __NR_io_uring_register,
+		     segment_writer->ring_file_descriptor,
+		     IORING_REGISTER_BUFFERS,
+		     segment_writer->registered_buffers,
+		     (unsigned int) number_of_buffers ) == 0 )
+		{
+			segment_writer->number_of_registered_buffers = number_of_buffers;
+		}
+#if defined( HAVE_VERBOSE_OUTPUT )
+		else if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to register buffers (error: %d) writing without registered buffers.\n",
+			 function,
+			 errno );
+		}
+#endif
+	}
+	if( libcthreads_mutex_initialize(
+	     &( segment_writer->requests_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create requests mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( segment_writer->requests_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create requests condition.",
+		 function );
+
+		goto on_error;
+	}
+	segment_writer->reference_function        = reference_function;
+	segment_writer->release_function          = release_function;
+	segment_writer->callback_arguments        = callback_arguments;
+	segment_writer->asynchronous_error_number = 0;
+	segment_writer->asynchronous_error_offset = 0;
+
+	if( libcthreads_thread_create(
+	     &( segment_writer->completion_thread ),
+	     NULL,
+	     (int (*)(void *)) &segment_writer_completion_thread_function,
+	     (void *) segment_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create completion thread.",
+		 function );
+
+		goto on_error;
+	}
+	segment_writer->is_asynchronous = 1;
+
+	return( 1 );
+
+on_error:
+	segment_writer_free_ring(
+	 segment_writer );
+
+	return( -1 );
+#else
+	return( 0 );
+
+#endif /* defined( SEGMENT_WRITER_HAVE_IO_URING ) */
+}
+
+/* Stops asynchronous writes
+ * Waits until every request in flight has completed
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_stop_asynchronous(
+     segment_writer_t *segment_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_stop_asynchronous";
+	int result            = 1;
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer->is_asynchronous == 0 )
+	{
+		return( 1 );
+	}
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+	if( segment_writer_wait_for_requests(
+	     segment_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to complete requests.",
+		 function );
+
+		result = -1;
+	}
+	if( segment_writer_submit_request(
+	     segment_writer,
+	     -1,
+	     ( result == 1 ) ? error : NULL ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop completion thread.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcthreads_thread_join(
+	          &( segment_writer->completion_thread ),
+	          ( result == 1 ) ? error : NULL ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join completion thread.",
+		 function );
+
+		result = -1;
+	}
+	segment_writer_free_ring(
+	 segment_writer );
+#endif
+	segment_writer->is_asynchronous = 0;
+
+	return( result );
+}
+
+/* Writes data at a specific offset in the output
+ * When the writes are asynchronous the data must remain available until the
+ * release function is called for the value, the reference and release functions
+ * are called once for every segment file the data is written to
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_write(
+     segment_writer_t *segment_writer,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function                = "segment_writer_write";
+	size64_t segment_file_remaining_size = 0;
+	size_t data_offset                   = 0;
+	size_t write_size                    = 0;
+	off64_t segment_file_offset          = 0;
+	int segment_index                    = 0;
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer->file_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment writer - missing file descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		if( segment_writer_get_segment_by_offset(
+		     segment_writer,
+		     offset + (off64_t) data_offset,
+		     &segment_index,
+		     &segment_file_offset,
+		     &segment_file_remaining_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file of offset: %" PRIi64 ".",
+			 function,
+			 offset + (off64_t) data_offset );
+
+			return( -1 );
+		}
+		write_size = data_size - data_offset;
+
+		if( (size64_t) write_size > segment_file_remaining_size )
+		{
+			write_size = (size_t) segment_file_remaining_size;
+		}
+		/* The writes move on to the next segment file, which means the
+		 * previous segment files are complete
+		 */
+		while( segment_writer->current_segment_index < segment_index )
+		{
+			if( segment_writer->fsync_policy == SEGMENT_WRITER_FSYNC_POLICY_SEGMENT )
+			{
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+				if( segment_writer->is_asynchronous != 0 )
+				{
+					if( segment_writer_submit(
+					     segment_writer,
+					     segment_writer->current_segment_index,
+					     NULL,
+					     0,
+					     0,
+					     offset + (off64_t) data_offset,
+					     NULL,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to submit synchronization of segment file: %d.",
+						 function,
+						 segment_writer->current_segment_index );
+
+						return( -1 );
+					}
+				}
+				else
+#endif
+				if( segment_writer_synchronize_segment_file(
+				     segment_writer,
+				     segment_writer->current_segment_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to synchronize segment file: %d.",
+					 function,
+					 segment_writer->current_segment_index );
+
+					return( -1 );
+				}
+			}
+			segment_writer->current_segment_index += 1;
+		}
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+		if( segment_writer->is_asynchronous != 0 )
+		{
+			if( segment_writer_submit(
+			     segment_writer,
+			     segment_index,
+			     &( data[ data_offset ] ),
+			     write_size,
+			     segment_file_offset,
+			     offset + (off64_t) data_offset,
+			     value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to submit write of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset + (off64_t) data_offset,
+				 offset + (off64_t) data_offset );
+
+				return( -1 );
+			}
+		}
+		else
+#endif
+		if( segment_writer_write_segment_file(
+		     segment_writer->file_descriptors[ segment_index ],
+		     &( data[ data_offset ] ),
+		     write_size,
+		     segment_file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset + (off64_t) data_offset,
+			 offset + (off64_t) data_offset );
+
+			return( -1 );
+		}
+		data_offset += write_size;
+	}
+	return( 1 );
+}
+
+/* Reads data at a specific offset back from the output
+ * Data beyond the end of a segment file is read as zero bytes
+ * This function must not be called while asynchronous writes are in flight
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_read(
+     segment_writer_t *segment_writer,
+     uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function                = "segment_writer_read";
+	size64_t segment_file_remaining_size = 0;
+	size_t data_offset                   = 0;
+	size_t read_end_offset               = 0;
+	off64_t segment_file_offset          = 0;
+	int segment_index                    = 0;
+
+#if defined( HAVE_PREAD ) || defined( HAVE_READ )
+	ssize_t read_count                   = 0;
+#endif
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer->file_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment writer - missing file descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PREAD ) || ( defined( HAVE_READ ) && defined( HAVE_LSEEK ) )
+	while( data_offset < data_size )
+	{
+		if( segment_writer_get_segment_by_offset(
+		     segment_writer,
+		     offset + (off64_t) data_offset,
+		     &segment_index,
+		     &segment_file_offset,
+		     &segment_file_remaining_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file of offset: %" PRIi64 ".",
+			 function,
+			 offset + (off64_t) data_offset );
+
+			return( -1 );
+		}
+		read_end_offset = data_size;
+
+		if( (size64_t) ( read_end_offset - data_offset ) > segment_file_remaining_size )
+		{
+			read_end_offset = data_offset + (size_t) segment_file_remaining_size;
+		}
+#if !defined( HAVE_PREAD )
+		if( lseek(
+		     segment_writer->file_descriptors[ segment_index ],
+		     (off_t) segment_file_offset,
+		     SEEK_SET ) != (off_t) segment_file_offset )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in segment file: %d.",
+			 function,
+			 segment_file_offset,
+			 segment_file_offset,
+			 segment_index );
+
+			return( -1 );
+		}
+#endif
+		while( data_offset < read_end_offset )
+		{
+#if defined( HAVE_PREAD )
+			read_count = pread(
+			              segment_writer->file_descriptors[ segment_index ],
+			              &( data[ data_offset ] ),
+			              read_end_offset - data_offset,
+			              (off_t) segment_file_offset );
+#else
+			read_count = read(
+			              segment_writer->file_descriptors[ segment_index ],
+			              &( data[ data_offset ] ),
+			              read_end_offset - data_offset );
+#endif
+			if( read_count < 0 )
+			{
+				if( errno == EINTR )
+				{
+					continue;
+				}
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read data of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset + (off64_t) data_offset,
+				 offset + (off64_t) data_offset );
+
+				return( -1 );
+			}
+			else if( read_count == 0 )
+			{
+				if( memory_set(
+				     &( data[ data_offset ] ),
+				     0,
+				     read_end_offset - data_offset ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear data.",
+					 function );
+
+					return( -1 );
+				}
+				data_offset = read_end_offset;
+
+				break;
+			}
+			data_offset         += (size_t) read_count;
+			segment_file_offset += (off64_t) read_count;
+		}
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing output file support.",
+	 function );
+
+	return( -1 );
+
+#endif /* defined( HAVE_PREAD ) || ( defined( HAVE_READ ) && defined( HAVE_LSEEK ) ) */
+}
+
+/* Sets the size of the output
+ * Every segment file is truncated or extended to the part of the size it
+ * covers, this makes sure the output covers zero blocks that were left as a hole
+ * This function must not be called while asynchronous writes are in flight
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_set_size(
+     segment_writer_t *segment_writer,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function       = "segment_writer_set_size";
+	size64_t segment_file_size  = 0;
+	size64_t segment_offset     = 0;
+	int segment_index           = 0;
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer->file_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment writer - missing file descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_FTRUNCATE )
+	for( segment_index = 0;
+	     segment_index < segment_writer->number_of_segments;
+	     segment_index++ )
+	{
+		if( segment_writer->segment_size == 0 )
+		{
+			segment_file_size = size;
+		}
+		else
+		{
+			segment_offset    = (size64_t) segment_index * segment_writer->segment_size;
+			segment_file_size = 0;
+
+			if( segment_offset < size )
+			{
+				segment_file_size = size - segment_offset;
+
+				if( segment_file_size > segment_writer->segment_size )
+				{
+					segment_file_size = segment_writer->segment_size;
+				}
+			}
+		}
+		if( ftruncate(
+		     segment_writer->file_descriptors[ segment_index ],
+		     (off_t) segment_file_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 errno,
+			 "%s: unable to set size of segment file: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Synchronizes the segment files to disk
+ * Waits until every asynchronous request in flight has completed first
+ * Returns 1 if successful or -1 on error
+ */
+int segment_writer_synchronize(
+     segment_writer_t *segment_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_writer_synchronize";
+	int segment_index     = 0;
+
+	if( segment_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_writer->file_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment writer - missing file descriptors.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+	if( segment_writer->is_asynchronous != 0 )
+	{
+		if( segment_writer_wait_for_requests(
+		     segment_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to complete requests.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	for( segment_index = 0;
+	     segment_index < segment_writer->number_of_segments;
+	     segment_index++ )
+	{
+		if( segment_writer_synchronize_segment_file(
+		     segment_writer,
+		     segment_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to synchronize segment file: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,393 @@
+/*
+ * Segmented output writer
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SEGMENT_WRITER_H )
+#define _SEGMENT_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+#include "tableautools_libcthreads.h"
+
+#if defined( HAVE_LINUX_IO_URING_H ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_SYS_UIO_H ) && defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+#define SEGMENT_WRITER_HAVE_IO_URING
+#endif
+
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum SEGMENT_WRITER_FSYNC_POLICIES
+{
+	/* The segment files are not synchronized
+	 */
+	SEGMENT_WRITER_FSYNC_POLICY_NONE	= 0,
+
+	/* Every segment file is synchronized when it is closed
+	 */
+	SEGMENT_WRITER_FSYNC_POLICY_CLOSE	= 1,
+
+	/* A segment file is synchronized as soon as the writes move on to
+	 * the next segment file
+	 */
+	SEGMENT_WRITER_FSYNC_POLICY_SEGMENT	= 2
+};
+
+#define SEGMENT_WRITER_DEFAULT_QUEUE_DEPTH		8
+#define SEGMENT_WRITER_MAXIMUM_QUEUE_DEPTH		256
+
+/* The segment files are named after the output with an extension
+ * of 3 digits, .001 up to .999
+ */
+#define SEGMENT_WRITER_MAXIMUM_NUMBER_OF_SEGMENTS	999
+
+typedef struct segment_writer segment_writer_t;
+
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+
+typedef struct segment_writer_request segment_writer_request_t;
+
+struct segment_writer_request
+{
+	/* The value passed to the release function when the request completes
+	 */
+	intptr_t *value;
+
+	/* The file descriptor of the segment file
+	 */
+	int file_descriptor;
+
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size, 0 for a synchronization request
+	 */
+	size_t data_size;
+
+	/* The offset in the segment file
+	 */
+	off64_t segment_file_offset;
+
+	/* The offset in the output
+	 */
+	off64_t offset;
+
+	/* The I/O vector of a write of data that is not in a registered buffer
+	 */
+	struct iovec iovec;
+};
+
+#endif /* defined( SEGMENT_WRITER_HAVE_IO_URING ) */
+
+struct segment_writer
+{
+	/* The size of the output
+	 */
+	size64_t size;
+
+	/* The size of a segment file, 0 if the output is a single file
+	 */
+	size64_t segment_size;
+
+	/* The number of segment files
+	 */
+	int number_of_segments;
+
+	/* The file descriptors of the segment files
+	 */
+	int *file_descriptors;
+
+	/* The index of the segment file that was last written
+	 */
+	int current_segment_index;
+
+	/* The fsync policy
+	 */
+	uint8_t fsync_policy;
+
+	/* The maximum number of write requests in flight
+	 */
+	int queue_depth;
+
+	/* Value to indicate the writes are asynchronous
+	 */
+	uint8_t is_asynchronous;
+
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+	/* The io_uring file descriptor
+	 */
+	int ring_file_descriptor;
+
+	/* The mapped submission queue ring
+	 */
+	uint8_t *submission_ring;
+
+	/* The size of the mapped submission queue ring
+	 */
+	size_t submission_ring_size;
+
+	/* The mapped completion queue ring, can be the same as the submission queue ring
+	 */
+	uint8_t *completion_ring;
+
+	/* The size of the mapped completion queue ring
+	 */
+	size_t completion_ring_size;
+
+	/* The mapped submission queue entries
+	 */
+	struct io_uring_sqe *submission_entries;
+
+	/* The size of the mapped submission queue entries
+	 */
+	size_t submission_entries_size;
+
+	/* The submission queue tail
+	 */
+	uint32_t *submission_tail;
+
+	/* The submission queue ring mask
+	 */
+	uint32_t submission_ring_mask;
+
+	/* The submission queue index array
+	 */
+	uint32_t *submission_array;
+
+	/* The completion queue head
+	 */
+	uint32_t *completion_head;
+
+	/* The completion queue tail
+	 */
+	uint32_t *completion_tail;
+
+	/* The completion queue ring mask
+	 */
+	uint32_t completion_ring_mask;
+
+	/* The completion queue entries
+	 */
+	struct io_uring_cqe *completion_entries;
+
+	/* The requests
+	 */
+	segment_writer_request_t *requests;
+
+	/* The indexes of the requests that are not in flight
+	 */
+	int *free_requests;
+
+	/* The number of requests that are not in flight
+	 */
+	int number_of_free_requests;
+
+	/* The registered buffers
+	 */
+	struct iovec *registered_buffers;
+
+	/* The number of registered buffers, 0 if the buffers could not be registered
+	 */
+	int number_of_registered_buffers;
+
+	/* The mutex protecting the requests and the asynchronous error
+	 */
+	libcthreads_mutex_t *requests_mutex;
+
+	/* The condition signalled when a request completes
+	 */
+	libcthreads_condition_t *requests_condition;
+
+	/* The completion thread
+	 */
+	libcthreads_thread_t *completion_thread;
+
+	/* The function called before a write request for a value is submitted
+	 */
+	int (*reference_function)(
+	       intptr_t *value,
+	       void *callback_arguments );
+
+	/* The function called when a write request for a value has completed
+	 */
+	int (*release_function)(
+	       intptr_t *value,
+	       void *callback_arguments );
+
+	/* The arguments of the reference and release functions
+	 */
+	void *callback_arguments;
+
+	/* The error number of the first asynchronous request that failed
+	 */
+	int asynchronous_error_number;
+
+	/* The output offset of the first asynchronous request that failed
+	 */
+	off64_t asynchronous_error_offset;
+#endif
+};
+
+int segment_writer_initialize(
+     segment_writer_t **segment_writer,
+     libcerror_error_t **error );
+
+int segment_writer_free(
+     segment_writer_t **segment_writer,
+     libcerror_error_t **error );
+
+int segment_writer_set_fsync_policy(
+     segment_writer_t *segment_writer,
+     uint8_t fsync_policy,
+     libcerror_error_t **error );
+
+int segment_writer_set_queue_depth(
+     segment_writer_t *segment_writer,
+     int queue_depth,
+     libcerror_error_t **error );
+
+int segment_writer_open(
+     segment_writer_t *segment_writer,
+     const system_character_t *filename,
+     size64_t size,
+     size64_t segment_size,
+     uint8_t create,
+     libcerror_error_t **error );
+
+int segment_writer_close(
+     segment_writer_t *segment_writer,
+     libcerror_error_t **error );
+
+int segment_writer_get_segment_by_offset(
+     segment_writer_t *segment_writer,
+     off64_t offset,
+     int *segment_index,
+     off64_t *segment_file_offset,
+     size64_t *segment_file_remaining_size,
+     libcerror_error_t **error );
+
+int segment_writer_write_segment_file(
+     int file_descriptor,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t segment_file_offset,
+     libcerror_error_t **error );
+
+int segment_writer_synchronize_segment_file(
+     segment_writer_t *segment_writer,
+     int segment_index,
+     libcerror_error_t **error );
+
+#if defined( SEGMENT_WRITER_HAVE_IO_URING )
+
+int segment_writer_get_free_request(
+     segment_writer_t *segment_writer,
+     int *request_index,
+     libcerror_error_t **error );
+
+int segment_writer_put_free_request(
+     segment_writer_t *segment_writer,
+     int request_index,
+     int error_number,
+     libcerror_error_t **error );
+
+int segment_writer_wait_for_requests(
+     segment_writer_t *segment_writer,
+     libcerror_error_t **error );
+
+int segment_writer_submit_request(
+     segment_writer_t *segment_writer,
+     int request_index,
+     libcerror_error_t **error );
+
+int segment_writer_submit(
+     segment_writer_t *segment_writer,
+     int segment_index,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t segment_file_offset,
+     off64_t offset,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int segment_writer_completion_thread_function(
+     segment_writer_t *segment_writer );
+
+void segment_writer_free_ring(
+      segment_writer_t *segment_writer );
+
+#endif /* defined( SEGMENT_WRITER_HAVE_IO_URING ) */
+
+int segment_writer_start_asynchronous(
+     segment_writer_t *segment_writer,
+     uint8_t **buffers,
+     size_t buffer_size,
+     int number_of_buffers,
+     int (*reference_function)(
+            intptr_t *value,
+            void *callback_arguments ),
+     int (*release_function)(
+            intptr_t *value,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+int segment_writer_stop_asynchronous(
+     segment_writer_t *segment_writer,
+     libcerror_error_t **error );
+
+int segment_writer_write(
+     segment_writer_t *segment_writer,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int segment_writer_read(
+     segment_writer_t *segment_writer,
+     uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int segment_writer_set_size(
+     segment_writer_t *segment_writer,
+     size64_t size,
+     libcerror_error_t **error );
+
+int segment_writer_synchronize(
+     segment_writer_t *segment_writer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SEGMENT_WRITER_H ) */
+
@@ -0,0 +1,112 @@
+/*
+ * SHA1 functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SHA1_H )
+#define _SHA1_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+#include <openssl/evp.h>
+#endif
+
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define SHA1_HASH_SIZE		20
+#define SHA1_BLOCK_SIZE		64
+
+/* The size of the intermediate state: the number of bytes hashed,
+ * the block offset, the 5 hash values and the block
+ */
+#define SHA1_STATE_SIZE		100
+
+typedef struct sha1_context sha1_context_t;
+
+struct sha1_context
+{
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	/* The EVP message digest context
+	 */
+	EVP_MD_CTX *evp_md_context;
+
+#else
+	/* The number of bytes hashed
+	 */
+	uint64_t hash_count;
+
+	/* The 32-bit hash values
+	 */
+	uint32_t hash_values[ 5 ];
+
+	/* The block offset
+	 */
+	size_t block_offset;
+
+	/* The (data) block
+	 */
+	uint8_t block[ 2 * SHA1_BLOCK_SIZE ];
+
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) */
+};
+
+int sha1_context_initialize(
+     sha1_context_t **context,
+     libcerror_error_t **error );
+
+int sha1_context_free(
+     sha1_context_t **context,
+     libcerror_error_t **error );
+
+int sha1_context_update(
+     sha1_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int sha1_context_finalize(
+     sha1_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int sha1_context_get_state(
+     sha1_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+int sha1_context_set_state(
+     sha1_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SHA1_H ) */
+
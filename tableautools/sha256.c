@@ -0,0 +1,830 @@
+/*
+ * SHA256 functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+#include <openssl/evp.h>
+#endif
+
+#include "sha256.h"
+#include "tableautools_libcerror.h"
+
+#if !defined( HAVE_LIBCRYPTO ) || !defined( HAVE_OPENSSL_EVP_H )
+
+/* FIPS 180-4 based SHA256 implementation
+ */
+static uint32_t sha256_prime_square_roots[ 64 ] = {
+	0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL,
+	0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+	0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL,
+	0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+	0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL,
+	0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+	0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL,
+	0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+	0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL,
+	0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+	0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL,
+	0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+	0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL,
+	0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+	0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL,
+	0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL };
+
+
+/* Calculates the SHA256 of 64 byte sized blocks of data in a buffer
+ * Returns the number of bytes used if successful
+ */
+static size_t sha256_calculate(
+               uint32_t *hash_values,
+               const uint8_t *buffer,
+               size_t size )
+{
+	uint32_t hash_values_abcdefgh[ 8 ];
+	uint32_t values_32bit[ 64 ];
+
+	size_t buffer_offset      = 0;
+	uint32_t s0               = 0;
+	uint32_t s1               = 0;
+	uint32_t t1               = 0;
+	uint32_t t2               = 0;
+	uint8_t block_index       = 0;
+	uint8_t hash_values_index = 0;
+	uint8_t value_32bit_index = 0;
+
+	while( ( size - buffer_offset ) >= SHA256_BLOCK_SIZE )
+	{
+		/* Break the block into 16 x 32-bit values
+		 */
+		for( value_32bit_index = 0;
+		     value_32bit_index < 16;
+		     value_32bit_index++ )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( buffer[ buffer_offset ] ),
+			 values_32bit[ value_32bit_index ] );
+
+			buffer_offset += sizeof( uint32_t );
+		}
+		/* Extend to 64 x 32-bit values
+		 */
+		for( value_32bit_index = 16;
+		     value_32bit_index < 64;
+		     value_32bit_index++ )
+		{
+			s0 = byte_stream_bit_rotate_right_32bit( values_32bit[ value_32bit_index - 15 ], 7 )
+			   ^ byte_stream_bit_rotate_right_32bit( values_32bit[ value_32bit_index - 15 ], 18 )
+			   ^ ( values_32bit[ value_32bit_index - 15 ] >> 3 );
+			s1 = byte_stream_bit_rotate_right_32bit( values_32bit[ value_32bit_index - 2 ], 17 )
+			   ^ byte_stream_bit_rotate_right_32bit( values_32bit[ value_32bit_index - 2 ], 19 )
+			   ^ ( values_32bit[ value_32bit_index - 2 ] >> 10 );
+
+			values_32bit[ value_32bit_index ] = values_32bit[ value_32bit_index - 16 ]
+			                                  + s0
+			                                  + values_32bit[ value_32bit_index - 7 ]
+			                                  + s1;
+		}
+		for( hash_values_index = 0;
+		     hash_values_index < 8;
+		     hash_values_index++ )
+		{
+			hash_values_abcdefgh[ hash_values_index ] = hash_values[ hash_values_index ];
+		}
+		for( block_index = 0;
+		     block_index < 64;
+		     block_index++ )
+		{
+			s1 = byte_stream_bit_rotate_right_32bit( hash_values_abcdefgh[ 4 ], 6 )
+			   ^ byte_stream_bit_rotate_right_32bit( hash_values_abcdefgh[ 4 ], 11 )
+			   ^ byte_stream_bit_rotate_right_32bit( hash_values_abcdefgh[ 4 ], 25 );
+
+			t1  = hash_values_abcdefgh[ 7 ];
+			t1 += s1;
+			t1 += ( hash_values_abcdefgh[ 4 ] & hash_values_abcdefgh[ 5 ] )
+			    ^ ( ~( hash_values_abcdefgh[ 4 ] ) & hash_values_abcdefgh[ 6 ] );
+			t1 += sha256_prime_square_roots[ block_index ];
+			t1 += values_32bit[ block_index ];
+
+			s0 = byte_stream_bit_rotate_right_32bit( hash_values_abcdefgh[ 0 ], 2 )
+			   ^ byte_stream_bit_rotate_right_32bit( hash_values_abcdefgh[ 0 ], 13 )
+			   ^ byte_stream_bit_rotate_right_32bit( hash_values_abcdefgh[ 0 ], 22 );
+
+			t2  = ( hash_values_abcdefgh[ 0 ] & hash_values_abcdefgh[ 1 ] )
+			    ^ ( hash_values_abcdefgh[ 0 ] & hash_values_abcdefgh[ 2 ] )
+			    ^ ( hash_values_abcdefgh[ 1 ] & hash_values_abcdefgh[ 2 ] );
+			t2 += s0;
+
+			hash_values_abcdefgh[ 7 ] = hash_values_abcdefgh[ 6 ];
+			hash_values_abcdefgh[ 6 ] = hash_values_abcdefgh[ 5 ];
+			hash_values_abcdefgh[ 5 ] = hash_values_abcdefgh[ 4 ];
+			hash_values_abcdefgh[ 4 ] = hash_values_abcdefgh[ 3 ] + t1;
+			hash_values_abcdefgh[ 3 ] = hash_values_abcdefgh[ 2 ];
+			hash_values_abcdefgh[ 2 ] = hash_values_abcdefgh[ 1 ];
+			hash_values_abcdefgh[ 1 ] = hash_values_abcdefgh[ 0 ];
+			hash_values_abcdefgh[ 0 ] = t1 + t2;
+		}
+		for( hash_values_index = 0;
+		     hash_values_index < 8;
+		     hash_values_index++ )
+		{
+			hash_values[ hash_values_index ] += hash_values_abcdefgh[ hash_values_index ];
+		}
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     hash_values_abcdefgh,
+	     0,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     values_32bit,
+	     0,
+	     sizeof( uint32_t ) * 64 ) == NULL )
+	{
+		return( 0 );
+	}
+	return( buffer_offset );
+}
+
+#endif /* !defined( HAVE_LIBCRYPTO ) || !defined( HAVE_OPENSSL_EVP_H ) */
+
+/* Creates a SHA256 context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_context_initialize(
+     sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            sha256_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( sha256_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	( *context )->evp_md_context = EVP_MD_CTX_new();
+
+	if( ( *context )->evp_md_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create EVP message digest context.",
+		 function );
+
+		goto on_error;
+	}
+	/* The EVP SHA256 implementation selects SHA-NI or AVX2 code paths
+	 * at run-time when supported by the CPU
+	 */
+	if( EVP_DigestInit_ex(
+	     ( *context )->evp_md_context,
+	     EVP_sha256(),
+	     NULL ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize EVP message digest context.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	( *context )->hash_values[ 0 ] = 0x6a09e667UL;
+	( *context )->hash_values[ 1 ] = 0xbb67ae85UL;
+	( *context )->hash_values[ 2 ] = 0x3c6ef372UL;
+	( *context )->hash_values[ 3 ] = 0xa54ff53aUL;
+	( *context )->hash_values[ 4 ] = 0x510e527fUL;
+	( *context )->hash_values[ 5 ] = 0x9b05688cUL;
+	( *context )->hash_values[ 6 ] = 0x1f83d9abUL;
+	( *context )->hash_values[ 7 ] = 0x5be0cd19UL;
+
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) */
+
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+		if( ( *context )->evp_md_context != NULL )
+		{
+			EVP_MD_CTX_free(
+			 ( *context )->evp_md_context );
+		}
+#endif
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a SHA256 context
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_context_free(
+     sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_context_free";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+		EVP_MD_CTX_free(
+		 ( *context )->evp_md_context );
+#else
+		if( memory_set(
+		     *context,
+		     0,
+		     sizeof( sha256_context_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear context.",
+			 function );
+		}
+#endif
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the SHA256 context
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_context_update(
+     sha256_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_context_update";
+
+#if !defined( HAVE_LIBCRYPTO ) || !defined( HAVE_OPENSSL_EVP_H )
+	size_t buffer_offset  = 0;
+	size_t remaining_size = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	if( EVP_DigestUpdate(
+	     context->evp_md_context,
+	     (const void *) buffer,
+	     size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update EVP message digest context.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( context->block_offset > 0 )
+	{
+		remaining_size = SHA256_BLOCK_SIZE - context->block_offset;
+
+		if( remaining_size > size )
+		{
+			remaining_size = size;
+		}
+		if( memory_copy(
+		     &( context->block[ context->block_offset ] ),
+		     buffer,
+		     remaining_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to context block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_offset += remaining_size;
+
+		if( context->block_offset < SHA256_BLOCK_SIZE )
+		{
+			context->hash_count += remaining_size;
+
+			return( 1 );
+		}
+		sha256_calculate(
+		 context->hash_values,
+		 context->block,
+		 SHA256_BLOCK_SIZE );
+
+		context->hash_count  += remaining_size;
+		context->block_offset = 0;
+		buffer_offset         = remaining_size;
+	}
+	remaining_size = size - buffer_offset;
+
+	if( remaining_size >= SHA256_BLOCK_SIZE )
+	{
+		remaining_size = sha256_calculate(
+		                  context->hash_values,
+		                  &( buffer[ buffer_offset ] ),
+		                  remaining_size );
+
+		context->hash_count += remaining_size;
+		buffer_offset       += remaining_size;
+	}
+	remaining_size = size - buffer_offset;
+
+	if( remaining_size > 0 )
+	{
+		if( memory_copy(
+		     context->block,
+		     &( buffer[ buffer_offset ] ),
+		     remaining_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to context block.",
+			 function );
+
+			return( -1 );
+		}
+		context->hash_count  += remaining_size;
+		context->block_offset = remaining_size;
+	}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) */
+
+	return( 1 );
+}
+
+/* Finalizes the SHA256 context
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_context_finalize(
+     sha256_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "sha256_context_finalize";
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	unsigned int safe_hash_size = 0;
+#else
+	size_t block_size       = 0;
+	size_t number_of_blocks = 0;
+	uint64_t bit_size       = 0;
+	int value_32bit_index   = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < (size_t) SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	safe_hash_size = (unsigned int) hash_size;
+
+	if( EVP_DigestFinal_ex(
+	     context->evp_md_context,
+	     (unsigned char *) hash,
+	     &safe_hash_size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize EVP message digest context.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	/* Add padding with a size of 56 mod 64
+	 */
+	number_of_blocks = 1;
+
+	if( context->block_offset > 55 )
+	{
+		number_of_blocks += 1;
+	}
+	block_size = number_of_blocks * SHA256_BLOCK_SIZE;
+
+	if( memory_set(
+	     &( context->block[ context->block_offset ] ),
+	     0,
+	     block_size - context->block_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context block.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first byte of the padding contains 0x80
+	 */
+	context->block[ context->block_offset ] = 0x80;
+
+	bit_size = context->hash_count * 8;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( context->block[ block_size - 8 ] ),
+	 bit_size );
+
+	sha256_calculate(
+	 context->hash_values,
+	 context->block,
+	 block_size );
+
+	for( value_32bit_index = 0;
+	     value_32bit_index < 8;
+	     value_32bit_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ value_32bit_index * sizeof( uint32_t ) ] ),
+		 context->hash_values[ value_32bit_index ] );
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     context,
+	     0,
+	     sizeof( sha256_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) */
+
+	return( 1 );
+}
+
+/* Copies the intermediate state of the context to a byte stream
+ * The state is only available with the built-in implementation
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int sha256_context_get_state(
+     sha256_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_context_get_state";
+
+#if !defined( HAVE_LIBCRYPTO ) || !defined( HAVE_OPENSSL_EVP_H )
+	size_t state_offset   = 0;
+	int value_32bit_index = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_size < SHA256_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	/* The EVP message digest context does not expose its state
+	 */
+	return( 0 );
+#else
+	byte_stream_copy_from_uint64_little_endian(
+	 state,
+	 context->hash_count );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( state[ 8 ] ),
+	 (uint64_t) context->block_offset );
+
+	state_offset = 16;
+
+	for( value_32bit_index = 0;
+	     value_32bit_index < 8;
+	     value_32bit_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( state[ state_offset ] ),
+		 context->hash_values[ value_32bit_index ] );
+
+		state_offset += sizeof( uint32_t );
+	}
+	if( memory_copy(
+	     &( state[ state_offset ] ),
+	     context->block,
+	     SHA256_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy context block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) */
+}
+
+/* Copies the intermediate state of the context from a byte stream
+ * The state is only available with the built-in implementation
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int sha256_context_set_state(
+     sha256_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_context_set_state";
+
+#if !defined( HAVE_LIBCRYPTO ) || !defined( HAVE_OPENSSL_EVP_H )
+	uint64_t block_offset = 0;
+	size_t state_offset   = 0;
+	int value_32bit_index = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_size < SHA256_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H )
+	return( 0 );
+#else
+	byte_stream_copy_to_uint64_little_endian(
+	 &( state[ 8 ] ),
+	 block_offset );
+
+	if( block_offset >= SHA256_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state - block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 state,
+	 context->hash_count );
+
+	context->block_offset = (size_t) block_offset;
+
+	state_offset = 16;
+
+	for( value_32bit_index = 0;
+	     value_32bit_index < 8;
+	     value_32bit_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( state[ state_offset ] ),
+		 context->hash_values[ value_32bit_index ] );
+
+		state_offset += sizeof( uint32_t );
+	}
+	if( memory_copy(
+	     context->block,
+	     &( state[ state_offset ] ),
+	     SHA256_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy context block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) */
+}
+
@@ -0,0 +1,1039 @@
+/*
+ * Shared memory status table of Tableau write blockers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include <time.h>
+
+#include "status_table.h"
+#include "tableautools_libcerror.h"
+
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+#include <sys/mman.h>
+#endif
+
+/* Creates a status table
+ * Make sure the value status_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int status_table_initialize(
+     status_table_t **status_table,
+     libcerror_error_t **error )
+{
+	static char *function = "status_table_initialize";
+
+	if( status_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *status_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid status table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*status_table = memory_allocate_structure(
+	                 status_table_t );
+
+	if( *status_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create status table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *status_table,
+	     0,
+	     sizeof( status_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear status table.",
+		 function );
+
+		memory_free(
+		 *status_table );
+
+		*status_table = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a status table
+ * The status table is closed if it is still open
+ * Returns 1 if successful or -1 on error
+ */
+int status_table_free(
+     status_table_t **status_table,
+     libcerror_error_t **error )
+{
+	static char *function = "status_table_free";
+	int result            = 1;
+
+	if( status_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *status_table != NULL )
+	{
+		if( ( *status_table )->data != NULL )
+		{
+			if( status_table_close(
+			     *status_table,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close status table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *status_table );
+
+		*status_table = NULL;
+	}
+	return( result );
+}
+
+/* Creates the shared memory object of a status table for writing
+ * A shared memory object left behind by a previous writer is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int status_table_create(
+     status_table_t *status_table,
+     const system_character_t *name,
+     uint32_t maximum_number_of_records,
+     libcerror_error_t **error )
+{
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	status_table_header_t *header = NULL;
+	void *data                    = NULL;
+	size_t data_size              = 0;
+	size_t name_length            = 0;
+	int file_descriptor           = -1;
+#endif
+	static char *function         = "status_table_create";
+
+	if( status_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status table.",
+		 function );
+
+		return( -1 );
+	}
+	if( status_table->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid status table - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_records == 0 )
+	 || ( maximum_number_of_records > STATUS_TABLE_MAXIMUM_NUMBER_OF_RECORDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	name_length = narrow_string_length(
+	               name );
+
+	if( ( name_length < 2 )
+	 || ( name_length >= 256 )
+	 || ( name[ 0 ] != '/' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported name, which must start with a /.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = sizeof( status_table_header_t )
+	          + ( (size_t) maximum_number_of_records * sizeof( status_table_record_t ) );
+
+	if( shm_unlink(
+	     name ) != 0 )
+	{
+		if( errno != ENOENT )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 errno,
+			 "%s: unable to remove stale shared memory object: %s.",
+			 function,
+			 name );
+
+			return( -1 );
+		}
+	}
+	/* The readers only need read access
+	 */
+	file_descriptor = shm_open(
+	                   name,
+	                   O_CREAT | O_EXCL | O_RDWR,
+	                   0644 );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to create shared memory object: %s.",
+		 function,
+		 name );
+
+		return( -1 );
+	}
+	if( ftruncate(
+	     file_descriptor,
+	     (off_t) data_size ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to set size of shared memory object.",
+		 function );
+
+		goto on_error;
+	}
+	data = mmap(
+	        NULL,
+	        data_size,
+	        PROT_READ | PROT_WRITE,
+	        MAP_SHARED,
+	        file_descriptor,
+	        0 );
+
+	if( data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map shared memory object.",
+		 function );
+
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+	header = (status_table_header_t *) data;
+
+	header->version                   = STATUS_TABLE_VERSION;
+	header->record_size               = (uint32_t) sizeof( status_table_record_t );
+	header->maximum_number_of_records = maximum_number_of_records;
+	header->update_time               = (uint64_t) time( NULL );
+
+	/* A reader only considers the table valid once the signature is set
+	 */
+	__atomic_thread_fence(
+	 __ATOMIC_RELEASE );
+
+	memory_copy(
+	 header->signature,
+	 STATUS_TABLE_SIGNATURE,
+	 8 );
+
+	memory_copy(
+	 status_table->name,
+	 name,
+	 name_length );
+
+	status_table->name[ name_length ] = 0;
+
+	status_table->data                      = (uint8_t *) data;
+	status_table->data_size                 = data_size;
+	status_table->header                    = header;
+	status_table->records                   = (status_table_record_t *) &( status_table->data[ sizeof( status_table_header_t ) ] );
+	status_table->maximum_number_of_records = maximum_number_of_records;
+	status_table->is_writer                 = 1;
+
+	return( 1 );
+
+on_error:
+	close(
+	 file_descriptor );
+
+	shm_unlink(
+	 name );
+
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing shared memory support.",
+	 function );
+
+	return( -1 );
+
+#endif /* defined( STATUS_TABLE_HAVE_SHARED_MEMORY ) */
+}
+
+/* Opens the shared memory object of a status table for reading
+ * The object is mapped read-only
+ * Returns 1 if successful or -1 on error
+ */
+int status_table_open(
+     status_table_t *status_table,
+     const system_character_t *name,
+     libcerror_error_t **error )
+{
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	struct stat file_statistics;
+
+	status_table_header_t *header = NULL;
+	void *data                    = NULL;
+	size_t data_size              = 0;
+	size_t name_length            = 0;
+	int file_descriptor           = -1;
+#endif
+	static char *function         = "status_table_open";
+
+	if( status_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status table.",
+		 function );
+
+		return( -1 );
+	}
+	if( status_table->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid status table - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	name_length = narrow_string_length(
+	               name );
+
+	if( ( name_length < 2 )
+	 || ( name_length >= 256 )
+	 || ( name[ 0 ] != '/' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported name, which must start with a /.",
+		 function );
+
+		return( -1 );
+	}
+	file_descriptor = shm_open(
+	                   name,
+	                   O_RDONLY,
+	                   0 );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open shared memory object: %s.",
+		 function,
+		 name );
+
+		return( -1 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve size of shared memory object.",
+		 function );
+
+		close(
+		 file_descriptor );
+
+		return( -1 );
+	}
+	if( file_statistics.st_size < (off_t) sizeof( status_table_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shared memory object size value out of bounds.",
+		 function );
+
+		close(
+		 file_descriptor );
+
+		return( -1 );
+	}
+	data_size = (size_t) file_statistics.st_size;
+
+	data = mmap(
+	        NULL,
+	        data_size,
+	        PROT_READ,
+	        MAP_SHARED,
+	        file_descriptor,
+	        0 );
+
+	close(
+	 file_descriptor );
+
+	if( data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map shared memory object.",
+		 function );
+
+		return( -1 );
+	}
+	header = (status_table_header_t *) data;
+
+	if( memory_compare(
+	     header->signature,
+	     STATUS_TABLE_SIGNATURE,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		goto on_error;
+	}
+	__atomic_thread_fence(
+	 __ATOMIC_ACQUIRE );
+
+	if( header->version != STATUS_TABLE_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported version: %" PRIu32 ".",
+		 function,
+		 header->version );
+
+		goto on_error;
+	}
+	if( header->record_size != (uint32_t) sizeof( status_table_record_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record size: %" PRIu32 ".",
+		 function,
+		 header->record_size );
+
+		goto on_error;
+	}
+	if( ( header->maximum_number_of_records == 0 )
+	 || ( header->maximum_number_of_records > STATUS_TABLE_MAXIMUM_NUMBER_OF_RECORDS )
+	 || ( header->maximum_number_of_records > ( ( data_size - sizeof( status_table_header_t ) ) / sizeof( status_table_record_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of records value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	memory_copy(
+	 status_table->name,
+	 name,
+	 name_length );
+
+	status_table->name[ name_length ] = 0;
+
+	status_table->data                      = (uint8_t *) data;
+	status_table->data_size                 = data_size;
+	status_table->header                    = header;
+	status_table->records                   = (status_table_record_t *) &( status_table->data[ sizeof( status_table_header_t ) ] );
+	status_table->maximum_number_of_records = header->maximum_number_of_records;
+	status_table->is_writer                 = 0;
+
+	return( 1 );
+
+on_error:
+	munmap(
+	 data,
+	 data_size );
+
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: missing shared memory support.",
+	 function );
+
+	return( -1 );
+
+#endif /* defined( STATUS_TABLE_HAVE_SHARED_MEMORY ) */
+}
+
+/* Closes a status table
+ * The shared memory object is removed when the table was created for writing
+ * Returns 0 if successful or -1 on error
+ */
+int status_table_close(
+     status_table_t *status_table,
+     libcerror_error_t **error )
+{
+	static char *function = "status_table_close";
+	int result            = 0;
+
+	if( status_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status table.",
+		 function );
+
+		return( -1 );
+	}
+	if( status_table->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid status table - missing data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	if( munmap(
+	     status_table->data,
+	     status_table->data_size ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to unmap shared memory object.",
+		 function );
+
+		result = -1;
+	}
+	if( status_table->is_writer != 0 )
+	{
+		if( shm_unlink(
+		     status_table->name ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 errno,
+			 "%s: unable to remove shared memory object: %s.",
+			 function,
+			 status_table->name );
+
+			result = -1;
+		}
+	}
+#endif
+	status_table->data                      = NULL;
+	status_table->data_size                 = 0;
+	status_table->header                    = NULL;
+	status_table->records                   = NULL;
+	status_table->maximum_number_of_records = 0;
+	status_table->is_writer                 = 0;
+
+	return( result );
+}
+
+/* Sets the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int status_table_set_number_of_records(
+     status_table_t *status_table,
+     uint32_t number_of_records,
+     libcerror_error_t **error )
+{
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	uint32_t sequence     = 0;
+#endif
+	static char *function = "status_table_set_number_of_records";
+
+	if( status_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status table.",
+		 function );
+
+		return( -1 );
+	}
+	if( status_table->is_writer == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid status table - not created for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records > status_table->maximum_number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	sequence = status_table->header->sequence;
+
+	__atomic_store_n(
+	 &( status_table->header->sequence ),
+	 sequence + 1,
+	 __ATOMIC_RELAXED );
+
+	__atomic_thread_fence(
+	 __ATOMIC_RELEASE );
+
+	status_table->header->number_of_records = number_of_records;
+	status_table->header->update_time       = (uint64_t) time( NULL );
+
+	__atomic_store_n(
+	 &( status_table->header->sequence ),
+	 sequence + 2,
+	 __ATOMIC_RELEASE );
+#endif
+	return( 1 );
+}
+
+/* Writes a record
+ * The sequence of the record that is written is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int status_table_write_record(
+     status_table_t *status_table,
+     uint32_t record_index,
+     const status_table_record_t *record,
+     libcerror_error_t **error )
+{
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	status_table_record_t *table_record = NULL;
+	uint32_t sequence                   = 0;
+#endif
+	static char *function               = "status_table_write_record";
+
+	if( status_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status table.",
+		 function );
+
+		return( -1 );
+	}
+	if( status_table->is_writer == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid status table - not created for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index >= status_table->maximum_number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	table_record = &( status_table->records[ record_index ] );
+
+	sequence = table_record->sequence;
+
+	/* An odd sequence tells the readers the record is being written
+	 */
+	__atomic_store_n(
+	 &( table_record->sequence ),
+	 sequence + 1,
+	 __ATOMIC_RELAXED );
+
+	__atomic_thread_fence(
+	 __ATOMIC_RELEASE );
+
+	memory_copy(
+	 &( table_record->status ),
+	 &( record->status ),
+	 sizeof( status_table_record_t ) - sizeof( uint32_t ) );
+
+	__atomic_store_n(
+	 &( table_record->sequence ),
+	 sequence + 2,
+	 __ATOMIC_RELEASE );
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful, 0 if the number of records is being changed
+ * or -1 on error
+ */
+int status_table_get_number_of_records(
+     status_table_t *status_table,
+     uint32_t *number_of_records,
+     libcerror_error_t **error )
+{
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	uint32_t attempt      = 0;
+	uint32_t safe_number  = 0;
+	uint32_t sequence     = 0;
+#endif
+	static char *function = "status_table_get_number_of_records";
+
+	if( status_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status table.",
+		 function );
+
+		return( -1 );
+	}
+	if( status_table->header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid status table - missing header.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	for( attempt = 0;
+	     attempt < STATUS_TABLE_MAXIMUM_NUMBER_OF_READ_ATTEMPTS;
+	     attempt++ )
+	{
+		sequence = __atomic_load_n(
+		            &( status_table->header->sequence ),
+		            __ATOMIC_ACQUIRE );
+
+		if( ( sequence & 1 ) != 0 )
+		{
+			continue;
+		}
+		safe_number = status_table->header->number_of_records;
+
+		__atomic_thread_fence(
+		 __ATOMIC_ACQUIRE );
+
+		if( __atomic_load_n(
+		     &( status_table->header->sequence ),
+		     __ATOMIC_RELAXED ) == sequence )
+		{
+			/* The writer is not trusted to stay within bounds
+			 */
+			if( safe_number > status_table->maximum_number_of_records )
+			{
+				safe_number = status_table->maximum_number_of_records;
+			}
+			*number_of_records = safe_number;
+
+			return( 1 );
+		}
+	}
+#endif
+	return( 0 );
+}
+
+/* Reads a record
+ * The record is copied without a system call or lock, when the writer
+ * changes the record while it is copied the copy is retried
+ * Returns 1 if successful, 0 if the record is being written or -1 on error
+ */
+int status_table_read_record(
+     status_table_t *status_table,
+     uint32_t record_index,
+     status_table_record_t *record,
+     libcerror_error_t **error )
+{
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	status_table_record_t *table_record = NULL;
+	uint32_t attempt                    = 0;
+	uint32_t sequence                   = 0;
+#endif
+	static char *function               = "status_table_read_record";
+
+	if( status_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status table.",
+		 function );
+
+		return( -1 );
+	}
+	if( status_table->records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid status table - missing records.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index >= status_table->maximum_number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+	table_record = &( status_table->records[ record_index ] );
+
+	for( attempt = 0;
+	     attempt < STATUS_TABLE_MAXIMUM_NUMBER_OF_READ_ATTEMPTS;
+	     attempt++ )
+	{
+		sequence = __atomic_load_n(
+		            &( table_record->sequence ),
+		            __ATOMIC_ACQUIRE );
+
+		if( ( sequence & 1 ) != 0 )
+		{
+			continue;
+		}
+		memory_copy(
+		 record,
+		 table_record,
+		 sizeof( status_table_record_t ) );
+
+		__atomic_thread_fence(
+		 __ATOMIC_ACQUIRE );
+
+		if( __atomic_load_n(
+		     &( table_record->sequence ),
+		     __ATOMIC_RELAXED ) == sequence )
+		{
+			record->sequence = sequence;
+
+			/* The strings are not trusted to be terminated
+			 */
+			record->source[ STATUS_TABLE_STRING_SIZE - 1 ]               = 0;
+			record->bridge_serial_number[ STATUS_TABLE_STRING_SIZE - 1 ] = 0;
+			record->drive_model[ STATUS_TABLE_STRING_SIZE - 1 ]          = 0;
+			record->drive_serial_number[ STATUS_TABLE_STRING_SIZE - 1 ]  = 0;
+
+			return( 1 );
+		}
+	}
+#endif
+	return( 0 );
+}
+
@@ -0,0 +1,260 @@
+/*
+ * Shared memory status table of Tableau write blockers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _STATUS_TABLE_H )
+#define _STATUS_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_SHM_OPEN ) && defined( HAVE_MMAP ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_FCNTL_H ) && defined( __ATOMIC_ACQUIRE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define STATUS_TABLE_HAVE_SHARED_MEMORY
+#endif
+
+/* The signature and version of a status table
+ */
+#define STATUS_TABLE_SIGNATURE			"tableaus"
+#define STATUS_TABLE_VERSION			1
+
+#define STATUS_TABLE_MAXIMUM_NUMBER_OF_RECORDS	256
+
+#define STATUS_TABLE_STRING_SIZE		64
+
+/* The number of attempts a reader makes to obtain a consistent copy
+ * before it gives up on a record that is being written
+ */
+#define STATUS_TABLE_MAXIMUM_NUMBER_OF_READ_ATTEMPTS	1024
+
+typedef struct status_table_header status_table_header_t;
+
+/* The header of a status table, which is followed by the records
+ */
+struct status_table_header
+{
+	/* The signature
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The version
+	 */
+	uint32_t version;
+
+	/* The size of a record
+	 */
+	uint32_t record_size;
+
+	/* The maximum number of records
+	 */
+	uint32_t maximum_number_of_records;
+
+	/* The sequence of the number of records, which is odd while
+	 * the number of records is being changed
+	 */
+	uint32_t sequence;
+
+	/* The number of records
+	 */
+	uint32_t number_of_records;
+
+	/* Reserved for alignment
+	 */
+	uint32_t reserved1;
+
+	/* The POSIX time in seconds of the last change of the number of records
+	 */
+	uint64_t update_time;
+
+	/* Reserved for future use
+	 */
+	uint8_t reserved2[ 24 ];
+};
+
+typedef struct status_table_record status_table_record_t;
+
+/* A record of a status table, the size is a multiple of 64 so that
+ * every record starts on a cache line of its own
+ */
+struct status_table_record
+{
+	/* The sequence, which is odd while the record is being written
+	 */
+	uint32_t sequence;
+
+	/* The status, as defined by DAEMON_STATE_STATUSES
+	 */
+	uint8_t status;
+
+	/* The flags, as defined by DAEMON_STATE_FLAGS
+	 */
+	uint8_t flags;
+
+	/* Reserved for alignment
+	 */
+	uint16_t reserved1;
+
+	/* The number of sectors of the drive
+	 */
+	uint32_t drive_number_of_sectors;
+
+	/* The number of HPA sectors
+	 */
+	uint32_t hpa_number_of_sectors;
+
+	/* The number of DCO sectors
+	 */
+	uint32_t dco_number_of_sectors;
+
+	/* Reserved for alignment
+	 */
+	uint32_t reserved2;
+
+	/* The duration of the last query in microseconds
+	 */
+	uint64_t latency;
+
+	/* The duration of the slowest query in microseconds
+	 */
+	uint64_t maximum_latency;
+
+	/* The number of queries
+	 */
+	uint64_t number_of_queries;
+
+	/* The number of failed opens and queries
+	 */
+	uint64_t number_of_errors;
+
+	/* The POSIX time of the last poll in seconds
+	 */
+	uint64_t poll_time;
+
+	/* The source
+	 */
+	char source[ STATUS_TABLE_STRING_SIZE ];
+
+	/* The bridge serial number
+	 */
+	char bridge_serial_number[ STATUS_TABLE_STRING_SIZE ];
+
+	/* The drive model
+	 */
+	char drive_model[ STATUS_TABLE_STRING_SIZE ];
+
+	/* The drive serial number
+	 */
+	char drive_serial_number[ STATUS_TABLE_STRING_SIZE ];
+};
+
+typedef struct status_table status_table_t;
+
+/* A status table is a POSIX shared memory object with a single writer and
+ * any number of readers. The number of records and every record are
+ * protected by a sequence lock, hence a reader never blocks the writer and
+ * reading a record requires neither a system call nor a lock
+ */
+struct status_table
+{
+	/* The name of the shared memory object
+	 */
+	char name[ 256 ];
+
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The size of the mapped data
+	 */
+	size_t data_size;
+
+	/* The header in the mapped data
+	 */
+	status_table_header_t *header;
+
+	/* The records in the mapped data
+	 */
+	status_table_record_t *records;
+
+	/* The maximum number of records
+	 */
+	uint32_t maximum_number_of_records;
+
+	/* Value to indicate the table was created for writing
+	 */
+	uint8_t is_writer;
+};
+
+int status_table_initialize(
+     status_table_t **status_table,
+     libcerror_error_t **error );
+
+int status_table_free(
+     status_table_t **status_table,
+     libcerror_error_t **error );
+
+int status_table_create(
+     status_table_t *status_table,
+     const system_character_t *name,
+     uint32_t maximum_number_of_records,
+     libcerror_error_t **error );
+
+int status_table_open(
+     status_table_t *status_table,
+     const system_character_t *name,
+     libcerror_error_t **error );
+
+int status_table_close(
+     status_table_t *status_table,
+     libcerror_error_t **error );
+
+int status_table_set_number_of_records(
+     status_table_t *status_table,
+     uint32_t number_of_records,
+     libcerror_error_t **error );
+
+int status_table_write_record(
+     status_table_t *status_table,
+     uint32_t record_index,
+     const status_table_record_t *record,
+     libcerror_error_t **error );
+
+int status_table_get_number_of_records(
+     status_table_t *status_table,
+     uint32_t *number_of_records,
+     libcerror_error_t **error );
+
+int status_table_read_record(
+     status_table_t *status_table,
+     uint32_t record_index,
+     status_table_record_t *record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _STATUS_TABLE_H ) */
+
@@ -0,0 +1,302 @@
+/*
+ * Storage media buffer
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "storage_media_buffer.h"
+#include "tableautools_libcerror.h"
+
+/* Creates a storage media buffer
+ * Make sure the value buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_initialize(
+     storage_media_buffer_t **buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_initialize";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer = memory_allocate_structure(
+	           storage_media_buffer_t );
+
+	if( *buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *buffer,
+	     0,
+	     sizeof( storage_media_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer.",
+		 function );
+
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_POSIX_MEMALIGN )
+	if( posix_memalign(
+	     (void **) &( ( *buffer )->raw_buffer ),
+	     STORAGE_MEDIA_BUFFER_ALIGNMENT,
+	     size ) != 0 )
+	{
+		( *buffer )->raw_buffer = NULL;
+	}
+#else
+	( *buffer )->raw_buffer = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * size );
+#endif
+	if( ( *buffer )->raw_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create raw buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *buffer )->raw_buffer_size = size;
+
+	return( 1 );
+
+on_error:
+	if( *buffer != NULL )
+	{
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a storage media buffer
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_free(
+     storage_media_buffer_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_free";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		if( ( *buffer )->raw_buffer != NULL )
+		{
+			memory_free(
+			 ( *buffer )->raw_buffer );
+		}
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines if a block of the buffer data consists of zero bytes only
+ * The words of the block are tested a cache line at a time, combining
+ * the words without a branch per word allows the compiler to use vector
+ * instructions
+ * Returns 1 if the block consists of zero bytes, 0 if not or -1 on error
+ */
+int storage_media_buffer_check_for_zero_block(
+     storage_media_buffer_t *buffer,
+     size_t buffer_offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	const storage_media_buffer_aligned_t *aligned_data = NULL;
+	const uint8_t *data                                = NULL;
+	static char *function                              = "storage_media_buffer_check_for_zero_block";
+	storage_media_buffer_aligned_t aligned_value       = 0;
+	size_t number_of_words                             = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer->raw_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid buffer - missing raw buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset > buffer->raw_buffer_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > ( buffer->raw_buffer_data_size - buffer_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data = &( buffer->raw_buffer[ buffer_offset ] );
+
+	/* Test the bytes before the first aligned word
+	 */
+	while( ( size > 0 )
+	    && ( ( (intptr_t) data % sizeof( storage_media_buffer_aligned_t ) ) != 0 ) )
+	{
+		if( *data != 0 )
+		{
+			return( 0 );
+		}
+		data++;
+		size--;
+	}
+	aligned_data    = (const storage_media_buffer_aligned_t *) data;
+	number_of_words = size / sizeof( storage_media_buffer_aligned_t );
+
+	while( number_of_words >= 8 )
+	{
+		aligned_value = aligned_data[ 0 ] | aligned_data[ 1 ]
+		              | aligned_data[ 2 ] | aligned_data[ 3 ]
+		              | aligned_data[ 4 ] | aligned_data[ 5 ]
+		              | aligned_data[ 6 ] | aligned_data[ 7 ];
+
+		if( aligned_value != 0 )
+		{
+			return( 0 );
+		}
+		aligned_data    += 8;
+		number_of_words -= 8;
+	}
+	while( number_of_words > 0 )
+	{
+		if( *aligned_data != 0 )
+		{
+			return( 0 );
+		}
+		aligned_data++;
+		number_of_words--;
+	}
+	/* Test the bytes after the last aligned word
+	 */
+	data = (const uint8_t *) aligned_data;
+	size = size % sizeof( storage_media_buffer_aligned_t );
+
+	while( size > 0 )
+	{
+		if( *data != 0 )
+		{
+			return( 0 );
+		}
+		data++;
+		size--;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,105 @@
+/*
+ * Storage media buffer
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _STORAGE_MEDIA_BUFFER_H )
+#define _STORAGE_MEDIA_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the buffer data, a page aligned buffer allows the
+ * operating system to transfer data from the device without copying it
+ */
+#define STORAGE_MEDIA_BUFFER_ALIGNMENT	4096
+
+/* The type used to test the buffer data a word at a time
+ */
+typedef uint64_t storage_media_buffer_aligned_t;
+
+typedef struct storage_media_buffer storage_media_buffer_t;
+
+struct storage_media_buffer
+{
+	/* The raw buffer
+	 */
+	uint8_t *raw_buffer;
+
+	/* The raw buffer size
+	 */
+	size_t raw_buffer_size;
+
+	/* The raw buffer data size
+	 */
+	size_t raw_buffer_data_size;
+
+	/* The storage media offset
+	 */
+	off64_t storage_media_offset;
+
+	/* The sequence number
+	 */
+	uint64_t sequence_number;
+
+	/* Value to indicate the data was read successfully
+	 */
+	int read_result;
+
+	/* The number of pipeline stages still using the buffer
+	 */
+	int number_of_references;
+
+	/* The buffer the data is compared with, only used by the verification
+	 */
+	struct storage_media_buffer *compare_buffer;
+
+	/* The chunk compressor that holds the compressed data, only used when
+	 * the output is compressed
+	 */
+	struct chunk_compressor *chunk_compressor;
+};
+
+int storage_media_buffer_initialize(
+     storage_media_buffer_t **buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int storage_media_buffer_free(
+     storage_media_buffer_t **buffer,
+     libcerror_error_t **error );
+
+int storage_media_buffer_check_for_zero_block(
+     storage_media_buffer_t *buffer,
+     size_t buffer_offset,
+     size_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _STORAGE_MEDIA_BUFFER_H ) */
+
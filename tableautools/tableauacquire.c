@@ -0,0 +1,996 @@
+/*
+ * Acquires the data of a device attached to a Tableau write blocker
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <signal.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "acquire_handle.h"
+#include "acquire_scheduler.h"
+#include "tableautools_getopt.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libclocale.h"
+#include "tableautools_libcnotify.h"
+#include "tableautools_libtableau.h"
+#include "tableautools_output.h"
+#include "tableautools_signal.h"
+#include "tableautools_unused.h"
+
+volatile sig_atomic_t tableauacquire_abort = 0;
+
+/* Signal handler for tableauacquire
+ * The acquire handle and the scheduler are signalled through the abort flag,
+ * which is the only thing that is safe to change in a signal handler
+ */
+void tableauacquire_signal_handler(
+      tableautools_signal_t signal TABLEAUTOOLS_ATTRIBUTE_UNUSED )
+{
+	TABLEAUTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	tableauacquire_abort = 1;
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description    = \
+		"Use tableauacquire to acquire the data of a device attached to a Tableau write blocker.";
+
+	tableautools_option_t options[ ] = {
+		{ 'b', "size", "the number of bytes per read, must be a multiple of 4096 (default is 1048576)" },
+		{ 'c', "level", "compress the target in chunks of 65536 bytes and write a chunk index named target.index, options: none (default), fast, best" },
+		{ 'C', "number", "the maximum number of concurrent jobs per host controller, between 1 and 32 (default is 2)" },
+		{ 'd', "digest_type", "calculate additional digest (hash) types besides md5, options: sha1, sha256" },
+		{ 'F', "policy", "when the output is synchronized to disk, options: none, close (default), segment" },
+		{ 'h', NULL, "shows this help" },
+		{ 'j', "threads", "the number of concurrent read threads (default is 4)" },
+		{ 'J', "jobfile", "acquire the source devices of the job file concurrently, every line contains a source device and a target file separated by a tab" },
+		{ 'Q', "depth", "the maximum number of asynchronous output writes in flight, between 1 and 256 (default is 8)" },
+		{ 'r', "mapfile", "recovery mode, reads around bad sectors in multiple passes and keeps their state in the rescue map file, an existing rescue map resumes a previous recovery" },
+		{ 'R', NULL, "resume an interrupted acquisition from the checkpoint next to the target file" },
+		{ 'S', "size", "split the output into segment files of size bytes named target.001, target.002, etc., must be a multiple of 4096 and at least 1048576" },
+		{ 't', "target", "the target file to write the data to, an existing file is not overwritten" },
+		{ 'T', "cachefile", "calibrate the number of bytes per read and the number of read threads on the start of the device and cache the result per bridge and drive model in the tuning cache file" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 'y', NULL, "verify the target against the source after the acquisition, in recovery mode only the areas recovered after read errors are verified" },
+		{ 0, "source", "the source device, not used with -J" },
+	};
+	system_character_t options_string[ 32 ];
+
+	acquire_handle_t *acquire_handle                   = NULL;
+	acquire_scheduler_t *acquire_scheduler             = NULL;
+	libtableau_error_t *error                          = NULL;
+	system_character_t *option_additional_digest_types = NULL;
+	system_character_t *option_compression_level       = NULL;
+	system_character_t *option_fsync_policy            = NULL;
+	system_character_t *option_job_file                = NULL;
+	system_character_t *option_maximum_jobs            = NULL;
+	system_character_t *option_number_of_threads       = NULL;
+	system_character_t *option_process_buffer_size     = NULL;
+	system_character_t *option_queue_depth             = NULL;
+	system_character_t *option_rescue_map              = NULL;
+	system_character_t *option_segment_size            = NULL;
+	system_character_t *option_tuning_cache            = NULL;
+	system_character_t *source                         = NULL;
+	system_character_t *target                         = NULL;
+	char *program                                      = "tableauacquire";
+	system_integer_t option                            = 0;
+	int number_of_options                              = (int) ( sizeof( options ) / sizeof( tableautools_option_t ) );
+	int result                                         = 0;
+	int verbose                                        = 0;
+	uint8_t option_resume                              = 0;
+	uint8_t option_verify                              = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "tableautools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( tableautools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	tableautools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( tableautools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = tableautools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				tableautools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_process_buffer_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'c':
+				option_compression_level = optarg;
+
+				break;
+
+			case (system_integer_t) 'C':
+				option_maximum_jobs = optarg;
+
+				break;
+
+			case (system_integer_t) 'd':
+				option_additional_digest_types = optarg;
+
+				break;
+
+			case (system_integer_t) 'F':
+				option_fsync_policy = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				tableautools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'J':
+				option_job_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'Q':
+				option_queue_depth = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_rescue_map = optarg;
+
+				break;
+
+			case (system_integer_t) 'R':
+				option_resume = 1;
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_segment_size = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				target = optarg;
+
+				break;
+
+			case (system_integer_t) 'T':
+				option_tuning_cache = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				tableautools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'y':
+				option_verify = 1;
+
+				break;
+		}
+	}
+	if( option_job_file != NULL )
+	{
+		if( ( optind != argc )
+		 || ( target != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "The job file cannot be combined with a source device or -t, it lists the source devices and target files.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( option_rescue_map != NULL )
+		 || ( option_resume != 0 )
+		 || ( option_tuning_cache != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "The job file cannot be combined with -r, -R or -T.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	else if( option_maximum_jobs != NULL )
+	{
+		fprintf(
+		 stderr,
+		 "The maximum number of jobs per host controller requires a job file.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	else if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source device.\n" );
+
+		tableautools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	else
+	{
+		source = argv[ optind ];
+	}
+	if( ( option_job_file == NULL )
+	 && ( target == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target file.\n" );
+
+		tableautools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( option_rescue_map != NULL )
+	 && ( option_resume != 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "The recovery mode cannot be combined with resuming from a checkpoint, the rescue map resumes a recovery.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( option_compression_level != NULL )
+	 && ( ( option_rescue_map != NULL )
+	  || ( option_resume != 0 ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "The compression cannot be combined with -r or -R, a compressed target cannot be resumed.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_tuning_cache != NULL )
+	{
+		if( option_rescue_map != NULL )
+		{
+			fprintf(
+			 stderr,
+			 "The read tuning cannot be combined with the recovery mode, which reads with a single thread.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( option_process_buffer_size != NULL )
+		 || ( option_number_of_threads != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "The read tuning cannot be combined with -b or -j, it determines the number of bytes per read and the number of read threads.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libtableau_notify_set_stream(
+	 stderr,
+	 NULL );
+	libtableau_notify_set_verbose(
+	 verbose );
+
+	if( acquire_handle_initialize(
+	     &acquire_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize acquire handle.\n" );
+
+		goto on_error;
+	}
+	if( acquire_handle_set_abort_flag(
+	     acquire_handle,
+	     &tableauacquire_abort,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set abort flag of acquire handle.\n" );
+
+		goto on_error;
+	}
+	if( option_process_buffer_size != NULL )
+	{
+		result = acquire_handle_set_process_buffer_size(
+		          acquire_handle,
+		          option_process_buffer_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set process buffer size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported process buffer size defaulting to: %" PRIzd ".\n",
+			 acquire_handle->process_buffer_size );
+		}
+	}
+	if( option_additional_digest_types != NULL )
+	{
+		result = acquire_handle_set_additional_digest_types(
+		          acquire_handle,
+		          option_additional_digest_types,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set additional digest types.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported additional digest types defaulting to: md5.\n" );
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		result = acquire_handle_set_number_of_threads(
+		          acquire_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 acquire_handle->number_of_threads );
+		}
+	}
+	if( option_segment_size != NULL )
+	{
+		result = acquire_handle_set_segment_size(
+		          acquire_handle,
+		          option_segment_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set segment size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported segment size defaulting to: a single output file.\n" );
+		}
+	}
+	if( option_queue_depth != NULL )
+	{
+		result = acquire_handle_set_queue_depth(
+		          acquire_handle,
+		          option_queue_depth,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set queue depth.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported queue depth defaulting to: %d.\n",
+			 acquire_handle->queue_depth );
+		}
+	}
+	if( option_fsync_policy != NULL )
+	{
+		result = acquire_handle_set_fsync_policy(
+		          acquire_handle,
+		          option_fsync_policy,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set fsync policy.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported fsync policy defaulting to: close.\n" );
+		}
+	}
+	if( option_compression_level != NULL )
+	{
+		result = acquire_handle_set_compression_level(
+		          acquire_handle,
+		          option_compression_level,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set compression level.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported compression level defaulting to: none.\n" );
+		}
+	}
+	if( option_job_file != NULL )
+	{
+		if( acquire_scheduler_initialize(
+		     &acquire_scheduler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize acquire scheduler.\n" );
+
+			goto on_error;
+		}
+		if( acquire_scheduler_set_abort_flag(
+		     acquire_scheduler,
+		     &tableauacquire_abort,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set abort flag of acquire scheduler.\n" );
+
+			goto on_error;
+		}
+		if( option_maximum_jobs != NULL )
+		{
+			result = acquire_scheduler_set_maximum_jobs_per_controller(
+			          acquire_scheduler,
+			          option_maximum_jobs,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set maximum number of jobs per host controller.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported maximum number of jobs per host controller defaulting to: %d.\n",
+				 acquire_scheduler->maximum_jobs_per_controller );
+			}
+		}
+		acquire_scheduler->verify = option_verify;
+
+		if( acquire_scheduler_read_job_file(
+		     acquire_scheduler,
+		     option_job_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read job file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( tableautools_signal_attach(
+	     tableauacquire_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( option_job_file != NULL )
+	{
+		result = acquire_scheduler_run(
+		          acquire_scheduler,
+		          acquire_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run jobs.\n" );
+
+			goto on_error;
+		}
+		if( acquire_scheduler_fprint(
+		     acquire_scheduler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print jobs summary.\n" );
+
+			goto on_error;
+		}
+		if( tableautools_signal_detach(
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to detach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( acquire_scheduler_free(
+		     &acquire_scheduler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free acquire scheduler.\n" );
+
+			goto on_error;
+		}
+		if( acquire_handle_free(
+		     &acquire_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free acquire handle.\n" );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
+	if( acquire_handle_open_input(
+	     acquire_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source device.\n" );
+
+		goto on_error;
+	}
+	if( option_tuning_cache != NULL )
+	{
+		result = acquire_handle_open_tuning_cache(
+		          acquire_handle,
+		          option_tuning_cache,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open tuning cache.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stdout,
+			 "Calibrating the number of bytes per read and the number of read threads.\n" );
+
+			result = acquire_handle_calibrate(
+			          acquire_handle,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to calibrate reads.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to calibrate reads defaulting to: %" PRIzd " bytes per read and %d read thread(s).\n",
+				 acquire_handle->process_buffer_size,
+				 acquire_handle->number_of_threads );
+			}
+		}
+		if( result == 1 )
+		{
+			fprintf(
+			 stdout,
+			 "Using %" PRIzd " bytes per read and %d read thread(s).\n",
+			 acquire_handle->process_buffer_size,
+			 acquire_handle->number_of_threads );
+		}
+	}
+	if( option_rescue_map != NULL )
+	{
+		if( acquire_handle_open_rescue_map(
+		     acquire_handle,
+		     option_rescue_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open rescue map.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( acquire_handle_open_checkpoint(
+		     acquire_handle,
+		     target,
+		     option_resume,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open checkpoint.\n" );
+
+			goto on_error;
+		}
+		if( option_resume != 0 )
+		{
+			fprintf(
+			 stdout,
+			 "Resuming acquisition at offset: %" PRIi64 ".\n",
+			 acquire_handle->resume_offset );
+		}
+	}
+	if( acquire_handle_open_output(
+	     acquire_handle,
+	     target,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target file.\n" );
+
+		goto on_error;
+	}
+	if( option_rescue_map != NULL )
+	{
+		result = acquire_handle_recover(
+		          acquire_handle,
+		          &error );
+	}
+	else
+	{
+		result = acquire_handle_acquire(
+		          acquire_handle,
+		          &error );
+	}
+	if( result == -1 )
+	{
+		if( tableauacquire_abort != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Aborted while acquiring source device.\n" );
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Unable to acquire source device.\n" );
+		}
+		if( acquire_handle->checkpoint != NULL )
+		{
+			fprintf(
+			 stderr,
+			 "The acquisition can be resumed from the last checkpoint with -R.\n" );
+		}
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Aborted while acquiring source device.\n" );
+
+		if( acquire_handle->checkpoint != NULL )
+		{
+			fprintf(
+			 stderr,
+			 "The acquisition can be resumed from the last checkpoint with -R.\n" );
+		}
+	}
+	else if( acquire_handle_acquire_fprint(
+	          acquire_handle,
+	          &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print acquisition summary.\n" );
+
+		goto on_error;
+	}
+	if( ( result == 1 )
+	 && ( option_verify != 0 ) )
+	{
+		fprintf(
+		 stdout,
+		 "Verifying target against source.\n" );
+
+		result = acquire_handle_verify(
+		          acquire_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to verify target.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Aborted while verifying target.\n" );
+		}
+		else if( acquire_handle_verify_fprint(
+		          acquire_handle,
+		          &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print verification summary.\n" );
+
+			goto on_error;
+		}
+		else if( acquire_handle->number_of_mismatched_sectors > 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Verification failed: the target differs from the source in %" PRIu64 " sector(s), the first at offset: %" PRIi64 ".\n",
+			 acquire_handle->number_of_mismatched_sectors,
+			 acquire_handle->first_mismatch_offset );
+
+			result = 0;
+		}
+	}
+	if( acquire_handle_close(
+	     acquire_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close acquire handle.\n" );
+
+		goto on_error;
+	}
+	if( tableautools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( acquire_handle_free(
+	     &acquire_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free acquire handle.\n" );
+
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( acquire_scheduler != NULL )
+	{
+		tableautools_signal_detach(
+		 NULL );
+
+		acquire_scheduler_free(
+		 &acquire_scheduler,
+		 NULL );
+	}
+	if( acquire_handle != NULL )
+	{
+		tableautools_signal_detach(
+		 NULL );
+
+		acquire_handle_close(
+		 acquire_handle,
+		 NULL );
+		acquire_handle_free(
+		 &acquire_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
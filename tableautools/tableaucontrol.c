@@ -25,6 +25,7 @@
 #include <system_string.h>
 #include <types.h>
 
+#include <signal.h>
 #include <stdio.h>
 
 #if defined( HAVE_FCNTL_H ) || defined( WINAPI )
@@ -43,6 +44,8 @@
 #include <unistd.h>
 #endif
 
+#include "control_batch.h"
+#include "control_policy.h"
 #include "tableautools_getopt.h"
 #include "tableautools_input.h"
 #include "tableautools_libcerror.h"
@@ -50,6 +53,10 @@
 #include "tableautools_libcnotify.h"
 #include "tableautools_libtableau.h"
 #include "tableautools_output.h"
+#include "tableautools_signal.h"
+#include "tableautools_unused.h"
+
+volatile sig_atomic_t tableaucontrol_abort = 0;
 
 /* Prints the executable usage information
  */
@@ -60,13 +67,34 @@ void usage_fprint(
 	{
 		return;
 	}
-	fprintf( stream, "Usage: tableaucontrol [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: tableaucontrol [ -p policy_file ] [ -k key_file ] [ -ahvV ]\n"
+	                 "                      [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: the source device, multiple source devices can be\n"
+	                 "\t        specified in batch mode\n\n" );
 
+	fprintf( stream, "\t-a: discover the SCSI generic devices in batch mode, only\n"
+	                 "\t    supported on Linux\n" );
 	fprintf( stream, "\t-h: shows this help\n" );
+	fprintf( stream, "\t-k: the file containing the key the policy file is signed with\n" );
+	fprintf( stream, "\t-p: remove the DCO of multiple devices without confirmation\n"
+	                 "\t    (batch mode) as specified by the signed policy file\n" );
 	fprintf( stream, "\t-v: verbose output to stderr\n" );
 	fprintf( stream, "\t-V: print version\n" );
 }
 
+/* Signal handler for tableaucontrol
+ * The handle and the batch are signalled through the abort flag, which is
+ * the only thing that is safe to change in a signal handler
+ */
+void tableaucontrol_signal_handler(
+      tableautools_signal_t signal TABLEAUTOOLS_ATTRIBUTE_UNUSED )
+{
+	TABLEAUTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	tableaucontrol_abort = 1;
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -77,13 +105,19 @@ int main( int argc, char * const argv[] )
 {
 	system_character_t input_buffer[ 64 ];
 
+	control_batch_t *control_batch            = NULL;
+	control_policy_t *control_policy          = NULL;
 	libcerror_error_t *error                  = NULL;
 	libtableau_handle_t *handle               = NULL;
 	system_character_t *fixed_string_variable = NULL;
+	system_character_t *option_key_file       = NULL;
+	system_character_t *option_policy_file    = NULL;
 	system_character_t *source                = NULL;
 	char *program                             = "tableaucontrol";
 	system_integer_t option                   = 0;
 	int8_t input_confirmed                    = -1;
+	int argument_index                        = 0;
+	int discover_devices                      = 0;
 	int result                                = 0;
 	int verbose                               = 0;
 
@@ -125,7 +159,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = tableautools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "hvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "ahk:p:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -141,12 +175,27 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'a':
+				discover_devices = 1;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'k':
+				option_key_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_policy_file = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -159,7 +208,9 @@ int main( int argc, char * const argv[] )
 				return( EXIT_SUCCESS );
 		}
 	}
-	if( optind == argc )
+	if( ( optind == argc )
+	 && ( ( option_policy_file == NULL )
+	  || ( discover_devices == 0 ) ) )
 	{
 		fprintf(
 		 stderr,
@@ -170,8 +221,32 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
+	if( option_policy_file == NULL )
+	{
+		if( ( discover_devices != 0 )
+		 || ( ( argc - optind ) > 1 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Multiple source devices require a policy file.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	else if( option_key_file == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Missing key file.\n" );
+
+		usage_fprint(
+		 stdout );
 
+		return( EXIT_FAILURE );
+	}
 	libcnotify_verbose_set(
 	 verbose );
 	libtableau_notify_set_stream(
@@ -180,6 +255,200 @@ int main( int argc, char * const argv[] )
 	libtableau_notify_set_verbose(
 	 verbose );
 
+	if( option_policy_file != NULL )
+	{
+		if( control_policy_initialize(
+		     &control_policy,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize policy.\n" );
+
+			goto on_error;
+		}
+		if( control_policy_read_key_file(
+		     control_policy,
+		     option_key_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read key file: %" PRIs_SYSTEM ".\n",
+			 option_key_file );
+
+			goto on_error;
+		}
+		result = control_policy_read_file(
+		          control_policy,
+		          option_policy_file,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read policy file: %" PRIs_SYSTEM ".\n",
+			 option_policy_file );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Policy file: %" PRIs_SYSTEM " is not signed with the key.\n",
+			 option_policy_file );
+
+			goto on_error;
+		}
+		if( control_batch_initialize(
+		     &control_batch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize batch.\n" );
+
+			goto on_error;
+		}
+		control_batch->verbose = (uint8_t) verbose;
+
+		if( control_batch_set_abort_flag(
+		     control_batch,
+		     &tableaucontrol_abort,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set abort flag of batch.\n" );
+
+			goto on_error;
+		}
+
+		for( argument_index = optind;
+		     argument_index < argc;
+		     argument_index++ )
+		{
+			if( control_batch_append_device(
+			     control_batch,
+			     argv[ argument_index ],
+			     system_string_length(
+			      argv[ argument_index ] ),
+			     0,
+			     &error ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append source device: %" PRIs_SYSTEM ".\n",
+				 argv[ argument_index ] );
+
+				goto on_error;
+			}
+		}
+		if( discover_devices != 0 )
+		{
+			if( control_batch_discover_devices(
+			     control_batch,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to discover devices.\n" );
+
+				goto on_error;
+			}
+		}
+		if( control_batch->number_of_devices == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "No devices found.\n" );
+
+			goto on_error;
+		}
+		if( tableautools_signal_attach(
+		     tableaucontrol_signal_handler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to attach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		result = control_batch_run(
+		          control_batch,
+		          control_policy,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process devices.\n" );
+
+			goto on_error;
+		}
+		if( control_batch_fprint(
+		     control_batch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print batch report.\n" );
+
+			goto on_error;
+		}
+		if( tableaucontrol_abort != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Aborted while processing devices.\n" );
+		}
+		if( tableautools_signal_detach(
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to detach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( control_batch_free(
+		     &control_batch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free batch.\n" );
+
+			goto on_error;
+		}
+		if( control_policy_free(
+		     &control_policy,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free policy.\n" );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
+	source = argv[ optind ];
+
 	if( libtableau_handle_initialize(
 	     &handle,
 	     &error ) != 1 )
@@ -190,6 +459,30 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
+	if( libtableau_handle_set_abort_flag(
+	     handle,
+	     &tableaucontrol_abort,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set abort flag of libtableau handle.\n" );
+
+		goto on_error;
+	}
+	if( tableautools_signal_attach(
+	     tableaucontrol_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
 	/* Open the device
 	 */
 	if( libtableau_handle_open(
@@ -209,10 +502,18 @@ int main( int argc, char * const argv[] )
 	     handle,
 	     &error ) != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to query Tableau.\n" );
-
+		if( tableaucontrol_abort != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Aborted while querying Tableau.\n" );
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Unable to query Tableau.\n" );
+		}
 		goto on_error;
 	}
 	result = libtableau_handle_detected_dco(
@@ -233,6 +534,14 @@ int main( int argc, char * const argv[] )
 		 */
 		while( input_confirmed == -1 )
 		{
+			if( tableaucontrol_abort != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Aborted.\n" );
+
+				goto on_error;
+			}
 			result = tableautools_input_get_fixed_string_variable(
 			          stdout,
 			          input_buffer,
@@ -251,9 +560,21 @@ int main( int argc, char * const argv[] )
 				libcerror_error_free(
 				 &error );
 
+				/* The read of the answer is interrupted by the signal handler
+				 */
+				if( tableaucontrol_abort != 0 )
+				{
+					continue;
+				}
 				fprintf(
 				 stdout,
 				 "Unable to determine answer.\n" );
+
+				if( file_stream_at_end(
+				     stdin ) != 0 )
+				{
+					goto on_error;
+				}
 			}
 			else
 			{
@@ -281,10 +602,18 @@ int main( int argc, char * const argv[] )
 			     handle,
 			     &error ) != 1 )
 			{
-				fprintf(
-				 stderr,
-				 "Unable to remove DCO.\n" );
-
+				if( tableaucontrol_abort != 0 )
+				{
+					fprintf(
+					 stderr,
+					 "Aborted while removing DCO, power cycle the drive before retrying.\n" );
+				}
+				else
+				{
+					fprintf(
+					 stderr,
+					 "Unable to remove DCO.\n" );
+				}
 				goto on_error;
 			}
 			fprintf(
@@ -309,6 +638,18 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( tableautools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
 	if( libtableau_handle_free(
 	     &handle,
 	     &error ) != 1 )
@@ -329,8 +670,26 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( control_batch != NULL )
+	{
+		tableautools_signal_detach(
+		 NULL );
+
+		control_batch_free(
+		 &control_batch,
+		 NULL );
+	}
+	if( control_policy != NULL )
+	{
+		control_policy_free(
+		 &control_policy,
+		 NULL );
+	}
 	if( handle != NULL )
 	{
+		tableautools_signal_detach(
+		 NULL );
+
 		libtableau_handle_free(
 		 &handle,
 		 NULL );
@@ -0,0 +1,607 @@
+/*
+ * Resident daemon that serves the state of Tableau write blockers
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_SIGNAL_H )
+#include <signal.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "daemon_server.h"
+#include "daemon_state.h"
+#include "metrics_textfile.h"
+#include "status_table.h"
+#include "tableautools_getopt.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_libclocale.h"
+#include "tableautools_libcnotify.h"
+#include "tableautools_libtableau.h"
+#include "tableautools_output.h"
+#include "tableautools_signal.h"
+#include "tableautools_unused.h"
+
+/* The default socket path
+ */
+#define TABLEAUD_DEFAULT_SOCKET_PATH	_SYSTEM_STRING( "/run/tableaud.sock" )
+
+daemon_server_t *tableaud_daemon_server = NULL;
+daemon_state_t *tableaud_daemon_state   = NULL;
+int tableaud_abort                      = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Usage: tableaud [ -i interval ] [ -m name ] [ -s socket_path ]\n"
+	                 "                [ -t textfile_path ] [ -ahvV ] [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: the source device, multiple source devices can be\n"
+	                 "\t        specified\n\n" );
+
+	fprintf( stream, "\t-a: discover the SCSI generic devices and track hot-plug,\n"
+	                 "\t    only supported on Linux\n" );
+	fprintf( stream, "\t-h: shows this help\n" );
+	fprintf( stream, "\t-i: the interval in milliseconds in which each device is\n"
+	                 "\t    queried, where interval is a value between 100 and\n"
+	                 "\t    3600000 (default is 1000)\n" );
+	fprintf( stream, "\t-m: the name of the POSIX shared memory object the state is\n"
+	                 "\t    published to, such as /tableaud, in addition to the socket\n" );
+	fprintf( stream, "\t-s: the path of the Unix domain socket the state is served on\n"
+	                 "\t    (default is /run/tableaud.sock)\n" );
+	fprintf( stream, "\t-t: the path of the text file the metrics are written to once per\n"
+	                 "\t    interval, such as /var/lib/node_exporter/tableaud.prom, in\n"
+	                 "\t    addition to the socket\n" );
+	fprintf( stream, "\t-v: verbose output to stderr\n" );
+	fprintf( stream, "\t-V: print version\n" );
+}
+
+/* Signal handler for tableaud
+ */
+void tableaud_signal_handler(
+      tableautools_signal_t signal TABLEAUTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "tableaud_signal_handler";
+
+	TABLEAUTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	tableaud_abort = 1;
+
+	if( tableaud_daemon_server != NULL )
+	{
+		if( daemon_server_signal_abort(
+		     tableaud_daemon_server,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal daemon server to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( tableaud_daemon_state != NULL )
+	{
+		if( daemon_state_signal_abort(
+		     tableaud_daemon_state,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal daemon state to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                      = NULL;
+	metrics_textfile_t *metrics_textfile          = NULL;
+	status_table_t *status_table                  = NULL;
+	system_character_t *option_interval           = NULL;
+	system_character_t *option_shared_memory_name = NULL;
+	system_character_t *option_socket_path        = NULL;
+	system_character_t *option_textfile_path      = NULL;
+	char *program                                 = "tableaud";
+	system_integer_t option                       = 0;
+	int argument_index                            = 0;
+	int discover_devices                          = 0;
+	int result                                    = 0;
+	int verbose                                   = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "tableautools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( tableautools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	tableautools_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = tableautools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "ahi:m:s:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %s\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'a':
+				discover_devices = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_interval = optarg;
+
+				break;
+
+			case (system_integer_t) 'm':
+				option_shared_memory_name = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_socket_path = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_textfile_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				tableautools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( optind == argc )
+	 && ( discover_devices == 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source device.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_socket_path == NULL )
+	{
+		option_socket_path = TABLEAUD_DEFAULT_SOCKET_PATH;
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libtableau_notify_set_stream(
+	 stderr,
+	 NULL );
+	libtableau_notify_set_verbose(
+	 verbose );
+
+	if( daemon_state_initialize(
+	     &tableaud_daemon_state,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize daemon state.\n" );
+
+		goto on_error;
+	}
+	if( option_interval != NULL )
+	{
+		result = daemon_state_set_poll_interval(
+		          tableaud_daemon_state,
+		          option_interval,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set poll interval.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported poll interval defaulting to: %" PRIu32 " milliseconds.\n",
+			 tableaud_daemon_state->poll_interval );
+		}
+	}
+	tableaud_daemon_state->track_hot_plug = (uint8_t) discover_devices;
+
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( daemon_state_append_device(
+		     tableaud_daemon_state,
+		     argv[ argument_index ],
+		     system_string_length(
+		      argv[ argument_index ] ),
+		     0,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source device: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
+
+			goto on_error;
+		}
+	}
+	if( daemon_server_initialize(
+	     &tableaud_daemon_server,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize daemon server.\n" );
+
+		goto on_error;
+	}
+	if( daemon_server_open(
+	     tableaud_daemon_server,
+	     option_socket_path,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open socket: %" PRIs_SYSTEM ".\n",
+		 option_socket_path );
+
+		goto on_error;
+	}
+	if( option_shared_memory_name != NULL )
+	{
+		if( status_table_initialize(
+		     &status_table,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize status table.\n" );
+
+			goto on_error;
+		}
+		if( status_table_create(
+		     status_table,
+		     option_shared_memory_name,
+		     STATUS_TABLE_MAXIMUM_NUMBER_OF_RECORDS,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create shared memory object: %" PRIs_SYSTEM ".\n",
+			 option_shared_memory_name );
+
+			goto on_error;
+		}
+		if( daemon_state_set_status_table(
+		     tableaud_daemon_state,
+		     status_table,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set status table.\n" );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "Publishing the state of the devices to: %" PRIs_SYSTEM ".\n",
+		 option_shared_memory_name );
+	}
+	if( option_textfile_path != NULL )
+	{
+		if( metrics_textfile_initialize(
+		     &metrics_textfile,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize metrics text file.\n" );
+
+			goto on_error;
+		}
+		if( metrics_textfile_set_path(
+		     metrics_textfile,
+		     option_textfile_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set metrics text file path: %" PRIs_SYSTEM ".\n",
+			 option_textfile_path );
+
+			goto on_error;
+		}
+		if( daemon_state_set_metrics_textfile(
+		     tableaud_daemon_state,
+		     metrics_textfile,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set metrics text file.\n" );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "Writing the metrics of the devices to: %" PRIs_SYSTEM ".\n",
+		 option_textfile_path );
+	}
+	if( tableautools_signal_attach(
+	     tableaud_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_SIGNAL_H ) && defined( SIGTERM ) && !defined( WINAPI )
+	/* The daemon is normally stopped by its service manager
+	 */
+	if( signal(
+	     SIGTERM,
+	     tableaud_signal_handler ) == SIG_ERR )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler for termination.\n" );
+	}
+#endif
+	fprintf(
+	 stdout,
+	 "Serving the state of the devices on: %" PRIs_SYSTEM ".\n",
+	 option_socket_path );
+
+	result = daemon_server_run(
+	          tableaud_daemon_server,
+	          tableaud_daemon_state,
+	          &error );
+
+#if defined( HAVE_SIGNAL_H ) && defined( SIGTERM ) && !defined( WINAPI )
+	signal(
+	 SIGTERM,
+	 SIG_DFL );
+#endif
+	if( tableautools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run daemon.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Served %" PRIu64 " requests.\n",
+	 tableaud_daemon_server->number_of_requests );
+
+	if( ( metrics_textfile != NULL )
+	 && ( metrics_textfile->number_of_failed_writes > 0 ) )
+	{
+		fprintf(
+		 stdout,
+		 "Unable to write the metrics text file %" PRIu64 " out of %" PRIu64 " times.\n",
+		 metrics_textfile->number_of_failed_writes,
+		 metrics_textfile->number_of_writes + metrics_textfile->number_of_failed_writes );
+	}
+
+	if( daemon_server_free(
+	     &tableaud_daemon_server,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free daemon server.\n" );
+
+		goto on_error;
+	}
+	if( daemon_state_free(
+	     &tableaud_daemon_state,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free daemon state.\n" );
+
+		goto on_error;
+	}
+	if( status_table != NULL )
+	{
+		if( status_table_free(
+		     &status_table,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free status table.\n" );
+
+			goto on_error;
+		}
+	}
+	if( metrics_textfile != NULL )
+	{
+		if( metrics_textfile_free(
+		     &metrics_textfile,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free metrics text file.\n" );
+
+			goto on_error;
+		}
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( tableaud_daemon_server != NULL )
+	{
+		daemon_server_free(
+		 &tableaud_daemon_server,
+		 NULL );
+	}
+	if( tableaud_daemon_state != NULL )
+	{
+		daemon_state_free(
+		 &tableaud_daemon_state,
+		 NULL );
+	}
+	if( status_table != NULL )
+	{
+		status_table_free(
+		 &status_table,
+		 NULL );
+	}
+	if( metrics_textfile != NULL )
+	{
+		metrics_textfile_free(
+		 &metrics_textfile,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
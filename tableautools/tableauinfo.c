@@ -24,6 +24,8 @@
 #include <system_string.h>
 #include <types.h>
 
+#include <signal.h>
+
 #if defined( HAVE_FCNTL_H ) || defined( WINAPI )
 #include <fcntl.h>
 #endif
@@ -40,7 +42,11 @@
 #include <unistd.h>
 #endif
 
+#include "info_benchmark.h"
 #include "info_handle.h"
+#include "info_inventory.h"
+#include "info_record.h"
+#include "info_watch.h"
 #include "tableautools_getopt.h"
 #include "tableautools_libcerror.h"
 #include "tableautools_libclocale.h"
@@ -50,51 +56,19 @@
 #include "tableautools_signal.h"
 #include "tableautools_unused.h"
 
-info_handle_t *tableauinfo_info_handle = NULL;
-int tableauinfo_abort                  = 0;
+volatile sig_atomic_t tableauinfo_abort = 0;
 
 /* Signal handler for tableauinfo
+ * The info handle, benchmark, inventory and watch are signalled through
+ * the abort flag, which is the only thing that is safe to change in a signal
+ * handler
  */
 void tableauinfo_signal_handler(
       tableautools_signal_t signal TABLEAUTOOLS_ATTRIBUTE_UNUSED )
 {
-	libcerror_error_t *error = NULL;
-	static char *function    = "tableauinfo_signal_handler";
-
 	TABLEAUTOOLS_UNREFERENCED_PARAMETER( signal )
 
 	tableauinfo_abort = 1;
-
-	if( tableauinfo_info_handle != NULL )
-	{
-		if( info_handle_signal_abort(
-		     tableauinfo_info_handle,
-		     &error ) != 1 )
-		{
-			libcnotify_printf(
-			 "%s: unable to signal info handle to abort.\n",
-			 function );
-
-			libcnotify_print_error_backtrace(
-			 error );
-			libcerror_error_free(
-			 &error );
-		}
-	}
-	/* Force stdin to close otherwise any function reading it will remain blocked
-	 */
-#if defined( WINAPI ) && !defined( __CYGWIN__ )
-	if( _close(
-	     0 ) != 0 )
-#else
-	if( close(
-	     0 ) != 0 )
-#endif
-	{
-		libcnotify_printf(
-		 "%s: unable to close stdin.\n",
-		 function );
-	}
 }
 
 /* The main program
@@ -109,19 +83,38 @@ int main( int argc, char * const argv[] )
 		"Use tableauinfo to determine information about a Tableau write blocker.";
 
 	tableautools_option_t options[ ] = {
+		{ 'a', NULL, "discover all SCSI generic devices and query them concurrently together with the source devices" },
+		{ 'b', "iterations", "benchmark the query latency of the source device with a number of back-to-back queries (1 to 1000000)" },
 		{ 'h', NULL, "shows this help" },
+		{ 'o', "format", "output format, options: text (default), jsonl, csv" },
+		{ 'r', NULL, "benchmark raw query commands, of which the response is not parsed" },
+		{ 't', NULL, "print a trace of the phases of opening and querying the source device" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
-		{ 0, "source", "the source device" },
+		{ 'w', "interval", "watch the source devices and redraw the values that changed every interval seconds" },
+		{ 0, "source", "the source device, multiple source devices are queried concurrently and reported ordered by bridge serial number" },
 	};
 	system_character_t options_string[ 32 ];
 
-	libtableau_error_t *error  = NULL;
-	system_character_t *source = NULL;
-	char *program              = "tableauinfo";
-	system_integer_t option    = 0;
-	int number_of_options      = (int) ( sizeof( options ) / sizeof( tableautools_option_t ) );
-	int verbose                = 0;
+	info_benchmark_t *info_benchmark                = NULL;
+	info_handle_t *info_handle                      = NULL;
+	info_inventory_t *info_inventory                = NULL;
+	info_watch_t *info_watch                        = NULL;
+	libtableau_error_t *error                       = NULL;
+	system_character_t *option_benchmark_iterations = NULL;
+	system_character_t *option_output_format        = NULL;
+	system_character_t *option_watch_interval       = NULL;
+	system_character_t *source                      = NULL;
+	char *program                                   = "tableauinfo";
+	system_integer_t option                         = 0;
+	int argument_index                              = 0;
+	int benchmark_raw_queries                       = 0;
+	int device_index                                = 0;
+	int discover_devices                            = 0;
+	int number_of_options                           = (int) ( sizeof( options ) / sizeof( tableautools_option_t ) );
+	int print_trace                                 = 0;
+	int result                                      = 0;
+	int verbose                                     = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
 	_setmode( _fileno( stdout ), _O_BINARY );
@@ -154,10 +147,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	tableautools_output_version_fprint(
-	 stdout,
-	 program );
-
 	if( tableautools_getopt_get_options_string(
 	     options,
 	     number_of_options,
@@ -179,6 +168,10 @@ int main( int argc, char * const argv[] )
 		{
 			case (system_integer_t) '?':
 			default:
+				tableautools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -193,7 +186,21 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'a':
+				discover_devices = 1;
+
+				break;
+
+			case (system_integer_t) 'b':
+				option_benchmark_iterations = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
+				tableautools_output_version_fprint(
+				 stdout,
+				 program );
+
 				tableautools_getopt_usage_fprint(
 				 stdout,
 				 program,
@@ -203,20 +210,49 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'o':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				benchmark_raw_queries = 1;
+
+				break;
+
+			case (system_integer_t) 't':
+				print_trace = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
 				break;
 
 			case (system_integer_t) 'V':
+				tableautools_output_version_fprint(
+				 stdout,
+				 program );
+
 				tableautools_output_copyright_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'w':
+				option_watch_interval = optarg;
+
+				break;
 		}
 	}
-	if( optind == argc )
+	if( ( optind == argc )
+	 && ( discover_devices == 0 ) )
 	{
+		tableautools_output_version_fprint(
+		 stdout,
+		 program );
+
 		fprintf(
 		 stderr,
 		 "Missing source device.\n" );
@@ -230,8 +266,6 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
-
 	libcnotify_verbose_set(
 	 verbose );
 	libtableau_notify_set_stream(
@@ -241,7 +275,7 @@ int main( int argc, char * const argv[] )
 	 verbose );
 
 	if( info_handle_initialize(
-	     &tableauinfo_info_handle,
+	     &info_handle,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -250,8 +284,602 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( info_handle_set_abort_flag(
+	     info_handle,
+	     &tableauinfo_abort,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set abort flag of info handle.\n" );
+
+		goto on_error;
+	}
+	if( option_output_format != NULL )
+	{
+		result = info_handle_set_output_format(
+		          info_handle,
+		          option_output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: text.\n" );
+		}
+	}
+	if( print_trace != 0 )
+	{
+		if( ( option_watch_interval != NULL )
+		 || ( discover_devices != 0 )
+		 || ( ( argc - optind ) != 1 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Trace requires a single source device, ignoring.\n" );
+		}
+		else if( info_handle_enable_trace(
+		          info_handle,
+		          &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to enable trace.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The version is not printed in a machine-readable output format
+	 * so that the output only contains records
+	 */
+	if( info_handle->output_format == INFO_RECORD_FORMAT_TEXT )
+	{
+		tableautools_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( option_benchmark_iterations != NULL )
+	{
+		if( ( option_watch_interval != NULL )
+		 || ( discover_devices != 0 )
+		 || ( ( argc - optind ) != 1 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Benchmark mode requires a single source device.\n" );
+
+			goto on_error;
+		}
+		if( info_benchmark_initialize(
+		     &info_benchmark,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize benchmark.\n" );
+
+			goto on_error;
+		}
+		if( info_benchmark_set_abort_flag(
+		     info_benchmark,
+		     &tableauinfo_abort,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set abort flag of benchmark.\n" );
+
+			goto on_error;
+		}
+		result = info_benchmark_set_number_of_iterations(
+		          info_benchmark,
+		          option_benchmark_iterations,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of benchmark iterations.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of benchmark iterations defaulting to: %" PRIu32 ".\n",
+			 info_benchmark->number_of_iterations );
+		}
+		info_benchmark->output_format = info_handle->output_format;
+
+		if( benchmark_raw_queries != 0 )
+		{
+			info_benchmark->mode = INFO_BENCHMARK_MODE_RAW;
+		}
+		source = argv[ optind ];
+
+		if( tableautools_signal_attach(
+		     tableauinfo_signal_handler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to attach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( info_handle_open_input(
+		     info_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source device.\n" );
+
+			goto on_error;
+		}
+		result = info_benchmark_run(
+		          info_benchmark,
+		          info_handle->input_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark source device.\n" );
+
+			goto on_error;
+		}
+		if( info_benchmark_fprint(
+		     info_benchmark,
+		     info_handle->source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print benchmark.\n" );
+
+			goto on_error;
+		}
+		if( info_handle_trace_fprint(
+		     info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print trace.\n" );
+
+			goto on_error;
+		}
+		if( tableauinfo_abort != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Aborted while benchmarking source device.\n" );
+		}
+		if( info_handle_close_input(
+		     info_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close info handle.\n" );
+
+			goto on_error;
+		}
+		if( tableautools_signal_detach(
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to detach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( info_benchmark_free(
+		     &info_benchmark,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free benchmark.\n" );
+
+			goto on_error;
+		}
+		if( info_handle_free(
+		     &info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free info handle.\n" );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
+	if( option_watch_interval != NULL )
+	{
+		if( info_handle->output_format != INFO_RECORD_FORMAT_TEXT )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format in watch mode defaulting to: text.\n" );
+		}
+		if( info_watch_initialize(
+		     &info_watch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize watch.\n" );
+
+			goto on_error;
+		}
+		if( info_watch_set_abort_flag(
+		     info_watch,
+		     &tableauinfo_abort,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set abort flag of watch.\n" );
+
+			goto on_error;
+		}
+		result = info_watch_set_interval(
+		          info_watch,
+		          option_watch_interval,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set watch interval.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported watch interval defaulting to: %" PRIu32 ".\n",
+			 info_watch->interval );
+		}
+#if defined( HAVE_ISATTY )
+		if( isatty(
+		     fileno( info_watch->notify_stream ) ) != 0 )
+		{
+			info_watch->use_escape_sequences = 1;
+		}
+#endif
+		for( argument_index = optind;
+		     argument_index < argc;
+		     argument_index++ )
+		{
+			if( info_watch_append_device(
+			     info_watch,
+			     argv[ argument_index ],
+			     system_string_length(
+			      argv[ argument_index ] ),
+			     &error ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append source device: %" PRIs_SYSTEM ".\n",
+				 argv[ argument_index ] );
+
+				goto on_error;
+			}
+		}
+		/* The discovered devices are watched together with the source devices
+		 */
+		if( discover_devices != 0 )
+		{
+			if( info_inventory_initialize(
+			     &info_inventory,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to initialize inventory.\n" );
+
+				goto on_error;
+			}
+			if( info_inventory_discover_devices(
+			     info_inventory,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to discover devices.\n" );
+
+				goto on_error;
+			}
+			for( device_index = 0;
+			     device_index < info_inventory->number_of_devices;
+			     device_index++ )
+			{
+				source = info_inventory->devices[ device_index ]->source;
+
+				if( info_watch_append_device(
+				     info_watch,
+				     source,
+				     system_string_length(
+				      source ),
+				     &error ) == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to append discovered device: %" PRIs_SYSTEM ".\n",
+					 source );
+
+					goto on_error;
+				}
+			}
+			if( info_inventory_free(
+			     &info_inventory,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free inventory.\n" );
+
+				goto on_error;
+			}
+		}
+		if( info_watch->number_of_devices == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "No devices found.\n" );
+
+			goto on_error;
+		}
+		if( tableautools_signal_attach(
+		     tableauinfo_signal_handler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to attach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( info_watch_run(
+		     info_watch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to watch devices.\n" );
+
+			goto on_error;
+		}
+		if( tableautools_signal_detach(
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to detach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( info_watch_free(
+		     &info_watch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free watch.\n" );
+
+			goto on_error;
+		}
+		if( info_handle_free(
+		     &info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free info handle.\n" );
+
+			goto on_error;
+		}
+		return( EXIT_SUCCESS );
+	}
+	if( ( discover_devices != 0 )
+	 || ( ( argc - optind ) > 1 ) )
+	{
+		if( info_inventory_initialize(
+		     &info_inventory,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize inventory.\n" );
+
+			goto on_error;
+		}
+		if( info_inventory_set_abort_flag(
+		     info_inventory,
+		     &tableauinfo_abort,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set abort flag of inventory.\n" );
+
+			goto on_error;
+		}
+		info_inventory->verbose       = (uint8_t) verbose;
+		info_inventory->output_format = info_handle->output_format;
+
+		for( argument_index = optind;
+		     argument_index < argc;
+		     argument_index++ )
+		{
+			if( info_inventory_append_device(
+			     info_inventory,
+			     argv[ argument_index ],
+			     system_string_length(
+			      argv[ argument_index ] ),
+			     0,
+			     &error ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append source device: %" PRIs_SYSTEM ".\n",
+				 argv[ argument_index ] );
+
+				goto on_error;
+			}
+		}
+		if( discover_devices != 0 )
+		{
+			if( info_inventory_discover_devices(
+			     info_inventory,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to discover devices.\n" );
+
+				goto on_error;
+			}
+		}
+		if( info_inventory->number_of_devices == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "No devices found.\n" );
+
+			goto on_error;
+		}
+		if( tableautools_signal_attach(
+		     tableauinfo_signal_handler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to attach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		result = info_inventory_run(
+		          info_inventory,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to query devices.\n" );
+
+			goto on_error;
+		}
+		if( info_inventory_fprint(
+		     info_inventory,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print inventory.\n" );
+
+			goto on_error;
+		}
+		if( tableauinfo_abort != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Aborted while querying devices.\n" );
+		}
+		if( tableautools_signal_detach(
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to detach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( info_inventory_free(
+		     &info_inventory,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free inventory.\n" );
+
+			goto on_error;
+		}
+		if( info_handle_free(
+		     &info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free info handle.\n" );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
+	source = argv[ optind ];
+
+	if( tableautools_signal_attach(
+	     tableauinfo_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
 	if( info_handle_open_input(
-	     tableauinfo_info_handle,
+	     info_handle,
 	     source,
 	     &error ) != 1 )
 	{
@@ -261,18 +889,46 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( info_handle_header_fprint(
+	     info_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print header.\n" );
+
+		goto on_error;
+	}
 	if( info_handle_device_fprint(
-	     tableauinfo_info_handle,
+	     info_handle,
+	     &error ) != 1 )
+	{
+		if( tableauinfo_abort != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Aborted while printing device information.\n" );
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print device information.\n" );
+		}
+		goto on_error;
+	}
+	if( info_handle_trace_fprint(
+	     info_handle,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to print device information.\n" );
+		 "Unable to print trace.\n" );
 
 		goto on_error;
 	}
 	if( info_handle_close_input(
-	     tableauinfo_info_handle,
+	     info_handle,
 	     &error ) != 0 )
 	{
 		fprintf(
@@ -281,8 +937,20 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( tableautools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
 	if( info_handle_free(
-	     &tableauinfo_info_handle,
+	     &info_handle,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -301,10 +969,40 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( tableauinfo_info_handle != NULL )
+	if( info_benchmark != NULL )
+	{
+		tableautools_signal_detach(
+		 NULL );
+
+		info_benchmark_free(
+		 &info_benchmark,
+		 NULL );
+	}
+	if( info_inventory != NULL )
+	{
+		tableautools_signal_detach(
+		 NULL );
+
+		info_inventory_free(
+		 &info_inventory,
+		 NULL );
+	}
+	if( info_watch != NULL )
+	{
+		tableautools_signal_detach(
+		 NULL );
+
+		info_watch_free(
+		 &info_watch,
+		 NULL );
+	}
+	if( info_handle != NULL )
 	{
+		tableautools_signal_detach(
+		 NULL );
+
 		info_handle_free(
-		 &tableauinfo_info_handle,
+		 &info_handle,
 		 NULL );
 	}
 	return( EXIT_FAILURE );
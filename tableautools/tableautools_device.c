@@ -0,0 +1,406 @@
+/*
+ * Device discovery functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_SYS_IOCTL_H )
+#include <sys/ioctl.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SCSI_SG_H )
+#include <scsi/sg.h>
+#endif
+
+#include "tableautools_device.h"
+#include "tableautools_libcerror.h"
+#include "tableautools_unused.h"
+
+#if defined( __linux__ ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+/* Retrieves the vendor identification of a SCSI generic device
+ * The vendor identification is read from sysfs and, if sysfs is not available,
+ * from the response to a standard INQUIRY command
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int tableautools_device_get_vendor_identification(
+     int device_number,
+     const char *device_name,
+     char *vendor_identification,
+     size_t vendor_identification_size,
+     libcerror_error_t **error )
+{
+	char sysfs_path[ 64 ];
+
+#if defined( HAVE_SCSI_SG_H ) && defined( HAVE_SYS_IOCTL_H ) && defined( HAVE_FCNTL_H )
+	uint8_t command[ 6 ]   = { 0x12, 0x00, 0x00, 0x00, TABLEAUTOOLS_DEVICE_INQUIRY_RESPONSE_SIZE, 0x00 };
+	uint8_t response[ TABLEAUTOOLS_DEVICE_INQUIRY_RESPONSE_SIZE ];
+	uint8_t sense[ 32 ];
+
+	sg_io_hdr_t io_header;
+
+	int file_descriptor    = -1;
+	int result             = 0;
+#endif
+	FILE *sysfs_stream     = NULL;
+	static char *function  = "tableautools_device_get_vendor_identification";
+	size_t string_index    = 0;
+	int sysfs_path_length  = 0;
+
+	if( device_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device name.",
+		 function );
+
+		return( -1 );
+	}
+	if( vendor_identification == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid vendor identification.",
+		 function );
+
+		return( -1 );
+	}
+	if( vendor_identification_size < 9 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid vendor identification size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	vendor_identification[ 0 ] = 0;
+
+	sysfs_path_length = narrow_string_snprintf(
+	                     sysfs_path,
+	                     64,
+	                     "/sys/class/scsi_generic/sg%d/device/vendor",
+	                     device_number );
+
+	if( ( sysfs_path_length < 0 )
+	 || ( sysfs_path_length >= 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sysfs path.",
+		 function );
+
+		return( -1 );
+	}
+	sysfs_stream = fopen(
+	                sysfs_path,
+	                "r" );
+
+	if( sysfs_stream != NULL )
+	{
+		if( fgets(
+		     vendor_identification,
+		     (int) vendor_identification_size,
+		     sysfs_stream ) == NULL )
+		{
+			vendor_identification[ 0 ] = 0;
+		}
+		fclose(
+		 sysfs_stream );
+	}
+#if defined( HAVE_SCSI_SG_H ) && defined( HAVE_SYS_IOCTL_H ) && defined( HAVE_FCNTL_H )
+	else
+	{
+		/* The INQUIRY is sent non-blocking, so that a device that is in use
+		 * does not stall the discovery
+		 */
+		file_descriptor = open(
+		                   device_name,
+		                   O_RDONLY | O_NONBLOCK );
+
+		if( file_descriptor == -1 )
+		{
+			return( 0 );
+		}
+		memory_set(
+		 &io_header,
+		 0,
+		 sizeof( sg_io_hdr_t ) );
+
+		io_header.interface_id    = 'S';
+		io_header.dxfer_direction = SG_DXFER_FROM_DEV;
+		io_header.cmd_len         = 6;
+		io_header.mx_sb_len       = 32;
+		io_header.dxfer_len       = TABLEAUTOOLS_DEVICE_INQUIRY_RESPONSE_SIZE;
+		io_header.dxferp          = response;
+		io_header.cmdp            = command;
+		io_header.sbp             = sense;
+		io_header.timeout         = TABLEAUTOOLS_DEVICE_INQUIRY_TIMEOUT;
+
+		result = ioctl(
+		          file_descriptor,
+		          SG_IO,
+		          &io_header );
+
+		close(
+		 file_descriptor );
+
+		if( ( result == -1 )
+		 || ( ( io_header.info & SG_INFO_OK_MASK ) != SG_INFO_OK ) )
+		{
+			return( 0 );
+		}
+		/* The vendor identification is stored in bytes 8 to 15
+		 */
+		memory_copy(
+		 vendor_identification,
+		 &( response[ 8 ] ),
+		 8 );
+
+		vendor_identification[ 8 ] = 0;
+	}
+#endif
+	/* Strip the trailing white space
+	 */
+	string_index = narrow_string_length(
+	                vendor_identification );
+
+	while( ( string_index > 0 )
+	    && ( ( vendor_identification[ string_index - 1 ] == ' ' )
+	     ||  ( vendor_identification[ string_index - 1 ] == '\n' ) ) )
+	{
+		string_index--;
+	}
+	vendor_identification[ string_index ] = 0;
+
+	if( string_index == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( __linux__ ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+/* Determines if a vendor identification is that of a Tableau write blocker
+ * Returns 1 if the vendor identification matches, 0 if not or -1 on error
+ */
+int tableautools_device_is_tableau_vendor_identification(
+     const char *vendor_identification,
+     libcerror_error_t **error )
+{
+	static char *function = "tableautools_device_is_tableau_vendor_identification";
+	size_t string_length  = 0;
+
+	if( vendor_identification == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid vendor identification.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = narrow_string_length(
+	                 vendor_identification );
+
+	if( ( string_length == 7 )
+	 && ( narrow_string_compare_no_case(
+	       vendor_identification,
+	       TABLEAUTOOLS_DEVICE_VENDOR_IDENTIFICATION,
+	       7 ) == 0 ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Discovers the SCSI generic devices
+ * Discovery is only supported on Linux, where every Tableau write blocker
+ * is accessible as a /dev/sg# device. Only devices with a Tableau vendor
+ * identification are candidates, so that the vendor specific Tableau query
+ * is never sent to other devices. The append device function is called
+ * for every candidate and stops the discovery when it returns 0
+ * Returns 1 if successful or -1 on error
+ */
+int tableautools_device_discover(
+     int (*append_device)(
+            intptr_t *context,
+            const system_character_t *device_name,
+            size_t device_name_length,
+            libcerror_error_t **error ),
+     intptr_t *context,
+     libcerror_error_t **error )
+{
+#if defined( __linux__ ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	char device_name[ 32 ];
+	char vendor_identification[ 32 ];
+
+	struct stat file_statistics;
+
+	int device_name_length = 0;
+	int device_number      = 0;
+	int result             = 0;
+#endif
+	static char *function  = "tableautools_device_discover";
+
+	if( append_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid append device function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __linux__ ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	for( device_number = 0;
+	     device_number <= TABLEAUTOOLS_DEVICE_MAXIMUM_DEVICE_NUMBER;
+	     device_number++ )
+	{
+		device_name_length = narrow_string_snprintf(
+		                      device_name,
+		                      32,
+		                      "/dev/sg%d",
+		                      device_number );
+
+		if( ( device_name_length < 0 )
+		 || ( device_name_length >= 32 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set device name.",
+			 function );
+
+			return( -1 );
+		}
+		if( stat(
+		     device_name,
+		     &file_statistics ) != 0 )
+		{
+			continue;
+		}
+		if( !S_ISCHR( file_statistics.st_mode ) )
+		{
+			continue;
+		}
+		result = tableautools_device_get_vendor_identification(
+		          device_number,
+		          device_name,
+		          vendor_identification,
+		          32,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve vendor identification of device: %s.",
+			 function,
+			 device_name );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		result = tableautools_device_is_tableau_vendor_identification(
+		          vendor_identification,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if device: %s is a Tableau write blocker.",
+			 function,
+			 device_name );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		result = append_device(
+		          context,
+		          device_name,
+		          (size_t) device_name_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append device: %s.",
+			 function,
+			 device_name );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+#else
+	TABLEAUTOOLS_UNREFERENCED_PARAMETER( context )
+#endif
+	return( 1 );
+}
+
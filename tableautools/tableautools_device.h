@@ -0,0 +1,79 @@
+/*
+ * Device discovery functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TABLEAUTOOLS_DEVICE_H )
+#define _TABLEAUTOOLS_DEVICE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The highest SCSI generic (sg) device number that is discovered
+ */
+#define TABLEAUTOOLS_DEVICE_MAXIMUM_DEVICE_NUMBER	255
+
+/* The vendor identification reported by a Tableau write blocker
+ */
+#define TABLEAUTOOLS_DEVICE_VENDOR_IDENTIFICATION	"Tableau"
+
+/* The size of the standard INQUIRY response that is requested
+ */
+#define TABLEAUTOOLS_DEVICE_INQUIRY_RESPONSE_SIZE	36
+
+/* The timeout of the standard INQUIRY command in milli seconds
+ */
+#define TABLEAUTOOLS_DEVICE_INQUIRY_TIMEOUT		5000
+
+#if defined( __linux__ ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+int tableautools_device_get_vendor_identification(
+     int device_number,
+     const char *device_name,
+     char *vendor_identification,
+     size_t vendor_identification_size,
+     libcerror_error_t **error );
+
+#endif /* defined( __linux__ ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+int tableautools_device_is_tableau_vendor_identification(
+     const char *vendor_identification,
+     libcerror_error_t **error );
+
+int tableautools_device_discover(
+     int (*append_device)(
+            intptr_t *context,
+            const system_character_t *device_name,
+            size_t device_name_length,
+            libcerror_error_t **error ),
+     intptr_t *context,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _TABLEAUTOOLS_DEVICE_H ) */
+
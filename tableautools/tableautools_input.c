@@ -298,9 +298,16 @@ int tableautools_input_get_fixed_string_variable(
 		}
 		else
 		{
-			fprintf(
-			 stream,
-			 "Error reading input, please try again or terminate using Ctrl^C.\n" );
+			/* The read fails at the end of input or when it was interrupted by a signal
+			 */
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read input.",
+			 function );
+
+			return( -1 );
 		}
 	}
 	return( 1 );
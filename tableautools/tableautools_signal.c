@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_SIGNAL_H )
@@ -199,12 +200,16 @@ int tableautools_signal_detach(
 #else
 
 /* Attaches a signal handler for SIGINT
+ * The handler is attached without SA_RESTART so that a blocking read
+ * is interrupted and the caller can check its abort flag
  * Returns 1 if successful or -1 on error
  */
 int tableautools_signal_attach(
      void (*signal_handler)( tableautools_signal_t ),
      libcerror_error_t **error )
 {
+	struct sigaction signal_action;
+
 	static char *function = "tableautools_signal_attach";
 
 	if( signal_handler == NULL )
@@ -218,9 +223,30 @@ int tableautools_signal_attach(
 
 		return( -1 );
 	}
-	if( signal(
+	if( memory_set(
+	     &signal_action,
+	     0,
+	     sizeof( struct sigaction ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear signal action.",
+		 function );
+
+		return( -1 );
+	}
+	signal_action.sa_handler = signal_handler;
+	signal_action.sa_flags   = 0;
+
+	sigemptyset(
+	 &signal_action.sa_mask );
+
+	if( sigaction(
 	     SIGINT,
-	     signal_handler ) == SIG_ERR )
+	     &signal_action,
+	     NULL ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -0,0 +1,90 @@
+/*
+ * Time functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include <time.h>
+
+#include "tableautools_time.h"
+
+/* Retrieves the current value of a monotonic clock in nanoseconds
+ * Falls back to the POSIX time, with a resolution of seconds, if no monotonic
+ * clock is available so that nanoseconds is always set
+ * Returns 1 if successful or 0 if the POSIX time was used
+ */
+int tableautools_time_get_monotonic_time(
+     uint64_t *nanoseconds )
+{
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+#endif
+
+	if( nanoseconds == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) == 0 )
+	{
+		*nanoseconds = ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec;
+
+		return( 1 );
+	}
+#endif
+	*nanoseconds = (uint64_t) time( NULL ) * 1000000000UL;
+
+	return( 0 );
+}
+
+/* Sleeps for a number of milliseconds
+ * The sleep ends early when interrupted by a signal, so that an abort
+ * is handled without waiting for the sleep to pass
+ */
+void tableautools_time_sleep(
+      uint32_t milliseconds )
+{
+#if defined( WINAPI )
+	Sleep(
+	 (DWORD) milliseconds );
+
+#elif defined( HAVE_NANOSLEEP )
+	struct timespec sleep_time;
+
+	sleep_time.tv_sec  = (time_t) ( milliseconds / 1000 );
+	sleep_time.tv_nsec = (long) ( milliseconds % 1000 ) * 1000000L;
+
+	nanosleep(
+	 &sleep_time,
+	 NULL );
+
+#else
+	sleep(
+	 (unsigned int) ( ( milliseconds + 999 ) / 1000 ) );
+#endif
+}
+
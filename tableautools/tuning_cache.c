@@ -0,0 +1,1077 @@
+/*
+ * Cache of the calibrated read tuning
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#include "rescue_map.h"
+#include "tableautools_libcerror.h"
+#include "tuning_cache.h"
+
+/* The maximum size of a line, an entry line is the largest
+ */
+#define TUNING_CACHE_MAXIMUM_LINE_SIZE	512
+
+/* Creates a tuning cache
+ * Make sure the value tuning_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int tuning_cache_initialize(
+     tuning_cache_t **tuning_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "tuning_cache_initialize";
+
+	if( tuning_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tuning cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tuning_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tuning cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*tuning_cache = memory_allocate_structure(
+	                 tuning_cache_t );
+
+	if( *tuning_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tuning cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *tuning_cache,
+	     0,
+	     sizeof( tuning_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tuning cache.",
+		 function );
+
+		memory_free(
+		 *tuning_cache );
+
+		*tuning_cache = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a tuning cache
+ * Returns 1 if successful or -1 on error
+ */
+int tuning_cache_free(
+     tuning_cache_t **tuning_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "tuning_cache_free";
+
+	if( tuning_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tuning cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tuning_cache != NULL )
+	{
+		memory_free(
+		 *tuning_cache );
+
+		*tuning_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines if an identification string can be stored in a field of an entry
+ * Returns 1 if the string can be stored, 0 if not or -1 on error
+ */
+static int tuning_cache_check_identification_string(
+            const char *string,
+            size_t string_size,
+            libcerror_error_t **error )
+{
+	static char *function = "tuning_cache_check_identification_string";
+	size_t string_length  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = narrow_string_length(
+	                 string );
+
+	if( string_length >= string_size )
+	{
+		return( 0 );
+	}
+	/* The fields of an entry are separated by a tab
+	 */
+	if( ( narrow_string_search_character(
+	       string,
+	       '\t',
+	       string_length ) != NULL )
+	 || ( narrow_string_search_character(
+	       string,
+	       '\n',
+	       string_length ) != NULL ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if two identification strings are equal
+ * Returns 1 if equal or 0 if not
+ */
+static int tuning_cache_identification_string_is_equal(
+            const char *string1,
+            const char *string2 )
+{
+	size_t string_length = narrow_string_length(
+	                        string1 );
+
+	if( string_length != narrow_string_length(
+	                      string2 ) )
+	{
+		return( 0 );
+	}
+	if( narrow_string_compare(
+	     string1,
+	     string2,
+	     string_length ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the entry of a specific bridge and drive
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int tuning_cache_get_entry(
+     tuning_cache_t *tuning_cache,
+     const char *bridge_model,
+     const char *bridge_firmware,
+     const char *bridge_channel_type,
+     const char *drive_model,
+     tuning_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	tuning_cache_entry_t *safe_entry = NULL;
+	static char *function            = "tuning_cache_get_entry";
+	int entry_index                  = 0;
+
+	if( tuning_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tuning cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bridge_model == NULL )
+	 || ( bridge_firmware == NULL )
+	 || ( bridge_channel_type == NULL )
+	 || ( drive_model == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identification string.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < tuning_cache->number_of_entries;
+	     entry_index++ )
+	{
+		safe_entry = &( tuning_cache->entries[ entry_index ] );
+
+		if( ( tuning_cache_identification_string_is_equal(
+		       safe_entry->bridge_model,
+		       bridge_model ) != 0 )
+		 && ( tuning_cache_identification_string_is_equal(
+		       safe_entry->bridge_firmware,
+		       bridge_firmware ) != 0 )
+		 && ( tuning_cache_identification_string_is_equal(
+		       safe_entry->bridge_channel_type,
+		       bridge_channel_type ) != 0 )
+		 && ( tuning_cache_identification_string_is_equal(
+		       safe_entry->drive_model,
+		       drive_model ) != 0 ) )
+		{
+			*entry = safe_entry;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Sets the entry of a specific bridge and drive
+ * An existing entry is replaced, otherwise the entry is added and
+ * the oldest entry is removed when the cache is full
+ * Returns 1 if successful, 0 if the identification cannot be stored or -1 on error
+ */
+int tuning_cache_set_entry(
+     tuning_cache_t *tuning_cache,
+     const char *bridge_model,
+     const char *bridge_firmware,
+     const char *bridge_channel_type,
+     const char *drive_model,
+     size_t process_buffer_size,
+     int number_of_threads,
+     uint64_t throughput,
+     libcerror_error_t **error )
+{
+	tuning_cache_entry_t *entry = NULL;
+	static char *function       = "tuning_cache_set_entry";
+	int entry_index             = 0;
+	int result                  = 0;
+
+	if( tuning_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tuning cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( process_buffer_size == 0 )
+	 || ( process_buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid process buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = tuning_cache_check_identification_string(
+	          bridge_model,
+	          64,
+	          error );
+
+	if( result == 1 )
+	{
+		result = tuning_cache_check_identification_string(
+		          bridge_firmware,
+		          64,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = tuning_cache_check_identification_string(
+		          bridge_channel_type,
+		          16,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = tuning_cache_check_identification_string(
+		          drive_model,
+		          64,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if identification string is supported.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = tuning_cache_get_entry(
+	          tuning_cache,
+	          bridge_model,
+	          bridge_firmware,
+	          bridge_channel_type,
+	          drive_model,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( tuning_cache->number_of_entries >= TUNING_CACHE_MAXIMUM_NUMBER_OF_ENTRIES )
+		{
+			for( entry_index = 1;
+			     entry_index < TUNING_CACHE_MAXIMUM_NUMBER_OF_ENTRIES;
+			     entry_index++ )
+			{
+				if( memory_copy(
+				     &( tuning_cache->entries[ entry_index - 1 ] ),
+				     &( tuning_cache->entries[ entry_index ] ),
+				     sizeof( tuning_cache_entry_t ) ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to remove oldest entry.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			tuning_cache->number_of_entries -= 1;
+		}
+		entry = &( tuning_cache->entries[ tuning_cache->number_of_entries ] );
+
+		if( memory_set(
+		     entry,
+		     0,
+		     sizeof( tuning_cache_entry_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entry.",
+			 function );
+
+			return( -1 );
+		}
+		/* The identification strings were checked to fit in the entry
+		 */
+		narrow_string_copy(
+		 entry->bridge_model,
+		 bridge_model,
+		 narrow_string_length( bridge_model ) );
+
+		narrow_string_copy(
+		 entry->bridge_firmware,
+		 bridge_firmware,
+		 narrow_string_length( bridge_firmware ) );
+
+		narrow_string_copy(
+		 entry->bridge_channel_type,
+		 bridge_channel_type,
+		 narrow_string_length( bridge_channel_type ) );
+
+		narrow_string_copy(
+		 entry->drive_model,
+		 drive_model,
+		 narrow_string_length( drive_model ) );
+
+		tuning_cache->number_of_entries += 1;
+	}
+	entry->process_buffer_size = process_buffer_size;
+	entry->number_of_threads   = number_of_threads;
+	entry->throughput          = throughput;
+
+	return( 1 );
+}
+
+/* Copies a tab separated field of an entry line
+ * The string index must point to the tab in front of the field and
+ * is moved to the end of the field
+ * Returns 1 if successful or -1 on error
+ */
+static int tuning_cache_copy_field_from_string(
+            const char *line,
+            size_t line_length,
+            size_t *line_index,
+            char *string,
+            size_t string_size,
+            libcerror_error_t **error )
+{
+	static char *function = "tuning_cache_copy_field_from_string";
+	size_t field_length   = 0;
+	size_t field_start    = 0;
+
+	if( ( *line_index >= line_length )
+	 || ( line[ *line_index ] != '\t' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing field.",
+		 function );
+
+		return( -1 );
+	}
+	field_start = *line_index + 1;
+
+	for( *line_index = field_start;
+	     *line_index < line_length;
+	     *line_index += 1 )
+	{
+		if( line[ *line_index ] == '\t' )
+		{
+			break;
+		}
+	}
+	field_length = *line_index - field_start;
+
+	if( field_length >= string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: field too large.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     string,
+	     &( line[ field_start ] ),
+	     field_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy field.",
+		 function );
+
+		return( -1 );
+	}
+	string[ field_length ] = 0;
+
+	return( 1 );
+}
+
+/* Reads the tuning cache from a file
+ * Every entry line contains the process buffer size, the number of threads
+ * and the throughput in hexadecimal, followed by the bridge model, bridge
+ * firmware, bridge channel type and drive model, all separated by a tab
+ * Returns 1 if successful, 0 if the file does not exist or -1 on error
+ */
+int tuning_cache_read(
+     tuning_cache_t *tuning_cache,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	char line[ TUNING_CACHE_MAXIMUM_LINE_SIZE ];
+
+	tuning_cache_entry_t *entry = NULL;
+	FILE *file_stream           = NULL;
+	static char *function       = "tuning_cache_read";
+	size_t key_length           = 0;
+	size_t line_index           = 0;
+	size_t line_length          = 0;
+	uint64_t value_64bit        = 0;
+	int line_number             = 0;
+	int result                  = 0;
+	int version                 = 0;
+
+	if( tuning_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tuning cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"r" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "r" );
+#endif
+	if( file_stream == NULL )
+	{
+		if( errno == ENOENT )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open tuning cache: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	tuning_cache->number_of_entries = 0;
+
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        TUNING_CACHE_MAXIMUM_LINE_SIZE ) != NULL )
+	{
+		line_number++;
+
+		line_length = narrow_string_length(
+		               line );
+
+		if( ( line_length == 0 )
+		 || ( line[ line_length - 1 ] != '\n' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid line: %d value out of bounds.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == '\n' )
+		     ||  ( line[ line_length - 1 ] == '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == '#' ) )
+		{
+			continue;
+		}
+		for( key_length = 0;
+		     key_length < line_length;
+		     key_length++ )
+		{
+			if( line[ key_length ] == '\t' )
+			{
+				break;
+			}
+		}
+		line_index = key_length;
+		result     = 0;
+
+		if( ( key_length == 7 )
+		 && ( narrow_string_compare(
+		       line,
+		       "version",
+		       7 ) == 0 ) )
+		{
+			result = rescue_map_copy_hexadecimal_from_string(
+			          line,
+			          line_length,
+			          &line_index,
+			          &value_64bit,
+			          error );
+
+			if( ( result == 1 )
+			 && ( value_64bit != TUNING_CACHE_VERSION ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported version: %" PRIu64 ".",
+				 function,
+				 value_64bit );
+
+				result = -1;
+			}
+			version = (int) value_64bit;
+		}
+		else if( ( key_length == 5 )
+		      && ( narrow_string_compare(
+		            line,
+		            "entry",
+		            5 ) == 0 ) )
+		{
+			if( version != TUNING_CACHE_VERSION )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing version before entry on line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			if( tuning_cache->number_of_entries >= TUNING_CACHE_MAXIMUM_NUMBER_OF_ENTRIES )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: number of entries exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			entry = &( tuning_cache->entries[ tuning_cache->number_of_entries ] );
+
+			result = rescue_map_copy_hexadecimal_from_string(
+			          line,
+			          line_length,
+			          &line_index,
+			          &value_64bit,
+			          error );
+
+			if( result == 1 )
+			{
+				if( ( value_64bit == 0 )
+				 || ( value_64bit > (uint64_t) SSIZE_MAX ) )
+				{
+					result = 0;
+				}
+				entry->process_buffer_size = (size_t) value_64bit;
+			}
+			if( result == 1 )
+			{
+				result = rescue_map_copy_hexadecimal_from_string(
+				          line,
+				          line_length,
+				          &line_index,
+				          &value_64bit,
+				          error );
+			}
+			if( result == 1 )
+			{
+				if( ( value_64bit == 0 )
+				 || ( value_64bit > (uint64_t) INT_MAX ) )
+				{
+					result = 0;
+				}
+				entry->number_of_threads = (int) value_64bit;
+			}
+			if( result == 1 )
+			{
+				result = rescue_map_copy_hexadecimal_from_string(
+				          line,
+				          line_length,
+				          &line_index,
+				          &( entry->throughput ),
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = tuning_cache_copy_field_from_string(
+				          line,
+				          line_length,
+				          &line_index,
+				          entry->bridge_model,
+				          64,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = tuning_cache_copy_field_from_string(
+				          line,
+				          line_length,
+				          &line_index,
+				          entry->bridge_firmware,
+				          64,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = tuning_cache_copy_field_from_string(
+				          line,
+				          line_length,
+				          &line_index,
+				          entry->bridge_channel_type,
+				          16,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = tuning_cache_copy_field_from_string(
+				          line,
+				          line_length,
+				          &line_index,
+				          entry->drive_model,
+				          64,
+				          error );
+			}
+			if( ( result == 1 )
+			 && ( line_index != line_length ) )
+			{
+				result = 0;
+			}
+			if( result == 1 )
+			{
+				tuning_cache->number_of_entries += 1;
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value on line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close tuning cache.",
+		 function );
+
+		file_stream = NULL;
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+	if( version != TUNING_CACHE_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing version.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	tuning_cache->number_of_entries = 0;
+
+	return( -1 );
+}
+
+/* Writes the tuning cache to a file
+ * The tuning cache is written to a temporary file first that then replaces
+ * the file, so that concurrent acquisitions never read a partial cache
+ * Returns 1 if successful or -1 on error
+ */
+int tuning_cache_write(
+     tuning_cache_t *tuning_cache,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t *temporary_filename = NULL;
+	tuning_cache_entry_t *entry            = NULL;
+	FILE *file_stream                      = NULL;
+	static char *function                  = "tuning_cache_write";
+	size_t filename_length                 = 0;
+	int entry_index                        = 0;
+	int print_count                        = 0;
+
+	if( tuning_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tuning cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	temporary_filename = (system_character_t *) memory_allocate(
+	                                             sizeof( system_character_t ) * ( filename_length + 5 ) );
+
+	if( temporary_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create temporary filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     temporary_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( temporary_filename[ filename_length ] ),
+	     _SYSTEM_STRING( ".tmp" ),
+	     5 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy temporary filename suffix.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               temporary_filename,
+	               L"w" );
+#else
+	file_stream = file_stream_open(
+	               temporary_filename,
+	               "w" );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open temporary tuning cache: %" PRIs_SYSTEM ".",
+		 function,
+		 temporary_filename );
+
+		goto on_error;
+	}
+	print_count = fprintf(
+	               file_stream,
+	               "# Tuning cache of tableauacquire\n"
+	               "# entry: process buffer size, number of threads, throughput (bytes per second),\n"
+	               "#        bridge model, bridge firmware, bridge channel type, drive model\n"
+	               "version\t0x%x\n",
+	               TUNING_CACHE_VERSION );
+
+	for( entry_index = 0;
+	     ( print_count >= 0 ) && ( entry_index < tuning_cache->number_of_entries );
+	     entry_index++ )
+	{
+		entry = &( tuning_cache->entries[ entry_index ] );
+
+		print_count = fprintf(
+		               file_stream,
+		               "entry\t0x%08" PRIx64 "\t0x%x\t0x%08" PRIx64 "\t%s\t%s\t%s\t%s\n",
+		               (uint64_t) entry->process_buffer_size,
+		               entry->number_of_threads,
+		               entry->throughput,
+		               entry->bridge_model,
+		               entry->bridge_firmware,
+		               entry->bridge_channel_type,
+		               entry->drive_model );
+	}
+	if( print_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write temporary tuning cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close temporary tuning cache.",
+		 function );
+
+		file_stream = NULL;
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( _wrename(
+	     temporary_filename,
+	     filename ) != 0 )
+#else
+	if( rename(
+	     temporary_filename,
+	     filename ) != 0 )
+#endif
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to replace tuning cache: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	memory_free(
+	 temporary_filename );
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( temporary_filename != NULL )
+	{
+		memory_free(
+		 temporary_filename );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,130 @@
+/*
+ * Cache of the calibrated read tuning
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TUNING_CACHE_H )
+#define _TUNING_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "tableautools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define TUNING_CACHE_VERSION				1
+
+/* The maximum number of entries, when the cache is full the oldest
+ * entry is replaced
+ */
+#define TUNING_CACHE_MAXIMUM_NUMBER_OF_ENTRIES		64
+
+typedef struct tuning_cache_entry tuning_cache_entry_t;
+
+struct tuning_cache_entry
+{
+	/* The bridge model
+	 */
+	char bridge_model[ 64 ];
+
+	/* The bridge firmware
+	 */
+	char bridge_firmware[ 64 ];
+
+	/* The bridge channel type
+	 */
+	char bridge_channel_type[ 16 ];
+
+	/* The drive model
+	 */
+	char drive_model[ 64 ];
+
+	/* The process buffer size, the number of bytes read by a single read
+	 */
+	size_t process_buffer_size;
+
+	/* The number of read threads
+	 */
+	int number_of_threads;
+
+	/* The throughput measured by the calibration in bytes per second
+	 */
+	uint64_t throughput;
+};
+
+typedef struct tuning_cache tuning_cache_t;
+
+struct tuning_cache
+{
+	/* The entries, from the oldest to the most recent
+	 */
+	tuning_cache_entry_t entries[ TUNING_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ];
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int tuning_cache_initialize(
+     tuning_cache_t **tuning_cache,
+     libcerror_error_t **error );
+
+int tuning_cache_free(
+     tuning_cache_t **tuning_cache,
+     libcerror_error_t **error );
+
+int tuning_cache_get_entry(
+     tuning_cache_t *tuning_cache,
+     const char *bridge_model,
+     const char *bridge_firmware,
+     const char *bridge_channel_type,
+     const char *drive_model,
+     tuning_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int tuning_cache_set_entry(
+     tuning_cache_t *tuning_cache,
+     const char *bridge_model,
+     const char *bridge_firmware,
+     const char *bridge_channel_type,
+     const char *drive_model,
+     size_t process_buffer_size,
+     int number_of_threads,
+     uint64_t throughput,
+     libcerror_error_t **error );
+
+int tuning_cache_read(
+     tuning_cache_t *tuning_cache,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int tuning_cache_write(
+     tuning_cache_t *tuning_cache,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _TUNING_CACHE_H ) */
+
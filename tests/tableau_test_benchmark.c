@@ -0,0 +1,1104 @@
+/*
+ * Library parsing, values table and string microbenchmarks
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+#include <time.h>
+
+#include "tableau_test_getopt.h"
+#include "tableau_test_libcerror.h"
+#include "tableau_test_libtableau.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_memory.h"
+#include "tableau_test_unused.h"
+
+#include "../libtableau/libtableau_definitions.h"
+#include "../libtableau/libtableau_query.h"
+#include "../libtableau/libtableau_security_values.h"
+#include "../libtableau/libtableau_string.h"
+#include "../libtableau/libtableau_values.h"
+#include "../libtableau/libtableau_values_table.h"
+
+#define TABLEAU_TEST_BENCHMARK_NUMBER_OF_ITERATIONS		200000
+#define TABLEAU_TEST_BENCHMARK_NUMBER_OF_SMOKE_ITERATIONS	16
+
+/* A timing is reported as slower when it exceeds the baseline by this factor
+ */
+#define TABLEAU_TEST_BENCHMARK_TIME_FACTOR			2
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+/* Query responses captured from a T35es bridge with a SATA drive that has
+ * a HPA and from a T8-R2 bridge with an USB flash drive without HPA or DCO
+ */
+uint8_t tableau_test_benchmark_response_sata[ 152 ] = {
+	0x00, 0x98, 0x0e, 0xcc, 0x00, 0x0c, 0x01, 0x0c,
+	0x00, 0x0e, 0xcc, 0x03, 0x00, 0xa1, 0xb2, 0xc3,
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x61, 0x75, 0x20,
+	0x54, 0x33, 0x35, 0x65, 0x73, 0x20, 0x20, 0x20,
+	0x4e, 0x6f, 0x76, 0x20, 0x31, 0x32, 0x20, 0x32,
+	0x30, 0x31, 0x30, 0x20, 0x31, 0x34, 0x3a, 0x32,
+	0x33, 0x3a, 0x35, 0x31, 0x20, 0x20, 0x20, 0x20,
+	0x41, 0x54, 0x41, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x57, 0x44, 0x43, 0x20, 0x57, 0x44, 0x35, 0x30,
+	0x30, 0x30, 0x41, 0x41, 0x4b, 0x53, 0x2d, 0x30,
+	0x30, 0x56, 0x31, 0x41, 0x30, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x57, 0x44, 0x2d, 0x57,
+	0x43, 0x41, 0x57, 0x46, 0x31, 0x32, 0x33, 0x34,
+	0x35, 0x36, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x30, 0x35, 0x2e, 0x30, 0x31, 0x44, 0x30, 0x35,
+	0x00, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3a, 0x38, 0x57, 0xef, 0x00, 0x00, 0x00, 0x00,
+	0x3a, 0x38, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0x3a, 0x38, 0x60, 0x30, 0x4d, 0x2a, 0x91, 0x07 };
+
+uint8_t tableau_test_benchmark_response_usb[ 152 ] = {
+	0x00, 0x98, 0x0e, 0xcc, 0x00, 0x04, 0x13, 0x0c,
+	0x00, 0x0e, 0xcc, 0x06, 0x00, 0x4d, 0x5e, 0x6f,
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x61, 0x75, 0x20,
+	0x54, 0x38, 0x2d, 0x52, 0x32, 0x20, 0x20, 0x20,
+	0x4a, 0x75, 0x6e, 0x20, 0x30, 0x33, 0x20, 0x32,
+	0x30, 0x31, 0x33, 0x20, 0x30, 0x39, 0x3a, 0x34,
+	0x31, 0x3a, 0x30, 0x37, 0x20, 0x20, 0x20, 0x20,
+	0x47, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x20,
+	0x55, 0x53, 0x42, 0x20, 0x46, 0x6c, 0x61, 0x73,
+	0x68, 0x20, 0x44, 0x69, 0x73, 0x6b, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x30, 0x31, 0x32, 0x33,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41, 0x42,
+	0x43, 0x44, 0x45, 0x46, 0x20, 0x20, 0x20, 0x20,
+	0x31, 0x31, 0x30, 0x30, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The values table identifiers that are looked up, the first, a middle and the last one
+ */
+const char *tableau_test_benchmark_identifiers[ 3 ] = {
+	"bridge_firmware_stepping", "drive_serial_number", "drive_security_in_use" };
+
+typedef struct tableau_test_benchmark_context tableau_test_benchmark_context_t;
+
+struct tableau_test_benchmark_context
+{
+	/* The values table
+	 */
+	libtableau_values_table_t *values_table;
+
+	/* The security values
+	 */
+	libtableau_security_values_t *security_values;
+
+	/* The query response
+	 */
+	uint8_t *response;
+};
+
+typedef struct tableau_test_benchmark_definition tableau_test_benchmark_definition_t;
+
+struct tableau_test_benchmark_definition
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The query response
+	 */
+	uint8_t *response;
+
+	/* The operation
+	 */
+	int (*operation)(
+	       tableau_test_benchmark_context_t *context,
+	       int iteration,
+	       libcerror_error_t **error );
+
+	/* Value to indicate the operation should not allocate memory
+	 */
+	int allocation_free;
+};
+
+typedef struct tableau_test_benchmark_result tableau_test_benchmark_result_t;
+
+struct tableau_test_benchmark_result
+{
+	/* The number of nanoseconds per operation
+	 */
+	double nanoseconds_per_operation;
+
+	/* The number of allocations per operation
+	 */
+	double allocations_per_operation;
+
+	/* Value to indicate the baseline contains the benchmark
+	 */
+	int has_baseline;
+
+	/* The baseline number of nanoseconds per operation
+	 */
+	double baseline_nanoseconds_per_operation;
+
+	/* The baseline number of allocations per operation
+	 */
+	double baseline_allocations_per_operation;
+};
+
+/* Retrieves the current time in nanoseconds
+ * Returns the current time
+ */
+int64_t tableau_test_benchmark_get_time(
+         void )
+{
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) == 0 )
+	{
+		return( ( (int64_t) time_value.tv_sec * 1000000000 ) + (int64_t) time_value.tv_nsec );
+	}
+#endif
+	return( (int64_t) time( NULL ) * 1000000000 );
+}
+
+/* Retrieves the number of allocations made by the process
+ * Returns the number of allocations or 0 if not supported
+ */
+uint64_t tableau_test_benchmark_get_number_of_allocations(
+          void )
+{
+#if defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING )
+	return( __atomic_load_n(
+	         &tableau_test_number_of_allocations,
+	         __ATOMIC_RELAXED ) );
+#else
+	return( 0 );
+#endif
+}
+
+/* Parses the header of the query response
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_benchmark_parse_tableau_header(
+     tableau_test_benchmark_context_t *context,
+     int iteration TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( iteration )
+
+	return( libtableau_query_parse_tableau_header(
+	         (tableau_header_t *) context->response,
+	         context->values_table,
+	         error ) );
+}
+
+/* Parses the HPA/DCO page data of the query response
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_benchmark_parse_tableau_page_data_hpa_dco(
+     tableau_test_benchmark_context_t *context,
+     int iteration TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( iteration )
+
+	return( libtableau_query_parse_tableau_page_data_hpa_dco(
+	         (tableau_page_data_hpa_dco_t *) &( context->response[ sizeof( tableau_header_t ) + sizeof( tableau_page_t ) ] ),
+	         context->values_table,
+	         context->security_values,
+	         error ) );
+}
+
+/* Looks up the index of one of the benchmark identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_benchmark_values_table_get_index(
+     tableau_test_benchmark_context_t *context,
+     int iteration,
+     libcerror_error_t **error )
+{
+	const char *identifier = tableau_test_benchmark_identifiers[ iteration % 3 ];
+
+	if( libtableau_values_table_get_index(
+	     context->values_table,
+	     identifier,
+	     narrow_string_length(
+	      identifier ),
+	     error ) < 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Replaces the value of the drive serial number
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_benchmark_values_table_set_value(
+     tableau_test_benchmark_context_t *context,
+     int iteration TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	char value_string[ 16 ] = "WD-WCAWF1234567";
+
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( iteration )
+
+	return( libtableau_values_table_set_value(
+	         context->values_table,
+	         "drive_serial_number",
+	         19,
+	         value_string,
+	         15,
+	         error ) );
+}
+
+/* Trims the drive model of the query response
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_benchmark_string_trim_copy(
+     tableau_test_benchmark_context_t *context,
+     int iteration TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	uint8_t value_string[ 29 ];
+
+	tableau_header_t *tableau_header = (tableau_header_t *) context->response;
+
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( iteration )
+
+	if( libtableau_string_trim_copy(
+	     value_string,
+	     tableau_header->drive_model,
+	     28,
+	     error ) <= 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+tableau_test_benchmark_definition_t tableau_test_benchmark_definitions[] = {
+	{ "parse_tableau_header_sata", tableau_test_benchmark_response_sata, tableau_test_benchmark_parse_tableau_header, 0 },
+	{ "parse_tableau_header_usb", tableau_test_benchmark_response_usb, tableau_test_benchmark_parse_tableau_header, 0 },
+	{ "parse_tableau_page_data_hpa_dco_sata", tableau_test_benchmark_response_sata, tableau_test_benchmark_parse_tableau_page_data_hpa_dco, 0 },
+	{ "parse_tableau_page_data_hpa_dco_usb", tableau_test_benchmark_response_usb, tableau_test_benchmark_parse_tableau_page_data_hpa_dco, 0 },
+	{ "values_table_get_index", tableau_test_benchmark_response_sata, tableau_test_benchmark_values_table_get_index, 1 },
+	{ "values_table_set_value", tableau_test_benchmark_response_sata, tableau_test_benchmark_values_table_set_value, 0 },
+	{ "string_trim_copy", tableau_test_benchmark_response_sata, tableau_test_benchmark_string_trim_copy, 1 } };
+
+#define TABLEAU_TEST_BENCHMARK_NUMBER_OF_DEFINITIONS \
+	( sizeof( tableau_test_benchmark_definitions ) / sizeof( tableau_test_benchmark_definition_t ) )
+
+/* Initializes a benchmark context with a filled values table
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_benchmark_context_initialize(
+     tableau_test_benchmark_context_t *context,
+     uint8_t *response,
+     libcerror_error_t **error )
+{
+	static char *function = "tableau_test_benchmark_context_initialize";
+
+	if( libtableau_values_table_initialize(
+	     &( context->values_table ),
+	     LIBTABLEAU_DEFAULT_NUMBER_OF_TABLEAU_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libtableau_values_initialize(
+	     context->values_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize values table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libtableau_security_values_initialize(
+	     &( context->security_values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security values.",
+		 function );
+
+		goto on_error;
+	}
+	context->response = response;
+
+	/* Fill the values table so that the benchmarks replace existing values
+	 */
+	if( tableau_test_benchmark_parse_tableau_header(
+	     context,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse tableau header.",
+		 function );
+
+		goto on_error;
+	}
+	if( tableau_test_benchmark_parse_tableau_page_data_hpa_dco(
+	     context,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse tableau HPA/DCO page data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( context->security_values != NULL )
+	{
+		libtableau_security_values_free(
+		 &( context->security_values ),
+		 NULL );
+	}
+	if( context->values_table != NULL )
+	{
+		libtableau_values_table_free(
+		 &( context->values_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a benchmark context
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_benchmark_context_free(
+     tableau_test_benchmark_context_t *context,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( libtableau_security_values_free(
+	     &( context->security_values ),
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	if( libtableau_values_table_free(
+	     &( context->values_table ),
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	return( result );
+}
+
+/* Tests the values parsed from the captured query responses
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_benchmark_responses(
+     void )
+{
+	char value_string[ 64 ];
+
+	tableau_test_benchmark_context_t context;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( tableau_test_benchmark_context_t ) );
+
+	/* Test the response with a HPA
+	 */
+	result = tableau_test_benchmark_context_initialize(
+	          &context,
+	          tableau_test_benchmark_response_sata,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_values_table_get_value_by_identifier(
+	          context.values_table,
+	          "drive_serial_number",
+	          19,
+	          value_string,
+	          64,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          value_string,
+	          "WD-WCAWF1234567",
+	          16 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libtableau_values_table_get_value_by_identifier(
+	          context.values_table,
+	          "drive_hpa_in_use",
+	          16,
+	          value_string,
+	          64,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          value_string,
+	          "true",
+	          5 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "context.security_values->drive_number_of_sectors",
+	 context.security_values->drive_number_of_sectors,
+	 (uint32_t) 976771055UL );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "context.security_values->hpa_number_of_sectors",
+	 context.security_values->hpa_number_of_sectors,
+	 (uint32_t) 976773168UL );
+
+	result = tableau_test_benchmark_context_free(
+	          &context,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the response without a HPA or DCO
+	 */
+	result = tableau_test_benchmark_context_initialize(
+	          &context,
+	          tableau_test_benchmark_response_usb,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_values_table_get_value_by_identifier(
+	          context.values_table,
+	          "bridge_channel_type",
+	          19,
+	          value_string,
+	          64,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          value_string,
+	          "USB",
+	          4 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "context.security_values->hpa_support",
+	 context.security_values->hpa_support,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "context.security_values->drive_number_of_sectors",
+	 context.security_values->drive_number_of_sectors,
+	 (uint32_t) 15663104UL );
+
+	result = tableau_test_benchmark_context_free(
+	          &context,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context.values_table != NULL )
+	{
+		tableau_test_benchmark_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Reads the baseline of the benchmark results
+ * The baseline consists of lines with a benchmark name, the number of nanoseconds
+ * per operation and the number of allocations per operation, separated by white space
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_benchmark_read_baseline(
+     const system_character_t *filename,
+     tableau_test_benchmark_result_t *results,
+     libcerror_error_t **error )
+{
+	char line[ 256 ];
+	char name[ 64 ];
+
+	FILE *file_stream                  = NULL;
+	static char *function              = "tableau_test_benchmark_read_baseline";
+	double allocations_per_operation   = 0.0;
+	double nanoseconds_per_operation   = 0.0;
+	size_t definition_index            = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"r" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "r" );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open baseline: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        256 ) != NULL )
+	{
+		if( ( line[ 0 ] == '#' )
+		 || ( line[ 0 ] == '\n' ) )
+		{
+			continue;
+		}
+		if( sscanf(
+		     line,
+		     "%63s %lf %lf",
+		     name,
+		     &nanoseconds_per_operation,
+		     &allocations_per_operation ) != 3 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported baseline line: %s",
+			 function,
+			 line );
+
+			file_stream_close(
+			 file_stream );
+
+			return( -1 );
+		}
+		for( definition_index = 0;
+		     definition_index < TABLEAU_TEST_BENCHMARK_NUMBER_OF_DEFINITIONS;
+		     definition_index++ )
+		{
+			if( narrow_string_compare(
+			     name,
+			     tableau_test_benchmark_definitions[ definition_index ].name,
+			     narrow_string_length( tableau_test_benchmark_definitions[ definition_index ].name ) + 1 ) == 0 )
+			{
+				results[ definition_index ].has_baseline                       = 1;
+				results[ definition_index ].baseline_nanoseconds_per_operation = nanoseconds_per_operation;
+				results[ definition_index ].baseline_allocations_per_operation = allocations_per_operation;
+
+				break;
+			}
+		}
+	}
+	file_stream_close(
+	 file_stream );
+
+	return( 1 );
+}
+
+/* Writes the benchmark results as a baseline
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_benchmark_write_baseline(
+     const system_character_t *filename,
+     tableau_test_benchmark_result_t *results,
+     libcerror_error_t **error )
+{
+	FILE *file_stream       = NULL;
+	static char *function   = "tableau_test_benchmark_write_baseline";
+	size_t definition_index = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"w" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "w" );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open baseline: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	fprintf(
+	 file_stream,
+	 "# Baseline of the library microbenchmarks, written by tableau_test_benchmark -b -w\n"
+	 "# name\tnanoseconds per operation\tallocations per operation\n" );
+
+	for( definition_index = 0;
+	     definition_index < TABLEAU_TEST_BENCHMARK_NUMBER_OF_DEFINITIONS;
+	     definition_index++ )
+	{
+		fprintf(
+		 file_stream,
+		 "%s\t%.1f\t%.2f\n",
+		 tableau_test_benchmark_definitions[ definition_index ].name,
+		 results[ definition_index ].nanoseconds_per_operation,
+		 results[ definition_index ].allocations_per_operation );
+	}
+	file_stream_close(
+	 file_stream );
+
+	return( 1 );
+}
+
+/* Runs a benchmark
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_benchmark_run_definition(
+     tableau_test_benchmark_definition_t *definition,
+     int number_of_iterations,
+     tableau_test_benchmark_result_t *result,
+     libcerror_error_t **error )
+{
+	tableau_test_benchmark_context_t context;
+
+	static char *function            = "tableau_test_benchmark_run_definition";
+	int64_t elapsed_time             = 0;
+	int64_t start_time               = 0;
+	uint64_t number_of_allocations   = 0;
+	int iteration                    = 0;
+
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( tableau_test_benchmark_context_t ) );
+
+	if( tableau_test_benchmark_context_initialize(
+	     &context,
+	     definition->response,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_allocations = tableau_test_benchmark_get_number_of_allocations();
+	start_time            = tableau_test_benchmark_get_time();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( definition->operation(
+		     &context,
+		     iteration,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run benchmark: %s.",
+			 function,
+			 definition->name );
+
+			goto on_error;
+		}
+	}
+	elapsed_time          = tableau_test_benchmark_get_time() - start_time;
+	number_of_allocations = tableau_test_benchmark_get_number_of_allocations() - number_of_allocations;
+
+	if( tableau_test_benchmark_context_free(
+	     &context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free context.",
+		 function );
+
+		goto on_error;
+	}
+	result->nanoseconds_per_operation = (double) elapsed_time / (double) number_of_iterations;
+	result->allocations_per_operation = (double) number_of_allocations / (double) number_of_iterations;
+
+	return( 1 );
+
+on_error:
+	if( context.values_table != NULL )
+	{
+		tableau_test_benchmark_context_free(
+		 &context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs the benchmarks and compares the results against a baseline
+ * Operations that should not allocate memory and allocation counts above
+ * the baseline are failures, timings above the baseline are reported only
+ * since they depend on the host
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_benchmark_run(
+     int number_of_iterations,
+     int print_results,
+     const system_character_t *baseline_filename,
+     const system_character_t *write_filename )
+{
+	tableau_test_benchmark_result_t results[ TABLEAU_TEST_BENCHMARK_NUMBER_OF_DEFINITIONS ];
+
+	tableau_test_benchmark_result_t *result = NULL;
+	libcerror_error_t *error                = NULL;
+	size_t definition_index                 = 0;
+	int number_of_regressions               = 0;
+
+	memory_set(
+	 results,
+	 0,
+	 sizeof( tableau_test_benchmark_result_t ) * TABLEAU_TEST_BENCHMARK_NUMBER_OF_DEFINITIONS );
+
+	if( baseline_filename != NULL )
+	{
+		if( tableau_test_benchmark_read_baseline(
+		     baseline_filename,
+		     results,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( print_results != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Library microbenchmarks: %d iterations per benchmark\n",
+		 number_of_iterations );
+	}
+	for( definition_index = 0;
+	     definition_index < TABLEAU_TEST_BENCHMARK_NUMBER_OF_DEFINITIONS;
+	     definition_index++ )
+	{
+		result = &( results[ definition_index ] );
+
+		if( tableau_test_benchmark_run_definition(
+		     &( tableau_test_benchmark_definitions[ definition_index ] ),
+		     number_of_iterations,
+		     result,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( print_results != 0 )
+		{
+#if defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING )
+			fprintf(
+			 stdout,
+			 "\t%-40s: %10.1f ns/op %8.2f allocations/op",
+			 tableau_test_benchmark_definitions[ definition_index ].name,
+			 result->nanoseconds_per_operation,
+			 result->allocations_per_operation );
+#else
+			fprintf(
+			 stdout,
+			 "\t%-40s: %10.1f ns/op      N/A allocations/op",
+			 tableau_test_benchmark_definitions[ definition_index ].name,
+			 result->nanoseconds_per_operation );
+#endif
+			if( result->has_baseline != 0 )
+			{
+				fprintf(
+				 stdout,
+				 " (baseline: %.1f ns/op, %.2f allocations/op)",
+				 result->baseline_nanoseconds_per_operation,
+				 result->baseline_allocations_per_operation );
+			}
+			fprintf(
+			 stdout,
+			 "\n" );
+		}
+#if defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING )
+		if( ( tableau_test_benchmark_definitions[ definition_index ].allocation_free != 0 )
+		 && ( result->allocations_per_operation > 0.0 ) )
+		{
+			fprintf(
+			 stdout,
+			 "\t%-40s: allocates memory\n",
+			 tableau_test_benchmark_definitions[ definition_index ].name );
+
+			number_of_regressions++;
+		}
+		if( ( result->has_baseline != 0 )
+		 && ( result->allocations_per_operation > ( result->baseline_allocations_per_operation + 0.005 ) ) )
+		{
+			fprintf(
+			 stdout,
+			 "\t%-40s: more allocations than baseline\n",
+			 tableau_test_benchmark_definitions[ definition_index ].name );
+
+			number_of_regressions++;
+		}
+#endif
+		if( ( result->has_baseline != 0 )
+		 && ( result->nanoseconds_per_operation > ( result->baseline_nanoseconds_per_operation * TABLEAU_TEST_BENCHMARK_TIME_FACTOR ) ) )
+		{
+			fprintf(
+			 stdout,
+			 "\t%-40s: slower than baseline\n",
+			 tableau_test_benchmark_definitions[ definition_index ].name );
+		}
+	}
+	if( write_filename != NULL )
+	{
+		if( tableau_test_benchmark_write_baseline(
+		     write_filename,
+		     results,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_regressions",
+	 number_of_regressions,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		TABLEAU_TEST_FPRINT_ERROR(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_character_t *baseline_filename = NULL;
+	system_character_t *write_filename    = NULL;
+	system_integer_t option               = 0;
+	int benchmark                         = 0;
+	int number_of_iterations              = TABLEAU_TEST_BENCHMARK_NUMBER_OF_SMOKE_ITERATIONS;
+
+	while( ( option = tableau_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "bB:w:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				benchmark            = 1;
+				number_of_iterations = TABLEAU_TEST_BENCHMARK_NUMBER_OF_ITERATIONS;
+
+				break;
+
+			case (system_integer_t) 'B':
+				baseline_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'w':
+				write_filename = optarg;
+
+				break;
+		}
+	}
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+	TABLEAU_TEST_RUN(
+	 "benchmark_responses",
+	 tableau_test_benchmark_responses );
+
+	TABLEAU_TEST_RUN_WITH_ARGS(
+	 "benchmark_run",
+	 tableau_test_benchmark_run,
+	 number_of_iterations,
+	 benchmark,
+	 baseline_filename,
+	 write_filename );
+
+#else
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( baseline_filename )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( write_filename )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( benchmark )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( number_of_iterations )
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+}
+
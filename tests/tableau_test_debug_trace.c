@@ -0,0 +1,655 @@
+/*
+ * Library debug trace functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_libtableau.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../libtableau/libtableau_definitions.h"
+#include "../libtableau/libtableau_debug_trace.h"
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) && defined( HAVE_DEBUG_OUTPUT )
+
+/* The stream the flushed records are written to
+ */
+FILE *tableau_test_debug_trace_notify_stream = NULL;
+
+/* Tests the libtableau_debug_trace_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_debug_trace_append_record(
+     void )
+{
+	uint8_t data[ LIBTABLEAU_DEBUG_TRACE_MAXIMUM_DATA_SIZE + 16 ];
+
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0xa5,
+	 LIBTABLEAU_DEBUG_TRACE_MAXIMUM_DATA_SIZE + 16 );
+
+	result = libtableau_debug_trace_flush(
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_debug_trace_append_record(
+	          "tableau_test_debug_trace_append_record",
+	          "event without data.",
+	          NULL,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data that exceeds the maximum data size is truncated
+	 */
+	result = libtableau_debug_trace_append_record(
+	          "tableau_test_debug_trace_append_record",
+	          "event with data:",
+	          data,
+	          LIBTABLEAU_DEBUG_TRACE_MAXIMUM_DATA_SIZE + 16,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_debug_trace_get_number_of_records(
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 2 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_debug_trace_append_record(
+	          NULL,
+	          "event without data.",
+	          NULL,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_debug_trace_append_record(
+	          "tableau_test_debug_trace_append_record",
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_debug_trace_append_record(
+	          "tableau_test_debug_trace_append_record",
+	          "event with data:",
+	          NULL,
+	          16,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_debug_trace_flush(
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_debug_trace_printf function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_debug_trace_printf(
+     void )
+{
+	char notify_output[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	char *string             = NULL;
+	size_t read_count        = 0;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_debug_trace_flush(
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	rewind(
+	 tableau_test_debug_trace_notify_stream );
+
+	/* Test regular cases
+	 */
+	result = libtableau_debug_trace_printf(
+	          "tableau_test_debug_trace_printf",
+	          "unsupported tableau page identifier: 0x%02x.",
+	          0x2a );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a description that exceeds the description size is truncated
+	 */
+	result = libtableau_debug_trace_printf(
+	          "tableau_test_debug_trace_printf",
+	          "%0*d",
+	          LIBTABLEAU_DEBUG_TRACE_DESCRIPTION_SIZE + 16,
+	          0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libtableau_debug_trace_get_number_of_records(
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 2 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_debug_trace_flush(
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the formatted description is part of the flushed output
+	 */
+	fflush(
+	 tableau_test_debug_trace_notify_stream );
+
+	rewind(
+	 tableau_test_debug_trace_notify_stream );
+
+	read_count = fread(
+	              notify_output,
+	              1,
+	              511,
+	              tableau_test_debug_trace_notify_stream );
+
+	notify_output[ read_count ] = 0;
+
+	string = narrow_string_search_string(
+	          notify_output,
+	          "tableau_test_debug_trace_printf: unsupported tableau page identifier: 0x2a.\n",
+	          read_count );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	string = narrow_string_search_string(
+	          notify_output,
+	          "tableau_test_debug_trace_printf: 000000000000000000000000000000000000000000000000000000000000000\n",
+	          read_count );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	/* Test error cases
+	 */
+	result = libtableau_debug_trace_printf(
+	          NULL,
+	          "unsupported tableau page identifier: 0x%02x.",
+	          0x2a );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libtableau_debug_trace_printf(
+	          "tableau_test_debug_trace_printf",
+	          NULL );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_debug_trace_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_debug_trace_get_number_of_records(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int record_number        = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_debug_trace_flush(
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_debug_trace_get_number_of_records(
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the number of records is limited once the buffer is full
+	 */
+	for( record_number = 0;
+	     record_number < ( LIBTABLEAU_DEBUG_TRACE_NUMBER_OF_RECORDS + 5 );
+	     record_number++ )
+	{
+		result = libtableau_debug_trace_append_record(
+		          "tableau_test_debug_trace_get_number_of_records",
+		          "event without data.",
+		          NULL,
+		          0,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libtableau_debug_trace_get_number_of_records(
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 LIBTABLEAU_DEBUG_TRACE_NUMBER_OF_RECORDS );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_debug_trace_get_number_of_records(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_debug_trace_flush(
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_debug_trace_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_debug_trace_flush(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_debug_trace_append_record(
+	          "tableau_test_debug_trace_flush",
+	          "event without data.",
+	          NULL,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_debug_trace_flush(
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_debug_trace_get_number_of_records(
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test flushing without records
+	 */
+	result = libtableau_debug_trace_flush(
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) && defined( HAVE_DEBUG_OUTPUT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) && defined( HAVE_DEBUG_OUTPUT )
+
+	/* The flushed records are written to a temporary file so that
+	 * they are not part of the test output
+	 */
+	tableau_test_debug_trace_notify_stream = tmpfile();
+
+	if( tableau_test_debug_trace_notify_stream == NULL )
+	{
+		return( EXIT_FAILURE );
+	}
+	if( libtableau_notify_set_stream(
+	     tableau_test_debug_trace_notify_stream,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	TABLEAU_TEST_RUN(
+	 "libtableau_debug_trace_append_record",
+	 tableau_test_debug_trace_append_record );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_debug_trace_printf",
+	 tableau_test_debug_trace_printf );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_debug_trace_get_number_of_records",
+	 tableau_test_debug_trace_get_number_of_records );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_debug_trace_flush",
+	 tableau_test_debug_trace_flush );
+
+	libtableau_notify_set_stream(
+	 NULL,
+	 NULL );
+
+	file_stream_close(
+	 tableau_test_debug_trace_notify_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) && defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) && defined( HAVE_DEBUG_OUTPUT )
+
+on_error:
+	libtableau_notify_set_stream(
+	 NULL,
+	 NULL );
+
+	file_stream_close(
+	 tableau_test_debug_trace_notify_stream );
+
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) && defined( HAVE_DEBUG_OUTPUT ) */
+}
+
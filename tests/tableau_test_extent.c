@@ -0,0 +1,398 @@
+/*
+ * Library extent functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_libtableau.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../libtableau/libtableau_definitions.h"
+#include "../libtableau/libtableau_extent.h"
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+/* Checks an extent
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_extent_check(
+     libtableau_extent_t *extent,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     uint8_t type,
+     uint32_t flags )
+{
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 extent->start_sector,
+	 start_sector );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 extent->number_of_sectors,
+	 number_of_sectors );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "type",
+	 extent->type,
+	 type );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "flags",
+	 extent->flags,
+	 flags );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libtableau_extent_plan function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_extent_plan(
+     void )
+{
+	libtableau_extent_t extents[ LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS ];
+
+	libcerror_error_t *error = NULL;
+	int number_of_extents    = 0;
+	int result               = 0;
+
+	/* Test a device that was not queried
+	 */
+	result = libtableau_extent_plan(
+	          extents,
+	          LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS,
+	          &number_of_extents,
+	          1000,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 1 );
+
+	result = tableau_test_extent_check(
+	          &( extents[ 0 ] ),
+	          0,
+	          1000,
+	          LIBTABLEAU_EXTENT_TYPE_USER,
+	          0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a drive with a HPA and a DCO that are hidden by the device
+	 */
+	result = libtableau_extent_plan(
+	          extents,
+	          LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS,
+	          &number_of_extents,
+	          1000,
+	          1000,
+	          1200,
+	          1500,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 3 );
+
+	result = tableau_test_extent_check(
+	          &( extents[ 0 ] ),
+	          0,
+	          1000,
+	          LIBTABLEAU_EXTENT_TYPE_USER,
+	          0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = tableau_test_extent_check(
+	          &( extents[ 1 ] ),
+	          1000,
+	          200,
+	          LIBTABLEAU_EXTENT_TYPE_HPA,
+	          LIBTABLEAU_EXTENT_FLAG_IS_INACCESSIBLE );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = tableau_test_extent_check(
+	          &( extents[ 2 ] ),
+	          1200,
+	          300,
+	          LIBTABLEAU_EXTENT_TYPE_DCO,
+	          LIBTABLEAU_EXTENT_FLAG_IS_INACCESSIBLE );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a drive of which the device exposes the HPA and part of the DCO
+	 */
+	result = libtableau_extent_plan(
+	          extents,
+	          LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS,
+	          &number_of_extents,
+	          1300,
+	          1000,
+	          1200,
+	          1500,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 4 );
+
+	result = tableau_test_extent_check(
+	          &( extents[ 1 ] ),
+	          1000,
+	          200,
+	          LIBTABLEAU_EXTENT_TYPE_HPA,
+	          0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = tableau_test_extent_check(
+	          &( extents[ 2 ] ),
+	          1200,
+	          100,
+	          LIBTABLEAU_EXTENT_TYPE_DCO,
+	          0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = tableau_test_extent_check(
+	          &( extents[ 3 ] ),
+	          1300,
+	          200,
+	          LIBTABLEAU_EXTENT_TYPE_DCO,
+	          LIBTABLEAU_EXTENT_FLAG_IS_INACCESSIBLE );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a drive with a DCO but without a HPA of which the device
+	 * reports more sectors than the DCO number of sectors
+	 */
+	result = libtableau_extent_plan(
+	          extents,
+	          LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS,
+	          &number_of_extents,
+	          1600,
+	          1000,
+	          1000,
+	          1500,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 2 );
+
+	result = tableau_test_extent_check(
+	          &( extents[ 1 ] ),
+	          1000,
+	          600,
+	          LIBTABLEAU_EXTENT_TYPE_DCO,
+	          0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libtableau_extent_plan(
+	          NULL,
+	          LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS,
+	          &number_of_extents,
+	          1000,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_extent_plan(
+	          extents,
+	          1,
+	          &number_of_extents,
+	          1000,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_extent_plan(
+	          extents,
+	          LIBTABLEAU_MAXIMUM_NUMBER_OF_EXTENTS,
+	          NULL,
+	          1000,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_extent_plan",
+	 tableau_test_extent_plan );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -28,6 +29,7 @@
 #endif
 
 #include "tableau_test_functions.h"
+#include "tableau_test_getopt.h"
 #include "tableau_test_libcerror.h"
 #include "tableau_test_libtableau.h"
 #include "tableau_test_macros.h"
@@ -44,6 +46,15 @@
 #define TABLEAU_TEST_HANDLE_VERBOSE
  */
 
+/* The allocation budgets of the handle lifecycle
+ * The number of allocations is exact, the sizes are measured with malloc_usable_size
+ * and contain headroom for allocators with a coarser granularity than glibc
+ */
+#define TABLEAU_TEST_HANDLE_INITIALIZE_MAXIMUM_NUMBER_OF_ALLOCATIONS	28
+#define TABLEAU_TEST_HANDLE_INITIALIZE_MAXIMUM_ALLOCATED_SIZE		1536
+#define TABLEAU_TEST_HANDLE_QUERY_MAXIMUM_NUMBER_OF_ALLOCATIONS		22
+#define TABLEAU_TEST_HANDLE_QUERY_MAXIMUM_ALLOCATED_SIZE		768
+
 /* Creates and opens a source handle
  * Returns 1 if successful or -1 on error
  */
@@ -409,6 +420,269 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libtableau_handle_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_signal_abort(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_handle_signal_abort(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "handle->abort",
+	 ( (libtableau_internal_handle_t *) handle )->abort,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_signal_abort(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_set_abort_flag function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_set_abort_flag(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libtableau_handle_t *handle      = NULL;
+	volatile sig_atomic_t abort_flag = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_handle_set_abort_flag(
+	          handle,
+	          &abort_flag,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an abort is signalled through the flag of the caller
+	 */
+	result = libtableau_handle_signal_abort(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "abort_flag",
+	 (int) abort_flag,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "handle->abort",
+	 ( (libtableau_internal_handle_t *) handle )->abort,
+	 0 );
+
+	/* Test that the flag of the handle is restored
+	 */
+	result = libtableau_handle_set_abort_flag(
+	          handle,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_handle_signal_abort(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "handle->abort",
+	 ( (libtableau_internal_handle_t *) handle )->abort,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_set_abort_flag(
+	          NULL,
+	          &abort_flag,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libtableau_handle_open function
  * Returns 1 if successful or 0 if not
  */
@@ -689,17 +963,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libtableau_handle_get_drive_number_of_sectors function
+/* Tests the libtableau_handle_get_timeout function
  * Returns 1 if successful or 0 if not
  */
-int tableau_test_handle_get_drive_number_of_sectors(
+int tableau_test_handle_get_timeout(
      void )
 {
-	libcerror_error_t *error           = NULL;
-	libtableau_handle_t *handle        = NULL;
-	uint32_t drive_number_of_sectors   = 0;
-	int drive_number_of_sectors_is_set = 0;
-	int result                         = 0;
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	uint32_t timeout            = 0;
+	int result                  = 0;
 
 	/* Initialize test
 	 */
@@ -722,27 +995,30 @@ int tableau_test_handle_get_drive_number_of_sectors(
 
 	/* Test regular cases
 	 */
-	result = libtableau_handle_get_drive_number_of_sectors(
+	result = libtableau_handle_get_timeout(
 	          handle,
-	          &drive_number_of_sectors,
+	          &timeout,
 	          &error );
 
-	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	TABLEAU_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	drive_number_of_sectors_is_set = result;
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "timeout",
+	 timeout,
+	 (uint32_t) 5 );
 
 	/* Test error cases
 	 */
-	result = libtableau_handle_get_drive_number_of_sectors(
+	result = libtableau_handle_get_timeout(
 	          NULL,
-	          &drive_number_of_sectors,
+	          &timeout,
 	          &error );
 
 	TABLEAU_TEST_ASSERT_EQUAL_INT(
@@ -757,25 +1033,23 @@ int tableau_test_handle_get_drive_number_of_sectors(
 	libcerror_error_free(
 	 &error );
 
-	if( drive_number_of_sectors_is_set != 0 )
-	{
-		result = libtableau_handle_get_drive_number_of_sectors(
-		          handle,
-		          NULL,
-		          &error );
+	result = libtableau_handle_get_timeout(
+	          handle,
+	          NULL,
+	          &error );
 
-		TABLEAU_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		TABLEAU_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libtableau_handle_free(
@@ -812,17 +1086,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libtableau_handle_get_hpa_number_of_sectors function
+/* Tests the libtableau_handle_set_timeout function
  * Returns 1 if successful or 0 if not
  */
-int tableau_test_handle_get_hpa_number_of_sectors(
+int tableau_test_handle_set_timeout(
      void )
 {
-	libcerror_error_t *error         = NULL;
-	libtableau_handle_t *handle      = NULL;
-	uint32_t hpa_number_of_sectors   = 0;
-	int hpa_number_of_sectors_is_set = 0;
-	int result                       = 0;
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	uint32_t timeout            = 0;
+	int result                  = 0;
 
 	/* Initialize test
 	 */
@@ -845,27 +1118,44 @@ int tableau_test_handle_get_hpa_number_of_sectors(
 
 	/* Test regular cases
 	 */
-	result = libtableau_handle_get_hpa_number_of_sectors(
+	result = libtableau_handle_set_timeout(
 	          handle,
-	          &hpa_number_of_sectors,
+	          30,
 	          &error );
 
-	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	TABLEAU_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	hpa_number_of_sectors_is_set = result;
+	result = libtableau_handle_get_timeout(
+	          handle,
+	          &timeout,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "timeout",
+	 timeout,
+	 (uint32_t) 30 );
 
 	/* Test error cases
 	 */
-	result = libtableau_handle_get_hpa_number_of_sectors(
+	result = libtableau_handle_set_timeout(
 	          NULL,
-	          &hpa_number_of_sectors,
+	          30,
 	          &error );
 
 	TABLEAU_TEST_ASSERT_EQUAL_INT(
@@ -880,25 +1170,40 @@ int tableau_test_handle_get_hpa_number_of_sectors(
 	libcerror_error_free(
 	 &error );
 
-	if( hpa_number_of_sectors_is_set != 0 )
-	{
-		result = libtableau_handle_get_hpa_number_of_sectors(
-		          handle,
-		          NULL,
-		          &error );
+	result = libtableau_handle_set_timeout(
+	          handle,
+	          0,
+	          &error );
 
-		TABLEAU_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		TABLEAU_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_set_timeout(
+	          handle,
+	          (uint32_t) 0xffffffffUL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libtableau_handle_free(
@@ -935,17 +1240,15 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libtableau_handle_get_dco_number_of_sectors function
+/* Tests the libtableau_handle_send_query function
  * Returns 1 if successful or 0 if not
  */
-int tableau_test_handle_get_dco_number_of_sectors(
+int tableau_test_handle_send_query(
      void )
 {
-	libcerror_error_t *error         = NULL;
-	libtableau_handle_t *handle      = NULL;
-	uint32_t dco_number_of_sectors   = 0;
-	int dco_number_of_sectors_is_set = 0;
-	int result                       = 0;
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	int result                  = 0;
 
 	/* Initialize test
 	 */
@@ -966,29 +1269,28 @@ int tableau_test_handle_get_dco_number_of_sectors(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libtableau_handle_get_dco_number_of_sectors(
-	          handle,
-	          &dco_number_of_sectors,
+	result = libtableau_handle_send_query(
+	          NULL,
 	          &error );
 
-	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	TABLEAU_TEST_ASSERT_IS_NULL(
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	dco_number_of_sectors_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
+	/* Test send query on a handle that was not opened
 	 */
-	result = libtableau_handle_get_dco_number_of_sectors(
-	          NULL,
-	          &dco_number_of_sectors,
+	result = libtableau_handle_send_query(
+	          handle,
 	          &error );
 
 	TABLEAU_TEST_ASSERT_EQUAL_INT(
@@ -1003,25 +1305,6 @@ int tableau_test_handle_get_dco_number_of_sectors(
 	libcerror_error_free(
 	 &error );
 
-	if( dco_number_of_sectors_is_set != 0 )
-	{
-		result = libtableau_handle_get_dco_number_of_sectors(
-		          handle,
-		          NULL,
-		          &error );
-
-		TABLEAU_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		TABLEAU_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libtableau_handle_free(
@@ -1058,16 +1341,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libtableau_handle_get_number_of_values function
+/* Tests the libtableau_handle_get_query_durations function
  * Returns 1 if successful or 0 if not
  */
-int tableau_test_handle_get_number_of_values(
+int tableau_test_handle_get_query_durations(
      void )
 {
 	libcerror_error_t *error    = NULL;
 	libtableau_handle_t *handle = NULL;
-	int number_of_values        = 0;
-	int number_of_values_is_set = 0;
+	uint64_t parse_duration     = 0;
+	uint64_t transport_duration = 0;
 	int result                  = 0;
 
 	/* Initialize test
@@ -1091,27 +1374,27 @@ int tableau_test_handle_get_number_of_values(
 
 	/* Test regular cases
 	 */
-	result = libtableau_handle_get_number_of_values(
+	result = libtableau_handle_get_query_durations(
 	          handle,
-	          &number_of_values,
+	          &transport_duration,
+	          &parse_duration,
 	          &error );
 
-	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	TABLEAU_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_values_is_set = result;
-
 	/* Test error cases
 	 */
-	result = libtableau_handle_get_number_of_values(
+	result = libtableau_handle_get_query_durations(
 	          NULL,
-	          &number_of_values,
+	          &transport_duration,
+	          &parse_duration,
 	          &error );
 
 	TABLEAU_TEST_ASSERT_EQUAL_INT(
@@ -1126,25 +1409,42 @@ int tableau_test_handle_get_number_of_values(
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_values_is_set != 0 )
-	{
-		result = libtableau_handle_get_number_of_values(
-		          handle,
-		          NULL,
-		          &error );
+	result = libtableau_handle_get_query_durations(
+	          handle,
+	          NULL,
+	          &parse_duration,
+	          &error );
 
-		TABLEAU_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		TABLEAU_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_query_durations(
+	          handle,
+	          &transport_duration,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
 	result = libtableau_handle_free(
@@ -1181,44 +1481,2754 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libtableau_handle_get_number_of_query_timeouts function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
-#endif
+int tableau_test_handle_get_number_of_query_timeouts(
+     void )
 {
-	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
-	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
-
-	TABLEAU_TEST_RUN(
-	 "libtableau_handle_initialize",
-	 tableau_test_handle_initialize );
+	libcerror_error_t *error          = NULL;
+	libtableau_handle_t *handle       = NULL;
+	uint64_t number_of_query_timeouts = 0;
+	int result                        = 0;
 
-	TABLEAU_TEST_RUN(
-	 "libtableau_handle_free",
-	 tableau_test_handle_free );
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
 
-	/* TODO: add tests for libtableau_handle_query */
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	TABLEAU_TEST_RUN(
-	 "libtableau_handle_get_drive_number_of_sectors",
-	 tableau_test_handle_get_drive_number_of_sectors );
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
 
-	TABLEAU_TEST_RUN(
-	 "libtableau_handle_get_hpa_number_of_sectors",
-	 tableau_test_handle_get_hpa_number_of_sectors );
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	TABLEAU_TEST_RUN(
-	 "libtableau_handle_get_dco_number_of_sectors",
-	 tableau_test_handle_get_dco_number_of_sectors );
+	/* Test regular cases
+	 */
+	result = libtableau_handle_get_number_of_query_timeouts(
+	          handle,
+	          &number_of_query_timeouts,
+	          &error );
 
-	TABLEAU_TEST_RUN(
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_query_timeouts",
+	 number_of_query_timeouts,
+	 (uint64_t) 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_number_of_query_timeouts(
+	          NULL,
+	          &number_of_query_timeouts,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_number_of_query_timeouts(
+	          handle,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_get_number_of_query_sense_errors function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_get_number_of_query_sense_errors(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libtableau_handle_t *handle           = NULL;
+	uint64_t number_of_query_sense_errors = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_handle_get_number_of_query_sense_errors(
+	          handle,
+	          &number_of_query_sense_errors,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_query_sense_errors",
+	 number_of_query_sense_errors,
+	 (uint64_t) 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_number_of_query_sense_errors(
+	          NULL,
+	          &number_of_query_sense_errors,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_number_of_query_sense_errors(
+	          handle,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_enable_trace function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_enable_trace(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_handle_enable_trace(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test enabling a trace that is already enabled
+	 */
+	result = libtableau_handle_enable_trace(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_enable_trace(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_disable_trace function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_disable_trace(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	int number_of_records       = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_handle_enable_trace(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A query on a handle that was not opened is traced as failed
+	 */
+	result = libtableau_handle_query(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_handle_disable_trace(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_handle_get_number_of_trace_records(
+	          handle,
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test disabling a trace that is not enabled
+	 */
+	result = libtableau_handle_disable_trace(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_disable_trace(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_get_number_of_trace_records function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_get_number_of_trace_records(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	int number_of_records       = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_handle_get_number_of_trace_records(
+	          handle,
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_handle_enable_trace(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_handle_query(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_number_of_trace_records(
+	          handle,
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 2 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_number_of_trace_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_number_of_trace_records(
+	          handle,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_get_trace_record_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_get_trace_record_by_index(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	uint64_t end_timestamp      = 0;
+	uint64_t start_timestamp    = 0;
+	uint8_t phase               = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving a record while the trace is disabled
+	 */
+	result = libtableau_handle_get_trace_record_by_index(
+	          handle,
+	          0,
+	          &phase,
+	          &start_timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_enable_trace(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_handle_query(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_handle_get_trace_record_by_index(
+	          handle,
+	          0,
+	          &phase,
+	          &start_timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "phase",
+	 phase,
+	 LIBTABLEAU_TRACE_PHASE_QUERY_START );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_handle_get_trace_record_by_index(
+	          handle,
+	          1,
+	          &phase,
+	          &end_timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "phase",
+	 phase,
+	 LIBTABLEAU_TRACE_PHASE_FAILED );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_LESS_THAN_UINT64(
+	 "start_timestamp",
+	 start_timestamp,
+	 end_timestamp + 1 );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_trace_record_by_index(
+	          NULL,
+	          0,
+	          &phase,
+	          &start_timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_trace_record_by_index(
+	          handle,
+	          2,
+	          &phase,
+	          &start_timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_trace_record_by_index(
+	          handle,
+	          0,
+	          NULL,
+	          &start_timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_trace_record_by_index(
+	          handle,
+	          0,
+	          &phase,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_get_drive_number_of_sectors function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_get_drive_number_of_sectors(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libtableau_handle_t *handle        = NULL;
+	uint32_t drive_number_of_sectors   = 0;
+	int drive_number_of_sectors_is_set = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_handle_get_drive_number_of_sectors(
+	          handle,
+	          &drive_number_of_sectors,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	drive_number_of_sectors_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_drive_number_of_sectors(
+	          NULL,
+	          &drive_number_of_sectors,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( drive_number_of_sectors_is_set != 0 )
+	{
+		result = libtableau_handle_get_drive_number_of_sectors(
+		          handle,
+		          NULL,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_get_hpa_number_of_sectors function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_get_hpa_number_of_sectors(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libtableau_handle_t *handle      = NULL;
+	uint32_t hpa_number_of_sectors   = 0;
+	int hpa_number_of_sectors_is_set = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_handle_get_hpa_number_of_sectors(
+	          handle,
+	          &hpa_number_of_sectors,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	hpa_number_of_sectors_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_hpa_number_of_sectors(
+	          NULL,
+	          &hpa_number_of_sectors,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( hpa_number_of_sectors_is_set != 0 )
+	{
+		result = libtableau_handle_get_hpa_number_of_sectors(
+		          handle,
+		          NULL,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_get_dco_number_of_sectors function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_get_dco_number_of_sectors(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libtableau_handle_t *handle      = NULL;
+	uint32_t dco_number_of_sectors   = 0;
+	int dco_number_of_sectors_is_set = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_handle_get_dco_number_of_sectors(
+	          handle,
+	          &dco_number_of_sectors,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	dco_number_of_sectors_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_dco_number_of_sectors(
+	          NULL,
+	          &dco_number_of_sectors,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( dco_number_of_sectors_is_set != 0 )
+	{
+		result = libtableau_handle_get_dco_number_of_sectors(
+		          handle,
+		          NULL,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_get_number_of_values function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_get_number_of_values(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	int number_of_values        = 0;
+	int number_of_values_is_set = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_handle_get_number_of_values(
+	          handle,
+	          &number_of_values,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_values_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_number_of_values(
+	          NULL,
+	          &number_of_values,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_values_is_set != 0 )
+	{
+		result = libtableau_handle_get_number_of_values(
+		          handle,
+		          NULL,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 512 ];
+
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	ssize_t read_count          = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libtableau_handle_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read buffer from a handle that is not open
+	 */
+	read_count = libtableau_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_get_media_size function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_get_media_size(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	size64_t media_size         = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_media_size(
+	          NULL,
+	          &media_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_media_size(
+	          handle,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get media size of a handle that is not open
+	 */
+	result = libtableau_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_get_number_of_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_get_number_of_extents(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	int number_of_extents       = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_number_of_extents(
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_number_of_extents(
+	          handle,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get number of extents of a handle that is not open
+	 */
+	result = libtableau_handle_get_number_of_extents(
+	          handle,
+	          &number_of_extents,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_get_extent_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_get_extent_by_index(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	size64_t extent_size        = 0;
+	off64_t extent_offset       = 0;
+	uint32_t extent_flags       = 0;
+	uint8_t extent_type         = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_extent_by_index(
+	          NULL,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_type,
+	          &extent_flags,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_extent_by_index(
+	          handle,
+	          0,
+	          NULL,
+	          &extent_size,
+	          &extent_type,
+	          &extent_flags,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_extent_by_index(
+	          handle,
+	          0,
+	          &extent_offset,
+	          NULL,
+	          &extent_type,
+	          &extent_flags,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_extent_by_index(
+	          handle,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          NULL,
+	          &extent_flags,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_extent_by_index(
+	          handle,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_type,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get extent of a handle that is not open
+	 */
+	result = libtableau_handle_get_extent_by_index(
+	          handle,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_type,
+	          &extent_flags,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_handle_get_bytes_per_sector function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_get_bytes_per_sector(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libtableau_handle_t *handle = NULL;
+	uint32_t bytes_per_sector   = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_handle_get_bytes_per_sector(
+	          NULL,
+	          &bytes_per_sector,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_bytes_per_sector(
+	          handle,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get bytes per sector of a handle that is not open
+	 */
+	result = libtableau_handle_get_bytes_per_sector(
+	          handle,
+	          &bytes_per_sector,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING )
+
+/* Tests the allocations of a handle lifecycle without a device
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_lifecycle_allocations(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libtableau_handle_t *handle     = NULL;
+	int64_t allocated_size          = 0;
+	int64_t peak_allocated_size     = 0;
+	uint64_t number_of_allocations  = 0;
+	uint64_t number_of_frees        = 0;
+	int result                      = 0;
+
+	/* Test libtableau_handle_initialize
+	 */
+	tableau_test_memory_accounting_reset();
+
+	result = libtableau_handle_initialize(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_allocations = tableau_test_number_of_allocations;
+	peak_allocated_size   = tableau_test_peak_allocated_size;
+
+	TABLEAU_TEST_ASSERT_LESS_THAN_UINT64(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 (uint64_t) TABLEAU_TEST_HANDLE_INITIALIZE_MAXIMUM_NUMBER_OF_ALLOCATIONS + 1 );
+
+#if defined( HAVE_MALLOC_USABLE_SIZE )
+	TABLEAU_TEST_ASSERT_LESS_THAN_INT64(
+	 "peak_allocated_size",
+	 peak_allocated_size,
+	 (int64_t) TABLEAU_TEST_HANDLE_INITIALIZE_MAXIMUM_ALLOCATED_SIZE + 1 );
+#endif
+
+	/* Test libtableau_handle_free
+	 */
+	result = libtableau_handle_free(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the lifecycle frees every allocation it made
+	 */
+	number_of_frees = tableau_test_number_of_frees;
+	allocated_size  = tableau_test_allocated_size;
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_frees",
+	 number_of_frees,
+	 number_of_allocations );
+
+#if defined( HAVE_MALLOC_USABLE_SIZE )
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "allocated_size",
+	 allocated_size,
+	 (int64_t) 0 );
+#endif
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libtableau_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the allocations of queries of a device
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_query_allocations(
+     const system_character_t *source )
+{
+	libcerror_error_t *error        = NULL;
+	libtableau_handle_t *handle     = NULL;
+	int64_t peak_allocated_size     = 0;
+	uint64_t number_of_allocations  = 0;
+	uint64_t number_of_frees        = 0;
+	int query_index                 = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = tableau_test_handle_open_source(
+	          &handle,
+	          source,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that every query stays within the allocation budget
+	 */
+	for( query_index = 0;
+	     query_index < 8;
+	     query_index++ )
+	{
+		tableau_test_memory_accounting_reset();
+
+		result = libtableau_handle_query(
+		          handle,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_allocations = tableau_test_number_of_allocations;
+		number_of_frees       = tableau_test_number_of_frees;
+		peak_allocated_size   = tableau_test_peak_allocated_size;
+
+		TABLEAU_TEST_ASSERT_LESS_THAN_UINT64(
+		 "number_of_allocations",
+		 number_of_allocations,
+		 (uint64_t) TABLEAU_TEST_HANDLE_QUERY_MAXIMUM_NUMBER_OF_ALLOCATIONS + 1 );
+
+#if defined( HAVE_MALLOC_USABLE_SIZE )
+		TABLEAU_TEST_ASSERT_LESS_THAN_INT64(
+		 "peak_allocated_size",
+		 peak_allocated_size,
+		 (int64_t) TABLEAU_TEST_HANDLE_QUERY_MAXIMUM_ALLOCATED_SIZE + 1 );
+#endif
+		/* A repeated query replaces the values of the previous query
+		 * and should not grow the heap
+		 */
+		if( query_index > 0 )
+		{
+			TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+			 "number_of_frees",
+			 number_of_frees,
+			 number_of_allocations );
+		}
+	}
+	/* Clean up
+	 */
+	result = tableau_test_handle_close_source(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		tableau_test_handle_close_source(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING ) */
+
+/* Tests a query of a device that stalls on its first command
+ * The query that follows the timed out query has to discard the response of
+ * the abandoned command, which the sg driver transfers into its buffers
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_query_stalled(
+     const system_character_t *source )
+{
+	libcerror_error_t *error          = NULL;
+	libtableau_handle_t *handle       = NULL;
+	uint64_t number_of_query_timeouts = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = tableau_test_handle_open_source(
+	          &handle,
+	          source,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_handle_set_timeout(
+	          handle,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a query of which the command is abandoned after the timeout
+	 */
+	result = libtableau_handle_query(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_handle_get_number_of_query_timeouts(
+	          handle,
+	          &number_of_query_timeouts,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_query_timeouts",
+	 number_of_query_timeouts,
+	 (uint64_t) 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a query that is send while the abandoned command is outstanding
+	 */
+	result = libtableau_handle_query(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = tableau_test_handle_close_source(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		tableau_test_handle_close_source(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests a query of a device after an abort was signalled
+ * The abort flag of the handle is cleared when the query starts, an abort
+ * flag of the caller is not
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_handle_query_after_abort(
+     const system_character_t *source )
+{
+	libcerror_error_t *error          = NULL;
+	libtableau_handle_t *handle       = NULL;
+	uint64_t number_of_query_timeouts = 0;
+	volatile sig_atomic_t abort_flag  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = tableau_test_handle_open_source(
+	          &handle,
+	          source,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a query after an abort signalled to the handle
+	 */
+	result = libtableau_handle_signal_abort(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_handle_query(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a query after an abort signalled through the flag of the caller
+	 */
+	result = libtableau_handle_set_abort_flag(
+	          handle,
+	          &abort_flag,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	abort_flag = 1;
+
+	result = libtableau_handle_query(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "abort_flag",
+	 (int) abort_flag,
+	 1 );
+
+	/* An aborted query did not time out
+	 */
+	result = libtableau_handle_get_number_of_query_timeouts(
+	          handle,
+	          &number_of_query_timeouts,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_query_timeouts",
+	 number_of_query_timeouts,
+	 (uint64_t) 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	abort_flag = 0;
+
+	result = libtableau_handle_query(
+	          handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = tableau_test_handle_close_source(
+	          &handle,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		tableau_test_handle_close_source(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+	int source_stalls          = 0;
+
+	while( ( option = tableau_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "s" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) 's':
+				source_stalls = 1;
+
+				break;
+
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_initialize",
+	 tableau_test_handle_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_free",
+	 tableau_test_handle_free );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_signal_abort",
+	 tableau_test_handle_signal_abort );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_set_abort_flag",
+	 tableau_test_handle_set_abort_flag );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_timeout",
+	 tableau_test_handle_get_timeout );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_set_timeout",
+	 tableau_test_handle_set_timeout );
+
+	/* TODO: add tests for libtableau_handle_query */
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_send_query",
+	 tableau_test_handle_send_query );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_query_durations",
+	 tableau_test_handle_get_query_durations );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_number_of_query_timeouts",
+	 tableau_test_handle_get_number_of_query_timeouts );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_number_of_query_sense_errors",
+	 tableau_test_handle_get_number_of_query_sense_errors );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_enable_trace",
+	 tableau_test_handle_enable_trace );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_disable_trace",
+	 tableau_test_handle_disable_trace );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_number_of_trace_records",
+	 tableau_test_handle_get_number_of_trace_records );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_trace_record_by_index",
+	 tableau_test_handle_get_trace_record_by_index );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_drive_number_of_sectors",
+	 tableau_test_handle_get_drive_number_of_sectors );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_hpa_number_of_sectors",
+	 tableau_test_handle_get_hpa_number_of_sectors );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_dco_number_of_sectors",
+	 tableau_test_handle_get_dco_number_of_sectors );
+
+	TABLEAU_TEST_RUN(
 	 "libtableau_handle_get_number_of_values",
 	 tableau_test_handle_get_number_of_values );
 
@@ -1226,6 +4236,61 @@ int main(
 
 	/* TODO: add tests for libtableau_handle_get_value */
 
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_read_buffer_at_offset",
+	 tableau_test_handle_read_buffer_at_offset );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_media_size",
+	 tableau_test_handle_get_media_size );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_bytes_per_sector",
+	 tableau_test_handle_get_bytes_per_sector );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_number_of_extents",
+	 tableau_test_handle_get_number_of_extents );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_get_extent_by_index",
+	 tableau_test_handle_get_extent_by_index );
+
+#if defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING )
+	TABLEAU_TEST_RUN(
+	 "libtableau_handle_lifecycle_allocations",
+	 tableau_test_handle_lifecycle_allocations );
+#endif
+
+	/* The first command to a source that stalls times out
+	 */
+	if( ( source != NULL )
+	 && ( source_stalls != 0 ) )
+	{
+		TABLEAU_TEST_RUN_WITH_ARGS(
+		 "libtableau_handle_query_stalled",
+		 tableau_test_handle_query_stalled,
+		 source );
+	}
+	else if( source != NULL )
+	{
+		TABLEAU_TEST_RUN_WITH_ARGS(
+		 "libtableau_handle_open",
+		 tableau_test_handle_open,
+		 source );
+
+		TABLEAU_TEST_RUN_WITH_ARGS(
+		 "libtableau_handle_query_after_abort",
+		 tableau_test_handle_query_after_abort,
+		 source );
+
+#if defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING )
+		TABLEAU_TEST_RUN_WITH_ARGS(
+		 "libtableau_handle_query_allocations",
+		 tableau_test_handle_query_allocations,
+		 source );
+#endif
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,345 @@
+/*
+ * Library Input/Output (IO) functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_libtableau.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../libtableau/libtableau_io.h"
+#include "../libtableau/libtableau_io_queue.h"
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+/* Tests the libtableau_io_send_command function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_io_send_command(
+     void )
+{
+	uint8_t command[ 6 ];
+	uint8_t response[ 32 ];
+	uint8_t sense[ 32 ];
+
+	libcerror_error_t *error        = NULL;
+	libtableau_io_queue_t *io_queue = NULL;
+	volatile sig_atomic_t abort     = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_io_queue_initialize(
+	          &io_queue,
+	          64,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_io_send_command(
+	          -1,
+	          io_queue,
+	          command,
+	          6,
+	          response,
+	          32,
+	          sense,
+	          32,
+	          5,
+	          1,
+	          &abort,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_io_send_command(
+	          0,
+	          NULL,
+	          command,
+	          6,
+	          response,
+	          32,
+	          sense,
+	          32,
+	          5,
+	          1,
+	          &abort,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_io_send_command(
+	          0,
+	          io_queue,
+	          NULL,
+	          6,
+	          response,
+	          32,
+	          sense,
+	          32,
+	          5,
+	          1,
+	          &abort,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_io_send_command(
+	          0,
+	          io_queue,
+	          command,
+	          6,
+	          NULL,
+	          32,
+	          sense,
+	          32,
+	          5,
+	          1,
+	          &abort,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_io_send_command(
+	          0,
+	          io_queue,
+	          command,
+	          6,
+	          response,
+	          32,
+	          NULL,
+	          32,
+	          5,
+	          1,
+	          &abort,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_io_send_command(
+	          0,
+	          io_queue,
+	          command,
+	          6,
+	          response,
+	          32,
+	          sense,
+	          32,
+	          0,
+	          1,
+	          &abort,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test send command with abort signalled
+	 */
+	abort = 1;
+
+	result = libtableau_io_send_command(
+	          0,
+	          io_queue,
+	          command,
+	          6,
+	          response,
+	          32,
+	          sense,
+	          32,
+	          5,
+	          1,
+	          &abort,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libtableau_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_io_send_command",
+	 tableau_test_io_send_command );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,828 @@
+/*
+ * Library IO queue type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_libtableau.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_memory.h"
+#include "tableau_test_unused.h"
+
+#include "../libtableau/libtableau_definitions.h"
+#include "../libtableau/libtableau_io_queue.h"
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+/* Tests the libtableau_io_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_io_queue_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libtableau_io_queue_t *io_queue = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_TABLEAU_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libtableau_io_queue_initialize(
+	          &io_queue,
+	          64,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_io_queue_initialize(
+	          NULL,
+	          64,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_queue = (libtableau_io_queue_t *) 0x12345678UL;
+
+	result = libtableau_io_queue_initialize(
+	          &io_queue,
+	          64,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_queue = NULL;
+
+	result = libtableau_io_queue_initialize(
+	          &io_queue,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_TABLEAU_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libtableau_io_queue_initialize with malloc failing
+		 */
+		tableau_test_malloc_attempts_before_fail = test_number;
+
+		result = libtableau_io_queue_initialize(
+		          &io_queue,
+		          64,
+		          &error );
+
+		if( tableau_test_malloc_attempts_before_fail != -1 )
+		{
+			tableau_test_malloc_attempts_before_fail = -1;
+
+			if( io_queue != NULL )
+			{
+				libtableau_io_queue_free(
+				 &io_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			TABLEAU_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			TABLEAU_TEST_ASSERT_IS_NULL(
+			 "io_queue",
+			 io_queue );
+
+			TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libtableau_io_queue_initialize with memset failing
+		 */
+		tableau_test_memset_attempts_before_fail = test_number;
+
+		result = libtableau_io_queue_initialize(
+		          &io_queue,
+		          64,
+		          &error );
+
+		if( tableau_test_memset_attempts_before_fail != -1 )
+		{
+			tableau_test_memset_attempts_before_fail = -1;
+
+			if( io_queue != NULL )
+			{
+				libtableau_io_queue_free(
+				 &io_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			TABLEAU_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			TABLEAU_TEST_ASSERT_IS_NULL(
+			 "io_queue",
+			 io_queue );
+
+			TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_TABLEAU_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libtableau_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_io_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_io_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libtableau_io_queue_free(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_io_queue_get_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_io_queue_get_buffer(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libtableau_io_queue_t *io_queue = NULL;
+	uint8_t *buffer                 = NULL;
+	uint8_t *previous_buffer        = NULL;
+	size_t buffer_size              = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_io_queue_initialize(
+	          &io_queue,
+	          64,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_io_queue_get_buffer(
+	          io_queue,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) 64 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the buffer is reused by the next command
+	 */
+	previous_buffer = buffer;
+
+	result = libtableau_io_queue_get_buffer(
+	          io_queue,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "buffer == previous_buffer",
+	 (int) ( buffer == previous_buffer ),
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_io_queue_get_buffer(
+	          NULL,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_io_queue_get_buffer(
+	          io_queue,
+	          NULL,
+	          &buffer_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_io_queue_get_buffer(
+	          io_queue,
+	          &buffer,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libtableau_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_io_queue_abandon_buffer and libtableau_io_queue_release_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_io_queue_abandon_buffer(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libtableau_io_queue_t *io_queue  = NULL;
+	uint8_t *abandoned_buffer        = NULL;
+	uint8_t *buffer                  = NULL;
+	size_t buffer_size               = 0;
+	int command_identifier           = 0;
+	int number_of_abandoned_commands = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_io_queue_initialize(
+	          &io_queue,
+	          64,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an abandoned buffer is not handed out to the next command
+	 */
+	result = libtableau_io_queue_get_buffer(
+	          io_queue,
+	          &abandoned_buffer,
+	          &buffer_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_io_queue_abandon_buffer(
+	          io_queue,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_io_queue_get_buffer(
+	          io_queue,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "buffer == abandoned_buffer",
+	 (int) ( buffer == abandoned_buffer ),
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_io_queue_get_number_of_abandoned_commands(
+	          io_queue,
+	          &number_of_abandoned_commands,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_abandoned_commands",
+	 number_of_abandoned_commands,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test release of a command that was not abandoned
+	 */
+	result = libtableau_io_queue_release_buffer(
+	          io_queue,
+	          2,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test release of the abandoned command
+	 */
+	result = libtableau_io_queue_release_buffer(
+	          io_queue,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_io_queue_get_number_of_abandoned_commands(
+	          io_queue,
+	          &number_of_abandoned_commands,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_abandoned_commands",
+	 number_of_abandoned_commands,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that no command is queued once the maximum number of commands was abandoned
+	 */
+	for( command_identifier = 0;
+	     command_identifier < LIBTABLEAU_IO_QUEUE_MAXIMUM_NUMBER_OF_ABANDONED_COMMANDS;
+	     command_identifier++ )
+	{
+		result = libtableau_io_queue_get_buffer(
+		          io_queue,
+		          &buffer,
+		          &buffer_size,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libtableau_io_queue_abandon_buffer(
+		          io_queue,
+		          command_identifier,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libtableau_io_queue_get_buffer(
+	          io_queue,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test empty once the file descriptor was closed
+	 */
+	result = libtableau_io_queue_empty(
+	          io_queue,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_io_queue_get_number_of_abandoned_commands(
+	          io_queue,
+	          &number_of_abandoned_commands,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_abandoned_commands",
+	 number_of_abandoned_commands,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_io_queue_abandon_buffer(
+	          NULL,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_io_queue_release_buffer(
+	          NULL,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libtableau_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_io_queue_initialize",
+	 tableau_test_io_queue_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_io_queue_free",
+	 tableau_test_io_queue_free );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_io_queue_get_buffer",
+	 tableau_test_io_queue_get_buffer );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_io_queue_abandon_buffer",
+	 tableau_test_io_queue_abandon_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -25,6 +25,10 @@
 #include <stdlib.h>
 #endif
 
+#if defined( HAVE_MALLOC_H )
+#include <malloc.h>
+#endif
+
 #if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
 #define __USE_GNU
 #include <dlfcn.h>
@@ -33,12 +37,104 @@
 
 #include "tableau_test_memory.h"
 
-#if defined( HAVE_TABLEAU_TEST_MEMORY )
+#if defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING )
+
+/* The number of successful malloc and realloc calls
+ */
+uint64_t tableau_test_number_of_allocations = 0;
+
+/* The number of free calls of non-NULL pointers
+ */
+uint64_t tableau_test_number_of_frees = 0;
+
+/* The allocated size relative to the last reset
+ * This can become negative when memory allocated before the reset is freed
+ */
+int64_t tableau_test_allocated_size = 0;
+
+/* The peak allocated size relative to the last reset
+ */
+int64_t tableau_test_peak_allocated_size = 0;
+
+/* Resets the memory accounting
+ */
+void tableau_test_memory_accounting_reset(
+      void )
+{
+	__atomic_store_n(
+	 &tableau_test_number_of_allocations,
+	 0,
+	 __ATOMIC_RELAXED );
+
+	__atomic_store_n(
+	 &tableau_test_number_of_frees,
+	 0,
+	 __ATOMIC_RELAXED );
+
+	__atomic_store_n(
+	 &tableau_test_allocated_size,
+	 0,
+	 __ATOMIC_RELAXED );
+
+	__atomic_store_n(
+	 &tableau_test_peak_allocated_size,
+	 0,
+	 __ATOMIC_RELAXED );
+}
+
+/* Retrieves the size of an allocation
+ * Returns the size or 0 if not available
+ */
+static int64_t tableau_test_memory_get_allocation_size(
+                void *ptr )
+{
+#if defined( HAVE_MALLOC_USABLE_SIZE )
+	return( (int64_t) malloc_usable_size(
+	                   ptr ) );
+#else
+	return( 0 );
+#endif
+}
+
+/* Accounts for a change in the allocated size and updates the peak
+ */
+static void tableau_test_memory_account_size(
+             int64_t size )
+{
+	int64_t allocated_size      = 0;
+	int64_t peak_allocated_size = 0;
+
+	allocated_size = __atomic_add_fetch(
+	                  &tableau_test_allocated_size,
+	                  size,
+	                  __ATOMIC_RELAXED );
+
+	peak_allocated_size = __atomic_load_n(
+	                       &tableau_test_peak_allocated_size,
+	                       __ATOMIC_RELAXED );
+
+	while( allocated_size > peak_allocated_size )
+	{
+		if( __atomic_compare_exchange_n(
+		     &tableau_test_peak_allocated_size,
+		     &peak_allocated_size,
+		     allocated_size,
+		     0,
+		     __ATOMIC_RELAXED,
+		     __ATOMIC_RELAXED ) != 0 )
+		{
+			break;
+		}
+	}
+}
 
 static void *(*tableau_test_real_malloc)(size_t) = NULL;
+
+#if defined( HAVE_TABLEAU_TEST_MEMORY )
 int tableau_test_malloc_attempts_before_fail     = -1;
+#endif
 
-/* Custom malloc for testing memory error cases
+/* Custom malloc for testing memory error cases and accounting allocations
  * Note this function might fail if compiled with optimization
  * Returns a pointer to newly allocated data or NULL
  */
@@ -58,6 +154,7 @@ void *malloc(
 			return( NULL );
 		}
 	}
+#if defined( HAVE_TABLEAU_TEST_MEMORY )
 	if( tableau_test_malloc_attempts_before_fail == 0 )
 	{
 		tableau_test_malloc_attempts_before_fail = -1;
@@ -68,12 +165,61 @@ void *malloc(
 	{
 		tableau_test_malloc_attempts_before_fail--;
 	}
+#endif
 	ptr = tableau_test_real_malloc(
 	       size );
 
+	if( ptr != NULL )
+	{
+		__atomic_fetch_add(
+		 &tableau_test_number_of_allocations,
+		 1,
+		 __ATOMIC_RELAXED );
+
+		tableau_test_memory_account_size(
+		 tableau_test_memory_get_allocation_size(
+		  ptr ) );
+	}
 	return( ptr );
 }
 
+static void (*tableau_test_real_free)(void *) = NULL;
+
+/* Custom free for counting frees
+ */
+void free(
+      void *ptr )
+{
+	if( tableau_test_real_free == NULL )
+	{
+		tableau_test_real_free = dlsym(
+		                          RTLD_NEXT,
+		                          "free" );
+
+		if( tableau_test_real_free == NULL )
+		{
+			return;
+		}
+	}
+	if( ptr != NULL )
+	{
+		__atomic_fetch_add(
+		 &tableau_test_number_of_frees,
+		 1,
+		 __ATOMIC_RELAXED );
+
+		tableau_test_memory_account_size(
+		 -tableau_test_memory_get_allocation_size(
+		   ptr ) );
+	}
+	tableau_test_real_free(
+	 ptr );
+}
+
+#endif /* defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING ) */
+
+#if defined( HAVE_TABLEAU_TEST_MEMORY )
+
 static void *(*tableau_test_real_memcpy)(void *, const void *, size_t) = NULL;
 int tableau_test_memcpy_attempts_before_fail                           = -1;
 
@@ -156,10 +302,17 @@ void *memset(
 	return( ptr );
 }
 
+#endif /* defined( HAVE_TABLEAU_TEST_MEMORY ) */
+
+#if defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING )
+
 static void *(*tableau_test_real_realloc)(void *, size_t) = NULL;
+
+#if defined( HAVE_TABLEAU_TEST_MEMORY )
 int tableau_test_realloc_attempts_before_fail             = -1;
+#endif
 
-/* Custom realloc for testing memory error cases
+/* Custom realloc for testing memory error cases and accounting allocations
  * Note this function might fail if compiled with optimization
  * Returns a pointer to reallocated data or NULL
  */
@@ -167,6 +320,8 @@ void *realloc(
        void *ptr,
        size_t size )
 {
+	int64_t previous_size = 0;
+
 	if( tableau_test_real_realloc == NULL )
 	{
 		tableau_test_real_realloc = dlsym(
@@ -178,6 +333,7 @@ void *realloc(
 			return( NULL );
 		}
 	}
+#if defined( HAVE_TABLEAU_TEST_MEMORY )
 	if( tableau_test_realloc_attempts_before_fail == 0 )
 	{
 		tableau_test_realloc_attempts_before_fail = -1;
@@ -188,12 +344,29 @@ void *realloc(
 	{
 		tableau_test_realloc_attempts_before_fail--;
 	}
+#endif
+	if( ptr != NULL )
+	{
+		previous_size = tableau_test_memory_get_allocation_size(
+		                 ptr );
+	}
 	ptr = tableau_test_real_realloc(
 	       ptr,
 	       size );
 
+	if( ptr != NULL )
+	{
+		__atomic_fetch_add(
+		 &tableau_test_number_of_allocations,
+		 1,
+		 __ATOMIC_RELAXED );
+
+		tableau_test_memory_account_size(
+		 tableau_test_memory_get_allocation_size(
+		  ptr ) - previous_size );
+	}
 	return( ptr );
 }
 
-#endif /* defined( HAVE_TABLEAU_TEST_MEMORY ) */
+#endif /* defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING ) */
 
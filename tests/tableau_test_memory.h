@@ -23,6 +23,7 @@
 #define _TABLEAU_TEST_MEMORY_H
 
 #include <common.h>
+#include <types.h>
 
 #if defined( __cplusplus )
 extern "C" {
@@ -46,6 +47,15 @@ extern "C" {
 #endif /* defined( __x86__ ) || defined( __x86_64__ ) */
 #endif /* defined( HAVE_MEMORY_TESTS ) */
 
+/* Memory accounting cannot be used in combination with DLLs or CygWin and requires dlsym */
+#if !defined( LIBTABLEAU_DLL_IMPORT ) && !defined( __CYGWIN__ )
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
+
+#define HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING	1
+
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) */
+#endif /* !defined( LIBTABLEAU_DLL_IMPORT ) && !defined( __CYGWIN__ ) */
+
 #if defined( HAVE_TABLEAU_TEST_MEMORY )
 
 extern int tableau_test_malloc_attempts_before_fail;
@@ -58,6 +68,21 @@ extern int tableau_test_realloc_attempts_before_fail;
 
 #endif /* defined( HAVE_TABLEAU_TEST_MEMORY ) */
 
+#if defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING )
+
+extern uint64_t tableau_test_number_of_allocations;
+
+extern uint64_t tableau_test_number_of_frees;
+
+extern int64_t tableau_test_allocated_size;
+
+extern int64_t tableau_test_peak_allocated_size;
+
+void tableau_test_memory_accounting_reset(
+      void );
+
+#endif /* defined( HAVE_TABLEAU_TEST_MEMORY_ACCOUNTING ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -190,6 +190,50 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libtableau_notify_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_notify_flush(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libtableau_notify_flush(
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Flushing without buffered debug output succeeds
+	 */
+	result = libtableau_notify_flush(
+	          NULL );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -221,6 +265,10 @@ int main(
 	 "libtableau_notify_stream_close",
 	 tableau_test_notify_stream_close )
 
+	TABLEAU_TEST_RUN(
+	 "libtableau_notify_flush",
+	 tableau_test_notify_flush )
+
 	return( EXIT_SUCCESS );
 
 on_error:
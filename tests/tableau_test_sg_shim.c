@@ -0,0 +1,2343 @@
+/*
+ * Preloadable emulator of Tableau write blockers on SCSI generic (sg) devices
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* The shim is loaded into an unmodified tool with LD_PRELOAD and interposes
+ * open, close, ioctl, read, write and poll. The devices it emulates are read
+ * from the drive model file referenced by the TABLEAU_TEST_SG_SHIM_MODEL
+ * environment variable, which consists of name and value lines separated by
+ * whitespace, where # starts a comment:
+ *
+ * device                 the path of the emulated device, e.g. /dev/sg90,
+ *                        starts the definition of a device
+ * number_of_sectors      the number of sectors accessible to the host
+ * hpa_number_of_sectors  the number of sectors up to and including the HPA
+ * dco_number_of_sectors  the number of sectors up to and including the DCO
+ * bytes_per_sector       the number of bytes per sector, 512 by default
+ * dco_challenge_key      the DCO challenge key as 8 hexadecimal digits
+ * bridge_serial_number   the bridge serial number as 16 hexadecimal digits
+ * bridge_vendor, bridge_model, bridge_firmware_date, bridge_firmware_time,
+ * drive_vendor, drive_model, drive_serial_number, drive_revision_number
+ *                        the strings reported by a Tableau query
+ * channel_type           pata, sata (default), scsi or usb
+ * write_permitted        1 to report a write permitting bridge
+ * command_latency        the time a command takes in microseconds
+ * query_latency          the time a Tableau query takes in microseconds,
+ *                        the command latency by default
+ * throughput             the read throughput in bytes per second, where 0
+ *                        is unlimited
+ * stalled_commands       the number of commands, from the first, that stall
+ *                        and complete at one and a half times their timeout
+ * maximum_transfer_size  the maximum number of bytes per command
+ * bad_sectors            a range of unreadable sectors as first-last and an
+ *                        optional number of failing reads after which the
+ *                        range becomes readable
+ * data                   an image file that provides the sector data, the
+ *                        sector number repeated as a 64-bit little-endian
+ *                        value is used otherwise
+ *
+ * The device executes its commands one at a time, hence the latency and
+ * throughput of concurrent commands add up. A command that takes longer than
+ * its timeout completes at the timeout with a time out host status.
+ *
+ * Like the sg driver does for indirect IO, the data and sense of a queued
+ * command are transferred into the buffers of the caller when its response
+ * is read, not when the command is queued.
+ */
+
+#include <common.h>
+
+/* The interposed functions are defined against the plain declarations of
+ * the system headers, not their fortified or large file variants
+ */
+#if defined( _FORTIFY_SOURCE )
+#undef _FORTIFY_SOURCE
+#endif
+
+#if defined( _FILE_OFFSET_BITS )
+#undef _FILE_OFFSET_BITS
+#endif
+
+#if !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <scsi/sg.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+
+#if defined( HAVE_LINUX_FS_H )
+#include <linux/fs.h>
+#endif
+
+#define TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_DEVICES			16
+#define TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_BAD_SECTORS_RANGES	32
+#define TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_FILE_DESCRIPTORS		1024
+#define TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_REQUESTS			16
+
+/* The sg driver version reported by SG_GET_VERSION_NUM
+ */
+#define TABLEAU_TEST_SG_SHIM_SG_VERSION					30536
+
+/* The timeout the sg driver uses when a command does not specify one
+ */
+#define TABLEAU_TEST_SG_SHIM_DEFAULT_TIMEOUT				60000
+
+#define TABLEAU_TEST_SG_SHIM_QUERY_RESPONSE_SIZE			152
+
+typedef struct tableau_test_sg_shim_bad_sectors_range tableau_test_sg_shim_bad_sectors_range_t;
+
+struct tableau_test_sg_shim_bad_sectors_range
+{
+	/* The first sector
+	 */
+	uint64_t first_sector;
+
+	/* The last sector
+	 */
+	uint64_t last_sector;
+
+	/* The number of reads that still fail, or -1 if the range never becomes readable
+	 */
+	int number_of_failing_reads;
+};
+
+typedef struct tableau_test_sg_shim_device tableau_test_sg_shim_device_t;
+
+struct tableau_test_sg_shim_device
+{
+	/* The path
+	 */
+	char path[ 256 ];
+
+	/* The number of sectors accessible to the host
+	 */
+	uint64_t number_of_sectors;
+
+	/* The number of HPA sectors
+	 */
+	uint64_t hpa_number_of_sectors;
+
+	/* The number of DCO sectors
+	 */
+	uint64_t dco_number_of_sectors;
+
+	/* The number of bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The DCO challenge key
+	 */
+	uint32_t dco_challenge_key;
+
+	/* The bridge serial number
+	 */
+	uint8_t bridge_serial_number[ 8 ];
+
+	/* The strings of the Tableau query response
+	 */
+	char bridge_vendor[ 9 ];
+	char bridge_model[ 9 ];
+	char bridge_firmware_date[ 13 ];
+	char bridge_firmware_time[ 13 ];
+	char drive_vendor[ 9 ];
+	char drive_model[ 29 ];
+	char drive_serial_number[ 21 ];
+	char drive_revision_number[ 9 ];
+
+	/* The channel type
+	 */
+	uint8_t channel_type;
+
+	/* Value to indicate the bridge permits writes
+	 */
+	uint8_t write_permitted;
+
+	/* The command latency in microseconds
+	 */
+	uint64_t command_latency;
+
+	/* The query latency in microseconds
+	 */
+	uint64_t query_latency;
+
+	/* The throughput in bytes per second
+	 */
+	uint64_t throughput;
+
+	/* The maximum transfer size
+	 */
+	int maximum_transfer_size;
+
+	/* The bad sectors ranges
+	 */
+	tableau_test_sg_shim_bad_sectors_range_t bad_sectors_ranges[ TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_BAD_SECTORS_RANGES ];
+
+	/* The number of bad sectors ranges
+	 */
+	int number_of_bad_sectors_ranges;
+
+	/* The file descriptor of the image file that provides the sector data
+	 */
+	int data_file_descriptor;
+
+	/* The number of commands that still stall
+	 */
+	uint64_t number_of_stalled_commands;
+
+	/* The time in microseconds the device finishes its last command
+	 */
+	uint64_t busy_time;
+};
+
+typedef struct tableau_test_sg_shim_request tableau_test_sg_shim_request_t;
+
+struct tableau_test_sg_shim_request
+{
+	/* The header of the completed command
+	 */
+	sg_io_hdr_t header;
+
+	/* The data transferred from the device, which is copied into
+	 * the data buffer of the caller when the response is read
+	 * The data is mapped instead of allocated so that the allocations
+	 * accounted by a test program are not affected
+	 */
+	uint8_t *data;
+
+	/* The sense data, which is copied into the sense buffer of
+	 * the caller when the response is read
+	 */
+	uint8_t sense[ 256 ];
+
+	/* The time in microseconds the command completes
+	 */
+	uint64_t completion_time;
+};
+
+typedef struct tableau_test_sg_shim_file tableau_test_sg_shim_file_t;
+
+struct tableau_test_sg_shim_file
+{
+	/* The emulated device, NULL if the file descriptor is not emulated
+	 */
+	tableau_test_sg_shim_device_t *device;
+
+	/* The requests queued with write in order of completion
+	 */
+	tableau_test_sg_shim_request_t requests[ TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_REQUESTS ];
+
+	/* The number of queued requests
+	 */
+	int number_of_requests;
+};
+
+static int (*tableau_test_sg_shim_real_open)(const char *, int, ...)   = NULL;
+static int (*tableau_test_sg_shim_real_close)(int)                     = NULL;
+static int (*tableau_test_sg_shim_real_ioctl)(int, unsigned long, ...) = NULL;
+static ssize_t (*tableau_test_sg_shim_real_read)(int, void *, size_t)  = NULL;
+static ssize_t (*tableau_test_sg_shim_real_write)(int, const void *, size_t) = NULL;
+static int (*tableau_test_sg_shim_real_poll)(struct pollfd *, nfds_t, int) = NULL;
+
+static tableau_test_sg_shim_device_t tableau_test_sg_shim_devices[ TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_DEVICES ];
+static int tableau_test_sg_shim_number_of_devices = 0;
+
+static tableau_test_sg_shim_file_t tableau_test_sg_shim_files[ TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_FILE_DESCRIPTORS ];
+
+/* The lock that serializes access to the devices and files, since the shim
+ * cannot depend on the threading library of the tool it is loaded into
+ */
+static int tableau_test_sg_shim_lock_value  = 0;
+static int tableau_test_sg_shim_initialized = 0;
+
+/* Acquires the shim lock
+ */
+static void tableau_test_sg_shim_lock(
+             void )
+{
+	while( __atomic_exchange_n(
+	        &tableau_test_sg_shim_lock_value,
+	        1,
+	        __ATOMIC_ACQUIRE ) != 0 )
+	{
+		sched_yield();
+	}
+}
+
+/* Releases the shim lock
+ */
+static void tableau_test_sg_shim_unlock(
+             void )
+{
+	__atomic_store_n(
+	 &tableau_test_sg_shim_lock_value,
+	 0,
+	 __ATOMIC_RELEASE );
+}
+
+/* Retrieves the monotonic time in microseconds
+ * Returns the time
+ */
+static uint64_t tableau_test_sg_shim_get_time(
+                 void )
+{
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000 ) + ( (uint64_t) time_value.tv_nsec / 1000 ) );
+}
+
+/* Sleeps until the monotonic time in microseconds
+ */
+static void tableau_test_sg_shim_sleep_until(
+             uint64_t wake_time )
+{
+	struct timespec time_value;
+
+	time_value.tv_sec  = (time_t) ( wake_time / 1000000 );
+	time_value.tv_nsec = (long) ( ( wake_time % 1000000 ) * 1000 );
+
+	while( clock_nanosleep(
+	        CLOCK_MONOTONIC,
+	        TIMER_ABSTIME,
+	        &time_value,
+	        NULL ) == EINTR )
+	{
+	}
+}
+
+/* Copies a string value of the drive model file
+ */
+static void tableau_test_sg_shim_copy_string(
+             char *string,
+             size_t string_size,
+             const char *value )
+{
+	size_t value_length = narrow_string_length(
+	                       value );
+
+	if( value_length >= string_size )
+	{
+		value_length = string_size - 1;
+	}
+	memory_copy(
+	 string,
+	 value,
+	 value_length );
+
+	string[ value_length ] = 0;
+}
+
+/* Copies a string into a space padded field of the Tableau query response
+ */
+static void tableau_test_sg_shim_copy_field(
+             uint8_t *field,
+             size_t field_size,
+             const char *string )
+{
+	size_t string_length = narrow_string_length(
+	                        string );
+
+	if( string_length > field_size )
+	{
+		string_length = field_size;
+	}
+	memory_set(
+	 field,
+	 ' ',
+	 field_size );
+
+	memory_copy(
+	 field,
+	 string,
+	 string_length );
+}
+
+/* Parses a value of hexadecimal digits into a big-endian byte array
+ * Returns 1 if successful or -1 on error
+ */
+static int tableau_test_sg_shim_parse_hexadecimal(
+            const char *value,
+            uint8_t *data,
+            size_t data_size )
+{
+	size_t value_index = 0;
+	uint8_t digit      = 0;
+	char character     = 0;
+
+	if( narrow_string_length(
+	     value ) != ( data_size * 2 ) )
+	{
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < ( data_size * 2 );
+	     value_index++ )
+	{
+		character = value[ value_index ];
+
+		if( ( character >= '0' )
+		 && ( character <= '9' ) )
+		{
+			digit = (uint8_t) ( character - '0' );
+		}
+		else if( ( character >= 'a' )
+		      && ( character <= 'f' ) )
+		{
+			digit = (uint8_t) ( character - 'a' + 10 );
+		}
+		else if( ( character >= 'A' )
+		      && ( character <= 'F' ) )
+		{
+			digit = (uint8_t) ( character - 'A' + 10 );
+		}
+		else
+		{
+			return( -1 );
+		}
+		if( ( value_index % 2 ) == 0 )
+		{
+			data[ value_index / 2 ] = (uint8_t) ( digit << 4 );
+		}
+		else
+		{
+			data[ value_index / 2 ] |= digit;
+		}
+	}
+	return( 1 );
+}
+
+/* Parses a decimal value
+ * Returns 1 if successful or -1 on error
+ */
+static int tableau_test_sg_shim_parse_decimal(
+            const char *value,
+            uint64_t *value_64bit )
+{
+	char *value_end = NULL;
+
+	if( ( value[ 0 ] < '0' )
+	 || ( value[ 0 ] > '9' ) )
+	{
+		return( -1 );
+	}
+	errno = 0;
+
+	*value_64bit = (uint64_t) strtoull(
+	                           value,
+	                           &value_end,
+	                           10 );
+
+	if( ( errno != 0 )
+	 || ( *value_end != 0 ) )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Initializes a device with the values of the default drive model
+ */
+static void tableau_test_sg_shim_device_initialize(
+             tableau_test_sg_shim_device_t *device,
+             const char *path )
+{
+	memory_set(
+	 device,
+	 0,
+	 sizeof( tableau_test_sg_shim_device_t ) );
+
+	tableau_test_sg_shim_copy_string(
+	 device->path,
+	 sizeof( device->path ),
+	 path );
+
+	device->number_of_sectors     = 2048;
+	device->bytes_per_sector      = 512;
+	device->dco_challenge_key     = 0x5ca1ab1eUL;
+	device->channel_type          = 0x01;
+	device->maximum_transfer_size = 1048576;
+	device->data_file_descriptor  = -1;
+
+	tableau_test_sg_shim_copy_string(
+	 device->bridge_vendor,
+	 sizeof( device->bridge_vendor ),
+	 "Tableau" );
+
+	tableau_test_sg_shim_copy_string(
+	 device->bridge_model,
+	 sizeof( device->bridge_model ),
+	 "T35u" );
+
+	tableau_test_sg_shim_copy_string(
+	 device->bridge_firmware_date,
+	 sizeof( device->bridge_firmware_date ),
+	 "Jun 27 2026" );
+
+	tableau_test_sg_shim_copy_string(
+	 device->bridge_firmware_time,
+	 sizeof( device->bridge_firmware_time ),
+	 "12:00:00" );
+
+	tableau_test_sg_shim_copy_string(
+	 device->drive_vendor,
+	 sizeof( device->drive_vendor ),
+	 "Emulated" );
+
+	tableau_test_sg_shim_copy_string(
+	 device->drive_model,
+	 sizeof( device->drive_model ),
+	 "Emulated drive" );
+
+	tableau_test_sg_shim_copy_string(
+	 device->drive_revision_number,
+	 sizeof( device->drive_revision_number ),
+	 "1.0" );
+}
+
+/* Finalizes the drive model of a device, where a HPA or DCO that is not
+ * specified does not hide any sectors
+ */
+static void tableau_test_sg_shim_device_finalize(
+             tableau_test_sg_shim_device_t *device,
+             uint8_t query_latency_set )
+{
+	if( device->hpa_number_of_sectors < device->number_of_sectors )
+	{
+		device->hpa_number_of_sectors = device->number_of_sectors;
+	}
+	if( device->dco_number_of_sectors < device->hpa_number_of_sectors )
+	{
+		device->dco_number_of_sectors = device->hpa_number_of_sectors;
+	}
+	if( query_latency_set == 0 )
+	{
+		device->query_latency = device->command_latency;
+	}
+}
+
+/* Sets a value of the drive model of a device
+ * Returns 1 if successful or -1 on error
+ */
+static int tableau_test_sg_shim_device_set_value(
+            tableau_test_sg_shim_device_t *device,
+            const char *name,
+            const char *value )
+{
+	uint8_t key_data[ 4 ];
+
+	tableau_test_sg_shim_bad_sectors_range_t *bad_sectors_range = NULL;
+	char *value_end                                             = NULL;
+	uint64_t value_64bit                                        = 0;
+
+	if( narrow_string_compare(
+	     name,
+	     "bridge_serial_number",
+	     21 ) == 0 )
+	{
+		return( tableau_test_sg_shim_parse_hexadecimal(
+		         value,
+		         device->bridge_serial_number,
+		         8 ) );
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "dco_challenge_key",
+	          18 ) == 0 )
+	{
+		if( tableau_test_sg_shim_parse_hexadecimal(
+		     value,
+		     key_data,
+		     4 ) != 1 )
+		{
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 key_data,
+		 device->dco_challenge_key );
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "bridge_vendor",
+	          14 ) == 0 )
+	{
+		tableau_test_sg_shim_copy_string(
+		 device->bridge_vendor,
+		 sizeof( device->bridge_vendor ),
+		 value );
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "bridge_model",
+	          13 ) == 0 )
+	{
+		tableau_test_sg_shim_copy_string(
+		 device->bridge_model,
+		 sizeof( device->bridge_model ),
+		 value );
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "bridge_firmware_date",
+	          21 ) == 0 )
+	{
+		tableau_test_sg_shim_copy_string(
+		 device->bridge_firmware_date,
+		 sizeof( device->bridge_firmware_date ),
+		 value );
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "bridge_firmware_time",
+	          21 ) == 0 )
+	{
+		tableau_test_sg_shim_copy_string(
+		 device->bridge_firmware_time,
+		 sizeof( device->bridge_firmware_time ),
+		 value );
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "drive_vendor",
+	          13 ) == 0 )
+	{
+		tableau_test_sg_shim_copy_string(
+		 device->drive_vendor,
+		 sizeof( device->drive_vendor ),
+		 value );
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "drive_model",
+	          12 ) == 0 )
+	{
+		tableau_test_sg_shim_copy_string(
+		 device->drive_model,
+		 sizeof( device->drive_model ),
+		 value );
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "drive_serial_number",
+	          20 ) == 0 )
+	{
+		tableau_test_sg_shim_copy_string(
+		 device->drive_serial_number,
+		 sizeof( device->drive_serial_number ),
+		 value );
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "drive_revision_number",
+	          22 ) == 0 )
+	{
+		tableau_test_sg_shim_copy_string(
+		 device->drive_revision_number,
+		 sizeof( device->drive_revision_number ),
+		 value );
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "channel_type",
+	          13 ) == 0 )
+	{
+		if( narrow_string_compare(
+		     value,
+		     "pata",
+		     5 ) == 0 )
+		{
+			device->channel_type = 0x00;
+		}
+		else if( narrow_string_compare(
+		          value,
+		          "sata",
+		          5 ) == 0 )
+		{
+			device->channel_type = 0x01;
+		}
+		else if( narrow_string_compare(
+		          value,
+		          "scsi",
+		          5 ) == 0 )
+		{
+			device->channel_type = 0x02;
+		}
+		else if( narrow_string_compare(
+		          value,
+		          "usb",
+		          4 ) == 0 )
+		{
+			device->channel_type = 0x03;
+		}
+		else
+		{
+			return( -1 );
+		}
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "data",
+	          5 ) == 0 )
+	{
+		if( device->data_file_descriptor != -1 )
+		{
+			return( -1 );
+		}
+		device->data_file_descriptor = tableau_test_sg_shim_real_open(
+		                                value,
+		                                O_RDONLY | O_CLOEXEC | O_LARGEFILE );
+
+		if( device->data_file_descriptor == -1 )
+		{
+			return( -1 );
+		}
+	}
+	else if( narrow_string_compare(
+	          name,
+	          "bad_sectors",
+	          12 ) == 0 )
+	{
+		if( device->number_of_bad_sectors_ranges >= TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_BAD_SECTORS_RANGES )
+		{
+			return( -1 );
+		}
+		bad_sectors_range = &( device->bad_sectors_ranges[ device->number_of_bad_sectors_ranges ] );
+
+		errno = 0;
+
+		bad_sectors_range->first_sector = (uint64_t) strtoull(
+		                                              value,
+		                                              &value_end,
+		                                              10 );
+
+		if( ( errno != 0 )
+		 || ( value_end == value )
+		 || ( *value_end != '-' ) )
+		{
+			return( -1 );
+		}
+		value = &( value_end[ 1 ] );
+
+		bad_sectors_range->last_sector = (uint64_t) strtoull(
+		                                             value,
+		                                             &value_end,
+		                                             10 );
+
+		if( ( errno != 0 )
+		 || ( value_end == value )
+		 || ( bad_sectors_range->last_sector < bad_sectors_range->first_sector ) )
+		{
+			return( -1 );
+		}
+		bad_sectors_range->number_of_failing_reads = -1;
+
+		while( ( *value_end == ' ' )
+		    || ( *value_end == '\t' ) )
+		{
+			value_end++;
+		}
+		if( *value_end != 0 )
+		{
+			if( ( tableau_test_sg_shim_parse_decimal(
+			       value_end,
+			       &value_64bit ) != 1 )
+			 || ( value_64bit == 0 )
+			 || ( value_64bit > (uint64_t) INT_MAX ) )
+			{
+				return( -1 );
+			}
+			bad_sectors_range->number_of_failing_reads = (int) value_64bit;
+		}
+		device->number_of_bad_sectors_ranges += 1;
+	}
+	else
+	{
+		if( tableau_test_sg_shim_parse_decimal(
+		     value,
+		     &value_64bit ) != 1 )
+		{
+			return( -1 );
+		}
+		if( narrow_string_compare(
+		     name,
+		     "number_of_sectors",
+		     18 ) == 0 )
+		{
+			if( value_64bit == 0 )
+			{
+				return( -1 );
+			}
+			device->number_of_sectors = value_64bit;
+		}
+		else if( narrow_string_compare(
+		          name,
+		          "hpa_number_of_sectors",
+		          22 ) == 0 )
+		{
+			device->hpa_number_of_sectors = value_64bit;
+		}
+		else if( narrow_string_compare(
+		          name,
+		          "dco_number_of_sectors",
+		          22 ) == 0 )
+		{
+			device->dco_number_of_sectors = value_64bit;
+		}
+		else if( narrow_string_compare(
+		          name,
+		          "bytes_per_sector",
+		          17 ) == 0 )
+		{
+			if( ( value_64bit == 0 )
+			 || ( value_64bit > 65536 )
+			 || ( ( value_64bit % 512 ) != 0 ) )
+			{
+				return( -1 );
+			}
+			device->bytes_per_sector = (uint32_t) value_64bit;
+		}
+		else if( narrow_string_compare(
+		          name,
+		          "write_permitted",
+		          16 ) == 0 )
+		{
+			device->write_permitted = (uint8_t) ( value_64bit != 0 );
+		}
+		else if( narrow_string_compare(
+		          name,
+		          "command_latency",
+		          16 ) == 0 )
+		{
+			device->command_latency = value_64bit;
+		}
+		else if( narrow_string_compare(
+		          name,
+		          "query_latency",
+		          14 ) == 0 )
+		{
+			device->query_latency = value_64bit;
+		}
+		else if( narrow_string_compare(
+		          name,
+		          "throughput",
+		          11 ) == 0 )
+		{
+			device->throughput = value_64bit;
+		}
+		else if( narrow_string_compare(
+		          name,
+		          "stalled_commands",
+		          17 ) == 0 )
+		{
+			device->number_of_stalled_commands = value_64bit;
+		}
+		else if( narrow_string_compare(
+		          name,
+		          "maximum_transfer_size",
+		          22 ) == 0 )
+		{
+			if( ( value_64bit == 0 )
+			 || ( value_64bit > (uint64_t) INT_MAX ) )
+			{
+				return( -1 );
+			}
+			device->maximum_transfer_size = (int) value_64bit;
+		}
+		else
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the drive model file
+ * Returns 1 if successful or -1 on error
+ */
+static int tableau_test_sg_shim_read_model(
+            const char *filename )
+{
+	char line[ 512 ];
+
+	tableau_test_sg_shim_device_t *device = NULL;
+	FILE *file_stream                     = NULL;
+	char *name                            = NULL;
+	char *value                           = NULL;
+	size_t line_length                    = 0;
+	size_t name_length                    = 0;
+	int line_number                       = 0;
+	uint8_t query_latency_set             = 0;
+
+	file_stream = fopen(
+	               filename,
+	               "r" );
+
+	if( file_stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "tableau_test_sg_shim: unable to open drive model file: %s.\n",
+		 filename );
+
+		return( -1 );
+	}
+	while( fgets(
+	        line,
+	        sizeof( line ),
+	        file_stream ) != NULL )
+	{
+		line_number++;
+
+		value = narrow_string_search_character(
+		         line,
+		         '#',
+		         narrow_string_length(
+		          line ) );
+
+		if( value != NULL )
+		{
+			*value = 0;
+		}
+		line_length = narrow_string_length(
+		               line );
+
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == '\n' )
+		     ||  ( line[ line_length - 1 ] == '\r' )
+		     ||  ( line[ line_length - 1 ] == ' ' )
+		     ||  ( line[ line_length - 1 ] == '\t' ) ) )
+		{
+			line_length--;
+		}
+		line[ line_length ] = 0;
+
+		name = line;
+
+		while( ( *name == ' ' )
+		    || ( *name == '\t' ) )
+		{
+			name++;
+		}
+		if( *name == 0 )
+		{
+			continue;
+		}
+		value = name;
+
+		while( ( *value != 0 )
+		    && ( *value != ' ' )
+		    && ( *value != '\t' ) )
+		{
+			value++;
+		}
+		name_length = (size_t) ( value - name );
+
+		while( ( *value == ' ' )
+		    || ( *value == '\t' ) )
+		{
+			*value = 0;
+
+			value++;
+		}
+		if( ( name_length == 6 )
+		 && ( narrow_string_compare(
+		       name,
+		       "device",
+		       6 ) == 0 ) )
+		{
+			if( ( *value == 0 )
+			 || ( tableau_test_sg_shim_number_of_devices >= TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_DEVICES ) )
+			{
+				goto on_error;
+			}
+			if( device != NULL )
+			{
+				tableau_test_sg_shim_device_finalize(
+				 device,
+				 query_latency_set );
+			}
+			device = &( tableau_test_sg_shim_devices[ tableau_test_sg_shim_number_of_devices ] );
+
+			tableau_test_sg_shim_number_of_devices += 1;
+
+			tableau_test_sg_shim_device_initialize(
+			 device,
+			 value );
+
+			query_latency_set = 0;
+
+			continue;
+		}
+		if( ( device == NULL )
+		 || ( *value == 0 ) )
+		{
+			goto on_error;
+		}
+		if( tableau_test_sg_shim_device_set_value(
+		     device,
+		     name,
+		     value ) != 1 )
+		{
+			goto on_error;
+		}
+		if( ( name_length == 13 )
+		 && ( narrow_string_compare(
+		       name,
+		       "query_latency",
+		       13 ) == 0 ) )
+		{
+			query_latency_set = 1;
+		}
+	}
+	if( device != NULL )
+	{
+		tableau_test_sg_shim_device_finalize(
+		 device,
+		 query_latency_set );
+	}
+	fclose(
+	 file_stream );
+
+	return( 1 );
+
+on_error:
+	fprintf(
+	 stderr,
+	 "tableau_test_sg_shim: invalid drive model file: %s at line: %d.\n",
+	 filename,
+	 line_number );
+
+	fclose(
+	 file_stream );
+
+	tableau_test_sg_shim_number_of_devices = 0;
+
+	return( -1 );
+}
+
+/* Resolves the interposed functions and reads the drive model file
+ * The caller must hold the shim lock
+ */
+static void tableau_test_sg_shim_initialize(
+             void )
+{
+	const char *filename = NULL;
+
+	if( tableau_test_sg_shim_initialized != 0 )
+	{
+		return;
+	}
+	tableau_test_sg_shim_real_open  = dlsym(
+	                                   RTLD_NEXT,
+	                                   "open" );
+	tableau_test_sg_shim_real_close = dlsym(
+	                                   RTLD_NEXT,
+	                                   "close" );
+	tableau_test_sg_shim_real_ioctl = dlsym(
+	                                   RTLD_NEXT,
+	                                   "ioctl" );
+	tableau_test_sg_shim_real_read  = dlsym(
+	                                   RTLD_NEXT,
+	                                   "read" );
+	tableau_test_sg_shim_real_write = dlsym(
+	                                   RTLD_NEXT,
+	                                   "write" );
+	tableau_test_sg_shim_real_poll  = dlsym(
+	                                   RTLD_NEXT,
+	                                   "poll" );
+
+	filename = getenv(
+	            "TABLEAU_TEST_SG_SHIM_MODEL" );
+
+	if( ( filename != NULL )
+	 && ( tableau_test_sg_shim_real_open != NULL ) )
+	{
+		tableau_test_sg_shim_read_model(
+		 filename );
+	}
+	tableau_test_sg_shim_initialized = 1;
+}
+
+/* Retrieves the emulated device of a file descriptor
+ * The caller must hold the shim lock
+ * Returns the device or NULL if the file descriptor is not emulated
+ */
+static tableau_test_sg_shim_device_t *tableau_test_sg_shim_get_device(
+                                       int file_descriptor )
+{
+	if( ( file_descriptor < 0 )
+	 || ( file_descriptor >= TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_FILE_DESCRIPTORS ) )
+	{
+		return( NULL );
+	}
+	return( tableau_test_sg_shim_files[ file_descriptor ].device );
+}
+
+/* Sets fixed format sense data and the check condition status
+ */
+static void tableau_test_sg_shim_set_sense(
+             sg_io_hdr_t *header,
+             uint8_t sense_key,
+             uint8_t additional_sense_code,
+             uint64_t information )
+{
+	uint8_t sense[ 18 ];
+
+	size_t sense_size = 18;
+
+	memory_set(
+	 sense,
+	 0,
+	 18 );
+
+	sense[ 0 ]  = 0x70;
+	sense[ 2 ]  = sense_key;
+	sense[ 7 ]  = 10;
+	sense[ 12 ] = additional_sense_code;
+
+	if( information <= (uint64_t) UINT32_MAX )
+	{
+		sense[ 0 ] |= 0x80;
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( sense[ 3 ] ),
+		 (uint32_t) information );
+	}
+	if( sense_size > (size_t) header->mx_sb_len )
+	{
+		sense_size = (size_t) header->mx_sb_len;
+	}
+	if( ( header->sbp != NULL )
+	 && ( sense_size > 0 ) )
+	{
+		memory_copy(
+		 header->sbp,
+		 sense,
+		 sense_size );
+	}
+	header->status        = 0x02;
+	header->masked_status = 0x01;
+	header->driver_status = 0x08;
+	header->sb_len_wr     = (unsigned char) sense_size;
+	header->resid         = (int) header->dxfer_len;
+}
+
+/* Reads sectors from the drive model
+ * Returns 1 if successful or 0 if a bad sector was read
+ */
+static int tableau_test_sg_shim_device_read_sectors(
+            tableau_test_sg_shim_device_t *device,
+            sg_io_hdr_t *header,
+            uint64_t sector,
+            uint64_t number_of_sectors )
+{
+	tableau_test_sg_shim_bad_sectors_range_t *bad_sectors_range = NULL;
+	uint8_t *data                                               = NULL;
+	uint64_t data_offset                                        = 0;
+	uint64_t last_sector                                        = 0;
+	size_t data_size                                            = 0;
+	ssize_t read_count                                          = 0;
+	int range_index                                             = 0;
+
+	if( number_of_sectors == 0 )
+	{
+		return( 1 );
+	}
+	last_sector = sector + number_of_sectors - 1;
+
+	if( ( last_sector < sector )
+	 || ( last_sector >= device->number_of_sectors ) )
+	{
+		/* LOGICAL BLOCK ADDRESS OUT OF RANGE
+		 */
+		tableau_test_sg_shim_set_sense(
+		 header,
+		 0x05,
+		 0x21,
+		 sector );
+
+		return( 0 );
+	}
+	for( range_index = 0;
+	     range_index < device->number_of_bad_sectors_ranges;
+	     range_index++ )
+	{
+		bad_sectors_range = &( device->bad_sectors_ranges[ range_index ] );
+
+		if( ( bad_sectors_range->number_of_failing_reads == 0 )
+		 || ( bad_sectors_range->first_sector > last_sector )
+		 || ( bad_sectors_range->last_sector < sector ) )
+		{
+			continue;
+		}
+		if( bad_sectors_range->number_of_failing_reads > 0 )
+		{
+			bad_sectors_range->number_of_failing_reads -= 1;
+		}
+		/* MEDIUM ERROR, UNRECOVERED READ ERROR at the first bad sector
+		 */
+		tableau_test_sg_shim_set_sense(
+		 header,
+		 0x03,
+		 0x11,
+		 ( bad_sectors_range->first_sector > sector ) ? bad_sectors_range->first_sector : sector );
+
+		return( 0 );
+	}
+	data      = (uint8_t *) header->dxferp;
+	data_size = (size_t) ( number_of_sectors * device->bytes_per_sector );
+
+	if( device->data_file_descriptor != -1 )
+	{
+		read_count = pread64(
+		              device->data_file_descriptor,
+		              data,
+		              data_size,
+		              (off64_t) ( sector * device->bytes_per_sector ) );
+
+		if( read_count < 0 )
+		{
+			read_count = 0;
+		}
+		if( (size_t) read_count < data_size )
+		{
+			memory_set(
+			 &( data[ read_count ] ),
+			 0,
+			 data_size - (size_t) read_count );
+		}
+	}
+	else
+	{
+		for( data_offset = 0;
+		     data_offset < data_size;
+		     data_offset += 8 )
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 sector + ( data_offset / device->bytes_per_sector ) );
+		}
+	}
+	return( 1 );
+}
+
+/* Answers a Tableau query or DCO removal
+ */
+static void tableau_test_sg_shim_device_query(
+             tableau_test_sg_shim_device_t *device,
+             sg_io_hdr_t *header )
+{
+	uint8_t response[ TABLEAU_TEST_SG_SHIM_QUERY_RESPONSE_SIZE ];
+
+	uint8_t *command       = (uint8_t *) header->cmdp;
+	uint32_t challenge_key = 0;
+	size_t response_size   = TABLEAU_TEST_SG_SHIM_QUERY_RESPONSE_SIZE;
+	uint8_t flags          = 0x05;
+
+	if( command[ 2 ] == 0x01 )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( command[ 5 ] ),
+		 challenge_key );
+
+		if( challenge_key != device->dco_challenge_key )
+		{
+			/* INVALID FIELD IN CDB
+			 */
+			tableau_test_sg_shim_set_sense(
+			 header,
+			 0x05,
+			 0x24,
+			 (uint64_t) -1 );
+
+			return;
+		}
+		if( device->dco_number_of_sectors > device->hpa_number_of_sectors )
+		{
+			device->hpa_number_of_sectors = device->dco_number_of_sectors;
+		}
+	}
+	else if( command[ 2 ] != 0x00 )
+	{
+		tableau_test_sg_shim_set_sense(
+		 header,
+		 0x05,
+		 0x24,
+		 (uint64_t) -1 );
+
+		return;
+	}
+	memory_set(
+	 response,
+	 0,
+	 TABLEAU_TEST_SG_SHIM_QUERY_RESPONSE_SIZE );
+
+	response[ 1 ] = (uint8_t) TABLEAU_TEST_SG_SHIM_QUERY_RESPONSE_SIZE;
+	response[ 2 ] = 0x0e;
+	response[ 3 ] = 0xcc;
+	response[ 6 ] = device->channel_type;
+
+	if( device->write_permitted != 0 )
+	{
+		response[ 7 ] = 0x06;
+	}
+	memory_copy(
+	 &( response[ 8 ] ),
+	 device->bridge_serial_number,
+	 8 );
+
+	tableau_test_sg_shim_copy_field(
+	 &( response[ 16 ] ),
+	 8,
+	 device->bridge_vendor );
+
+	tableau_test_sg_shim_copy_field(
+	 &( response[ 24 ] ),
+	 8,
+	 device->bridge_model );
+
+	tableau_test_sg_shim_copy_field(
+	 &( response[ 32 ] ),
+	 12,
+	 device->bridge_firmware_date );
+
+	tableau_test_sg_shim_copy_field(
+	 &( response[ 44 ] ),
+	 12,
+	 device->bridge_firmware_time );
+
+	tableau_test_sg_shim_copy_field(
+	 &( response[ 56 ] ),
+	 8,
+	 device->drive_vendor );
+
+	tableau_test_sg_shim_copy_field(
+	 &( response[ 64 ] ),
+	 28,
+	 device->drive_model );
+
+	tableau_test_sg_shim_copy_field(
+	 &( response[ 92 ] ),
+	 20,
+	 device->drive_serial_number );
+
+	tableau_test_sg_shim_copy_field(
+	 &( response[ 112 ] ),
+	 8,
+	 device->drive_revision_number );
+
+	/* The HPA and DCO page, where a HPA or DCO is in use if it hides sectors
+	 */
+	if( device->hpa_number_of_sectors > device->number_of_sectors )
+	{
+		flags |= 0x02;
+	}
+	if( device->dco_number_of_sectors > device->hpa_number_of_sectors )
+	{
+		flags |= 0x08;
+	}
+	response[ 120 ] = 0x00;
+	response[ 121 ] = 32;
+	response[ 122 ] = flags;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( response[ 128 ] ),
+	 (uint32_t) device->number_of_sectors );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( response[ 136 ] ),
+	 (uint32_t) device->hpa_number_of_sectors );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( response[ 144 ] ),
+	 (uint32_t) device->dco_number_of_sectors );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( response[ 148 ] ),
+	 device->dco_challenge_key );
+
+	if( response_size > (size_t) header->dxfer_len )
+	{
+		response_size = (size_t) header->dxfer_len;
+	}
+	memory_copy(
+	 header->dxferp,
+	 response,
+	 response_size );
+
+	header->resid = (int) ( header->dxfer_len - response_size );
+}
+
+/* Executes a command on the drive model
+ * The caller must hold the shim lock
+ * Returns the time in microseconds the command completes
+ */
+static uint64_t tableau_test_sg_shim_device_execute(
+                 tableau_test_sg_shim_device_t *device,
+                 sg_io_hdr_t *header )
+{
+	uint8_t *command           = (uint8_t *) header->cmdp;
+	uint8_t *data              = (uint8_t *) header->dxferp;
+	uint64_t completion_time   = 0;
+	uint64_t duration          = 0;
+	uint64_t last_sector       = 0;
+	uint64_t number_of_sectors = 0;
+	uint64_t sector            = 0;
+	uint64_t start_time        = 0;
+	uint64_t timeout           = 0;
+	size_t transfer_size       = 0;
+
+	header->status          = 0;
+	header->masked_status   = 0;
+	header->msg_status      = 0;
+	header->host_status     = 0;
+	header->driver_status   = 0;
+	header->sb_len_wr       = 0;
+	header->resid           = 0;
+	header->info            = SG_INFO_OK;
+
+	if( ( header->cmdp == NULL )
+	 || ( header->cmd_len < 6 ) )
+	{
+		header->host_status = 0x07;
+		header->info        = SG_INFO_CHECK;
+
+		return( tableau_test_sg_shim_get_time() );
+	}
+	duration = device->command_latency;
+
+	if( ( header->dxfer_len > 0 )
+	 && ( header->dxferp != NULL )
+	 && ( command[ 0 ] != 0x28 )
+	 && ( command[ 0 ] != 0x88 ) )
+	{
+		memory_set(
+		 data,
+		 0,
+		 header->dxfer_len );
+	}
+	switch( command[ 0 ] )
+	{
+		/* TEST UNIT READY
+		 */
+		case 0x00:
+			break;
+
+		/* INQUIRY
+		 */
+		case 0x12:
+			if( header->dxfer_len >= 36 )
+			{
+				data[ 2 ] = 0x05;
+				data[ 3 ] = 0x02;
+				data[ 4 ] = 31;
+
+				tableau_test_sg_shim_copy_field(
+				 &( data[ 8 ] ),
+				 8,
+				 device->bridge_vendor );
+
+				tableau_test_sg_shim_copy_field(
+				 &( data[ 16 ] ),
+				 16,
+				 device->bridge_model );
+
+				tableau_test_sg_shim_copy_field(
+				 &( data[ 32 ] ),
+				 4,
+				 device->drive_revision_number );
+
+				header->resid = (int) ( header->dxfer_len - 36 );
+			}
+			break;
+
+		/* READ CAPACITY (10)
+		 */
+		case 0x25:
+			if( header->dxfer_len < 8 )
+			{
+				tableau_test_sg_shim_set_sense(
+				 header,
+				 0x05,
+				 0x24,
+				 (uint64_t) -1 );
+
+				break;
+			}
+			last_sector = device->number_of_sectors - 1;
+
+			if( last_sector > (uint64_t) UINT32_MAX )
+			{
+				last_sector = (uint64_t) UINT32_MAX;
+			}
+			byte_stream_copy_from_uint32_big_endian(
+			 data,
+			 (uint32_t) last_sector );
+
+			byte_stream_copy_from_uint32_big_endian(
+			 &( data[ 4 ] ),
+			 device->bytes_per_sector );
+
+			header->resid = (int) ( header->dxfer_len - 8 );
+
+			break;
+
+		/* READ CAPACITY (16)
+		 */
+		case 0x9e:
+			if( ( ( command[ 1 ] & 0x1f ) != 0x10 )
+			 || ( header->dxfer_len < 12 ) )
+			{
+				tableau_test_sg_shim_set_sense(
+				 header,
+				 0x05,
+				 0x24,
+				 (uint64_t) -1 );
+
+				break;
+			}
+			byte_stream_copy_from_uint64_big_endian(
+			 data,
+			 device->number_of_sectors - 1 );
+
+			byte_stream_copy_from_uint32_big_endian(
+			 &( data[ 8 ] ),
+			 device->bytes_per_sector );
+
+			header->resid = (int) ( header->dxfer_len - ( ( header->dxfer_len < 32 ) ? header->dxfer_len : 32 ) );
+
+			break;
+
+		/* READ (10) and READ (16)
+		 */
+		case 0x28:
+		case 0x88:
+			if( command[ 0 ] == 0x28 )
+			{
+				byte_stream_copy_to_uint32_big_endian(
+				 &( command[ 2 ] ),
+				 sector );
+
+				byte_stream_copy_to_uint16_big_endian(
+				 &( command[ 7 ] ),
+				 number_of_sectors );
+			}
+			else if( header->cmd_len >= 16 )
+			{
+				byte_stream_copy_to_uint64_big_endian(
+				 &( command[ 2 ] ),
+				 sector );
+
+				byte_stream_copy_to_uint32_big_endian(
+				 &( command[ 10 ] ),
+				 number_of_sectors );
+			}
+			transfer_size = (size_t) ( number_of_sectors * device->bytes_per_sector );
+
+			if( ( header->cmd_len < 10 )
+			 || ( header->dxferp == NULL )
+			 || ( transfer_size > (size_t) header->dxfer_len )
+			 || ( transfer_size > (size_t) device->maximum_transfer_size ) )
+			{
+				tableau_test_sg_shim_set_sense(
+				 header,
+				 0x05,
+				 0x24,
+				 (uint64_t) -1 );
+
+				break;
+			}
+			if( tableau_test_sg_shim_device_read_sectors(
+			     device,
+			     header,
+			     sector,
+			     number_of_sectors ) == 1 )
+			{
+				header->resid = (int) ( header->dxfer_len - transfer_size );
+			}
+			if( device->throughput > 0 )
+			{
+				duration += ( (uint64_t) transfer_size * 1000000 ) / device->throughput;
+			}
+			break;
+
+		/* Tableau query and DCO removal
+		 */
+		case 0xec:
+			duration = device->query_latency;
+
+			/* A query consists of 6 bytes and a DCO removal of 12 bytes
+			 */
+			if( ( command[ 2 ] == 0x01 )
+			 && ( header->cmd_len < 12 ) )
+			{
+				tableau_test_sg_shim_set_sense(
+				 header,
+				 0x05,
+				 0x24,
+				 (uint64_t) -1 );
+
+				break;
+			}
+			tableau_test_sg_shim_device_query(
+			 device,
+			 header );
+
+			break;
+
+		/* INVALID COMMAND OPERATION CODE
+		 */
+		default:
+			tableau_test_sg_shim_set_sense(
+			 header,
+			 0x05,
+			 0x20,
+			 (uint64_t) -1 );
+
+			break;
+	}
+	if( header->status != 0 )
+	{
+		header->info = SG_INFO_CHECK;
+	}
+	/* The device executes one command at a time
+	 */
+	start_time = tableau_test_sg_shim_get_time();
+
+	if( start_time < device->busy_time )
+	{
+		start_time = device->busy_time;
+	}
+	timeout = (uint64_t) header->timeout;
+
+	if( timeout == 0 )
+	{
+		timeout = TABLEAU_TEST_SG_SHIM_DEFAULT_TIMEOUT;
+	}
+	timeout *= 1000;
+
+	/* A stalled command is only reported as timed out well after its timeout
+	 */
+	if( device->number_of_stalled_commands > 0 )
+	{
+		device->number_of_stalled_commands -= 1;
+
+		header->status        = 0;
+		header->masked_status = 0;
+		header->host_status   = 0x03;
+		header->driver_status = 0;
+		header->sb_len_wr     = 0;
+		header->resid         = (int) header->dxfer_len;
+		header->info          = SG_INFO_CHECK;
+
+		duration = ( timeout * 3 ) / 2;
+	}
+	else if( duration > timeout )
+	{
+		/* DID_TIME_OUT
+		 */
+		header->status        = 0;
+		header->masked_status = 0;
+		header->host_status   = 0x03;
+		header->driver_status = 0;
+		header->sb_len_wr     = 0;
+		header->resid         = (int) header->dxfer_len;
+		header->info          = SG_INFO_CHECK;
+
+		duration = timeout;
+	}
+	completion_time    = start_time + duration;
+	device->busy_time  = completion_time;
+	header->duration   = (unsigned int) ( duration / 1000 );
+
+	return( completion_time );
+}
+
+/* Discards the queued requests of a file
+ */
+static void tableau_test_sg_shim_file_clear(
+             tableau_test_sg_shim_file_t *file )
+{
+	int request_index = 0;
+
+	for( request_index = 0;
+	     request_index < file->number_of_requests;
+	     request_index++ )
+	{
+		if( file->requests[ request_index ].data != NULL )
+		{
+			munmap(
+			 file->requests[ request_index ].data,
+			 (size_t) file->requests[ request_index ].header.dxfer_len );
+
+			file->requests[ request_index ].data = NULL;
+		}
+	}
+	file->number_of_requests = 0;
+}
+
+/* Opens an emulated device on a file descriptor of /dev/null, which is a
+ * character device that is always ready for reading
+ * Returns the file descriptor, -2 if the path is not emulated or -1 on error
+ */
+static int tableau_test_sg_shim_open_device(
+            const char *path,
+            int flags )
+{
+	tableau_test_sg_shim_device_t *device = NULL;
+	tableau_test_sg_shim_file_t *file     = NULL;
+	size_t path_length                    = 0;
+	int device_index                      = 0;
+	int file_descriptor                   = -1;
+
+	tableau_test_sg_shim_lock();
+
+	tableau_test_sg_shim_initialize();
+
+	if( path == NULL )
+	{
+		tableau_test_sg_shim_unlock();
+
+		return( -2 );
+	}
+	path_length = narrow_string_length(
+	               path );
+
+	for( device_index = 0;
+	     device_index < tableau_test_sg_shim_number_of_devices;
+	     device_index++ )
+	{
+		if( ( narrow_string_length(
+		       tableau_test_sg_shim_devices[ device_index ].path ) == path_length )
+		 && ( narrow_string_compare(
+		       tableau_test_sg_shim_devices[ device_index ].path,
+		       path,
+		       path_length ) == 0 ) )
+		{
+			device = &( tableau_test_sg_shim_devices[ device_index ] );
+
+			break;
+		}
+	}
+	if( device == NULL )
+	{
+		tableau_test_sg_shim_unlock();
+
+		return( -2 );
+	}
+	file_descriptor = tableau_test_sg_shim_real_open(
+	                   "/dev/null",
+	                   flags & ( O_ACCMODE | O_NONBLOCK | O_CLOEXEC ) );
+
+	if( file_descriptor >= TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_FILE_DESCRIPTORS )
+	{
+		tableau_test_sg_shim_real_close(
+		 file_descriptor );
+
+		file_descriptor = -1;
+		errno           = EMFILE;
+	}
+	if( file_descriptor != -1 )
+	{
+		file = &( tableau_test_sg_shim_files[ file_descriptor ] );
+
+		tableau_test_sg_shim_file_clear(
+		 file );
+
+		file->device = device;
+	}
+	tableau_test_sg_shim_unlock();
+
+	return( file_descriptor );
+}
+
+/* Opens a file
+ * Returns the file descriptor or -1 on error
+ */
+static int tableau_test_sg_shim_open(
+            const char *path,
+            int flags,
+            mode_t mode )
+{
+	int file_descriptor = tableau_test_sg_shim_open_device(
+	                       path,
+	                       flags );
+
+	if( file_descriptor != -2 )
+	{
+		return( file_descriptor );
+	}
+	return( tableau_test_sg_shim_real_open(
+	         path,
+	         flags | O_LARGEFILE,
+	         mode ) );
+}
+
+/* Interposed open
+ * Returns the file descriptor or -1 on error
+ */
+int open(
+     const char *path,
+     int flags,
+     ... )
+{
+	va_list argument_list;
+
+	mode_t mode = 0;
+
+	if( ( flags & ( O_CREAT | O_TMPFILE ) ) != 0 )
+	{
+		va_start(
+		 argument_list,
+		 flags );
+
+		mode = (mode_t) va_arg(
+		                 argument_list,
+		                 int );
+
+		va_end(
+		 argument_list );
+	}
+	return( tableau_test_sg_shim_open(
+	         path,
+	         flags,
+	         mode ) );
+}
+
+/* Interposed open64
+ * Returns the file descriptor or -1 on error
+ */
+int open64(
+     const char *path,
+     int flags,
+     ... )
+{
+	va_list argument_list;
+
+	mode_t mode = 0;
+
+	if( ( flags & ( O_CREAT | O_TMPFILE ) ) != 0 )
+	{
+		va_start(
+		 argument_list,
+		 flags );
+
+		mode = (mode_t) va_arg(
+		                 argument_list,
+		                 int );
+
+		va_end(
+		 argument_list );
+	}
+	return( tableau_test_sg_shim_open(
+	         path,
+	         flags,
+	         mode ) );
+}
+
+/* Interposed open of fortified callers that do not pass a mode
+ * Returns the file descriptor or -1 on error
+ */
+int __open_2(
+     const char *path,
+     int flags )
+{
+	return( tableau_test_sg_shim_open(
+	         path,
+	         flags,
+	         0 ) );
+}
+
+/* Interposed open64 of fortified callers that do not pass a mode
+ * Returns the file descriptor or -1 on error
+ */
+int __open64_2(
+     const char *path,
+     int flags )
+{
+	return( tableau_test_sg_shim_open(
+	         path,
+	         flags,
+	         0 ) );
+}
+
+/* Interposed close
+ * Returns 0 if successful or -1 on error
+ */
+int close(
+     int file_descriptor )
+{
+	tableau_test_sg_shim_lock();
+
+	tableau_test_sg_shim_initialize();
+
+	if( tableau_test_sg_shim_get_device(
+	     file_descriptor ) != NULL )
+	{
+		/* Outstanding commands are discarded like the sg driver does
+		 */
+		tableau_test_sg_shim_file_clear(
+		 &( tableau_test_sg_shim_files[ file_descriptor ] ) );
+
+		tableau_test_sg_shim_files[ file_descriptor ].device = NULL;
+	}
+	tableau_test_sg_shim_unlock();
+
+	return( tableau_test_sg_shim_real_close(
+	         file_descriptor ) );
+}
+
+/* Interposed ioctl
+ * Returns 0 if successful or -1 on error
+ */
+int ioctl(
+     int file_descriptor,
+     unsigned long request,
+     ... )
+{
+	va_list argument_list;
+
+	tableau_test_sg_shim_device_t *device = NULL;
+	void *argument                        = NULL;
+	uint64_t completion_time              = 0;
+	int result                            = 0;
+
+	va_start(
+	 argument_list,
+	 request );
+
+	argument = va_arg(
+	            argument_list,
+	            void * );
+
+	va_end(
+	 argument_list );
+
+	tableau_test_sg_shim_lock();
+
+	tableau_test_sg_shim_initialize();
+
+	device = tableau_test_sg_shim_get_device(
+	          file_descriptor );
+
+	if( device == NULL )
+	{
+		tableau_test_sg_shim_unlock();
+
+		return( tableau_test_sg_shim_real_ioctl(
+		         file_descriptor,
+		         request,
+		         argument ) );
+	}
+	if( ( argument == NULL )
+	 && ( request != SG_IO ) )
+	{
+		tableau_test_sg_shim_unlock();
+
+		errno = EFAULT;
+
+		return( -1 );
+	}
+	switch( request )
+	{
+		case SG_IO:
+			if( ( argument == NULL )
+			 || ( ( (sg_io_hdr_t *) argument )->interface_id != 'S' ) )
+			{
+				errno  = EINVAL;
+				result = -1;
+
+				break;
+			}
+			completion_time = tableau_test_sg_shim_device_execute(
+			                   device,
+			                   (sg_io_hdr_t *) argument );
+			break;
+
+		case SG_GET_VERSION_NUM:
+			*( (int *) argument ) = TABLEAU_TEST_SG_SHIM_SG_VERSION;
+			break;
+
+		case SG_GET_RESERVED_SIZE:
+#if defined( BLKSECTGET )
+		case BLKSECTGET:
+#endif
+			*( (int *) argument ) = device->maximum_transfer_size;
+			break;
+
+		case SG_SET_RESERVED_SIZE:
+			break;
+
+		default:
+			errno  = ENOTTY;
+			result = -1;
+
+			break;
+	}
+	tableau_test_sg_shim_unlock();
+
+	if( completion_time != 0 )
+	{
+		tableau_test_sg_shim_sleep_until(
+		 completion_time );
+	}
+	return( result );
+}
+
+/* Interposed write, which queues a command with the asynchronous sg version 3 interface
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t write(
+         int file_descriptor,
+         const void *buffer,
+         size_t size )
+{
+	tableau_test_sg_shim_request_t *request = NULL;
+	tableau_test_sg_shim_device_t *device   = NULL;
+	tableau_test_sg_shim_file_t *file       = NULL;
+	sg_io_hdr_t *header                     = NULL;
+	uint8_t *data                           = NULL;
+
+	tableau_test_sg_shim_lock();
+
+	tableau_test_sg_shim_initialize();
+
+	device = tableau_test_sg_shim_get_device(
+	          file_descriptor );
+
+	if( device == NULL )
+	{
+		tableau_test_sg_shim_unlock();
+
+		return( tableau_test_sg_shim_real_write(
+		         file_descriptor,
+		         buffer,
+		         size ) );
+	}
+	file = &( tableau_test_sg_shim_files[ file_descriptor ] );
+
+	if( ( buffer == NULL )
+	 || ( size < sizeof( sg_io_hdr_t ) )
+	 || ( ( (sg_io_hdr_t *) buffer )->interface_id != 'S' ) )
+	{
+		tableau_test_sg_shim_unlock();
+
+		errno = EINVAL;
+
+		return( -1 );
+	}
+	if( file->number_of_requests >= TABLEAU_TEST_SG_SHIM_MAXIMUM_NUMBER_OF_REQUESTS )
+	{
+		tableau_test_sg_shim_unlock();
+
+		errno = EDOM;
+
+		return( -1 );
+	}
+	header = (sg_io_hdr_t *) buffer;
+
+	if( ( header->dxfer_len > 0 )
+	 && ( header->dxferp != NULL ) )
+	{
+		data = (uint8_t *) mmap(
+		                    NULL,
+		                    (size_t) header->dxfer_len,
+		                    PROT_READ | PROT_WRITE,
+		                    MAP_PRIVATE | MAP_ANONYMOUS,
+		                    -1,
+		                    0 );
+
+		if( data == MAP_FAILED )
+		{
+			tableau_test_sg_shim_unlock();
+
+			errno = ENOMEM;
+
+			return( -1 );
+		}
+		if( header->dxfer_direction == SG_DXFER_TO_DEV )
+		{
+			memory_copy(
+			 data,
+			 header->dxferp,
+			 (size_t) header->dxfer_len );
+		}
+	}
+	request = &( file->requests[ file->number_of_requests ] );
+
+	memory_copy(
+	 &( request->header ),
+	 header,
+	 sizeof( sg_io_hdr_t ) );
+
+	request->data = data;
+
+	/* The command is executed on the buffers of the request
+	 */
+	if( data != NULL )
+	{
+		request->header.dxferp = data;
+	}
+	if( request->header.sbp != NULL )
+	{
+		request->header.sbp = request->sense;
+	}
+	request->completion_time = tableau_test_sg_shim_device_execute(
+	                            device,
+	                            &( request->header ) );
+
+	request->header.dxferp = header->dxferp;
+	request->header.sbp    = header->sbp;
+
+	file->number_of_requests += 1;
+
+	tableau_test_sg_shim_unlock();
+
+	return( (ssize_t) size );
+}
+
+/* Interposed read, which returns the oldest completed command of the asynchronous sg version 3 interface
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t read(
+         int file_descriptor,
+         void *buffer,
+         size_t size )
+{
+	tableau_test_sg_shim_request_t *request = NULL;
+	tableau_test_sg_shim_file_t *file       = NULL;
+	uint64_t completion_time                = 0;
+	int flags                               = 0;
+	int request_index                       = 0;
+
+	tableau_test_sg_shim_lock();
+
+	tableau_test_sg_shim_initialize();
+
+	if( tableau_test_sg_shim_get_device(
+	     file_descriptor ) == NULL )
+	{
+		tableau_test_sg_shim_unlock();
+
+		return( tableau_test_sg_shim_real_read(
+		         file_descriptor,
+		         buffer,
+		         size ) );
+	}
+	file = &( tableau_test_sg_shim_files[ file_descriptor ] );
+
+	if( ( buffer == NULL )
+	 || ( size < sizeof( sg_io_hdr_t ) ) )
+	{
+		tableau_test_sg_shim_unlock();
+
+		errno = EINVAL;
+
+		return( -1 );
+	}
+	if( file->number_of_requests == 0 )
+	{
+		tableau_test_sg_shim_unlock();
+
+		errno = EAGAIN;
+
+		return( -1 );
+	}
+	completion_time = file->requests[ 0 ].completion_time;
+
+	if( completion_time > tableau_test_sg_shim_get_time() )
+	{
+		flags = fcntl(
+		         file_descriptor,
+		         F_GETFL );
+
+		if( ( flags != -1 )
+		 && ( ( flags & O_NONBLOCK ) != 0 ) )
+		{
+			tableau_test_sg_shim_unlock();
+
+			errno = EAGAIN;
+
+			return( -1 );
+		}
+		tableau_test_sg_shim_unlock();
+
+		tableau_test_sg_shim_sleep_until(
+		 completion_time );
+
+		tableau_test_sg_shim_lock();
+
+		/* The file descriptor could have been closed by another thread
+		 */
+		if( file->number_of_requests == 0 )
+		{
+			tableau_test_sg_shim_unlock();
+
+			errno = EAGAIN;
+
+			return( -1 );
+		}
+	}
+	request = &( file->requests[ 0 ] );
+
+	if( request->data != NULL )
+	{
+		if( request->header.dxfer_direction != SG_DXFER_TO_DEV )
+		{
+			memory_copy(
+			 request->header.dxferp,
+			 request->data,
+			 (size_t) request->header.dxfer_len );
+		}
+		munmap(
+		 request->data,
+		 (size_t) request->header.dxfer_len );
+
+		request->data = NULL;
+	}
+	if( ( request->header.sbp != NULL )
+	 && ( request->header.sb_len_wr > 0 ) )
+	{
+		memory_copy(
+		 request->header.sbp,
+		 request->sense,
+		 (size_t) request->header.sb_len_wr );
+	}
+	memory_copy(
+	 buffer,
+	 &( request->header ),
+	 sizeof( sg_io_hdr_t ) );
+
+	for( request_index = 1;
+	     request_index < file->number_of_requests;
+	     request_index++ )
+	{
+		file->requests[ request_index - 1 ] = file->requests[ request_index ];
+	}
+	file->number_of_requests -= 1;
+
+	tableau_test_sg_shim_unlock();
+
+	return( (ssize_t) sizeof( sg_io_hdr_t ) );
+}
+
+/* Interposed poll, which reports an emulated device readable once its oldest command completed
+ * Returns the number of ready file descriptors, 0 on timeout or -1 on error
+ */
+int poll(
+     struct pollfd *file_descriptors,
+     nfds_t number_of_file_descriptors,
+     int timeout )
+{
+	uint64_t completion_time = 0;
+	uint64_t current_time    = 0;
+	uint64_t wake_time       = 0;
+	int has_request          = 0;
+
+	tableau_test_sg_shim_lock();
+
+	tableau_test_sg_shim_initialize();
+
+	if( ( file_descriptors == NULL )
+	 || ( number_of_file_descriptors != 1 )
+	 || ( tableau_test_sg_shim_get_device(
+	       file_descriptors[ 0 ].fd ) == NULL ) )
+	{
+		tableau_test_sg_shim_unlock();
+
+		return( tableau_test_sg_shim_real_poll(
+		         file_descriptors,
+		         number_of_file_descriptors,
+		         timeout ) );
+	}
+	if( tableau_test_sg_shim_files[ file_descriptors[ 0 ].fd ].number_of_requests > 0 )
+	{
+		completion_time = tableau_test_sg_shim_files[ file_descriptors[ 0 ].fd ].requests[ 0 ].completion_time;
+		has_request     = 1;
+	}
+	tableau_test_sg_shim_unlock();
+
+	file_descriptors[ 0 ].revents = 0;
+
+	current_time = tableau_test_sg_shim_get_time();
+
+	if( ( has_request != 0 )
+	 && ( completion_time <= current_time ) )
+	{
+		file_descriptors[ 0 ].revents = file_descriptors[ 0 ].events & ( POLLIN | POLLOUT );
+
+		return( 1 );
+	}
+	if( timeout == 0 )
+	{
+		return( 0 );
+	}
+	wake_time = current_time + ( (uint64_t) timeout * 1000 );
+
+	if( ( has_request != 0 )
+	 && ( ( timeout < 0 )
+	  ||  ( completion_time < wake_time ) ) )
+	{
+		tableau_test_sg_shim_sleep_until(
+		 completion_time );
+
+		file_descriptors[ 0 ].revents = file_descriptors[ 0 ].events & ( POLLIN | POLLOUT );
+
+		return( 1 );
+	}
+	if( timeout < 0 )
+	{
+		/* The sg driver blocks indefinitely without outstanding commands
+		 */
+		errno = EINTR;
+
+		return( -1 );
+	}
+	tableau_test_sg_shim_sleep_until(
+	 wake_time );
+
+	return( 0 );
+}
+
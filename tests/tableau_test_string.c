@@ -0,0 +1,274 @@
+/*
+ * Library string functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_libtableau.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../libtableau/libtableau_string.h"
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+/* Tests the libtableau_string_trim_copy function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_string_trim_copy(
+     void )
+{
+	uint8_t destination[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t result           = 0;
+	int compare_result       = 0;
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 destination,
+	 0xff,
+	 16 );
+
+	result = libtableau_string_trim_copy(
+	          destination,
+	          (uint8_t *) "  MODEL   ",
+	          10,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SSIZE(
+	 "result",
+	 result,
+	 (ssize_t) 5 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compare_result = memory_compare(
+	                  destination,
+	                  "MODEL",
+	                  6 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "compare_result",
+	 compare_result,
+	 0 );
+
+	/* Test the end-of-string character directly follows the trimmed string
+	 */
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "destination[ 6 ]",
+	 destination[ 6 ],
+	 (uint8_t) 0xff );
+
+	/* Test a source without whitespace fills the destination up to the end-of-string character
+	 */
+	memory_set(
+	 destination,
+	 0xff,
+	 16 );
+
+	result = libtableau_string_trim_copy(
+	          destination,
+	          (uint8_t *) "SERIAL01",
+	          8,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SSIZE(
+	 "result",
+	 result,
+	 (ssize_t) 8 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compare_result = memory_compare(
+	                  destination,
+	                  "SERIAL01",
+	                  9 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "compare_result",
+	 compare_result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "destination[ 9 ]",
+	 destination[ 9 ],
+	 (uint8_t) 0xff );
+
+	/* Test a single character source
+	 */
+	memory_set(
+	 destination,
+	 0xff,
+	 16 );
+
+	result = libtableau_string_trim_copy(
+	          destination,
+	          (uint8_t *) "   1",
+	          4,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SSIZE(
+	 "result",
+	 result,
+	 (ssize_t) 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compare_result = memory_compare(
+	                  destination,
+	                  "1",
+	                  2 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "compare_result",
+	 compare_result,
+	 0 );
+
+	/* Test a source without readable characters
+	 */
+	result = libtableau_string_trim_copy(
+	          destination,
+	          (uint8_t *) " \t\x00 ",
+	          4,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SSIZE(
+	 "result",
+	 result,
+	 (ssize_t) 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_string_trim_copy(
+	          NULL,
+	          (uint8_t *) "MODEL",
+	          5,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SSIZE(
+	 "result",
+	 result,
+	 (ssize_t) -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_string_trim_copy(
+	          destination,
+	          NULL,
+	          5,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SSIZE(
+	 "result",
+	 result,
+	 (ssize_t) -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_string_trim_copy(
+	          destination,
+	          (uint8_t *) "MODEL",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SSIZE(
+	 "result",
+	 result,
+	 (ssize_t) -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_string_trim_copy",
+	 tableau_test_string_trim_copy );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,736 @@
+/*
+ * Tools checkpoint functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/checkpoint.h"
+
+#define TABLEAU_TEST_CHECKPOINT_MEDIA_SIZE	( 64 * 512 )
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define tableau_test_tools_checkpoint_remove( filename ) \
+	_wremove( filename )
+#else
+#define tableau_test_tools_checkpoint_remove( filename ) \
+	remove( filename )
+#endif
+
+/* Tests the checkpoint_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_checkpoint_initialize(
+     void )
+{
+	checkpoint_t *checkpoint = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = checkpoint_initialize(
+	          &checkpoint,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "checkpoint",
+	 checkpoint );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "checkpoint->number_of_extents",
+	 checkpoint->number_of_extents,
+	 0 );
+
+	result = checkpoint_free(
+	          &checkpoint,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "checkpoint",
+	 checkpoint );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = checkpoint_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checkpoint != NULL )
+	{
+		checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the checkpoint_copy_state_from_string function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_checkpoint_copy_state_from_string(
+     void )
+{
+	uint8_t state[ 4 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = checkpoint_copy_state_from_string(
+	          "00a1ff7e",
+	          8,
+	          state,
+	          4,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "state[ 0 ]",
+	 state[ 0 ],
+	 0x00 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "state[ 1 ]",
+	 state[ 1 ],
+	 0xa1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "state[ 2 ]",
+	 state[ 2 ],
+	 0xff );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "state[ 3 ]",
+	 state[ 3 ],
+	 0x7e );
+
+	/* Test error cases
+	 */
+	result = checkpoint_copy_state_from_string(
+	          "00a1ff",
+	          6,
+	          state,
+	          4,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checkpoint_copy_state_from_string(
+	          "00a1fx7e",
+	          8,
+	          state,
+	          4,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checkpoint_copy_state_from_string(
+	          NULL,
+	          8,
+	          state,
+	          4,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checkpoint_write and checkpoint_read functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_checkpoint_read(
+     void )
+{
+	const system_character_t *filename = _SYSTEM_STRING( "tableau_test_tools_checkpoint.checkpoint" );
+	FILE *file_stream                  = NULL;
+	checkpoint_t *checkpoint           = NULL;
+	checkpoint_t *read_checkpoint      = NULL;
+	libcerror_error_t *error           = NULL;
+	size_t state_index                 = 0;
+	int result                         = 0;
+
+	tableau_test_tools_checkpoint_remove(
+	 filename );
+
+	/* Initialize test
+	 */
+	result = checkpoint_initialize(
+	          &checkpoint,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = checkpoint_initialize(
+	          &read_checkpoint,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a checkpoint that does not exist
+	 */
+	result = checkpoint_read(
+	          read_checkpoint,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a round trip, the last extent is an inaccessible HPA beyond the media size
+	 */
+	narrow_string_copy(
+	 checkpoint->bridge_serial_number,
+	 "000ecc0000000001",
+	 17 );
+
+	narrow_string_copy(
+	 checkpoint->drive_serial_number,
+	 "WD-WCAV5A123456",
+	 16 );
+
+	narrow_string_copy(
+	 checkpoint->drive_model,
+	 "WDC WD20EARS-00MVWB0",
+	 21 );
+
+	checkpoint->media_size            = TABLEAU_TEST_CHECKPOINT_MEDIA_SIZE;
+	checkpoint->bytes_per_sector      = 512;
+	checkpoint->digest_types          = 0x07;
+	checkpoint->segment_size          = 16 * 512;
+	checkpoint->extent_offsets[ 0 ]   = 0;
+	checkpoint->extent_sizes[ 0 ]     = 48 * 512;
+	checkpoint->extent_offsets[ 1 ]   = 48 * 512;
+	checkpoint->extent_sizes[ 1 ]     = 16 * 512;
+	checkpoint->extent_offsets[ 2 ]   = 64 * 512;
+	checkpoint->extent_sizes[ 2 ]     = 8 * 512;
+	checkpoint->number_of_extents     = 3;
+	checkpoint->offset                = 32 * 512;
+	checkpoint->number_of_zero_blocks = 2;
+	checkpoint->zero_blocks_size      = 8192;
+
+	for( state_index = 0;
+	     state_index < DIGEST_PIPELINE_STATE_SIZE;
+	     state_index++ )
+	{
+		checkpoint->digest_state[ state_index ]              = (uint8_t) state_index;
+		checkpoint->extent_digest_states[ 0 ][ state_index ] = (uint8_t) ( 255 - state_index );
+	}
+	checkpoint->digest_state_is_set             = 1;
+	checkpoint->extent_digest_state_is_set[ 0 ] = 1;
+
+	result = checkpoint_write(
+	          checkpoint,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = checkpoint_read(
+	          read_checkpoint,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          read_checkpoint->drive_serial_number,
+	          checkpoint->drive_serial_number,
+	          32 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          read_checkpoint->drive_model,
+	          checkpoint->drive_model,
+	          64 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "read_checkpoint->media_size",
+	 read_checkpoint->media_size,
+	 checkpoint->media_size );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "read_checkpoint->bytes_per_sector",
+	 read_checkpoint->bytes_per_sector,
+	 checkpoint->bytes_per_sector );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "read_checkpoint->digest_types",
+	 read_checkpoint->digest_types,
+	 checkpoint->digest_types );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "read_checkpoint->segment_size",
+	 (uint64_t) read_checkpoint->segment_size,
+	 (uint64_t) checkpoint->segment_size );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "read_checkpoint->number_of_extents",
+	 read_checkpoint->number_of_extents,
+	 3 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "read_checkpoint->extent_offsets[ 1 ]",
+	 (int64_t) read_checkpoint->extent_offsets[ 1 ],
+	 (int64_t) checkpoint->extent_offsets[ 1 ] );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "read_checkpoint->extent_sizes[ 1 ]",
+	 read_checkpoint->extent_sizes[ 1 ],
+	 checkpoint->extent_sizes[ 1 ] );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "read_checkpoint->extent_offsets[ 2 ]",
+	 (int64_t) read_checkpoint->extent_offsets[ 2 ],
+	 (int64_t) checkpoint->extent_offsets[ 2 ] );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "read_checkpoint->extent_sizes[ 2 ]",
+	 read_checkpoint->extent_sizes[ 2 ],
+	 checkpoint->extent_sizes[ 2 ] );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "read_checkpoint->offset",
+	 (int64_t) read_checkpoint->offset,
+	 (int64_t) checkpoint->offset );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "read_checkpoint->number_of_zero_blocks",
+	 read_checkpoint->number_of_zero_blocks,
+	 checkpoint->number_of_zero_blocks );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "read_checkpoint->zero_blocks_size",
+	 read_checkpoint->zero_blocks_size,
+	 checkpoint->zero_blocks_size );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "read_checkpoint->digest_state_is_set",
+	 read_checkpoint->digest_state_is_set,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "read_checkpoint->extent_digest_state_is_set[ 0 ]",
+	 read_checkpoint->extent_digest_state_is_set[ 0 ],
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "read_checkpoint->extent_digest_state_is_set[ 1 ]",
+	 read_checkpoint->extent_digest_state_is_set[ 1 ],
+	 0 );
+
+	result = memory_compare(
+	          read_checkpoint->digest_state,
+	          checkpoint->digest_state,
+	          DIGEST_PIPELINE_STATE_SIZE );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          read_checkpoint->extent_digest_states[ 0 ],
+	          checkpoint->extent_digest_states[ 0 ],
+	          DIGEST_PIPELINE_STATE_SIZE );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a checkpoint with an offset beyond the media size
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"w" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "w" );
+#endif
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	fprintf(
+	 file_stream,
+	 "version\t0x1\nmedia_size\t0x00008000\nbytes_per_sector\t0x200\ndigest_types\t0x01\noffset\t0x00010000\n" );
+
+	file_stream_close(
+	 file_stream );
+
+	result = checkpoint_read(
+	          read_checkpoint,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a checkpoint with an extent that starts within the media and ends beyond it
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"w" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "w" );
+#endif
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	fprintf(
+	 file_stream,
+	 "version\t0x1\nmedia_size\t0x00008000\nbytes_per_sector\t0x200\ndigest_types\t0x01\nextent\t0x00000000\t0x00009000\noffset\t0x00004000\n" );
+
+	file_stream_close(
+	 file_stream );
+
+	result = checkpoint_read(
+	          read_checkpoint,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a checkpoint without an offset
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"w" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "w" );
+#endif
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	fprintf(
+	 file_stream,
+	 "version\t0x1\nmedia_size\t0x00008000\nbytes_per_sector\t0x200\ndigest_types\t0x01\n" );
+
+	file_stream_close(
+	 file_stream );
+
+	result = checkpoint_read(
+	          read_checkpoint,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = checkpoint_write(
+	          NULL,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checkpoint_read(
+	          read_checkpoint,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	tableau_test_tools_checkpoint_remove(
+	 filename );
+
+	result = checkpoint_free(
+	          &read_checkpoint,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = checkpoint_free(
+	          &checkpoint,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_checkpoint != NULL )
+	{
+		checkpoint_free(
+		 &read_checkpoint,
+		 NULL );
+	}
+	if( checkpoint != NULL )
+	{
+		checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	tableau_test_tools_checkpoint_remove(
+	 filename );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "checkpoint_initialize",
+	 tableau_test_tools_checkpoint_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "checkpoint_copy_state_from_string",
+	 tableau_test_tools_checkpoint_copy_state_from_string );
+
+	TABLEAU_TEST_RUN(
+	 "checkpoint_read",
+	 tableau_test_tools_checkpoint_read );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1197 @@
+/*
+ * Tools chunk compressor and chunk index functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+#include <time.h>
+
+#include "tableau_test_getopt.h"
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/chunk_compressor.h"
+#include "../tableautools/chunk_index.h"
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define tableau_test_tools_chunk_compressor_remove( filename ) \
+	_wremove( filename )
+#else
+#define tableau_test_tools_chunk_compressor_remove( filename ) \
+	remove( filename )
+#endif
+
+/* The test data consists of 3 full chunks and a partial chunk
+ */
+#define TABLEAU_TEST_CHUNK_DATA_SIZE			( ( 3 * CHUNK_COMPRESSOR_CHUNK_SIZE ) + 4096 )
+
+#define TABLEAU_TEST_BENCHMARK_BUFFER_SIZE		( 1024 * 1024 )
+#define TABLEAU_TEST_BENCHMARK_NUMBER_OF_BUFFERS	16
+
+enum TABLEAU_TEST_DATA_TYPES
+{
+	TABLEAU_TEST_DATA_TYPE_ZERO,
+	TABLEAU_TEST_DATA_TYPE_TEXT,
+	TABLEAU_TEST_DATA_TYPE_RANDOM,
+	TABLEAU_TEST_DATA_TYPE_MIXED
+};
+
+/* Fills a buffer with synthetic test data
+ * Text data repeats words from a small vocabulary, random data is generated
+ * with xorshift32 and mixed data alternates the other types per 64 KiB
+ */
+void tableau_test_tools_chunk_compressor_fill_data(
+      uint8_t *data,
+      size_t data_size,
+      int data_type )
+{
+	const char *words[ 8 ] = {
+		"the ", "acquisition ", "of ", "sector ", "data ", "from ", "device ", "write blocker\n" };
+
+	const char *word      = NULL;
+	size_t data_offset    = 0;
+	uint32_t random_value = 0x2545f491UL;
+	int fill_type         = data_type;
+
+	while( data_offset < data_size )
+	{
+		if( data_type == TABLEAU_TEST_DATA_TYPE_MIXED )
+		{
+			fill_type = (int) ( ( data_offset / CHUNK_COMPRESSOR_CHUNK_SIZE ) % 3 );
+		}
+		random_value ^= random_value << 13;
+		random_value ^= random_value >> 17;
+		random_value ^= random_value << 5;
+
+		if( fill_type == TABLEAU_TEST_DATA_TYPE_ZERO )
+		{
+			data[ data_offset++ ] = 0;
+		}
+		else if( fill_type == TABLEAU_TEST_DATA_TYPE_TEXT )
+		{
+			for( word = words[ random_value % 8 ];
+			     ( *word != 0 ) && ( data_offset < data_size );
+			     word++ )
+			{
+				data[ data_offset++ ] = (uint8_t) *word;
+			}
+		}
+		else
+		{
+			data[ data_offset++ ] = (uint8_t) random_value;
+		}
+	}
+}
+
+/* Tests the chunk_compressor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_chunk_compressor_initialize(
+     void )
+{
+	chunk_compressor_t *chunk_compressor = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_ZLIB )
+	/* Test regular cases
+	 */
+	result = chunk_compressor_initialize(
+	          &chunk_compressor,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE,
+	          TABLEAU_TEST_CHUNK_DATA_SIZE,
+	          CHUNK_COMPRESSOR_LEVEL_FAST,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_compressor",
+	 chunk_compressor );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "chunk_compressor->maximum_number_of_chunks",
+	 chunk_compressor->maximum_number_of_chunks,
+	 4 );
+
+	result = chunk_compressor_free(
+	          &chunk_compressor,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "chunk_compressor",
+	 chunk_compressor );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+#else
+	/* Test that compression is not available without zlib
+	 */
+	result = chunk_compressor_initialize(
+	          &chunk_compressor,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE,
+	          TABLEAU_TEST_CHUNK_DATA_SIZE,
+	          CHUNK_COMPRESSOR_LEVEL_FAST,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "chunk_compressor",
+	 chunk_compressor );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+#endif /* defined( HAVE_ZLIB ) */
+
+	/* Test error cases
+	 */
+	result = chunk_compressor_initialize(
+	          NULL,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE,
+	          TABLEAU_TEST_CHUNK_DATA_SIZE,
+	          CHUNK_COMPRESSOR_LEVEL_FAST,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_compressor_initialize(
+	          &chunk_compressor,
+	          0,
+	          TABLEAU_TEST_CHUNK_DATA_SIZE,
+	          CHUNK_COMPRESSOR_LEVEL_FAST,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "chunk_compressor",
+	 chunk_compressor );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_compressor_initialize(
+	          &chunk_compressor,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE,
+	          TABLEAU_TEST_CHUNK_DATA_SIZE,
+	          CHUNK_COMPRESSOR_LEVEL_NONE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "chunk_compressor",
+	 chunk_compressor );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_compressor != NULL )
+	{
+		chunk_compressor_free(
+		 &chunk_compressor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_ZLIB )
+
+/* Tests the chunk_compressor_compress and chunk_compressor_decompress functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_chunk_compressor_compress(
+     int data_type )
+{
+	chunk_compressor_t *chunk_compressor = NULL;
+	libcerror_error_t *error             = NULL;
+	uint8_t *data                        = NULL;
+	uint8_t *decompressed_data           = NULL;
+	size_t chunk_data_size               = 0;
+	size_t compressed_offset             = 0;
+	size_t data_offset                   = 0;
+	int chunk_index                      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * TABLEAU_TEST_CHUNK_DATA_SIZE );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	decompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * CHUNK_COMPRESSOR_CHUNK_SIZE );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "decompressed_data",
+	 decompressed_data );
+
+	tableau_test_tools_chunk_compressor_fill_data(
+	 data,
+	 TABLEAU_TEST_CHUNK_DATA_SIZE,
+	 data_type );
+
+	result = chunk_compressor_initialize(
+	          &chunk_compressor,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE,
+	          TABLEAU_TEST_CHUNK_DATA_SIZE,
+	          CHUNK_COMPRESSOR_LEVEL_BEST,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = chunk_compressor_compress(
+	          chunk_compressor,
+	          data,
+	          TABLEAU_TEST_CHUNK_DATA_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "chunk_compressor->number_of_chunks",
+	 chunk_compressor->number_of_chunks,
+	 4 );
+
+	for( chunk_index = 0;
+	     chunk_index < chunk_compressor->number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_data_size = CHUNK_COMPRESSOR_CHUNK_SIZE;
+
+		if( chunk_data_size > ( TABLEAU_TEST_CHUNK_DATA_SIZE - data_offset ) )
+		{
+			chunk_data_size = TABLEAU_TEST_CHUNK_DATA_SIZE - data_offset;
+		}
+		/* Random data does not compress and is stored uncompressed
+		 */
+		if( data_type == TABLEAU_TEST_DATA_TYPE_RANDOM )
+		{
+			TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+			 "chunk_compressed_size",
+			 (size_t) chunk_compressor->chunk_compressed_sizes[ chunk_index ],
+			 chunk_data_size );
+		}
+		else if( data_type == TABLEAU_TEST_DATA_TYPE_TEXT )
+		{
+			TABLEAU_TEST_ASSERT_LESS_THAN_UINT32(
+			 "chunk_compressed_size",
+			 chunk_compressor->chunk_compressed_sizes[ chunk_index ],
+			 (uint32_t) chunk_data_size );
+		}
+		result = chunk_compressor_decompress(
+		          &( chunk_compressor->compressed_data[ compressed_offset ] ),
+		          (size_t) chunk_compressor->chunk_compressed_sizes[ chunk_index ],
+		          decompressed_data,
+		          chunk_data_size,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          decompressed_data,
+		          &( data[ data_offset ] ),
+		          chunk_data_size );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		compressed_offset += (size_t) chunk_compressor->chunk_compressed_sizes[ chunk_index ];
+		data_offset       += chunk_data_size;
+	}
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_offset",
+	 compressed_offset,
+	 chunk_compressor->compressed_size );
+
+	/* Test error cases
+	 */
+	result = chunk_compressor_compress(
+	          NULL,
+	          data,
+	          TABLEAU_TEST_CHUNK_DATA_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_compressor_compress(
+	          chunk_compressor,
+	          data,
+	          TABLEAU_TEST_CHUNK_DATA_SIZE + 1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( data_type != TABLEAU_TEST_DATA_TYPE_RANDOM )
+	{
+		/* Test that a decompressed size mismatch is detected
+		 */
+		result = chunk_compressor_decompress(
+		          chunk_compressor->compressed_data,
+		          (size_t) chunk_compressor->chunk_compressed_sizes[ 0 ],
+		          decompressed_data,
+		          CHUNK_COMPRESSOR_CHUNK_SIZE - 1,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = chunk_compressor_free(
+	          &chunk_compressor,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 decompressed_data );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_compressor != NULL )
+	{
+		chunk_compressor_free(
+		 &chunk_compressor,
+		 NULL );
+	}
+	if( decompressed_data != NULL )
+	{
+		memory_free(
+		 decompressed_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_ZLIB ) */
+
+/* Tests the chunk_index_open_write, chunk_index_append_chunk, chunk_index_finalize,
+ * chunk_index_open_read and chunk_index_get_chunk_by_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_chunk_index_get_chunk_by_offset(
+     void )
+{
+	const system_character_t *filename = _SYSTEM_STRING( "tableau_test_tools_chunk_compressor.index" );
+	chunk_index_t *chunk_index         = NULL;
+	libcerror_error_t *error           = NULL;
+	size_t chunk_compressed_size       = 0;
+	size_t chunk_data_size             = 0;
+	off64_t chunk_compressed_offset    = 0;
+	off64_t chunk_media_offset         = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	tableau_test_tools_chunk_compressor_remove(
+	 filename );
+
+	result = chunk_index_initialize(
+	          &chunk_index,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = chunk_index_open_write(
+	          chunk_index,
+	          filename,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A chunk that ends at an extent boundary is shorter than the chunk size
+	 */
+	result = chunk_index_append_chunk(
+	          chunk_index,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE,
+	          100,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = chunk_index_append_chunk(
+	          chunk_index,
+	          1000,
+	          1000,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = chunk_index_append_chunk(
+	          chunk_index,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = chunk_index_append_chunk(
+	          chunk_index,
+	          512,
+	          20,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an incomplete index cannot be read
+	 */
+	result = chunk_index_get_chunk_by_offset(
+	          chunk_index,
+	          0,
+	          &chunk_media_offset,
+	          &chunk_data_size,
+	          &chunk_compressed_offset,
+	          &chunk_compressed_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_index_finalize(
+	          chunk_index,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_index->number_of_chunks",
+	 chunk_index->number_of_chunks,
+	 (uint64_t) 4 );
+
+	result = chunk_index_close(
+	          chunk_index,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = chunk_index_open_read(
+	          chunk_index,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_index->media_size",
+	 (uint64_t) chunk_index->media_size,
+	 (uint64_t) ( ( 2 * CHUNK_COMPRESSOR_CHUNK_SIZE ) + 1000 + 512 ) );
+
+	result = chunk_index_get_chunk_by_offset(
+	          chunk_index,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE - 1,
+	          &chunk_media_offset,
+	          &chunk_data_size,
+	          &chunk_compressed_offset,
+	          &chunk_compressed_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "chunk_media_offset",
+	 (int64_t) chunk_media_offset,
+	 (int64_t) 0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_compressed_size",
+	 chunk_compressed_size,
+	 (size_t) 100 );
+
+	result = chunk_index_get_chunk_by_offset(
+	          chunk_index,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE + 999,
+	          &chunk_media_offset,
+	          &chunk_data_size,
+	          &chunk_compressed_offset,
+	          &chunk_compressed_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "chunk_media_offset",
+	 (int64_t) chunk_media_offset,
+	 (int64_t) CHUNK_COMPRESSOR_CHUNK_SIZE );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_data_size",
+	 chunk_data_size,
+	 (size_t) 1000 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "chunk_compressed_offset",
+	 (int64_t) chunk_compressed_offset,
+	 (int64_t) 100 );
+
+	/* The chunk that follows the short chunk is not at a multiple of the chunk size
+	 */
+	result = chunk_index_get_chunk_by_offset(
+	          chunk_index,
+	          ( 2 * CHUNK_COMPRESSOR_CHUNK_SIZE ) + 999,
+	          &chunk_media_offset,
+	          &chunk_data_size,
+	          &chunk_compressed_offset,
+	          &chunk_compressed_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "chunk_media_offset",
+	 (int64_t) chunk_media_offset,
+	 (int64_t) ( CHUNK_COMPRESSOR_CHUNK_SIZE + 1000 ) );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_compressed_size",
+	 chunk_compressed_size,
+	 (size_t) CHUNK_COMPRESSOR_CHUNK_SIZE );
+
+	result = chunk_index_get_chunk_by_offset(
+	          chunk_index,
+	          ( 2 * CHUNK_COMPRESSOR_CHUNK_SIZE ) + 1000,
+	          &chunk_media_offset,
+	          &chunk_data_size,
+	          &chunk_compressed_offset,
+	          &chunk_compressed_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_data_size",
+	 chunk_data_size,
+	 (size_t) 512 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "chunk_compressed_offset",
+	 (int64_t) chunk_compressed_offset,
+	 (int64_t) ( 100 + 1000 + CHUNK_COMPRESSOR_CHUNK_SIZE ) );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_compressed_size",
+	 chunk_compressed_size,
+	 (size_t) 20 );
+
+	/* Test that an offset beyond the media size returns 0
+	 */
+	result = chunk_index_get_chunk_by_offset(
+	          chunk_index,
+	          ( 2 * CHUNK_COMPRESSOR_CHUNK_SIZE ) + 1000 + 512,
+	          &chunk_media_offset,
+	          &chunk_data_size,
+	          &chunk_compressed_offset,
+	          &chunk_compressed_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = chunk_index_get_chunk_by_offset(
+	          NULL,
+	          0,
+	          &chunk_media_offset,
+	          &chunk_data_size,
+	          &chunk_compressed_offset,
+	          &chunk_compressed_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_index_get_chunk_by_offset(
+	          chunk_index,
+	          -1,
+	          &chunk_media_offset,
+	          &chunk_data_size,
+	          &chunk_compressed_offset,
+	          &chunk_compressed_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_index_close(
+	          chunk_index,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that an existing index is not overwritten
+	 */
+	result = chunk_index_open_write(
+	          chunk_index,
+	          filename,
+	          CHUNK_COMPRESSOR_CHUNK_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = chunk_index_free(
+	          &chunk_index,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	tableau_test_tools_chunk_compressor_remove(
+	 filename );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_index != NULL )
+	{
+		chunk_index_free(
+		 &chunk_index,
+		 NULL );
+	}
+	tableau_test_tools_chunk_compressor_remove(
+	 filename );
+
+	return( 0 );
+}
+
+#if defined( HAVE_ZLIB )
+
+/* Retrieves the current time in microseconds
+ * Returns the current time
+ */
+int64_t tableau_test_tools_chunk_compressor_get_time(
+         void )
+{
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) == 0 )
+	{
+		return( ( (int64_t) time_value.tv_sec * 1000000 ) + ( (int64_t) time_value.tv_nsec / 1000 ) );
+	}
+#endif
+	return( (int64_t) time( NULL ) * 1000000 );
+}
+
+/* Benchmarks compressing synthetic data of a specific type at both compression levels
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_tools_chunk_compressor_benchmark_run(
+     uint8_t *data,
+     const char *data_description,
+     int number_of_buffers,
+     libcerror_error_t **error )
+{
+	char description[ 32 ];
+
+	chunk_compressor_t *chunk_compressor = NULL;
+	int64_t elapsed_time                 = 0;
+	int64_t start_time                   = 0;
+	uint64_t bytes_per_second            = 0;
+	uint64_t compressed_size             = 0;
+	int buffer_index                     = 0;
+	int compression_level                = 0;
+
+	for( compression_level = CHUNK_COMPRESSOR_LEVEL_FAST;
+	     compression_level <= CHUNK_COMPRESSOR_LEVEL_BEST;
+	     compression_level += CHUNK_COMPRESSOR_LEVEL_BEST - CHUNK_COMPRESSOR_LEVEL_FAST )
+	{
+		if( chunk_compressor_initialize(
+		     &chunk_compressor,
+		     CHUNK_COMPRESSOR_CHUNK_SIZE,
+		     TABLEAU_TEST_BENCHMARK_BUFFER_SIZE,
+		     compression_level,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		compressed_size = 0;
+		start_time      = tableau_test_tools_chunk_compressor_get_time();
+
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			if( chunk_compressor_compress(
+			     chunk_compressor,
+			     data,
+			     TABLEAU_TEST_BENCHMARK_BUFFER_SIZE,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			compressed_size += (uint64_t) chunk_compressor->compressed_size;
+		}
+		elapsed_time = tableau_test_tools_chunk_compressor_get_time() - start_time;
+
+		if( chunk_compressor_free(
+		     &chunk_compressor,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( elapsed_time <= 0 )
+		{
+			elapsed_time = 1;
+		}
+		bytes_per_second = ( (uint64_t) number_of_buffers * TABLEAU_TEST_BENCHMARK_BUFFER_SIZE * 1000000 ) / (uint64_t) elapsed_time;
+
+		snprintf(
+		 description,
+		 32,
+		 "%s %s",
+		 data_description,
+		 ( compression_level == CHUNK_COMPRESSOR_LEVEL_BEST ) ? "best" : "fast" );
+
+		fprintf(
+		 stdout,
+		 "\t%-32s: %6" PRIu64 " MiB/s (%" PRIi64 " us), %3" PRIu64 "%% of data\n",
+		 description,
+		 bytes_per_second / ( 1024 * 1024 ),
+		 elapsed_time,
+		 ( compressed_size * 100 ) / ( (uint64_t) number_of_buffers * TABLEAU_TEST_BENCHMARK_BUFFER_SIZE ) );
+	}
+	return( 1 );
+
+on_error:
+	if( chunk_compressor != NULL )
+	{
+		chunk_compressor_free(
+		 &chunk_compressor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks compressing zero, text-like, random and mixed data
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_chunk_compressor_benchmark(
+     int number_of_buffers )
+{
+	const char *data_descriptions[ 4 ] = {
+		"Zero", "Text", "Random", "Mixed" };
+
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	int data_type            = 0;
+	int result               = 0;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * TABLEAU_TEST_BENCHMARK_BUFFER_SIZE );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	fprintf(
+	 stdout,
+	 "Chunk compressor benchmark: %d buffers of %d bytes in chunks of %d bytes\n",
+	 number_of_buffers,
+	 TABLEAU_TEST_BENCHMARK_BUFFER_SIZE,
+	 CHUNK_COMPRESSOR_CHUNK_SIZE );
+
+	for( data_type = TABLEAU_TEST_DATA_TYPE_ZERO;
+	     data_type <= TABLEAU_TEST_DATA_TYPE_MIXED;
+	     data_type++ )
+	{
+		tableau_test_tools_chunk_compressor_fill_data(
+		 data,
+		 TABLEAU_TEST_BENCHMARK_BUFFER_SIZE,
+		 data_type );
+
+		result = tableau_test_tools_chunk_compressor_benchmark_run(
+		          data,
+		          data_descriptions[ data_type ],
+		          number_of_buffers,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		TABLEAU_TEST_FPRINT_ERROR(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_ZLIB ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_integer_t option = 0;
+	int benchmark           = 0;
+
+	while( ( option = tableau_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				benchmark = 1;
+
+				break;
+		}
+	}
+	TABLEAU_TEST_RUN(
+	 "chunk_compressor_initialize",
+	 tableau_test_tools_chunk_compressor_initialize );
+
+#if defined( HAVE_ZLIB )
+	TABLEAU_TEST_RUN_WITH_ARGS(
+	 "chunk_compressor_compress",
+	 tableau_test_tools_chunk_compressor_compress,
+	 TABLEAU_TEST_DATA_TYPE_TEXT );
+
+	TABLEAU_TEST_RUN_WITH_ARGS(
+	 "chunk_compressor_compress",
+	 tableau_test_tools_chunk_compressor_compress,
+	 TABLEAU_TEST_DATA_TYPE_RANDOM );
+
+	TABLEAU_TEST_RUN_WITH_ARGS(
+	 "chunk_compressor_compress",
+	 tableau_test_tools_chunk_compressor_compress,
+	 TABLEAU_TEST_DATA_TYPE_MIXED );
+#endif
+
+	TABLEAU_TEST_RUN(
+	 "chunk_index_get_chunk_by_offset",
+	 tableau_test_tools_chunk_index_get_chunk_by_offset );
+
+#if defined( HAVE_ZLIB )
+	if( benchmark != 0 )
+	{
+		TABLEAU_TEST_RUN_WITH_ARGS(
+		 "chunk_compressor_benchmark",
+		 tableau_test_tools_chunk_compressor_benchmark,
+		 TABLEAU_TEST_BENCHMARK_NUMBER_OF_BUFFERS );
+	}
+#endif
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
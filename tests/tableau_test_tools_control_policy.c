@@ -0,0 +1,639 @@
+/*
+ * Tools policy functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/control_policy.h"
+
+/* The HMAC-SHA256 test cases 2 and 6 of RFC 4231
+ */
+uint8_t tableau_test_tools_control_policy_hmac2[ 32 ] = {
+	0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xc7,
+	0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83, 0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43 };
+
+uint8_t tableau_test_tools_control_policy_hmac6[ 32 ] = {
+	0x60, 0xe4, 0x31, 0x59, 0x1e, 0xe0, 0xb6, 0x7f, 0x0d, 0x8a, 0x26, 0xaa, 0xcb, 0xf5, 0xb7, 0x7f,
+	0x8e, 0x0b, 0xc6, 0x21, 0x37, 0x28, 0xc5, 0x14, 0x05, 0x46, 0x04, 0x0f, 0x0e, 0xe3, 0x7f, 0x54 };
+
+/* A policy signed with the key "secret"
+ */
+const char *tableau_test_tools_control_policy_signed = \
+	"# Intake\n"
+	"action\tremove_dco\n"
+	"bridge_serial_number\t0000000000000000\n"
+	"drive_serial_number\t*\n"
+	"signature\t94c5f914a29fb109c7328cf565b80cbaec8efda587e86f33caef5c028cb05763\n";
+
+/* Tests the control_policy_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_control_policy_initialize(
+     void )
+{
+	control_policy_t *control_policy = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = control_policy_initialize(
+	          &control_policy,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "control_policy",
+	 control_policy );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = control_policy_free(
+	          &control_policy,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "control_policy",
+	 control_policy );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = control_policy_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( control_policy != NULL )
+	{
+		control_policy_free(
+		 &control_policy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the control_policy_calculate_hmac function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_control_policy_calculate_hmac(
+     void )
+{
+	uint8_t hmac[ SHA256_HASH_SIZE ];
+	uint8_t key[ 131 ];
+
+	libcerror_error_t *error = NULL;
+	const char *data         = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	data = "what do ya want for nothing?";
+
+	result = control_policy_calculate_hmac(
+	          (uint8_t *) "Jefe",
+	          4,
+	          (uint8_t *) data,
+	          narrow_string_length(
+	           data ),
+	          hmac,
+	          SHA256_HASH_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hmac,
+	          tableau_test_tools_control_policy_hmac2,
+	          SHA256_HASH_SIZE );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A key that is larger than the block size is hashed first
+	 */
+	memory_set(
+	 key,
+	 0xaa,
+	 131 );
+
+	data = "Test Using Larger Than Block-Size Key - Hash Key First";
+
+	result = control_policy_calculate_hmac(
+	          key,
+	          131,
+	          (uint8_t *) data,
+	          narrow_string_length(
+	           data ),
+	          hmac,
+	          SHA256_HASH_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hmac,
+	          tableau_test_tools_control_policy_hmac6,
+	          SHA256_HASH_SIZE );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = control_policy_calculate_hmac(
+	          (uint8_t *) "Jefe",
+	          4,
+	          (uint8_t *) data,
+	          narrow_string_length(
+	           data ),
+	          hmac,
+	          SHA256_HASH_SIZE - 1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the control_policy_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_control_policy_read_data(
+     void )
+{
+	char data[ 256 ];
+
+	control_policy_t *control_policy = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t data_size                 = 0;
+	int result                       = 0;
+
+	result = control_policy_initialize(
+	          &control_policy,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "control_policy",
+	 control_policy );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_size = narrow_string_length(
+	             tableau_test_tools_control_policy_signed );
+
+	/* Test error cases
+	 */
+	result = control_policy_read_data(
+	          control_policy,
+	          (uint8_t *) tableau_test_tools_control_policy_signed,
+	          data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a policy signed with another key
+	 */
+	result = control_policy_set_key(
+	          control_policy,
+	          (uint8_t *) "Secret",
+	          6,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = control_policy_read_data(
+	          control_policy,
+	          (uint8_t *) tableau_test_tools_control_policy_signed,
+	          data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = control_policy_set_key(
+	          control_policy,
+	          (uint8_t *) "secret",
+	          6,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = control_policy_read_data(
+	          control_policy,
+	          (uint8_t *) tableau_test_tools_control_policy_signed,
+	          data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "control_policy->action",
+	 control_policy->action,
+	 CONTROL_POLICY_ACTION_REMOVE_DCO );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "control_policy->number_of_bridge_serial_numbers",
+	 control_policy->number_of_bridge_serial_numbers,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "control_policy->number_of_drive_serial_numbers",
+	 control_policy->number_of_drive_serial_numbers,
+	 1 );
+
+	result = control_policy_matches_device(
+	          control_policy,
+	          "0000000000000000",
+	          "FAKE-SERIAL-0001",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = control_policy_matches_device(
+	          control_policy,
+	          "0000000000000001",
+	          "FAKE-SERIAL-0001",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = control_policy_matches_device(
+	          control_policy,
+	          "",
+	          "FAKE-SERIAL-0001",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a policy that was modified after it was signed
+	 */
+	result = narrow_string_snprintf(
+	          data,
+	          256,
+	          "%s",
+	          tableau_test_tools_control_policy_signed );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 (int) data_size );
+
+	data[ 48 ] = '1';
+
+	result = control_policy_read_data(
+	          control_policy,
+	          (uint8_t *) data,
+	          data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a policy with data after the signature
+	 */
+	result = narrow_string_snprintf(
+	          data,
+	          256,
+	          "%sdrive_serial_number\tFAKE-SERIAL-0002\n",
+	          tableau_test_tools_control_policy_signed );
+
+	TABLEAU_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 (int) data_size );
+
+	result = control_policy_read_data(
+	          control_policy,
+	          (uint8_t *) data,
+	          narrow_string_length(
+	           data ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a policy without a signature
+	 */
+	result = control_policy_read_data(
+	          control_policy,
+	          (uint8_t *) "action\tremove_dco\n",
+	          18,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a signed policy with an unsupported name
+	 */
+	result = narrow_string_snprintf(
+	          data,
+	          256,
+	          "action\tremove_dco\nvolume_serial_number\t1234\n"
+	          "signature\tce3873b39add711f144d664ea01b05665763b6e6078db2869b1073899059c614\n" );
+
+	TABLEAU_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = control_policy_read_data(
+	          control_policy,
+	          (uint8_t *) data,
+	          narrow_string_length(
+	           data ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a signed policy without serial numbers
+	 */
+	result = narrow_string_snprintf(
+	          data,
+	          256,
+	          "action\tremove_dco\n"
+	          "signature\t91a4aedd928db6193a9ad4d3b7cf553e611bac2e30f14ae9eb1780fd9ad977ee\n" );
+
+	TABLEAU_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = control_policy_read_data(
+	          control_policy,
+	          (uint8_t *) data,
+	          narrow_string_length(
+	           data ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = control_policy_free(
+	          &control_policy,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( control_policy != NULL )
+	{
+		control_policy_free(
+		 &control_policy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "control_policy_initialize",
+	 tableau_test_tools_control_policy_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "control_policy_calculate_hmac",
+	 tableau_test_tools_control_policy_calculate_hmac );
+
+	TABLEAU_TEST_RUN(
+	 "control_policy_read_data",
+	 tableau_test_tools_control_policy_read_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
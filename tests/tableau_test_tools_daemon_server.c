@@ -0,0 +1,651 @@
+/*
+ * Tools daemon server functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/daemon_server.h"
+#include "../tableautools/daemon_state.h"
+
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+#define TABLEAU_TEST_TOOLS_DAEMON_SERVER_SOCKET_PATH	"tableau_test_tools_daemon_server.sock"
+
+/* Tests the daemon_server_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_daemon_server_initialize(
+     void )
+{
+	daemon_server_t *daemon_server = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = daemon_server_initialize(
+	          &daemon_server,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "daemon_server",
+	 daemon_server );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "daemon_server->socket_descriptor",
+	 daemon_server->socket_descriptor,
+	 -1 );
+
+	result = daemon_server_free(
+	          &daemon_server,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "daemon_server",
+	 daemon_server );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = daemon_server_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( daemon_server != NULL )
+	{
+		daemon_server_free(
+		 &daemon_server,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+
+/* Connects to the socket of the daemon server and sends a request
+ * Returns the socket descriptor if successful or -1 on error
+ */
+int tableau_test_tools_daemon_server_send_request(
+     const char *request,
+     size_t request_length )
+{
+	struct sockaddr_un socket_address;
+
+	int socket_descriptor = -1;
+
+	memory_set(
+	 &socket_address,
+	 0,
+	 sizeof( struct sockaddr_un ) );
+
+	socket_address.sun_family = AF_UNIX;
+
+	narrow_string_copy(
+	 socket_address.sun_path,
+	 TABLEAU_TEST_TOOLS_DAEMON_SERVER_SOCKET_PATH,
+	 narrow_string_length( TABLEAU_TEST_TOOLS_DAEMON_SERVER_SOCKET_PATH ) );
+
+	socket_descriptor = socket(
+	                     AF_UNIX,
+	                     SOCK_STREAM,
+	                     0 );
+
+	if( socket_descriptor == -1 )
+	{
+		return( -1 );
+	}
+	if( connect(
+	     socket_descriptor,
+	     (struct sockaddr *) &socket_address,
+	     sizeof( struct sockaddr_un ) ) != 0 )
+	{
+		close(
+		 socket_descriptor );
+
+		return( -1 );
+	}
+	if( send(
+	     socket_descriptor,
+	     request,
+	     request_length,
+	     0 ) != (ssize_t) request_length )
+	{
+		close(
+		 socket_descriptor );
+
+		return( -1 );
+	}
+	return( socket_descriptor );
+}
+
+/* Reads the response of the daemon server
+ * Returns the number of bytes read
+ */
+size_t tableau_test_tools_daemon_server_read_response(
+        int socket_descriptor,
+        uint8_t *data,
+        size_t data_size )
+{
+	size_t data_offset = 0;
+	ssize_t read_count = 0;
+
+	while( data_offset < data_size )
+	{
+		read_count = recv(
+		              socket_descriptor,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              0 );
+
+		if( read_count <= 0 )
+		{
+			break;
+		}
+		data_offset += (size_t) read_count;
+	}
+	close(
+	 socket_descriptor );
+
+	return( data_offset );
+}
+
+/* Tests the daemon_server_handle_connection function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_daemon_server_handle_connection(
+     void )
+{
+	uint8_t response_data[ 1024 ];
+
+	daemon_server_t *daemon_server = NULL;
+	daemon_state_t *daemon_state   = NULL;
+	libcerror_error_t *error       = NULL;
+	size_t read_count              = 0;
+	uint32_t value_32bit           = 0;
+	int result                     = 0;
+	int socket_descriptor          = -1;
+
+	/* Initialize test
+	 */
+	result = daemon_state_initialize(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_state_append_device(
+	          daemon_state,
+	          _SYSTEM_STRING( "/dev/sg1" ),
+	          8,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A discovered device that is not supported is not reported
+	 */
+	result = daemon_state_append_device(
+	          daemon_state,
+	          _SYSTEM_STRING( "/dev/sg2" ),
+	          8,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	daemon_state->devices[ 1 ]->status = DAEMON_STATE_STATUS_UNSUPPORTED;
+
+	result = daemon_server_initialize(
+	          &daemon_server,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_server_open(
+	          daemon_server,
+	          TABLEAU_TEST_TOOLS_DAEMON_SERVER_SOCKET_PATH,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The request is sent before the connection is handled, since both
+	 * ends of the connection are in the same thread
+	 */
+	socket_descriptor = tableau_test_tools_daemon_server_send_request(
+	                     "binary\n",
+	                     7 );
+
+	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	 "socket_descriptor",
+	 socket_descriptor,
+	 -1 );
+
+	result = daemon_server_handle_connection(
+	          daemon_server,
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = tableau_test_tools_daemon_server_read_response(
+	              socket_descriptor,
+	              response_data,
+	              1024 );
+
+	socket_descriptor = -1;
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) ( DAEMON_SERVER_BINARY_HEADER_SIZE + DAEMON_STATE_BINARY_RECORD_SIZE ) );
+
+	result = memory_compare(
+	          response_data,
+	          DAEMON_SERVER_BINARY_SIGNATURE,
+	          8 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( response_data[ 12 ] ),
+	 value_32bit );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 1 );
+
+	socket_descriptor = tableau_test_tools_daemon_server_send_request(
+	                     "json\r\n",
+	                     6 );
+
+	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	 "socket_descriptor",
+	 socket_descriptor,
+	 -1 );
+
+	result = daemon_server_handle_connection(
+	          daemon_server,
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = tableau_test_tools_daemon_server_read_response(
+	              socket_descriptor,
+	              response_data,
+	              1024 );
+
+	socket_descriptor = -1;
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 daemon_state->devices[ 0 ]->json_record.data_size );
+
+	result = memory_compare(
+	          response_data,
+	          "{\"source\":\"/dev/sg1\",\"status\":\"pending\",",
+	          40 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	socket_descriptor = tableau_test_tools_daemon_server_send_request(
+	                     "metrics\n",
+	                     8 );
+
+	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	 "socket_descriptor",
+	 socket_descriptor,
+	 -1 );
+
+	result = daemon_server_handle_connection(
+	          daemon_server,
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = tableau_test_tools_daemon_server_read_response(
+	              socket_descriptor,
+	              response_data,
+	              1024 );
+
+	socket_descriptor = -1;
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) 1024 );
+
+	result = memory_compare(
+	          response_data,
+	          "# HELP tableau_bridge_up ",
+	          25 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* An unsupported request is answered with an error
+	 */
+	socket_descriptor = tableau_test_tools_daemon_server_send_request(
+	                     "status\n",
+	                     7 );
+
+	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	 "socket_descriptor",
+	 socket_descriptor,
+	 -1 );
+
+	result = daemon_server_handle_connection(
+	          daemon_server,
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = tableau_test_tools_daemon_server_read_response(
+	              socket_descriptor,
+	              response_data,
+	              1024 );
+
+	socket_descriptor = -1;
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) 27 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "daemon_server->number_of_requests",
+	 daemon_server->number_of_requests,
+	 (uint64_t) 3 );
+
+	/* Test error cases
+	 */
+	result = daemon_server_handle_connection(
+	          NULL,
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_server_handle_connection(
+	          daemon_server,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = daemon_server_close(
+	          daemon_server,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_server_free(
+	          &daemon_server,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_state_free(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( socket_descriptor != -1 )
+	{
+		close(
+		 socket_descriptor );
+	}
+	if( daemon_server != NULL )
+	{
+		daemon_server_free(
+		 &daemon_server,
+		 NULL );
+	}
+	if( daemon_state != NULL )
+	{
+		daemon_state_free(
+		 &daemon_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( DAEMON_SERVER_HAVE_UNIX_SOCKET ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "daemon_server_initialize",
+	 tableau_test_tools_daemon_server_initialize );
+
+#if defined( DAEMON_SERVER_HAVE_UNIX_SOCKET )
+
+	TABLEAU_TEST_RUN(
+	 "daemon_server_handle_connection",
+	 tableau_test_tools_daemon_server_handle_connection );
+
+#endif /* defined( DAEMON_SERVER_HAVE_UNIX_SOCKET ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1469 @@
+/*
+ * Tools daemon state functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/daemon_state.h"
+#include "../tableautools/tableautools_time.h"
+
+#define TABLEAU_TEST_DAEMON_STATE_METRICS_SIZE	16384
+
+typedef struct tableau_test_tools_daemon_state_metrics tableau_test_tools_daemon_state_metrics_t;
+
+struct tableau_test_tools_daemon_state_metrics
+{
+	/* The data
+	 */
+	char data[ TABLEAU_TEST_DAEMON_STATE_METRICS_SIZE ];
+
+	/* The size of the data
+	 */
+	size_t data_size;
+};
+
+/* Appends metrics data to a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_tools_daemon_state_append_metrics(
+     const uint8_t *data,
+     size_t data_size,
+     tableau_test_tools_daemon_state_metrics_t *metrics,
+     libcerror_error_t **error TABLEAU_TEST_ATTRIBUTE_UNUSED )
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( metrics->data_size + data_size ) >= TABLEAU_TEST_DAEMON_STATE_METRICS_SIZE )
+	{
+		return( -1 );
+	}
+	memory_copy(
+	 &( metrics->data[ metrics->data_size ] ),
+	 data,
+	 data_size );
+
+	metrics->data_size += data_size;
+
+	metrics->data[ metrics->data_size ] = 0;
+
+	return( 1 );
+}
+
+/* Tests the daemon_state_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_daemon_state_initialize(
+     void )
+{
+	daemon_state_t *daemon_state = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = daemon_state_initialize(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "daemon_state",
+	 daemon_state );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "daemon_state->poll_interval",
+	 daemon_state->poll_interval,
+	 1000 );
+
+	result = daemon_state_free(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "daemon_state",
+	 daemon_state );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = daemon_state_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( daemon_state != NULL )
+	{
+		daemon_state_free(
+		 &daemon_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the daemon_state_set_poll_interval function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_daemon_state_set_poll_interval(
+     void )
+{
+	daemon_state_t *daemon_state = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = daemon_state_initialize(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "daemon_state",
+	 daemon_state );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = daemon_state_set_poll_interval(
+	          daemon_state,
+	          _SYSTEM_STRING( "250" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "daemon_state->poll_interval",
+	 daemon_state->poll_interval,
+	 250 );
+
+	result = daemon_state_set_poll_interval(
+	          daemon_state,
+	          _SYSTEM_STRING( "99" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_state_set_poll_interval(
+	          daemon_state,
+	          _SYSTEM_STRING( "3600001" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_state_set_poll_interval(
+	          daemon_state,
+	          _SYSTEM_STRING( "often" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "daemon_state->poll_interval",
+	 daemon_state->poll_interval,
+	 250 );
+
+	/* Test error cases
+	 */
+	result = daemon_state_set_poll_interval(
+	          NULL,
+	          _SYSTEM_STRING( "250" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_state_set_poll_interval(
+	          daemon_state,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = daemon_state_free(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( daemon_state != NULL )
+	{
+		daemon_state_free(
+		 &daemon_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the daemon_state_append_device function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_daemon_state_append_device(
+     void )
+{
+	daemon_state_t *daemon_state = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = daemon_state_initialize(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "daemon_state",
+	 daemon_state );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = daemon_state_append_device(
+	          daemon_state,
+	          _SYSTEM_STRING( "/dev/sg1" ),
+	          8,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "daemon_state->devices[ 0 ]->flags",
+	 daemon_state->devices[ 0 ]->flags,
+	 DAEMON_STATE_FLAG_DISCOVERED );
+
+	/* A discovered device that is also specified is no longer
+	 * considered discovered
+	 */
+	result = daemon_state_append_device(
+	          daemon_state,
+	          _SYSTEM_STRING( "/dev/sg1" ),
+	          8,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "daemon_state->number_of_devices",
+	 daemon_state->number_of_devices,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "daemon_state->devices[ 0 ]->flags",
+	 daemon_state->devices[ 0 ]->flags,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "daemon_state->devices[ 0 ]->status",
+	 daemon_state->devices[ 0 ]->status,
+	 DAEMON_STATE_STATUS_PENDING );
+
+	result = narrow_string_compare(
+	          daemon_state->devices[ 0 ]->source_string,
+	          "/dev/sg1",
+	          9 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = daemon_state_append_device(
+	          NULL,
+	          _SYSTEM_STRING( "/dev/sg2" ),
+	          8,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_state_append_device(
+	          daemon_state,
+	          NULL,
+	          8,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_state_append_device(
+	          daemon_state,
+	          _SYSTEM_STRING( "/dev/sg2" ),
+	          0,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = daemon_state_free(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( daemon_state != NULL )
+	{
+		daemon_state_free(
+		 &daemon_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the daemon_state_device_update_records function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_daemon_state_device_update_records(
+     void )
+{
+	daemon_state_device_t *device = NULL;
+	daemon_state_t *daemon_state  = NULL;
+	libcerror_error_t *error      = NULL;
+	uint64_t value_64bit          = 0;
+	uint32_t value_32bit          = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = daemon_state_initialize(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "daemon_state",
+	 daemon_state );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_state_append_device(
+	          daemon_state,
+	          _SYSTEM_STRING( "/dev/sg1" ),
+	          8,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	device = daemon_state->devices[ 0 ];
+
+	device->status                  = DAEMON_STATE_STATUS_OK;
+	device->flags                   = DAEMON_STATE_FLAG_READ_ONLY | DAEMON_STATE_FLAG_DCO_IN_USE;
+	device->drive_number_of_sectors = 1000;
+	device->dco_number_of_sectors   = 24;
+	device->latency                 = 1500;
+	device->number_of_queries       = 3;
+
+	memory_copy(
+	 device->drive_serial_number,
+	 "WD-123",
+	 7 );
+
+	/* Test regular cases
+	 */
+	result = daemon_state_device_update_records(
+	          device,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "device->json_record.data_size",
+	 device->json_record.data_size,
+	 (size_t) 385 );
+
+	result = narrow_string_compare(
+	          device->json_record.data,
+	          "{\"source\":\"/dev/sg1\",\"status\":\"ok\",\"bridge_serial_number\":\"\",\"drive_model\":\"\",\"drive_serial_number\":\"WD-123\","
+	          "\"bridge_mode_read_only\":\"true\",\"drive_hpa_in_use\":\"false\",\"drive_dco_in_use\":\"true\",\"drive_number_of_sectors\":1000,"
+	          "\"hpa_number_of_sectors\":0,\"dco_number_of_sectors\":24,\"latency\":1500,\"maximum_latency\":0,\"number_of_queries\":3,"
+	          "\"number_of_errors\":0,\"poll_time\":0,\"discovered\":0}\n",
+	          385 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "device->binary_record[ 0 ]",
+	 device->binary_record[ 0 ],
+	 DAEMON_STATE_STATUS_OK );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "device->binary_record[ 1 ]",
+	 device->binary_record[ 1 ],
+	 ( DAEMON_STATE_FLAG_READ_ONLY | DAEMON_STATE_FLAG_DCO_IN_USE ) );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( device->binary_record[ 4 ] ),
+	 value_32bit );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 1000 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( device->binary_record[ 16 ] ),
+	 value_64bit );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 1500 );
+
+	result = narrow_string_compare(
+	          (char *) &( device->binary_record[ 64 ] ),
+	          "/dev/sg1",
+	          9 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          (char *) &( device->binary_record[ 256 ] ),
+	          "WD-123",
+	          7 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = daemon_state_device_update_records(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = daemon_state_free(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( daemon_state != NULL )
+	{
+		daemon_state_free(
+		 &daemon_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the daemon_state_poll_next_device function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_daemon_state_poll_next_device(
+     void )
+{
+	daemon_state_t *daemon_state = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+	int timeout                  = 0;
+
+	/* Initialize test
+	 */
+	result = daemon_state_initialize(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "daemon_state",
+	 daemon_state );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_state_append_device(
+	          daemon_state,
+	          _SYSTEM_STRING( "tableau_test_missing_device" ),
+	          27,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_state_append_device(
+	          daemon_state,
+	          _SYSTEM_STRING( "tableau_test_missing_discovered_device" ),
+	          38,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Both devices are due to be polled
+	 */
+	result = daemon_state_get_timeout(
+	          daemon_state,
+	          &timeout,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "timeout",
+	 timeout,
+	 0 );
+
+	result = daemon_state_poll_next_device(
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_state_poll_next_device(
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A specified device that cannot be opened is reported as an error,
+	 * a discovered device as unsupported
+	 */
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "daemon_state->devices[ 0 ]->status",
+	 daemon_state->devices[ 0 ]->status,
+	 DAEMON_STATE_STATUS_ERROR );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "daemon_state->devices[ 0 ]->number_of_errors",
+	 daemon_state->devices[ 0 ]->number_of_errors,
+	 (uint64_t) 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "daemon_state->devices[ 1 ]->status",
+	 daemon_state->devices[ 1 ]->status,
+	 DAEMON_STATE_STATUS_UNSUPPORTED );
+
+	/* No device is due to be polled until the poll interval passed
+	 */
+	result = daemon_state_poll_next_device(
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_state_get_timeout(
+	          daemon_state,
+	          &timeout,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_GREATER_THAN_INT(
+	 "timeout",
+	 timeout,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_LESS_THAN_INT(
+	 "timeout",
+	 timeout,
+	 1001 );
+
+	/* Test error cases
+	 */
+	result = daemon_state_poll_next_device(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_state_get_timeout(
+	          daemon_state,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = daemon_state_free(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( daemon_state != NULL )
+	{
+		daemon_state_free(
+		 &daemon_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+/* Tests the daemon_state_start_poll_thread and daemon_state_stop_poll_thread functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_daemon_state_poll_thread(
+     void )
+{
+	daemon_state_t *daemon_state = NULL;
+	libcerror_error_t *error     = NULL;
+	int iterator                 = 0;
+	int result                   = 0;
+	int status                   = 0;
+
+	/* Initialize test
+	 */
+	result = daemon_state_initialize(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "daemon_state",
+	 daemon_state );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_state_append_device(
+	          daemon_state,
+	          _SYSTEM_STRING( "tableau_test_missing_device" ),
+	          27,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = daemon_state_start_poll_thread(
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The device is polled by the poll thread, its status is read
+	 * while holding the devices lock
+	 */
+	for( iterator = 0;
+	     iterator < 500;
+	     iterator++ )
+	{
+		result = daemon_state_grab_for_read(
+		          daemon_state,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		status = daemon_state->devices[ 0 ]->status;
+
+		result = daemon_state_release_for_read(
+		          daemon_state,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( status != DAEMON_STATE_STATUS_PENDING )
+		{
+			break;
+		}
+		tableautools_time_sleep(
+		 10 );
+	}
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "status",
+	 status,
+	 DAEMON_STATE_STATUS_ERROR );
+
+	/* Test error cases
+	 */
+	result = daemon_state_start_poll_thread(
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_state_stop_poll_thread(
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "daemon_state->poll_thread",
+	 daemon_state->poll_thread );
+
+	/* Stopping a poll thread that is not running succeeds
+	 */
+	result = daemon_state_stop_poll_thread(
+	          daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_state_start_poll_thread(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_state_stop_poll_thread(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_state_grab_for_read(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = daemon_state_free(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( daemon_state != NULL )
+	{
+		daemon_state_free(
+		 &daemon_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+/* Tests the daemon_state_write_metrics function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_daemon_state_write_metrics(
+     void )
+{
+	tableau_test_tools_daemon_state_metrics_t metrics;
+
+	daemon_state_device_t *device = NULL;
+	daemon_state_t *daemon_state  = NULL;
+	libcerror_error_t *error      = NULL;
+	char *capacity_sample         = NULL;
+	char *hpa_sample              = NULL;
+	char *latency_header          = NULL;
+	char *up_sample               = NULL;
+	int result                    = 0;
+
+	metrics.data_size = 0;
+
+	/* Initialize test
+	 */
+	result = daemon_state_initialize(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = daemon_state_append_device(
+	          daemon_state,
+	          _SYSTEM_STRING( "/dev/sg1" ),
+	          8,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = daemon_state_append_device(
+	          daemon_state,
+	          _SYSTEM_STRING( "/dev/sg2" ),
+	          8,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	device = daemon_state->devices[ 0 ];
+
+	device->status                  = DAEMON_STATE_STATUS_OK;
+	device->flags                   = DAEMON_STATE_FLAG_QUERIED | DAEMON_STATE_FLAG_HPA_IN_USE;
+	device->drive_number_of_sectors = 1000;
+
+	memory_copy(
+	 device->bridge_serial_number,
+	 "0001",
+	 5 );
+
+	result = daemon_state_device_update_records(
+	          device,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = daemon_state_write_metrics(
+	          daemon_state,
+	          (int (*)(const uint8_t *, size_t, void *, libcerror_error_t **)) &tableau_test_tools_daemon_state_append_metrics,
+	          (void *) &metrics,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          metrics.data,
+	          "# HELP tableau_bridge_up ",
+	          25 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The samples of both devices follow the header of their family
+	 */
+	up_sample = narrow_string_search_string(
+	             metrics.data,
+	             "tableau_bridge_up{source=\"/dev/sg2\",bridge_serial_number=\"\"} 0\n",
+	             metrics.data_size );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "up_sample",
+	 up_sample );
+
+	latency_header = narrow_string_search_string(
+	                  metrics.data,
+	                  "# HELP tableau_bridge_query_latency_seconds ",
+	                  metrics.data_size );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "latency_header",
+	 latency_header );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "up_sample < latency_header",
+	 (int) ( up_sample < latency_header ),
+	 1 );
+
+	capacity_sample = narrow_string_search_string(
+	                   metrics.data,
+	                   "tableau_drive_capacity_sectors{source=\"/dev/sg1\",bridge_serial_number=\"0001\"} 1000\n",
+	                   metrics.data_size );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "capacity_sample",
+	 capacity_sample );
+
+	hpa_sample = narrow_string_search_string(
+	              metrics.data,
+	              "tableau_drive_hpa_present{source=\"/dev/sg1\",bridge_serial_number=\"0001\"} 1\n",
+	              metrics.data_size );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "hpa_sample",
+	 hpa_sample );
+
+	/* The state of a device that was never queried is not exposed
+	 */
+	capacity_sample = narrow_string_search_string(
+	                   metrics.data,
+	                   "tableau_drive_capacity_sectors{source=\"/dev/sg2\"",
+	                   metrics.data_size );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "capacity_sample",
+	 capacity_sample );
+
+	/* Test error cases
+	 */
+	result = daemon_state_write_metrics(
+	          NULL,
+	          (int (*)(const uint8_t *, size_t, void *, libcerror_error_t **)) &tableau_test_tools_daemon_state_append_metrics,
+	          (void *) &metrics,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_state_write_metrics(
+	          daemon_state,
+	          NULL,
+	          (void *) &metrics,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = daemon_state_free(
+	          &daemon_state,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( daemon_state != NULL )
+	{
+		daemon_state_free(
+		 &daemon_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "daemon_state_initialize",
+	 tableau_test_tools_daemon_state_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "daemon_state_set_poll_interval",
+	 tableau_test_tools_daemon_state_set_poll_interval );
+
+	TABLEAU_TEST_RUN(
+	 "daemon_state_append_device",
+	 tableau_test_tools_daemon_state_append_device );
+
+	TABLEAU_TEST_RUN(
+	 "daemon_state_device_update_records",
+	 tableau_test_tools_daemon_state_device_update_records );
+
+	TABLEAU_TEST_RUN(
+	 "daemon_state_poll_next_device",
+	 tableau_test_tools_daemon_state_poll_next_device );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+	TABLEAU_TEST_RUN(
+	 "daemon_state_poll_thread",
+	 tableau_test_tools_daemon_state_poll_thread );
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+	TABLEAU_TEST_RUN(
+	 "daemon_state_write_metrics",
+	 tableau_test_tools_daemon_state_write_metrics );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
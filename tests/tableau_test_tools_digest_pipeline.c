@@ -0,0 +1,1039 @@
+/*
+ * Tools digest pipeline functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "tableau_test_getopt.h"
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/digest_pipeline.h"
+#include "../tableautools/storage_media_buffer.h"
+#include "../tableautools/tableautools_libcthreads.h"
+
+#define TABLEAU_TEST_BENCHMARK_BUFFER_SIZE		( 1024 * 1024 )
+#define TABLEAU_TEST_BENCHMARK_NUMBER_OF_BUFFERS	256
+#define TABLEAU_TEST_BENCHMARK_BUFFERS_IN_FLIGHT	8
+
+/* The digests of "abc"
+ */
+const system_character_t *tableau_test_tools_digest_pipeline_md5_hash_string    = _SYSTEM_STRING( "900150983cd24fb0d6963f7d28e17f72" );
+const system_character_t *tableau_test_tools_digest_pipeline_sha1_hash_string   = _SYSTEM_STRING( "a9993e364706816aba3e25717850c26c9cd0d89d" );
+const system_character_t *tableau_test_tools_digest_pipeline_sha256_hash_string = _SYSTEM_STRING( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" );
+
+/* The release function used in the tests, counts the number of releases
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_tools_digest_pipeline_release_count(
+     storage_media_buffer_t *storage_media_buffer,
+     int *number_of_releases )
+{
+	if( storage_media_buffer == NULL )
+	{
+		return( -1 );
+	}
+	if( number_of_releases == NULL )
+	{
+		return( -1 );
+	}
+	*number_of_releases += 1;
+
+	return( 1 );
+}
+
+/* Tests the digest_pipeline_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_digest_pipeline_initialize(
+     void )
+{
+	digest_pipeline_t *digest_pipeline = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          DIGEST_PIPELINE_TYPE_MD5 | DIGEST_PIPELINE_TYPE_SHA1 | DIGEST_PIPELINE_TYPE_SHA256,
+	          4,
+	          NULL,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "digest_pipeline->number_of_digests",
+	 digest_pipeline->number_of_digests,
+	 3 );
+
+	result = digest_pipeline_free(
+	          &digest_pipeline,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_pipeline_initialize(
+	          NULL,
+	          DIGEST_PIPELINE_TYPE_MD5,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          0x08,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          DIGEST_PIPELINE_TYPE_MD5,
+	          -1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &digest_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_pipeline_free function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_digest_pipeline_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = digest_pipeline_free(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_pipeline_push_buffer and digest_pipeline_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_digest_pipeline_push_buffer(
+     int maximum_number_of_buffers )
+{
+	digest_pipeline_t *digest_pipeline           = NULL;
+	libcerror_error_t *error                     = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	int number_of_releases                       = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = storage_media_buffer_initialize(
+	          &storage_media_buffer,
+	          4096,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "storage_media_buffer",
+	 storage_media_buffer );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	storage_media_buffer->raw_buffer[ 0 ]      = (uint8_t) 'a';
+	storage_media_buffer->raw_buffer[ 1 ]      = (uint8_t) 'b';
+	storage_media_buffer->raw_buffer[ 2 ]      = (uint8_t) 'c';
+	storage_media_buffer->raw_buffer_data_size = 3;
+
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          DIGEST_PIPELINE_TYPE_MD5 | DIGEST_PIPELINE_TYPE_SHA1 | DIGEST_PIPELINE_TYPE_SHA256,
+	          maximum_number_of_buffers,
+	          NULL,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = digest_pipeline_push_buffer(
+	          digest_pipeline,
+	          storage_media_buffer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_pipeline_finalize(
+	          digest_pipeline,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          digest_pipeline->md5_hash_string,
+	          tableau_test_tools_digest_pipeline_md5_hash_string,
+	          33 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = system_string_compare(
+	          digest_pipeline->sha1_hash_string,
+	          tableau_test_tools_digest_pipeline_sha1_hash_string,
+	          41 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = system_string_compare(
+	          digest_pipeline->sha256_hash_string,
+	          tableau_test_tools_digest_pipeline_sha256_hash_string,
+	          65 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = digest_pipeline_push_buffer(
+	          NULL,
+	          storage_media_buffer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_pipeline_push_buffer(
+	          digest_pipeline,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_pipeline_free(
+	          &digest_pipeline,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the release function is called once per digest
+	 */
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          DIGEST_PIPELINE_TYPE_MD5 | DIGEST_PIPELINE_TYPE_SHA1 | DIGEST_PIPELINE_TYPE_SHA256,
+	          0,
+	          (int (*)(storage_media_buffer_t *, void *)) &tableau_test_tools_digest_pipeline_release_count,
+	          (void *) &number_of_releases,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_pipeline_push_buffer(
+	          digest_pipeline,
+	          storage_media_buffer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_releases",
+	 number_of_releases,
+	 3 );
+
+	result = digest_pipeline_free(
+	          &digest_pipeline,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_free(
+	          &storage_media_buffer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &digest_pipeline,
+		 NULL );
+	}
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Retrieves the current time in microseconds
+ * Returns the current time
+ */
+int64_t tableau_test_tools_digest_pipeline_get_time(
+         void )
+{
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) == 0 )
+	{
+		return( ( (int64_t) time_value.tv_sec * 1000000 ) + ( (int64_t) time_value.tv_nsec / 1000 ) );
+	}
+#endif
+	return( (int64_t) time( NULL ) * 1000000 );
+}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+typedef struct tableau_test_benchmark tableau_test_benchmark_t;
+
+struct tableau_test_benchmark
+{
+	/* The queue of storage media buffers no longer used by the digests
+	 */
+	libcthreads_queue_t *free_buffer_queue;
+
+	/* The mutex protecting the storage media buffer references
+	 */
+	libcthreads_mutex_t *references_mutex;
+};
+
+/* The release function used in the benchmark, returns the buffer to the
+ * free queue when all digests no longer use it
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_tools_digest_pipeline_benchmark_release(
+     storage_media_buffer_t *storage_media_buffer,
+     tableau_test_benchmark_t *benchmark )
+{
+	int number_of_references = 0;
+
+	if( libcthreads_mutex_grab(
+	     benchmark->references_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	storage_media_buffer->number_of_references -= 1;
+
+	number_of_references = storage_media_buffer->number_of_references;
+
+	if( libcthreads_mutex_release(
+	     benchmark->references_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( number_of_references > 0 )
+	{
+		return( 1 );
+	}
+	return( libcthreads_queue_push(
+	         benchmark->free_buffer_queue,
+	         (intptr_t *) storage_media_buffer,
+	         NULL ) );
+}
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+/* Runs a single benchmark of the digest pipeline
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_tools_digest_pipeline_benchmark_run(
+     storage_media_buffer_t **storage_media_buffers,
+     int number_of_buffers,
+     uint8_t digest_types,
+     int use_workers,
+     int64_t *elapsed_time,
+     libcerror_error_t **error )
+{
+	digest_pipeline_t *digest_pipeline           = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	int64_t start_time                           = 0;
+	int buffer_index                             = 0;
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	tableau_test_benchmark_t benchmark;
+#endif
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	benchmark.free_buffer_queue = NULL;
+	benchmark.references_mutex  = NULL;
+
+	if( use_workers != 0 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( benchmark.references_mutex ),
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libcthreads_queue_initialize(
+		     &( benchmark.free_buffer_queue ),
+		     TABLEAU_TEST_BENCHMARK_BUFFERS_IN_FLIGHT,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		for( buffer_index = 0;
+		     buffer_index < TABLEAU_TEST_BENCHMARK_BUFFERS_IN_FLIGHT;
+		     buffer_index++ )
+		{
+			if( libcthreads_queue_push(
+			     benchmark.free_buffer_queue,
+			     (intptr_t *) storage_media_buffers[ buffer_index ],
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		if( digest_pipeline_initialize(
+		     &digest_pipeline,
+		     digest_types,
+		     TABLEAU_TEST_BENCHMARK_BUFFERS_IN_FLIGHT,
+		     (int (*)(storage_media_buffer_t *, void *)) &tableau_test_tools_digest_pipeline_benchmark_release,
+		     (void *) &benchmark,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+	{
+		if( digest_pipeline_initialize(
+		     &digest_pipeline,
+		     digest_types,
+		     0,
+		     NULL,
+		     NULL,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	start_time = tableau_test_tools_digest_pipeline_get_time();
+
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+		if( use_workers != 0 )
+		{
+			/* Blocks until all digests released a buffer
+			 */
+			if( libcthreads_queue_pop(
+			     benchmark.free_buffer_queue,
+			     (intptr_t **) &storage_media_buffer,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			storage_media_buffer->number_of_references = digest_pipeline->number_of_digests;
+		}
+		else
+#endif
+		{
+			storage_media_buffer = storage_media_buffers[ buffer_index % TABLEAU_TEST_BENCHMARK_BUFFERS_IN_FLIGHT ];
+		}
+		if( digest_pipeline_push_buffer(
+		     digest_pipeline,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( digest_pipeline_finalize(
+	     digest_pipeline,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*elapsed_time = tableau_test_tools_digest_pipeline_get_time() - start_time;
+
+	if( digest_pipeline_free(
+	     &digest_pipeline,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( benchmark.free_buffer_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( benchmark.free_buffer_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( benchmark.references_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( benchmark.references_mutex ),
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &digest_pipeline,
+		 NULL );
+	}
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	if( benchmark.free_buffer_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( benchmark.free_buffer_queue ),
+		 NULL,
+		 NULL );
+	}
+	if( benchmark.references_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( benchmark.references_mutex ),
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Prints the throughput of a benchmark run
+ */
+void tableau_test_tools_digest_pipeline_benchmark_fprint(
+      const char *description,
+      int number_of_buffers,
+      int64_t elapsed_time )
+{
+	uint64_t bytes_per_second = 0;
+
+	if( elapsed_time <= 0 )
+	{
+		elapsed_time = 1;
+	}
+	bytes_per_second = ( (uint64_t) number_of_buffers * TABLEAU_TEST_BENCHMARK_BUFFER_SIZE * 1000000 ) / (uint64_t) elapsed_time;
+
+	fprintf(
+	 stdout,
+	 "\t%-32s: %6" PRIu64 " MiB/s (%" PRIi64 " us)\n",
+	 description,
+	 bytes_per_second / ( 1024 * 1024 ),
+	 elapsed_time );
+}
+
+/* Benchmarks calculating the MD5, SHA1 and SHA256 digests of synthetic data
+ * one after another and by the digest pipeline workers
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_digest_pipeline_benchmark(
+     int number_of_buffers )
+{
+	storage_media_buffer_t *storage_media_buffers[ TABLEAU_TEST_BENCHMARK_BUFFERS_IN_FLIGHT ];
+
+	libcerror_error_t *error = NULL;
+	int64_t elapsed_time     = 0;
+	int64_t sequential_time  = 0;
+	size_t buffer_offset     = 0;
+	uint32_t random_value    = 0x2545f491UL;
+	uint8_t all_digest_types = DIGEST_PIPELINE_TYPE_MD5 | DIGEST_PIPELINE_TYPE_SHA1 | DIGEST_PIPELINE_TYPE_SHA256;
+	int buffer_index         = 0;
+	int result               = 0;
+
+	for( buffer_index = 0;
+	     buffer_index < TABLEAU_TEST_BENCHMARK_BUFFERS_IN_FLIGHT;
+	     buffer_index++ )
+	{
+		storage_media_buffers[ buffer_index ] = NULL;
+	}
+	for( buffer_index = 0;
+	     buffer_index < TABLEAU_TEST_BENCHMARK_BUFFERS_IN_FLIGHT;
+	     buffer_index++ )
+	{
+		result = storage_media_buffer_initialize(
+		          &( storage_media_buffers[ buffer_index ] ),
+		          TABLEAU_TEST_BENCHMARK_BUFFER_SIZE,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Fill the buffer with pseudo random data (xorshift32)
+		 */
+		for( buffer_offset = 0;
+		     buffer_offset < TABLEAU_TEST_BENCHMARK_BUFFER_SIZE;
+		     buffer_offset++ )
+		{
+			random_value ^= random_value << 13;
+			random_value ^= random_value >> 17;
+			random_value ^= random_value << 5;
+
+			storage_media_buffers[ buffer_index ]->raw_buffer[ buffer_offset ] = (uint8_t) random_value;
+		}
+		storage_media_buffers[ buffer_index ]->raw_buffer_data_size = TABLEAU_TEST_BENCHMARK_BUFFER_SIZE;
+	}
+	fprintf(
+	 stdout,
+	 "Digest pipeline benchmark: %d buffers of %d bytes\n",
+	 number_of_buffers,
+	 TABLEAU_TEST_BENCHMARK_BUFFER_SIZE );
+
+	result = tableau_test_tools_digest_pipeline_benchmark_run(
+	          storage_media_buffers,
+	          number_of_buffers,
+	          DIGEST_PIPELINE_TYPE_MD5,
+	          0,
+	          &elapsed_time,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	tableau_test_tools_digest_pipeline_benchmark_fprint(
+	 "MD5",
+	 number_of_buffers,
+	 elapsed_time );
+
+	result = tableau_test_tools_digest_pipeline_benchmark_run(
+	          storage_media_buffers,
+	          number_of_buffers,
+	          DIGEST_PIPELINE_TYPE_SHA1,
+	          0,
+	          &elapsed_time,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	tableau_test_tools_digest_pipeline_benchmark_fprint(
+	 "SHA1",
+	 number_of_buffers,
+	 elapsed_time );
+
+	result = tableau_test_tools_digest_pipeline_benchmark_run(
+	          storage_media_buffers,
+	          number_of_buffers,
+	          DIGEST_PIPELINE_TYPE_SHA256,
+	          0,
+	          &elapsed_time,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	tableau_test_tools_digest_pipeline_benchmark_fprint(
+	 "SHA256",
+	 number_of_buffers,
+	 elapsed_time );
+
+	result = tableau_test_tools_digest_pipeline_benchmark_run(
+	          storage_media_buffers,
+	          number_of_buffers,
+	          all_digest_types,
+	          0,
+	          &sequential_time,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	tableau_test_tools_digest_pipeline_benchmark_fprint(
+	 "MD5+SHA1+SHA256 sequential",
+	 number_of_buffers,
+	 sequential_time );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	result = tableau_test_tools_digest_pipeline_benchmark_run(
+	          storage_media_buffers,
+	          number_of_buffers,
+	          all_digest_types,
+	          1,
+	          &elapsed_time,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	tableau_test_tools_digest_pipeline_benchmark_fprint(
+	 "MD5+SHA1+SHA256 pipelined",
+	 number_of_buffers,
+	 elapsed_time );
+
+	if( elapsed_time > 0 )
+	{
+		fprintf(
+		 stdout,
+		 "\t%-32s: %.2fx\n",
+		 "Pipelined speedup",
+		 (double) sequential_time / (double) elapsed_time );
+	}
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+	for( buffer_index = 0;
+	     buffer_index < TABLEAU_TEST_BENCHMARK_BUFFERS_IN_FLIGHT;
+	     buffer_index++ )
+	{
+		result = storage_media_buffer_free(
+		          &( storage_media_buffers[ buffer_index ] ),
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		TABLEAU_TEST_FPRINT_ERROR(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	for( buffer_index = 0;
+	     buffer_index < TABLEAU_TEST_BENCHMARK_BUFFERS_IN_FLIGHT;
+	     buffer_index++ )
+	{
+		if( storage_media_buffers[ buffer_index ] != NULL )
+		{
+			storage_media_buffer_free(
+			 &( storage_media_buffers[ buffer_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_integer_t option = 0;
+	int benchmark           = 0;
+
+	while( ( option = tableau_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				benchmark = 1;
+
+				break;
+		}
+	}
+	TABLEAU_TEST_RUN(
+	 "digest_pipeline_initialize",
+	 tableau_test_tools_digest_pipeline_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "digest_pipeline_free",
+	 tableau_test_tools_digest_pipeline_free );
+
+	TABLEAU_TEST_RUN_WITH_ARGS(
+	 "digest_pipeline_push_buffer",
+	 tableau_test_tools_digest_pipeline_push_buffer,
+	 0 );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+	TABLEAU_TEST_RUN_WITH_ARGS(
+	 "digest_pipeline_push_buffer",
+	 tableau_test_tools_digest_pipeline_push_buffer,
+	 4 );
+#endif
+
+	if( benchmark != 0 )
+	{
+		TABLEAU_TEST_RUN_WITH_ARGS(
+		 "digest_pipeline_benchmark",
+		 tableau_test_tools_digest_pipeline_benchmark,
+		 TABLEAU_TEST_BENCHMARK_NUMBER_OF_BUFFERS );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,413 @@
+/*
+ * Tools host topology functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/host_topology.h"
+
+/* Tests the host_topology_is_pci_address function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_host_topology_is_pci_address(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = host_topology_is_pci_address(
+	          "0000:00:14.0",
+	          12 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = host_topology_is_pci_address(
+	          "0000:3b:00.1",
+	          12 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = host_topology_is_pci_address(
+	          "pci0000:00",
+	          10 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = host_topology_is_pci_address(
+	          "0000:00:14:0",
+	          12 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = host_topology_is_pci_address(
+	          "0000:0G:14.0",
+	          12 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = host_topology_is_pci_address(
+	          "0:0:0:0",
+	          7 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = host_topology_is_pci_address(
+	          NULL,
+	          12 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the host_topology_get_controller_from_device_path function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_host_topology_get_controller_from_device_path(
+     void )
+{
+	char controller[ HOST_TOPOLOGY_CONTROLLER_SIZE ];
+
+	const char *ahci_device_path    = "/sys/devices/pci0000:00/0000:00:17.0/ata3/host2/target2:0:0/2:0:0:0";
+	const char *bridge_device_path  = "/sys/devices/pci0000:00/0000:00:01.0/0000:01:00.0/host0/port-0:0/end_device-0:0/target0:0:0/0:0:0:0";
+	const char *usb_device_path     = "/sys/devices/pci0000:00/0000:00:14.0/usb2/2-1/2-1:1.0/host6/target6:0:0/6:0:0:0";
+	const char *virtual_device_path = "/sys/devices/virtual/block/loop0";
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = host_topology_get_controller_from_device_path(
+	          usb_device_path,
+	          narrow_string_length( usb_device_path ),
+	          controller,
+	          HOST_TOPOLOGY_CONTROLLER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          controller,
+	          "0000:00:14.0",
+	          13 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = host_topology_get_controller_from_device_path(
+	          ahci_device_path,
+	          narrow_string_length( ahci_device_path ),
+	          controller,
+	          HOST_TOPOLOGY_CONTROLLER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          controller,
+	          "0000:00:17.0",
+	          13 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A host bus adapter behind a PCI bridge is the host controller
+	 */
+	result = host_topology_get_controller_from_device_path(
+	          bridge_device_path,
+	          narrow_string_length( bridge_device_path ),
+	          controller,
+	          HOST_TOPOLOGY_CONTROLLER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          controller,
+	          "0000:01:00.0",
+	          13 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = host_topology_get_controller_from_device_path(
+	          virtual_device_path,
+	          narrow_string_length( virtual_device_path ),
+	          controller,
+	          HOST_TOPOLOGY_CONTROLLER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = host_topology_get_controller_from_device_path(
+	          NULL,
+	          0,
+	          controller,
+	          HOST_TOPOLOGY_CONTROLLER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = host_topology_get_controller_from_device_path(
+	          usb_device_path,
+	          narrow_string_length( usb_device_path ),
+	          NULL,
+	          HOST_TOPOLOGY_CONTROLLER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = host_topology_get_controller_from_device_path(
+	          usb_device_path,
+	          narrow_string_length( usb_device_path ),
+	          controller,
+	          4,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the host_topology_get_controller function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_host_topology_get_controller(
+     void )
+{
+	char controller[ HOST_TOPOLOGY_CONTROLLER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = host_topology_get_controller(
+	          _SYSTEM_STRING( "/nonexistent/sg99" ),
+	          controller,
+	          HOST_TOPOLOGY_CONTROLLER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = host_topology_get_controller(
+	          NULL,
+	          controller,
+	          HOST_TOPOLOGY_CONTROLLER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = host_topology_get_controller(
+	          _SYSTEM_STRING( "/nonexistent/sg99" ),
+	          NULL,
+	          HOST_TOPOLOGY_CONTROLLER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "host_topology_is_pci_address",
+	 tableau_test_tools_host_topology_is_pci_address );
+
+	TABLEAU_TEST_RUN(
+	 "host_topology_get_controller_from_device_path",
+	 tableau_test_tools_host_topology_get_controller_from_device_path );
+
+	TABLEAU_TEST_RUN(
+	 "host_topology_get_controller",
+	 tableau_test_tools_host_topology_get_controller );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
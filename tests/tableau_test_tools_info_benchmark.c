@@ -0,0 +1,688 @@
+/*
+ * Tools benchmark functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/info_benchmark.h"
+
+/* Tests the info_benchmark_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_benchmark_initialize(
+     void )
+{
+	info_benchmark_t *info_benchmark = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = info_benchmark_initialize(
+	          &info_benchmark,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_benchmark",
+	 info_benchmark );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "info_benchmark->mode",
+	 info_benchmark->mode,
+	 INFO_BENCHMARK_MODE_QUERY );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "info_benchmark->number_of_samples",
+	 info_benchmark->number_of_samples,
+	 0 );
+
+	result = info_benchmark_free(
+	          &info_benchmark,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "info_benchmark",
+	 info_benchmark );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = info_benchmark_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_benchmark != NULL )
+	{
+		info_benchmark_free(
+		 &info_benchmark,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_benchmark_set_number_of_iterations function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_benchmark_set_number_of_iterations(
+     void )
+{
+	info_benchmark_t *info_benchmark = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = info_benchmark_initialize(
+	          &info_benchmark,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_benchmark",
+	 info_benchmark );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = info_benchmark_set_number_of_iterations(
+	          info_benchmark,
+	          _SYSTEM_STRING( "250" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "info_benchmark->number_of_iterations",
+	 info_benchmark->number_of_iterations,
+	 250 );
+
+	result = info_benchmark_set_number_of_iterations(
+	          info_benchmark,
+	          _SYSTEM_STRING( "0" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_benchmark_set_number_of_iterations(
+	          info_benchmark,
+	          _SYSTEM_STRING( "1000001" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_benchmark_set_number_of_iterations(
+	          info_benchmark,
+	          _SYSTEM_STRING( "many" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "info_benchmark->number_of_iterations",
+	 info_benchmark->number_of_iterations,
+	 250 );
+
+	/* Test error cases
+	 */
+	result = info_benchmark_set_number_of_iterations(
+	          NULL,
+	          _SYSTEM_STRING( "250" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_benchmark_set_number_of_iterations(
+	          info_benchmark,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_benchmark_free(
+	          &info_benchmark,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_benchmark != NULL )
+	{
+		info_benchmark_free(
+		 &info_benchmark,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_benchmark_calculate_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_benchmark_calculate_statistics(
+     void )
+{
+	info_benchmark_statistics_t statistics;
+
+	uint64_t durations[ 200 ];
+
+	libcerror_error_t *error = NULL;
+	int duration_index       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * The durations 100 to 1 in descending order
+	 */
+	for( duration_index = 0;
+	     duration_index < 100;
+	     duration_index++ )
+	{
+		durations[ duration_index ] = (uint64_t) ( 100 - duration_index );
+	}
+	result = info_benchmark_calculate_statistics(
+	          durations,
+	          100,
+	          &statistics,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.minimum",
+	 statistics.minimum,
+	 (uint64_t) 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.median",
+	 statistics.median,
+	 (uint64_t) 50 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.percentile_99",
+	 statistics.percentile_99,
+	 (uint64_t) 99 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.maximum",
+	 statistics.maximum,
+	 (uint64_t) 100 );
+
+	/* A single outlier in 200 durations is excluded by the 99th percentile
+	 */
+	for( duration_index = 0;
+	     duration_index < 200;
+	     duration_index++ )
+	{
+		durations[ duration_index ] = 1000;
+	}
+	durations[ 17 ] = 500000;
+
+	result = info_benchmark_calculate_statistics(
+	          durations,
+	          200,
+	          &statistics,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.percentile_99",
+	 statistics.percentile_99,
+	 (uint64_t) 1000 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.maximum",
+	 statistics.maximum,
+	 (uint64_t) 500000 );
+
+	/* A single duration determines every statistic
+	 */
+	durations[ 0 ] = 42;
+
+	result = info_benchmark_calculate_statistics(
+	          durations,
+	          1,
+	          &statistics,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.minimum",
+	 statistics.minimum,
+	 (uint64_t) 42 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.median",
+	 statistics.median,
+	 (uint64_t) 42 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.percentile_99",
+	 statistics.percentile_99,
+	 (uint64_t) 42 );
+
+	/* Test error cases
+	 */
+	result = info_benchmark_calculate_statistics(
+	          NULL,
+	          1,
+	          &statistics,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_benchmark_calculate_statistics(
+	          durations,
+	          0,
+	          &statistics,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_benchmark_calculate_statistics(
+	          durations,
+	          1,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the info_benchmark_fprint function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_benchmark_fprint(
+     void )
+{
+	char output_data[ 512 ];
+
+	info_benchmark_t *info_benchmark = NULL;
+	libcerror_error_t *error         = NULL;
+	FILE *stream                     = NULL;
+	size_t read_count                = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = info_benchmark_initialize(
+	          &info_benchmark,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_benchmark",
+	 info_benchmark );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	stream = tmpfile();
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	info_benchmark->notify_stream                      = stream;
+	info_benchmark->output_format                      = INFO_RECORD_FORMAT_CSV;
+	info_benchmark->mode                               = INFO_BENCHMARK_MODE_RAW;
+	info_benchmark->number_of_iterations               = 10;
+	info_benchmark->number_of_samples                  = 10;
+	info_benchmark->transport_statistics.minimum       = 100;
+	info_benchmark->transport_statistics.median        = 200;
+	info_benchmark->transport_statistics.percentile_99 = 300;
+	info_benchmark->transport_statistics.maximum       = 400;
+
+	/* Test regular cases
+	 * The CSV output consists of a header and a single record
+	 */
+	result = info_benchmark_fprint(
+	          info_benchmark,
+	          "/dev/sg1",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_stream_seek_offset(
+	     stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		goto on_error;
+	}
+	read_count = file_stream_read(
+	              stream,
+	              output_data,
+	              511 );
+
+	output_data[ read_count ] = 0;
+
+	result = narrow_string_compare(
+	          output_data,
+	          "source,bridge_serial_number,mode,",
+	          33 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ( narrow_string_search_string(
+	            output_data,
+	            "\n/dev/sg1,,raw,10,10,0,100,200,300,400,0,0,0,0\n",
+	            48 ) != NULL );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = info_benchmark_fprint(
+	          NULL,
+	          "/dev/sg1",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	file_stream_close(
+	 stream );
+
+	stream = NULL;
+
+	result = info_benchmark_free(
+	          &info_benchmark,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( info_benchmark != NULL )
+	{
+		info_benchmark_free(
+		 &info_benchmark,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "info_benchmark_initialize",
+	 tableau_test_tools_info_benchmark_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "info_benchmark_set_number_of_iterations",
+	 tableau_test_tools_info_benchmark_set_number_of_iterations );
+
+	TABLEAU_TEST_RUN(
+	 "info_benchmark_calculate_statistics",
+	 tableau_test_tools_info_benchmark_calculate_statistics );
+
+	TABLEAU_TEST_RUN(
+	 "info_benchmark_fprint",
+	 tableau_test_tools_info_benchmark_fprint );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,775 @@
+/*
+ * Tools inventory functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/info_inventory.h"
+
+/* Tests the info_inventory_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_inventory_initialize(
+     void )
+{
+	info_inventory_t *info_inventory = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = info_inventory_initialize(
+	          &info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_inventory",
+	 info_inventory );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "info_inventory->number_of_devices",
+	 info_inventory->number_of_devices,
+	 0 );
+
+	result = info_inventory_free(
+	          &info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "info_inventory",
+	 info_inventory );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = info_inventory_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_inventory != NULL )
+	{
+		info_inventory_free(
+		 &info_inventory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_inventory_append_device function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_inventory_append_device(
+     void )
+{
+	info_inventory_t *info_inventory = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = info_inventory_initialize(
+	          &info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_inventory",
+	 info_inventory );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = info_inventory_append_device(
+	          info_inventory,
+	          _SYSTEM_STRING( "/dev/sg1" ),
+	          8,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_inventory_append_device(
+	          info_inventory,
+	          _SYSTEM_STRING( "/dev/sg10" ),
+	          9,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "info_inventory->number_of_devices",
+	 info_inventory->number_of_devices,
+	 2 );
+
+	/* A device that is both specified and discovered is appended once
+	 * and is considered specified
+	 */
+	result = info_inventory_append_device(
+	          info_inventory,
+	          _SYSTEM_STRING( "/dev/sg1" ),
+	          8,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "info_inventory->number_of_devices",
+	 info_inventory->number_of_devices,
+	 2 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "info_inventory->devices[ 0 ]->is_discovered",
+	 info_inventory->devices[ 0 ]->is_discovered,
+	 0 );
+
+	result = info_inventory_append_device(
+	          info_inventory,
+	          _SYSTEM_STRING( "/dev/sg10" ),
+	          9,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "info_inventory->devices[ 1 ]->is_discovered",
+	 info_inventory->devices[ 1 ]->is_discovered,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = info_inventory_append_device(
+	          NULL,
+	          _SYSTEM_STRING( "/dev/sg2" ),
+	          8,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_inventory_append_device(
+	          info_inventory,
+	          NULL,
+	          8,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_inventory_append_device(
+	          info_inventory,
+	          _SYSTEM_STRING( "/dev/sg2" ),
+	          0,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_inventory_free(
+	          &info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_inventory != NULL )
+	{
+		info_inventory_free(
+		 &info_inventory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_inventory_sort_devices function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_inventory_sort_devices(
+     void )
+{
+	const system_character_t *sources[ 5 ] = {
+		_SYSTEM_STRING( "/dev/sg0" ),
+		_SYSTEM_STRING( "/dev/sg1" ),
+		_SYSTEM_STRING( "/dev/sg2" ),
+		_SYSTEM_STRING( "/dev/sg3" ),
+		_SYSTEM_STRING( "/dev/sg4" ) };
+
+	const char *serial_numbers[ 5 ] = {
+		"000ecc5a",
+		"",
+		"000ecc12",
+		"",
+		"000ecc12" };
+
+	int results[ 5 ] = { 1, -1, 1, 1, 1 };
+
+	info_inventory_t *info_inventory = NULL;
+	libcerror_error_t *error         = NULL;
+	int device_index                 = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = info_inventory_initialize(
+	          &info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_inventory",
+	 info_inventory );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( device_index = 4;
+	     device_index >= 0;
+	     device_index-- )
+	{
+		result = info_inventory_append_device(
+		          info_inventory,
+		          sources[ device_index ],
+		          8,
+		          0,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		narrow_string_copy(
+		 info_inventory->devices[ 4 - device_index ]->serial_number,
+		 serial_numbers[ device_index ],
+		 narrow_string_length( serial_numbers[ device_index ] ) + 1 );
+
+		info_inventory->devices[ 4 - device_index ]->result = results[ device_index ];
+	}
+	/* Test regular cases
+	 */
+	result = info_inventory_sort_devices(
+	          info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The devices are ordered by serial number and source, followed by
+	 * the device without a serial number and the device that failed
+	 */
+	result = system_string_compare(
+	          info_inventory->devices[ 0 ]->source,
+	          _SYSTEM_STRING( "/dev/sg2" ),
+	          9 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = system_string_compare(
+	          info_inventory->devices[ 1 ]->source,
+	          _SYSTEM_STRING( "/dev/sg4" ),
+	          9 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = system_string_compare(
+	          info_inventory->devices[ 2 ]->source,
+	          _SYSTEM_STRING( "/dev/sg0" ),
+	          9 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = system_string_compare(
+	          info_inventory->devices[ 3 ]->source,
+	          _SYSTEM_STRING( "/dev/sg3" ),
+	          9 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = system_string_compare(
+	          info_inventory->devices[ 4 ]->source,
+	          _SYSTEM_STRING( "/dev/sg1" ),
+	          9 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = info_inventory_sort_devices(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_inventory_free(
+	          &info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_inventory != NULL )
+	{
+		info_inventory_free(
+		 &info_inventory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_inventory_run function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_inventory_run(
+     void )
+{
+	info_inventory_t *info_inventory = NULL;
+	libcerror_error_t *error         = NULL;
+	int device_index                 = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = info_inventory_initialize(
+	          &info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_inventory",
+	 info_inventory );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = info_inventory_run(
+	          info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_inventory_run(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a device that cannot be opened fails the inventory
+	 * only if it was specified
+	 */
+	result = info_inventory_append_device(
+	          info_inventory,
+	          _SYSTEM_STRING( "/nonexistent/sg0" ),
+	          16,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_inventory_run(
+	          info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "info_inventory->devices[ 0 ]->result",
+	 info_inventory->devices[ 0 ]->result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_inventory->devices[ 0 ]->error",
+	 info_inventory->devices[ 0 ]->error );
+
+	/* Clean up
+	 */
+	result = info_inventory_free(
+	          &info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = info_inventory_initialize(
+	          &info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_inventory_append_device(
+	          info_inventory,
+	          _SYSTEM_STRING( "/nonexistent/sg0" ),
+	          16,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = info_inventory_append_device(
+	          info_inventory,
+	          _SYSTEM_STRING( "/nonexistent/sg1" ),
+	          16,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_inventory_run(
+	          info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( device_index = 0;
+	     device_index < 2;
+	     device_index++ )
+	{
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "info_inventory->devices[ device_index ]->result",
+		 info_inventory->devices[ device_index ]->result,
+		 -1 );
+	}
+	/* Clean up
+	 */
+	result = info_inventory_free(
+	          &info_inventory,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_inventory != NULL )
+	{
+		info_inventory_free(
+		 &info_inventory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "info_inventory_initialize",
+	 tableau_test_tools_info_inventory_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "info_inventory_append_device",
+	 tableau_test_tools_info_inventory_append_device );
+
+	TABLEAU_TEST_RUN(
+	 "info_inventory_sort_devices",
+	 tableau_test_tools_info_inventory_sort_devices );
+
+	TABLEAU_TEST_RUN(
+	 "info_inventory_run",
+	 tableau_test_tools_info_inventory_run );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,720 @@
+/*
+ * Tools record functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/info_record.h"
+
+/* Tests the info_record_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_record_clear(
+     void )
+{
+	info_record_t info_record;
+
+	libcerror_error_t *error  = NULL;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = info_record_clear(
+	          &info_record,
+	          INFO_RECORD_FORMAT_JSONL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "info_record.data_size",
+	 info_record.data_size,
+	 (size_t) 1 );
+
+	result = info_record_clear(
+	          &info_record,
+	          INFO_RECORD_FORMAT_CSV,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "info_record.data_size",
+	 info_record.data_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = info_record_clear(
+	          NULL,
+	          INFO_RECORD_FORMAT_JSONL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_record_clear(
+	          &info_record,
+	          INFO_RECORD_FORMAT_TEXT,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests composing a JSON Lines record
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_record_jsonl(
+     void )
+{
+	info_record_t info_record;
+
+	const char *expected_data = \
+		"{\"vendor\":\"Tab\\\"l\\\\x\\n\\u0001\\u00e9\",\"model\":null,\"sectors\":18446744073709551615}\n";
+
+	libcerror_error_t *error  = NULL;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = info_record_clear(
+	          &info_record,
+	          INFO_RECORD_FORMAT_JSONL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_record_append_string(
+	          &info_record,
+	          "vendor",
+	          "Tab\"l\\x\n\x01\xe9",
+	          10,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_record_append_string(
+	          &info_record,
+	          "model",
+	          NULL,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_record_append_integer(
+	          &info_record,
+	          "sectors",
+	          (uint64_t) 18446744073709551615ULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_record_finalize(
+	          &info_record,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "info_record.data_size",
+	 info_record.data_size,
+	 narrow_string_length(
+	  expected_data ) );
+
+	result = memory_compare(
+	          info_record.data,
+	          expected_data,
+	          info_record.data_size );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = info_record_append_string(
+	          NULL,
+	          "vendor",
+	          "Tableau",
+	          7,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_record_append_string(
+	          &info_record,
+	          NULL,
+	          "Tableau",
+	          7,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_record_append_integer(
+	          NULL,
+	          "sectors",
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_record_finalize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests composing a CSV record
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_record_csv(
+     void )
+{
+	info_record_t info_record;
+
+	const char *expected_data = \
+		"Tableau,\"T35, \"\"forensic\"\"\",,512\n";
+
+	libcerror_error_t *error  = NULL;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = info_record_clear(
+	          &info_record,
+	          INFO_RECORD_FORMAT_CSV,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_record_append_string(
+	          &info_record,
+	          "vendor",
+	          "Tableau",
+	          7,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_record_append_string(
+	          &info_record,
+	          "model",
+	          "T35, \"forensic\"",
+	          15,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_record_append_string(
+	          &info_record,
+	          "serial_number",
+	          NULL,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_record_append_integer(
+	          &info_record,
+	          "sectors",
+	          512,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_record_finalize(
+	          &info_record,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "info_record.data_size",
+	 info_record.data_size,
+	 narrow_string_length(
+	  expected_data ) );
+
+	result = memory_compare(
+	          info_record.data,
+	          expected_data,
+	          info_record.data_size );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = info_record_append_string(
+	          &info_record,
+	          "model",
+	          "Tableau",
+	          INFO_RECORD_DATA_SIZE + 1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the info_record_append_string function with a full record
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_record_append_string_full(
+     void )
+{
+	info_record_t info_record;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Initialize test
+	 */
+	result = info_record_clear(
+	          &info_record,
+	          INFO_RECORD_FORMAT_JSONL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	for( value_index = 0;
+	     value_index < INFO_RECORD_DATA_SIZE;
+	     value_index++ )
+	{
+		result = info_record_append_string(
+		          &info_record,
+		          "value",
+		          "\x01",
+		          1,
+		          &error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+	}
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The record data must never exceed its size
+	 */
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "data_size_in_bounds",
+	 (int) ( info_record.data_size <= INFO_RECORD_DATA_SIZE ),
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the info_record_header_fprint function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_record_header_fprint(
+     void )
+{
+	char header_data[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	FILE *stream             = NULL;
+	size_t read_count        = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	stream = tmpfile();
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	/* Test regular cases
+	 */
+	result = info_record_header_fprint(
+	          INFO_RECORD_FORMAT_JSONL,
+	          stream,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_record_header_fprint(
+	          INFO_RECORD_FORMAT_CSV,
+	          stream,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = file_stream_seek_offset(
+	          stream,
+	          0,
+	          SEEK_SET );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = file_stream_read(
+	              stream,
+	              header_data,
+	              21 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) 21 );
+
+	result = memory_compare(
+	          header_data,
+	          "source,bridge_vendor,",
+	          21 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = info_record_header_fprint(
+	          INFO_RECORD_FORMAT_CSV,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	file_stream_close(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "info_record_clear",
+	 tableau_test_tools_info_record_clear );
+
+	TABLEAU_TEST_RUN(
+	 "info_record_jsonl",
+	 tableau_test_tools_info_record_jsonl );
+
+	TABLEAU_TEST_RUN(
+	 "info_record_csv",
+	 tableau_test_tools_info_record_csv );
+
+	TABLEAU_TEST_RUN(
+	 "info_record_append_string_full",
+	 tableau_test_tools_info_record_append_string_full );
+
+	TABLEAU_TEST_RUN(
+	 "info_record_header_fprint",
+	 tableau_test_tools_info_record_header_fprint );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,828 @@
+/*
+ * Tools watch functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/info_watch.h"
+
+/* Reads the output of a stream from the start
+ * Returns the number of bytes read
+ */
+size_t tableau_test_tools_info_watch_read_stream(
+        FILE *stream,
+        char *data,
+        size_t data_size )
+{
+	size_t read_count = 0;
+
+	if( file_stream_seek_offset(
+	     stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		return( 0 );
+	}
+	read_count = file_stream_read(
+	              stream,
+	              data,
+	              data_size - 1 );
+
+	data[ read_count ] = 0;
+
+	return( read_count );
+}
+
+/* Tests the info_watch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_watch_initialize(
+     void )
+{
+	info_watch_t *info_watch = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = info_watch_initialize(
+	          &info_watch,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_watch",
+	 info_watch );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "info_watch->number_of_devices",
+	 info_watch->number_of_devices,
+	 0 );
+
+	result = info_watch_free(
+	          &info_watch,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "info_watch",
+	 info_watch );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = info_watch_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_watch != NULL )
+	{
+		info_watch_free(
+		 &info_watch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_watch_set_interval function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_watch_set_interval(
+     void )
+{
+	info_watch_t *info_watch = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = info_watch_initialize(
+	          &info_watch,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_watch",
+	 info_watch );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = info_watch_set_interval(
+	          info_watch,
+	          _SYSTEM_STRING( "5" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "info_watch->interval",
+	 (int) info_watch->interval,
+	 5 );
+
+	result = info_watch_set_interval(
+	          info_watch,
+	          _SYSTEM_STRING( "0" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_watch_set_interval(
+	          info_watch,
+	          _SYSTEM_STRING( "3601" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_watch_set_interval(
+	          info_watch,
+	          _SYSTEM_STRING( "fast" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "info_watch->interval",
+	 (int) info_watch->interval,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = info_watch_set_interval(
+	          NULL,
+	          _SYSTEM_STRING( "5" ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_watch_set_interval(
+	          info_watch,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_watch_free(
+	          &info_watch,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_watch != NULL )
+	{
+		info_watch_free(
+		 &info_watch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_watch_append_device function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_watch_append_device(
+     void )
+{
+	info_watch_t *info_watch = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = info_watch_initialize(
+	          &info_watch,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_watch",
+	 info_watch );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = info_watch_append_device(
+	          info_watch,
+	          _SYSTEM_STRING( "/dev/sg1" ),
+	          8,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A device that is appended twice is watched once
+	 */
+	result = info_watch_append_device(
+	          info_watch,
+	          _SYSTEM_STRING( "/dev/sg1" ),
+	          8,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "info_watch->number_of_devices",
+	 info_watch->number_of_devices,
+	 1 );
+
+	result = narrow_string_compare(
+	          info_watch->devices[ 0 ]->fields[ INFO_WATCH_FIELD_SOURCE ],
+	          "/dev/sg1",
+	          9 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = info_watch_append_device(
+	          NULL,
+	          _SYSTEM_STRING( "/dev/sg2" ),
+	          8,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_watch_append_device(
+	          info_watch,
+	          NULL,
+	          8,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_watch_append_device(
+	          info_watch,
+	          _SYSTEM_STRING( "/dev/sg2" ),
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_watch_free(
+	          &info_watch,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_watch != NULL )
+	{
+		info_watch_free(
+		 &info_watch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_watch_refresh_fprint function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_info_watch_refresh_fprint(
+     void )
+{
+	char output_data[ 512 ];
+
+	info_watch_t *info_watch = NULL;
+	libcerror_error_t *error = NULL;
+	FILE *stream             = NULL;
+	size_t read_count        = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = info_watch_initialize(
+	          &info_watch,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "info_watch",
+	 info_watch );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_watch_append_device(
+	          info_watch,
+	          _SYSTEM_STRING( "/dev/sg1" ),
+	          8,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_watch_set_field(
+	          info_watch->devices[ 0 ],
+	          INFO_WATCH_FIELD_STATUS,
+	          "ok",
+	          2,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The first refresh prints the table
+	 */
+	stream = tmpfile();
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	info_watch->notify_stream = stream;
+
+	result = info_watch_refresh_fprint(
+	          info_watch,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = tableau_test_tools_info_watch_read_stream(
+	              stream,
+	              output_data,
+	              512 );
+
+	result = narrow_string_compare(
+	          output_data,
+	          "Source           Status ",
+	          24 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	file_stream_close(
+	 stream );
+
+	/* A following refresh only prints a line per changed value, where
+	 * a change of a counter is not printed
+	 */
+	stream = tmpfile();
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	info_watch->notify_stream = stream;
+
+	result = info_watch_set_field(
+	          info_watch->devices[ 0 ],
+	          INFO_WATCH_FIELD_STATUS,
+	          "error",
+	          5,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_watch_set_field(
+	          info_watch->devices[ 0 ],
+	          INFO_WATCH_FIELD_NUMBER_OF_ERRORS,
+	          "1",
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_watch_refresh_fprint(
+	          info_watch,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = tableau_test_tools_info_watch_read_stream(
+	              stream,
+	              output_data,
+	              512 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) 44 );
+
+	result = narrow_string_compare(
+	          output_data,
+	          "/dev/sg1: Status changed from: ok to: error\n",
+	          44 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	file_stream_close(
+	 stream );
+
+	/* With escape sequences only the changed field is redrawn in place
+	 */
+	stream = tmpfile();
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	info_watch->notify_stream        = stream;
+	info_watch->use_escape_sequences = 1;
+
+	result = info_watch_set_field(
+	          info_watch->devices[ 0 ],
+	          INFO_WATCH_FIELD_STATUS,
+	          "ok",
+	          2,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_watch_refresh_fprint(
+	          info_watch,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = tableau_test_tools_info_watch_read_stream(
+	              stream,
+	              output_data,
+	              512 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) 19 );
+
+	result = narrow_string_compare(
+	          output_data,
+	          "\033[2;18Hok    \033[3;1H",
+	          19 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	file_stream_close(
+	 stream );
+
+	stream = NULL;
+
+	info_watch->notify_stream = stdout;
+
+	result = info_watch_free(
+	          &info_watch,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = info_watch_refresh_fprint(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( info_watch != NULL )
+	{
+		info_watch_free(
+		 &info_watch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "info_watch_initialize",
+	 tableau_test_tools_info_watch_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "info_watch_set_interval",
+	 tableau_test_tools_info_watch_set_interval );
+
+	TABLEAU_TEST_RUN(
+	 "info_watch_append_device",
+	 tableau_test_tools_info_watch_append_device );
+
+	TABLEAU_TEST_RUN(
+	 "info_watch_refresh_fprint",
+	 tableau_test_tools_info_watch_refresh_fprint );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
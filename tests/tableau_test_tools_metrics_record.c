@@ -0,0 +1,807 @@
+/*
+ * Tools metrics record functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/metrics_record.h"
+
+/* Tests the metrics_record_get_latency_bucket_index function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_metrics_record_get_latency_bucket_index(
+     void )
+{
+	int bucket_index = 0;
+
+	/* Test regular cases
+	 */
+	bucket_index = metrics_record_get_latency_bucket_index(
+	                0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 0 );
+
+	bucket_index = metrics_record_get_latency_bucket_index(
+	                1000 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 0 );
+
+	bucket_index = metrics_record_get_latency_bucket_index(
+	                1001 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 1 );
+
+	bucket_index = metrics_record_get_latency_bucket_index(
+	                5000000 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 ( METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS - 1 ) );
+
+	bucket_index = metrics_record_get_latency_bucket_index(
+	                5000001 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the metrics_record_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_metrics_record_clear(
+     void )
+{
+	char long_value[ METRICS_RECORD_LABELS_SIZE ];
+
+	metrics_record_t metrics_record;
+
+	const char *expected_labels = "source=\"/dev/sg\\\\0\",bridge_serial_number=\"a\\\"b\\nc\"";
+	libcerror_error_t *error    = NULL;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = metrics_record_clear(
+	          &metrics_record,
+	          "/dev/sg\\0",
+	          "a\"b\nc",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "metrics_record.labels_size",
+	 metrics_record.labels_size,
+	 narrow_string_length(
+	  expected_labels ) );
+
+	result = memory_compare(
+	          metrics_record.labels,
+	          expected_labels,
+	          metrics_record.labels_size + 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "metrics_record.data_size",
+	 metrics_record.data_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = metrics_record_clear(
+	          NULL,
+	          "/dev/sg0",
+	          "",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_record_clear(
+	          &metrics_record,
+	          NULL,
+	          "",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_record_clear(
+	          &metrics_record,
+	          "/dev/sg0",
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test labels that exceed the maximum size once escaped
+	 */
+	memory_set(
+	 long_value,
+	 '"',
+	 METRICS_RECORD_LABELS_SIZE / 2 );
+
+	long_value[ METRICS_RECORD_LABELS_SIZE / 2 ] = 0;
+
+	result = metrics_record_clear(
+	          &metrics_record,
+	          long_value,
+	          "",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the metrics_record_append_value, metrics_record_append_histogram,
+ * metrics_record_finalize and metrics_record_get_family_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_metrics_record_append(
+     void )
+{
+	uint64_t bucket_counts[ METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS + 1 ];
+
+	metrics_record_t metrics_record;
+
+	const char *expected_capacity_data  = "tableau_drive_capacity_sectors{source=\"/dev/sg0\",bridge_serial_number=\"0001\"} 4294967295\n";
+	const char *expected_histogram_data = "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"0.001\"} 2\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"0.0025\"} 2\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"0.005\"} 3\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"0.01\"} 3\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"0.025\"} 3\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"0.05\"} 3\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"0.1\"} 3\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"0.25\"} 3\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"0.5\"} 3\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"1\"} 3\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"2.5\"} 3\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"5\"} 3\n"
+	                                      "tableau_bridge_query_latency_seconds_bucket{source=\"/dev/sg0\",bridge_serial_number=\"0001\",le=\"+Inf\"} 4\n"
+	                                      "tableau_bridge_query_latency_seconds_sum{source=\"/dev/sg0\",bridge_serial_number=\"0001\"} 6.004750\n"
+	                                      "tableau_bridge_query_latency_seconds_count{source=\"/dev/sg0\",bridge_serial_number=\"0001\"} 4\n";
+	const char *expected_up_data        = "tableau_bridge_up{source=\"/dev/sg0\",bridge_serial_number=\"0001\"} 1\n";
+	const uint8_t *data                 = NULL;
+	libcerror_error_t *error            = NULL;
+	size_t data_size                    = 0;
+	int family                          = 0;
+	int result                          = 0;
+
+	memory_set(
+	 bucket_counts,
+	 0,
+	 sizeof( uint64_t ) * ( METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS + 1 ) );
+
+	/* Latencies of 0.5 ms, 1 ms, 3.25 ms and 6 s
+	 */
+	bucket_counts[ 0 ]                                        = 2;
+	bucket_counts[ 2 ]                                        = 1;
+	bucket_counts[ METRICS_RECORD_NUMBER_OF_LATENCY_BUCKETS ] = 1;
+
+	result = metrics_record_clear(
+	          &metrics_record,
+	          "/dev/sg0",
+	          "0001",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = metrics_record_append_value(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_UP,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = metrics_record_append_histogram(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_QUERY_LATENCY,
+	          bucket_counts,
+	          6004750,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = metrics_record_append_value(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_CAPACITY,
+	          0xffffffffUL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the samples cannot be retrieved before the record is finalized
+	 */
+	result = metrics_record_get_family_data(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_UP,
+	          &data,
+	          &data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_record_finalize(
+	          &metrics_record,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = metrics_record_get_family_data(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_UP,
+	          &data,
+	          &data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 narrow_string_length(
+	  expected_up_data ) );
+
+	result = memory_compare(
+	          data,
+	          expected_up_data,
+	          data_size );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = metrics_record_get_family_data(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_QUERY_LATENCY,
+	          &data,
+	          &data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 narrow_string_length(
+	  expected_histogram_data ) );
+
+	result = memory_compare(
+	          data,
+	          expected_histogram_data,
+	          data_size );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the skipped families have no samples
+	 */
+	for( family = METRICS_RECORD_FAMILY_QUERIES;
+	     family < METRICS_RECORD_FAMILY_CAPACITY;
+	     family++ )
+	{
+		result = metrics_record_get_family_data(
+		          &metrics_record,
+		          family,
+		          &data,
+		          &data_size,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+		 "data_size",
+		 data_size,
+		 (size_t) 0 );
+	}
+	result = metrics_record_get_family_data(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_CAPACITY,
+	          &data,
+	          &data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 narrow_string_length(
+	  expected_capacity_data ) );
+
+	result = memory_compare(
+	          data,
+	          expected_capacity_data,
+	          data_size );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = metrics_record_clear(
+	          &metrics_record,
+	          "/dev/sg0",
+	          "0001",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = metrics_record_append_value(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_QUERY_LATENCY,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_record_append_histogram(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_UP,
+	          bucket_counts,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_record_append_histogram(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_QUERY_LATENCY,
+	          NULL,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_record_append_value(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_QUERIES,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that families cannot be appended out of order
+	 */
+	result = metrics_record_append_value(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_UP,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_record_append_value(
+	          &metrics_record,
+	          METRICS_RECORD_NUMBER_OF_FAMILIES,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_record_finalize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_record_finalize(
+	          &metrics_record,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = metrics_record_get_family_data(
+	          &metrics_record,
+	          -1,
+	          &data,
+	          &data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_record_get_family_data(
+	          &metrics_record,
+	          METRICS_RECORD_FAMILY_UP,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the metrics_record_get_family_header function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_metrics_record_get_family_header(
+     void )
+{
+	const char *expected_data = "# HELP tableau_bridge_up Whether the most recent query of the bridge succeeded.\n"
+	                            "# TYPE tableau_bridge_up gauge\n";
+	const uint8_t *data       = NULL;
+	libcerror_error_t *error  = NULL;
+	size_t data_size          = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = metrics_record_get_family_header(
+	          METRICS_RECORD_FAMILY_UP,
+	          &data,
+	          &data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 narrow_string_length(
+	  expected_data ) );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          data_size );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = metrics_record_get_family_header(
+	          METRICS_RECORD_NUMBER_OF_FAMILIES,
+	          &data,
+	          &data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_record_get_family_header(
+	          METRICS_RECORD_FAMILY_UP,
+	          &data,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "metrics_record_get_latency_bucket_index",
+	 tableau_test_tools_metrics_record_get_latency_bucket_index );
+
+	TABLEAU_TEST_RUN(
+	 "metrics_record_clear",
+	 tableau_test_tools_metrics_record_clear );
+
+	TABLEAU_TEST_RUN(
+	 "metrics_record_append",
+	 tableau_test_tools_metrics_record_append );
+
+	TABLEAU_TEST_RUN(
+	 "metrics_record_get_family_header",
+	 tableau_test_tools_metrics_record_get_family_header );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,588 @@
+/*
+ * Tools metrics text file functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/metrics_textfile.h"
+
+#define TABLEAU_TEST_METRICS_TEXTFILE_PATH		"tableau_test_tools_metrics_textfile.prom"
+#define TABLEAU_TEST_METRICS_TEXTFILE_TEMPORARY_PATH	"tableau_test_tools_metrics_textfile.prom.tmp"
+
+/* Tests the metrics_textfile_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_metrics_textfile_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	metrics_textfile_t *metrics_textfile = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = metrics_textfile_initialize(
+	          &metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "metrics_textfile",
+	 metrics_textfile );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "metrics_textfile->file_descriptor",
+	 metrics_textfile->file_descriptor,
+	 -1 );
+
+	result = metrics_textfile_free(
+	          &metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "metrics_textfile",
+	 metrics_textfile );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = metrics_textfile_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_textfile_initialize(
+	          &metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = metrics_textfile_initialize(
+	          &metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_textfile_free(
+	          &metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = metrics_textfile_free(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metrics_textfile != NULL )
+	{
+		metrics_textfile_free(
+		 &metrics_textfile,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE )
+
+/* Reads the text file and compares it with the expected data
+ * Returns 1 if the text file contains the expected data or 0 if not
+ */
+int tableau_test_tools_metrics_textfile_compare(
+     const uint8_t *expected_data,
+     size_t expected_data_size )
+{
+	uint8_t data[ 256 ];
+
+	FILE *file_stream   = NULL;
+	size_t data_offset  = 0;
+	size_t read_count   = 0;
+	int result          = 1;
+
+	file_stream = file_stream_open(
+	               TABLEAU_TEST_METRICS_TEXTFILE_PATH,
+	               "r" );
+
+	if( file_stream == NULL )
+	{
+		return( 0 );
+	}
+	do
+	{
+		read_count = file_stream_read(
+		              file_stream,
+		              data,
+		              256 );
+
+		if( ( data_offset + read_count ) > expected_data_size )
+		{
+			result = 0;
+		}
+		else if( ( read_count > 0 )
+		      && ( memory_compare(
+		            data,
+		            &( expected_data[ data_offset ] ),
+		            read_count ) != 0 ) )
+		{
+			result = 0;
+		}
+		data_offset += read_count;
+	}
+	while( ( result == 1 )
+	    && ( read_count == 256 ) );
+
+	file_stream_close(
+	 file_stream );
+
+	if( data_offset != expected_data_size )
+	{
+		result = 0;
+	}
+	return( result );
+}
+
+/* Tests the metrics_textfile_open, metrics_textfile_write and
+ * metrics_textfile_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_metrics_textfile_write(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	metrics_textfile_t *metrics_textfile = NULL;
+	uint8_t *data                        = NULL;
+	size_t data_index                    = 0;
+	size_t data_size                     = ( METRICS_TEXTFILE_BUFFER_SIZE * 2 ) + 123;
+	int result                           = 0;
+
+	remove(
+	 TABLEAU_TEST_METRICS_TEXTFILE_PATH );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( data_index = 0;
+	     data_index < data_size;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( 'a' + ( data_index % 26 ) );
+	}
+	result = metrics_textfile_initialize(
+	          &metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = metrics_textfile_set_path(
+	          metrics_textfile,
+	          TABLEAU_TEST_METRICS_TEXTFILE_PATH,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          metrics_textfile->temporary_path,
+	          TABLEAU_TEST_METRICS_TEXTFILE_TEMPORARY_PATH,
+	          narrow_string_length( TABLEAU_TEST_METRICS_TEXTFILE_TEMPORARY_PATH ) + 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test writing data that exceeds the output buffer
+	 */
+	result = metrics_textfile_open(
+	          metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = metrics_textfile_write(
+	          metrics_textfile,
+	          data,
+	          data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The text file is only replaced when it is closed
+	 */
+	result = tableau_test_tools_metrics_textfile_compare(
+	          data,
+	          data_size );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = metrics_textfile_close(
+	          metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = tableau_test_tools_metrics_textfile_compare(
+	          data,
+	          data_size );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test replacing the text file with less data
+	 */
+	result = metrics_textfile_open(
+	          metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = metrics_textfile_write(
+	          metrics_textfile,
+	          &( data[ 3 ] ),
+	          10,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = metrics_textfile_close(
+	          metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = tableau_test_tools_metrics_textfile_compare(
+	          &( data[ 3 ] ),
+	          10 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "metrics_textfile->number_of_writes",
+	 metrics_textfile->number_of_writes,
+	 (uint64_t) 2 );
+
+	/* Test error cases
+	 */
+	result = metrics_textfile_write(
+	          metrics_textfile,
+	          data,
+	          data_size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_textfile_close(
+	          metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_textfile_set_path(
+	          metrics_textfile,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_textfile_set_path(
+	          metrics_textfile,
+	          "",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a text file that cannot be written is counted
+	 */
+	result = metrics_textfile_set_path(
+	          metrics_textfile,
+	          "tableau_test_tools_metrics_textfile.missing/tableau.prom",
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = metrics_textfile_open(
+	          metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "metrics_textfile->number_of_failed_writes",
+	 metrics_textfile->number_of_failed_writes,
+	 (uint64_t) 1 );
+
+	/* Clean up
+	 */
+	result = metrics_textfile_free(
+	          &metrics_textfile,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_free(
+	 data );
+
+	remove(
+	 TABLEAU_TEST_METRICS_TEXTFILE_PATH );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metrics_textfile != NULL )
+	{
+		metrics_textfile_free(
+		 &metrics_textfile,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	remove(
+	 TABLEAU_TEST_METRICS_TEXTFILE_PATH );
+
+	return( 0 );
+}
+
+#endif /* defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "metrics_textfile_initialize",
+	 tableau_test_tools_metrics_textfile_initialize );
+
+#if defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE )
+
+	TABLEAU_TEST_RUN(
+	 "metrics_textfile_write",
+	 tableau_test_tools_metrics_textfile_write );
+
+#endif /* defined( METRICS_TEXTFILE_HAVE_ATOMIC_REPLACE ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
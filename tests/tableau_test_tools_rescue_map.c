@@ -0,0 +1,1060 @@
+/*
+ * Tools rescue map functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/rescue_map.h"
+
+#define TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE	( 64 * 512 )
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define tableau_test_tools_rescue_map_remove( filename ) \
+	_wremove( filename )
+#else
+#define tableau_test_tools_rescue_map_remove( filename ) \
+	remove( filename )
+#endif
+
+/* Tests the rescue_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_rescue_map_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	rescue_map_t *rescue_map = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = rescue_map_initialize(
+	          &rescue_map,
+	          TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "rescue_map",
+	 rescue_map );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "rescue_map->number_of_extents",
+	 rescue_map->number_of_extents,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "rescue_map->extents[ 0 ].size",
+	 rescue_map->extents[ 0 ].size,
+	 (uint64_t) TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "rescue_map->extents[ 0 ].status",
+	 rescue_map->extents[ 0 ].status,
+	 RESCUE_MAP_STATUS_UNTRIED );
+
+	result = rescue_map_free(
+	          &rescue_map,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "rescue_map",
+	 rescue_map );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = rescue_map_initialize(
+	          NULL,
+	          TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = rescue_map_initialize(
+	          &rescue_map,
+	          (size64_t) INT64_MAX + 1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "rescue_map",
+	 rescue_map );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rescue_map != NULL )
+	{
+		rescue_map_free(
+		 &rescue_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the rescue_map_set_status function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_rescue_map_set_status(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	rescue_map_t *rescue_map = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = rescue_map_initialize(
+	          &rescue_map,
+	          TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "rescue_map",
+	 rescue_map );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a range in the middle of an extent, which splits the extent
+	 */
+	result = rescue_map_set_status(
+	          rescue_map,
+	          1024,
+	          512,
+	          RESCUE_MAP_STATUS_FAILED,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "rescue_map->number_of_extents",
+	 rescue_map->number_of_extents,
+	 3 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "rescue_map->extents[ 1 ].offset",
+	 (int64_t) rescue_map->extents[ 1 ].offset,
+	 (int64_t) 1024 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "rescue_map->extents[ 1 ].size",
+	 rescue_map->extents[ 1 ].size,
+	 (uint64_t) 512 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "rescue_map->extents[ 1 ].status",
+	 rescue_map->extents[ 1 ].status,
+	 RESCUE_MAP_STATUS_FAILED );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "rescue_map->extents[ 2 ].size",
+	 rescue_map->extents[ 2 ].size,
+	 (uint64_t) ( TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE - 1536 ) );
+
+	/* Test a range that spans multiple extents
+	 */
+	result = rescue_map_set_status(
+	          rescue_map,
+	          512,
+	          2048,
+	          RESCUE_MAP_STATUS_BAD,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "rescue_map->number_of_extents",
+	 rescue_map->number_of_extents,
+	 3 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "rescue_map->extents[ 1 ].offset",
+	 (int64_t) rescue_map->extents[ 1 ].offset,
+	 (int64_t) 512 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "rescue_map->extents[ 1 ].size",
+	 rescue_map->extents[ 1 ].size,
+	 (uint64_t) 2048 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "rescue_map->extents[ 1 ].status",
+	 rescue_map->extents[ 1 ].status,
+	 RESCUE_MAP_STATUS_BAD );
+
+	/* Test ranges that are merged with their neighbours
+	 */
+	result = rescue_map_set_status(
+	          rescue_map,
+	          0,
+	          512,
+	          RESCUE_MAP_STATUS_BAD,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "rescue_map->number_of_extents",
+	 rescue_map->number_of_extents,
+	 2 );
+
+	result = rescue_map_set_status(
+	          rescue_map,
+	          2560,
+	          TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE - 2560,
+	          RESCUE_MAP_STATUS_BAD,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "rescue_map->number_of_extents",
+	 rescue_map->number_of_extents,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "rescue_map->extents[ 0 ].size",
+	 rescue_map->extents[ 0 ].size,
+	 (uint64_t) TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "rescue_map->extents[ 0 ].status",
+	 rescue_map->extents[ 0 ].status,
+	 RESCUE_MAP_STATUS_BAD );
+
+	/* Test error cases
+	 */
+	result = rescue_map_set_status(
+	          NULL,
+	          0,
+	          512,
+	          RESCUE_MAP_STATUS_GOOD,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = rescue_map_set_status(
+	          rescue_map,
+	          TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE - 512,
+	          1024,
+	          RESCUE_MAP_STATUS_GOOD,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = rescue_map_set_status(
+	          rescue_map,
+	          0,
+	          512,
+	          (uint8_t) 'x',
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = rescue_map_free(
+	          &rescue_map,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rescue_map != NULL )
+	{
+		rescue_map_free(
+		 &rescue_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the rescue_map_get_next_extent and rescue_map_get_size_by_status functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_rescue_map_get_next_extent(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	rescue_map_t *rescue_map = NULL;
+	size64_t size            = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = rescue_map_initialize(
+	          &rescue_map,
+	          TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "rescue_map",
+	 rescue_map );
+
+	result = rescue_map_set_status(
+	          rescue_map,
+	          0,
+	          4096,
+	          RESCUE_MAP_STATUS_GOOD,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = rescue_map_set_status(
+	          rescue_map,
+	          8192,
+	          4096,
+	          RESCUE_MAP_STATUS_FAILED,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = rescue_map_get_next_extent(
+	          rescue_map,
+	          RESCUE_MAP_STATUS_UNTRIED,
+	          0,
+	          &offset,
+	          &size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 4096 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 4096 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a start offset inside an extent
+	 */
+	result = rescue_map_get_next_extent(
+	          rescue_map,
+	          RESCUE_MAP_STATUS_UNTRIED,
+	          6144,
+	          &offset,
+	          &size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 6144 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 2048 );
+
+	result = rescue_map_get_next_extent(
+	          rescue_map,
+	          RESCUE_MAP_STATUS_UNTRIED,
+	          8192,
+	          &offset,
+	          &size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 12288 );
+
+	/* Test a status that is not present after the start offset
+	 */
+	result = rescue_map_get_next_extent(
+	          rescue_map,
+	          RESCUE_MAP_STATUS_FAILED,
+	          12288,
+	          &offset,
+	          &size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a start offset beyond the media size
+	 */
+	result = rescue_map_get_next_extent(
+	          rescue_map,
+	          RESCUE_MAP_STATUS_UNTRIED,
+	          TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE,
+	          &offset,
+	          &size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = rescue_map_get_size_by_status(
+	          rescue_map,
+	          RESCUE_MAP_STATUS_UNTRIED,
+	          &size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) ( TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE - 8192 ) );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = rescue_map_get_next_extent(
+	          NULL,
+	          RESCUE_MAP_STATUS_UNTRIED,
+	          0,
+	          &offset,
+	          &size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = rescue_map_get_next_extent(
+	          rescue_map,
+	          RESCUE_MAP_STATUS_UNTRIED,
+	          0,
+	          NULL,
+	          &size,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = rescue_map_get_size_by_status(
+	          rescue_map,
+	          RESCUE_MAP_STATUS_UNTRIED,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = rescue_map_free(
+	          &rescue_map,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rescue_map != NULL )
+	{
+		rescue_map_free(
+		 &rescue_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the rescue_map_write and rescue_map_read functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_rescue_map_read(
+     void )
+{
+	const system_character_t *filename = _SYSTEM_STRING( "tableau_test_tools_rescue_map.map" );
+	FILE *file_stream                  = NULL;
+	libcerror_error_t *error           = NULL;
+	rescue_map_t *read_rescue_map      = NULL;
+	rescue_map_t *rescue_map           = NULL;
+	int extent_index                   = 0;
+	int result                         = 0;
+
+	tableau_test_tools_rescue_map_remove(
+	 filename );
+
+	/* Initialize test
+	 */
+	result = rescue_map_initialize(
+	          &rescue_map,
+	          TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = rescue_map_initialize(
+	          &read_rescue_map,
+	          TABLEAU_TEST_RESCUE_MAP_MEDIA_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a rescue map that does not exist
+	 */
+	result = rescue_map_read(
+	          read_rescue_map,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a round trip
+	 */
+	result = rescue_map_set_status(
+	          rescue_map,
+	          0,
+	          4096,
+	          RESCUE_MAP_STATUS_GOOD,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = rescue_map_set_status(
+	          rescue_map,
+	          4096,
+	          512,
+	          RESCUE_MAP_STATUS_BAD,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = rescue_map_set_status(
+	          rescue_map,
+	          8192,
+	          1024,
+	          RESCUE_MAP_STATUS_FAILED,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = rescue_map_write(
+	          rescue_map,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = rescue_map_read(
+	          read_rescue_map,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "read_rescue_map->number_of_extents",
+	 read_rescue_map->number_of_extents,
+	 rescue_map->number_of_extents );
+
+	for( extent_index = 0;
+	     extent_index < rescue_map->number_of_extents;
+	     extent_index++ )
+	{
+		TABLEAU_TEST_ASSERT_EQUAL_INT64(
+		 "read_rescue_map->extents[ extent_index ].offset",
+		 (int64_t) read_rescue_map->extents[ extent_index ].offset,
+		 (int64_t) rescue_map->extents[ extent_index ].offset );
+
+		TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+		 "read_rescue_map->extents[ extent_index ].size",
+		 read_rescue_map->extents[ extent_index ].size,
+		 rescue_map->extents[ extent_index ].size );
+
+		TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+		 "read_rescue_map->extents[ extent_index ].status",
+		 read_rescue_map->extents[ extent_index ].status,
+		 rescue_map->extents[ extent_index ].status );
+	}
+	/* Test a rescue map that does not cover the media size
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"w" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "w" );
+#endif
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	fprintf(
+	 file_stream,
+	 "0x00000000\t0x00001000\t+\n" );
+
+	file_stream_close(
+	 file_stream );
+
+	result = rescue_map_read(
+	          read_rescue_map,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "read_rescue_map->number_of_extents",
+	 read_rescue_map->number_of_extents,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "read_rescue_map->extents[ 0 ].status",
+	 read_rescue_map->extents[ 0 ].status,
+	 RESCUE_MAP_STATUS_UNTRIED );
+
+	/* Test a rescue map with an unsupported status
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"w" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "w" );
+#endif
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	fprintf(
+	 file_stream,
+	 "0x00000000\t0x00008000\tx\n" );
+
+	file_stream_close(
+	 file_stream );
+
+	result = rescue_map_read(
+	          read_rescue_map,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = rescue_map_write(
+	          NULL,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = rescue_map_read(
+	          read_rescue_map,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	tableau_test_tools_rescue_map_remove(
+	 filename );
+
+	result = rescue_map_free(
+	          &read_rescue_map,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = rescue_map_free(
+	          &rescue_map,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_rescue_map != NULL )
+	{
+		rescue_map_free(
+		 &read_rescue_map,
+		 NULL );
+	}
+	if( rescue_map != NULL )
+	{
+		rescue_map_free(
+		 &rescue_map,
+		 NULL );
+	}
+	tableau_test_tools_rescue_map_remove(
+	 filename );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "rescue_map_initialize",
+	 tableau_test_tools_rescue_map_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "rescue_map_set_status",
+	 tableau_test_tools_rescue_map_set_status );
+
+	TABLEAU_TEST_RUN(
+	 "rescue_map_get_next_extent",
+	 tableau_test_tools_rescue_map_get_next_extent );
+
+	TABLEAU_TEST_RUN(
+	 "rescue_map_read",
+	 tableau_test_tools_rescue_map_read );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
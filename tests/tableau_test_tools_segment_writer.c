@@ -0,0 +1,882 @@
+/*
+ * Tools segment writer functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/segment_writer.h"
+
+#define TABLEAU_TEST_SEGMENT_WRITER_SEGMENT_SIZE	8192
+#define TABLEAU_TEST_SEGMENT_WRITER_SIZE		( ( 2 * TABLEAU_TEST_SEGMENT_WRITER_SEGMENT_SIZE ) + 4096 )
+
+#if defined( HAVE_OPEN ) && defined( HAVE_FCNTL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+/* The segment files created by the tests
+ */
+static const char *tableau_test_tools_segment_writer_filenames[ 4 ] = {
+	"tableau_test_tools_segment_writer.raw",
+	"tableau_test_tools_segment_writer.raw.001",
+	"tableau_test_tools_segment_writer.raw.002",
+	"tableau_test_tools_segment_writer.raw.003" };
+
+static int tableau_test_tools_segment_writer_number_of_references = 0;
+static int tableau_test_tools_segment_writer_number_of_releases   = 0;
+
+/* Removes the segment files created by the tests
+ */
+void tableau_test_tools_segment_writer_remove_files(
+      void )
+{
+	int filename_index = 0;
+
+	for( filename_index = 0;
+	     filename_index < 4;
+	     filename_index++ )
+	{
+		remove(
+		 tableau_test_tools_segment_writer_filenames[ filename_index ] );
+	}
+}
+
+/* Retrieves the size of a file
+ * Returns the size or -1 on error
+ */
+off64_t tableau_test_tools_segment_writer_get_file_size(
+         const char *filename )
+{
+	struct stat file_statistics;
+
+	if( stat(
+	     filename,
+	     &file_statistics ) != 0 )
+	{
+		return( -1 );
+	}
+	return( (off64_t) file_statistics.st_size );
+}
+
+/* Reference function of the asynchronous writes
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_tools_segment_writer_reference(
+     intptr_t *value TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     void *callback_arguments TABLEAU_TEST_ATTRIBUTE_UNUSED )
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( value )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( callback_arguments )
+
+	tableau_test_tools_segment_writer_number_of_references += 1;
+
+	return( 1 );
+}
+
+/* Release function of the asynchronous writes
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_tools_segment_writer_release(
+     intptr_t *value TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     void *callback_arguments TABLEAU_TEST_ATTRIBUTE_UNUSED )
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( value )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( callback_arguments )
+
+	tableau_test_tools_segment_writer_number_of_releases += 1;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_OPEN ) && defined( HAVE_FCNTL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+/* Tests the segment_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_segment_writer_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	segment_writer_t *segment_writer = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = segment_writer_initialize(
+	          &segment_writer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_writer",
+	 segment_writer );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "segment_writer->queue_depth",
+	 segment_writer->queue_depth,
+	 SEGMENT_WRITER_DEFAULT_QUEUE_DEPTH );
+
+	result = segment_writer_free(
+	          &segment_writer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "segment_writer",
+	 segment_writer );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = segment_writer_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = segment_writer_initialize(
+	          &segment_writer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = segment_writer_set_queue_depth(
+	          segment_writer,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = segment_writer_set_queue_depth(
+	          segment_writer,
+	          SEGMENT_WRITER_MAXIMUM_QUEUE_DEPTH + 1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = segment_writer_set_fsync_policy(
+	          segment_writer,
+	          0xff,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = segment_writer_free(
+	          &segment_writer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_writer != NULL )
+	{
+		segment_writer_free(
+		 &segment_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_OPEN ) && defined( HAVE_FCNTL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+/* Tests the segment_writer_write and segment_writer_read functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_segment_writer_write(
+     void )
+{
+	uint8_t *buffers[ 1 ];
+
+	libcerror_error_t *error         = NULL;
+	segment_writer_t *segment_writer = NULL;
+	uint8_t *data                    = NULL;
+	uint8_t *read_data               = NULL;
+	off64_t file_size                = 0;
+	size_t data_index                = 0;
+	int asynchronous                 = 0;
+	int result                       = 0;
+
+	tableau_test_tools_segment_writer_remove_files();
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    TABLEAU_TEST_SEGMENT_WRITER_SIZE );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	read_data = (uint8_t *) memory_allocate(
+	                         TABLEAU_TEST_SEGMENT_WRITER_SIZE );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "read_data",
+	 read_data );
+
+	for( data_index = 0;
+	     data_index < TABLEAU_TEST_SEGMENT_WRITER_SIZE;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( ( data_index % 251 ) + 1 );
+	}
+	result = segment_writer_initialize(
+	          &segment_writer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = segment_writer_set_fsync_policy(
+	          segment_writer,
+	          SEGMENT_WRITER_FSYNC_POLICY_SEGMENT,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a size that requires too many segment files
+	 */
+	result = segment_writer_open(
+	          segment_writer,
+	          tableau_test_tools_segment_writer_filenames[ 0 ],
+	          (size64_t) 1000 * 512,
+	          512,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test writing data that spans the segment files
+	 */
+	result = segment_writer_open(
+	          segment_writer,
+	          tableau_test_tools_segment_writer_filenames[ 0 ],
+	          TABLEAU_TEST_SEGMENT_WRITER_SIZE,
+	          TABLEAU_TEST_SEGMENT_WRITER_SEGMENT_SIZE,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "segment_writer->number_of_segments",
+	 segment_writer->number_of_segments,
+	 3 );
+
+	buffers[ 0 ] = data;
+
+	asynchronous = segment_writer_start_asynchronous(
+	                segment_writer,
+	                buffers,
+	                TABLEAU_TEST_SEGMENT_WRITER_SIZE,
+	                1,
+	                &tableau_test_tools_segment_writer_reference,
+	                &tableau_test_tools_segment_writer_release,
+	                NULL,
+	                &error );
+
+	TABLEAU_TEST_ASSERT_NOT_EQUAL_INT(
+	 "asynchronous",
+	 asynchronous,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first 4096 bytes are left as a hole
+	 */
+	result = segment_writer_write(
+	          segment_writer,
+	          &( data[ 4096 ] ),
+	          TABLEAU_TEST_SEGMENT_WRITER_SIZE - 4096,
+	          4096,
+	          (intptr_t *) data,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = segment_writer_stop_asynchronous(
+	          segment_writer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( asynchronous == 1 )
+	{
+		/* Every segment file the data was written to is referenced once
+		 */
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "number_of_references",
+		 tableau_test_tools_segment_writer_number_of_references,
+		 3 );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "number_of_releases",
+		 tableau_test_tools_segment_writer_number_of_releases,
+		 3 );
+	}
+	result = segment_writer_read(
+	          segment_writer,
+	          read_data,
+	          TABLEAU_TEST_SEGMENT_WRITER_SIZE,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+		 "read_data[ data_index ]",
+		 read_data[ data_index ],
+		 0 );
+	}
+	result = memory_compare(
+	          &( read_data[ 4096 ] ),
+	          &( data[ 4096 ] ),
+	          TABLEAU_TEST_SEGMENT_WRITER_SIZE - 4096 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test setting the size, which truncates the segment files
+	 */
+	result = segment_writer_set_size(
+	          segment_writer,
+	          TABLEAU_TEST_SEGMENT_WRITER_SEGMENT_SIZE + 512,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = segment_writer_close(
+	          segment_writer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_size = tableau_test_tools_segment_writer_get_file_size(
+	             tableau_test_tools_segment_writer_filenames[ 1 ] );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "file_size",
+	 (int64_t) file_size,
+	 (int64_t) TABLEAU_TEST_SEGMENT_WRITER_SEGMENT_SIZE );
+
+	file_size = tableau_test_tools_segment_writer_get_file_size(
+	             tableau_test_tools_segment_writer_filenames[ 2 ] );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "file_size",
+	 (int64_t) file_size,
+	 (int64_t) 512 );
+
+	file_size = tableau_test_tools_segment_writer_get_file_size(
+	             tableau_test_tools_segment_writer_filenames[ 3 ] );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "file_size",
+	 (int64_t) file_size,
+	 (int64_t) 0 );
+
+	/* Test that existing segment files are not overwritten
+	 */
+	result = segment_writer_open(
+	          segment_writer,
+	          tableau_test_tools_segment_writer_filenames[ 0 ],
+	          TABLEAU_TEST_SEGMENT_WRITER_SIZE,
+	          TABLEAU_TEST_SEGMENT_WRITER_SEGMENT_SIZE,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reopening the existing segment files
+	 */
+	result = segment_writer_open(
+	          segment_writer,
+	          tableau_test_tools_segment_writer_filenames[ 0 ],
+	          TABLEAU_TEST_SEGMENT_WRITER_SIZE,
+	          TABLEAU_TEST_SEGMENT_WRITER_SEGMENT_SIZE,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Data beyond the end of a segment file is read as zero bytes
+	 */
+	result = segment_writer_read(
+	          segment_writer,
+	          read_data,
+	          4096,
+	          TABLEAU_TEST_SEGMENT_WRITER_SEGMENT_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          read_data,
+	          &( data[ TABLEAU_TEST_SEGMENT_WRITER_SEGMENT_SIZE ] ),
+	          512 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "read_data[ 512 ]",
+	 read_data[ 512 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = segment_writer_write(
+	          segment_writer,
+	          data,
+	          512,
+	          TABLEAU_TEST_SEGMENT_WRITER_SIZE + 4096,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = segment_writer_write(
+	          NULL,
+	          data,
+	          512,
+	          0,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = segment_writer_free(
+	          &segment_writer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 read_data );
+
+	memory_free(
+	 data );
+
+	tableau_test_tools_segment_writer_remove_files();
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_writer != NULL )
+	{
+		segment_writer_free(
+		 &segment_writer,
+		 NULL );
+	}
+	if( read_data != NULL )
+	{
+		memory_free(
+		 read_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	tableau_test_tools_segment_writer_remove_files();
+
+	return( 0 );
+}
+
+/* Tests the segment_writer_open function with a single output file
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_segment_writer_open_single_file(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libcerror_error_t *error         = NULL;
+	segment_writer_t *segment_writer = NULL;
+	off64_t file_size                = 0;
+	int result                       = 0;
+
+	tableau_test_tools_segment_writer_remove_files();
+
+	/* Initialize test
+	 */
+	result = segment_writer_initialize(
+	          &segment_writer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = segment_writer_open(
+	          segment_writer,
+	          tableau_test_tools_segment_writer_filenames[ 0 ],
+	          TABLEAU_TEST_SEGMENT_WRITER_SIZE,
+	          0,
+	          1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "segment_writer->number_of_segments",
+	 segment_writer->number_of_segments,
+	 1 );
+
+	memory_set(
+	 data,
+	 0xa5,
+	 512 );
+
+	result = segment_writer_write(
+	          segment_writer,
+	          data,
+	          512,
+	          TABLEAU_TEST_SEGMENT_WRITER_SIZE - 512,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = segment_writer_close(
+	          segment_writer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_size = tableau_test_tools_segment_writer_get_file_size(
+	             tableau_test_tools_segment_writer_filenames[ 0 ] );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "file_size",
+	 (int64_t) file_size,
+	 (int64_t) TABLEAU_TEST_SEGMENT_WRITER_SIZE );
+
+	file_size = tableau_test_tools_segment_writer_get_file_size(
+	             tableau_test_tools_segment_writer_filenames[ 1 ] );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT64(
+	 "file_size",
+	 (int64_t) file_size,
+	 (int64_t) -1 );
+
+	/* Clean up
+	 */
+	result = segment_writer_free(
+	          &segment_writer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	tableau_test_tools_segment_writer_remove_files();
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_writer != NULL )
+	{
+		segment_writer_free(
+		 &segment_writer,
+		 NULL );
+	}
+	tableau_test_tools_segment_writer_remove_files();
+
+	return( 0 );
+}
+
+#endif /* defined( HAVE_OPEN ) && defined( HAVE_FCNTL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "segment_writer_initialize",
+	 tableau_test_tools_segment_writer_initialize );
+
+#if defined( HAVE_OPEN ) && defined( HAVE_FCNTL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+	TABLEAU_TEST_RUN(
+	 "segment_writer_write",
+	 tableau_test_tools_segment_writer_write );
+
+	TABLEAU_TEST_RUN(
+	 "segment_writer_open_single_file",
+	 tableau_test_tools_segment_writer_open_single_file );
+
+#endif /* defined( HAVE_OPEN ) && defined( HAVE_FCNTL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
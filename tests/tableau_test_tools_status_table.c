@@ -0,0 +1,1040 @@
+/*
+ * Tools status table functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/status_table.h"
+#include "../tableautools/tableautools_libcthreads.h"
+
+#define TABLEAU_TEST_STATUS_TABLE_NAME			"/tableau_test_status_table"
+#define TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS	4
+#define TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_READERS	3
+#define TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_WRITES	200000
+
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+
+/* Sets the values of a record from a counter, so that a reader can
+ * determine if all the values of a copy belong together
+ */
+void tableau_test_tools_status_table_set_record(
+      status_table_record_t *record,
+      uint32_t counter )
+{
+	memory_set(
+	 record,
+	 0,
+	 sizeof( status_table_record_t ) );
+
+	record->status                  = (uint8_t) ( counter % 3 );
+	record->flags                   = (uint8_t) ( counter & 0x0f );
+	record->drive_number_of_sectors = counter;
+	record->hpa_number_of_sectors   = counter ^ 0xaaaaaaaaUL;
+	record->dco_number_of_sectors   = ~counter;
+	record->latency                 = (uint64_t) counter * 3;
+	record->maximum_latency         = (uint64_t) counter * 5;
+	record->number_of_queries       = (uint64_t) counter;
+	record->number_of_errors        = (uint64_t) counter / 2;
+	record->poll_time               = (uint64_t) counter * 7;
+
+	narrow_string_snprintf(
+	 record->source,
+	 STATUS_TABLE_STRING_SIZE,
+	 "/dev/sg%08" PRIx32 "",
+	 counter );
+
+	narrow_string_snprintf(
+	 record->drive_serial_number,
+	 STATUS_TABLE_STRING_SIZE,
+	 "%08" PRIx32 "",
+	 ~counter );
+}
+
+/* Determines if the values of a record belong to the same counter
+ * Returns 1 if consistent or 0 if not
+ */
+int tableau_test_tools_status_table_record_is_consistent(
+     const status_table_record_t *record )
+{
+	status_table_record_t expected_record;
+
+	uint32_t counter = 0;
+
+	counter = record->drive_number_of_sectors;
+
+	tableau_test_tools_status_table_set_record(
+	 &expected_record,
+	 counter );
+
+	expected_record.sequence = record->sequence;
+
+	if( memory_compare(
+	     &expected_record,
+	     record,
+	     sizeof( status_table_record_t ) ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( STATUS_TABLE_HAVE_SHARED_MEMORY ) */
+
+/* Tests the status_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_status_table_initialize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	status_table_t *status_table = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = status_table_initialize(
+	          &status_table,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "status_table",
+	 status_table );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "status_table->data",
+	 status_table->data );
+
+	result = status_table_free(
+	          &status_table,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "status_table",
+	 status_table );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = status_table_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = status_table_initialize(
+	          &status_table,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = status_table_initialize(
+	          &status_table,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = status_table_free(
+	          &status_table,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = status_table_free(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( status_table != NULL )
+	{
+		status_table_free(
+		 &status_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+
+/* Tests the status_table_create, status_table_open, status_table_write_record
+ * and status_table_read_record functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_status_table_read_write(
+     void )
+{
+	status_table_record_t read_record;
+	status_table_record_t record;
+
+	libcerror_error_t *error            = NULL;
+	status_table_t *reader_status_table = NULL;
+	status_table_t *writer_status_table = NULL;
+	uint32_t number_of_records          = 0;
+	int result                          = 0;
+
+	result = status_table_initialize(
+	          &writer_status_table,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = status_table_initialize(
+	          &reader_status_table,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = status_table_create(
+	          writer_status_table,
+	          TABLEAU_TEST_STATUS_TABLE_NAME,
+	          TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = status_table_open(
+	          reader_status_table,
+	          TABLEAU_TEST_STATUS_TABLE_NAME,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "reader_status_table->maximum_number_of_records",
+	 reader_status_table->maximum_number_of_records,
+	 (uint32_t) TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS );
+
+	result = status_table_get_number_of_records(
+	          reader_status_table,
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 number_of_records,
+	 (uint32_t) 0 );
+
+	tableau_test_tools_status_table_set_record(
+	 &record,
+	 0x12345678UL );
+
+	result = status_table_write_record(
+	          writer_status_table,
+	          1,
+	          &record,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = status_table_set_number_of_records(
+	          writer_status_table,
+	          2,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = status_table_get_number_of_records(
+	          reader_status_table,
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_records",
+	 number_of_records,
+	 (uint32_t) 2 );
+
+	result = status_table_read_record(
+	          reader_status_table,
+	          1,
+	          &read_record,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The sequence is incremented by 2 for every write
+	 */
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "read_record.sequence",
+	 read_record.sequence,
+	 (uint32_t) 2 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "read_record.number_of_queries",
+	 read_record.number_of_queries,
+	 (uint64_t) 0x12345678UL );
+
+	result = tableau_test_tools_status_table_record_is_consistent(
+	          &read_record );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = status_table_read_record(
+	          reader_status_table,
+	          0,
+	          &read_record,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT32(
+	 "read_record.sequence",
+	 read_record.sequence,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = status_table_create(
+	          reader_status_table,
+	          TABLEAU_TEST_STATUS_TABLE_NAME,
+	          TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = status_table_write_record(
+	          reader_status_table,
+	          0,
+	          &record,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = status_table_write_record(
+	          writer_status_table,
+	          TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS,
+	          &record,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = status_table_set_number_of_records(
+	          writer_status_table,
+	          TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS + 1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = status_table_read_record(
+	          reader_status_table,
+	          TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS,
+	          &read_record,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = status_table_read_record(
+	          reader_status_table,
+	          0,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = status_table_close(
+	          reader_status_table,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = status_table_close(
+	          writer_status_table,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The shared memory object is removed when the writer closes it
+	 */
+	result = status_table_open(
+	          reader_status_table,
+	          TABLEAU_TEST_STATUS_TABLE_NAME,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = status_table_create(
+	          writer_status_table,
+	          "tableau_test_status_table",
+	          TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = status_table_create(
+	          writer_status_table,
+	          TABLEAU_TEST_STATUS_TABLE_NAME,
+	          STATUS_TABLE_MAXIMUM_NUMBER_OF_RECORDS + 1,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = status_table_free(
+	          &reader_status_table,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = status_table_free(
+	          &writer_status_table,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reader_status_table != NULL )
+	{
+		status_table_free(
+		 &reader_status_table,
+		 NULL );
+	}
+	if( writer_status_table != NULL )
+	{
+		status_table_free(
+		 &writer_status_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+/* The values shared by the writer and reader threads
+ */
+typedef struct tableau_test_tools_status_table_concurrency tableau_test_tools_status_table_concurrency_t;
+
+struct tableau_test_tools_status_table_concurrency
+{
+	/* The status table created for writing
+	 */
+	status_table_t *writer_status_table;
+
+	/* The status table opened for reading
+	 */
+	status_table_t *reader_status_table;
+
+	/* Value to indicate the writer has finished
+	 */
+	int writer_finished;
+};
+
+/* Writes records with an incrementing counter
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_tools_status_table_writer_callback(
+     tableau_test_tools_status_table_concurrency_t *concurrency )
+{
+	status_table_record_t record;
+
+	uint32_t counter      = 0;
+	uint32_t record_index = 0;
+	int result            = 1;
+
+	for( counter = 1;
+	     counter <= TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_WRITES;
+	     counter++ )
+	{
+		tableau_test_tools_status_table_set_record(
+		 &record,
+		 counter );
+
+		record_index = counter % TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS;
+
+		if( status_table_write_record(
+		     concurrency->writer_status_table,
+		     record_index,
+		     &record,
+		     NULL ) != 1 )
+		{
+			result = -1;
+
+			break;
+		}
+		if( ( counter % 1024 ) == 0 )
+		{
+			if( status_table_set_number_of_records(
+			     concurrency->writer_status_table,
+			     ( counter / 1024 ) % ( TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS + 1 ),
+			     NULL ) != 1 )
+			{
+				result = -1;
+
+				break;
+			}
+		}
+	}
+	__atomic_store_n(
+	 &( concurrency->writer_finished ),
+	 1,
+	 __ATOMIC_RELEASE );
+
+	return( result );
+}
+
+/* Reads records until the writer has finished and checks every copy
+ * Returns 1 if successful or -1 on error
+ */
+int tableau_test_tools_status_table_reader_callback(
+     tableau_test_tools_status_table_concurrency_t *concurrency )
+{
+	status_table_record_t record;
+
+	uint32_t number_of_records = 0;
+	uint32_t record_index      = 0;
+	int result                 = 0;
+
+	while( __atomic_load_n(
+	        &( concurrency->writer_finished ),
+	        __ATOMIC_ACQUIRE ) == 0 )
+	{
+		result = status_table_get_number_of_records(
+		          concurrency->reader_status_table,
+		          &number_of_records,
+		          NULL );
+
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( number_of_records > TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS ) )
+		{
+			return( -1 );
+		}
+		for( record_index = 0;
+		     record_index < TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS;
+		     record_index++ )
+		{
+			result = status_table_read_record(
+			          concurrency->reader_status_table,
+			          record_index,
+			          &record,
+			          NULL );
+
+			if( result == -1 )
+			{
+				return( -1 );
+			}
+			/* A record that was being written is skipped
+			 */
+			else if( result == 0 )
+			{
+				continue;
+			}
+			if( ( record.sequence & 1 ) != 0 )
+			{
+				return( -1 );
+			}
+			if( ( record.sequence != 0 )
+			 && ( tableau_test_tools_status_table_record_is_consistent(
+			       &record ) == 0 ) )
+			{
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Tests a writer and readers that access the status table concurrently
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_status_table_concurrent_access(
+     void )
+{
+	libcthreads_thread_t *reader_threads[ TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_READERS ];
+
+	tableau_test_tools_status_table_concurrency_t concurrency;
+
+	libcerror_error_t *error            = NULL;
+	libcthreads_thread_t *writer_thread = NULL;
+	int reader_index                    = 0;
+	int result                          = 0;
+
+	memory_set(
+	 reader_threads,
+	 0,
+	 sizeof( libcthreads_thread_t * ) * TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_READERS );
+
+	memory_set(
+	 &concurrency,
+	 0,
+	 sizeof( tableau_test_tools_status_table_concurrency_t ) );
+
+	result = status_table_initialize(
+	          &( concurrency.writer_status_table ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = status_table_initialize(
+	          &( concurrency.reader_status_table ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = status_table_create(
+	          concurrency.writer_status_table,
+	          TABLEAU_TEST_STATUS_TABLE_NAME,
+	          TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_RECORDS,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = status_table_open(
+	          concurrency.reader_status_table,
+	          TABLEAU_TEST_STATUS_TABLE_NAME,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( reader_index = 0;
+	     reader_index < TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_READERS;
+	     reader_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( reader_threads[ reader_index ] ),
+		          NULL,
+		          (int (*)(void *)) &tableau_test_tools_status_table_reader_callback,
+		          (void *) &concurrency,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = libcthreads_thread_create(
+	          &writer_thread,
+	          NULL,
+	          (int (*)(void *)) &tableau_test_tools_status_table_writer_callback,
+	          (void *) &concurrency,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcthreads_thread_join(
+	          &writer_thread,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( reader_index = 0;
+	     reader_index < TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_READERS;
+	     reader_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( reader_threads[ reader_index ] ),
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = status_table_free(
+	          &( concurrency.reader_status_table ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = status_table_free(
+	          &( concurrency.writer_status_table ),
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	/* The writer and readers stop once the writer has finished
+	 */
+	if( writer_thread != NULL )
+	{
+		libcthreads_thread_join(
+		 &writer_thread,
+		 NULL );
+	}
+	__atomic_store_n(
+	 &( concurrency.writer_finished ),
+	 1,
+	 __ATOMIC_RELEASE );
+
+	for( reader_index = 0;
+	     reader_index < TABLEAU_TEST_STATUS_TABLE_NUMBER_OF_READERS;
+	     reader_index++ )
+	{
+		if( reader_threads[ reader_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( reader_threads[ reader_index ] ),
+			 NULL );
+		}
+	}
+	if( concurrency.reader_status_table != NULL )
+	{
+		status_table_free(
+		 &( concurrency.reader_status_table ),
+		 NULL );
+	}
+	if( concurrency.writer_status_table != NULL )
+	{
+		status_table_free(
+		 &( concurrency.writer_status_table ),
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( STATUS_TABLE_HAVE_SHARED_MEMORY ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "status_table_initialize",
+	 tableau_test_tools_status_table_initialize );
+
+#if defined( STATUS_TABLE_HAVE_SHARED_MEMORY )
+
+	TABLEAU_TEST_RUN(
+	 "status_table_read_write",
+	 tableau_test_tools_status_table_read_write );
+
+#if defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT )
+
+	TABLEAU_TEST_RUN(
+	 "status_table_concurrent_access",
+	 tableau_test_tools_status_table_concurrent_access );
+
+#endif /* defined( HAVE_TABLEAUTOOLS_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( STATUS_TABLE_HAVE_SHARED_MEMORY ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,387 @@
+/*
+ * Tools storage media buffer functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/storage_media_buffer.h"
+
+#define TABLEAU_TEST_STORAGE_MEDIA_BUFFER_SIZE	8192
+
+/* Tests the storage_media_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_storage_media_buffer_initialize(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	int result                                   = 0;
+
+	/* Test regular cases
+	 */
+	result = storage_media_buffer_initialize(
+	          &storage_media_buffer,
+	          TABLEAU_TEST_STORAGE_MEDIA_BUFFER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "storage_media_buffer",
+	 storage_media_buffer );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "storage_media_buffer->raw_buffer_size",
+	 storage_media_buffer->raw_buffer_size,
+	 (size_t) TABLEAU_TEST_STORAGE_MEDIA_BUFFER_SIZE );
+
+	result = storage_media_buffer_free(
+	          &storage_media_buffer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "storage_media_buffer",
+	 storage_media_buffer );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_initialize(
+	          NULL,
+	          TABLEAU_TEST_STORAGE_MEDIA_BUFFER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the storage_media_buffer_check_for_zero_block function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_storage_media_buffer_check_for_zero_block(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	size_t byte_offset                           = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = storage_media_buffer_initialize(
+	          &storage_media_buffer,
+	          TABLEAU_TEST_STORAGE_MEDIA_BUFFER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "storage_media_buffer",
+	 storage_media_buffer );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          storage_media_buffer->raw_buffer,
+	          0,
+	          TABLEAU_TEST_STORAGE_MEDIA_BUFFER_SIZE ) != NULL;
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	storage_media_buffer->raw_buffer_data_size = TABLEAU_TEST_STORAGE_MEDIA_BUFFER_SIZE;
+
+	/* Test regular cases
+	 */
+	result = storage_media_buffer_check_for_zero_block(
+	          storage_media_buffer,
+	          0,
+	          TABLEAU_TEST_STORAGE_MEDIA_BUFFER_SIZE,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a non-zero byte at every position of an unaligned block
+	 */
+	for( byte_offset = 3;
+	     byte_offset < 3 + 520;
+	     byte_offset++ )
+	{
+		storage_media_buffer->raw_buffer[ byte_offset ] = 0x01;
+
+		result = storage_media_buffer_check_for_zero_block(
+		          storage_media_buffer,
+		          3,
+		          517,
+		          &error );
+
+		storage_media_buffer->raw_buffer[ byte_offset ] = 0;
+
+		if( byte_offset < 3 + 517 )
+		{
+			TABLEAU_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		else
+		{
+			TABLEAU_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a non-zero byte before the block
+	 */
+	storage_media_buffer->raw_buffer[ 4095 ] = 0x80;
+
+	result = storage_media_buffer_check_for_zero_block(
+	          storage_media_buffer,
+	          4096,
+	          4096,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_check_for_zero_block(
+	          storage_media_buffer,
+	          0,
+	          4096,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty block
+	 */
+	result = storage_media_buffer_check_for_zero_block(
+	          storage_media_buffer,
+	          TABLEAU_TEST_STORAGE_MEDIA_BUFFER_SIZE,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_check_for_zero_block(
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_check_for_zero_block(
+	          storage_media_buffer,
+	          TABLEAU_TEST_STORAGE_MEDIA_BUFFER_SIZE + 1,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_check_for_zero_block(
+	          storage_media_buffer,
+	          4096,
+	          4097,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = storage_media_buffer_free(
+	          &storage_media_buffer,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "storage_media_buffer_initialize",
+	 tableau_test_tools_storage_media_buffer_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "storage_media_buffer_check_for_zero_block",
+	 tableau_test_tools_storage_media_buffer_check_for_zero_block );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,850 @@
+/*
+ * Tools tuning cache functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_unused.h"
+
+#include "../tableautools/tuning_cache.h"
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define tableau_test_tools_tuning_cache_remove( filename ) \
+	_wremove( filename )
+#else
+#define tableau_test_tools_tuning_cache_remove( filename ) \
+	remove( filename )
+#endif
+
+/* Tests the tuning_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_tuning_cache_initialize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	tuning_cache_t *tuning_cache = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = tuning_cache_initialize(
+	          &tuning_cache,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "tuning_cache",
+	 tuning_cache );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "tuning_cache->number_of_entries",
+	 tuning_cache->number_of_entries,
+	 0 );
+
+	result = tuning_cache_free(
+	          &tuning_cache,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "tuning_cache",
+	 tuning_cache );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = tuning_cache_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tuning_cache != NULL )
+	{
+		tuning_cache_free(
+		 &tuning_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the tuning_cache_set_entry and tuning_cache_get_entry functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_tuning_cache_set_entry(
+     void )
+{
+	char drive_model[ 64 ];
+
+	libcerror_error_t *error     = NULL;
+	tuning_cache_entry_t *entry  = NULL;
+	tuning_cache_t *tuning_cache = NULL;
+	int entry_index              = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = tuning_cache_initialize(
+	          &tuning_cache,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an entry that does not exist
+	 */
+	result = tuning_cache_get_entry(
+	          tuning_cache,
+	          "T35u",
+	          "Mar 10 2010 10:09:23",
+	          "SATA",
+	          "WDC WD20EARS-00MVWB0",
+	          &entry,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = tuning_cache_set_entry(
+	          tuning_cache,
+	          "T35u",
+	          "Mar 10 2010 10:09:23",
+	          "SATA",
+	          "WDC WD20EARS-00MVWB0",
+	          1048576,
+	          4,
+	          100 * 1024 * 1024,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The same bridge with a PATA drive is a different entry
+	 */
+	result = tuning_cache_set_entry(
+	          tuning_cache,
+	          "T35u",
+	          "Mar 10 2010 10:09:23",
+	          "PATA",
+	          "WDC WD20EARS-00MVWB0",
+	          262144,
+	          1,
+	          40 * 1024 * 1024,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "tuning_cache->number_of_entries",
+	 tuning_cache->number_of_entries,
+	 2 );
+
+	result = tuning_cache_get_entry(
+	          tuning_cache,
+	          "T35u",
+	          "Mar 10 2010 10:09:23",
+	          "SATA",
+	          "WDC WD20EARS-00MVWB0",
+	          &entry,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "entry->process_buffer_size",
+	 entry->process_buffer_size,
+	 (size_t) 1048576 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "entry->number_of_threads",
+	 entry->number_of_threads,
+	 4 );
+
+	/* Test replacing an existing entry
+	 */
+	result = tuning_cache_set_entry(
+	          tuning_cache,
+	          "T35u",
+	          "Mar 10 2010 10:09:23",
+	          "SATA",
+	          "WDC WD20EARS-00MVWB0",
+	          4194304,
+	          8,
+	          120 * 1024 * 1024,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "tuning_cache->number_of_entries",
+	 tuning_cache->number_of_entries,
+	 2 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "entry->process_buffer_size",
+	 entry->process_buffer_size,
+	 (size_t) 4194304 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "entry->number_of_threads",
+	 entry->number_of_threads,
+	 8 );
+
+	/* Test an identification string that contains a field separator
+	 */
+	result = tuning_cache_set_entry(
+	          tuning_cache,
+	          "T35u",
+	          "Mar 10 2010\t10:09:23",
+	          "SATA",
+	          "WDC WD20EARS-00MVWB0",
+	          1048576,
+	          4,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the oldest entry is removed when the cache is full
+	 */
+	for( entry_index = 0;
+	     entry_index < TUNING_CACHE_MAXIMUM_NUMBER_OF_ENTRIES;
+	     entry_index++ )
+	{
+		narrow_string_snprintf(
+		 drive_model,
+		 64,
+		 "Drive %d",
+		 entry_index );
+
+		result = tuning_cache_set_entry(
+		          tuning_cache,
+		          "T8u",
+		          "",
+		          "USB",
+		          drive_model,
+		          65536,
+		          2,
+		          0,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "tuning_cache->number_of_entries",
+	 tuning_cache->number_of_entries,
+	 TUNING_CACHE_MAXIMUM_NUMBER_OF_ENTRIES );
+
+	result = tuning_cache_get_entry(
+	          tuning_cache,
+	          "T35u",
+	          "Mar 10 2010 10:09:23",
+	          "PATA",
+	          "WDC WD20EARS-00MVWB0",
+	          &entry,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = tuning_cache_get_entry(
+	          tuning_cache,
+	          "T8u",
+	          "",
+	          "USB",
+	          "Drive 0",
+	          &entry,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = tuning_cache_set_entry(
+	          NULL,
+	          "T35u",
+	          "Mar 10 2010 10:09:23",
+	          "SATA",
+	          "WDC WD20EARS-00MVWB0",
+	          1048576,
+	          4,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = tuning_cache_set_entry(
+	          tuning_cache,
+	          "T35u",
+	          "Mar 10 2010 10:09:23",
+	          "SATA",
+	          "WDC WD20EARS-00MVWB0",
+	          1048576,
+	          0,
+	          0,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = tuning_cache_get_entry(
+	          tuning_cache,
+	          NULL,
+	          "Mar 10 2010 10:09:23",
+	          "SATA",
+	          "WDC WD20EARS-00MVWB0",
+	          &entry,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = tuning_cache_free(
+	          &tuning_cache,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tuning_cache != NULL )
+	{
+		tuning_cache_free(
+		 &tuning_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the tuning_cache_write and tuning_cache_read functions
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_tools_tuning_cache_read(
+     void )
+{
+	const system_character_t *filename = _SYSTEM_STRING( "tableau_test_tools_tuning_cache.cache" );
+	FILE *file_stream                  = NULL;
+	libcerror_error_t *error           = NULL;
+	tuning_cache_entry_t *entry        = NULL;
+	tuning_cache_t *read_tuning_cache  = NULL;
+	tuning_cache_t *tuning_cache       = NULL;
+	int result                         = 0;
+
+	tableau_test_tools_tuning_cache_remove(
+	 filename );
+
+	/* Initialize test
+	 */
+	result = tuning_cache_initialize(
+	          &tuning_cache,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = tuning_cache_initialize(
+	          &read_tuning_cache,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a tuning cache that does not exist
+	 */
+	result = tuning_cache_read(
+	          read_tuning_cache,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a round trip, including an empty firmware
+	 */
+	result = tuning_cache_set_entry(
+	          tuning_cache,
+	          "T35u",
+	          "Mar 10 2010 10:09:23",
+	          "SATA",
+	          "WDC WD20EARS-00MVWB0",
+	          1048576,
+	          4,
+	          104857600,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = tuning_cache_set_entry(
+	          tuning_cache,
+	          "T8u",
+	          "",
+	          "USB",
+	          "ST3500418AS",
+	          262144,
+	          2,
+	          31457280,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = tuning_cache_write(
+	          tuning_cache,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = tuning_cache_read(
+	          read_tuning_cache,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "read_tuning_cache->number_of_entries",
+	 read_tuning_cache->number_of_entries,
+	 2 );
+
+	result = tuning_cache_get_entry(
+	          read_tuning_cache,
+	          "T8u",
+	          "",
+	          "USB",
+	          "ST3500418AS",
+	          &entry,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "entry->process_buffer_size",
+	 entry->process_buffer_size,
+	 (size_t) 262144 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "entry->number_of_threads",
+	 entry->number_of_threads,
+	 2 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "entry->throughput",
+	 entry->throughput,
+	 (uint64_t) 31457280 );
+
+	result = tuning_cache_get_entry(
+	          read_tuning_cache,
+	          "T35u",
+	          "Mar 10 2010 10:09:23",
+	          "SATA",
+	          "WDC WD20EARS-00MVWB0",
+	          &entry,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_SIZE(
+	 "entry->process_buffer_size",
+	 entry->process_buffer_size,
+	 (size_t) 1048576 );
+
+	/* Test a tuning cache with an entry that misses the drive model
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"w" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "w" );
+#endif
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	fprintf(
+	 file_stream,
+	 "version\t0x1\nentry\t0x00100000\t0x4\t0x06400000\tT35u\tMar 10 2010 10:09:23\tSATA\n" );
+
+	file_stream_close(
+	 file_stream );
+
+	result = tuning_cache_read(
+	          read_tuning_cache,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "read_tuning_cache->number_of_entries",
+	 read_tuning_cache->number_of_entries,
+	 0 );
+
+	/* Test a tuning cache without a version
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               L"w" );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               "w" );
+#endif
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	fprintf(
+	 file_stream,
+	 "entry\t0x00100000\t0x4\t0x06400000\tT35u\tMar 10 2010 10:09:23\tSATA\tST3500418AS\n" );
+
+	file_stream_close(
+	 file_stream );
+
+	result = tuning_cache_read(
+	          read_tuning_cache,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = tuning_cache_read(
+	          NULL,
+	          filename,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = tuning_cache_write(
+	          tuning_cache,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = tuning_cache_free(
+	          &read_tuning_cache,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = tuning_cache_free(
+	          &tuning_cache,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	tableau_test_tools_tuning_cache_remove(
+	 filename );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_tuning_cache != NULL )
+	{
+		tuning_cache_free(
+		 &read_tuning_cache,
+		 NULL );
+	}
+	if( tuning_cache != NULL )
+	{
+		tuning_cache_free(
+		 &tuning_cache,
+		 NULL );
+	}
+	tableau_test_tools_tuning_cache_remove(
+	 filename );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+	TABLEAU_TEST_RUN(
+	 "tuning_cache_initialize",
+	 tableau_test_tools_tuning_cache_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "tuning_cache_set_entry",
+	 tableau_test_tools_tuning_cache_set_entry );
+
+	TABLEAU_TEST_RUN(
+	 "tuning_cache_read",
+	 tableau_test_tools_tuning_cache_read );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,908 @@
+/*
+ * Library trace type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "tableau_test_libcerror.h"
+#include "tableau_test_libtableau.h"
+#include "tableau_test_macros.h"
+#include "tableau_test_memory.h"
+#include "tableau_test_unused.h"
+
+#include "../libtableau/libtableau_definitions.h"
+#include "../libtableau/libtableau_trace.h"
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+/* Tests the libtableau_trace_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_trace_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libtableau_trace_t *trace       = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_TABLEAU_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libtableau_trace_initialize(
+	          &trace,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "trace",
+	 trace );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_trace_free(
+	          &trace,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "trace",
+	 trace );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_trace_initialize(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	trace = (libtableau_trace_t *) 0x12345678UL;
+
+	result = libtableau_trace_initialize(
+	          &trace,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	trace = NULL;
+
+#if defined( HAVE_TABLEAU_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libtableau_trace_initialize with malloc failing
+		 */
+		tableau_test_malloc_attempts_before_fail = test_number;
+
+		result = libtableau_trace_initialize(
+		          &trace,
+		          &error );
+
+		if( tableau_test_malloc_attempts_before_fail != -1 )
+		{
+			tableau_test_malloc_attempts_before_fail = -1;
+
+			if( trace != NULL )
+			{
+				libtableau_trace_free(
+				 &trace,
+				 NULL );
+			}
+		}
+		else
+		{
+			TABLEAU_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			TABLEAU_TEST_ASSERT_IS_NULL(
+			 "trace",
+			 trace );
+
+			TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libtableau_trace_initialize with memset failing
+		 */
+		tableau_test_memset_attempts_before_fail = test_number;
+
+		result = libtableau_trace_initialize(
+		          &trace,
+		          &error );
+
+		if( tableau_test_memset_attempts_before_fail != -1 )
+		{
+			tableau_test_memset_attempts_before_fail = -1;
+
+			if( trace != NULL )
+			{
+				libtableau_trace_free(
+				 &trace,
+				 NULL );
+			}
+		}
+		else
+		{
+			TABLEAU_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			TABLEAU_TEST_ASSERT_IS_NULL(
+			 "trace",
+			 trace );
+
+			TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_TABLEAU_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace != NULL )
+	{
+		libtableau_trace_free(
+		 &trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_trace_free function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_trace_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libtableau_trace_free(
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_trace_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_trace_append_record(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libtableau_trace_t *trace = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_trace_initialize(
+	          &trace,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "trace",
+	 trace );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_trace_append_record(
+	          trace,
+	          LIBTABLEAU_TRACE_PHASE_OPEN_START,
+	          1000,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "trace->number_of_appended_records",
+	 trace->number_of_appended_records,
+	 (uint64_t) 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_trace_append_record(
+	          NULL,
+	          LIBTABLEAU_TRACE_PHASE_OPEN_START,
+	          1000,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_trace_free(
+	          &trace,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "trace",
+	 trace );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace != NULL )
+	{
+		libtableau_trace_free(
+		 &trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_trace_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_trace_get_number_of_records(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libtableau_trace_t *trace = NULL;
+	int number_of_records     = 0;
+	int record_number         = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_trace_initialize(
+	          &trace,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "trace",
+	 trace );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_trace_get_number_of_records(
+	          trace,
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the number of records is limited once the trace is full
+	 */
+	for( record_number = 0;
+	     record_number < ( LIBTABLEAU_TRACE_NUMBER_OF_RECORDS + 6 );
+	     record_number++ )
+	{
+		result = libtableau_trace_append_record(
+		          trace,
+		          LIBTABLEAU_TRACE_PHASE_QUERY_START,
+		          (uint64_t) record_number,
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libtableau_trace_get_number_of_records(
+	          trace,
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 LIBTABLEAU_TRACE_NUMBER_OF_RECORDS );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_trace_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_trace_get_number_of_records(
+	          trace,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_trace_free(
+	          &trace,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "trace",
+	 trace );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace != NULL )
+	{
+		libtableau_trace_free(
+		 &trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libtableau_trace_get_record_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int tableau_test_trace_get_record_by_index(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libtableau_trace_t *trace = NULL;
+	uint64_t timestamp        = 0;
+	uint8_t phase             = 0;
+	int record_number         = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libtableau_trace_initialize(
+	          &trace,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "trace",
+	 trace );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_trace_append_record(
+	          trace,
+	          LIBTABLEAU_TRACE_PHASE_OPEN_START,
+	          1000,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_trace_append_record(
+	          trace,
+	          LIBTABLEAU_TRACE_PHASE_OPEN_END,
+	          2000,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libtableau_trace_get_record_by_index(
+	          trace,
+	          0,
+	          &phase,
+	          &timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "phase",
+	 phase,
+	 LIBTABLEAU_TRACE_PHASE_OPEN_START );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 1000 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_trace_get_record_by_index(
+	          trace,
+	          1,
+	          &phase,
+	          &timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "phase",
+	 phase,
+	 LIBTABLEAU_TRACE_PHASE_OPEN_END );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 2000 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the oldest records are overwritten once the trace is full
+	 */
+	for( record_number = 2;
+	     record_number < ( LIBTABLEAU_TRACE_NUMBER_OF_RECORDS + 6 );
+	     record_number++ )
+	{
+		result = libtableau_trace_append_record(
+		          trace,
+		          LIBTABLEAU_TRACE_PHASE_QUERY_END,
+		          (uint64_t) ( ( record_number + 1 ) * 1000 ),
+		          &error );
+
+		TABLEAU_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		TABLEAU_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libtableau_trace_get_record_by_index(
+	          trace,
+	          0,
+	          &phase,
+	          &timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT8(
+	 "phase",
+	 phase,
+	 LIBTABLEAU_TRACE_PHASE_QUERY_END );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 7000 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libtableau_trace_get_record_by_index(
+	          trace,
+	          LIBTABLEAU_TRACE_NUMBER_OF_RECORDS - 1,
+	          &phase,
+	          &timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) ( ( LIBTABLEAU_TRACE_NUMBER_OF_RECORDS + 6 ) * 1000 ) );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libtableau_trace_get_record_by_index(
+	          NULL,
+	          0,
+	          &phase,
+	          &timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_trace_get_record_by_index(
+	          trace,
+	          -1,
+	          &phase,
+	          &timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_trace_get_record_by_index(
+	          trace,
+	          LIBTABLEAU_TRACE_NUMBER_OF_RECORDS,
+	          &phase,
+	          &timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_trace_get_record_by_index(
+	          trace,
+	          0,
+	          NULL,
+	          &timestamp,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libtableau_trace_get_record_by_index(
+	          trace,
+	          0,
+	          &phase,
+	          NULL,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	TABLEAU_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libtableau_trace_free(
+	          &trace,
+	          &error );
+
+	TABLEAU_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "trace",
+	 trace );
+
+	TABLEAU_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace != NULL )
+	{
+		libtableau_trace_free(
+		 &trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc TABLEAU_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] TABLEAU_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argc )
+	TABLEAU_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT )
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_trace_initialize",
+	 tableau_test_trace_initialize );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_trace_free",
+	 tableau_test_trace_free );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_trace_append_record",
+	 tableau_test_trace_append_record );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_trace_get_number_of_records",
+	 tableau_test_trace_get_number_of_records );
+
+	TABLEAU_TEST_RUN(
+	 "libtableau_trace_get_record_by_index",
+	 tableau_test_trace_get_record_by_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBTABLEAU_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
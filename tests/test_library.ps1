@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "error notify handle security_values support values_table"
+$LibraryTests = "error notify benchmark debug_trace extent handle io io_queue security_values string support trace values_table"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 
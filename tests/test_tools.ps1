@@ -0,0 +1,55 @@
+# Tests tools functions and types.
+
+$ToolsTests = "tools_checkpoint tools_chunk_compressor tools_control_policy tools_daemon_server tools_daemon_state tools_digest_pipeline tools_host_topology tools_info_benchmark tools_info_inventory tools_info_record tools_info_watch tools_metrics_record tools_metrics_textfile tools_rescue_map tools_segment_writer tools_status_table tools_storage_media_buffer tools_tuning_cache"
+$ToolsTestsWithInput = ""
+$OptionSets = "" -split " "
+
+. .\test_functions.ps1
+
+$TestExecutablesDirectory = GetTestExecutablesDirectory
+
+If (-Not (Test-Path ${TestExecutablesDirectory}))
+{
+	Write-Error "Missing test executables directory"
+
+	Exit ${ExitFailure}
+}
+
+$Result = ${ExitSuccess}
+
+Foreach (${TestName} in ${ToolsTests} -split " ")
+{
+	# Split will return an array of a single empty string when ToolsTests is empty.
+	If (-Not (${TestName}))
+	{
+		Continue
+	}
+	$ResultRun = RunTestBinary ${TestExecutablesDirectory} "tableau_test_${TestName}"
+
+	If ((${ResultRun} -ne ${ExitSuccess}) -And (${ResultRun} -ne ${ExitIgnore}))
+	{
+		$Result = ${ResultRun}
+	}
+}
+
+$TestInputs = GenerateTestInputs "libtableau" ${OptionSets}
+
+Foreach (${TestName} in ${ToolsTestsWithInput} -split " ")
+{
+	# Split will return an array of a single empty string when ToolsTestsWithInput is empty.
+	If (-Not (${TestName}))
+	{
+		Continue
+	}
+	ForEach ($TestInput in ${TestInputs})
+	{
+		$ResultRun = RunTestBinaryWithInput ${TestExecutablesDirectory} "tableau_test_${TestName}" ${TestInput}
+
+		If ((${ResultRun} -ne ${ExitSuccess}) -And (${ResultRun} -ne ${ExitIgnore}))
+		{
+			$Result = ${ResultRun}
+		}
+	}
+}
+
+Exit ${Result}